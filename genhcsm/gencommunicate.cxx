@@ -13,19 +13,22 @@
 #include "gencommunicate.h"
 #include <genericinclude.h>
 #include <hcsmcollection.h>
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////
 // CDialint
 //////////////////////////////////////////////////////////////
 
-CDialint::CDialint( CHcsmCollection* pRootCollection, string name ):
+CDialint::CDialint( CHcsmCollection* pRootCollection, const string& name ):
     CDial( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CDialint::CDialint( const CDialint& objToCopy ):
-    CDial( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CDial( objToCopy )
 {
 
     // call the assignment operator
@@ -42,8 +45,9 @@ CDialint& CDialint::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -67,7 +71,7 @@ int CDialint::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -77,37 +81,14 @@ int CDialint::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CDialint::GetValueStr()
 {
     string strValue = "";
-    int curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    int curValue = GetValue();
     
     sprintf(&*strValue.begin(), "%d", curValue);
     return strValue;
@@ -119,8 +100,11 @@ void CDialint::SetValue( int value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
@@ -132,25 +116,43 @@ void CDialint::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = atoi(value.c_str());
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = atoi(value.c_str());
     }
     
     CDial::SetValue();
 }
 
+void CDialint::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CDial::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CDialint::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CDial::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CDialdouble
 //////////////////////////////////////////////////////////////
 
-CDialdouble::CDialdouble( CHcsmCollection* pRootCollection, string name ):
+CDialdouble::CDialdouble( CHcsmCollection* pRootCollection, const string& name ):
     CDial( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CDialdouble::CDialdouble( const CDialdouble& objToCopy ):
-    CDial( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CDial( objToCopy )
 {
 
     // call the assignment operator
@@ -167,8 +169,9 @@ CDialdouble& CDialdouble::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -192,7 +195,7 @@ double CDialdouble::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -202,37 +205,14 @@ double CDialdouble::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CDialdouble::GetValueStr()
 {
     string strValue = "";
-    double curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    double curValue = GetValue();
     
     sprintf(&*strValue.begin(), "%lf", curValue);
     return strValue;
@@ -244,8 +224,11 @@ void CDialdouble::SetValue( double value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
@@ -257,25 +240,43 @@ void CDialdouble::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = atof(value.c_str());
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = atof(value.c_str());
     }
     
     CDial::SetValue();
 }
 
+void CDialdouble::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CDial::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CDialdouble::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CDial::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CDialstring
 //////////////////////////////////////////////////////////////
 
-CDialstring::CDialstring( CHcsmCollection* pRootCollection, string name ):
+CDialstring::CDialstring( CHcsmCollection* pRootCollection, const string& name ):
     CDial( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CDialstring::CDialstring( const CDialstring& objToCopy ):
-    CDial( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CDial( objToCopy )
 {
 
     // call the assignment operator
@@ -292,8 +293,9 @@ CDialstring& CDialstring::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -306,7 +308,7 @@ CDialstring::~CDialstring()
 
 }
 
-string CDialstring::GetValue()
+const string& CDialstring::GetValue()
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( writtenThisFrame )
@@ -317,7 +319,7 @@ string CDialstring::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -327,50 +329,30 @@ string CDialstring::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CDialstring::GetValueStr()
 {
     string strValue = "";
-    string curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    string curValue = GetValue();
     
     strValue = curValue;
     return strValue;
 
 }
 
-void CDialstring::SetValue( string value )
+void CDialstring::SetValue( const string& value )
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
@@ -382,25 +364,43 @@ void CDialstring::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
 }
 
+void CDialstring::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CDial::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CDialstring::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CDial::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CDialfloat
 //////////////////////////////////////////////////////////////
 
-CDialfloat::CDialfloat( CHcsmCollection* pRootCollection, string name ):
+CDialfloat::CDialfloat( CHcsmCollection* pRootCollection, const string& name ):
     CDial( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CDialfloat::CDialfloat( const CDialfloat& objToCopy ):
-    CDial( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CDial( objToCopy )
 {
 
     // call the assignment operator
@@ -417,8 +417,9 @@ CDialfloat& CDialfloat::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -442,7 +443,7 @@ float CDialfloat::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -452,37 +453,14 @@ float CDialfloat::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CDialfloat::GetValueStr()
 {
     string strValue = "";
-    float curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    float curValue = GetValue();
     
     sprintf(&*strValue.begin(), "%f", curValue);
     return strValue;
@@ -494,8 +472,11 @@ void CDialfloat::SetValue( float value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
@@ -507,25 +488,43 @@ void CDialfloat::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = atof(value.c_str());
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = atof(value.c_str());
     }
     
     CDial::SetValue();
 }
 
+void CDialfloat::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CDial::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CDialfloat::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CDial::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CDialbool
 //////////////////////////////////////////////////////////////
 
-CDialbool::CDialbool( CHcsmCollection* pRootCollection, string name ):
+CDialbool::CDialbool( CHcsmCollection* pRootCollection, const string& name ):
     CDial( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CDialbool::CDialbool( const CDialbool& objToCopy ):
-    CDial( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CDial( objToCopy )
 {
 
     // call the assignment operator
@@ -542,8 +541,9 @@ CDialbool& CDialbool::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -567,7 +567,7 @@ bool CDialbool::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -577,37 +577,14 @@ bool CDialbool::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CDialbool::GetValueStr()
 {
     string strValue = "";
-    bool curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    bool curValue = GetValue();
     
     strValue = (curValue? "true" : "false");
     return strValue;
@@ -619,8 +596,11 @@ void CDialbool::SetValue( bool value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CDial::SetValue();
@@ -632,25 +612,43 @@ void CDialbool::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = (value == "true");
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = (value == "true");
     }
     
     CDial::SetValue();
 }
 
+void CDialbool::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CDial::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CDialbool::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CDial::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CMonitorCRoadPos
 //////////////////////////////////////////////////////////////
 
-CMonitorCRoadPos::CMonitorCRoadPos( CHcsmCollection* pRootCollection, string name ):
+CMonitorCRoadPos::CMonitorCRoadPos( CHcsmCollection* pRootCollection, const string& name ):
     CMonitor( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CMonitorCRoadPos::CMonitorCRoadPos( const CMonitorCRoadPos& objToCopy ):
-    CMonitor( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CMonitor( objToCopy )
 {
 
     // call the assignment operator
@@ -667,8 +665,9 @@ CMonitorCRoadPos& CMonitorCRoadPos::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -681,7 +680,7 @@ CMonitorCRoadPos::~CMonitorCRoadPos()
 
 }
 
-CRoadPos CMonitorCRoadPos::GetValue()
+const CRoadPos& CMonitorCRoadPos::GetValue()
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( writtenThisFrame )
@@ -692,7 +691,7 @@ CRoadPos CMonitorCRoadPos::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -702,50 +701,30 @@ CRoadPos CMonitorCRoadPos::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CMonitorCRoadPos::GetValueStr()
 {
     string strValue = "";
-    CRoadPos curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    CRoadPos curValue = GetValue();
     
     strValue = curValue.GetString();
     return strValue;
 
 }
 
-void CMonitorCRoadPos::SetValue( CRoadPos value )
+void CMonitorCRoadPos::SetValue( const CRoadPos& value )
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
@@ -757,25 +736,55 @@ void CMonitorCRoadPos::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA.SetString(value);
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA].SetString(value);
     }
     
     CMonitor::SetValue();
 }
 
+void CMonitorCRoadPos::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::SaveState( ckpt );
+    ckpt.Put( m_prevValue.GetString() );
+    ckpt.Put( m_values[m_idxA].GetString() );
+    ckpt.Put( m_values[1 - m_idxA].GetString() );
+}
+
+void CMonitorCRoadPos::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::RestoreState( ckpt );
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_prevValue.SetString( str );
+    }
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_values[m_idxA].SetString( str );
+    }
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_values[1 - m_idxA].SetString( str );
+    }
+}
+
 //////////////////////////////////////////////////////////////
 // CMonitorCCrdr
 //////////////////////////////////////////////////////////////
 
-CMonitorCCrdr::CMonitorCCrdr( CHcsmCollection* pRootCollection, string name ):
+CMonitorCCrdr::CMonitorCCrdr( CHcsmCollection* pRootCollection, const string& name ):
     CMonitor( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CMonitorCCrdr::CMonitorCCrdr( const CMonitorCCrdr& objToCopy ):
-    CMonitor( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CMonitor( objToCopy )
 {
 
     // call the assignment operator
@@ -792,8 +801,9 @@ CMonitorCCrdr& CMonitorCCrdr::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -806,7 +816,7 @@ CMonitorCCrdr::~CMonitorCCrdr()
 
 }
 
-CCrdr CMonitorCCrdr::GetValue()
+const CCrdr& CMonitorCCrdr::GetValue()
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( writtenThisFrame )
@@ -817,7 +827,7 @@ CCrdr CMonitorCCrdr::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -827,50 +837,30 @@ CCrdr CMonitorCCrdr::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CMonitorCCrdr::GetValueStr()
 {
     string strValue = "";
-    CCrdr curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    CCrdr curValue = GetValue();
     
     strValue = curValue.GetString();
     return strValue;
 
 }
 
-void CMonitorCCrdr::SetValue( CCrdr value )
+void CMonitorCCrdr::SetValue( const CCrdr& value )
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
@@ -882,25 +872,55 @@ void CMonitorCCrdr::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA.SetString(value);
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA].SetString(value);
     }
     
     CMonitor::SetValue();
 }
 
+void CMonitorCCrdr::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::SaveState( ckpt );
+    ckpt.Put( m_prevValue.GetString() );
+    ckpt.Put( m_values[m_idxA].GetString() );
+    ckpt.Put( m_values[1 - m_idxA].GetString() );
+}
+
+void CMonitorCCrdr::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::RestoreState( ckpt );
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_prevValue.SetString( str );
+    }
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_values[m_idxA].SetString( str );
+    }
+    {
+        string str;
+        ckpt.Get( str );
+        if ( !str.empty() ) m_values[1 - m_idxA].SetString( str );
+    }
+}
+
 //////////////////////////////////////////////////////////////
 // CMonitorint
 //////////////////////////////////////////////////////////////
 
-CMonitorint::CMonitorint( CHcsmCollection* pRootCollection, string name ):
+CMonitorint::CMonitorint( CHcsmCollection* pRootCollection, const string& name ):
     CMonitor( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CMonitorint::CMonitorint( const CMonitorint& objToCopy ):
-    CMonitor( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CMonitor( objToCopy )
 {
 
     // call the assignment operator
@@ -917,8 +937,9 @@ CMonitorint& CMonitorint::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -942,7 +963,7 @@ int CMonitorint::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -952,37 +973,14 @@ int CMonitorint::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CMonitorint::GetValueStr()
 {
     string strValue = "";
-    int curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    int curValue = GetValue();
     
     sprintf(&*strValue.begin(), "%d", curValue);
     return strValue;
@@ -994,8 +992,11 @@ void CMonitorint::SetValue( int value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
@@ -1007,25 +1008,43 @@ void CMonitorint::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = atoi(value.c_str());
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = atoi(value.c_str());
     }
     
     CMonitor::SetValue();
 }
 
+void CMonitorint::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CMonitorint::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CMonitorbool
 //////////////////////////////////////////////////////////////
 
-CMonitorbool::CMonitorbool( CHcsmCollection* pRootCollection, string name ):
+CMonitorbool::CMonitorbool( CHcsmCollection* pRootCollection, const string& name ):
     CMonitor( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CMonitorbool::CMonitorbool( const CMonitorbool& objToCopy ):
-    CMonitor( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CMonitor( objToCopy )
 {
 
     // call the assignment operator
@@ -1042,8 +1061,9 @@ CMonitorbool& CMonitorbool::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -1067,7 +1087,7 @@ bool CMonitorbool::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -1077,37 +1097,14 @@ bool CMonitorbool::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CMonitorbool::GetValueStr()
 {
     string strValue = "";
-    bool curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    bool curValue = GetValue();
     
     strValue = (curValue? "true" : "false");
     return strValue;
@@ -1119,8 +1116,11 @@ void CMonitorbool::SetValue( bool value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
@@ -1132,25 +1132,43 @@ void CMonitorbool::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = (value == "true");
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = (value == "true");
     }
     
     CMonitor::SetValue();
 }
 
+void CMonitorbool::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CMonitorbool::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
 //////////////////////////////////////////////////////////////
 // CMonitorstring
 //////////////////////////////////////////////////////////////
 
-CMonitorstring::CMonitorstring( CHcsmCollection* pRootCollection, string name ):
+CMonitorstring::CMonitorstring( CHcsmCollection* pRootCollection, const string& name ):
     CMonitor( pRootCollection, name )
 {
 
+    m_idxA = 0;
+
 }
 
 CMonitorstring::CMonitorstring( const CMonitorstring& objToCopy ):
-    CMonitor( objToCopy.m_pRootCollection, objToCopy.m_name )
+    CMonitor( objToCopy )
 {
 
     // call the assignment operator
@@ -1167,8 +1185,9 @@ CMonitorstring& CMonitorstring::operator=(
     if ( this != &objToCopy ) {
 
         // make a deep copy
-        m_valueA = objToCopy.m_valueA;
-        m_valueB = objToCopy.m_valueB;
+        m_values[0] = objToCopy.m_values[0];
+        m_values[1] = objToCopy.m_values[1];
+        m_idxA = objToCopy.m_idxA;
 
     }
 
@@ -1181,7 +1200,7 @@ CMonitorstring::~CMonitorstring()
 
 }
 
-string CMonitorstring::GetValue()
+const string& CMonitorstring::GetValue()
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( writtenThisFrame )
@@ -1192,7 +1211,7 @@ string CMonitorstring::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueB;
+        return m_values[1 - m_idxA];
     }
     else
     {
@@ -1202,50 +1221,30 @@ string CMonitorstring::GetValue()
             cerr << MyName() << "::GetValue: dial has no value" << endl;
         }
 
-        return m_valueA;
+        return m_values[m_idxA];
     }
 }
 
 string CMonitorstring::GetValueStr()
 {
     string strValue = "";
-    string curValue;
-
-
-    bool writtenThisFrame = m_setFrame == GetFrame();
-    if( writtenThisFrame )
-    {
-        // make sure that dial has a value
-        if( !m_hasValueB )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueB;
-    }
-    else
-    {
-        // make sure that dial has a value
-        if( !m_hasValueA )
-        {
-            cerr << MyName() << "::GetValue: dial has no value" << endl;
-        }
-
-        curValue = m_valueA;
-    }
+    string curValue = GetValue();
     
     strValue = curValue;
     return strValue;
 
 }
 
-void CMonitorstring::SetValue( string value )
+void CMonitorstring::SetValue( const string& value )
 {
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        // the new value goes into the older buffer, so a value
+        // borrowed earlier in this frame stays intact, as B, until
+        // the next frame's write
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
@@ -1257,10 +1256,26 @@ void CMonitorstring::SetValueStr( const string& value )
     bool writtenThisFrame = m_setFrame == GetFrame();
     if( !writtenThisFrame )
     {
-        m_valueB = m_valueA;
-        m_valueA = value;
+        m_idxA = 1 - m_idxA;
+        m_values[m_idxA] = value;
     }
     
     CMonitor::SetValue();
 }
 
+void CMonitorstring::SaveState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::SaveState( ckpt );
+    ckpt.Put( m_prevValue );
+    ckpt.Put( m_values[m_idxA] );
+    ckpt.Put( m_values[1 - m_idxA] );
+}
+
+void CMonitorstring::RestoreState( CHcsmCheckpoint& ckpt )
+{
+    CMonitor::RestoreState( ckpt );
+    ckpt.Get( m_prevValue );
+    ckpt.Get( m_values[m_idxA] );
+    ckpt.Get( m_values[1 - m_idxA] );
+}
+
@@ -26,7 +26,7 @@ using namespace std;
 class CDialint : public CDial
 {
 public:
-    CDialint( CHcsmCollection*, string );
+    CDialint( CHcsmCollection*, const string& );
     CDialint( const CDialint& );
     CDialint& operator=( const CDialint& );
     virtual ~CDialint(); 
@@ -34,11 +34,13 @@ public:
     string GetValueStr();
     void SetValue( int );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     int m_prevValue;
-    int m_valueA;
-    int m_valueB;
+    int m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -48,7 +50,7 @@ private:
 class CDialdouble : public CDial
 {
 public:
-    CDialdouble( CHcsmCollection*, string );
+    CDialdouble( CHcsmCollection*, const string& );
     CDialdouble( const CDialdouble& );
     CDialdouble& operator=( const CDialdouble& );
     virtual ~CDialdouble(); 
@@ -56,11 +58,13 @@ public:
     string GetValueStr();
     void SetValue( double );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     double m_prevValue;
-    double m_valueA;
-    double m_valueB;
+    double m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -70,19 +74,21 @@ private:
 class CDialstring : public CDial
 {
 public:
-    CDialstring( CHcsmCollection*, string );
+    CDialstring( CHcsmCollection*, const string& );
     CDialstring( const CDialstring& );
     CDialstring& operator=( const CDialstring& );
     virtual ~CDialstring(); 
-    string GetValue();
+    const string& GetValue();
     string GetValueStr();
-    void SetValue( string );
+    void SetValue( const string& );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     string m_prevValue;
-    string m_valueA;
-    string m_valueB;
+    string m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -92,7 +98,7 @@ private:
 class CDialfloat : public CDial
 {
 public:
-    CDialfloat( CHcsmCollection*, string );
+    CDialfloat( CHcsmCollection*, const string& );
     CDialfloat( const CDialfloat& );
     CDialfloat& operator=( const CDialfloat& );
     virtual ~CDialfloat(); 
@@ -100,11 +106,13 @@ public:
     string GetValueStr();
     void SetValue( float );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     float m_prevValue;
-    float m_valueA;
-    float m_valueB;
+    float m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -114,7 +122,7 @@ private:
 class CDialbool : public CDial
 {
 public:
-    CDialbool( CHcsmCollection*, string );
+    CDialbool( CHcsmCollection*, const string& );
     CDialbool( const CDialbool& );
     CDialbool& operator=( const CDialbool& );
     virtual ~CDialbool(); 
@@ -122,11 +130,13 @@ public:
     string GetValueStr();
     void SetValue( bool );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     bool m_prevValue;
-    bool m_valueA;
-    bool m_valueB;
+    bool m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -136,19 +146,21 @@ private:
 class CMonitorCRoadPos : public CMonitor
 {
 public:
-    CMonitorCRoadPos( CHcsmCollection*, string );
+    CMonitorCRoadPos( CHcsmCollection*, const string& );
     CMonitorCRoadPos( const CMonitorCRoadPos& );
     CMonitorCRoadPos& operator=( const CMonitorCRoadPos& );
     virtual ~CMonitorCRoadPos(); 
-    CRoadPos GetValue();
+    const CRoadPos& GetValue();
     string GetValueStr();
-    void SetValue( CRoadPos );
+    void SetValue( const CRoadPos& );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     CRoadPos m_prevValue;
-    CRoadPos m_valueA;
-    CRoadPos m_valueB;
+    CRoadPos m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -158,19 +170,21 @@ private:
 class CMonitorCCrdr : public CMonitor
 {
 public:
-    CMonitorCCrdr( CHcsmCollection*, string );
+    CMonitorCCrdr( CHcsmCollection*, const string& );
     CMonitorCCrdr( const CMonitorCCrdr& );
     CMonitorCCrdr& operator=( const CMonitorCCrdr& );
     virtual ~CMonitorCCrdr(); 
-    CCrdr GetValue();
+    const CCrdr& GetValue();
     string GetValueStr();
-    void SetValue( CCrdr );
+    void SetValue( const CCrdr& );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     CCrdr m_prevValue;
-    CCrdr m_valueA;
-    CCrdr m_valueB;
+    CCrdr m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -180,7 +194,7 @@ private:
 class CMonitorint : public CMonitor
 {
 public:
-    CMonitorint( CHcsmCollection*, string );
+    CMonitorint( CHcsmCollection*, const string& );
     CMonitorint( const CMonitorint& );
     CMonitorint& operator=( const CMonitorint& );
     virtual ~CMonitorint(); 
@@ -188,11 +202,13 @@ public:
     string GetValueStr();
     void SetValue( int );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     int m_prevValue;
-    int m_valueA;
-    int m_valueB;
+    int m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -202,7 +218,7 @@ private:
 class CMonitorbool : public CMonitor
 {
 public:
-    CMonitorbool( CHcsmCollection*, string );
+    CMonitorbool( CHcsmCollection*, const string& );
     CMonitorbool( const CMonitorbool& );
     CMonitorbool& operator=( const CMonitorbool& );
     virtual ~CMonitorbool(); 
@@ -210,11 +226,13 @@ public:
     string GetValueStr();
     void SetValue( bool );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     bool m_prevValue;
-    bool m_valueA;
-    bool m_valueB;
+    bool m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 //////////////////////////////////////////////////////////////
@@ -224,19 +242,21 @@ private:
 class CMonitorstring : public CMonitor
 {
 public:
-    CMonitorstring( CHcsmCollection*, string );
+    CMonitorstring( CHcsmCollection*, const string& );
     CMonitorstring( const CMonitorstring& );
     CMonitorstring& operator=( const CMonitorstring& );
     virtual ~CMonitorstring(); 
-    string GetValue();
+    const string& GetValue();
     string GetValueStr();
-    void SetValue( string );
+    void SetValue( const string& );
     void SetValueStr(const string &);
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     string m_prevValue;
-    string m_valueA;
-    string m_valueB;
+    string m_values[2];
+    int m_idxA;  // m_values[m_idxA] is A, the other one B
 };
 
 
@@ -22,6 +22,49 @@
 #include "gencommunicate.h"
 #include "button.h"
 
+// HCSM template ids, see CHcsmCollection::CreateHcsm
+enum EHcsmTemplateId {
+    eHCSM_Ddo,
+    eHCSM_VirtualObject,
+    eHCSM_TimeTrigger,
+    eHCSM_GmtrcPstnTrigger,
+    eHCSM_TrffcLghtTrigger,
+    eHCSM_RoadPadTrigger,
+    eHCSM_ExpressionTrigger,
+    eHCSM_FollowTrigger,
+    eHCSM_TimeToArrvlTrigger,
+    eHCSM_Gateway,
+    eHCSM_Ado,
+    eHCSM_Autonomous,
+    eHCSM_RemoteControl,
+    eHCSM_FreeDrive,
+    eHCSM_Follow,
+    eHCSM_LaneChange,
+    eHCSM_LcMonitor,
+    eHCSM_LcSignal,
+    eHCSM_LcExecute,
+    eHCSM_LcAbort,
+    eHCSM_LcExecuteNeutralize,
+    eHCSM_LcExecuteIncrement,
+    eHCSM_LcExecuteSteady,
+    eHCSM_LcExecuteDecrement,
+    eHCSM_NavigateIntrsctn,
+    eHCSM_Merge,
+    eHCSM_EnvironmentController,
+    eHCSM_EnviroInfo,
+    eHCSM_IntersectionManager,
+    eHCSM_OwnVehicleMirror,
+    eHCSM_StaticObjManager,
+    eHCSM_TrafficLightManager,
+    eHCSM_TrafficManager,
+    eHCSM_TrafficSource,
+    eHCSM_VehFail,
+    eHCSM_DriverMirror,
+    eHCSM_TrafficData,
+    eHCSM_DaqDriver,
+    eHCSM_NUM_TEMPLATES
+};
+
 class CDdo : public CHcsmConcurrent
 {
 public:
@@ -29,6 +72,8 @@ public:
     CDdo( const CDdo& );
     CDdo& operator=( const CDdo& );
     virtual ~CDdo();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetDialAudioState( int );
     void SetDialAudioStateNoValue();
     void SetDialVisualState( int );
@@ -39,9 +84,9 @@ public:
     void SetDialDependentNoValue();
     void SetDialSpeedOverRide( double );
     void SetDialSpeedOverRideNoValue();
-    void SetDialDiGuyAction( string );
+    void SetDialDiGuyAction( const string& );
     void SetDialDiGuyActionNoValue();
-    CRoadPos GetMonitorRoadPos();
+    const CRoadPos& GetMonitorRoadPos();
     virtual bool SetButtonByName( const string& );
     bool SetDialByName( const string&, const int& );
     bool SetDialByName( const string&, const double& );
@@ -52,10 +97,13 @@ public:
     bool IsDialActiveByNameStr( const string& );
     bool ResetDialByName( const string& );
     bool GetMonitorByName( const string&, CRoadPos* );
+    bool BorrowMonitorByName( const string&, const CRoadPos** );
     bool GetMonitorByName( const string&, CCrdr* );
+    bool BorrowMonitorByName( const string&, const CCrdr** );
     bool GetMonitorByName( const string&, int* );
     bool GetMonitorByName( const string&, bool* );
     bool GetMonitorByName( const string&, string* );
+    bool BorrowMonitorByName( const string&, const string** );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -118,9 +166,9 @@ private:
     CDialdouble m_dialSpeedOverRide;
     double GetDialSpeedOverRide();
     CDialstring m_dialDiGuyAction;
-    string GetDialDiGuyAction();
+    const string& GetDialDiGuyAction();
     CMonitorCRoadPos m_monitorRoadPos;
-    void SetMonitorRoadPos( CRoadPos );
+    void SetMonitorRoadPos( const CRoadPos& );
     void SetMonitorRoadPosNoValue();
 };
 
@@ -131,17 +179,19 @@ public:
     CVirtualObject( const CVirtualObject& );
     CVirtualObject& operator=( const CVirtualObject& );
     virtual ~CVirtualObject();
-    void SetDialSetAnimation( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialSetAnimation( const string& );
     void SetDialSetAnimationNoValue();
     void SetDialSetRotation( float );
     void SetDialSetRotationNoValue();
-    void SetDialSetPosition( string );
+    void SetDialSetPosition( const string& );
     void SetDialSetPositionNoValue();
-    void SetDialSetStateIndex( string );
+    void SetDialSetStateIndex( const string& );
     void SetDialSetStateIndexNoValue();
     void SetDialSetDrawType( int );
     void SetDialSetDrawTypeNoValue();
-    void SetDialAttachToObject( string );
+    void SetDialAttachToObject( const string& );
     void SetDialAttachToObjectNoValue();
     void SetDialAttachToLight( int );
     void SetDialAttachToLightNoValue();
@@ -201,17 +251,17 @@ private:
     CHcsmBtn m_buttonTurnOffAnimation;
     bool GetButtonTurnOffAnimation();
     CDialstring m_dialSetAnimation;
-    string GetDialSetAnimation();
+    const string& GetDialSetAnimation();
     CDialfloat m_dialSetRotation;
     float GetDialSetRotation();
     CDialstring m_dialSetPosition;
-    string GetDialSetPosition();
+    const string& GetDialSetPosition();
     CDialstring m_dialSetStateIndex;
-    string GetDialSetStateIndex();
+    const string& GetDialSetStateIndex();
     CDialint m_dialSetDrawType;
     int GetDialSetDrawType();
     CDialstring m_dialAttachToObject;
-    string GetDialAttachToObject();
+    const string& GetDialAttachToObject();
     CDialint m_dialAttachToLight;
     int GetDialAttachToLight();
 };
@@ -223,6 +273,8 @@ public:
     CTimeTrigger( const CTimeTrigger& );
     CTimeTrigger& operator=( const CTimeTrigger& );
     virtual ~CTimeTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -260,6 +312,8 @@ public:
     CGmtrcPstnTrigger( const CGmtrcPstnTrigger& );
     CGmtrcPstnTrigger& operator=( const CGmtrcPstnTrigger& );
     virtual ~CGmtrcPstnTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -300,6 +354,8 @@ public:
     CTrffcLghtTrigger( const CTrffcLghtTrigger& );
     CTrffcLghtTrigger& operator=( const CTrffcLghtTrigger& );
     virtual ~CTrffcLghtTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -340,6 +396,8 @@ public:
     CRoadPadTrigger( const CRoadPadTrigger& );
     CRoadPadTrigger& operator=( const CRoadPadTrigger& );
     virtual ~CRoadPadTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -385,6 +443,8 @@ public:
     CExpressionTrigger( const CExpressionTrigger& );
     CExpressionTrigger& operator=( const CExpressionTrigger& );
     virtual ~CExpressionTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -432,6 +492,8 @@ public:
     CFollowTrigger( const CFollowTrigger& );
     CFollowTrigger& operator=( const CFollowTrigger& );
     virtual ~CFollowTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -485,6 +547,8 @@ public:
     CTimeToArrvlTrigger( const CTimeToArrvlTrigger& );
     CTimeToArrvlTrigger& operator=( const CTimeToArrvlTrigger& );
     virtual ~CTimeToArrvlTrigger();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     virtual bool SetButtonByName( const string& );
 
 private:
@@ -547,6 +611,8 @@ public:
     CGateway( const CGateway& );
     CGateway& operator=( const CGateway& );
     virtual ~CGateway();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -555,12 +621,10 @@ private:
     		void CreateWorker (const CGatewayParseBlock* pBlock );
     		void DeleteWorker (const CGatewayParseBlock* pBlock );
     		void Worker(void);
-    		void DispatchMessage(int sock);
-    		void HandleGetDynaObjsMsg(int sock, TMsgHeader &head);
-    		void HandleGetInstObjsMsg(int sock, TMsgHeader &head);
-    		void HandleTakeObjControlMsg(int sock, TMsgHeader &head);
-    		void HandleControlObjMsg(int sock, TMsgHeader &head);
-    		void HandleReleaseObjCntrlMsg(int sock, TMsgHeader &head);
+    		void ApplyControlCmd(int hcsmId, int cmd, int val);
+    		void CollectDynaObjs(vector<TObjDesc>& objs);
+    		void PublishObjs(void);
+    		CGatewayIo* m_pIo;
 };
 
 class CAdo : public CHcsmSequential
@@ -570,31 +634,33 @@ public:
     CAdo( const CAdo& );
     CAdo& operator=( const CAdo& );
     virtual ~CAdo();
-    void SetDialAudioState( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialAudioState( const string& );
     void SetDialAudioStateNoValue();
-    void SetDialForcedLaneOffset( string );
+    void SetDialForcedLaneOffset( const string& );
     void SetDialForcedLaneOffsetNoValue();
-    void SetDialForcedVelocity( string );
+    void SetDialForcedVelocity( const string& );
     void SetDialForcedVelocityNoValue();
     void SetDialImStop( double );
     void SetDialImStopNoValue();
     void SetDialInhibitLaneChange( double );
     void SetDialInhibitLaneChangeNoValue();
-    void SetDialLaneChange( string );
+    void SetDialLaneChange( const string& );
     void SetDialLaneChangeNoValue();
-    void SetDialLaneChangeStatus( string );
+    void SetDialLaneChangeStatus( const string& );
     void SetDialLaneChangeStatusNoValue();
-    void SetDialMaintainGap( string );
+    void SetDialMaintainGap( const string& );
     void SetDialMaintainGapNoValue();
-    void SetDialTargetVelocity( string );
+    void SetDialTargetVelocity( const string& );
     void SetDialTargetVelocityNoValue();
-    void SetDialVisualState( string );
+    void SetDialVisualState( const string& );
     void SetDialVisualStateNoValue();
-    CRoadPos GetMonitorRoadPos();
-    CCrdr GetMonitorTargCrdr();
+    const CRoadPos& GetMonitorRoadPos();
+    const CCrdr& GetMonitorTargCrdr();
     int GetMonitorStoppedBehindObj();
     bool GetMonitorHasStopSignTarget();
-    string GetMonitorImTargCrdrs();
+    const string& GetMonitorImTargCrdrs();
     int GetMonitorStoppedAtStopSignFrame();
     virtual bool SetButtonByName( const string& );
     bool SetDialByName( const string&, const int& );
@@ -606,10 +672,13 @@ public:
     bool IsDialActiveByNameStr( const string& );
     bool ResetDialByName( const string& );
     bool GetMonitorByName( const string&, CRoadPos* );
+    bool BorrowMonitorByName( const string&, const CRoadPos** );
     bool GetMonitorByName( const string&, CCrdr* );
+    bool BorrowMonitorByName( const string&, const CCrdr** );
     bool GetMonitorByName( const string&, int* );
     bool GetMonitorByName( const string&, bool* );
     bool GetMonitorByName( const string&, string* );
+    bool BorrowMonitorByName( const string&, const string** );
 
 private:
     virtual void ExecuteTransitions();
@@ -621,6 +690,9 @@ private:
            void UserPreActivity( const CAdoParseBlock* );
            void UserPostActivity( const CAdoParseBlock* );
            void UserDeletion( const CAdoParseBlock* );
+           void Execute();
+           bool LodCoast();
+           int LodLevel();
            CObjectInitCond m_initConditions;
            CAdoInfoPtr m_pI;
            CCrdr m_crdr;
@@ -637,7 +709,10 @@ private:
     		double FadeInGap( int argC, const CExprParser::CStrNum args[] );
     		double FadeOutGap( int argC, const CExprParser::CStrNum args[] );
            void DumpSnoBlock( const CAdoParseBlock* );
-           bool CreateCvedObject( const CAdoParseBlock* );
+           bool CreateCvedObject( const CAdoParseBlock*, bool restore = false );
+           void SaveUserState( CHcsmCheckpoint& );
+           void RestoreUserState( CHcsmCheckpoint& );
+           void RestoreCvedObject();
            CRoadPos GetRoadposForRelCreate( const CAdoParseBlock* cpSnoBlock);
            void Activated( const CAdoParseBlock* );
            CAdoInfo::ERunMode GetRunMode( const string& );
@@ -695,30 +770,30 @@ private:
     CHcsmBtn m_buttonProjectAndResetLaneOffset;
     bool GetButtonProjectAndResetLaneOffset();
     CDialstring m_dialAudioState;
-    string GetDialAudioState();
+    const string& GetDialAudioState();
     CDialstring m_dialForcedLaneOffset;
-    string GetDialForcedLaneOffset();
+    const string& GetDialForcedLaneOffset();
     CDialstring m_dialForcedVelocity;
-    string GetDialForcedVelocity();
+    const string& GetDialForcedVelocity();
     CDialdouble m_dialImStop;
     double GetDialImStop();
     CDialdouble m_dialInhibitLaneChange;
     double GetDialInhibitLaneChange();
     CDialstring m_dialLaneChange;
-    string GetDialLaneChange();
+    const string& GetDialLaneChange();
     CDialstring m_dialLaneChangeStatus;
-    string GetDialLaneChangeStatus();
+    const string& GetDialLaneChangeStatus();
     CDialstring m_dialMaintainGap;
-    string GetDialMaintainGap();
+    const string& GetDialMaintainGap();
     CDialstring m_dialTargetVelocity;
-    string GetDialTargetVelocity();
+    const string& GetDialTargetVelocity();
     CDialstring m_dialVisualState;
-    string GetDialVisualState();
+    const string& GetDialVisualState();
     CMonitorCRoadPos m_monitorRoadPos;
-    void SetMonitorRoadPos( CRoadPos );
+    void SetMonitorRoadPos( const CRoadPos& );
     void SetMonitorRoadPosNoValue();
     CMonitorCCrdr m_monitorTargCrdr;
-    void SetMonitorTargCrdr( CCrdr );
+    void SetMonitorTargCrdr( const CCrdr& );
     void SetMonitorTargCrdrNoValue();
     CMonitorint m_monitorStoppedBehindObj;
     void SetMonitorStoppedBehindObj( int );
@@ -727,7 +802,7 @@ private:
     void SetMonitorHasStopSignTarget( bool );
     void SetMonitorHasStopSignTargetNoValue();
     CMonitorstring m_monitorImTargCrdrs;
-    void SetMonitorImTargCrdrs( string );
+    void SetMonitorImTargCrdrs( const string& );
     void SetMonitorImTargCrdrsNoValue();
     CMonitorint m_monitorStoppedAtStopSignFrame;
     void SetMonitorStoppedAtStopSignFrame( int );
@@ -741,6 +816,8 @@ public:
     CAutonomous( const CAutonomous& );
     CAutonomous& operator=( const CAutonomous& );
     virtual ~CAutonomous();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
 
 private:
@@ -763,6 +840,8 @@ public:
     CRemoteControl( const CRemoteControl& );
     CRemoteControl& operator=( const CRemoteControl& );
     virtual ~CRemoteControl();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     CPoint3D GetOutputTargPos();
     bool HasValueOutputTargPos();
@@ -854,6 +933,8 @@ public:
     CFreeDrive( const CFreeDrive& );
     CFreeDrive& operator=( const CFreeDrive& );
     virtual ~CFreeDrive();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     CPoint3D GetOutputTargPos();
     bool HasValueOutputTargPos();
@@ -927,6 +1008,8 @@ public:
     CFollow( const CFollow& );
     CFollow& operator=( const CFollow& );
     virtual ~CFollow();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     double GetOutputTargAccel();
     bool HasValueOutputTargAccel();
@@ -963,6 +1046,8 @@ public:
     CLaneChange( const CLaneChange& );
     CLaneChange& operator=( const CLaneChange& );
     virtual ~CLaneChange();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputFreeDriveTargVel( double );
     double GetOutputTargAccel();
@@ -984,6 +1069,8 @@ private:
            void Deletion();
            void NullifyOutputs();
            CLaneChangeConds m_conditions;
+           void SaveUserState( CHcsmCheckpoint& );
+           void RestoreUserState( CHcsmCheckpoint& );
     CInputParCAdoInfoPtr m_inputpI;
     CAdoInfoPtr GetInputpI();
     bool HasValueInputpI();
@@ -1021,6 +1108,8 @@ public:
     CLcMonitor( const CLcMonitor& );
     CLcMonitor& operator=( const CLcMonitor& );
     virtual ~CLcMonitor();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     void SetInputFreeDriveTargVel( double );
@@ -1054,6 +1143,8 @@ public:
     CLcSignal( const CLcSignal& );
     CLcSignal& operator=( const CLcSignal& );
     virtual ~CLcSignal();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
 
@@ -1085,6 +1176,8 @@ public:
     CLcExecute( const CLcExecute& );
     CLcExecute& operator=( const CLcExecute& );
     virtual ~CLcExecute();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     double GetOutputTargAccel();
@@ -1159,6 +1252,8 @@ public:
     CLcAbort( const CLcAbort& );
     CLcAbort& operator=( const CLcAbort& );
     virtual ~CLcAbort();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
 
@@ -1190,6 +1285,8 @@ public:
     CLcExecuteNeutralize( const CLcExecuteNeutralize& );
     CLcExecuteNeutralize& operator=( const CLcExecuteNeutralize& );
     virtual ~CLcExecuteNeutralize();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     double GetOutputTargOffset();
@@ -1219,6 +1316,8 @@ public:
     CLcExecuteIncrement( const CLcExecuteIncrement& );
     CLcExecuteIncrement& operator=( const CLcExecuteIncrement& );
     virtual ~CLcExecuteIncrement();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     double GetOutputTargOffset();
@@ -1256,6 +1355,8 @@ public:
     CLcExecuteSteady( const CLcExecuteSteady& );
     CLcExecuteSteady& operator=( const CLcExecuteSteady& );
     virtual ~CLcExecuteSteady();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     double GetOutputTargOffset();
@@ -1292,6 +1393,8 @@ public:
     CLcExecuteDecrement( const CLcExecuteDecrement& );
     CLcExecuteDecrement& operator=( const CLcExecuteDecrement& );
     virtual ~CLcExecuteDecrement();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     void SetInputpCond( CLcCondsPtr );
     double GetOutputTargOffset();
@@ -1328,6 +1431,8 @@ public:
     CNavigateIntrsctn( const CNavigateIntrsctn& );
     CNavigateIntrsctn& operator=( const CNavigateIntrsctn& );
     virtual ~CNavigateIntrsctn();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     double GetOutputTargAccel();
     bool HasValueOutputTargAccel();
@@ -1380,6 +1485,8 @@ public:
     CMerge( const CMerge& );
     CMerge& operator=( const CMerge& );
     virtual ~CMerge();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetInputpI( CAdoInfoPtr );
     double GetOutputTargAccel();
     bool HasValueOutputTargAccel();
@@ -1436,6 +1543,8 @@ public:
     CEnvironmentController( const CEnvironmentController& );
     CEnvironmentController& operator=( const CEnvironmentController& );
     virtual ~CEnvironmentController();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1458,6 +1567,8 @@ public:
     CEnviroInfo( const CEnviroInfo& );
     CEnviroInfo& operator=( const CEnviroInfo& );
     virtual ~CEnviroInfo();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1477,6 +1588,8 @@ public:
     CIntersectionManager( const CIntersectionManager& );
     CIntersectionManager& operator=( const CIntersectionManager& );
     virtual ~CIntersectionManager();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1498,6 +1611,9 @@ private:
            CImActiveIntrsctn m_activeIntrsctns[cMAX_ACTIVE_IM_INTRSCTN];
            int m_activeIntrsctnsLastElem;
            queue<int> m_freeActiveIntrsctnsIdx;
+           vector<TCrdrPriorityList> m_crdrList;           // scratch for UserPreActivity
+           vector<TVehiclePriorityList> m_vehPriorityList; // scratch for UserPreActivity
+           vector<TAttachedList> m_attachedList;           // scratch for PrioritizeVehicles
 };
 
 class COwnVehicleMirror : public CHcsmConcurrent
@@ -1507,6 +1623,8 @@ public:
     COwnVehicleMirror( const COwnVehicleMirror& );
     COwnVehicleMirror& operator=( const COwnVehicleMirror& );
     virtual ~COwnVehicleMirror();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1526,15 +1644,17 @@ public:
     CStaticObjManager( const CStaticObjManager& );
     CStaticObjManager& operator=( const CStaticObjManager& );
     virtual ~CStaticObjManager();
-    void SetDialSetOption1( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialSetOption1( const string& );
     void SetDialSetOption1NoValue();
-    void SetDialSetOption2( string );
+    void SetDialSetOption2( const string& );
     void SetDialSetOption2NoValue();
-    void SetDialAudioState( string );
+    void SetDialAudioState( const string& );
     void SetDialAudioStateNoValue();
-    void SetDialVisualState( string );
+    void SetDialVisualState( const string& );
     void SetDialVisualStateNoValue();
-    void SetDialAnimationState( string );
+    void SetDialAnimationState( const string& );
     void SetDialAnimationStateNoValue();
     bool SetDialByName( const string&, const int& );
     bool SetDialByName( const string&, const double& );
@@ -1552,19 +1672,21 @@ private:
     		void Creation( const CSobjMngrParseBlock* );
     		void Deletion( const CSobjMngrParseBlock* );
            void PostActivity( const CSobjMngrParseBlock* );
-           bool SetObjectOptions( const string& name, int *pValues );
-           bool SetObjectAudioState( const string& name, short val );
-           bool SetObjectVisualState( const string& name, short val );
+           void ParseOptionDial( const string& value, bool composite );
+           int  ParseStateDial( const string& value, short& val );
+           void ApplyOptions( vector<TStaticObjOptions>& options );
+           CStaticObjHandles m_handles;
+           vector<TStaticObjOptions> m_options;
     CDialstring m_dialSetOption1;
-    string GetDialSetOption1();
+    const string& GetDialSetOption1();
     CDialstring m_dialSetOption2;
-    string GetDialSetOption2();
+    const string& GetDialSetOption2();
     CDialstring m_dialAudioState;
-    string GetDialAudioState();
+    const string& GetDialAudioState();
     CDialstring m_dialVisualState;
-    string GetDialVisualState();
+    const string& GetDialVisualState();
     CDialstring m_dialAnimationState;
-    string GetDialAnimationState();
+    const string& GetDialAnimationState();
 };
 
 class CTrafficLightManager : public CHcsmConcurrent
@@ -1574,7 +1696,9 @@ public:
     CTrafficLightManager( const CTrafficLightManager& );
     CTrafficLightManager& operator=( const CTrafficLightManager& );
     virtual ~CTrafficLightManager();
-    void SetDialTrafficLight( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialTrafficLight( const string& );
     void SetDialTrafficLightNoValue();
     bool SetDialByName( const string&, const int& );
     bool SetDialByName( const string&, const double& );
@@ -1594,11 +1718,18 @@ private:
            void UserPreActivity( const CTrafLghtMngrParseBlock* );
            void UserPostActivity( const CTrafLghtMngrParseBlock* );
            void UserDeletion( const CTrafLghtMngrParseBlock* );
+           void SaveUserState( CHcsmCheckpoint& );
+           void RestoreUserState( CHcsmCheckpoint& );
     		void MakeStringUpper( string& s );
     		void ParseDialString( const string&, string&, string&, double* );
+    		void ScheduleClg( int idx, int minFrame );
     		vector<CClg>     m_clgs;
+    		CTimingWheel     m_clgWheel;
+    		vector<int>      m_dueClgs;
+    		string           m_dialLightName;
+    		string           m_dialLightState;
     CDialstring m_dialTrafficLight;
-    string GetDialTrafficLight();
+    const string& GetDialTrafficLight();
 };
 
 class CTrafficManager : public CHcsmConcurrent
@@ -1608,7 +1739,9 @@ public:
     CTrafficManager( const CTrafficManager& );
     CTrafficManager& operator=( const CTrafficManager& );
     virtual ~CTrafficManager();
-    void SetDialInputSet( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialInputSet( const string& );
     void SetDialInputSetNoValue();
     virtual bool SetButtonByName( const string& );
     bool SetDialByName( const string&, const int& );
@@ -1651,7 +1784,7 @@ private:
     CHcsmBtn m_buttonMakeTraffic;
     bool GetButtonMakeTraffic();
     CDialstring m_dialInputSet;
-    string GetDialInputSet();
+    const string& GetDialInputSet();
 };
 
 class CTrafficSource : public CHcsmConcurrent
@@ -1661,6 +1794,8 @@ public:
     CTrafficSource( const CTrafficSource& );
     CTrafficSource& operator=( const CTrafficSource& );
     virtual ~CTrafficSource();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
     void SetDialStartStop( bool );
     void SetDialStartStopNoValue();
     virtual bool SetButtonByName( const string& );
@@ -1688,6 +1823,7 @@ private:
     		int m_curTimeIdx;
     		double m_randTime;
     		vector<CSnoBlock> m_traffic;
+    		vector<int> m_trafficIds;
     		vector<double> m_times;
     		vector<double> m_periodicSequence;
     		vector<double> m_workingSequence;
@@ -1712,7 +1848,9 @@ public:
     CVehFail( const CVehFail& );
     CVehFail& operator=( const CVehFail& );
     virtual ~CVehFail();
-    void SetDialFailure( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialFailure( const string& );
     void SetDialFailureNoValue();
     bool SetDialByName( const string&, const int& );
     bool SetDialByName( const string&, const double& );
@@ -1736,7 +1874,7 @@ private:
            int             m_CmdSock;
            TFailureQueue   m_Failures;
     CDialstring m_dialFailure;
-    string GetDialFailure();
+    const string& GetDialFailure();
 };
 
 class CDriverMirror : public CHcsmConcurrent
@@ -1746,13 +1884,15 @@ public:
     CDriverMirror( const CDriverMirror& );
     CDriverMirror& operator=( const CDriverMirror& );
     virtual ~CDriverMirror();
-    void SetDialTargetVelocity( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
+    void SetDialTargetVelocity( const string& );
     void SetDialTargetVelocityNoValue();
-    CRoadPos GetMonitorRoadPos();
-    CRoadPos GetMonitorTrailerPos();
-    CCrdr GetMonitorTargCrdr();
+    const CRoadPos& GetMonitorRoadPos();
+    const CRoadPos& GetMonitorTrailerPos();
+    const CCrdr& GetMonitorTargCrdr();
     int GetMonitorStoppedBehindObj();
-    string GetMonitorImTargCrdrs();
+    const string& GetMonitorImTargCrdrs();
     bool SetDialByName( const string&, const int& );
     bool SetDialByName( const string&, const double& );
     bool SetDialByName( const string&, const string& );
@@ -1762,10 +1902,13 @@ public:
     bool IsDialActiveByNameStr( const string& );
     bool ResetDialByName( const string& );
     bool GetMonitorByName( const string&, CRoadPos* );
+    bool BorrowMonitorByName( const string&, const CRoadPos** );
     bool GetMonitorByName( const string&, CCrdr* );
+    bool BorrowMonitorByName( const string&, const CCrdr** );
     bool GetMonitorByName( const string&, int* );
     bool GetMonitorByName( const string&, bool* );
     bool GetMonitorByName( const string&, string* );
+    bool BorrowMonitorByName( const string&, const string** );
 
 private:
     virtual void Creation();
@@ -1786,21 +1929,21 @@ private:
            CRoadPos m_currTrailerPos;
            CCrdr m_prevTargCrdr;
     CDialstring m_dialTargetVelocity;
-    string GetDialTargetVelocity();
+    const string& GetDialTargetVelocity();
     CMonitorCRoadPos m_monitorRoadPos;
-    void SetMonitorRoadPos( CRoadPos );
+    void SetMonitorRoadPos( const CRoadPos& );
     void SetMonitorRoadPosNoValue();
     CMonitorCRoadPos m_monitorTrailerPos;
-    void SetMonitorTrailerPos( CRoadPos );
+    void SetMonitorTrailerPos( const CRoadPos& );
     void SetMonitorTrailerPosNoValue();
     CMonitorCCrdr m_monitorTargCrdr;
-    void SetMonitorTargCrdr( CCrdr );
+    void SetMonitorTargCrdr( const CCrdr& );
     void SetMonitorTargCrdrNoValue();
     CMonitorint m_monitorStoppedBehindObj;
     void SetMonitorStoppedBehindObj( int );
     void SetMonitorStoppedBehindObjNoValue();
     CMonitorstring m_monitorImTargCrdrs;
-    void SetMonitorImTargCrdrs( string );
+    void SetMonitorImTargCrdrs( const string& );
     void SetMonitorImTargCrdrsNoValue();
 };
 
@@ -1811,6 +1954,8 @@ public:
     CTrafficData( const CTrafficData& );
     CTrafficData& operator=( const CTrafficData& );
     virtual ~CTrafficData();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1835,6 +1980,8 @@ public:
     CDaqDriver( const CDaqDriver& );
     CDaqDriver& operator=( const CDaqDriver& );
     virtual ~CDaqDriver();
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     virtual void Creation( const CSnoBlock* );
@@ -1845,12 +1992,12 @@ private:
            void UserPreActivity( const CDaqDriverParseBlock* );
            void UserPostActivity( const CDaqDriverParseBlock* );
            void UserDeletion( const CDaqDriverParseBlock* );
-           void ProcessOneDaqFrame();
+           void SetDriverState( const CPoint3D&, const CVector3D& );
     		CDynObj* m_pObj;
-    		CFastDeque<TDaqData> m_DaqDataContainer;
+    		CDaqTrace m_trace;
            double m_dataFreq;
            double m_executionMultiplier;
-           int m_framesSinceLastExecution;
+           double m_traceIdx;
 };
 
 
@@ -0,0 +1,1230 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CAdo::CAdo(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmSequential(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "Ado",
+            true,
+            11
+            )
+,
+    m_buttonChangeLaneLeft( pRootCollection, "ChangeLaneLeft" ),
+    m_buttonChangeLaneRight( pRootCollection, "ChangeLaneRight" ),
+    m_buttonTurnLeft( pRootCollection, "TurnLeft" ),
+    m_buttonTurnRight( pRootCollection, "TurnRight" ),
+    m_buttonProjectAndResetLaneOffset( pRootCollection, "ProjectAndResetLaneOffset" ),
+    m_dialAudioState( pRootCollection, "AudioState" ),
+    m_dialForcedLaneOffset( pRootCollection, "ForcedLaneOffset" ),
+    m_dialForcedVelocity( pRootCollection, "ForcedVelocity" ),
+    m_dialImStop( pRootCollection, "ImStop" ),
+    m_dialInhibitLaneChange( pRootCollection, "InhibitLaneChange" ),
+    m_dialLaneChange( pRootCollection, "LaneChange" ),
+    m_dialLaneChangeStatus( pRootCollection, "LaneChangeStatus" ),
+    m_dialMaintainGap( pRootCollection, "MaintainGap" ),
+    m_dialTargetVelocity( pRootCollection, "TargetVelocity" ),
+    m_dialVisualState( pRootCollection, "VisualState" ),
+    m_monitorRoadPos( pRootCollection, "RoadPos" ),
+    m_monitorTargCrdr( pRootCollection, "TargCrdr" ),
+    m_monitorStoppedBehindObj( pRootCollection, "StoppedBehindObj" ),
+    m_monitorHasStopSignTarget( pRootCollection, "HasStopSignTarget" ),
+    m_monitorImTargCrdrs( pRootCollection, "ImTargCrdrs" ),
+    m_monitorStoppedAtStopSignFrame( pRootCollection, "StoppedAtStopSignFrame" )
+{
+
+    // add my children
+    AddChild( new CAutonomous( pRootCollection, snoBlock ) );
+    AddChild( new CRemoteControl( pRootCollection, snoBlock ) );
+
+    m_activeChild = m_children[0];
+    m_defaultActiveChild = m_children[0];
+
+
+}
+
+CAdo::CAdo( const CAdo& objToCopy ):
+    CHcsmSequential(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonChangeLaneLeft( objToCopy.m_pRootCollection, objToCopy.m_buttonChangeLaneLeft.GetName() ),
+    m_buttonChangeLaneRight( objToCopy.m_pRootCollection, objToCopy.m_buttonChangeLaneRight.GetName() ),
+    m_buttonTurnLeft( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnLeft.GetName() ),
+    m_buttonTurnRight( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnRight.GetName() ),
+    m_buttonProjectAndResetLaneOffset( objToCopy.m_pRootCollection, objToCopy.m_buttonProjectAndResetLaneOffset.GetName() ),
+    m_dialAudioState( objToCopy.m_pRootCollection, objToCopy.m_dialAudioState.GetName() ),
+    m_dialForcedLaneOffset( objToCopy.m_pRootCollection, objToCopy.m_dialForcedLaneOffset.GetName() ),
+    m_dialForcedVelocity( objToCopy.m_pRootCollection, objToCopy.m_dialForcedVelocity.GetName() ),
+    m_dialImStop( objToCopy.m_pRootCollection, objToCopy.m_dialImStop.GetName() ),
+    m_dialInhibitLaneChange( objToCopy.m_pRootCollection, objToCopy.m_dialInhibitLaneChange.GetName() ),
+    m_dialLaneChange( objToCopy.m_pRootCollection, objToCopy.m_dialLaneChange.GetName() ),
+    m_dialLaneChangeStatus( objToCopy.m_pRootCollection, objToCopy.m_dialLaneChangeStatus.GetName() ),
+    m_dialMaintainGap( objToCopy.m_pRootCollection, objToCopy.m_dialMaintainGap.GetName() ),
+    m_dialTargetVelocity( objToCopy.m_pRootCollection, objToCopy.m_dialTargetVelocity.GetName() ),
+    m_dialVisualState( objToCopy.m_pRootCollection, objToCopy.m_dialVisualState.GetName() ),
+    m_monitorRoadPos( objToCopy.m_pRootCollection, objToCopy.m_monitorRoadPos.GetName() ),
+    m_monitorTargCrdr( objToCopy.m_pRootCollection, objToCopy.m_monitorTargCrdr.GetName() ),
+    m_monitorStoppedBehindObj( objToCopy.m_pRootCollection, objToCopy.m_monitorStoppedBehindObj.GetName() ),
+    m_monitorHasStopSignTarget( objToCopy.m_pRootCollection, objToCopy.m_monitorHasStopSignTarget.GetName() ),
+    m_monitorImTargCrdrs( objToCopy.m_pRootCollection, objToCopy.m_monitorImTargCrdrs.GetName() ),
+    m_monitorStoppedAtStopSignFrame( objToCopy.m_pRootCollection, objToCopy.m_monitorStoppedAtStopSignFrame.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CAdo& CAdo::operator=(
+            const CAdo& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CAdo::~CAdo()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CAdo::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::SaveState( ckpt );
+    m_buttonChangeLaneLeft.SaveState( ckpt );
+    m_buttonChangeLaneRight.SaveState( ckpt );
+    m_buttonTurnLeft.SaveState( ckpt );
+    m_buttonTurnRight.SaveState( ckpt );
+    m_buttonProjectAndResetLaneOffset.SaveState( ckpt );
+    m_dialAudioState.SaveState( ckpt );
+    m_dialForcedLaneOffset.SaveState( ckpt );
+    m_dialForcedVelocity.SaveState( ckpt );
+    m_dialImStop.SaveState( ckpt );
+    m_dialInhibitLaneChange.SaveState( ckpt );
+    m_dialLaneChange.SaveState( ckpt );
+    m_dialLaneChangeStatus.SaveState( ckpt );
+    m_dialMaintainGap.SaveState( ckpt );
+    m_dialTargetVelocity.SaveState( ckpt );
+    m_dialVisualState.SaveState( ckpt );
+    m_monitorRoadPos.SaveState( ckpt );
+    m_monitorTargCrdr.SaveState( ckpt );
+    m_monitorStoppedBehindObj.SaveState( ckpt );
+    m_monitorHasStopSignTarget.SaveState( ckpt );
+    m_monitorImTargCrdrs.SaveState( ckpt );
+    m_monitorStoppedAtStopSignFrame.SaveState( ckpt );
+    m_initConditions.SaveState( ckpt );
+    // m_pI is of type CAdoInfoPtr and is not checkpointed
+    ckpt.Put( m_crdr );
+    // m_debugFile is of type FILE* and is not checkpointed
+    ckpt.Put( m_currForcedLaneOffset );
+    ckpt.Put( m_currForcedLaneOffsetUrgency );
+    ckpt.Put( m_prevForcedLaneDialVal );
+    // m_exprEval is of type CExpEvalAdo and is not checkpointed
+    // m_exprGapDisEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMinSpeedEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMaxSpeedEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMaxAccelEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMinAccelEvtal is of type CExpEvalAdo and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CAdo::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::RestoreState( ckpt );
+    m_buttonChangeLaneLeft.RestoreState( ckpt );
+    m_buttonChangeLaneRight.RestoreState( ckpt );
+    m_buttonTurnLeft.RestoreState( ckpt );
+    m_buttonTurnRight.RestoreState( ckpt );
+    m_buttonProjectAndResetLaneOffset.RestoreState( ckpt );
+    m_dialAudioState.RestoreState( ckpt );
+    m_dialForcedLaneOffset.RestoreState( ckpt );
+    m_dialForcedVelocity.RestoreState( ckpt );
+    m_dialImStop.RestoreState( ckpt );
+    m_dialInhibitLaneChange.RestoreState( ckpt );
+    m_dialLaneChange.RestoreState( ckpt );
+    m_dialLaneChangeStatus.RestoreState( ckpt );
+    m_dialMaintainGap.RestoreState( ckpt );
+    m_dialTargetVelocity.RestoreState( ckpt );
+    m_dialVisualState.RestoreState( ckpt );
+    m_monitorRoadPos.RestoreState( ckpt );
+    m_monitorTargCrdr.RestoreState( ckpt );
+    m_monitorStoppedBehindObj.RestoreState( ckpt );
+    m_monitorHasStopSignTarget.RestoreState( ckpt );
+    m_monitorImTargCrdrs.RestoreState( ckpt );
+    m_monitorStoppedAtStopSignFrame.RestoreState( ckpt );
+    m_initConditions.RestoreState( ckpt, *cved );
+    // m_pI is of type CAdoInfoPtr and is not checkpointed
+    ckpt.Get( m_crdr, *cved );
+    // m_debugFile is of type FILE* and is not checkpointed
+    ckpt.Get( m_currForcedLaneOffset );
+    ckpt.Get( m_currForcedLaneOffsetUrgency );
+    ckpt.Get( m_prevForcedLaneDialVal );
+    // m_exprEval is of type CExpEvalAdo and is not checkpointed
+    // m_exprGapDisEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMinSpeedEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMaxSpeedEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMaxAccelEvtal is of type CExpEvalAdo and is not checkpointed
+    // m_exprMinAccelEvtal is of type CExpEvalAdo and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CAdo::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CAdo::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CAdo::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CAdo::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
+void CAdo::ExecuteTransitions()
+{
+
+    // from "Autonomous" to "RemoteControl"
+    if ( m_activeChild == m_children[0] && m_children[0]->ExecutePredicate( 1 ) ) {
+        
+        m_activeChild = m_children[1];
+        return;
+        
+    }
+
+    // from "RemoteControl" to "Autonomous"
+    if ( m_activeChild == m_children[1] && m_children[1]->ExecutePredicate( 2 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+}
+
+void CAdo::SetInputpIForAutonomous( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CAutonomous*>(m_children[0]) )->SetInputpI( value );
+
+}
+
+void CAdo::SetInputpIForRemoteControl( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CRemoteControl*>(m_children[1]) )->SetInputpI( value );
+
+}
+
+CPoint3D CAdo::GetOutputTargPosFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputTargPos();
+
+}
+
+bool CAdo::HasValueOutputTargPosFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputTargPos();
+
+}
+
+double CAdo::GetOutputTargSteerFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputTargSteer();
+
+}
+
+bool CAdo::HasValueOutputTargSteerFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputTargSteer();
+
+}
+
+double CAdo::GetOutputTargAccelFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputTargAccel();
+
+}
+
+bool CAdo::HasValueOutputTargAccelFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputTargAccel();
+
+}
+
+string CAdo::GetOutputImTargCrdrsFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputImTargCrdrs();
+
+}
+
+bool CAdo::HasValueOutputImTargCrdrsFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputImTargCrdrs();
+
+}
+
+bool CAdo::GetOutputHasStopSignTargetFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputHasStopSignTarget();
+
+}
+
+bool CAdo::HasValueOutputHasStopSignTargetFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputHasStopSignTarget();
+
+}
+
+int CAdo::GetOutputStoppedAtStopSignFrameFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputStoppedAtStopSignFrame();
+
+}
+
+bool CAdo::HasValueOutputStoppedAtStopSignFrameFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputStoppedAtStopSignFrame();
+
+}
+
+double CAdo::GetOutputMaxSteerFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->GetOutputMaxSteer();
+
+}
+
+bool CAdo::HasValueOutputMaxSteerFromRemoteControl()
+{
+
+    return ( dynamic_cast<CRemoteControl*>(m_children[1]) )->HasValueOutputMaxSteer();
+
+}
+
+bool CAdo::GetButtonChangeLaneLeft()
+{
+
+    return m_buttonChangeLaneLeft.IsButtonPressed();
+
+}
+
+bool CAdo::GetButtonChangeLaneRight()
+{
+
+    return m_buttonChangeLaneRight.IsButtonPressed();
+
+}
+
+bool CAdo::GetButtonTurnLeft()
+{
+
+    return m_buttonTurnLeft.IsButtonPressed();
+
+}
+
+bool CAdo::GetButtonTurnRight()
+{
+
+    return m_buttonTurnRight.IsButtonPressed();
+
+}
+
+bool CAdo::GetButtonProjectAndResetLaneOffset()
+{
+
+    return m_buttonProjectAndResetLaneOffset.IsButtonPressed();
+
+}
+
+bool CAdo::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonChangeLaneLeft.GetName() ) {
+        
+        m_buttonChangeLaneLeft.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonChangeLaneRight.GetName() ) {
+        
+        m_buttonChangeLaneRight.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonTurnLeft.GetName() ) {
+        
+        m_buttonTurnLeft.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonTurnRight.GetName() ) {
+        
+        m_buttonTurnRight.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonProjectAndResetLaneOffset.GetName() ) {
+        
+        m_buttonProjectAndResetLaneOffset.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const string& CAdo::GetDialAudioState()
+{
+
+    return m_dialAudioState.GetValue();
+
+}
+
+void CAdo::SetDialAudioState( const string& value )
+{
+
+    m_dialAudioState.SetValue( value );
+
+}
+
+void CAdo::SetDialAudioStateNoValue()
+{
+
+    m_dialAudioState.SetNoValue();
+
+}
+
+const string& CAdo::GetDialForcedLaneOffset()
+{
+
+    return m_dialForcedLaneOffset.GetValue();
+
+}
+
+void CAdo::SetDialForcedLaneOffset( const string& value )
+{
+
+    m_dialForcedLaneOffset.SetValue( value );
+
+}
+
+void CAdo::SetDialForcedLaneOffsetNoValue()
+{
+
+    m_dialForcedLaneOffset.SetNoValue();
+
+}
+
+const string& CAdo::GetDialForcedVelocity()
+{
+
+    return m_dialForcedVelocity.GetValue();
+
+}
+
+void CAdo::SetDialForcedVelocity( const string& value )
+{
+
+    m_dialForcedVelocity.SetValue( value );
+
+}
+
+void CAdo::SetDialForcedVelocityNoValue()
+{
+
+    m_dialForcedVelocity.SetNoValue();
+
+}
+
+double CAdo::GetDialImStop()
+{
+
+    return m_dialImStop.GetValue();
+
+}
+
+void CAdo::SetDialImStop( double value )
+{
+
+    m_dialImStop.SetValue( value );
+
+}
+
+void CAdo::SetDialImStopNoValue()
+{
+
+    m_dialImStop.SetNoValue();
+
+}
+
+double CAdo::GetDialInhibitLaneChange()
+{
+
+    return m_dialInhibitLaneChange.GetValue();
+
+}
+
+void CAdo::SetDialInhibitLaneChange( double value )
+{
+
+    m_dialInhibitLaneChange.SetValue( value );
+
+}
+
+void CAdo::SetDialInhibitLaneChangeNoValue()
+{
+
+    m_dialInhibitLaneChange.SetNoValue();
+
+}
+
+const string& CAdo::GetDialLaneChange()
+{
+
+    return m_dialLaneChange.GetValue();
+
+}
+
+void CAdo::SetDialLaneChange( const string& value )
+{
+
+    m_dialLaneChange.SetValue( value );
+
+}
+
+void CAdo::SetDialLaneChangeNoValue()
+{
+
+    m_dialLaneChange.SetNoValue();
+
+}
+
+const string& CAdo::GetDialLaneChangeStatus()
+{
+
+    return m_dialLaneChangeStatus.GetValue();
+
+}
+
+void CAdo::SetDialLaneChangeStatus( const string& value )
+{
+
+    m_dialLaneChangeStatus.SetValue( value );
+
+}
+
+void CAdo::SetDialLaneChangeStatusNoValue()
+{
+
+    m_dialLaneChangeStatus.SetNoValue();
+
+}
+
+const string& CAdo::GetDialMaintainGap()
+{
+
+    return m_dialMaintainGap.GetValue();
+
+}
+
+void CAdo::SetDialMaintainGap( const string& value )
+{
+
+    m_dialMaintainGap.SetValue( value );
+
+}
+
+void CAdo::SetDialMaintainGapNoValue()
+{
+
+    m_dialMaintainGap.SetNoValue();
+
+}
+
+const string& CAdo::GetDialTargetVelocity()
+{
+
+    return m_dialTargetVelocity.GetValue();
+
+}
+
+void CAdo::SetDialTargetVelocity( const string& value )
+{
+
+    m_dialTargetVelocity.SetValue( value );
+
+}
+
+void CAdo::SetDialTargetVelocityNoValue()
+{
+
+    m_dialTargetVelocity.SetNoValue();
+
+}
+
+const string& CAdo::GetDialVisualState()
+{
+
+    return m_dialVisualState.GetValue();
+
+}
+
+void CAdo::SetDialVisualState( const string& value )
+{
+
+    m_dialVisualState.SetValue( value );
+
+}
+
+void CAdo::SetDialVisualStateNoValue()
+{
+
+    m_dialVisualState.SetNoValue();
+
+}
+
+bool CAdo::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CAdo::SetDialByName( const string& dialName, const double& value )
+{
+
+    if ( dialName == m_dialImStop.GetName() ) {
+        
+        m_dialImStop.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialInhibitLaneChange.GetName() ) {
+        
+        m_dialInhibitLaneChange.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedLaneOffset.GetName() ) {
+        
+        m_dialForcedLaneOffset.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedVelocity.GetName() ) {
+        
+        m_dialForcedVelocity.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChange.GetName() ) {
+        
+        m_dialLaneChange.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChangeStatus.GetName() ) {
+        
+        m_dialLaneChangeStatus.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialMaintainGap.GetName() ) {
+        
+        m_dialMaintainGap.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CAdo::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CAdo::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedLaneOffset.GetName() ) {
+        
+        m_dialForcedLaneOffset.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedVelocity.GetName() ) {
+        
+        m_dialForcedVelocity.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialImStop.GetName() ) {
+        
+        m_dialImStop.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialInhibitLaneChange.GetName() ) {
+        
+        m_dialInhibitLaneChange.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChange.GetName() ) {
+        
+        m_dialLaneChange.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChangeStatus.GetName() ) {
+        
+        m_dialLaneChangeStatus.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialMaintainGap.GetName() ) {
+        
+        m_dialMaintainGap.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        return m_dialAudioState.HasValue();
+        
+    }
+    if ( dialName == m_dialForcedLaneOffset.GetName() ) {
+        
+        return m_dialForcedLaneOffset.HasValue();
+        
+    }
+    if ( dialName == m_dialForcedVelocity.GetName() ) {
+        
+        return m_dialForcedVelocity.HasValue();
+        
+    }
+    if ( dialName == m_dialImStop.GetName() ) {
+        
+        return m_dialImStop.HasValue();
+        
+    }
+    if ( dialName == m_dialInhibitLaneChange.GetName() ) {
+        
+        return m_dialInhibitLaneChange.HasValue();
+        
+    }
+    if ( dialName == m_dialLaneChange.GetName() ) {
+        
+        return m_dialLaneChange.HasValue();
+        
+    }
+    if ( dialName == m_dialLaneChangeStatus.GetName() ) {
+        
+        return m_dialLaneChangeStatus.HasValue();
+        
+    }
+    if ( dialName == m_dialMaintainGap.GetName() ) {
+        
+        return m_dialMaintainGap.HasValue();
+        
+    }
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        return m_dialTargetVelocity.HasValue();
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        return m_dialVisualState.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedLaneOffset.GetName() ) {
+        
+        m_dialForcedLaneOffset.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialForcedVelocity.GetName() ) {
+        
+        m_dialForcedVelocity.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialImStop.GetName() ) {
+        
+        m_dialImStop.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialInhibitLaneChange.GetName() ) {
+        
+        m_dialInhibitLaneChange.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChange.GetName() ) {
+        
+        m_dialLaneChange.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialLaneChangeStatus.GetName() ) {
+        
+        m_dialLaneChangeStatus.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialMaintainGap.GetName() ) {
+        
+        m_dialMaintainGap.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const CRoadPos& CAdo::GetMonitorRoadPos()
+{
+
+    return m_monitorRoadPos.GetValue();
+
+}
+
+void CAdo::SetMonitorRoadPos( const CRoadPos& value )
+{
+
+    m_monitorRoadPos.SetValue( value );
+
+}
+
+void CAdo::SetMonitorRoadPosNoValue()
+{
+
+    m_monitorRoadPos.SetNoValue();
+
+}
+
+const CCrdr& CAdo::GetMonitorTargCrdr()
+{
+
+    return m_monitorTargCrdr.GetValue();
+
+}
+
+void CAdo::SetMonitorTargCrdr( const CCrdr& value )
+{
+
+    m_monitorTargCrdr.SetValue( value );
+
+}
+
+void CAdo::SetMonitorTargCrdrNoValue()
+{
+
+    m_monitorTargCrdr.SetNoValue();
+
+}
+
+int CAdo::GetMonitorStoppedBehindObj()
+{
+
+    return m_monitorStoppedBehindObj.GetValue();
+
+}
+
+void CAdo::SetMonitorStoppedBehindObj( int value )
+{
+
+    m_monitorStoppedBehindObj.SetValue( value );
+
+}
+
+void CAdo::SetMonitorStoppedBehindObjNoValue()
+{
+
+    m_monitorStoppedBehindObj.SetNoValue();
+
+}
+
+bool CAdo::GetMonitorHasStopSignTarget()
+{
+
+    return m_monitorHasStopSignTarget.GetValue();
+
+}
+
+void CAdo::SetMonitorHasStopSignTarget( bool value )
+{
+
+    m_monitorHasStopSignTarget.SetValue( value );
+
+}
+
+void CAdo::SetMonitorHasStopSignTargetNoValue()
+{
+
+    m_monitorHasStopSignTarget.SetNoValue();
+
+}
+
+const string& CAdo::GetMonitorImTargCrdrs()
+{
+
+    return m_monitorImTargCrdrs.GetValue();
+
+}
+
+void CAdo::SetMonitorImTargCrdrs( const string& value )
+{
+
+    m_monitorImTargCrdrs.SetValue( value );
+
+}
+
+void CAdo::SetMonitorImTargCrdrsNoValue()
+{
+
+    m_monitorImTargCrdrs.SetNoValue();
+
+}
+
+int CAdo::GetMonitorStoppedAtStopSignFrame()
+{
+
+    return m_monitorStoppedAtStopSignFrame.GetValue();
+
+}
+
+void CAdo::SetMonitorStoppedAtStopSignFrame( int value )
+{
+
+    m_monitorStoppedAtStopSignFrame.SetValue( value );
+
+}
+
+void CAdo::SetMonitorStoppedAtStopSignFrameNoValue()
+{
+
+    m_monitorStoppedAtStopSignFrame.SetNoValue();
+
+}
+
+bool CAdo::GetMonitorByName( const string& monitorName, CRoadPos* pValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::BorrowMonitorByName( const string& monitorName, const CRoadPos** ppValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::GetMonitorByName( const string& monitorName, CCrdr* pValue )
+{
+
+    if ( monitorName == m_monitorTargCrdr.GetName() ) {
+        
+        bool retVal = m_monitorTargCrdr.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorTargCrdr.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::BorrowMonitorByName( const string& monitorName, const CCrdr** ppValue )
+{
+
+    if ( monitorName == m_monitorTargCrdr.GetName() ) {
+        
+        bool retVal = m_monitorTargCrdr.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorTargCrdr.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::GetMonitorByName( const string& monitorName, int* pValue )
+{
+
+    if ( monitorName == m_monitorStoppedBehindObj.GetName() ) {
+        
+        bool retVal = m_monitorStoppedBehindObj.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorStoppedBehindObj.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    if ( monitorName == m_monitorStoppedAtStopSignFrame.GetName() ) {
+        
+        bool retVal = m_monitorStoppedAtStopSignFrame.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorStoppedAtStopSignFrame.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::GetMonitorByName( const string& monitorName, bool* pValue )
+{
+
+    if ( monitorName == m_monitorHasStopSignTarget.GetName() ) {
+        
+        bool retVal = m_monitorHasStopSignTarget.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorHasStopSignTarget.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::GetMonitorByName( const string& monitorName, string* pValue )
+{
+
+    if ( monitorName == m_monitorImTargCrdrs.GetName() ) {
+        
+        bool retVal = m_monitorImTargCrdrs.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorImTargCrdrs.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CAdo::BorrowMonitorByName( const string& monitorName, const string** ppValue )
+{
+
+    if ( monitorName == m_monitorImTargCrdrs.GetName() ) {
+        
+        bool retVal = m_monitorImTargCrdrs.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorImTargCrdrs.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
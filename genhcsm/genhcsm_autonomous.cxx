@@ -0,0 +1,151 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CAutonomous::CAutonomous(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "Autonomous",
+            false,
+            12
+            )
+,
+    m_inputpI( "pI" )
+{
+
+
+}
+
+CAutonomous::CAutonomous( const CAutonomous& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CAutonomous& CAutonomous::operator=(
+            const CAutonomous& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CAutonomous::~CAutonomous()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CAutonomous::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CAutonomous::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CAutonomous::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	AutonomousPreActivity();
+
+}
+
+void CAutonomous::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	AutonomousPostActivity();
+
+}
+
+bool CAutonomous::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 1 ) {
+        
+        return AdoAutoRemotePredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CAutonomous::AdoAutoRemotePredicate()
+{
+
+	return AutoRemotePredicate();
+
+}
+
+CAdoInfoPtr CAutonomous::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CAutonomous::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CAutonomous::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
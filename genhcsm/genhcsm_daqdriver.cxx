@@ -0,0 +1,128 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CDaqDriver::CDaqDriver(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CDaqDriverParseBlock( snoBlock ),
+            "DaqDriver",
+            true,
+            38
+            )
+
+{
+
+
+}
+
+CDaqDriver::CDaqDriver( const CDaqDriver& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CDaqDriver& CDaqDriver::operator=(
+            const CDaqDriver& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CDaqDriver::~CDaqDriver()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CDaqDriver::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    // m_pObj is of type CDynObj* and is not checkpointed
+    // m_trace is of type CDaqTrace and is not checkpointed
+    ckpt.Put( m_dataFreq );
+    ckpt.Put( m_executionMultiplier );
+    ckpt.Put( m_traceIdx );
+    SaveUserState( ckpt );
+
+}
+
+void CDaqDriver::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    // m_pObj is of type CDynObj* and is not checkpointed
+    // m_trace is of type CDaqTrace and is not checkpointed
+    ckpt.Get( m_dataFreq );
+    ckpt.Get( m_executionMultiplier );
+    ckpt.Get( m_traceIdx );
+    RestoreUserState( ckpt );
+
+}
+
+void CDaqDriver::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDaqDriverParseBlock* pSnoBlock = dynamic_cast<const CDaqDriverParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CDaqDriver::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDaqDriverParseBlock* pSnoBlock = dynamic_cast<const CDaqDriverParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CDaqDriver::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDaqDriverParseBlock* pSnoBlock = dynamic_cast<const CDaqDriverParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CDaqDriver::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDaqDriverParseBlock* pSnoBlock = dynamic_cast<const CDaqDriverParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
@@ -0,0 +1,686 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CDdo::CDdo(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CDdoParseBlock( snoBlock ),
+            "Ddo",
+            true,
+            1
+            )
+,
+    m_buttonTurnOnAnimation( pRootCollection, "TurnOnAnimation" ),
+    m_buttonTurnOffAnimation( pRootCollection, "TurnOffAnimation" ),
+    m_dialAudioState( pRootCollection, "AudioState" ),
+    m_dialVisualState( pRootCollection, "VisualState" ),
+    m_dialMode( pRootCollection, "Mode" ),
+    m_dialDependent( pRootCollection, "Dependent" ),
+    m_dialSpeedOverRide( pRootCollection, "SpeedOverRide" ),
+    m_dialDiGuyAction( pRootCollection, "DiGuyAction" ),
+    m_monitorRoadPos( pRootCollection, "RoadPos" )
+{
+
+
+}
+
+CDdo::CDdo( const CDdo& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonTurnOnAnimation( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnOnAnimation.GetName() ),
+    m_buttonTurnOffAnimation( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnOffAnimation.GetName() ),
+    m_dialAudioState( objToCopy.m_pRootCollection, objToCopy.m_dialAudioState.GetName() ),
+    m_dialVisualState( objToCopy.m_pRootCollection, objToCopy.m_dialVisualState.GetName() ),
+    m_dialMode( objToCopy.m_pRootCollection, objToCopy.m_dialMode.GetName() ),
+    m_dialDependent( objToCopy.m_pRootCollection, objToCopy.m_dialDependent.GetName() ),
+    m_dialSpeedOverRide( objToCopy.m_pRootCollection, objToCopy.m_dialSpeedOverRide.GetName() ),
+    m_dialDiGuyAction( objToCopy.m_pRootCollection, objToCopy.m_dialDiGuyAction.GetName() ),
+    m_monitorRoadPos( objToCopy.m_pRootCollection, objToCopy.m_monitorRoadPos.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CDdo& CDdo::operator=(
+            const CDdo& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CDdo::~CDdo()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CDdo::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonTurnOnAnimation.SaveState( ckpt );
+    m_buttonTurnOffAnimation.SaveState( ckpt );
+    m_dialAudioState.SaveState( ckpt );
+    m_dialVisualState.SaveState( ckpt );
+    m_dialMode.SaveState( ckpt );
+    m_dialDependent.SaveState( ckpt );
+    m_dialSpeedOverRide.SaveState( ckpt );
+    m_dialDiGuyAction.SaveState( ckpt );
+    m_monitorRoadPos.SaveState( ckpt );
+    ckpt.Put( m_lastState );
+    ckpt.Put( m_quitAtEnd );
+    ckpt.Put( m_last3DPos );
+    ckpt.Put( m_lastDirection );
+    ckpt.Put( m_lastOrientation );
+    ckpt.Put( m_dependent );
+    ckpt.Put( m_isDiGuy );
+    ckpt.Put( m_speedOveride );
+    ckpt.Put( m_doOverideSpeed );
+    ckpt.Put( m_takeAccelIntoAccount );
+    ckpt.Put( m_referencePoint );
+    ckpt.Put( m_target );
+    ckpt.Put( m_vehicleReferencePoint );
+    m_initConditions.SaveState( ckpt );
+    // m_lastSplinePos is of type CCubicSplinePos and is not checkpointed
+    // m_spline is of type CSplineHermiteNonNorm and is not checkpointed
+    // m_pDdo is of type CVED::CTrajFollowerObj* and is not checkpointed
+    ckpt.Put( m_velocityVector );
+    ckpt.Put( m_delayVector );
+    ckpt.Put( m_orientVector );
+    ckpt.Put( m_trajIsGlobal );
+    ckpt.Put( m_parentName );
+    ckpt.Put( m_curModeDialVal );
+    ckpt.Put( m_initPosOffset );
+    ckpt.Put( m_useInitVel );
+    ckpt.Put( m_enableAni );
+    ckpt.Put( m_currentVel );
+    ckpt.Put( m_maxAccel_fps2 );
+    ckpt.Put( m_maxDecel_fps2 );
+    ckpt.Put( m_isAnimationOn );
+    ckpt.Put( m_isFirstRun );
+    // m_debugPointsFile is of type FILE* and is not checkpointed
+    ckpt.Put( m_prevRoadPosFrame );
+    ckpt.Put( m_currRoadPos );
+    ckpt.Put( m_currDiGuyActionDialString );
+    SaveUserState( ckpt );
+
+}
+
+void CDdo::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonTurnOnAnimation.RestoreState( ckpt );
+    m_buttonTurnOffAnimation.RestoreState( ckpt );
+    m_dialAudioState.RestoreState( ckpt );
+    m_dialVisualState.RestoreState( ckpt );
+    m_dialMode.RestoreState( ckpt );
+    m_dialDependent.RestoreState( ckpt );
+    m_dialSpeedOverRide.RestoreState( ckpt );
+    m_dialDiGuyAction.RestoreState( ckpt );
+    m_monitorRoadPos.RestoreState( ckpt );
+    ckpt.Get( m_lastState );
+    ckpt.Get( m_quitAtEnd );
+    ckpt.Get( m_last3DPos );
+    ckpt.Get( m_lastDirection );
+    ckpt.Get( m_lastOrientation );
+    ckpt.Get( m_dependent );
+    ckpt.Get( m_isDiGuy );
+    ckpt.Get( m_speedOveride );
+    ckpt.Get( m_doOverideSpeed );
+    ckpt.Get( m_takeAccelIntoAccount );
+    ckpt.Get( m_referencePoint );
+    ckpt.Get( m_target );
+    ckpt.Get( m_vehicleReferencePoint );
+    m_initConditions.RestoreState( ckpt, *cved );
+    // m_lastSplinePos is of type CCubicSplinePos and is not checkpointed
+    // m_spline is of type CSplineHermiteNonNorm and is not checkpointed
+    // m_pDdo is of type CVED::CTrajFollowerObj* and is not checkpointed
+    ckpt.Get( m_velocityVector );
+    ckpt.Get( m_delayVector );
+    ckpt.Get( m_orientVector );
+    ckpt.Get( m_trajIsGlobal );
+    ckpt.Get( m_parentName );
+    ckpt.Get( m_curModeDialVal );
+    ckpt.Get( m_initPosOffset );
+    ckpt.Get( m_useInitVel );
+    ckpt.Get( m_enableAni );
+    ckpt.Get( m_currentVel );
+    ckpt.Get( m_maxAccel_fps2 );
+    ckpt.Get( m_maxDecel_fps2 );
+    ckpt.Get( m_isAnimationOn );
+    ckpt.Get( m_isFirstRun );
+    // m_debugPointsFile is of type FILE* and is not checkpointed
+    ckpt.Get( m_prevRoadPosFrame );
+    ckpt.Get( m_currRoadPos, *cved );
+    ckpt.Get( m_currDiGuyActionDialString );
+    RestoreUserState( ckpt );
+
+}
+
+void CDdo::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDdoParseBlock* pSnoBlock = dynamic_cast<const CDdoParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CDdo::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDdoParseBlock* pSnoBlock = dynamic_cast<const CDdoParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CDdo::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDdoParseBlock* pSnoBlock = dynamic_cast<const CDdoParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CDdo::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CDdoParseBlock* pSnoBlock = dynamic_cast<const CDdoParseBlock*>(pBaseSnoBlock);
+;
+
+}
+
+bool CDdo::GetButtonTurnOnAnimation()
+{
+
+    return m_buttonTurnOnAnimation.IsButtonPressed();
+
+}
+
+bool CDdo::GetButtonTurnOffAnimation()
+{
+
+    return m_buttonTurnOffAnimation.IsButtonPressed();
+
+}
+
+bool CDdo::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonTurnOnAnimation.GetName() ) {
+        
+        m_buttonTurnOnAnimation.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonTurnOffAnimation.GetName() ) {
+        
+        m_buttonTurnOffAnimation.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+int CDdo::GetDialAudioState()
+{
+
+    return m_dialAudioState.GetValue();
+
+}
+
+void CDdo::SetDialAudioState( int value )
+{
+
+    m_dialAudioState.SetValue( value );
+
+}
+
+void CDdo::SetDialAudioStateNoValue()
+{
+
+    m_dialAudioState.SetNoValue();
+
+}
+
+int CDdo::GetDialVisualState()
+{
+
+    return m_dialVisualState.GetValue();
+
+}
+
+void CDdo::SetDialVisualState( int value )
+{
+
+    m_dialVisualState.SetValue( value );
+
+}
+
+void CDdo::SetDialVisualStateNoValue()
+{
+
+    m_dialVisualState.SetNoValue();
+
+}
+
+int CDdo::GetDialMode()
+{
+
+    return m_dialMode.GetValue();
+
+}
+
+void CDdo::SetDialMode( int value )
+{
+
+    m_dialMode.SetValue( value );
+
+}
+
+void CDdo::SetDialModeNoValue()
+{
+
+    m_dialMode.SetNoValue();
+
+}
+
+int CDdo::GetDialDependent()
+{
+
+    return m_dialDependent.GetValue();
+
+}
+
+void CDdo::SetDialDependent( int value )
+{
+
+    m_dialDependent.SetValue( value );
+
+}
+
+void CDdo::SetDialDependentNoValue()
+{
+
+    m_dialDependent.SetNoValue();
+
+}
+
+double CDdo::GetDialSpeedOverRide()
+{
+
+    return m_dialSpeedOverRide.GetValue();
+
+}
+
+void CDdo::SetDialSpeedOverRide( double value )
+{
+
+    m_dialSpeedOverRide.SetValue( value );
+
+}
+
+void CDdo::SetDialSpeedOverRideNoValue()
+{
+
+    m_dialSpeedOverRide.SetNoValue();
+
+}
+
+const string& CDdo::GetDialDiGuyAction()
+{
+
+    return m_dialDiGuyAction.GetValue();
+
+}
+
+void CDdo::SetDialDiGuyAction( const string& value )
+{
+
+    m_dialDiGuyAction.SetValue( value );
+
+}
+
+void CDdo::SetDialDiGuyActionNoValue()
+{
+
+    m_dialDiGuyAction.SetNoValue();
+
+}
+
+bool CDdo::SetDialByName( const string& dialName, const int& value )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialMode.GetName() ) {
+        
+        m_dialMode.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialDependent.GetName() ) {
+        
+        m_dialDependent.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::SetDialByName( const string& dialName, const double& value )
+{
+
+    if ( dialName == m_dialSpeedOverRide.GetName() ) {
+        
+        m_dialSpeedOverRide.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialDiGuyAction.GetName() ) {
+        
+        m_dialDiGuyAction.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDdo::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDdo::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialMode.GetName() ) {
+        
+        m_dialMode.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialDependent.GetName() ) {
+        
+        m_dialDependent.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSpeedOverRide.GetName() ) {
+        
+        m_dialSpeedOverRide.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialDiGuyAction.GetName() ) {
+        
+        m_dialDiGuyAction.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        return m_dialAudioState.HasValue();
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        return m_dialVisualState.HasValue();
+        
+    }
+    if ( dialName == m_dialMode.GetName() ) {
+        
+        return m_dialMode.HasValue();
+        
+    }
+    if ( dialName == m_dialDependent.GetName() ) {
+        
+        return m_dialDependent.HasValue();
+        
+    }
+    if ( dialName == m_dialSpeedOverRide.GetName() ) {
+        
+        return m_dialSpeedOverRide.HasValue();
+        
+    }
+    if ( dialName == m_dialDiGuyAction.GetName() ) {
+        
+        return m_dialDiGuyAction.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialMode.GetName() ) {
+        
+        m_dialMode.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialDependent.GetName() ) {
+        
+        m_dialDependent.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSpeedOverRide.GetName() ) {
+        
+        m_dialSpeedOverRide.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialDiGuyAction.GetName() ) {
+        
+        m_dialDiGuyAction.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const CRoadPos& CDdo::GetMonitorRoadPos()
+{
+
+    return m_monitorRoadPos.GetValue();
+
+}
+
+void CDdo::SetMonitorRoadPos( const CRoadPos& value )
+{
+
+    m_monitorRoadPos.SetValue( value );
+
+}
+
+void CDdo::SetMonitorRoadPosNoValue()
+{
+
+    m_monitorRoadPos.SetNoValue();
+
+}
+
+bool CDdo::GetMonitorByName( const string& monitorName, CRoadPos* pValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::BorrowMonitorByName( const string& monitorName, const CRoadPos** ppValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDdo::GetMonitorByName( const string& monitorName, CCrdr* pValue )
+{
+
+    return false;
+
+}
+
+bool CDdo::BorrowMonitorByName( const string& monitorName, const CCrdr** ppValue )
+{
+
+    return false;
+
+}
+
+bool CDdo::GetMonitorByName( const string& monitorName, int* pValue )
+{
+
+    return false;
+
+}
+
+bool CDdo::GetMonitorByName( const string& monitorName, bool* pValue )
+{
+
+    return false;
+
+}
+
+bool CDdo::GetMonitorByName( const string& monitorName, string* pValue )
+{
+
+    return false;
+
+}
+
+bool CDdo::BorrowMonitorByName( const string& monitorName, const string** ppValue )
+{
+
+    return false;
+
+}
+
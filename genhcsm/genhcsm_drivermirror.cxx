@@ -0,0 +1,519 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CDriverMirror::CDriverMirror(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "DriverMirror",
+            true,
+            36
+            )
+,
+    m_dialTargetVelocity( pRootCollection, "TargetVelocity" ),
+    m_monitorRoadPos( pRootCollection, "RoadPos" ),
+    m_monitorTrailerPos( pRootCollection, "TrailerPos" ),
+    m_monitorTargCrdr( pRootCollection, "TargCrdr" ),
+    m_monitorStoppedBehindObj( pRootCollection, "StoppedBehindObj" ),
+    m_monitorImTargCrdrs( pRootCollection, "ImTargCrdrs" )
+{
+
+
+}
+
+CDriverMirror::CDriverMirror( const CDriverMirror& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_dialTargetVelocity( objToCopy.m_pRootCollection, objToCopy.m_dialTargetVelocity.GetName() ),
+    m_monitorRoadPos( objToCopy.m_pRootCollection, objToCopy.m_monitorRoadPos.GetName() ),
+    m_monitorTrailerPos( objToCopy.m_pRootCollection, objToCopy.m_monitorTrailerPos.GetName() ),
+    m_monitorTargCrdr( objToCopy.m_pRootCollection, objToCopy.m_monitorTargCrdr.GetName() ),
+    m_monitorStoppedBehindObj( objToCopy.m_pRootCollection, objToCopy.m_monitorStoppedBehindObj.GetName() ),
+    m_monitorImTargCrdrs( objToCopy.m_pRootCollection, objToCopy.m_monitorImTargCrdrs.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CDriverMirror& CDriverMirror::operator=(
+            const CDriverMirror& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CDriverMirror::~CDriverMirror()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CDriverMirror::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_dialTargetVelocity.SaveState( ckpt );
+    m_monitorRoadPos.SaveState( ckpt );
+    m_monitorTrailerPos.SaveState( ckpt );
+    m_monitorTargCrdr.SaveState( ckpt );
+    m_monitorStoppedBehindObj.SaveState( ckpt );
+    m_monitorImTargCrdrs.SaveState( ckpt );
+    ckpt.Put( m_signaledIntrsctns );
+    ckpt.Put( m_prevRoadPosFrame );
+    ckpt.Put( m_registeredHcsmId );
+    ckpt.Put( m_currRoadPos );
+    ckpt.Put( m_prevRoadPos );
+    ckpt.Put( m_prevTrailerPosFrame );
+    ckpt.Put( m_currTrailerPos );
+    ckpt.Put( m_prevTargCrdr );
+    SaveUserState( ckpt );
+
+}
+
+void CDriverMirror::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_dialTargetVelocity.RestoreState( ckpt );
+    m_monitorRoadPos.RestoreState( ckpt );
+    m_monitorTrailerPos.RestoreState( ckpt );
+    m_monitorTargCrdr.RestoreState( ckpt );
+    m_monitorStoppedBehindObj.RestoreState( ckpt );
+    m_monitorImTargCrdrs.RestoreState( ckpt );
+    ckpt.Get( m_signaledIntrsctns );
+    ckpt.Get( m_prevRoadPosFrame );
+    ckpt.Get( m_registeredHcsmId );
+    ckpt.Get( m_currRoadPos, *cved );
+    ckpt.Get( m_prevRoadPos, *cved );
+    ckpt.Get( m_prevTrailerPosFrame );
+    ckpt.Get( m_currTrailerPos, *cved );
+    ckpt.Get( m_prevTargCrdr, *cved );
+    RestoreUserState( ckpt );
+
+}
+
+void CDriverMirror::Creation()
+{
+
+	UserCreation();
+
+}
+
+void CDriverMirror::Deletion()
+{
+
+	UserDeletion();
+
+}
+
+void CDriverMirror::PreActivity()
+{
+
+	UserPreActivity();
+
+}
+
+void CDriverMirror::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+const string& CDriverMirror::GetDialTargetVelocity()
+{
+
+    return m_dialTargetVelocity.GetValue();
+
+}
+
+void CDriverMirror::SetDialTargetVelocity( const string& value )
+{
+
+    m_dialTargetVelocity.SetValue( value );
+
+}
+
+void CDriverMirror::SetDialTargetVelocityNoValue()
+{
+
+    m_dialTargetVelocity.SetNoValue();
+
+}
+
+bool CDriverMirror::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDriverMirror::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDriverMirror::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDriverMirror::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CDriverMirror::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        return m_dialTargetVelocity.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialTargetVelocity.GetName() ) {
+        
+        m_dialTargetVelocity.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const CRoadPos& CDriverMirror::GetMonitorRoadPos()
+{
+
+    return m_monitorRoadPos.GetValue();
+
+}
+
+void CDriverMirror::SetMonitorRoadPos( const CRoadPos& value )
+{
+
+    m_monitorRoadPos.SetValue( value );
+
+}
+
+void CDriverMirror::SetMonitorRoadPosNoValue()
+{
+
+    m_monitorRoadPos.SetNoValue();
+
+}
+
+const CRoadPos& CDriverMirror::GetMonitorTrailerPos()
+{
+
+    return m_monitorTrailerPos.GetValue();
+
+}
+
+void CDriverMirror::SetMonitorTrailerPos( const CRoadPos& value )
+{
+
+    m_monitorTrailerPos.SetValue( value );
+
+}
+
+void CDriverMirror::SetMonitorTrailerPosNoValue()
+{
+
+    m_monitorTrailerPos.SetNoValue();
+
+}
+
+const CCrdr& CDriverMirror::GetMonitorTargCrdr()
+{
+
+    return m_monitorTargCrdr.GetValue();
+
+}
+
+void CDriverMirror::SetMonitorTargCrdr( const CCrdr& value )
+{
+
+    m_monitorTargCrdr.SetValue( value );
+
+}
+
+void CDriverMirror::SetMonitorTargCrdrNoValue()
+{
+
+    m_monitorTargCrdr.SetNoValue();
+
+}
+
+int CDriverMirror::GetMonitorStoppedBehindObj()
+{
+
+    return m_monitorStoppedBehindObj.GetValue();
+
+}
+
+void CDriverMirror::SetMonitorStoppedBehindObj( int value )
+{
+
+    m_monitorStoppedBehindObj.SetValue( value );
+
+}
+
+void CDriverMirror::SetMonitorStoppedBehindObjNoValue()
+{
+
+    m_monitorStoppedBehindObj.SetNoValue();
+
+}
+
+const string& CDriverMirror::GetMonitorImTargCrdrs()
+{
+
+    return m_monitorImTargCrdrs.GetValue();
+
+}
+
+void CDriverMirror::SetMonitorImTargCrdrs( const string& value )
+{
+
+    m_monitorImTargCrdrs.SetValue( value );
+
+}
+
+void CDriverMirror::SetMonitorImTargCrdrsNoValue()
+{
+
+    m_monitorImTargCrdrs.SetNoValue();
+
+}
+
+bool CDriverMirror::GetMonitorByName( const string& monitorName, CRoadPos* pValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    if ( monitorName == m_monitorTrailerPos.GetName() ) {
+        
+        bool retVal = m_monitorTrailerPos.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorTrailerPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::BorrowMonitorByName( const string& monitorName, const CRoadPos** ppValue )
+{
+
+    if ( monitorName == m_monitorRoadPos.GetName() ) {
+        
+        bool retVal = m_monitorRoadPos.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorRoadPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    if ( monitorName == m_monitorTrailerPos.GetName() ) {
+        
+        bool retVal = m_monitorTrailerPos.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorTrailerPos.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::GetMonitorByName( const string& monitorName, CCrdr* pValue )
+{
+
+    if ( monitorName == m_monitorTargCrdr.GetName() ) {
+        
+        bool retVal = m_monitorTargCrdr.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorTargCrdr.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::BorrowMonitorByName( const string& monitorName, const CCrdr** ppValue )
+{
+
+    if ( monitorName == m_monitorTargCrdr.GetName() ) {
+        
+        bool retVal = m_monitorTargCrdr.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorTargCrdr.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::GetMonitorByName( const string& monitorName, int* pValue )
+{
+
+    if ( monitorName == m_monitorStoppedBehindObj.GetName() ) {
+        
+        bool retVal = m_monitorStoppedBehindObj.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorStoppedBehindObj.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::GetMonitorByName( const string& monitorName, bool* pValue )
+{
+
+    return false;
+
+}
+
+bool CDriverMirror::GetMonitorByName( const string& monitorName, string* pValue )
+{
+
+    if ( monitorName == m_monitorImTargCrdrs.GetName() ) {
+        
+        bool retVal = m_monitorImTargCrdrs.HasValue();
+        if ( retVal ) {
+            *pValue = m_monitorImTargCrdrs.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
+bool CDriverMirror::BorrowMonitorByName( const string& monitorName, const string** ppValue )
+{
+
+    if ( monitorName == m_monitorImTargCrdrs.GetName() ) {
+        
+        bool retVal = m_monitorImTargCrdrs.HasValue();
+        if ( retVal ) {
+            *ppValue = &m_monitorImTargCrdrs.GetValue();
+        }
+        
+        return retVal;
+        
+    }
+    
+    return false;
+
+}
+
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CEnviroInfo::CEnviroInfo(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CEnviroInfoParseBlock( snoBlock ),
+            "EnviroInfo",
+            true,
+            28
+            )
+
+{
+
+
+}
+
+CEnviroInfo::CEnviroInfo( const CEnviroInfo& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CEnviroInfo& CEnviroInfo::operator=(
+            const CEnviroInfo& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CEnviroInfo::~CEnviroInfo()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CEnviroInfo::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CEnviroInfo::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CEnviroInfo::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnviroInfoParseBlock* pSnoBlock = dynamic_cast<const CEnviroInfoParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CEnviroInfo::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnviroInfoParseBlock* pSnoBlock = dynamic_cast<const CEnviroInfoParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CEnviroInfo::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnviroInfoParseBlock* pSnoBlock = dynamic_cast<const CEnviroInfoParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CEnviroInfo::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnviroInfoParseBlock* pSnoBlock = dynamic_cast<const CEnviroInfoParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
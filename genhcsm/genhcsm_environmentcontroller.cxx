@@ -0,0 +1,118 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CEnvironmentController::CEnvironmentController(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CEnvControlParseBlock( snoBlock ),
+            "EnvironmentController",
+            true,
+            27
+            )
+
+{
+
+
+}
+
+CEnvironmentController::CEnvironmentController( const CEnvironmentController& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CEnvironmentController& CEnvironmentController::operator=(
+            const CEnvironmentController& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CEnvironmentController::~CEnvironmentController()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CEnvironmentController::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CEnvironmentController::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CEnvironmentController::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnvControlParseBlock* pSnoBlock = dynamic_cast<const CEnvControlParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CEnvironmentController::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnvControlParseBlock* pSnoBlock = dynamic_cast<const CEnvControlParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CEnvironmentController::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnvControlParseBlock* pSnoBlock = dynamic_cast<const CEnvControlParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CEnvironmentController::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CEnvControlParseBlock* pSnoBlock = dynamic_cast<const CEnvControlParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
@@ -0,0 +1,183 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CExpressionTrigger::CExpressionTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTriggerParseBlock( snoBlock ),
+            "ExpressionTrigger",
+            true,
+            7
+            )
+,
+    m_buttonFireTrigger( pRootCollection, "FireTrigger" )
+{
+
+
+}
+
+CExpressionTrigger::CExpressionTrigger( const CExpressionTrigger& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonFireTrigger( objToCopy.m_pRootCollection, objToCopy.m_buttonFireTrigger.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CExpressionTrigger& CExpressionTrigger::operator=(
+            const CExpressionTrigger& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CExpressionTrigger::~CExpressionTrigger()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CExpressionTrigger::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonFireTrigger.SaveState( ckpt );
+    m_initCondition.SaveState( ckpt );
+    m_fireCondition.SaveState( ckpt );
+    ckpt.Put( m_prevPosition );
+    ckpt.Put( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Put( m_sequentialActions );
+    ckpt.Put( m_delayFrameCount );
+    ckpt.Put( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    // m_expEval is of type CExpEval and is not checkpointed
+    ckpt.Put( m_expression );
+    ckpt.Put( m_parsedExpression );
+    ckpt.Put( m_nthFromStart );
+    ckpt.Put( m_nthFromEnd );
+    ckpt.Put( m_nAhead );
+    ckpt.Put( m_nBehind );
+    ckpt.Put( m_debug );
+    SaveUserState( ckpt );
+
+}
+
+void CExpressionTrigger::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonFireTrigger.RestoreState( ckpt );
+    m_initCondition.RestoreState( ckpt, *cved );
+    m_fireCondition.RestoreState( ckpt, *cved );
+    ckpt.Get( m_prevPosition );
+    ckpt.Get( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Get( m_sequentialActions );
+    ckpt.Get( m_delayFrameCount );
+    ckpt.Get( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    // m_expEval is of type CExpEval and is not checkpointed
+    ckpt.Get( m_expression );
+    ckpt.Get( m_parsedExpression );
+    ckpt.Get( m_nthFromStart );
+    ckpt.Get( m_nthFromEnd );
+    ckpt.Get( m_nAhead );
+    ckpt.Get( m_nBehind );
+    ckpt.Get( m_debug );
+    RestoreUserState( ckpt );
+
+}
+
+void CExpressionTrigger::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CExpressionTrigger::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CExpressionTrigger::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CExpressionTrigger::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	;
+
+}
+
+bool CExpressionTrigger::GetButtonFireTrigger()
+{
+
+    return m_buttonFireTrigger.IsButtonPressed();
+
+}
+
+bool CExpressionTrigger::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonFireTrigger.GetName() ) {
+        
+        m_buttonFireTrigger.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
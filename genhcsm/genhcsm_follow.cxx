@@ -0,0 +1,181 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CFollow::CFollow(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "Follow",
+            false,
+            15
+            )
+,
+    m_inputpI( "pI" ),
+    m_outputTargAccel( "TargAccel" )
+{
+
+
+}
+
+CFollow::CFollow( const CFollow& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CFollow& CFollow::operator=(
+            const CFollow& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CFollow::~CFollow()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CFollow::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    ckpt.Put( m_ownVehicleRefreshFrame );
+    ckpt.Put( m_ownVehicleRoadPos );
+    ckpt.Put( m_followRandomization );
+    ckpt.Put( m_currFollEngTime );
+    ckpt.Put( m_initFollDist );
+    ckpt.Put( m_lastLeadId );
+    ckpt.Put( m_prevFollowActualDist );
+    SaveUserState( ckpt );
+
+}
+
+void CFollow::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    ckpt.Get( m_ownVehicleRefreshFrame );
+    ckpt.Get( m_ownVehicleRoadPos, *cved );
+    ckpt.Get( m_followRandomization );
+    ckpt.Get( m_currFollEngTime );
+    ckpt.Get( m_initFollDist );
+    ckpt.Get( m_lastLeadId );
+    ckpt.Get( m_prevFollowActualDist );
+    RestoreUserState( ckpt );
+
+}
+
+void CFollow::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CFollow::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CFollow::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+CAdoInfoPtr CFollow::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CFollow::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CFollow::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+double CFollow::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CFollow::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CFollow::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CFollow::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
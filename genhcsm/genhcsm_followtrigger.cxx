@@ -0,0 +1,197 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CFollowTrigger::CFollowTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTriggerParseBlock( snoBlock ),
+            "FollowTrigger",
+            true,
+            8
+            )
+,
+    m_buttonFireTrigger( pRootCollection, "FireTrigger" )
+{
+
+
+}
+
+CFollowTrigger::CFollowTrigger( const CFollowTrigger& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonFireTrigger( objToCopy.m_pRootCollection, objToCopy.m_buttonFireTrigger.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CFollowTrigger& CFollowTrigger::operator=(
+            const CFollowTrigger& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CFollowTrigger::~CFollowTrigger()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CFollowTrigger::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonFireTrigger.SaveState( ckpt );
+    m_initCondition.SaveState( ckpt );
+    m_fireCondition.SaveState( ckpt );
+    ckpt.Put( m_prevPosition );
+    ckpt.Put( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Put( m_sequentialActions );
+    ckpt.Put( m_delayFrameCount );
+    ckpt.Put( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    ckpt.Put( m_path );
+    // m_leaderInfo is of type CTriggerParseBlock::TFollowInfo and is not checkpointed
+    // m_followerInfo is of type CTriggerParseBlock::TFollowInfo and is not checkpointed
+    ckpt.Put( m_isExpression );
+    ckpt.Put( m_isFollowTime );
+    ckpt.Put( m_followTime );
+    ckpt.Put( m_followDist );
+    ckpt.Put( m_toleranceMinus );
+    ckpt.Put( m_tolerancePlus );
+    ckpt.Put( m_minDuration );
+    ckpt.Put( m_percentSpeedMatch );
+    ckpt.Put( m_framesInRange );
+    ckpt.Put( m_requireSameLane );
+    ckpt.Put( m_expression );
+    // m_exprEval is of type CExpEval and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CFollowTrigger::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonFireTrigger.RestoreState( ckpt );
+    m_initCondition.RestoreState( ckpt, *cved );
+    m_fireCondition.RestoreState( ckpt, *cved );
+    ckpt.Get( m_prevPosition );
+    ckpt.Get( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Get( m_sequentialActions );
+    ckpt.Get( m_delayFrameCount );
+    ckpt.Get( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    ckpt.Get( m_path, *cved );
+    // m_leaderInfo is of type CTriggerParseBlock::TFollowInfo and is not checkpointed
+    // m_followerInfo is of type CTriggerParseBlock::TFollowInfo and is not checkpointed
+    ckpt.Get( m_isExpression );
+    ckpt.Get( m_isFollowTime );
+    ckpt.Get( m_followTime );
+    ckpt.Get( m_followDist );
+    ckpt.Get( m_toleranceMinus );
+    ckpt.Get( m_tolerancePlus );
+    ckpt.Get( m_minDuration );
+    ckpt.Get( m_percentSpeedMatch );
+    ckpt.Get( m_framesInRange );
+    ckpt.Get( m_requireSameLane );
+    ckpt.Get( m_expression );
+    // m_exprEval is of type CExpEval and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CFollowTrigger::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CFollowTrigger::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CFollowTrigger::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CFollowTrigger::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	;
+
+}
+
+bool CFollowTrigger::GetButtonFireTrigger()
+{
+
+    return m_buttonFireTrigger.IsButtonPressed();
+
+}
+
+bool CFollowTrigger::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonFireTrigger.GetName() ) {
+        
+        m_buttonFireTrigger.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
@@ -0,0 +1,331 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CFreeDrive::CFreeDrive(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "FreeDrive",
+            false,
+            14
+            )
+,
+    m_inputpI( "pI" ),
+    m_outputTargPos( "TargPos" ),
+    m_outputTargVel( "TargVel" ),
+    m_outputTargSteer( "TargSteer" ),
+    m_outputTargAccel( "TargAccel" ),
+    m_outputMaxSteer( "MaxSteer" )
+{
+
+
+}
+
+CFreeDrive::CFreeDrive( const CFreeDrive& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_outputTargPos( objToCopy.m_outputTargPos.GetName() ),
+    m_outputTargVel( objToCopy.m_outputTargVel.GetName() ),
+    m_outputTargSteer( objToCopy.m_outputTargSteer.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() ),
+    m_outputMaxSteer( objToCopy.m_outputMaxSteer.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CFreeDrive& CFreeDrive::operator=(
+            const CFreeDrive& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CFreeDrive::~CFreeDrive()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CFreeDrive::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_outputTargPos.SaveState( ckpt );
+    m_outputTargVel.SaveState( ckpt );
+    m_outputTargSteer.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    m_outputMaxSteer.SaveState( ckpt );
+    ckpt.Put( m_targDistRoadPos );
+    ckpt.Put( m_prevTargAccel );
+    ckpt.PutPod( m_command );
+    ckpt.Put( m_listeningToCurvature );
+    ckpt.Put( m_waitTimeFrame );
+    ckpt.Put( m_laneOffsetPrevFrame );
+    ckpt.Put( m_laneOffsetPrev );
+    ckpt.Put( m_curveOffsetPrev );
+    ckpt.Put( m_currFollEngTime );
+    ckpt.Put( m_initFollDist );
+    ckpt.Put( m_lastMaintainGapId );
+    ckpt.Put( m_maintainGapPrevActualDist );
+    ckpt.PutPod( m_mgParams );
+    ckpt.Put( m_maintainGapDurationCounter );
+    ckpt.Put( m_maintainGapCounter );
+    ckpt.Put( m_prevDistToCurv );
+    ckpt.Put( m_refreshSpeedRandomizationFrame );
+    ckpt.Put( m_speedRandomization );
+    SaveUserState( ckpt );
+
+}
+
+void CFreeDrive::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_outputTargPos.RestoreState( ckpt );
+    m_outputTargVel.RestoreState( ckpt );
+    m_outputTargSteer.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    m_outputMaxSteer.RestoreState( ckpt );
+    ckpt.Get( m_targDistRoadPos, *cved );
+    ckpt.Get( m_prevTargAccel );
+    ckpt.GetPod( m_command );
+    ckpt.Get( m_listeningToCurvature );
+    ckpt.Get( m_waitTimeFrame );
+    ckpt.Get( m_laneOffsetPrevFrame );
+    ckpt.Get( m_laneOffsetPrev );
+    ckpt.Get( m_curveOffsetPrev );
+    ckpt.Get( m_currFollEngTime );
+    ckpt.Get( m_initFollDist );
+    ckpt.Get( m_lastMaintainGapId );
+    ckpt.Get( m_maintainGapPrevActualDist );
+    ckpt.GetPod( m_mgParams );
+    ckpt.Get( m_maintainGapDurationCounter );
+    ckpt.Get( m_maintainGapCounter );
+    ckpt.Get( m_prevDistToCurv );
+    ckpt.Get( m_refreshSpeedRandomizationFrame );
+    ckpt.Get( m_speedRandomization );
+    RestoreUserState( ckpt );
+
+}
+
+void CFreeDrive::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CFreeDrive::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CFreeDrive::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+CAdoInfoPtr CFreeDrive::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CFreeDrive::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CFreeDrive::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CPoint3D CFreeDrive::GetOutputTargPos()
+{
+
+    return m_outputTargPos.GetValue();
+
+}
+
+bool CFreeDrive::HasValueOutputTargPos()
+{
+
+    return m_outputTargPos.HasValue();
+
+}
+
+void CFreeDrive::SetOutputTargPos( CPoint3D value )
+{
+
+    m_outputTargPos.SetValue( value );
+
+}
+
+void CFreeDrive::SetOutputTargPosNoValue()
+{
+
+    m_outputTargPos.SetNoValue();
+
+}
+
+double CFreeDrive::GetOutputTargVel()
+{
+
+    return m_outputTargVel.GetValue();
+
+}
+
+bool CFreeDrive::HasValueOutputTargVel()
+{
+
+    return m_outputTargVel.HasValue();
+
+}
+
+void CFreeDrive::SetOutputTargVel( double value )
+{
+
+    m_outputTargVel.SetValue( value );
+
+}
+
+void CFreeDrive::SetOutputTargVelNoValue()
+{
+
+    m_outputTargVel.SetNoValue();
+
+}
+
+double CFreeDrive::GetOutputTargSteer()
+{
+
+    return m_outputTargSteer.GetValue();
+
+}
+
+bool CFreeDrive::HasValueOutputTargSteer()
+{
+
+    return m_outputTargSteer.HasValue();
+
+}
+
+void CFreeDrive::SetOutputTargSteer( double value )
+{
+
+    m_outputTargSteer.SetValue( value );
+
+}
+
+void CFreeDrive::SetOutputTargSteerNoValue()
+{
+
+    m_outputTargSteer.SetNoValue();
+
+}
+
+double CFreeDrive::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CFreeDrive::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CFreeDrive::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CFreeDrive::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
+double CFreeDrive::GetOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.GetValue();
+
+}
+
+bool CFreeDrive::HasValueOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.HasValue();
+
+}
+
+void CFreeDrive::SetOutputMaxSteer( double value )
+{
+
+    m_outputMaxSteer.SetValue( value );
+
+}
+
+void CFreeDrive::SetOutputMaxSteerNoValue()
+{
+
+    m_outputMaxSteer.SetNoValue();
+
+}
+
@@ -0,0 +1,112 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CGateway::CGateway(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CGatewayParseBlock( snoBlock ),
+            "Gateway",
+            true,
+            10
+            )
+
+{
+
+
+}
+
+CGateway::CGateway( const CGateway& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CGateway& CGateway::operator=(
+            const CGateway& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CGateway::~CGateway()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CGateway::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    // m_pIo is of type CGatewayIo* and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CGateway::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    // m_pIo is of type CGatewayIo* and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CGateway::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CGatewayParseBlock* pSnoBlock = dynamic_cast<const CGatewayParseBlock*>(pBaseSnoBlock);
+	CreateWorker( pSnoBlock );
+
+}
+
+void CGateway::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CGatewayParseBlock* pSnoBlock = dynamic_cast<const CGatewayParseBlock*>(pBaseSnoBlock);
+	DeleteWorker( pSnoBlock );
+
+}
+
+void CGateway::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CGatewayParseBlock* pSnoBlock = dynamic_cast<const CGatewayParseBlock*>(pBaseSnoBlock);
+	Worker( );
+
+}
+
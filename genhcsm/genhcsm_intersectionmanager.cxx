@@ -0,0 +1,128 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CIntersectionManager::CIntersectionManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CIntersectionMngrParseBlock( snoBlock ),
+            "IntersectionManager",
+            true,
+            29
+            )
+
+{
+
+
+}
+
+CIntersectionManager::CIntersectionManager( const CIntersectionManager& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CIntersectionManager& CIntersectionManager::operator=(
+            const CIntersectionManager& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CIntersectionManager::~CIntersectionManager()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CIntersectionManager::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    ckpt.Put( m_activeIntrsctnsLastElem );
+    // m_freeActiveIntrsctnsIdx is of type queue<int> and is not checkpointed
+    // m_crdrList is of type vector<TCrdrPriorityList> and is not checkpointed
+    // m_vehPriorityList is of type vector<TVehiclePriorityList> and is not checkpointed
+    // m_attachedList is of type vector<TAttachedList> and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CIntersectionManager::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    ckpt.Get( m_activeIntrsctnsLastElem );
+    // m_freeActiveIntrsctnsIdx is of type queue<int> and is not checkpointed
+    // m_crdrList is of type vector<TCrdrPriorityList> and is not checkpointed
+    // m_vehPriorityList is of type vector<TVehiclePriorityList> and is not checkpointed
+    // m_attachedList is of type vector<TAttachedList> and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CIntersectionManager::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CIntersectionMngrParseBlock* pSnoBlock = dynamic_cast<const CIntersectionMngrParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CIntersectionManager::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CIntersectionMngrParseBlock* pSnoBlock = dynamic_cast<const CIntersectionMngrParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CIntersectionManager::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CIntersectionMngrParseBlock* pSnoBlock = dynamic_cast<const CIntersectionMngrParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CIntersectionManager::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CIntersectionMngrParseBlock* pSnoBlock = dynamic_cast<const CIntersectionMngrParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
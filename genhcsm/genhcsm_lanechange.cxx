@@ -0,0 +1,427 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLaneChange::CLaneChange(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmSequential(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "LaneChange",
+            false,
+            16
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputFreeDriveTargVel( "FreeDriveTargVel" ),
+    m_outputTargAccel( "TargAccel" ),
+    m_outputTargPos( "TargPos" ),
+    m_outputMaxSteer( "MaxSteer" )
+{
+
+    // add my children
+    AddChild( new CLcMonitor( pRootCollection, snoBlock ) );
+    AddChild( new CLcSignal( pRootCollection, snoBlock ) );
+    AddChild( new CLcExecute( pRootCollection, snoBlock ) );
+    AddChild( new CLcAbort( pRootCollection, snoBlock ) );
+
+    m_activeChild = m_children[0];
+    m_defaultActiveChild = m_children[0];
+
+
+}
+
+CLaneChange::CLaneChange( const CLaneChange& objToCopy ):
+    CHcsmSequential(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputFreeDriveTargVel( objToCopy.m_inputFreeDriveTargVel.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() ),
+    m_outputTargPos( objToCopy.m_outputTargPos.GetName() ),
+    m_outputMaxSteer( objToCopy.m_outputMaxSteer.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLaneChange& CLaneChange::operator=(
+            const CLaneChange& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLaneChange::~CLaneChange()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CLaneChange::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputFreeDriveTargVel.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    m_outputTargPos.SaveState( ckpt );
+    m_outputMaxSteer.SaveState( ckpt );
+    m_conditions.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLaneChange::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputFreeDriveTargVel.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    m_outputTargPos.RestoreState( ckpt );
+    m_outputMaxSteer.RestoreState( ckpt );
+    m_conditions.RestoreState( ckpt, *cved );
+    RestoreUserState( ckpt );
+
+}
+
+void CLaneChange::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CLaneChange::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Deletion();
+
+}
+
+void CLaneChange::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CLaneChange::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+void CLaneChange::ExecuteTransitions()
+{
+
+    // from "LcMonitor" to "LcExecute"
+    if ( m_activeChild == m_children[0] && m_children[0]->ExecutePredicate( 3 ) ) {
+        
+        m_activeChild = m_children[2];
+        return;
+        
+    }
+
+    // from "LcMonitor" to "LcSignal"
+    if ( m_activeChild == m_children[0] && m_children[0]->ExecutePredicate( 4 ) ) {
+        
+        m_activeChild = m_children[1];
+        return;
+        
+    }
+
+    // from "LcSignal" to "LcExecute"
+    if ( m_activeChild == m_children[1] && m_children[1]->ExecutePredicate( 5 ) ) {
+        
+        m_activeChild = m_children[2];
+        return;
+        
+    }
+
+    // from "LcSignal" to "LcAbort"
+    if ( m_activeChild == m_children[1] && m_children[1]->ExecutePredicate( 6 ) ) {
+        
+        m_activeChild = m_children[3];
+        return;
+        
+    }
+
+    // from "LcExecute" to "LcAbort"
+    if ( m_activeChild == m_children[2] && m_children[2]->ExecutePredicate( 7 ) ) {
+        
+        m_activeChild = m_children[3];
+        return;
+        
+    }
+
+    // from "LcExecute" to "LcMonitor"
+    if ( m_activeChild == m_children[2] && m_children[2]->ExecutePredicate( 8 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+    // from "LcAbort" to "LcMonitor"
+    if ( m_activeChild == m_children[3] && m_children[3]->ExecutePredicate( 9 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+}
+
+CAdoInfoPtr CLaneChange::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLaneChange::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLaneChange::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+double CLaneChange::GetInputFreeDriveTargVel()
+{
+
+    return m_inputFreeDriveTargVel.GetValue();
+
+}
+
+bool CLaneChange::HasValueInputFreeDriveTargVel()
+{
+
+    return m_inputFreeDriveTargVel.HasValue();
+
+}
+
+void CLaneChange::SetInputFreeDriveTargVel( double value )
+{
+
+    m_inputFreeDriveTargVel.SetValue( value );
+
+}
+
+void CLaneChange::SetInputpIForLcMonitor( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcMonitor*>(m_children[0]) )->SetInputpI( value );
+
+}
+
+void CLaneChange::SetInputpCondForLcMonitor( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcMonitor*>(m_children[0]) )->SetInputpCond( value );
+
+}
+
+void CLaneChange::SetInputFreeDriveTargVelForLcMonitor( double value )
+{
+
+    ( dynamic_cast<CLcMonitor*>(m_children[0]) )->SetInputFreeDriveTargVel( value );
+
+}
+
+void CLaneChange::SetInputpIForLcSignal( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcSignal*>(m_children[1]) )->SetInputpI( value );
+
+}
+
+void CLaneChange::SetInputpCondForLcSignal( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcSignal*>(m_children[1]) )->SetInputpCond( value );
+
+}
+
+void CLaneChange::SetInputpIForLcExecute( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcExecute*>(m_children[2]) )->SetInputpI( value );
+
+}
+
+void CLaneChange::SetInputpCondForLcExecute( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcExecute*>(m_children[2]) )->SetInputpCond( value );
+
+}
+
+void CLaneChange::SetInputpIForLcAbort( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcAbort*>(m_children[3]) )->SetInputpI( value );
+
+}
+
+void CLaneChange::SetInputpCondForLcAbort( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcAbort*>(m_children[3]) )->SetInputpCond( value );
+
+}
+
+double CLaneChange::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CLaneChange::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CLaneChange::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CLaneChange::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
+CPoint3D CLaneChange::GetOutputTargPos()
+{
+
+    return m_outputTargPos.GetValue();
+
+}
+
+bool CLaneChange::HasValueOutputTargPos()
+{
+
+    return m_outputTargPos.HasValue();
+
+}
+
+void CLaneChange::SetOutputTargPos( CPoint3D value )
+{
+
+    m_outputTargPos.SetValue( value );
+
+}
+
+void CLaneChange::SetOutputTargPosNoValue()
+{
+
+    m_outputTargPos.SetNoValue();
+
+}
+
+double CLaneChange::GetOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.GetValue();
+
+}
+
+bool CLaneChange::HasValueOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.HasValue();
+
+}
+
+void CLaneChange::SetOutputMaxSteer( double value )
+{
+
+    m_outputMaxSteer.SetValue( value );
+
+}
+
+void CLaneChange::SetOutputMaxSteerNoValue()
+{
+
+    m_outputMaxSteer.SetNoValue();
+
+}
+
+double CLaneChange::GetOutputTargAccelFromLcExecute()
+{
+
+    return ( dynamic_cast<CLcExecute*>(m_children[2]) )->GetOutputTargAccel();
+
+}
+
+bool CLaneChange::HasValueOutputTargAccelFromLcExecute()
+{
+
+    return ( dynamic_cast<CLcExecute*>(m_children[2]) )->HasValueOutputTargAccel();
+
+}
+
+CPoint3D CLaneChange::GetOutputTargPosFromLcExecute()
+{
+
+    return ( dynamic_cast<CLcExecute*>(m_children[2]) )->GetOutputTargPos();
+
+}
+
+bool CLaneChange::HasValueOutputTargPosFromLcExecute()
+{
+
+    return ( dynamic_cast<CLcExecute*>(m_children[2]) )->HasValueOutputTargPos();
+
+}
+
@@ -0,0 +1,190 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcAbort::CLcAbort(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "LcAbort",
+            false,
+            20
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" )
+{
+
+
+}
+
+CLcAbort::CLcAbort( const CLcAbort& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcAbort& CLcAbort::operator=(
+            const CLcAbort& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcAbort::~CLcAbort()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CLcAbort::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    ckpt.Put( m_scenarioTriggeredAbort );
+    ckpt.Put( m_firstFrame );
+    ckpt.Put( m_abortCount );
+    SaveUserState( ckpt );
+
+}
+
+void CLcAbort::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    ckpt.Get( m_scenarioTriggeredAbort );
+    ckpt.Get( m_firstFrame );
+    ckpt.Get( m_abortCount );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcAbort::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CLcAbort::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CLcAbort::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+bool CLcAbort::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 9 ) {
+        
+        return AdoLcAbortLcMonitorPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcAbort::AdoLcAbortLcMonitorPredicate()
+{
+
+	return LcAbortLcMonitorPredicate();
+
+}
+
+CAdoInfoPtr CLcAbort::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcAbort::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcAbort::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcAbort::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcAbort::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcAbort::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
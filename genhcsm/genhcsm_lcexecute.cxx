@@ -0,0 +1,499 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcExecute::CLcExecute(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmSequential(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "LcExecute",
+            false,
+            19
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_outputTargAccel( "TargAccel" ),
+    m_outputTargPos( "TargPos" )
+{
+
+    // add my children
+    AddChild( new CLcExecuteNeutralize( pRootCollection ) );
+    AddChild( new CLcExecuteIncrement( pRootCollection ) );
+    AddChild( new CLcExecuteSteady( pRootCollection ) );
+    AddChild( new CLcExecuteDecrement( pRootCollection ) );
+
+    m_activeChild = m_children[0];
+    m_defaultActiveChild = m_children[0];
+
+
+}
+
+CLcExecute::CLcExecute( const CLcExecute& objToCopy ):
+    CHcsmSequential(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() ),
+    m_outputTargPos( objToCopy.m_outputTargPos.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcExecute& CLcExecute::operator=(
+            const CLcExecute& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcExecute::~CLcExecute()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CLcExecute::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    m_outputTargPos.SaveState( ckpt );
+    ckpt.Put( m_firstFrame );
+    ckpt.Put( m_startLcFrame );
+    ckpt.Put( m_targRoadPos );
+    ckpt.Put( m_storeRoadAngle );
+    ckpt.Put( m_maxRoadAngle );
+    ckpt.Put( m_lastTargetOffset );
+    ckpt.Put( m_currLookAheadTime );
+    ckpt.Put( m_overShotLc );
+    SaveUserState( ckpt );
+
+}
+
+void CLcExecute::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmSequential::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    m_outputTargPos.RestoreState( ckpt );
+    ckpt.Get( m_firstFrame );
+    ckpt.Get( m_startLcFrame );
+    ckpt.Get( m_targRoadPos, *cved );
+    ckpt.Get( m_storeRoadAngle );
+    ckpt.Get( m_maxRoadAngle );
+    ckpt.Get( m_lastTargetOffset );
+    ckpt.Get( m_currLookAheadTime );
+    ckpt.Get( m_overShotLc );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcExecute::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CLcExecute::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CLcExecute::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+void CLcExecute::ExecuteTransitions()
+{
+
+    // from "LcExecuteNeutralize" to "LcExecuteIncrement"
+    if ( m_activeChild == m_children[0] && m_children[0]->ExecutePredicate( 10 ) ) {
+        
+        m_activeChild = m_children[1];
+        return;
+        
+    }
+
+    // from "LcExecuteIncrement" to "LcExecuteSteady"
+    if ( m_activeChild == m_children[1] && m_children[1]->ExecutePredicate( 11 ) ) {
+        
+        m_activeChild = m_children[2];
+        return;
+        
+    }
+
+    // from "LcExecuteSteady" to "LcExecuteDecrement"
+    if ( m_activeChild == m_children[2] && m_children[2]->ExecutePredicate( 12 ) ) {
+        
+        m_activeChild = m_children[3];
+        return;
+        
+    }
+
+    // from "LcExecuteDecrement" to "LcExecuteNeutralize"
+    if ( m_activeChild == m_children[3] && m_children[3]->ExecutePredicate( 13 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+    // from "LcExecuteIncrement" to "LcExecuteNeutralize"
+    if ( m_activeChild == m_children[1] && m_children[1]->ExecutePredicate( 14 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+    // from "LcExecuteSteady" to "LcExecuteNeutralize"
+    if ( m_activeChild == m_children[2] && m_children[2]->ExecutePredicate( 15 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+    // from "LcExecuteDecrement" to "LcExecuteNeutralize"
+    if ( m_activeChild == m_children[3] && m_children[3]->ExecutePredicate( 16 ) ) {
+        
+        m_activeChild = m_children[0];
+        return;
+        
+    }
+
+}
+
+bool CLcExecute::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 7 ) {
+        
+        return AdoLcExecuteLcAbortPredicate();
+        
+    }
+    else if ( functionId == 8 ) {
+        
+        return AdoLcExecuteLcMonitorPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcExecute::AdoLcExecuteLcAbortPredicate()
+{
+
+	return LcExecuteLcAbortPredicate();
+
+}
+bool CLcExecute::AdoLcExecuteLcMonitorPredicate()
+{
+
+	return LcExecuteLcMonitorPredicate();
+
+}
+
+CAdoInfoPtr CLcExecute::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcExecute::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcExecute::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcExecute::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcExecute::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcExecute::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+void CLcExecute::SetInputpIForLcExecuteNeutralize( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteNeutralize*>(m_children[0]) )->SetInputpI( value );
+
+}
+
+void CLcExecute::SetInputpCondForLcExecuteNeutralize( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteNeutralize*>(m_children[0]) )->SetInputpCond( value );
+
+}
+
+void CLcExecute::SetInputpIForLcExecuteIncrement( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->SetInputpI( value );
+
+}
+
+void CLcExecute::SetInputpCondForLcExecuteIncrement( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->SetInputpCond( value );
+
+}
+
+void CLcExecute::SetInputpIForLcExecuteSteady( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->SetInputpI( value );
+
+}
+
+void CLcExecute::SetInputpCondForLcExecuteSteady( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->SetInputpCond( value );
+
+}
+
+void CLcExecute::SetInputpIForLcExecuteDecrement( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->SetInputpI( value );
+
+}
+
+void CLcExecute::SetInputpCondForLcExecuteDecrement( CLcCondsPtr value )
+{
+
+    ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->SetInputpCond( value );
+
+}
+
+double CLcExecute::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CLcExecute::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CLcExecute::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CLcExecute::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
+CPoint3D CLcExecute::GetOutputTargPos()
+{
+
+    return m_outputTargPos.GetValue();
+
+}
+
+bool CLcExecute::HasValueOutputTargPos()
+{
+
+    return m_outputTargPos.HasValue();
+
+}
+
+void CLcExecute::SetOutputTargPos( CPoint3D value )
+{
+
+    m_outputTargPos.SetValue( value );
+
+}
+
+void CLcExecute::SetOutputTargPosNoValue()
+{
+
+    m_outputTargPos.SetNoValue();
+
+}
+
+double CLcExecute::GetOutputTargOffsetFromLcExecuteNeutralize()
+{
+
+    return ( dynamic_cast<CLcExecuteNeutralize*>(m_children[0]) )->GetOutputTargOffset();
+
+}
+
+bool CLcExecute::HasValueOutputTargOffsetFromLcExecuteNeutralize()
+{
+
+    return ( dynamic_cast<CLcExecuteNeutralize*>(m_children[0]) )->HasValueOutputTargOffset();
+
+}
+
+double CLcExecute::GetOutputTargOffsetFromLcExecuteIncrement()
+{
+
+    return ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->GetOutputTargOffset();
+
+}
+
+bool CLcExecute::HasValueOutputTargOffsetFromLcExecuteIncrement()
+{
+
+    return ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->HasValueOutputTargOffset();
+
+}
+
+double CLcExecute::GetOutputTargLookAheadFromLcExecuteIncrement()
+{
+
+    return ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->GetOutputTargLookAhead();
+
+}
+
+bool CLcExecute::HasValueOutputTargLookAheadFromLcExecuteIncrement()
+{
+
+    return ( dynamic_cast<CLcExecuteIncrement*>(m_children[1]) )->HasValueOutputTargLookAhead();
+
+}
+
+double CLcExecute::GetOutputTargOffsetFromLcExecuteSteady()
+{
+
+    return ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->GetOutputTargOffset();
+
+}
+
+bool CLcExecute::HasValueOutputTargOffsetFromLcExecuteSteady()
+{
+
+    return ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->HasValueOutputTargOffset();
+
+}
+
+double CLcExecute::GetOutputTargLookAheadFromLcExecuteSteady()
+{
+
+    return ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->GetOutputTargLookAhead();
+
+}
+
+bool CLcExecute::HasValueOutputTargLookAheadFromLcExecuteSteady()
+{
+
+    return ( dynamic_cast<CLcExecuteSteady*>(m_children[2]) )->HasValueOutputTargLookAhead();
+
+}
+
+double CLcExecute::GetOutputTargOffsetFromLcExecuteDecrement()
+{
+
+    return ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->GetOutputTargOffset();
+
+}
+
+bool CLcExecute::HasValueOutputTargOffsetFromLcExecuteDecrement()
+{
+
+    return ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->HasValueOutputTargOffset();
+
+}
+
+double CLcExecute::GetOutputTargLookAheadFromLcExecuteDecrement()
+{
+
+    return ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->GetOutputTargLookAhead();
+
+}
+
+bool CLcExecute::HasValueOutputTargLookAheadFromLcExecuteDecrement()
+{
+
+    return ( dynamic_cast<CLcExecuteDecrement*>(m_children[3]) )->HasValueOutputTargLookAhead();
+
+}
+
@@ -0,0 +1,239 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcExecuteDecrement::CLcExecuteDecrement(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "LcExecuteDecrement",
+            false,
+            24
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_outputTargOffset( "TargOffset" ),
+    m_outputTargLookAhead( "TargLookAhead" )
+{
+
+
+}
+
+CLcExecuteDecrement::CLcExecuteDecrement( const CLcExecuteDecrement& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_outputTargOffset( objToCopy.m_outputTargOffset.GetName() ),
+    m_outputTargLookAhead( objToCopy.m_outputTargLookAhead.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcExecuteDecrement& CLcExecuteDecrement::operator=(
+            const CLcExecuteDecrement& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcExecuteDecrement::~CLcExecuteDecrement()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CLcExecuteDecrement::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_outputTargOffset.SaveState( ckpt );
+    m_outputTargLookAhead.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLcExecuteDecrement::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_outputTargOffset.RestoreState( ckpt );
+    m_outputTargLookAhead.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcExecuteDecrement::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+bool CLcExecuteDecrement::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 13 ) {
+        
+        return ExecuteLcDecrementLcNeutralizePredicate();
+        
+    }
+    else if ( functionId == 16 ) {
+        
+        return ExecuteLcDecrementLcAbortPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcExecuteDecrement::ExecuteLcDecrementLcNeutralizePredicate()
+{
+
+	return LcDecrementNeutralizePredicate();
+
+}
+bool CLcExecuteDecrement::ExecuteLcDecrementLcAbortPredicate()
+{
+
+	return LcDecrementLcAbortPredicate();
+
+}
+
+CAdoInfoPtr CLcExecuteDecrement::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcExecuteDecrement::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcExecuteDecrement::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcExecuteDecrement::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcExecuteDecrement::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcExecuteDecrement::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+double CLcExecuteDecrement::GetOutputTargOffset()
+{
+
+    return m_outputTargOffset.GetValue();
+
+}
+
+bool CLcExecuteDecrement::HasValueOutputTargOffset()
+{
+
+    return m_outputTargOffset.HasValue();
+
+}
+
+void CLcExecuteDecrement::SetOutputTargOffset( double value )
+{
+
+    m_outputTargOffset.SetValue( value );
+
+}
+
+void CLcExecuteDecrement::SetOutputTargOffsetNoValue()
+{
+
+    m_outputTargOffset.SetNoValue();
+
+}
+
+double CLcExecuteDecrement::GetOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.GetValue();
+
+}
+
+bool CLcExecuteDecrement::HasValueOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.HasValue();
+
+}
+
+void CLcExecuteDecrement::SetOutputTargLookAhead( double value )
+{
+
+    m_outputTargLookAhead.SetValue( value );
+
+}
+
+void CLcExecuteDecrement::SetOutputTargLookAheadNoValue()
+{
+
+    m_outputTargLookAhead.SetNoValue();
+
+}
+
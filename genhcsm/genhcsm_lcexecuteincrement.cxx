@@ -0,0 +1,239 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcExecuteIncrement::CLcExecuteIncrement(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "LcExecuteIncrement",
+            false,
+            22
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_outputTargOffset( "TargOffset" ),
+    m_outputTargLookAhead( "TargLookAhead" )
+{
+
+
+}
+
+CLcExecuteIncrement::CLcExecuteIncrement( const CLcExecuteIncrement& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_outputTargOffset( objToCopy.m_outputTargOffset.GetName() ),
+    m_outputTargLookAhead( objToCopy.m_outputTargLookAhead.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcExecuteIncrement& CLcExecuteIncrement::operator=(
+            const CLcExecuteIncrement& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcExecuteIncrement::~CLcExecuteIncrement()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CLcExecuteIncrement::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_outputTargOffset.SaveState( ckpt );
+    m_outputTargLookAhead.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLcExecuteIncrement::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_outputTargOffset.RestoreState( ckpt );
+    m_outputTargLookAhead.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcExecuteIncrement::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+bool CLcExecuteIncrement::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 11 ) {
+        
+        return ExecuteLcIncrementLcSteadyPredicate();
+        
+    }
+    else if ( functionId == 14 ) {
+        
+        return ExecuteLcIncrementLcAbortPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcExecuteIncrement::ExecuteLcIncrementLcSteadyPredicate()
+{
+
+	return LcIncrementSteadyPredicate();
+
+}
+bool CLcExecuteIncrement::ExecuteLcIncrementLcAbortPredicate()
+{
+
+	return LcIncrementLcAbortPredicate();
+
+}
+
+CAdoInfoPtr CLcExecuteIncrement::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcExecuteIncrement::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcExecuteIncrement::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcExecuteIncrement::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcExecuteIncrement::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcExecuteIncrement::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+double CLcExecuteIncrement::GetOutputTargOffset()
+{
+
+    return m_outputTargOffset.GetValue();
+
+}
+
+bool CLcExecuteIncrement::HasValueOutputTargOffset()
+{
+
+    return m_outputTargOffset.HasValue();
+
+}
+
+void CLcExecuteIncrement::SetOutputTargOffset( double value )
+{
+
+    m_outputTargOffset.SetValue( value );
+
+}
+
+void CLcExecuteIncrement::SetOutputTargOffsetNoValue()
+{
+
+    m_outputTargOffset.SetNoValue();
+
+}
+
+double CLcExecuteIncrement::GetOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.GetValue();
+
+}
+
+bool CLcExecuteIncrement::HasValueOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.HasValue();
+
+}
+
+void CLcExecuteIncrement::SetOutputTargLookAhead( double value )
+{
+
+    m_outputTargLookAhead.SetValue( value );
+
+}
+
+void CLcExecuteIncrement::SetOutputTargLookAheadNoValue()
+{
+
+    m_outputTargLookAhead.SetNoValue();
+
+}
+
@@ -0,0 +1,196 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcExecuteNeutralize::CLcExecuteNeutralize(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "LcExecuteNeutralize",
+            false,
+            21
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_outputTargOffset( "TargOffset" )
+{
+
+
+}
+
+CLcExecuteNeutralize::CLcExecuteNeutralize( const CLcExecuteNeutralize& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_outputTargOffset( objToCopy.m_outputTargOffset.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcExecuteNeutralize& CLcExecuteNeutralize::operator=(
+            const CLcExecuteNeutralize& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcExecuteNeutralize::~CLcExecuteNeutralize()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CLcExecuteNeutralize::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_outputTargOffset.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLcExecuteNeutralize::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_outputTargOffset.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcExecuteNeutralize::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+bool CLcExecuteNeutralize::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 10 ) {
+        
+        return ExecuteLcNeutralizeLcIncrementPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcExecuteNeutralize::ExecuteLcNeutralizeLcIncrementPredicate()
+{
+
+	return LcNeutralizeIncrementPredicate();
+
+}
+
+CAdoInfoPtr CLcExecuteNeutralize::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcExecuteNeutralize::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcExecuteNeutralize::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcExecuteNeutralize::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcExecuteNeutralize::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcExecuteNeutralize::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+double CLcExecuteNeutralize::GetOutputTargOffset()
+{
+
+    return m_outputTargOffset.GetValue();
+
+}
+
+bool CLcExecuteNeutralize::HasValueOutputTargOffset()
+{
+
+    return m_outputTargOffset.HasValue();
+
+}
+
+void CLcExecuteNeutralize::SetOutputTargOffset( double value )
+{
+
+    m_outputTargOffset.SetValue( value );
+
+}
+
+void CLcExecuteNeutralize::SetOutputTargOffsetNoValue()
+{
+
+    m_outputTargOffset.SetNoValue();
+
+}
+
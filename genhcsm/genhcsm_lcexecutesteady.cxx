@@ -0,0 +1,239 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcExecuteSteady::CLcExecuteSteady(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "LcExecuteSteady",
+            false,
+            23
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_outputTargOffset( "TargOffset" ),
+    m_outputTargLookAhead( "TargLookAhead" )
+{
+
+
+}
+
+CLcExecuteSteady::CLcExecuteSteady( const CLcExecuteSteady& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_outputTargOffset( objToCopy.m_outputTargOffset.GetName() ),
+    m_outputTargLookAhead( objToCopy.m_outputTargLookAhead.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcExecuteSteady& CLcExecuteSteady::operator=(
+            const CLcExecuteSteady& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcExecuteSteady::~CLcExecuteSteady()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CLcExecuteSteady::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_outputTargOffset.SaveState( ckpt );
+    m_outputTargLookAhead.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLcExecuteSteady::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_outputTargOffset.RestoreState( ckpt );
+    m_outputTargLookAhead.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcExecuteSteady::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+bool CLcExecuteSteady::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 12 ) {
+        
+        return ExecuteLcSteadyLcDecrementPredicate();
+        
+    }
+    else if ( functionId == 15 ) {
+        
+        return ExecuteLcSteadyLcAbortPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcExecuteSteady::ExecuteLcSteadyLcDecrementPredicate()
+{
+
+	return LcSteadyDecrementPredicate();
+
+}
+bool CLcExecuteSteady::ExecuteLcSteadyLcAbortPredicate()
+{
+
+	return LcSteadyLcAbortPredicate();
+
+}
+
+CAdoInfoPtr CLcExecuteSteady::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcExecuteSteady::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcExecuteSteady::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcExecuteSteady::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcExecuteSteady::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcExecuteSteady::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+double CLcExecuteSteady::GetOutputTargOffset()
+{
+
+    return m_outputTargOffset.GetValue();
+
+}
+
+bool CLcExecuteSteady::HasValueOutputTargOffset()
+{
+
+    return m_outputTargOffset.HasValue();
+
+}
+
+void CLcExecuteSteady::SetOutputTargOffset( double value )
+{
+
+    m_outputTargOffset.SetValue( value );
+
+}
+
+void CLcExecuteSteady::SetOutputTargOffsetNoValue()
+{
+
+    m_outputTargOffset.SetNoValue();
+
+}
+
+double CLcExecuteSteady::GetOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.GetValue();
+
+}
+
+bool CLcExecuteSteady::HasValueOutputTargLookAhead()
+{
+
+    return m_outputTargLookAhead.HasValue();
+
+}
+
+void CLcExecuteSteady::SetOutputTargLookAhead( double value )
+{
+
+    m_outputTargLookAhead.SetValue( value );
+
+}
+
+void CLcExecuteSteady::SetOutputTargLookAheadNoValue()
+{
+
+    m_outputTargLookAhead.SetNoValue();
+
+}
+
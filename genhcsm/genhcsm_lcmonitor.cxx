@@ -0,0 +1,212 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcMonitor::CLcMonitor(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "LcMonitor",
+            false,
+            17
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" ),
+    m_inputFreeDriveTargVel( "FreeDriveTargVel" )
+{
+
+
+}
+
+CLcMonitor::CLcMonitor( const CLcMonitor& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() ),
+    m_inputFreeDriveTargVel( objToCopy.m_inputFreeDriveTargVel.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcMonitor& CLcMonitor::operator=(
+            const CLcMonitor& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcMonitor::~CLcMonitor()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CLcMonitor::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    m_inputFreeDriveTargVel.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CLcMonitor::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    m_inputFreeDriveTargVel.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcMonitor::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CLcMonitor::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+bool CLcMonitor::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 3 ) {
+        
+        return AdoLcMonitorLcExecutePredicate();
+        
+    }
+    else if ( functionId == 4 ) {
+        
+        return AdoLcMonitorLcSignalPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcMonitor::AdoLcMonitorLcExecutePredicate()
+{
+
+	return LcMonitorLcExecutePredicate();
+
+}
+bool CLcMonitor::AdoLcMonitorLcSignalPredicate()
+{
+
+	return LcMonitorLcSignalPredicate();
+
+}
+
+CAdoInfoPtr CLcMonitor::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcMonitor::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcMonitor::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcMonitor::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcMonitor::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcMonitor::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
+double CLcMonitor::GetInputFreeDriveTargVel()
+{
+
+    return m_inputFreeDriveTargVel.GetValue();
+
+}
+
+bool CLcMonitor::HasValueInputFreeDriveTargVel()
+{
+
+    return m_inputFreeDriveTargVel.HasValue();
+
+}
+
+void CLcMonitor::SetInputFreeDriveTargVel( double value )
+{
+
+    m_inputFreeDriveTargVel.SetValue( value );
+
+}
+
@@ -0,0 +1,197 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CLcSignal::CLcSignal(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "LcSignal",
+            false,
+            18
+            )
+,
+    m_inputpI( "pI" ),
+    m_inputpCond( "pCond" )
+{
+
+
+}
+
+CLcSignal::CLcSignal( const CLcSignal& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_inputpCond( objToCopy.m_inputpCond.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CLcSignal& CLcSignal::operator=(
+            const CLcSignal& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CLcSignal::~CLcSignal()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CLcSignal::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_inputpCond.SaveState( ckpt );
+    ckpt.Put( m_signalFrame );
+    SaveUserState( ckpt );
+
+}
+
+void CLcSignal::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_inputpCond.RestoreState( ckpt );
+    ckpt.Get( m_signalFrame );
+    RestoreUserState( ckpt );
+
+}
+
+void CLcSignal::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CLcSignal::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CLcSignal::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+bool CLcSignal::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 5 ) {
+        
+        return AdoLcSignalLcExecutePredicate();
+        
+    }
+    else if ( functionId == 6 ) {
+        
+        return AdoLcSignalLcAbortPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CLcSignal::AdoLcSignalLcExecutePredicate()
+{
+
+	return LcSignalLcExecutePredicate();
+
+}
+bool CLcSignal::AdoLcSignalLcAbortPredicate()
+{
+
+	return LcSignalLcAbortPredicate();
+
+}
+
+CAdoInfoPtr CLcSignal::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CLcSignal::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CLcSignal::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+CLcCondsPtr CLcSignal::GetInputpCond()
+{
+
+    return m_inputpCond.GetValue();
+
+}
+
+bool CLcSignal::HasValueInputpCond()
+{
+
+    return m_inputpCond.HasValue();
+
+}
+
+void CLcSignal::SetInputpCond( CLcCondsPtr value )
+{
+
+    m_inputpCond.SetValue( value );
+
+}
+
@@ -0,0 +1,195 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CMerge::CMerge(
+            CHcsmCollection* pRootCollection
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            "Merge",
+            false,
+            26
+            )
+,
+    m_inputpI( "pI" ),
+    m_outputTargAccel( "TargAccel" )
+{
+
+
+}
+
+CMerge::CMerge( const CMerge& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CMerge& CMerge::operator=(
+            const CMerge& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CMerge::~CMerge()
+{
+
+    // call the deletion function
+    Deletion();
+
+}
+
+void CMerge::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    ckpt.Put( m_state );
+    ckpt.Put( m_isMergeLaneChangeDone );
+    ckpt.Put( m_isOnMergeRoad );
+    ckpt.Put( m_firstFrame );
+    ckpt.Put( m_firstDist );
+    ckpt.Put( m_minDist );
+    ckpt.Put( m_prevFollowActualDist );
+    ckpt.Put( m_currFollEngTime );
+    ckpt.Put( m_initFollDist );
+    ckpt.Put( m_lastLeadId );
+    ckpt.Put( m_distToP1Ado );
+    ckpt.Put( m_distToP1ApprchObj );
+    ckpt.PutPod( m_mergeParams );
+    ckpt.Put( m_mergeTtc );
+    ckpt.Put( m_targCrdr );
+    ckpt.Put( m_distAtP1 );
+    ckpt.Put( m_gapObjId );
+    SaveUserState( ckpt );
+
+}
+
+void CMerge::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    ckpt.Get( m_state );
+    ckpt.Get( m_isMergeLaneChangeDone );
+    ckpt.Get( m_isOnMergeRoad );
+    ckpt.Get( m_firstFrame );
+    ckpt.Get( m_firstDist );
+    ckpt.Get( m_minDist );
+    ckpt.Get( m_prevFollowActualDist );
+    ckpt.Get( m_currFollEngTime );
+    ckpt.Get( m_initFollDist );
+    ckpt.Get( m_lastLeadId );
+    ckpt.Get( m_distToP1Ado );
+    ckpt.Get( m_distToP1ApprchObj );
+    ckpt.GetPod( m_mergeParams );
+    ckpt.Get( m_mergeTtc );
+    ckpt.Get( m_targCrdr, *cved );
+    ckpt.Get( m_distAtP1 );
+    ckpt.Get( m_gapObjId );
+    RestoreUserState( ckpt );
+
+}
+
+void CMerge::Creation()
+{
+
+	UserCreation();
+
+}
+
+void CMerge::PreActivity()
+{
+
+	UserPreActivity();
+
+}
+
+void CMerge::PostActivity()
+{
+
+	UserPostActivity();
+
+}
+
+CAdoInfoPtr CMerge::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CMerge::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CMerge::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+double CMerge::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CMerge::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CMerge::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CMerge::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
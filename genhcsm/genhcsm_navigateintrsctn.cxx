@@ -0,0 +1,283 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CNavigateIntrsctn::CNavigateIntrsctn(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "NavigateIntrsctn",
+            false,
+            25
+            )
+,
+    m_inputpI( "pI" ),
+    m_outputTargAccel( "TargAccel" ),
+    m_outputImTargCrdrs( "ImTargCrdrs" ),
+    m_outputHasStopSignTarget( "HasStopSignTarget" ),
+    m_outputStoppedAtStopSignFrame( "StoppedAtStopSignFrame" )
+{
+
+
+}
+
+CNavigateIntrsctn::CNavigateIntrsctn( const CNavigateIntrsctn& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() ),
+    m_outputImTargCrdrs( objToCopy.m_outputImTargCrdrs.GetName() ),
+    m_outputHasStopSignTarget( objToCopy.m_outputHasStopSignTarget.GetName() ),
+    m_outputStoppedAtStopSignFrame( objToCopy.m_outputStoppedAtStopSignFrame.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CNavigateIntrsctn& CNavigateIntrsctn::operator=(
+            const CNavigateIntrsctn& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CNavigateIntrsctn::~CNavigateIntrsctn()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CNavigateIntrsctn::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    m_outputImTargCrdrs.SaveState( ckpt );
+    m_outputHasStopSignTarget.SaveState( ckpt );
+    m_outputStoppedAtStopSignFrame.SaveState( ckpt );
+    ckpt.Put( m_signaledIntrsctns );
+    ckpt.Put( m_madeStopSignCheck );
+    ckpt.Put( m_stopSignCrdr );
+    ckpt.Put( m_stopSignHldOfsDist );
+    ckpt.Put( m_madeTheNeededStop );
+    ckpt.Put( m_StoppedAtStopSignFrame );
+    ckpt.Put( m_tempStartFrames );
+    ckpt.Put( m_firstFrame );
+    ckpt.Put( m_firstDist );
+    ckpt.Put( m_minDist );
+    SaveUserState( ckpt );
+
+}
+
+void CNavigateIntrsctn::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    m_outputImTargCrdrs.RestoreState( ckpt );
+    m_outputHasStopSignTarget.RestoreState( ckpt );
+    m_outputStoppedAtStopSignFrame.RestoreState( ckpt );
+    ckpt.Get( m_signaledIntrsctns );
+    ckpt.Get( m_madeStopSignCheck );
+    ckpt.Get( m_stopSignCrdr );
+    ckpt.Get( m_stopSignHldOfsDist );
+    ckpt.Get( m_madeTheNeededStop );
+    ckpt.Get( m_StoppedAtStopSignFrame );
+    ckpt.Get( m_tempStartFrames );
+    ckpt.Get( m_firstFrame );
+    ckpt.Get( m_firstDist );
+    ckpt.Get( m_minDist );
+    RestoreUserState( ckpt );
+
+}
+
+void CNavigateIntrsctn::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	Creation();
+
+}
+
+void CNavigateIntrsctn::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PreActivity();
+
+}
+
+void CNavigateIntrsctn::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	PostActivity();
+
+}
+
+CAdoInfoPtr CNavigateIntrsctn::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CNavigateIntrsctn::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CNavigateIntrsctn::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+double CNavigateIntrsctn::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CNavigateIntrsctn::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CNavigateIntrsctn::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CNavigateIntrsctn::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
+string CNavigateIntrsctn::GetOutputImTargCrdrs()
+{
+
+    return m_outputImTargCrdrs.GetValue();
+
+}
+
+bool CNavigateIntrsctn::HasValueOutputImTargCrdrs()
+{
+
+    return m_outputImTargCrdrs.HasValue();
+
+}
+
+void CNavigateIntrsctn::SetOutputImTargCrdrs( string value )
+{
+
+    m_outputImTargCrdrs.SetValue( value );
+
+}
+
+void CNavigateIntrsctn::SetOutputImTargCrdrsNoValue()
+{
+
+    m_outputImTargCrdrs.SetNoValue();
+
+}
+
+bool CNavigateIntrsctn::GetOutputHasStopSignTarget()
+{
+
+    return m_outputHasStopSignTarget.GetValue();
+
+}
+
+bool CNavigateIntrsctn::HasValueOutputHasStopSignTarget()
+{
+
+    return m_outputHasStopSignTarget.HasValue();
+
+}
+
+void CNavigateIntrsctn::SetOutputHasStopSignTarget( bool value )
+{
+
+    m_outputHasStopSignTarget.SetValue( value );
+
+}
+
+void CNavigateIntrsctn::SetOutputHasStopSignTargetNoValue()
+{
+
+    m_outputHasStopSignTarget.SetNoValue();
+
+}
+
+int CNavigateIntrsctn::GetOutputStoppedAtStopSignFrame()
+{
+
+    return m_outputStoppedAtStopSignFrame.GetValue();
+
+}
+
+bool CNavigateIntrsctn::HasValueOutputStoppedAtStopSignFrame()
+{
+
+    return m_outputStoppedAtStopSignFrame.HasValue();
+
+}
+
+void CNavigateIntrsctn::SetOutputStoppedAtStopSignFrame( int value )
+{
+
+    m_outputStoppedAtStopSignFrame.SetValue( value );
+
+}
+
+void CNavigateIntrsctn::SetOutputStoppedAtStopSignFrameNoValue()
+{
+
+    m_outputStoppedAtStopSignFrame.SetNoValue();
+
+}
+
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+COwnVehicleMirror::COwnVehicleMirror(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new COwnVehicleMirrorParseBlock( snoBlock ),
+            "OwnVehicleMirror",
+            true,
+            30
+            )
+
+{
+
+
+}
+
+COwnVehicleMirror::COwnVehicleMirror( const COwnVehicleMirror& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+COwnVehicleMirror& COwnVehicleMirror::operator=(
+            const COwnVehicleMirror& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+COwnVehicleMirror::~COwnVehicleMirror()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void COwnVehicleMirror::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void COwnVehicleMirror::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void COwnVehicleMirror::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const COwnVehicleMirrorParseBlock* pSnoBlock = dynamic_cast<const COwnVehicleMirrorParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void COwnVehicleMirror::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const COwnVehicleMirrorParseBlock* pSnoBlock = dynamic_cast<const COwnVehicleMirrorParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void COwnVehicleMirror::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const COwnVehicleMirrorParseBlock* pSnoBlock = dynamic_cast<const COwnVehicleMirrorParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void COwnVehicleMirror::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const COwnVehicleMirrorParseBlock* pSnoBlock = dynamic_cast<const COwnVehicleMirrorParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
@@ -0,0 +1,620 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CRemoteControl::CRemoteControl(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CAdoParseBlock( snoBlock ),
+            "RemoteControl",
+            false,
+            13
+            )
+,
+    m_inputpI( "pI" ),
+    m_outputTargPos( "TargPos" ),
+    m_outputTargSteer( "TargSteer" ),
+    m_outputTargAccel( "TargAccel" ),
+    m_outputImTargCrdrs( "ImTargCrdrs" ),
+    m_outputHasStopSignTarget( "HasStopSignTarget" ),
+    m_outputStoppedAtStopSignFrame( "StoppedAtStopSignFrame" ),
+    m_outputMaxSteer( "MaxSteer" )
+{
+
+    // add my children
+    AddChild( new CFreeDrive( pRootCollection, snoBlock ) );
+    AddChild( new CFollow( pRootCollection, snoBlock ) );
+    AddChild( new CLaneChange( pRootCollection, snoBlock ) );
+    AddChild( new CNavigateIntrsctn( pRootCollection, snoBlock ) );
+    AddChild( new CMerge( pRootCollection ) );
+
+
+}
+
+CRemoteControl::CRemoteControl( const CRemoteControl& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_inputpI( objToCopy.m_inputpI.GetName() ),
+    m_outputTargPos( objToCopy.m_outputTargPos.GetName() ),
+    m_outputTargSteer( objToCopy.m_outputTargSteer.GetName() ),
+    m_outputTargAccel( objToCopy.m_outputTargAccel.GetName() ),
+    m_outputImTargCrdrs( objToCopy.m_outputImTargCrdrs.GetName() ),
+    m_outputHasStopSignTarget( objToCopy.m_outputHasStopSignTarget.GetName() ),
+    m_outputStoppedAtStopSignFrame( objToCopy.m_outputStoppedAtStopSignFrame.GetName() ),
+    m_outputMaxSteer( objToCopy.m_outputMaxSteer.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CRemoteControl& CRemoteControl::operator=(
+            const CRemoteControl& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CRemoteControl::~CRemoteControl()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CRemoteControl::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_inputpI.SaveState( ckpt );
+    m_outputTargPos.SaveState( ckpt );
+    m_outputTargSteer.SaveState( ckpt );
+    m_outputTargAccel.SaveState( ckpt );
+    m_outputImTargCrdrs.SaveState( ckpt );
+    m_outputHasStopSignTarget.SaveState( ckpt );
+    m_outputStoppedAtStopSignFrame.SaveState( ckpt );
+    m_outputMaxSteer.SaveState( ckpt );
+    SaveUserState( ckpt );
+
+}
+
+void CRemoteControl::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_inputpI.RestoreState( ckpt );
+    m_outputTargPos.RestoreState( ckpt );
+    m_outputTargSteer.RestoreState( ckpt );
+    m_outputTargAccel.RestoreState( ckpt );
+    m_outputImTargCrdrs.RestoreState( ckpt );
+    m_outputHasStopSignTarget.RestoreState( ckpt );
+    m_outputStoppedAtStopSignFrame.RestoreState( ckpt );
+    m_outputMaxSteer.RestoreState( ckpt );
+    RestoreUserState( ckpt );
+
+}
+
+void CRemoteControl::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	RemoteControlPreActivity();
+
+}
+
+void CRemoteControl::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CAdoParseBlock* pSnoBlock = dynamic_cast<const CAdoParseBlock*>(pBaseSnoBlock);
+	RemoteControlPostActivity();
+
+}
+
+bool CRemoteControl::ExecutePredicate( int functionId )
+{
+
+    if ( functionId == 2 ) {
+        
+        return AdoRemoteAutoPredicate();
+        
+    }
+    else {
+        
+        // unknown function id
+        return false;
+        
+    }
+
+}
+
+bool CRemoteControl::AdoRemoteAutoPredicate()
+{
+
+	return RemoteAutoPredicate();
+
+}
+
+CAdoInfoPtr CRemoteControl::GetInputpI()
+{
+
+    return m_inputpI.GetValue();
+
+}
+
+bool CRemoteControl::HasValueInputpI()
+{
+
+    return m_inputpI.HasValue();
+
+}
+
+void CRemoteControl::SetInputpI( CAdoInfoPtr value )
+{
+
+    m_inputpI.SetValue( value );
+
+}
+
+void CRemoteControl::SetInputpIForFreeDrive( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CFreeDrive*>(m_children[0]) )->SetInputpI( value );
+
+}
+
+void CRemoteControl::SetInputpIForFollow( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CFollow*>(m_children[1]) )->SetInputpI( value );
+
+}
+
+void CRemoteControl::SetInputpIForLaneChange( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CLaneChange*>(m_children[2]) )->SetInputpI( value );
+
+}
+
+void CRemoteControl::SetInputFreeDriveTargVelForLaneChange( double value )
+{
+
+    ( dynamic_cast<CLaneChange*>(m_children[2]) )->SetInputFreeDriveTargVel( value );
+
+}
+
+void CRemoteControl::SetInputpIForNavigateIntrsctn( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->SetInputpI( value );
+
+}
+
+void CRemoteControl::SetInputpIForMerge( CAdoInfoPtr value )
+{
+
+    ( dynamic_cast<CMerge*>(m_children[4]) )->SetInputpI( value );
+
+}
+
+CPoint3D CRemoteControl::GetOutputTargPos()
+{
+
+    return m_outputTargPos.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputTargPos()
+{
+
+    return m_outputTargPos.HasValue();
+
+}
+
+void CRemoteControl::SetOutputTargPos( CPoint3D value )
+{
+
+    m_outputTargPos.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputTargPosNoValue()
+{
+
+    m_outputTargPos.SetNoValue();
+
+}
+
+double CRemoteControl::GetOutputTargSteer()
+{
+
+    return m_outputTargSteer.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputTargSteer()
+{
+
+    return m_outputTargSteer.HasValue();
+
+}
+
+void CRemoteControl::SetOutputTargSteer( double value )
+{
+
+    m_outputTargSteer.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputTargSteerNoValue()
+{
+
+    m_outputTargSteer.SetNoValue();
+
+}
+
+double CRemoteControl::GetOutputTargAccel()
+{
+
+    return m_outputTargAccel.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccel()
+{
+
+    return m_outputTargAccel.HasValue();
+
+}
+
+void CRemoteControl::SetOutputTargAccel( double value )
+{
+
+    m_outputTargAccel.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputTargAccelNoValue()
+{
+
+    m_outputTargAccel.SetNoValue();
+
+}
+
+string CRemoteControl::GetOutputImTargCrdrs()
+{
+
+    return m_outputImTargCrdrs.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputImTargCrdrs()
+{
+
+    return m_outputImTargCrdrs.HasValue();
+
+}
+
+void CRemoteControl::SetOutputImTargCrdrs( string value )
+{
+
+    m_outputImTargCrdrs.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputImTargCrdrsNoValue()
+{
+
+    m_outputImTargCrdrs.SetNoValue();
+
+}
+
+bool CRemoteControl::GetOutputHasStopSignTarget()
+{
+
+    return m_outputHasStopSignTarget.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputHasStopSignTarget()
+{
+
+    return m_outputHasStopSignTarget.HasValue();
+
+}
+
+void CRemoteControl::SetOutputHasStopSignTarget( bool value )
+{
+
+    m_outputHasStopSignTarget.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputHasStopSignTargetNoValue()
+{
+
+    m_outputHasStopSignTarget.SetNoValue();
+
+}
+
+int CRemoteControl::GetOutputStoppedAtStopSignFrame()
+{
+
+    return m_outputStoppedAtStopSignFrame.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputStoppedAtStopSignFrame()
+{
+
+    return m_outputStoppedAtStopSignFrame.HasValue();
+
+}
+
+void CRemoteControl::SetOutputStoppedAtStopSignFrame( int value )
+{
+
+    m_outputStoppedAtStopSignFrame.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputStoppedAtStopSignFrameNoValue()
+{
+
+    m_outputStoppedAtStopSignFrame.SetNoValue();
+
+}
+
+double CRemoteControl::GetOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.GetValue();
+
+}
+
+bool CRemoteControl::HasValueOutputMaxSteer()
+{
+
+    return m_outputMaxSteer.HasValue();
+
+}
+
+void CRemoteControl::SetOutputMaxSteer( double value )
+{
+
+    m_outputMaxSteer.SetValue( value );
+
+}
+
+void CRemoteControl::SetOutputMaxSteerNoValue()
+{
+
+    m_outputMaxSteer.SetNoValue();
+
+}
+
+CPoint3D CRemoteControl::GetOutputTargPosFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->GetOutputTargPos();
+
+}
+
+bool CRemoteControl::HasValueOutputTargPosFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->HasValueOutputTargPos();
+
+}
+
+double CRemoteControl::GetOutputTargVelFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->GetOutputTargVel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargVelFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->HasValueOutputTargVel();
+
+}
+
+double CRemoteControl::GetOutputTargSteerFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->GetOutputTargSteer();
+
+}
+
+bool CRemoteControl::HasValueOutputTargSteerFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->HasValueOutputTargSteer();
+
+}
+
+double CRemoteControl::GetOutputTargAccelFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->GetOutputTargAccel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccelFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->HasValueOutputTargAccel();
+
+}
+
+double CRemoteControl::GetOutputMaxSteerFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->GetOutputMaxSteer();
+
+}
+
+bool CRemoteControl::HasValueOutputMaxSteerFromFreeDrive()
+{
+
+    return ( dynamic_cast<CFreeDrive*>(m_children[0]) )->HasValueOutputMaxSteer();
+
+}
+
+double CRemoteControl::GetOutputTargAccelFromFollow()
+{
+
+    return ( dynamic_cast<CFollow*>(m_children[1]) )->GetOutputTargAccel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccelFromFollow()
+{
+
+    return ( dynamic_cast<CFollow*>(m_children[1]) )->HasValueOutputTargAccel();
+
+}
+
+double CRemoteControl::GetOutputTargAccelFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->GetOutputTargAccel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccelFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->HasValueOutputTargAccel();
+
+}
+
+CPoint3D CRemoteControl::GetOutputTargPosFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->GetOutputTargPos();
+
+}
+
+bool CRemoteControl::HasValueOutputTargPosFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->HasValueOutputTargPos();
+
+}
+
+double CRemoteControl::GetOutputMaxSteerFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->GetOutputMaxSteer();
+
+}
+
+bool CRemoteControl::HasValueOutputMaxSteerFromLaneChange()
+{
+
+    return ( dynamic_cast<CLaneChange*>(m_children[2]) )->HasValueOutputMaxSteer();
+
+}
+
+double CRemoteControl::GetOutputTargAccelFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->GetOutputTargAccel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccelFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->HasValueOutputTargAccel();
+
+}
+
+string CRemoteControl::GetOutputImTargCrdrsFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->GetOutputImTargCrdrs();
+
+}
+
+bool CRemoteControl::HasValueOutputImTargCrdrsFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->HasValueOutputImTargCrdrs();
+
+}
+
+bool CRemoteControl::GetOutputHasStopSignTargetFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->GetOutputHasStopSignTarget();
+
+}
+
+bool CRemoteControl::HasValueOutputHasStopSignTargetFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->HasValueOutputHasStopSignTarget();
+
+}
+
+int CRemoteControl::GetOutputStoppedAtStopSignFrameFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->GetOutputStoppedAtStopSignFrame();
+
+}
+
+bool CRemoteControl::HasValueOutputStoppedAtStopSignFrameFromNavigateIntrsctn()
+{
+
+    return ( dynamic_cast<CNavigateIntrsctn*>(m_children[3]) )->HasValueOutputStoppedAtStopSignFrame();
+
+}
+
+double CRemoteControl::GetOutputTargAccelFromMerge()
+{
+
+    return ( dynamic_cast<CMerge*>(m_children[4]) )->GetOutputTargAccel();
+
+}
+
+bool CRemoteControl::HasValueOutputTargAccelFromMerge()
+{
+
+    return ( dynamic_cast<CMerge*>(m_children[4]) )->HasValueOutputTargAccel();
+
+}
+
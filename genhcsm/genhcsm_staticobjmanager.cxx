@@ -0,0 +1,418 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CStaticObjManager::CStaticObjManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CSobjMngrParseBlock( snoBlock ),
+            "StaticObjManager",
+            true,
+            31
+            )
+,
+    m_dialSetOption1( pRootCollection, "SetOption1" ),
+    m_dialSetOption2( pRootCollection, "SetOption2" ),
+    m_dialAudioState( pRootCollection, "AudioState" ),
+    m_dialVisualState( pRootCollection, "VisualState" ),
+    m_dialAnimationState( pRootCollection, "AnimationState" )
+{
+
+
+}
+
+CStaticObjManager::CStaticObjManager( const CStaticObjManager& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_dialSetOption1( objToCopy.m_pRootCollection, objToCopy.m_dialSetOption1.GetName() ),
+    m_dialSetOption2( objToCopy.m_pRootCollection, objToCopy.m_dialSetOption2.GetName() ),
+    m_dialAudioState( objToCopy.m_pRootCollection, objToCopy.m_dialAudioState.GetName() ),
+    m_dialVisualState( objToCopy.m_pRootCollection, objToCopy.m_dialVisualState.GetName() ),
+    m_dialAnimationState( objToCopy.m_pRootCollection, objToCopy.m_dialAnimationState.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CStaticObjManager& CStaticObjManager::operator=(
+            const CStaticObjManager& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CStaticObjManager::~CStaticObjManager()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CStaticObjManager::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_dialSetOption1.SaveState( ckpt );
+    m_dialSetOption2.SaveState( ckpt );
+    m_dialAudioState.SaveState( ckpt );
+    m_dialVisualState.SaveState( ckpt );
+    m_dialAnimationState.SaveState( ckpt );
+    // m_handles is of type CStaticObjHandles and is not checkpointed
+    // m_options is of type vector<TStaticObjOptions> and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CStaticObjManager::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_dialSetOption1.RestoreState( ckpt );
+    m_dialSetOption2.RestoreState( ckpt );
+    m_dialAudioState.RestoreState( ckpt );
+    m_dialVisualState.RestoreState( ckpt );
+    m_dialAnimationState.RestoreState( ckpt );
+    // m_handles is of type CStaticObjHandles and is not checkpointed
+    // m_options is of type vector<TStaticObjOptions> and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CStaticObjManager::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CSobjMngrParseBlock* pSnoBlock = dynamic_cast<const CSobjMngrParseBlock*>(pBaseSnoBlock);
+	Creation( pSnoBlock );
+
+}
+
+void CStaticObjManager::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CSobjMngrParseBlock* pSnoBlock = dynamic_cast<const CSobjMngrParseBlock*>(pBaseSnoBlock);
+	Deletion( pSnoBlock );
+
+}
+
+void CStaticObjManager::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CSobjMngrParseBlock* pSnoBlock = dynamic_cast<const CSobjMngrParseBlock*>(pBaseSnoBlock);
+	PostActivity( pSnoBlock );
+
+}
+
+const string& CStaticObjManager::GetDialSetOption1()
+{
+
+    return m_dialSetOption1.GetValue();
+
+}
+
+void CStaticObjManager::SetDialSetOption1( const string& value )
+{
+
+    m_dialSetOption1.SetValue( value );
+
+}
+
+void CStaticObjManager::SetDialSetOption1NoValue()
+{
+
+    m_dialSetOption1.SetNoValue();
+
+}
+
+const string& CStaticObjManager::GetDialSetOption2()
+{
+
+    return m_dialSetOption2.GetValue();
+
+}
+
+void CStaticObjManager::SetDialSetOption2( const string& value )
+{
+
+    m_dialSetOption2.SetValue( value );
+
+}
+
+void CStaticObjManager::SetDialSetOption2NoValue()
+{
+
+    m_dialSetOption2.SetNoValue();
+
+}
+
+const string& CStaticObjManager::GetDialAudioState()
+{
+
+    return m_dialAudioState.GetValue();
+
+}
+
+void CStaticObjManager::SetDialAudioState( const string& value )
+{
+
+    m_dialAudioState.SetValue( value );
+
+}
+
+void CStaticObjManager::SetDialAudioStateNoValue()
+{
+
+    m_dialAudioState.SetNoValue();
+
+}
+
+const string& CStaticObjManager::GetDialVisualState()
+{
+
+    return m_dialVisualState.GetValue();
+
+}
+
+void CStaticObjManager::SetDialVisualState( const string& value )
+{
+
+    m_dialVisualState.SetValue( value );
+
+}
+
+void CStaticObjManager::SetDialVisualStateNoValue()
+{
+
+    m_dialVisualState.SetNoValue();
+
+}
+
+const string& CStaticObjManager::GetDialAnimationState()
+{
+
+    return m_dialAnimationState.GetValue();
+
+}
+
+void CStaticObjManager::SetDialAnimationState( const string& value )
+{
+
+    m_dialAnimationState.SetValue( value );
+
+}
+
+void CStaticObjManager::SetDialAnimationStateNoValue()
+{
+
+    m_dialAnimationState.SetNoValue();
+
+}
+
+bool CStaticObjManager::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CStaticObjManager::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CStaticObjManager::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialSetOption1.GetName() ) {
+        
+        m_dialSetOption1.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetOption2.GetName() ) {
+        
+        m_dialSetOption2.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAnimationState.GetName() ) {
+        
+        m_dialAnimationState.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CStaticObjManager::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CStaticObjManager::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CStaticObjManager::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialSetOption1.GetName() ) {
+        
+        m_dialSetOption1.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetOption2.GetName() ) {
+        
+        m_dialSetOption2.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAnimationState.GetName() ) {
+        
+        m_dialAnimationState.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CStaticObjManager::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialSetOption1.GetName() ) {
+        
+        return m_dialSetOption1.HasValue();
+        
+    }
+    if ( dialName == m_dialSetOption2.GetName() ) {
+        
+        return m_dialSetOption2.HasValue();
+        
+    }
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        return m_dialAudioState.HasValue();
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        return m_dialVisualState.HasValue();
+        
+    }
+    if ( dialName == m_dialAnimationState.GetName() ) {
+        
+        return m_dialAnimationState.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CStaticObjManager::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialSetOption1.GetName() ) {
+        
+        m_dialSetOption1.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSetOption2.GetName() ) {
+        
+        m_dialSetOption2.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialAudioState.GetName() ) {
+        
+        m_dialAudioState.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialVisualState.GetName() ) {
+        
+        m_dialVisualState.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialAnimationState.GetName() ) {
+        
+        m_dialAnimationState.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
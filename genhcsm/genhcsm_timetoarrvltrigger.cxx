@@ -0,0 +1,191 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CTimeToArrvlTrigger::CTimeToArrvlTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTriggerParseBlock( snoBlock ),
+            "TimeToArrvlTrigger",
+            true,
+            9
+            )
+,
+    m_buttonFireTrigger( pRootCollection, "FireTrigger" )
+{
+
+
+}
+
+CTimeToArrvlTrigger::CTimeToArrvlTrigger( const CTimeToArrvlTrigger& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonFireTrigger( objToCopy.m_pRootCollection, objToCopy.m_buttonFireTrigger.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CTimeToArrvlTrigger& CTimeToArrvlTrigger::operator=(
+            const CTimeToArrvlTrigger& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CTimeToArrvlTrigger::~CTimeToArrvlTrigger()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CTimeToArrvlTrigger::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonFireTrigger.SaveState( ckpt );
+    m_initCondition.SaveState( ckpt );
+    m_fireCondition.SaveState( ckpt );
+    ckpt.Put( m_prevPosition );
+    ckpt.Put( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Put( m_sequentialActions );
+    ckpt.Put( m_delayFrameCount );
+    ckpt.Put( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    ckpt.Put( m_path );
+    ckpt.Put( m_firePosition );
+    ckpt.Put( m_time );
+    ckpt.Put( m_secondOrder );
+    ckpt.Put( m_boundSpeed );
+    // m_expEval is of type CExpEvalTTA and is not checkpointed
+    ckpt.Put( m_expression );
+    // m_currCandidate is of type CCandidate and is not checkpointed
+    ckpt.Put( m_activationTime );
+    ckpt.Put( m_currTimeToArrival );
+    ckpt.Put( m_logTTA );
+    ckpt.Put( m_logTTANum );
+    SaveUserState( ckpt );
+
+}
+
+void CTimeToArrvlTrigger::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonFireTrigger.RestoreState( ckpt );
+    m_initCondition.RestoreState( ckpt, *cved );
+    m_fireCondition.RestoreState( ckpt, *cved );
+    ckpt.Get( m_prevPosition );
+    ckpt.Get( m_prevState );
+    // m_pTrigger is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    // m_pActionVector is of type CAction::TActionVec and is not checkpointed
+    // m_pCurrentAction is of type CAction::TActionIterator and is not checkpointed
+    ckpt.Get( m_sequentialActions );
+    ckpt.Get( m_delayFrameCount );
+    ckpt.Get( m_waitingForAction );
+    // m_candidateSet is of type CCandidateSet and is not checkpointed
+    // m_instigatorSet is of type set<CCandidate> and is not checkpointed
+    ckpt.Get( m_path, *cved );
+    ckpt.Get( m_firePosition );
+    ckpt.Get( m_time );
+    ckpt.Get( m_secondOrder );
+    ckpt.Get( m_boundSpeed );
+    // m_expEval is of type CExpEvalTTA and is not checkpointed
+    ckpt.Get( m_expression );
+    // m_currCandidate is of type CCandidate and is not checkpointed
+    ckpt.Get( m_activationTime );
+    ckpt.Get( m_currTimeToArrival );
+    ckpt.Get( m_logTTA );
+    ckpt.Get( m_logTTANum );
+    RestoreUserState( ckpt );
+
+}
+
+void CTimeToArrvlTrigger::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CTimeToArrvlTrigger::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CTimeToArrvlTrigger::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CTimeToArrvlTrigger::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTriggerParseBlock* pSnoBlock = dynamic_cast<const CTriggerParseBlock*>(pBaseSnoBlock);
+	;
+
+}
+
+bool CTimeToArrvlTrigger::GetButtonFireTrigger()
+{
+
+    return m_buttonFireTrigger.IsButtonPressed();
+
+}
+
+bool CTimeToArrvlTrigger::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonFireTrigger.GetName() ) {
+        
+        m_buttonFireTrigger.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
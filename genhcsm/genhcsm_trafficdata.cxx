@@ -0,0 +1,128 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CTrafficData::CTrafficData(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTrafficDataParseBlock( snoBlock ),
+            "TrafficData",
+            true,
+            37
+            )
+
+{
+
+
+}
+
+CTrafficData::CTrafficData( const CTrafficData& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CTrafficData& CTrafficData::operator=(
+            const CTrafficData& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CTrafficData::~CTrafficData()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CTrafficData::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    ckpt.Put( m_logAllObjs );
+    ckpt.Put( m_logObjName );
+    ckpt.Put( m_logAccel );
+    ckpt.Put( m_accelMin );
+    ckpt.Put( m_accelMax );
+    SaveUserState( ckpt );
+
+}
+
+void CTrafficData::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    ckpt.Get( m_logAllObjs );
+    ckpt.Get( m_logObjName );
+    ckpt.Get( m_logAccel );
+    ckpt.Get( m_accelMin );
+    ckpt.Get( m_accelMax );
+    RestoreUserState( ckpt );
+
+}
+
+void CTrafficData::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafficDataParseBlock* pSnoBlock = dynamic_cast<const CTrafficDataParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CTrafficData::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafficDataParseBlock* pSnoBlock = dynamic_cast<const CTrafficDataParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CTrafficData::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafficDataParseBlock* pSnoBlock = dynamic_cast<const CTrafficDataParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CTrafficData::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafficDataParseBlock* pSnoBlock = dynamic_cast<const CTrafficDataParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
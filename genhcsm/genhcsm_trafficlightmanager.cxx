@@ -0,0 +1,240 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CTrafficLightManager::CTrafficLightManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTrafLghtMngrParseBlock( snoBlock ),
+            "TrafficLightManager",
+            true,
+            32
+            )
+,
+    m_dialTrafficLight( pRootCollection, "TrafficLight" )
+{
+
+
+}
+
+CTrafficLightManager::CTrafficLightManager( const CTrafficLightManager& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_dialTrafficLight( objToCopy.m_pRootCollection, objToCopy.m_dialTrafficLight.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CTrafficLightManager& CTrafficLightManager::operator=(
+            const CTrafficLightManager& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CTrafficLightManager::~CTrafficLightManager()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CTrafficLightManager::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_dialTrafficLight.SaveState( ckpt );
+    // m_clgs is of type vector<CClg> and is not checkpointed
+    // m_clgWheel is of type CTimingWheel and is not checkpointed
+    ckpt.Put( m_dueClgs );
+    ckpt.Put( m_dialLightName );
+    ckpt.Put( m_dialLightState );
+    SaveUserState( ckpt );
+
+}
+
+void CTrafficLightManager::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_dialTrafficLight.RestoreState( ckpt );
+    // m_clgs is of type vector<CClg> and is not checkpointed
+    // m_clgWheel is of type CTimingWheel and is not checkpointed
+    ckpt.Get( m_dueClgs );
+    ckpt.Get( m_dialLightName );
+    ckpt.Get( m_dialLightState );
+    RestoreUserState( ckpt );
+
+}
+
+void CTrafficLightManager::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafLghtMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafLghtMngrParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CTrafficLightManager::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafLghtMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafLghtMngrParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CTrafficLightManager::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafLghtMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafLghtMngrParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CTrafficLightManager::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafLghtMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafLghtMngrParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
+const string& CTrafficLightManager::GetDialTrafficLight()
+{
+
+    return m_dialTrafficLight.GetValue();
+
+}
+
+void CTrafficLightManager::SetDialTrafficLight( const string& value )
+{
+
+    m_dialTrafficLight.SetValue( value );
+
+}
+
+void CTrafficLightManager::SetDialTrafficLightNoValue()
+{
+
+    m_dialTrafficLight.SetNoValue();
+
+}
+
+bool CTrafficLightManager::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialTrafficLight.GetName() ) {
+        
+        m_dialTrafficLight.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialTrafficLight.GetName() ) {
+        
+        m_dialTrafficLight.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialTrafficLight.GetName() ) {
+        
+        return m_dialTrafficLight.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficLightManager::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialTrafficLight.GetName() ) {
+        
+        m_dialTrafficLight.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
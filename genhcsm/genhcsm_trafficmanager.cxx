@@ -0,0 +1,273 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CTrafficManager::CTrafficManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTrafMngrParseBlock( snoBlock ),
+            "TrafficManager",
+            true,
+            33
+            )
+,
+    m_buttonMakeTraffic( pRootCollection, "MakeTraffic" ),
+    m_dialInputSet( pRootCollection, "InputSet" )
+{
+
+
+}
+
+CTrafficManager::CTrafficManager( const CTrafficManager& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonMakeTraffic( objToCopy.m_pRootCollection, objToCopy.m_buttonMakeTraffic.GetName() ),
+    m_dialInputSet( objToCopy.m_pRootCollection, objToCopy.m_dialInputSet.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CTrafficManager& CTrafficManager::operator=(
+            const CTrafficManager& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CTrafficManager::~CTrafficManager()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CTrafficManager::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonMakeTraffic.SaveState( ckpt );
+    m_dialInputSet.SaveState( ckpt );
+    // m_inputSets is of type vector<CTrafMngrParseBlock::TInputSet> and is not checkpointed
+    // m_cInputSetItr is of type vector<CTrafMngrParseBlock::TInputSet>::const_iterator and is not checkpointed
+    ckpt.Put( m_distAtAppending );
+    ckpt.Put( m_timeAtObjCreation );
+    ckpt.Put( m_roadPos );
+    // m_pPath is of type CPath* and is not checkpointed
+    ckpt.Put( m_rndStreamId );
+    ckpt.Put( m_objsByTM );
+    ckpt.Put( m_creationCounter );
+    SaveUserState( ckpt );
+
+}
+
+void CTrafficManager::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonMakeTraffic.RestoreState( ckpt );
+    m_dialInputSet.RestoreState( ckpt );
+    // m_inputSets is of type vector<CTrafMngrParseBlock::TInputSet> and is not checkpointed
+    // m_cInputSetItr is of type vector<CTrafMngrParseBlock::TInputSet>::const_iterator and is not checkpointed
+    ckpt.Get( m_distAtAppending );
+    ckpt.Get( m_timeAtObjCreation );
+    ckpt.Get( m_roadPos, *cved );
+    // m_pPath is of type CPath* and is not checkpointed
+    ckpt.Get( m_rndStreamId );
+    ckpt.Get( m_objsByTM );
+    ckpt.Get( m_creationCounter );
+    RestoreUserState( ckpt );
+
+}
+
+void CTrafficManager::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafMngrParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CTrafficManager::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafMngrParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CTrafficManager::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafMngrParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CTrafficManager::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafMngrParseBlock* pSnoBlock = dynamic_cast<const CTrafMngrParseBlock*>(pBaseSnoBlock);
+	pSnoBlock;
+
+}
+
+bool CTrafficManager::GetButtonMakeTraffic()
+{
+
+    return m_buttonMakeTraffic.IsButtonPressed();
+
+}
+
+bool CTrafficManager::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonMakeTraffic.GetName() ) {
+        
+        m_buttonMakeTraffic.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const string& CTrafficManager::GetDialInputSet()
+{
+
+    return m_dialInputSet.GetValue();
+
+}
+
+void CTrafficManager::SetDialInputSet( const string& value )
+{
+
+    m_dialInputSet.SetValue( value );
+
+}
+
+void CTrafficManager::SetDialInputSetNoValue()
+{
+
+    m_dialInputSet.SetNoValue();
+
+}
+
+bool CTrafficManager::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficManager::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficManager::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialInputSet.GetName() ) {
+        
+        m_dialInputSet.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficManager::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficManager::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficManager::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialInputSet.GetName() ) {
+        
+        m_dialInputSet.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficManager::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialInputSet.GetName() ) {
+        
+        return m_dialInputSet.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficManager::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialInputSet.GetName() ) {
+        
+        m_dialInputSet.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
@@ -0,0 +1,289 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CTrafficSource::CTrafficSource(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CTrafSrcParseBlock( snoBlock ),
+            "TrafficSource",
+            true,
+            34
+            )
+,
+    m_buttonMakeTraffic( pRootCollection, "MakeTraffic" ),
+    m_dialStartStop( pRootCollection, "StartStop" )
+{
+
+
+}
+
+CTrafficSource::CTrafficSource( const CTrafficSource& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonMakeTraffic( objToCopy.m_pRootCollection, objToCopy.m_buttonMakeTraffic.GetName() ),
+    m_dialStartStop( objToCopy.m_pRootCollection, objToCopy.m_dialStartStop.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CTrafficSource& CTrafficSource::operator=(
+            const CTrafficSource& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CTrafficSource::~CTrafficSource()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CTrafficSource::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonMakeTraffic.SaveState( ckpt );
+    m_dialStartStop.SaveState( ckpt );
+    m_initCondition.SaveState( ckpt );
+    ckpt.Put( m_startFrame );
+    ckpt.Put( m_curTimeIdx );
+    ckpt.Put( m_randTime );
+    // m_traffic is of type vector<CSnoBlock> and is not checkpointed
+    ckpt.Put( m_trafficIds );
+    ckpt.Put( m_times );
+    ckpt.Put( m_periodicSequence );
+    ckpt.Put( m_workingSequence );
+    ckpt.Put( m_randomSequence );
+    ckpt.Put( m_isRandomUniform );
+    ckpt.Put( m_curSequenceIdx );
+    ckpt.Put( m_curSequenceCount );
+    ckpt.Put( m_rng );
+    ckpt.Put( m_rngTime );
+    ckpt.Put( m_rngTraffic );
+    // m_pTraffSource is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CTrafficSource::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonMakeTraffic.RestoreState( ckpt );
+    m_dialStartStop.RestoreState( ckpt );
+    m_initCondition.RestoreState( ckpt, *cved );
+    ckpt.Get( m_startFrame );
+    ckpt.Get( m_curTimeIdx );
+    ckpt.Get( m_randTime );
+    // m_traffic is of type vector<CSnoBlock> and is not checkpointed
+    ckpt.Get( m_trafficIds );
+    ckpt.Get( m_times );
+    ckpt.Get( m_periodicSequence );
+    ckpt.Get( m_workingSequence );
+    ckpt.Get( m_randomSequence );
+    ckpt.Get( m_isRandomUniform );
+    ckpt.Get( m_curSequenceIdx );
+    ckpt.Get( m_curSequenceCount );
+    ckpt.Get( m_rng );
+    ckpt.Get( m_rngTime );
+    ckpt.Get( m_rngTraffic );
+    // m_pTraffSource is of type CVED::CCoordinatorObjectObj* and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CTrafficSource::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafSrcParseBlock* pSnoBlock = dynamic_cast<const CTrafSrcParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CTrafficSource::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafSrcParseBlock* pSnoBlock = dynamic_cast<const CTrafSrcParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CTrafficSource::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafSrcParseBlock* pSnoBlock = dynamic_cast<const CTrafSrcParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CTrafficSource::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CTrafSrcParseBlock* pSnoBlock = dynamic_cast<const CTrafSrcParseBlock*>(pBaseSnoBlock);
+;
+
+}
+
+bool CTrafficSource::GetButtonMakeTraffic()
+{
+
+    return m_buttonMakeTraffic.IsButtonPressed();
+
+}
+
+bool CTrafficSource::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonMakeTraffic.GetName() ) {
+        
+        m_buttonMakeTraffic.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficSource::GetDialStartStop()
+{
+
+    return m_dialStartStop.GetValue();
+
+}
+
+void CTrafficSource::SetDialStartStop( bool value )
+{
+
+    m_dialStartStop.SetValue( value );
+
+}
+
+void CTrafficSource::SetDialStartStopNoValue()
+{
+
+    m_dialStartStop.SetNoValue();
+
+}
+
+bool CTrafficSource::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficSource::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficSource::SetDialByName( const string& dialName, const string& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficSource::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CTrafficSource::SetDialByName( const string& dialName, const bool& value )
+{
+
+    if ( dialName == m_dialStartStop.GetName() ) {
+        
+        m_dialStartStop.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficSource::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialStartStop.GetName() ) {
+        
+        m_dialStartStop.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficSource::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialStartStop.GetName() ) {
+        
+        return m_dialStartStop.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CTrafficSource::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialStartStop.GetName() ) {
+        
+        m_dialStartStop.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
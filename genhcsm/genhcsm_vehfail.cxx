@@ -0,0 +1,236 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CVehFail::CVehFail(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CVehFailParseBlock( snoBlock ),
+            "VehFail",
+            true,
+            35
+            )
+,
+    m_dialFailure( pRootCollection, "Failure" )
+{
+
+
+}
+
+CVehFail::CVehFail( const CVehFail& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_dialFailure( objToCopy.m_pRootCollection, objToCopy.m_dialFailure.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CVehFail& CVehFail::operator=(
+            const CVehFail& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CVehFail::~CVehFail()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CVehFail::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_dialFailure.SaveState( ckpt );
+    ckpt.Put( m_Socket );
+    ckpt.Put( m_CmdSock );
+    // m_Failures is of type TFailureQueue and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CVehFail::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_dialFailure.RestoreState( ckpt );
+    ckpt.Get( m_Socket );
+    ckpt.Get( m_CmdSock );
+    // m_Failures is of type TFailureQueue and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CVehFail::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVehFailParseBlock* pSnoBlock = dynamic_cast<const CVehFailParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CVehFail::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVehFailParseBlock* pSnoBlock = dynamic_cast<const CVehFailParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CVehFail::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVehFailParseBlock* pSnoBlock = dynamic_cast<const CVehFailParseBlock*>(pBaseSnoBlock);
+	UserPreActivity( pSnoBlock );
+
+}
+
+void CVehFail::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVehFailParseBlock* pSnoBlock = dynamic_cast<const CVehFailParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
+const string& CVehFail::GetDialFailure()
+{
+
+    return m_dialFailure.GetValue();
+
+}
+
+void CVehFail::SetDialFailure( const string& value )
+{
+
+    m_dialFailure.SetValue( value );
+
+}
+
+void CVehFail::SetDialFailureNoValue()
+{
+
+    m_dialFailure.SetNoValue();
+
+}
+
+bool CVehFail::SetDialByName( const string& dialName, const int& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVehFail::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVehFail::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialFailure.GetName() ) {
+        
+        m_dialFailure.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVehFail::SetDialByName( const string& dialName, const float& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVehFail::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVehFail::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialFailure.GetName() ) {
+        
+        m_dialFailure.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVehFail::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialFailure.GetName() ) {
+        
+        return m_dialFailure.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CVehFail::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialFailure.GetName() ) {
+        
+        m_dialFailure.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
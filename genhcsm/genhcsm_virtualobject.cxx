@@ -0,0 +1,611 @@
+/*****************************************************************************
+ *
+ *  (C) Copyright 1998 by National Advanced Driving Simulator and
+ *  Simulation Center, the University of Iowa and The University
+ *  of Iowa. All rights reserved.
+ *
+ *  This file has been generated by the hcsm code generator.
+ *  ### DO NOT EDIT DIRECTLY ###
+ *
+ */
+
+
+#include "genhcsm.h"
+#include "hcsmcheckpoint.h"
+
+CVirtualObject::CVirtualObject(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            ):
+    CHcsmConcurrent(
+            pRootCollection,
+            new CVirtualObjectParseBlock( snoBlock ),
+            "VirtualObject",
+            true,
+            2
+            )
+,
+    m_buttonTurnOnAnimation( pRootCollection, "TurnOnAnimation" ),
+    m_buttonTurnOffAnimation( pRootCollection, "TurnOffAnimation" ),
+    m_dialSetAnimation( pRootCollection, "SetAnimation" ),
+    m_dialSetRotation( pRootCollection, "SetRotation" ),
+    m_dialSetPosition( pRootCollection, "SetPosition" ),
+    m_dialSetStateIndex( pRootCollection, "SetStateIndex" ),
+    m_dialSetDrawType( pRootCollection, "SetDrawType" ),
+    m_dialAttachToObject( pRootCollection, "AttachToObject" ),
+    m_dialAttachToLight( pRootCollection, "AttachToLight" )
+{
+
+
+}
+
+CVirtualObject::CVirtualObject( const CVirtualObject& objToCopy ):
+    CHcsmConcurrent(
+            objToCopy.m_pRootCollection,
+            objToCopy.m_pSnoBlock,
+            objToCopy.m_name,
+            objToCopy.m_root
+            ),
+    m_buttonTurnOnAnimation( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnOnAnimation.GetName() ),
+    m_buttonTurnOffAnimation( objToCopy.m_pRootCollection, objToCopy.m_buttonTurnOffAnimation.GetName() ),
+    m_dialSetAnimation( objToCopy.m_pRootCollection, objToCopy.m_dialSetAnimation.GetName() ),
+    m_dialSetRotation( objToCopy.m_pRootCollection, objToCopy.m_dialSetRotation.GetName() ),
+    m_dialSetPosition( objToCopy.m_pRootCollection, objToCopy.m_dialSetPosition.GetName() ),
+    m_dialSetStateIndex( objToCopy.m_pRootCollection, objToCopy.m_dialSetStateIndex.GetName() ),
+    m_dialSetDrawType( objToCopy.m_pRootCollection, objToCopy.m_dialSetDrawType.GetName() ),
+    m_dialAttachToObject( objToCopy.m_pRootCollection, objToCopy.m_dialAttachToObject.GetName() ),
+    m_dialAttachToLight( objToCopy.m_pRootCollection, objToCopy.m_dialAttachToLight.GetName() )
+{
+
+    // call the assignment operator
+    *this = objToCopy;
+
+}
+
+CVirtualObject& CVirtualObject::operator=(
+            const CVirtualObject& objToCopy
+            )
+{
+
+    // check to see if the object passed in is really me
+    if ( this != &objToCopy ) {
+
+        // make a deep copy
+
+    }
+
+    return *this;
+
+}
+
+CVirtualObject::~CVirtualObject()
+{
+
+    // call the deletion function
+    Deletion( m_pSnoBlock );
+
+}
+
+void CVirtualObject::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::SaveState( ckpt );
+    m_buttonTurnOnAnimation.SaveState( ckpt );
+    m_buttonTurnOffAnimation.SaveState( ckpt );
+    m_dialSetAnimation.SaveState( ckpt );
+    m_dialSetRotation.SaveState( ckpt );
+    m_dialSetPosition.SaveState( ckpt );
+    m_dialSetStateIndex.SaveState( ckpt );
+    m_dialSetDrawType.SaveState( ckpt );
+    m_dialAttachToObject.SaveState( ckpt );
+    m_dialAttachToLight.SaveState( ckpt );
+    m_initCondition.SaveState( ckpt );
+    ckpt.Put( m_lastState );
+    ckpt.Put( m_last3DPos );
+    ckpt.Put( m_referencePoint );
+    ckpt.Put( m_OverLayPosition );
+    ckpt.Put( m_rotation );
+    ckpt.Put( m_size );
+    ckpt.Put( m_drawType );
+    ckpt.Put( m_drawScreen );
+    ckpt.Put( m_stateIndex );
+    ckpt.Put( m_startAnimationFrame );
+    ckpt.Put( m_periodFrames );
+    ckpt.Put( m_flashOnFrames );
+    m_initConditions.SaveState( ckpt );
+    ckpt.Put( m_parentName );
+    ckpt.Put( m_isAnimationOn );
+    ckpt.Put( m_isBlinking );
+    ckpt.Put( m_isMoving );
+    ckpt.Put( m_isRotating );
+    ckpt.Put( m_rotateRate );
+    ckpt.Put( m_degreesPerSec );
+    ckpt.Put( m_targetPos );
+    ckpt.Put( m_unitsPerSecMov );
+    ckpt.Put( m_currRoadPos );
+    // m_pVisualObject is of type CVED::CVisualObjectObj* and is not checkpointed
+    SaveUserState( ckpt );
+
+}
+
+void CVirtualObject::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CHcsmConcurrent::RestoreState( ckpt );
+    m_buttonTurnOnAnimation.RestoreState( ckpt );
+    m_buttonTurnOffAnimation.RestoreState( ckpt );
+    m_dialSetAnimation.RestoreState( ckpt );
+    m_dialSetRotation.RestoreState( ckpt );
+    m_dialSetPosition.RestoreState( ckpt );
+    m_dialSetStateIndex.RestoreState( ckpt );
+    m_dialSetDrawType.RestoreState( ckpt );
+    m_dialAttachToObject.RestoreState( ckpt );
+    m_dialAttachToLight.RestoreState( ckpt );
+    m_initCondition.RestoreState( ckpt, *cved );
+    ckpt.Get( m_lastState );
+    ckpt.Get( m_last3DPos );
+    ckpt.Get( m_referencePoint );
+    ckpt.Get( m_OverLayPosition );
+    ckpt.Get( m_rotation );
+    ckpt.Get( m_size );
+    ckpt.Get( m_drawType );
+    ckpt.Get( m_drawScreen );
+    ckpt.Get( m_stateIndex );
+    ckpt.Get( m_startAnimationFrame );
+    ckpt.Get( m_periodFrames );
+    ckpt.Get( m_flashOnFrames );
+    m_initConditions.RestoreState( ckpt, *cved );
+    ckpt.Get( m_parentName );
+    ckpt.Get( m_isAnimationOn );
+    ckpt.Get( m_isBlinking );
+    ckpt.Get( m_isMoving );
+    ckpt.Get( m_isRotating );
+    ckpt.Get( m_rotateRate );
+    ckpt.Get( m_degreesPerSec );
+    ckpt.Get( m_targetPos );
+    ckpt.Get( m_unitsPerSecMov );
+    ckpt.Get( m_currRoadPos, *cved );
+    // m_pVisualObject is of type CVED::CVisualObjectObj* and is not checkpointed
+    RestoreUserState( ckpt );
+
+}
+
+void CVirtualObject::Creation( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVirtualObjectParseBlock* pSnoBlock = dynamic_cast<const CVirtualObjectParseBlock*>(pBaseSnoBlock);
+	UserCreation( pSnoBlock );
+
+}
+
+void CVirtualObject::Deletion( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVirtualObjectParseBlock* pSnoBlock = dynamic_cast<const CVirtualObjectParseBlock*>(pBaseSnoBlock);
+	UserDeletion( pSnoBlock );
+
+}
+
+void CVirtualObject::PreActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVirtualObjectParseBlock* pSnoBlock = dynamic_cast<const CVirtualObjectParseBlock*>(pBaseSnoBlock);
+	UserActivity( pSnoBlock );
+
+}
+
+void CVirtualObject::PostActivity( const CSnoBlock* pBaseSnoBlock )
+{
+
+    const CVirtualObjectParseBlock* pSnoBlock = dynamic_cast<const CVirtualObjectParseBlock*>(pBaseSnoBlock);
+	UserPostActivity( pSnoBlock );
+
+}
+
+bool CVirtualObject::GetButtonTurnOnAnimation()
+{
+
+    return m_buttonTurnOnAnimation.IsButtonPressed();
+
+}
+
+bool CVirtualObject::GetButtonTurnOffAnimation()
+{
+
+    return m_buttonTurnOffAnimation.IsButtonPressed();
+
+}
+
+bool CVirtualObject::SetButtonByName( const string& buttonName )
+{
+
+    if ( buttonName == m_buttonTurnOnAnimation.GetName() ) {
+        
+        m_buttonTurnOnAnimation.PressButton();
+        return true;
+        
+    }
+    
+    if ( buttonName == m_buttonTurnOffAnimation.GetName() ) {
+        
+        m_buttonTurnOffAnimation.PressButton();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+const string& CVirtualObject::GetDialSetAnimation()
+{
+
+    return m_dialSetAnimation.GetValue();
+
+}
+
+void CVirtualObject::SetDialSetAnimation( const string& value )
+{
+
+    m_dialSetAnimation.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialSetAnimationNoValue()
+{
+
+    m_dialSetAnimation.SetNoValue();
+
+}
+
+float CVirtualObject::GetDialSetRotation()
+{
+
+    return m_dialSetRotation.GetValue();
+
+}
+
+void CVirtualObject::SetDialSetRotation( float value )
+{
+
+    m_dialSetRotation.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialSetRotationNoValue()
+{
+
+    m_dialSetRotation.SetNoValue();
+
+}
+
+const string& CVirtualObject::GetDialSetPosition()
+{
+
+    return m_dialSetPosition.GetValue();
+
+}
+
+void CVirtualObject::SetDialSetPosition( const string& value )
+{
+
+    m_dialSetPosition.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialSetPositionNoValue()
+{
+
+    m_dialSetPosition.SetNoValue();
+
+}
+
+const string& CVirtualObject::GetDialSetStateIndex()
+{
+
+    return m_dialSetStateIndex.GetValue();
+
+}
+
+void CVirtualObject::SetDialSetStateIndex( const string& value )
+{
+
+    m_dialSetStateIndex.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialSetStateIndexNoValue()
+{
+
+    m_dialSetStateIndex.SetNoValue();
+
+}
+
+int CVirtualObject::GetDialSetDrawType()
+{
+
+    return m_dialSetDrawType.GetValue();
+
+}
+
+void CVirtualObject::SetDialSetDrawType( int value )
+{
+
+    m_dialSetDrawType.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialSetDrawTypeNoValue()
+{
+
+    m_dialSetDrawType.SetNoValue();
+
+}
+
+const string& CVirtualObject::GetDialAttachToObject()
+{
+
+    return m_dialAttachToObject.GetValue();
+
+}
+
+void CVirtualObject::SetDialAttachToObject( const string& value )
+{
+
+    m_dialAttachToObject.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialAttachToObjectNoValue()
+{
+
+    m_dialAttachToObject.SetNoValue();
+
+}
+
+int CVirtualObject::GetDialAttachToLight()
+{
+
+    return m_dialAttachToLight.GetValue();
+
+}
+
+void CVirtualObject::SetDialAttachToLight( int value )
+{
+
+    m_dialAttachToLight.SetValue( value );
+
+}
+
+void CVirtualObject::SetDialAttachToLightNoValue()
+{
+
+    m_dialAttachToLight.SetNoValue();
+
+}
+
+bool CVirtualObject::SetDialByName( const string& dialName, const int& value )
+{
+
+    if ( dialName == m_dialSetDrawType.GetName() ) {
+        
+        m_dialSetDrawType.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToLight.GetName() ) {
+        
+        m_dialAttachToLight.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVirtualObject::SetDialByName( const string& dialName, const double& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVirtualObject::SetDialByName( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialSetAnimation.GetName() ) {
+        
+        m_dialSetAnimation.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetPosition.GetName() ) {
+        
+        m_dialSetPosition.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetStateIndex.GetName() ) {
+        
+        m_dialSetStateIndex.SetValue( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToObject.GetName() ) {
+        
+        m_dialAttachToObject.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVirtualObject::SetDialByName( const string& dialName, const float& value )
+{
+
+    if ( dialName == m_dialSetRotation.GetName() ) {
+        
+        m_dialSetRotation.SetValue( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVirtualObject::SetDialByName( const string& dialName, const bool& value )
+{
+
+    
+    return false;
+
+}
+
+bool CVirtualObject::SetDialByNameStr( const string& dialName, const string& value )
+{
+
+    if ( dialName == m_dialSetAnimation.GetName() ) {
+        
+        m_dialSetAnimation.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetRotation.GetName() ) {
+        
+        m_dialSetRotation.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetPosition.GetName() ) {
+        
+        m_dialSetPosition.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetStateIndex.GetName() ) {
+        
+        m_dialSetStateIndex.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialSetDrawType.GetName() ) {
+        
+        m_dialSetDrawType.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToObject.GetName() ) {
+        
+        m_dialAttachToObject.SetValueStr( value );
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToLight.GetName() ) {
+        
+        m_dialAttachToLight.SetValueStr( value );
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
+bool CVirtualObject::IsDialActiveByNameStr( const string& dialName )
+{
+
+    if ( dialName == m_dialSetAnimation.GetName() ) {
+        
+        return m_dialSetAnimation.HasValue();
+        
+    }
+    if ( dialName == m_dialSetRotation.GetName() ) {
+        
+        return m_dialSetRotation.HasValue();
+        
+    }
+    if ( dialName == m_dialSetPosition.GetName() ) {
+        
+        return m_dialSetPosition.HasValue();
+        
+    }
+    if ( dialName == m_dialSetStateIndex.GetName() ) {
+        
+        return m_dialSetStateIndex.HasValue();
+        
+    }
+    if ( dialName == m_dialSetDrawType.GetName() ) {
+        
+        return m_dialSetDrawType.HasValue();
+        
+    }
+    if ( dialName == m_dialAttachToObject.GetName() ) {
+        
+        return m_dialAttachToObject.HasValue();
+        
+    }
+    if ( dialName == m_dialAttachToLight.GetName() ) {
+        
+        return m_dialAttachToLight.HasValue();
+        
+    }
+    
+    return false;
+
+}
+
+bool CVirtualObject::ResetDialByName( const string& dialName )
+{
+
+    if ( dialName == m_dialSetAnimation.GetName() ) {
+        
+        m_dialSetAnimation.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSetRotation.GetName() ) {
+        
+        m_dialSetRotation.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSetPosition.GetName() ) {
+        
+        m_dialSetPosition.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSetStateIndex.GetName() ) {
+        
+        m_dialSetStateIndex.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialSetDrawType.GetName() ) {
+        
+        m_dialSetDrawType.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToObject.GetName() ) {
+        
+        m_dialAttachToObject.Reset();
+        return true;
+        
+    }
+    if ( dialName == m_dialAttachToLight.GetName() ) {
+        
+        m_dialAttachToLight.Reset();
+        return true;
+        
+    }
+    
+    return false;
+
+}
+
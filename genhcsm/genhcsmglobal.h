@@ -30,14 +30,18 @@ using namespace std;
 
 #include "util.h"
 #include "hcsmconnect.h"
+#include "gatewayio.h"
 #include "objectinitcond.h"
 #include "triggerfirecond.h"
 #include "action.h"
 #include "clg.h"
+#include "timingwheel.h"
+#include "staticobjhandles.h"
 #include "candidateset.h"
 #include "adoinfo.h"
 #include "lanechangeconds.h"
 #include "vehdyncommand.h"
+#include "daqtrace.h"
 #include "vehfailclient.h"
 #include "expeval.h"
 #include "expevalAdo.h"
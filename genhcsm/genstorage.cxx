@@ -12,19 +12,20 @@
 
 #include "genstorage.h"
 #include <genericinclude.h>
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////
 // CInputParCAdoInfoPtr
 //////////////////////////////////////////////////////////////
 
-CInputParCAdoInfoPtr::CInputParCAdoInfoPtr( string name ):
+CInputParCAdoInfoPtr::CInputParCAdoInfoPtr( const string& name ):
     CInputParameter( name )
 {
 
 }
 
 CInputParCAdoInfoPtr::CInputParCAdoInfoPtr( const CInputParCAdoInfoPtr& objToCopy ):
-    CInputParameter( objToCopy.m_name )
+    CInputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -78,18 +79,34 @@ void CInputParCAdoInfoPtr::SetValue( CAdoInfoPtr value )
 
 }
 
+void CInputParCAdoInfoPtr::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::SaveState( ckpt );
+    // m_value is of type CAdoInfoPtr and is not checkpointed
+
+}
+
+void CInputParCAdoInfoPtr::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::RestoreState( ckpt );
+    // m_value is of type CAdoInfoPtr and is not checkpointed
+
+}
+
 //////////////////////////////////////////////////////////////
 // CInputPardouble
 //////////////////////////////////////////////////////////////
 
-CInputPardouble::CInputPardouble( string name ):
+CInputPardouble::CInputPardouble( const string& name ):
     CInputParameter( name )
 {
 
 }
 
 CInputPardouble::CInputPardouble( const CInputPardouble& objToCopy ):
-    CInputParameter( objToCopy.m_name )
+    CInputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -143,18 +160,34 @@ void CInputPardouble::SetValue( double value )
 
 }
 
+void CInputPardouble::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void CInputPardouble::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
 //////////////////////////////////////////////////////////////
 // CInputParCLcCondsPtr
 //////////////////////////////////////////////////////////////
 
-CInputParCLcCondsPtr::CInputParCLcCondsPtr( string name ):
+CInputParCLcCondsPtr::CInputParCLcCondsPtr( const string& name ):
     CInputParameter( name )
 {
 
 }
 
 CInputParCLcCondsPtr::CInputParCLcCondsPtr( const CInputParCLcCondsPtr& objToCopy ):
-    CInputParameter( objToCopy.m_name )
+    CInputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -208,18 +241,34 @@ void CInputParCLcCondsPtr::SetValue( CLcCondsPtr value )
 
 }
 
+void CInputParCLcCondsPtr::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::SaveState( ckpt );
+    // m_value is of type CLcCondsPtr and is not checkpointed
+
+}
+
+void CInputParCLcCondsPtr::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    CInputParameter::RestoreState( ckpt );
+    // m_value is of type CLcCondsPtr and is not checkpointed
+
+}
+
 //////////////////////////////////////////////////////////////
 // COutputParCPoint3D
 //////////////////////////////////////////////////////////////
 
-COutputParCPoint3D::COutputParCPoint3D( string name ):
+COutputParCPoint3D::COutputParCPoint3D( const string& name ):
     COutputParameter( name )
 {
 
 }
 
 COutputParCPoint3D::COutputParCPoint3D( const COutputParCPoint3D& objToCopy ):
-    COutputParameter( objToCopy.m_name )
+    COutputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -273,18 +322,34 @@ void COutputParCPoint3D::SetValue( CPoint3D value )
 
 }
 
+void COutputParCPoint3D::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void COutputParCPoint3D::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
 //////////////////////////////////////////////////////////////
 // COutputPardouble
 //////////////////////////////////////////////////////////////
 
-COutputPardouble::COutputPardouble( string name ):
+COutputPardouble::COutputPardouble( const string& name ):
     COutputParameter( name )
 {
 
 }
 
 COutputPardouble::COutputPardouble( const COutputPardouble& objToCopy ):
-    COutputParameter( objToCopy.m_name )
+    COutputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -338,18 +403,34 @@ void COutputPardouble::SetValue( double value )
 
 }
 
+void COutputPardouble::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void COutputPardouble::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
 //////////////////////////////////////////////////////////////
 // COutputParstring
 //////////////////////////////////////////////////////////////
 
-COutputParstring::COutputParstring( string name ):
+COutputParstring::COutputParstring( const string& name ):
     COutputParameter( name )
 {
 
 }
 
 COutputParstring::COutputParstring( const COutputParstring& objToCopy ):
-    COutputParameter( objToCopy.m_name )
+    COutputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -403,18 +484,34 @@ void COutputParstring::SetValue( string value )
 
 }
 
+void COutputParstring::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void COutputParstring::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
 //////////////////////////////////////////////////////////////
 // COutputParbool
 //////////////////////////////////////////////////////////////
 
-COutputParbool::COutputParbool( string name ):
+COutputParbool::COutputParbool( const string& name ):
     COutputParameter( name )
 {
 
 }
 
 COutputParbool::COutputParbool( const COutputParbool& objToCopy ):
-    COutputParameter( objToCopy.m_name )
+    COutputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -468,18 +565,34 @@ void COutputParbool::SetValue( bool value )
 
 }
 
+void COutputParbool::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void COutputParbool::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
 //////////////////////////////////////////////////////////////
 // COutputParint
 //////////////////////////////////////////////////////////////
 
-COutputParint::COutputParint( string name ):
+COutputParint::COutputParint( const string& name ):
     COutputParameter( name )
 {
 
 }
 
 COutputParint::COutputParint( const COutputParint& objToCopy ):
-    COutputParameter( objToCopy.m_name )
+    COutputParameter( objToCopy )
 {
 
     // call the assignment operator
@@ -533,3 +646,19 @@ void COutputParint::SetValue( int value )
 
 }
 
+void COutputParint::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::SaveState( ckpt );
+    ckpt.Put( m_value );
+
+}
+
+void COutputParint::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+    COutputParameter::RestoreState( ckpt );
+    ckpt.Get( m_value );
+
+}
+
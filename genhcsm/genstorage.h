@@ -26,12 +26,14 @@ using namespace std;
 class CInputParCAdoInfoPtr : public CInputParameter
 {
 public:
-    CInputParCAdoInfoPtr( string );
+    CInputParCAdoInfoPtr( const string& );
     CInputParCAdoInfoPtr( const CInputParCAdoInfoPtr& );
     CInputParCAdoInfoPtr& operator=( const CInputParCAdoInfoPtr& );
     virtual ~CInputParCAdoInfoPtr(); 
     CAdoInfoPtr GetValue();
     void SetValue( CAdoInfoPtr );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     CAdoInfoPtr m_value;
@@ -44,12 +46,14 @@ private:
 class CInputPardouble : public CInputParameter
 {
 public:
-    CInputPardouble( string );
+    CInputPardouble( const string& );
     CInputPardouble( const CInputPardouble& );
     CInputPardouble& operator=( const CInputPardouble& );
     virtual ~CInputPardouble(); 
     double GetValue();
     void SetValue( double );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     double m_value;
@@ -62,12 +66,14 @@ private:
 class CInputParCLcCondsPtr : public CInputParameter
 {
 public:
-    CInputParCLcCondsPtr( string );
+    CInputParCLcCondsPtr( const string& );
     CInputParCLcCondsPtr( const CInputParCLcCondsPtr& );
     CInputParCLcCondsPtr& operator=( const CInputParCLcCondsPtr& );
     virtual ~CInputParCLcCondsPtr(); 
     CLcCondsPtr GetValue();
     void SetValue( CLcCondsPtr );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     CLcCondsPtr m_value;
@@ -80,12 +86,14 @@ private:
 class COutputParCPoint3D : public COutputParameter
 {
 public:
-    COutputParCPoint3D( string );
+    COutputParCPoint3D( const string& );
     COutputParCPoint3D( const COutputParCPoint3D& );
     COutputParCPoint3D& operator=( const COutputParCPoint3D& );
     virtual ~COutputParCPoint3D(); 
     CPoint3D GetValue();
     void SetValue( CPoint3D );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     CPoint3D m_value;
@@ -98,12 +106,14 @@ private:
 class COutputPardouble : public COutputParameter
 {
 public:
-    COutputPardouble( string );
+    COutputPardouble( const string& );
     COutputPardouble( const COutputPardouble& );
     COutputPardouble& operator=( const COutputPardouble& );
     virtual ~COutputPardouble(); 
     double GetValue();
     void SetValue( double );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     double m_value;
@@ -116,12 +126,14 @@ private:
 class COutputParstring : public COutputParameter
 {
 public:
-    COutputParstring( string );
+    COutputParstring( const string& );
     COutputParstring( const COutputParstring& );
     COutputParstring& operator=( const COutputParstring& );
     virtual ~COutputParstring(); 
     string GetValue();
     void SetValue( string );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     string m_value;
@@ -134,12 +146,14 @@ private:
 class COutputParbool : public COutputParameter
 {
 public:
-    COutputParbool( string );
+    COutputParbool( const string& );
     COutputParbool( const COutputParbool& );
     COutputParbool& operator=( const COutputParbool& );
     virtual ~COutputParbool(); 
     bool GetValue();
     void SetValue( bool );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     bool m_value;
@@ -152,12 +166,14 @@ private:
 class COutputParint : public COutputParameter
 {
 public:
-    COutputParint( string );
+    COutputParint( const string& );
     COutputParint( const COutputParint& );
     COutputParint& operator=( const COutputParint& );
     virtual ~COutputParint(); 
     int GetValue();
     void SetValue( int );
+    virtual void SaveState( CHcsmCheckpoint& );
+    virtual void RestoreState( CHcsmCheckpoint& );
 
 private:
     int m_value;
@@ -151,7 +151,8 @@ ResetDialByName( const string& cDialName )
 //
 // Arguments: 
 //     monitorName - name of the monitor
-//     value - place where value of monitor is put
+//     value - place where value of monitor is put, or for
+//       BorrowMonitorByName a pointer to the current value
 //
 // Returns: false
 //
@@ -167,6 +168,17 @@ GetMonitorByName( const string& monitorName, CRoadPos* )
 
 }
 
+inline virtual bool
+BorrowMonitorByName( const string& monitorName, const CRoadPos** )
+{
+
+    cout << MyName()
+         << "::BorrowMonitorByName has no monitor named "
+         << monitorName << endl;
+    return false;
+
+}
+
 inline virtual bool
 GetMonitorByName( const string& monitorName, CCrdr* )
 {
@@ -178,6 +190,17 @@ GetMonitorByName( const string& monitorName, CCrdr* )
 
 }
 
+inline virtual bool
+BorrowMonitorByName( const string& monitorName, const CCrdr** )
+{
+
+    cout << MyName()
+         << "::BorrowMonitorByName has no monitor named "
+         << monitorName << endl;
+    return false;
+
+}
+
 inline virtual bool
 GetMonitorByName( const string& monitorName, int* )
 {
@@ -211,6 +234,17 @@ GetMonitorByName( const string& monitorName, string* )
 
 }
 
+inline virtual bool
+BorrowMonitorByName( const string& monitorName, const string** )
+{
+
+    cout << MyName()
+         << "::BorrowMonitorByName has no monitor named "
+         << monitorName << endl;
+    return false;
+
+}
+
 inline virtual bool
 GetMonitorByNameStr( const string monitorName, const string* )
 {
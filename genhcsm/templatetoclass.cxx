@@ -1,279 +1,414 @@
 #include "genhcsm.h"
 #include "hcsmcollection.h"
 
-CHcsm* CHcsmCollection::GetClassFromTemplateName(
-            string templateName,
+static CHcsm* NewDdo(
+            CHcsmCollection* pRootCollection,
             const CSnoBlock& snoBlock
             )
 {
-    CHcsm* pHcsm;
-
-    if ( templateName == "Ddo" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CDdo( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "VirtualObject" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CVirtualObject( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "TimeTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CTimeTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "GmtrcPstnTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CGmtrcPstnTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "TrffcLghtTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CTrffcLghtTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "RoadPadTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CRoadPadTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "ExpressionTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CExpressionTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "FollowTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CFollowTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "TimeToArrvlTrigger" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CTimeToArrvlTrigger( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "Gateway" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CGateway( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "Ado" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CAdo( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "Autonomous" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CAutonomous( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "RemoteControl" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CRemoteControl( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "FreeDrive" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CFreeDrive( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "Follow" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CFollow( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "LaneChange" ) {
-
-        // EXIT: found class for template
-        pHcsm = new CLaneChange( this, snoBlock );
-        return pHcsm;
-
-    }
-    if ( templateName == "LcMonitor" ) {
+    return new CDdo( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcMonitor( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewVirtualObject(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CVirtualObject( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcSignal" ) {
+static CHcsm* NewTimeTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTimeTrigger( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcSignal( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewGmtrcPstnTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CGmtrcPstnTrigger( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcExecute" ) {
+static CHcsm* NewTrffcLghtTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTrffcLghtTrigger( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcExecute( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewRoadPadTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CRoadPadTrigger( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcAbort" ) {
+static CHcsm* NewExpressionTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CExpressionTrigger( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcAbort( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewFollowTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CFollowTrigger( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcExecuteNeutralize" ) {
+static CHcsm* NewTimeToArrvlTrigger(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTimeToArrvlTrigger( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcExecuteNeutralize( this );
-        return pHcsm;
+static CHcsm* NewGateway(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CGateway( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcExecuteIncrement" ) {
+static CHcsm* NewAdo(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CAdo( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcExecuteIncrement( this );
-        return pHcsm;
+static CHcsm* NewAutonomous(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CAutonomous( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcExecuteSteady" ) {
+static CHcsm* NewRemoteControl(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CRemoteControl( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcExecuteSteady( this );
-        return pHcsm;
+static CHcsm* NewFreeDrive(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CFreeDrive( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "LcExecuteDecrement" ) {
+static CHcsm* NewFollow(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CFollow( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CLcExecuteDecrement( this );
-        return pHcsm;
+static CHcsm* NewLaneChange(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CLaneChange( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "NavigateIntrsctn" ) {
+static CHcsm* NewLcMonitor(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CLcMonitor( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CNavigateIntrsctn( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewLcSignal(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CLcSignal( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "Merge" ) {
+static CHcsm* NewLcExecute(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CLcExecute( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CMerge( this );
-        return pHcsm;
+static CHcsm* NewLcAbort(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CLcAbort( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "EnvironmentController" ) {
+static CHcsm* NewLcExecuteNeutralize(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CLcExecuteNeutralize( pRootCollection );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CEnvironmentController( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewLcExecuteIncrement(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CLcExecuteIncrement( pRootCollection );
+}
 
-    }
-    if ( templateName == "EnviroInfo" ) {
+static CHcsm* NewLcExecuteSteady(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CLcExecuteSteady( pRootCollection );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CEnviroInfo( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewLcExecuteDecrement(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CLcExecuteDecrement( pRootCollection );
+}
 
-    }
-    if ( templateName == "IntersectionManager" ) {
+static CHcsm* NewNavigateIntrsctn(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CNavigateIntrsctn( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CIntersectionManager( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewMerge(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CMerge( pRootCollection );
+}
 
-    }
-    if ( templateName == "OwnVehicleMirror" ) {
+static CHcsm* NewEnvironmentController(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CEnvironmentController( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new COwnVehicleMirror( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewEnviroInfo(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CEnviroInfo( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "StaticObjManager" ) {
+static CHcsm* NewIntersectionManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CIntersectionManager( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CStaticObjManager( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewOwnVehicleMirror(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new COwnVehicleMirror( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "TrafficLightManager" ) {
+static CHcsm* NewStaticObjManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CStaticObjManager( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CTrafficLightManager( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewTrafficLightManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTrafficLightManager( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "TrafficManager" ) {
+static CHcsm* NewTrafficManager(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTrafficManager( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CTrafficManager( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewTrafficSource(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTrafficSource( pRootCollection, snoBlock );
+}
 
-    }
-    if ( templateName == "TrafficSource" ) {
+static CHcsm* NewVehFail(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CVehFail( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CTrafficSource( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewDriverMirror(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock&
+            )
+{
+    return new CDriverMirror( pRootCollection );
+}
 
-    }
-    if ( templateName == "VehFail" ) {
+static CHcsm* NewTrafficData(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CTrafficData( pRootCollection, snoBlock );
+}
 
-        // EXIT: found class for template
-        pHcsm = new CVehFail( this, snoBlock );
-        return pHcsm;
+static CHcsm* NewDaqDriver(
+            CHcsmCollection* pRootCollection,
+            const CSnoBlock& snoBlock
+            )
+{
+    return new CDaqDriver( pRootCollection, snoBlock );
+}
 
+struct THcsmTemplate {
+    const char* pName;
+    CHcsm* (*pNew)( CHcsmCollection*, const CSnoBlock& );
+};
+
+static const THcsmTemplate cHcsmTemplates[] = {
+    { "Ddo", NewDdo },
+    { "VirtualObject", NewVirtualObject },
+    { "TimeTrigger", NewTimeTrigger },
+    { "GmtrcPstnTrigger", NewGmtrcPstnTrigger },
+    { "TrffcLghtTrigger", NewTrffcLghtTrigger },
+    { "RoadPadTrigger", NewRoadPadTrigger },
+    { "ExpressionTrigger", NewExpressionTrigger },
+    { "FollowTrigger", NewFollowTrigger },
+    { "TimeToArrvlTrigger", NewTimeToArrvlTrigger },
+    { "Gateway", NewGateway },
+    { "Ado", NewAdo },
+    { "Autonomous", NewAutonomous },
+    { "RemoteControl", NewRemoteControl },
+    { "FreeDrive", NewFreeDrive },
+    { "Follow", NewFollow },
+    { "LaneChange", NewLaneChange },
+    { "LcMonitor", NewLcMonitor },
+    { "LcSignal", NewLcSignal },
+    { "LcExecute", NewLcExecute },
+    { "LcAbort", NewLcAbort },
+    { "LcExecuteNeutralize", NewLcExecuteNeutralize },
+    { "LcExecuteIncrement", NewLcExecuteIncrement },
+    { "LcExecuteSteady", NewLcExecuteSteady },
+    { "LcExecuteDecrement", NewLcExecuteDecrement },
+    { "NavigateIntrsctn", NewNavigateIntrsctn },
+    { "Merge", NewMerge },
+    { "EnvironmentController", NewEnvironmentController },
+    { "EnviroInfo", NewEnviroInfo },
+    { "IntersectionManager", NewIntersectionManager },
+    { "OwnVehicleMirror", NewOwnVehicleMirror },
+    { "StaticObjManager", NewStaticObjManager },
+    { "TrafficLightManager", NewTrafficLightManager },
+    { "TrafficManager", NewTrafficManager },
+    { "TrafficSource", NewTrafficSource },
+    { "VehFail", NewVehFail },
+    { "DriverMirror", NewDriverMirror },
+    { "TrafficData", NewTrafficData },
+    { "DaqDriver", NewDaqDriver },
+};
+
+// perfect hash of the template names; each slot holds the
+// id of the only template that hashes to it or -1
+static const unsigned int cHcsmTemplateHashSeed = 2166136265u;
+static const int cHcsmTemplateHashSize = 256;
+static const short cHcsmTemplateHash[256] = {
+    21, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+    -1, -1, -1, 18, 14, -1, 8, -1, -1, -1, -1, -1, -1, -1, 29, -1, 
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, -1, 15, 
+    -1, 10, -1, -1, -1, -1, -1, 33, -1, -1, 36, 37, 20, -1, -1, 4, 
+    12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, 26, -1, 
+    -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, 30, -1, -1, -1, 1, 
+    -1, -1, 0, -1, 34, -1, -1, -1, 27, -1, -1, -1, -1, -1, -1, -1, 
+    -1, 32, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+    -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, 
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 28, -1, -1, -1, -1, 
+    17, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+    -1, -1, -1, -1, -1, -1, -1, -1, 35, -1, -1, -1, -1, 31, 19, -1, 
+    23, -1, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1, 2, 11, -1, -1, 
+    -1, 6, -1, 25, -1, -1, -1, -1, -1, -1, 16, -1, -1, -1, -1, -1, 
+    -1, -1, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+int CHcsmCollection::GetTemplateId( const string& templateName )
+{
+    unsigned int hash = cHcsmTemplateHashSeed;
+    for ( string::size_type i = 0; i < templateName.size(); i++ ) {
+        hash ^= (unsigned char) templateName[i];
+        hash = ( hash * 16777619u ) & 0xffffffffu;
     }
-    if ( templateName == "DriverMirror" ) {
 
-        // EXIT: found class for template
-        pHcsm = new CDriverMirror( this );
-        return pHcsm;
+    int id = cHcsmTemplateHash[hash & ( cHcsmTemplateHashSize - 1 )];
+    if ( id >= 0 && templateName == cHcsmTemplates[id].pName )  return id;
 
-    }
-    if ( templateName == "TrafficData" ) {
+    return -1;
+}
 
-        // EXIT: found class for template
-        pHcsm = new CTrafficData( this, snoBlock );
-        return pHcsm;
+const char* CHcsmCollection::GetTemplateName( int templateId )
+{
+    if ( templateId < 0 || templateId >= eHCSM_NUM_TEMPLATES )  return "";
 
-    }
-    if ( templateName == "DaqDriver" ) {
+    return cHcsmTemplates[templateId].pName;
+}
 
-        // EXIT: found class for template
-        pHcsm = new CDaqDriver( this, snoBlock );
-        return pHcsm;
+CHcsm* CHcsmCollection::GetClassFromTemplateId(
+            int templateId,
+            const CSnoBlock& snoBlock
+            )
+{
+    if ( templateId < 0 || templateId >= eHCSM_NUM_TEMPLATES )  return NULL;
 
-    }
+    return cHcsmTemplates[templateId].pNew( this, snoBlock );
+}
 
-    return NULL;
+CHcsm* CHcsmCollection::GetClassFromTemplateName(
+            string templateName,
+            const CSnoBlock& snoBlock
+            )
+{
+    return GetClassFromTemplateId( GetTemplateId( templateName ), snoBlock );
 }
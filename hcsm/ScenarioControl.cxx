@@ -234,7 +234,7 @@ CScenarioControl::ProcessFile(
 //////////////////////////////////////////////////////////////////////////////
 int
 CScenarioControl::GetScenarioHeadlightSetting( void ){
-	return CHcsmCollection::m_sHeadlightScenarioControl; //<are the headlights on or off?
+	return m_pRootColl->m_ctx.m_sHeadlightScenarioControl; //<are the headlights on or off?
 }
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -1043,6 +1043,12 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	//if( m_pCved ) delete m_pCved;
 	if( m_pRootColl ) delete m_pRootColl;
 
+	//
+	// The header settings below are stored in the collection's context,
+	// so the collection has to exist before they are read.
+	//
+	m_pRootColl = new CHcsmCollection( m_behavDeltaT, m_pCved );
+
 	//
 	// Check for the existence of the CD1 and summary files and set
 	// member variables.
@@ -1055,10 +1061,10 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	m_pHdrBlk->GetBlankColor(m_blankColor[0],m_blankColor[1],m_blankColor[2]);
 	if (m_pHdrBlk->GetSirenOverSpeed()){
 		//m_sirenSpeed = m_pHdrBlk->GetSirenSpeed() * cMPH_TO_MS;
-		CHcsmCollection::m_sSirenSpeed = (m_pHdrBlk->GetSirenSpeed() * (float)cMPH_TO_MS);
+		m_pRootColl->m_ctx.m_sSirenSpeed = (m_pHdrBlk->GetSirenSpeed() * (float)cMPH_TO_MS);
 	}else{
 		//m_sirenSpeed = -1;
-		CHcsmCollection::m_sSirenSpeed = -1;
+		m_pRootColl->m_ctx.m_sSirenSpeed = -1;
 	}
 
 	//
@@ -1066,29 +1072,29 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	//
 	CHeaderParseBlock::TMotionPosition motionPos = m_pHdrBlk->GetMotionScenarioPosition();
 
-	CHcsmCollection::m_sSCC_Scen_Pos_X_Crossbeam = (float) motionPos.m_crossbeamX;
-	CHcsmCollection::m_sSCC_Scen_Pos_Y_Carriage  = (float) motionPos.m_carriageY;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_X       = (float) motionPos.m_hexX;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Y       = (float) motionPos.m_hexY;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Z       = (float) motionPos.m_hexZ;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Roll    = (float) motionPos.m_hexRoll;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Pitch   = (float) motionPos.m_hexPitch;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Yaw     = (float) motionPos.m_hexYaw;
-	CHcsmCollection::m_sSCC_Scen_Pos_TT          = (float) motionPos.m_turntable;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_X_Crossbeam = (float) motionPos.m_crossbeamX;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Y_Carriage  = (float) motionPos.m_carriageY;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_X       = (float) motionPos.m_hexX;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Y       = (float) motionPos.m_hexY;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Z       = (float) motionPos.m_hexZ;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Roll    = (float) motionPos.m_hexRoll;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Pitch   = (float) motionPos.m_hexPitch;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Yaw     = (float) motionPos.m_hexYaw;
+	m_pRootColl->m_ctx.m_sSCC_Scen_Pos_TT          = (float) motionPos.m_turntable;
 
 #if 1 // DEBUG_MPP
 	fprintf(
 		stdout,
 		"MPP: reading from file (%.1f, %.1f) (%.1f %.1f %.1f) (%.1f %.1f %.1f) %.1f\n",
-		CHcsmCollection::m_sSCC_Scen_Pos_X_Crossbeam,
-		CHcsmCollection::m_sSCC_Scen_Pos_Y_Carriage,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_X,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_Y,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_Z,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_Roll,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_Pitch,
-		CHcsmCollection::m_sSCC_Scen_Pos_Hex_Yaw,
-		CHcsmCollection::m_sSCC_Scen_Pos_TT
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_X_Crossbeam,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Y_Carriage,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_X,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Y,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Z,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Roll,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Pitch,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_Hex_Yaw,
+		m_pRootColl->m_ctx.m_sSCC_Scen_Pos_TT
 		);
 #endif
 
@@ -1103,7 +1109,7 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 		int value = *brakeItr;
 		if( cnt < cBRAKE_COND_SIZE )
 		{
-			CHcsmCollection::m_sBrakeCond[cnt++] = value;
+			m_pRootColl->m_ctx.m_sBrakeCond[cnt++] = value;
 		}
 		else
 		{
@@ -1221,7 +1227,7 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	m_sunlightIntensity = 100.0;
 	m_moonlightIntensity = (float)m_pHdrBlk->GetAmbientLightInt();
 
-	CHcsmCollection::m_sHeadlightScenarioControl = 0;
+	m_pRootColl->m_ctx.m_sHeadlightScenarioControl = 0;
 	//
 	// This SCN file has an external driver.  Make an ADO that will
 	// represent the ExternalDriver in this scenario.
@@ -1253,8 +1259,6 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	//
 	// Now load the initial set of HCSMs
 	//
-	m_pRootColl = new CHcsmCollection( m_behavDeltaT, m_pCved );
-
 	CSnoParser::TIterator pBlock = parser.Begin();
 	for( pBlock++ ; pBlock != parser.End(); pBlock++ )
 	{
@@ -1291,12 +1295,12 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	vector<string>::iterator itr;
 	for( itr = cellNames.begin(); itr != cellNames.end(); itr++ )
 	{
-		int currSize = CHcsmCollection::m_sWriteCellDataSize;
+		int currSize = m_pRootColl->m_ctx.m_sWriteCellDataSize;
 		bool haveEnoughSpace = currSize < cMAX_WRITE_CELL_DATA_SIZE;
 		if( haveEnoughSpace )
 		{
-			CHcsmCollection::m_sWriteCellData[currSize].cellName = *itr;
-			CHcsmCollection::m_sWriteCellDataSize++;
+			m_pRootColl->m_ctx.m_sWriteCellData[currSize].cellName = *itr;
+			m_pRootColl->m_ctx.m_sWriteCellDataSize++;
 		}
 		else
 		{
@@ -1324,21 +1328,21 @@ bool CScenarioControl::InitSimulation( CSnoParser& parser, bool simulateOwnVeh )
 	if( m_intVehRoadPos.IsValid() )
 	{
 		CPoint3D pos = m_intVehRoadPos.GetXYZ();
-		CHcsmCollection::m_sIsOnPath = true;
+		m_pRootColl->m_ctx.m_sIsOnPath = true;
 		CHcsmCollection::SetLastGoodPosition( (float)pos.m_x, (float)pos.m_y, (float)pos.m_z );
 	}
 
 //	CHcsmCollection::m_ownshipPath.SetCved( m_pCved );
-	CHcsmCollection::m_sOwnshipPath.SetString( m_pHdrBlk->GetPath() );
+	m_pRootColl->m_ctx.m_sOwnshipPath.SetString( m_pHdrBlk->GetPath() );
 
-	CHcsmCollection::m_sHour   = m_hour;
-	CHcsmCollection::m_sMinute = m_minute;
+	m_pRootColl->m_ctx.m_sHour   = m_hour;
+	m_pRootColl->m_ctx.m_sMinute = m_minute;
 
 	string visualSettings = m_pHdrBlk->GetVisualSettings();
-	CHcsmCollection::SetVisualSettings( visualSettings );
+	m_pRootColl->SetVisualSettings( visualSettings );
 
 	//clear the variables from the last run
-	CHcsmCollection::ClearVariables();
+	m_pRootColl->ClearVariables();
 
 	return !(m_haveError=false);
 }
@@ -2333,7 +2337,7 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 	//
 	qsort( objData, objCntr, sizeof(TObjData), CompareDists );
 
-	memset( &(CHcsmCollection::m_sDynObjData), 0, sizeof(CHcsmCollection::m_sDynObjData) );
+	memset( &(m_pRootColl->m_ctx.m_sDynObjData), 0, sizeof(m_pRootColl->m_ctx.m_sDynObjData) );
 
 	//
 	// Iterate through each dynamic object.
@@ -2352,15 +2356,15 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 
 		objPos = pDynObj->GetPosImm();
 
-		CHcsmCollection::m_sDynObjData.vel[ arrSize ] = (float) pDynObj->GetVelImm();
+		m_pRootColl->m_ctx.m_sDynObjData.vel[ arrSize ] = (float) pDynObj->GetVelImm();
 		if (objType == eCV_TRAJ_FOLLOWER) //DDO's use FPS, convert to M/S
-			CHcsmCollection::m_sDynObjData.vel[ arrSize ] *= (float)cFEET_TO_METER;
+			m_pRootColl->m_ctx.m_sDynObjData.vel[ arrSize ] *= (float)cFEET_TO_METER;
 
 
-		CHcsmCollection::m_sDynObjData.cvedId[ arrSize ] = cvedId;
-		CHcsmCollection::m_sDynObjData.solId[ arrSize ] = m_pCved->GetObjSolId( cvedId );
-		CHcsmCollection::m_sDynObjData.hcsmTypeId[ arrSize ] = m_pCved->GetObjHcsmTypeId( cvedId );
-		CHcsmCollection::m_sDynObjData.colorIndex[ arrSize ] = (short) m_pCved->GetObjColorIndex( cvedId );
+		m_pRootColl->m_ctx.m_sDynObjData.cvedId[ arrSize ] = cvedId;
+		m_pRootColl->m_ctx.m_sDynObjData.solId[ arrSize ] = m_pCved->GetObjSolId( cvedId );
+		m_pRootColl->m_ctx.m_sDynObjData.hcsmTypeId[ arrSize ] = m_pCved->GetObjHcsmTypeId( cvedId );
+		m_pRootColl->m_ctx.m_sDynObjData.colorIndex[ arrSize ] = (short) m_pCved->GetObjColorIndex( cvedId );
 
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
@@ -2369,24 +2373,24 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 			cMAX_DYN_OBJ_NAME_SIZE
 			);
 		memcpy(
-			CHcsmCollection::m_sDynObjData.name + arrSize * cMAX_DYN_OBJ_NAME_SIZE,
+			m_pRootColl->m_ctx.m_sDynObjData.name + arrSize * cMAX_DYN_OBJ_NAME_SIZE,
 			temp,
 			cMAX_DYN_OBJ_NAME_SIZE
 			);
 
-		CHcsmCollection::m_sDynObjData.pos[ arrSize*3 ]    = (float) objPos.m_x;
-		CHcsmCollection::m_sDynObjData.pos[ arrSize*3 + 1] = (float) objPos.m_y;
-		CHcsmCollection::m_sDynObjData.pos[ arrSize*3 + 2] = (float) objPos.m_z;
+		m_pRootColl->m_ctx.m_sDynObjData.pos[ arrSize*3 ]    = (float) objPos.m_x;
+		m_pRootColl->m_ctx.m_sDynObjData.pos[ arrSize*3 + 1] = (float) objPos.m_y;
+		m_pRootColl->m_ctx.m_sDynObjData.pos[ arrSize*3 + 2] = (float) objPos.m_z;
 
         auto target     = pDynObj->GetPosTarget();
         auto targetacc  = pDynObj->GetAccelTarget();
         auto targetvell = pDynObj->GetVelTarget();
 
-        CHcsmCollection::m_sDynObjData.tarPos[arrSize*3  ]    = (float)target.m_x;
-        CHcsmCollection::m_sDynObjData.tarPos[arrSize*3+1]    = (float)target.m_y;
-        CHcsmCollection::m_sDynObjData.tarPos[arrSize*3+2]    = (float)target.m_z;
-        CHcsmCollection::m_sDynObjData.tarAccMs2[arrSize]     = (float)targetacc;
-        CHcsmCollection::m_sDynObjData.tarVelMs[arrSize]      = (float)targetvell;
+        m_pRootColl->m_ctx.m_sDynObjData.tarPos[arrSize*3  ]    = (float)target.m_x;
+        m_pRootColl->m_ctx.m_sDynObjData.tarPos[arrSize*3+1]    = (float)target.m_y;
+        m_pRootColl->m_ctx.m_sDynObjData.tarPos[arrSize*3+2]    = (float)target.m_z;
+        m_pRootColl->m_ctx.m_sDynObjData.tarAccMs2[arrSize]     = (float)targetacc;
+        m_pRootColl->m_ctx.m_sDynObjData.tarVelMs[arrSize]      = (float)targetvell;
 		lat = pDynObj->GetLat();
 		lat.m_i = -lat.m_i;
 		lat.m_j = -lat.m_j;
@@ -2402,16 +2406,16 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 		double pitch = asin( tng.m_k );
 		double yaw   = atan2( tng.m_j, tng.m_i );
 
-		CHcsmCollection::m_sDynObjData.heading[ arrSize ] = (float) yaw;
-		CHcsmCollection::m_sDynObjData.rollPitch[ arrSize*2 ] = (float) roll;
-		CHcsmCollection::m_sDynObjData.rollPitch[ arrSize*2 + 1 ] = (float) pitch;
+		m_pRootColl->m_ctx.m_sDynObjData.heading[ arrSize ] = (float) yaw;
+		m_pRootColl->m_ctx.m_sDynObjData.rollPitch[ arrSize*2 ] = (float) roll;
+		m_pRootColl->m_ctx.m_sDynObjData.rollPitch[ arrSize*2 + 1 ] = (float) pitch;
 
 
 		if( objType == eCV_TRAJ_FOLLOWER )
 		{
 			const CTrajFollowerObj* pTrajFollower = dynamic_cast<const CTrajFollowerObj*>( pDynObj );
 
-			CHcsmCollection::m_sDynObjData.audioVisualState[ arrSize ] =
+			m_pRootColl->m_ctx.m_sDynObjData.audioVisualState[ arrSize ] =
 				((pTrajFollower->GetAudioState() & 0xFFFF) << 16 )
 				+ (pTrajFollower->GetVisualState() & 0xFFFF);
 		}
@@ -2419,7 +2423,7 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 		{
 			const CVehicleObj* pVehicleObj = dynamic_cast<const CVehicleObj*>( pDynObj );
 
-			CHcsmCollection::m_sDynObjData.audioVisualState[ arrSize ] =
+			m_pRootColl->m_ctx.m_sDynObjData.audioVisualState[ arrSize ] =
 				((pVehicleObj->GetAudioState() & 0xFFFF) << 16 )
 				+ (pVehicleObj->GetVisualState() & 0xFFFF);
 		}
@@ -2435,7 +2439,7 @@ CScenarioControl::ComputeDynObjData( const CPoint3D& cOwnVehCartPos )
 		}
 	}
 
-	CHcsmCollection::m_sDynObjDataSize = arrSize;
+	m_pRootColl->m_ctx.m_sDynObjDataSize = arrSize;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2468,7 +2472,7 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 
 	if ( objs.empty() )
 	{
-		CHcsmCollection::m_sStatObjDataSize = 0;
+		m_pRootColl->m_ctx.m_sStatObjDataSize = 0;
 		return;
 	}
 
@@ -2513,7 +2517,7 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 	//
 	qsort( objData, objCntr, sizeof(TObjData), CompareDists );
 
-	memset( &(CHcsmCollection::m_sStatObjData), 0, sizeof(CHcsmCollection::m_sStatObjData) );
+	memset( &(m_pRootColl->m_ctx.m_sStatObjData), 0, sizeof(m_pRootColl->m_ctx.m_sStatObjData) );
 
 	//
 	// Iterate through each static object.
@@ -2533,9 +2537,9 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 		tan = state.anyState.tangent;
 		lat = state.anyState.lateral;
 
-		CHcsmCollection::m_sStatObjData.cvedId[ arrSize ] = cvedId;
-		CHcsmCollection::m_sStatObjData.solId[ arrSize ] = m_pCved->GetObjSolId( cvedId );
-		CHcsmCollection::m_sStatObjData.hcsmTypeId[ arrSize ] = m_pCved->GetObjHcsmTypeId( cvedId );
+		m_pRootColl->m_ctx.m_sStatObjData.cvedId[ arrSize ] = cvedId;
+		m_pRootColl->m_ctx.m_sStatObjData.solId[ arrSize ] = m_pCved->GetObjSolId( cvedId );
+		m_pRootColl->m_ctx.m_sStatObjData.hcsmTypeId[ arrSize ] = m_pCved->GetObjHcsmTypeId( cvedId );
 
 		char temp[cMAX_STAT_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
@@ -2544,14 +2548,14 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 			cMAX_STAT_OBJ_NAME_SIZE
 			);
 		memcpy(
-			CHcsmCollection::m_sStatObjData.name + arrSize * cMAX_STAT_OBJ_NAME_SIZE,
+			m_pRootColl->m_ctx.m_sStatObjData.name + arrSize * cMAX_STAT_OBJ_NAME_SIZE,
 			temp,
 			cMAX_STAT_OBJ_NAME_SIZE
 			);
 
-		CHcsmCollection::m_sStatObjData.pos[ arrSize*3 ] = (float) objPos.m_x;
-		CHcsmCollection::m_sStatObjData.pos[ arrSize*3 + 1] = (float) objPos.m_y;
-		CHcsmCollection::m_sStatObjData.pos[ arrSize*3 + 2] = (float) objPos.m_z;
+		m_pRootColl->m_ctx.m_sStatObjData.pos[ arrSize*3 ] = (float) objPos.m_x;
+		m_pRootColl->m_ctx.m_sStatObjData.pos[ arrSize*3 + 1] = (float) objPos.m_y;
+		m_pRootColl->m_ctx.m_sStatObjData.pos[ arrSize*3 + 2] = (float) objPos.m_z;
 
 		lat.m_i = -lat.m_i;
 		lat.m_j = -lat.m_j;
@@ -2565,11 +2569,11 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 		double pitch = asin( tan.m_k );
 		double yaw   = atan2( tan.m_j, tan.m_i );
 
-		CHcsmCollection::m_sStatObjData.heading[ arrSize ] = (float) yaw;
-		CHcsmCollection::m_sStatObjData.rollPitch[ arrSize*2 ] = (float) roll;
-		CHcsmCollection::m_sStatObjData.rollPitch[ arrSize*2 + 1 ] = (float) pitch;
+		m_pRootColl->m_ctx.m_sStatObjData.heading[ arrSize ] = (float) yaw;
+		m_pRootColl->m_ctx.m_sStatObjData.rollPitch[ arrSize*2 ] = (float) roll;
+		m_pRootColl->m_ctx.m_sStatObjData.rollPitch[ arrSize*2 + 1 ] = (float) pitch;
 
-		CHcsmCollection::m_sStatObjData.audioVisualState[ arrSize ] =
+		m_pRootColl->m_ctx.m_sStatObjData.audioVisualState[ arrSize ] =
 			((state.anyState.audioState & 0xFFFF) << 16 )
 			+ (state.anyState.visualState & 0xFFFF);
 
@@ -2586,10 +2590,10 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 
 	delete [] objData;
 
-	CHcsmCollection::m_sStatObjDataSize = arrSize;
+	m_pRootColl->m_ctx.m_sStatObjDataSize = arrSize;
 	//now lets get the list of changed static objects
 	//CHcsmCollection::m_sChangedStatObjOptionId = 0;
-	CHcsmCollection::m_sChangedStatObjDataSize = 0;
+	m_pRootColl->m_ctx.m_sChangedStatObjDataSize = 0;
 
 	CVED::CCved::TIntVec objItr;
     // Define a template class deque of int
@@ -2599,15 +2603,15 @@ CScenarioControl::ComputeStatObjData( const CPoint3D& cOwnVehCartPos, bool onlyO
 	CObjTypeMask mask;
 	mask.SetAll();
 	m_pCved->GetChangedStaticObjsNear(cOwnVehCartPos,10000,5,objItr);
-	CHcsmCollection::m_sChangedStatObjDataSize = min(objItr.size(),size_t(cMAX_CHANGED_STAT_OBJ));
+	m_pRootColl->m_ctx.m_sChangedStatObjDataSize = min(objItr.size(),size_t(cMAX_CHANGED_STAT_OBJ));
 	int option = -1;
-	for (int i = 0; i < CHcsmCollection::m_sChangedStatObjDataSize; i++){
+	for (int i = 0; i < m_pRootColl->m_ctx.m_sChangedStatObjDataSize; i++){
 		if (m_pCved->GetObjOption(objItr[i],option)){
-			CHcsmCollection::m_sChangedStatObjOption[i] = option;
+			m_pRootColl->m_ctx.m_sChangedStatObjOption[i] = option;
 		}else{
-			CHcsmCollection::m_sChangedStatObjOption[i] = -1; //invalid id
+			m_pRootColl->m_ctx.m_sChangedStatObjOption[i] = -1; //invalid id
 		}
-		CHcsmCollection::m_sChangedStatObjId[i] = objItr[i];
+		m_pRootColl->m_ctx.m_sChangedStatObjId[i] = objItr[i];
 	}
 
 }
@@ -2819,15 +2823,15 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
 	int leadObjId;
 	double distToLeadObj;
     bool isGoingCorrectDir = true;
-	CHcsmCollection::m_sFollowInfo[0] = -2.0f;
+	m_pRootColl->m_ctx.m_sFollowInfo[0] = -2.0f;
     CRoadPos ownVehPos(*m_pCved,cOwnVehCartPos);
     if (!ownVehPos.IsValid()){
 		m_sOwnVehToLeadObjDist = -1.0f;
-		CHcsmCollection::m_sFollowInfo[0] = -1.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[0] = -1.0f;
 		// these are being set since the titler is not able to look at
 		// element 0 to see if the values in elements 1 and 4 are valid.
-		CHcsmCollection::m_sFollowInfo[1] = 0.0f;
-		CHcsmCollection::m_sFollowInfo[3] = 0.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[1] = 0.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[3] = 0.0f;
         return;
     }
     bool useSpecedCrdr = false; //if we are facing the wrong way on a corridor because of overlap, we may
@@ -2852,7 +2856,7 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
                     isGoingCorrectDir= true;
                 }
             }else if (!ovFrontrp.IsRoad() && ! ownVehPos.IsRoad() && dir < 0){
-                if (!CHcsmCollection::m_sOwnshipPath.IsValid()){
+                if (!m_pRootColl->m_ctx.m_sOwnshipPath.IsValid()){
                     //if we have a path, the path should resolve to the correct cooridor for us...
                     //but since we do not have one, we need to build a resolve one for our selves...
                     vector< pair<int,double> > corridors;
@@ -2888,13 +2892,13 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
     if (useSpecedCrdr){
          success = m_pCved->GetLeadObj( 0, leadObjId, distToLeadObj, NULL,isGoingCorrectDir,prefCrdr );
     }else{
-        success = m_pCved->GetLeadObj( 0, leadObjId, distToLeadObj, &CHcsmCollection::m_sOwnshipPath,isGoingCorrectDir );
+        success = m_pCved->GetLeadObj( 0, leadObjId, distToLeadObj, &m_pRootColl->m_ctx.m_sOwnshipPath,isGoingCorrectDir );
     }
-	CHcsmCollection::m_sFollowInfo[0] = -2;
+	m_pRootColl->m_ctx.m_sFollowInfo[0] = -2;
     memset(
-		&CHcsmCollection::m_sFollowInfo[1],
+		&m_pRootColl->m_ctx.m_sFollowInfo[1],
 		0,
-		sizeof( CHcsmCollection::m_sFollowInfo[0] )  * 8
+		sizeof( m_pRootColl->m_ctx.m_sFollowInfo[0] )  * 8
 		);
 
 	if( success )
@@ -2910,31 +2914,31 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
 		ownVehVel = ownVehVel * cMETER_TO_FEET; //3.2808;  // convert to ft/s
 		double diffVel = ownVehVel - leadVehVel;
 
-		CHcsmCollection::m_sFollowInfo[0] = (float) leadObjId;
-		CHcsmCollection::m_sFollowInfo[1] = (float) distToLeadObj;
+		m_pRootColl->m_ctx.m_sFollowInfo[0] = (float) leadObjId;
+		m_pRootColl->m_ctx.m_sFollowInfo[1] = (float) distToLeadObj;
 		if( success )
 		{
-			CHcsmCollection::m_sFollowInfo[2] = (float) ( bumperTobumperDist / ownVehVel );
+			m_pRootColl->m_ctx.m_sFollowInfo[2] = (float) ( bumperTobumperDist / ownVehVel );
 			bool calcTtc = leadVehVel < ownVehVel;
 			if( calcTtc )
 			{
-				CHcsmCollection::m_sFollowInfo[4] = (float) ( bumperTobumperDist / diffVel );
+				m_pRootColl->m_ctx.m_sFollowInfo[4] = (float) ( bumperTobumperDist / diffVel );
 			}
 			else
 			{
-				CHcsmCollection::m_sFollowInfo[4] = 10000.0f;
+				m_pRootColl->m_ctx.m_sFollowInfo[4] = 10000.0f;
 			}
 		}
 		else
 		{
-			CHcsmCollection::m_sFollowInfo[2] = 0.0f;
-			CHcsmCollection::m_sFollowInfo[4] = 0.0f;
+			m_pRootColl->m_ctx.m_sFollowInfo[2] = 0.0f;
+			m_pRootColl->m_ctx.m_sFollowInfo[4] = 0.0f;
 		}
-		CHcsmCollection::m_sFollowInfo[3] = (float) bumperTobumperDist;
-		CHcsmCollection::m_sFollowInfo[5] = (float) leadVehVel;
-		CHcsmCollection::m_sFollowInfo[6] = (float) leadVehPos.m_x;
-		CHcsmCollection::m_sFollowInfo[7] = (float) leadVehPos.m_y;
-		CHcsmCollection::m_sFollowInfo[8] = (float) leadVehPos.m_z;
+		m_pRootColl->m_ctx.m_sFollowInfo[3] = (float) bumperTobumperDist;
+		m_pRootColl->m_ctx.m_sFollowInfo[5] = (float) leadVehVel;
+		m_pRootColl->m_ctx.m_sFollowInfo[6] = (float) leadVehPos.m_x;
+		m_pRootColl->m_ctx.m_sFollowInfo[7] = (float) leadVehPos.m_y;
+		m_pRootColl->m_ctx.m_sFollowInfo[8] = (float) leadVehPos.m_z;
 
 		m_sOwnVehToLeadObjDist = (float) bumperTobumperDist;
 
@@ -2942,11 +2946,11 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
 	else
 	{
 		m_sOwnVehToLeadObjDist = -1.0f;
-		CHcsmCollection::m_sFollowInfo[0] = -1.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[0] = -1.0f;
 		// these are being set since the titler is not able to look at
 		// element 0 to see if the values in elements 1 and 4 are valid.
-		CHcsmCollection::m_sFollowInfo[1] = 0.0f;
-		CHcsmCollection::m_sFollowInfo[3] = 0.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[1] = 0.0f;
+		m_pRootColl->m_ctx.m_sFollowInfo[3] = 0.0f;
 	}
 
 }
@@ -2960,7 +2964,7 @@ CScenarioControl::ComputeLeadVehInfo( const CPoint3D& cOwnVehCartPos )
 //   check to see if any corner within 2 feet of lane edge.  If driver not
 //   steering away from that edge, then activate warning.
 //
-//   NOTES: Sets the CHcsmCollection::m_sLdwStatus static variable.
+//   NOTES: Sets the m_pRootColl->m_ctx.m_sLdwStatus static variable.
 //
 // Arguments:
 //  cpOwnVehCartPos - The ownvehicle's current position.
@@ -2973,13 +2977,13 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 {
 	//gout << "LDW..." << endl;
 
-	CHcsmCollection::m_sLdwStatus = eLDW_NONE;
-	CHcsmCollection::m_sLaneDepartWarn[0] = (float)CHcsmCollection::m_sLdwStatus;
-	CHcsmCollection::m_sLaneDepartWarn[1] = 0.0;
-	CHcsmCollection::m_sLaneDepartWarn[2] = 0.0;
-	CHcsmCollection::m_sLaneDepartWarn[3] = 0.0;
+	m_pRootColl->m_ctx.m_sLdwStatus = eLDW_NONE;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[0] = (float)m_pRootColl->m_ctx.m_sLdwStatus;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[1] = 0.0;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[2] = 0.0;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[3] = 0.0;
 
-	bool runLdwAlgorithm = CHcsmCollection::m_sLCW_IsOn;
+	bool runLdwAlgorithm = m_pRootColl->m_ctx.m_sLCW_IsOn;
 	//if( !runLdwAlgorithm )  return;
 
 	// check to make sure that the own vehicle exists
@@ -3059,8 +3063,8 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 	// Get lane markings
 	//m_ownVehRoadPos.GetRoadMarking(leftMarking, rightMarking, rightAtrib, leftAtrib);
 	//cout << "left=" << leftMarking << " right=" << rightMarking << endl;
-	leftMarking = CHcsmCollection::m_sLaneMarkingInfo[0];
-	rightMarking  = CHcsmCollection::m_sLaneMarkingInfo[1];
+	leftMarking = m_pRootColl->m_ctx.m_sLaneMarkingInfo[0];
+	rightMarking  = m_pRootColl->m_ctx.m_sLaneMarkingInfo[1];
 	////
 	//// Check to see if all four corners are on the same crdr or lane.
 	////
@@ -3097,11 +3101,11 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 	//
 	// Figure out which way the vehicle is head with respect to the road.
 	//
-	bool driverSignalingLeft = CHcsmCollection::m_sCisTurnSignal == eTURN_SIGNAL_LEFT;
-	bool driverSignalingRight = CHcsmCollection::m_sCisTurnSignal == eTURN_SIGNAL_RIGHT;
+	bool driverSignalingLeft = m_pRootColl->m_ctx.m_sCisTurnSignal == eTURN_SIGNAL_LEFT;
+	bool driverSignalingRight = m_pRootColl->m_ctx.m_sCisTurnSignal == eTURN_SIGNAL_RIGHT;
 	int crdrUsed = -1;
-	double offsetFront = ownVehRoadPosSorted[cMID_FRONT].GetOffset(-1,&CHcsmCollection::m_sOwnshipPath);
-	double offsetRear = ownVehRoadPosSorted[cMID_REAR].GetOffset(-1,&CHcsmCollection::m_sOwnshipPath);
+	double offsetFront = ownVehRoadPosSorted[cMID_FRONT].GetOffset(-1,&m_pRootColl->m_ctx.m_sOwnshipPath);
+	double offsetRear = ownVehRoadPosSorted[cMID_REAR].GetOffset(-1,&m_pRootColl->m_ctx.m_sOwnshipPath);
 	CVector3D tanRoad = ownVehRoadPosSorted[cMID_FRONT].GetTangent();
 
 	// only 'false' case can happen on a road in the wrong lane.
@@ -3132,9 +3136,9 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 	if( angleInLane < -0.5 ) vehicleHeadedRight = false;
 
 	float margin = 3.0f;
-	if (CHcsmCollection::m_sLDW_Severity==1)
+	if (m_pRootColl->m_ctx.m_sLDW_Severity==1)
 		margin = 12.0f; // 12" before crossing inner edge of the lane marking
-	else if (CHcsmCollection::m_sLDW_Severity==2)
+	else if (m_pRootColl->m_ctx.m_sLDW_Severity==2)
 		margin = 3.0f; // 3" before crossing inner edge of the lane marking
 	else
 		margin = 6.0f; // 6" before crossing inner edge of the lane marking
@@ -3181,44 +3185,44 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 			maxDistFromRightEdge = 18.0f/12.0f;  // feet
 	};
 
-	CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+	m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 
 	if( distFromLeftEdge < -maxDistFromLeftEdge &&
 		!vehicleHeadedRight && !driverSignalingLeft ) {
-			CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+			m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 	}
 	else if( distFromLeftEdge < minDistFromLeftEdge &&
 		!vehicleHeadedRight && !driverSignalingLeft ) {
-			CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+			m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 			//if( leftMarking>=0 ) {
-			//	if( leftMarking>0 ) CHcsmCollection::m_sLdwStatus = eLDW_LEFT;
+			//	if( leftMarking>0 ) m_pRootColl->m_ctx.m_sLdwStatus = eLDW_LEFT;
 			//} else {
-			//	CHcsmCollection::m_sLdwStatus = eLDW_LEFT;
+			//	m_pRootColl->m_ctx.m_sLdwStatus = eLDW_LEFT;
 			//}
 			if( leftMarking > 0  && goingWithTraffic ) {
-				CHcsmCollection::m_sLdwStatus = eLDW_LEFT;
+				m_pRootColl->m_ctx.m_sLdwStatus = eLDW_LEFT;
 			}
 			if (leftMarking == -1 && goingWithTraffic && m_ownVehRoadPos.IsRoad() ){
-				CHcsmCollection::m_sLdwStatus = eLDW_LEFT;
+				m_pRootColl->m_ctx.m_sLdwStatus = eLDW_LEFT;
 			}
 	}
 	if( distFromRightEdge < -maxDistFromRightEdge &&
 		vehicleHeadedRight && !driverSignalingRight ) {
-			CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+			m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 	}
 	else if( distFromRightEdge < minDistFromRightEdge &&
 		vehicleHeadedRight && !driverSignalingRight ) {
-			CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+			m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 			//if( rightMarking>=0 ) {
-			//	if( rightMarking>0 ) CHcsmCollection::m_sLdwStatus = eLDW_RIGHT;
+			//	if( rightMarking>0 ) m_pRootColl->m_ctx.m_sLdwStatus = eLDW_RIGHT;
 			//} else {
-			//	CHcsmCollection::m_sLdwStatus = eLDW_RIGHT;
+			//	m_pRootColl->m_ctx.m_sLdwStatus = eLDW_RIGHT;
 			//}
 			if( rightMarking > 0 && goingWithTraffic ) {
-				CHcsmCollection::m_sLdwStatus = eLDW_RIGHT;
+				m_pRootColl->m_ctx.m_sLdwStatus = eLDW_RIGHT;
 			}
 			if (rightMarking == -1 && goingWithTraffic && m_ownVehRoadPos.IsRoad() ){
-				CHcsmCollection::m_sLdwStatus = eLDW_RIGHT;
+				m_pRootColl->m_ctx.m_sLdwStatus = eLDW_RIGHT;
 			}
 	}
 
@@ -3230,22 +3234,22 @@ CScenarioControl::ComputeLaneDepartureWarning( const CPoint3D& cOwnVehCartPos )
 	//	//cout << "distleft=" << distFromLeftEdge << " distright=" << distFromRightEdge << endl;
 	//	//cout << "minleft=" << minDistFromLeftEdge << " minright=" << minDistFromRightEdge << endl;
 	//	//cout << " road name = " << m_ownVehRoadPos.GetName();
-	//	//cout << " lane width = " << CHcsmCollection::m_sLaneDevInfo[2] << endl;
+	//	//cout << " lane width = " << m_pRootColl->m_ctx.m_sLaneDevInfo[2] << endl;
 	//}
 	//else {
 	//	counter+=1;
 	//}
 
 	// check that the car is not in the oncoming lane
-	//if( CHcsmCollection::m_sLaneDevInfo[3]==0 ) CHcsmCollection::m_sLdwStatus = eLDW_MONITORING;
+	//if( m_pRootColl->m_ctx.m_sLaneDevInfo[3]==0 ) m_pRootColl->m_ctx.m_sLdwStatus = eLDW_MONITORING;
 
-	CHcsmCollection::m_sLaneDepartWarn[0] = (float)CHcsmCollection::m_sLdwStatus;
-	CHcsmCollection::m_sLaneDepartWarn[1] = (float)distFromLeftEdge;
-	CHcsmCollection::m_sLaneDepartWarn[2] = (float)distFromRightEdge;
-	CHcsmCollection::m_sLaneDepartWarn[3] = (float)angleInLane;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[0] = (float)m_pRootColl->m_ctx.m_sLdwStatus;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[1] = (float)distFromLeftEdge;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[2] = (float)distFromRightEdge;
+	m_pRootColl->m_ctx.m_sLaneDepartWarn[3] = (float)angleInLane;
 	//printf("angleInLane = %f, left:%f, right:%f\n",angleInLane,(float)vehicleHeadedLeft,(float)vehicleHeadedRight);
 
-//	gout << "  system status = " << CHcsmCollection::m_sLdwStatus << endl;
+//	gout << "  system status = " << m_pRootColl->m_ctx.m_sLdwStatus << endl;
 }
 
 
@@ -3269,11 +3273,11 @@ CScenarioControl::ComputeBackupDetectionWarning( const CPoint3D& cOwnVehCartPos
 	// Check to see if backup detection has been engaged by scenario.
 	//
 
-	bool runBudAlgorithm = CHcsmCollection::m_sBUD_IsOn;
+	bool runBudAlgorithm = m_pRootColl->m_ctx.m_sBUD_IsOn;
 	if( !runBudAlgorithm )  return;
 
 	const double cBUD_MAX_DIST = 100.0f;
-	CHcsmCollection::m_sBackUpDistance = (float)cBUD_MAX_DIST;
+	m_pRootColl->m_ctx.m_sBackUpDistance = (float)cBUD_MAX_DIST;
 
 	//
 	// Get all objects within a certain distance of the driver.
@@ -3374,7 +3378,7 @@ CScenarioControl::ComputeBackupDetectionWarning( const CPoint3D& cOwnVehCartPos
 		if( ovBoundingBox.Intersects( objBoundingBox ) )
 		{
 //			gout << "    ov intersects this obj" << endl;
-			CHcsmCollection::m_sBackUpDistance = 0.0f;
+			m_pRootColl->m_ctx.m_sBackUpDistance = 0.0f;
 			break;
 		}
 		else if( ovBackBoundingBox.Intersects( objBoundingBox ) )
@@ -3410,10 +3414,10 @@ CScenarioControl::ComputeBackupDetectionWarning( const CPoint3D& cOwnVehCartPos
 
 	if( foundDist )
 	{
-		CHcsmCollection::m_sBackUpDistance =(float) sqrt( minDistSquared );
+		m_pRootColl->m_ctx.m_sBackUpDistance =(float) sqrt( minDistSquared );
 	}
 
-//	gout << "  result = " << CHcsmCollection::m_sBackUpDistance << " feet" << endl;
+//	gout << "  result = " << m_pRootColl->m_ctx.m_sBackUpDistance << " feet" << endl;
 }
 
 
@@ -3503,7 +3507,7 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 				//printf("distance on lane %f\n", distance);
 				CLane lane = m_ownVehRoadPos.GetLane();
 				CLane splineLane = m_ownVehRoadPos.GetSplineLane();
-//				if (CHcsmCollection::m_sOwnshipPath.IsValid() && CHcsmCollection::m_sOwnshipPath.Contains(m_ownVehRoadPos))
+//				if (m_pRootColl->m_ctx.m_sOwnshipPath.IsValid() && m_pRootColl->m_ctx.m_sOwnshipPath.Contains(m_ownVehRoadPos))
 //				{
 //
 //				}
@@ -3511,15 +3515,15 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 //				tempSpline.addPoint();
 				double ofs  = m_ownVehRoadPos.GetOffset();
 
-				CHcsmCollection::m_sLaneDevInfo[0] = 1.0;
-				CHcsmCollection::m_sLaneDevInfo[1] = (float) ofs;
-				CHcsmCollection::m_sLaneDevInfo[2] = (float) lane.GetWidth(distance);
-				CHcsmCollection::m_sLaneDevInfo[3] = lane.GetRelativeId();
+				m_pRootColl->m_ctx.m_sLaneDevInfo[0] = 1.0;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[1] = (float) ofs;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[2] = (float) lane.GetWidth(distance);
+				m_pRootColl->m_ctx.m_sLaneDevInfo[3] = lane.GetRelativeId();
 
-				CHcsmCollection::m_sSplineDevInfo[0] = 1.0;
-				CHcsmCollection::m_sSplineDevInfo[1] = (float) m_ownVehRoadPos.GetSplineOffset();;
-				CHcsmCollection::m_sSplineDevInfo[2] = (float) splineLane.GetWidth(distance);
-				CHcsmCollection::m_sSplineDevInfo[3] = splineLane.GetRelativeId();
+				m_pRootColl->m_ctx.m_sSplineDevInfo[0] = 1.0;
+				m_pRootColl->m_ctx.m_sSplineDevInfo[1] = (float) m_ownVehRoadPos.GetSplineOffset();;
+				m_pRootColl->m_ctx.m_sSplineDevInfo[2] = (float) splineLane.GetWidth(distance);
+				m_pRootColl->m_ctx.m_sSplineDevInfo[3] = splineLane.GetRelativeId();
 
 			}
 			else
@@ -3529,9 +3533,9 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 				int crdId = -1;
 				double ofs  = 0;
 				int usedPathMode = 1;
-				if( CHcsmCollection::m_sOwnshipPath.IsValid() && CHcsmCollection::m_sOwnshipPath.Contains(m_ownVehRoadPos))
+				if( m_pRootColl->m_ctx.m_sOwnshipPath.IsValid() && m_pRootColl->m_ctx.m_sOwnshipPath.Contains(m_ownVehRoadPos))
 				{
-					ofs  = m_ownVehRoadPos.GetOffset(-1, &CHcsmCollection::m_sOwnshipPath, &crdId );
+					ofs  = m_ownVehRoadPos.GetOffset(-1, &m_pRootColl->m_ctx.m_sOwnshipPath, &crdId );
 				}
 				else
 				{
@@ -3550,29 +3554,29 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 
 
 
-				CHcsmCollection::m_sLaneDevInfo[0] = -1.0f * usedPathMode;
-				CHcsmCollection::m_sLaneDevInfo[1] = (float) ofs;
-				CHcsmCollection::m_sLaneDevInfo[2] = 0.0;  // not efficient
-				CHcsmCollection::m_sLaneDevInfo[3] = (float) crdId;//sPrevCrdr.GetRelativeId();
+				m_pRootColl->m_ctx.m_sLaneDevInfo[0] = -1.0f * usedPathMode;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[1] = (float) ofs;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[2] = 0.0;  // not efficient
+				m_pRootColl->m_ctx.m_sLaneDevInfo[3] = (float) crdId;//sPrevCrdr.GetRelativeId();
 
-				CHcsmCollection::m_sSplineDevInfo[0] = -1.0f * usedPathMode;
-				CHcsmCollection::m_sSplineDevInfo[1] = (float) ofs;
-				CHcsmCollection::m_sSplineDevInfo[2] = 0.0;  // not efficient
-				CHcsmCollection::m_sSplineDevInfo[3] = (float) crdId;//sPrevCrdr.GetRelativeId();
+				m_pRootColl->m_ctx.m_sSplineDevInfo[0] = -1.0f * usedPathMode;
+				m_pRootColl->m_ctx.m_sSplineDevInfo[1] = (float) ofs;
+				m_pRootColl->m_ctx.m_sSplineDevInfo[2] = 0.0;  // not efficient
+				m_pRootColl->m_ctx.m_sSplineDevInfo[3] = (float) crdId;//sPrevCrdr.GetRelativeId();
 
 
 			}
 
-			CHcsmCollection::m_sOwnVehCurvature = (float) m_ownVehRoadPos.GetExpandedCurvature();
+			m_pRootColl->m_ctx.m_sOwnVehCurvature = (float) m_ownVehRoadPos.GetExpandedCurvature();
 			const float cMAX_CUVATURE = 10000.0;
-			bool curvatureTooHighToMatter = CHcsmCollection::m_sOwnVehCurvature > cMAX_CUVATURE;
+			bool curvatureTooHighToMatter = m_pRootColl->m_ctx.m_sOwnVehCurvature > cMAX_CUVATURE;
 			if( curvatureTooHighToMatter )
-				CHcsmCollection::m_sOwnVehCurvature = cMAX_CUVATURE;
+				m_pRootColl->m_ctx.m_sOwnVehCurvature = cMAX_CUVATURE;
 			else
 			{
-				curvatureTooHighToMatter = CHcsmCollection::m_sOwnVehCurvature < -cMAX_CUVATURE;
+				curvatureTooHighToMatter = m_pRootColl->m_ctx.m_sOwnVehCurvature < -cMAX_CUVATURE;
 				if( curvatureTooHighToMatter )
-					CHcsmCollection::m_sOwnVehCurvature = -cMAX_CUVATURE;
+					m_pRootColl->m_ctx.m_sOwnVehCurvature = -cMAX_CUVATURE;
 			}
 		}
 		else
@@ -3592,11 +3596,11 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 					fflush( stderr );
 				}
 #endif
-				CHcsmCollection::m_sLaneDevInfo[0] = 0.0;
-				CHcsmCollection::m_sLaneDevInfo[1] = 0.0;
-				CHcsmCollection::m_sLaneDevInfo[2] = 0.0;
-				CHcsmCollection::m_sLaneDevInfo[3] = 0.0;
-				CHcsmCollection::m_sOwnVehCurvature = 0.0f;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[0] = 0.0;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[1] = 0.0;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[2] = 0.0;
+				m_pRootColl->m_ctx.m_sLaneDevInfo[3] = 0.0;
+				m_pRootColl->m_ctx.m_sOwnVehCurvature = 0.0f;
 			}
 		}
 
@@ -3604,63 +3608,63 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 	}
 	else
 	{
-		CHcsmCollection::m_sLaneDevInfo[0] = 0.0;
-		CHcsmCollection::m_sLaneDevInfo[1] = 0.0;
-		CHcsmCollection::m_sLaneDevInfo[2] = 0.0;
-		CHcsmCollection::m_sLaneDevInfo[3] = 0.0;
-		CHcsmCollection::m_sOwnVehCurvature = 0.0f;
+		m_pRootColl->m_ctx.m_sLaneDevInfo[0] = 0.0;
+		m_pRootColl->m_ctx.m_sLaneDevInfo[1] = 0.0;
+		m_pRootColl->m_ctx.m_sLaneDevInfo[2] = 0.0;
+		m_pRootColl->m_ctx.m_sLaneDevInfo[3] = 0.0;
+		m_pRootColl->m_ctx.m_sOwnVehCurvature = 0.0f;
 	}
 
-	if( CHcsmCollection::m_sSirenSpeed > 0 )
+	if( m_pRootColl->m_ctx.m_sSirenSpeed > 0 )
 	{
 		//if they are over sirenSpeed, tell the audio to play a siren
 		double myvel;
 		if( m_pCved->GetOwnVehicleVel( myvel ) )
 		{
-			if( myvel > CHcsmCollection::m_sSirenSpeed )
+			if( myvel > m_pRootColl->m_ctx.m_sSirenSpeed )
 			{
 				//float overSpeed = myvel - m_sirenSpeed;
-				float overSpeed = (float)myvel - CHcsmCollection::m_sSirenSpeed;
-				CHcsmCollection::m_sSirenEffect = 0.1f + (overSpeed/(15 * (float)cMS_TO_MPH)) * 0.9f;
+				float overSpeed = (float)myvel - m_pRootColl->m_ctx.m_sSirenSpeed;
+				m_pRootColl->m_ctx.m_sSirenEffect = 0.1f + (overSpeed/(15 * (float)cMS_TO_MPH)) * 0.9f;
 			}
 			else
 			{
-				CHcsmCollection::m_sSirenEffect  = 0;
+				m_pRootColl->m_ctx.m_sSirenEffect  = 0;
 			}
 		}
 	}
 	else
 	{
-		CHcsmCollection::m_sSirenEffect  = 0;
+		m_pRootColl->m_ctx.m_sSirenEffect  = 0;
 	}
 
 	//now see if the ownship is on the ownship path
-	if( m_ownVehRoadPos.IsValid() && CHcsmCollection::m_sOwnshipPath.IsValid() && CHcsmCollection::m_sOwnshipPath.Contains( m_ownVehRoadPos ) )
+	if( m_ownVehRoadPos.IsValid() && m_pRootColl->m_ctx.m_sOwnshipPath.IsValid() && m_pRootColl->m_ctx.m_sOwnshipPath.Contains( m_ownVehRoadPos ) )
 	{
 		CPoint3D pos = m_ownVehRoadPos.GetXYZ();
-		CHcsmCollection::m_sIsOnPath = true;
+		m_pRootColl->m_ctx.m_sIsOnPath = true;
 		CHcsmCollection::SetLastGoodPosition( (float)pos.m_x, (float)pos.m_y, (float)pos.m_z );
 	}
 	else
 	{
-		CHcsmCollection::m_sIsOnPath = false;
+		m_pRootColl->m_ctx.m_sIsOnPath = false;
 	}
 
 	if( m_ownVehRoadPos.IsValid() &&
 		m_intVehRoadPos.IsValid() &&
-	    CHcsmCollection::m_sOwnshipPath.Contains( m_ownVehRoadPos ) &&
-		CHcsmCollection::m_sOwnshipPath.Contains( m_intVehRoadPos )
+	    m_pRootColl->m_ctx.m_sOwnshipPath.Contains( m_ownVehRoadPos ) &&
+		m_pRootColl->m_ctx.m_sOwnshipPath.Contains( m_intVehRoadPos )
 		)
 	{
-			CHcsmCollection::m_sOwnVehDistOnPath = (float)CHcsmCollection::m_sOwnshipPath.GetLength( &m_intVehRoadPos, &m_ownVehRoadPos );
+			m_pRootColl->m_ctx.m_sOwnVehDistOnPath = (float)m_pRootColl->m_ctx.m_sOwnshipPath.GetLength( &m_intVehRoadPos, &m_ownVehRoadPos );
 	}
 	else
 	{
-		CHcsmCollection::m_sOwnVehDistOnPath = -1;
+		m_pRootColl->m_ctx.m_sOwnVehDistOnPath = -1;
 	}
 	int leftmarking, rightmarking, rightAtrib, leftAtrib;
     //calcuate a forward vector for an overhead view
-    if (CHcsmCollection::m_sIsOnPath){
+    if (m_pRootColl->m_ctx.m_sIsOnPath){
         float collectiveWeights;
         //we are going to do a 7 point sample of the tangents
         // 2 4 8 4 2
@@ -3668,7 +3672,7 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
         CPoint3D ownpos = m_ownVehRoadPos.GetVeryBestXYZ();
         CRoadPos tempRP;
         CLane tempLane;
-        auto res = CHcsmCollection::m_sOwnshipPath.Travel(300,m_ownVehRoadPos,tempRP,tempLane);
+        auto res = m_pRootColl->m_ctx.m_sOwnshipPath.Travel(300,m_ownVehRoadPos,tempRP,tempLane);
         if (res > -1){
             CVector3D tpos(tempRP.GetBestXYZ()-ownpos);
             tpos.Normalize();
@@ -3676,13 +3680,13 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
         }
         pos.Normalize();
         CVector3D oldPos(
-            CHcsmCollection::m_sSmoothForwardRoadVector[0],
-            CHcsmCollection::m_sSmoothForwardRoadVector[1],
+            m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[0],
+            m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[1],
             0);
         oldPos = oldPos *0.99 + pos*0.01;
         oldPos.Normalize();
-        CHcsmCollection::m_sSmoothForwardRoadVector[0] = oldPos.m_i;
-        CHcsmCollection::m_sSmoothForwardRoadVector[1] = oldPos.m_j;
+        m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[0] = oldPos.m_i;
+        m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[1] = oldPos.m_j;
     }else{
         if (m_ownVehRoadPos.IsValid()){
             CVector3D pos = m_ownVehRoadPos.GetTangentInterpolated(true)*6.0;
@@ -3697,13 +3701,13 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
             }
             pos.Normalize();
             CVector3D oldPos(
-                CHcsmCollection::m_sSmoothForwardRoadVector[0],
-                CHcsmCollection::m_sSmoothForwardRoadVector[1],
+                m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[0],
+                m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[1],
                 0);
             oldPos = oldPos * 0.99 + pos*0.01;
             oldPos.Normalize();
-            CHcsmCollection::m_sSmoothForwardRoadVector[0] = oldPos.m_i;
-            CHcsmCollection::m_sSmoothForwardRoadVector[1] = oldPos.m_j;
+            m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[0] = oldPos.m_i;
+            m_pRootColl->m_ctx.m_sSmoothForwardRoadVector[1] = oldPos.m_j;
         }else{
             //CHcsmCollection::m_sownvhe
         }
@@ -3711,8 +3715,8 @@ CScenarioControl::ComputeOwnVehInfo( const CPoint3D& cOwnVehCartPos )
 
 	m_ownVehRoadPos.GetRoadMarking(leftmarking,rightmarking, rightAtrib, leftAtrib);
 
-	CHcsmCollection::m_sLaneMarkingInfo[0] = leftmarking;
-	CHcsmCollection::m_sLaneMarkingInfo[1] = rightmarking;
+	m_pRootColl->m_ctx.m_sLaneMarkingInfo[0] = leftmarking;
+	m_pRootColl->m_ctx.m_sLaneMarkingInfo[1] = rightmarking;
 }
 /////////////////////////////////////////////////////////////////////////////////////////
 ///\brief
@@ -14,6 +14,7 @@
 #pragma once
 #include <cvedpub.h>
 #include "hcsmcollection.h"
+#include "warningbatch.h"
 #include <hcsmspec.h>
 #include <snoparse.h>
 #include <filename.h>
@@ -215,7 +216,7 @@ public:
 				const float relHeading,
 				const double ownVehVel
 				);
-	static bool ObjInFrontCone(
+	bool ObjInFrontCone(
 				const CDynaParams& dynaParams,
 				const CPoint3D rotObjPos,
 				const float relHeading,
@@ -224,7 +225,7 @@ public:
 				double& bumperToBumperDist,
 				double& angleInCone
 				);
-	static bool ObjInFrontCone(
+	bool ObjInFrontCone(
 				const CSolObjVehicle* cpSolObjVeh,
 				const CPoint3D rotObjPos,
 				const float relHeading,
@@ -233,7 +234,7 @@ public:
 				double& bumperToBumperDist,
 				double& angleInCone
 				);
-	static int FCW(
+	int FCW(
 				const double ownVehVel,
 				float* pFcwInfo,
 				float frequencyOfExecution
@@ -276,6 +277,7 @@ private:
 	float	m_sirenSpeed;			//<M/S when Driver is over this speed, we set HCSM::SirenEffect
 
 	int m_prevLdwFrame;
+	CWarningBatch m_warnBatch;		// scratch for the collision warnings
 	ELdwStatus m_prevLdwStatus;
 
 	bool ProcessFile(
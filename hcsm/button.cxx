@@ -21,7 +21,7 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-CHcsmBtn::CHcsmBtn( CHcsmCollection *pRootCollection, string name ):
+CHcsmBtn::CHcsmBtn( CHcsmCollection *pRootCollection, const string& name ):
 	CHcsmCommunicate( pRootCollection, name )
 {
 }
@@ -69,7 +69,7 @@ CHcsmBtn::~CHcsmBtn()
 const string& CHcsmBtn::GetName() const
 {
 
-	return m_name;
+	return *m_pName;
 
 }
 
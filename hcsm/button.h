@@ -44,7 +44,7 @@ using namespace std;
 class CHcsmBtn : public CHcsmCommunicate
 {
 public:
-	CHcsmBtn( CHcsmCollection*, string );
+	CHcsmBtn( CHcsmCollection*, const string& );
 	CHcsmBtn( const CHcsmBtn& );
 	CHcsmBtn& operator=( const CHcsmBtn& );
 	virtual ~CHcsmBtn();
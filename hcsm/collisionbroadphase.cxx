@@ -0,0 +1,324 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: collisionbroadphase.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The implementation of the CCollisionBroadphase class.
+ *
+ ****************************************************************************/
+
+#include "collisionbroadphase.h"
+#include <math.h>
+#include <algorithm>
+
+using namespace CVED;
+
+// Objects further apart than this vertically never collide (feet)
+const double cBROADPHASE_MAX_DZ = 10.0;
+
+CCollisionBroadphase::CCollisionBroadphase( double cellSize )
+{
+	m_cellSize = cellSize;
+	m_refreshCount = 0;
+}
+
+CCollisionBroadphase::~CCollisionBroadphase() {}
+
+long long
+CCollisionBroadphase::CellKey( int cx, int cy )
+{
+	return (long long) ( ( (unsigned long long) (unsigned int) cx << 32 ) | (unsigned int) cy );
+}
+
+int
+CCollisionBroadphase::CellOf( double v ) const
+{
+	return (int) floor( v / m_cellSize );
+}
+
+void
+CCollisionBroadphase::File( int slot )
+{
+	const TEntry& e = m_entries[slot];
+	int cx, cy;
+	for( cx = e.cx0; cx <= e.cx1; cx++ )
+	{
+		for( cy = e.cy0; cy <= e.cy1; cy++ )
+		{
+			m_grid[CellKey( cx, cy )].push_back( slot );
+		}
+	}
+}
+
+void
+CCollisionBroadphase::Unfile( int slot )
+{
+	const TEntry& e = m_entries[slot];
+	int cx, cy;
+	for( cx = e.cx0; cx <= e.cx1; cx++ )
+	{
+		for( cy = e.cy0; cy <= e.cy1; cy++ )
+		{
+			unordered_map<long long, vector<int> >::iterator cell;
+			cell = m_grid.find( CellKey( cx, cy ) );
+			if( cell == m_grid.end() )  continue;
+
+			vector<int>& list = cell->second;
+			vector<int>::iterator i = find( list.begin(), list.end(), slot );
+			if( i != list.end() )
+			{
+				*i = list.back();
+				list.pop_back();
+			}
+			if( list.empty() )  m_grid.erase( cell );
+		}
+	}
+}
+
+void
+CCollisionBroadphase::Remove( int slot )
+{
+	int last = (int) m_entries.size() - 1;
+
+	Unfile( slot );
+	m_slotOfObj[m_entries[slot].objId] = -1;
+	if( slot != last )
+	{
+		// move the last entry into the hole
+		Unfile( last );
+		m_entries[slot] = m_entries[last];
+		m_slotOfObj[m_entries[slot].objId] = slot;
+		File( slot );
+	}
+	m_entries.pop_back();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Reads the footprints of the objects from CVED.
+//
+// Remarks: Objects that are no longer reported by CVED are dropped.  An
+//  object is only refiled in the grid when the range of cells its
+//  bounding box touches changes.
+//
+// Arguments:
+//  cved - the CVED instance
+//  mask - the types of the objects to consider
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CCollisionBroadphase::Refresh( CCved& cved, const CObjTypeMask& mask )
+{
+	m_refreshCount++;
+
+	m_ids.clear();
+	cved.GetAllObjs( m_ids, mask );
+
+	vector<int>::const_iterator i;
+	for( i = m_ids.begin(); i != m_ids.end(); i++ )
+	{
+		int objId = *i;
+		if( objId < 0 )  continue;
+
+		CPoint3D  pos = cved.GetObjPos( objId );
+		CVector3D tan = cved.GetObjTan( objId );
+		double halfLength = cved.GetObjLength( objId ) * 0.5;
+		double halfWidth  = cved.GetObjWidth( objId ) * 0.5;
+
+		double tx = tan.m_i;
+		double ty = tan.m_j;
+		double norm = sqrt( tx * tx + ty * ty );
+		if( norm > 1.0e-9 )
+		{
+			tx /= norm;
+			ty /= norm;
+		}
+		else
+		{
+			tx = 1.0;
+			ty = 0.0;
+		}
+
+		if( objId >= (int) m_slotOfObj.size() )  m_slotOfObj.resize( objId + 1, -1 );
+		int slot = m_slotOfObj[objId];
+		bool filed = slot >= 0;
+		if( !filed )
+		{
+			slot = (int) m_entries.size();
+			m_entries.push_back( TEntry() );
+			m_entries[slot].objId = objId;
+			m_slotOfObj[objId] = slot;
+		}
+
+		TEntry& e = m_entries[slot];
+		e.x  = pos.m_x;
+		e.y  = pos.m_y;
+		e.z  = pos.m_z;
+		e.ax = tx * halfLength;
+		e.ay = ty * halfLength;
+		e.bx = -ty * halfWidth;
+		e.by = tx * halfWidth;
+		e.seenFrame = m_refreshCount;
+
+		double extX = fabs( e.ax ) + fabs( e.bx );
+		double extY = fabs( e.ay ) + fabs( e.by );
+		e.minX = e.x - extX;
+		e.maxX = e.x + extX;
+		e.minY = e.y - extY;
+		e.maxY = e.y + extY;
+
+		int cx0 = CellOf( e.minX );
+		int cy0 = CellOf( e.minY );
+		int cx1 = CellOf( e.maxX );
+		int cy1 = CellOf( e.maxY );
+		bool moved = !filed || 
+			cx0 != e.cx0 || cy0 != e.cy0 || cx1 != e.cx1 || cy1 != e.cy1;
+		if( moved )
+		{
+			if( filed )  Unfile( slot );
+			e.cx0 = cx0;
+			e.cy0 = cy0;
+			e.cx1 = cx1;
+			e.cy1 = cy1;
+			File( slot );
+		}
+	}
+
+	int slot;
+	for( slot = (int) m_entries.size() - 1; slot >= 0; slot-- )
+	{
+		if( m_entries[slot].seenFrame != m_refreshCount )  Remove( slot );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: The narrow phase; checks if two footprints overlap.
+//
+// Remarks: Separating axis test over the axes of both rectangles.  The
+//  half length and half width vectors serve as the axes; they don't need
+//  to be unit vectors since both sides of each comparison scale alike.
+//
+/////////////////////////////////////////////////////////////////////////////
+bool
+CCollisionBroadphase::Overlap( const TEntry& e1, const TEntry& e2 ) const
+{
+	if( fabs( e1.z - e2.z ) > cBROADPHASE_MAX_DZ )  return false;
+	if( e1.maxX < e2.minX || e2.maxX < e1.minX )  return false;
+	if( e1.maxY < e2.minY || e2.maxY < e1.minY )  return false;
+
+	double dx = e2.x - e1.x;
+	double dy = e2.y - e1.y;
+	const double axes[4][2] = {
+		{ e1.ax, e1.ay }, { e1.bx, e1.by }, { e2.ax, e2.ay }, { e2.bx, e2.by }
+	};
+
+	int i;
+	for( i = 0; i < 4; i++ )
+	{
+		double ux = axes[i][0];
+		double uy = axes[i][1];
+		double r1 = fabs( e1.ax * ux + e1.ay * uy ) + fabs( e1.bx * ux + e1.by * uy );
+		double r2 = fabs( e2.ax * ux + e2.ay * uy ) + fabs( e2.bx * ux + e2.by * uy );
+		if( fabs( dx * ux + dy * uy ) > r1 + r2 )  return false;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Finds all the pairs of objects that collide.
+//
+// Remarks: A pair that shares several cells is only examined in one of
+//  them, the cell at the lower left corner of the intersection of their
+//  cell ranges.  The pairs are returned sorted.
+//
+// Arguments:
+//  pairs - (output) the colliding pairs, as of the last Refresh
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CCollisionBroadphase::FindPairs( vector<TPair>& pairs ) const
+{
+	pairs.clear();
+
+	unordered_map<long long, vector<int> >::const_iterator cell;
+	for( cell = m_grid.begin(); cell != m_grid.end(); cell++ )
+	{
+		const vector<int>& list = cell->second;
+		vector<int>::size_type i, j;
+		for( i = 0; i < list.size(); i++ )
+		{
+			const TEntry& e1 = m_entries[list[i]];
+			for( j = i + 1; j < list.size(); j++ )
+			{
+				const TEntry& e2 = m_entries[list[j]];
+
+				long long owner = CellKey( max( e1.cx0, e2.cx0 ), max( e1.cy0, e2.cy0 ) );
+				if( owner != cell->first )  continue;
+				if( !Overlap( e1, e2 ) )  continue;
+
+				TPair p;
+				p.obj1 = min( e1.objId, e2.objId );
+				p.obj2 = max( e1.objId, e2.objId );
+				pairs.push_back( p );
+			}
+		}
+	}
+
+	sort( pairs.begin(), pairs.end(), []( const TPair& p1, const TPair& p2 ) {
+		return p1.obj1 < p2.obj1 || ( p1.obj1 == p2.obj1 && p1.obj2 < p2.obj2 );
+	} );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Finds the objects that collide with the specified one.
+//
+// Arguments:
+//  objId - the CVED id of the object
+//  objs  - (output) the ids of the colliding objects, sorted; empty if
+//          the object wasn't seen by the last Refresh
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CCollisionBroadphase::FindCollisions( int objId, vector<int>& objs ) const
+{
+	objs.clear();
+	if( objId < 0 || objId >= (int) m_slotOfObj.size() )  return;
+
+	int slot = m_slotOfObj[objId];
+	if( slot < 0 )  return;
+
+	const TEntry& e = m_entries[slot];
+	int cx, cy;
+	for( cx = e.cx0; cx <= e.cx1; cx++ )
+	{
+		for( cy = e.cy0; cy <= e.cy1; cy++ )
+		{
+			unordered_map<long long, vector<int> >::const_iterator cell;
+			cell = m_grid.find( CellKey( cx, cy ) );
+			if( cell == m_grid.end() )  continue;
+
+			vector<int>::const_iterator i;
+			for( i = cell->second.begin(); i != cell->second.end(); i++ )
+			{
+				if( *i == slot )  continue;
+
+				const TEntry& other = m_entries[*i];
+				if( Overlap( e, other ) )  objs.push_back( other.objId );
+			}
+		}
+	}
+
+	sort( objs.begin(), objs.end() );
+	objs.erase( unique( objs.begin(), objs.end() ), objs.end() );
+}
@@ -0,0 +1,85 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: collisionbroadphase.h,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The header file for the CCollisionBroadphase class, which
+ *   finds the pairs of CVED objects whose footprints overlap.
+ *
+ * Every object is represented by its footprint, the oriented rectangle
+ * given by its position, tangent, length and width.  The footprints are
+ * filed in a uniform grid under every cell their axis aligned bounding
+ * box touches.  Refresh reads the objects from CVED once per frame and
+ * only refiles the objects whose cell range changed, so objects that
+ * don't move, or move within their cells, cost a few comparisons.  Pairs
+ * are then only considered if they share a cell and their bounding boxes
+ * overlap, and only those pairs get the oriented rectangle test.
+ *
+ * The test is two dimensional; objects whose positions differ in height
+ * by more than cBROADPHASE_MAX_DZ (e.g. on a bridge and under it) are
+ * not considered colliding.
+ *
+ ****************************************************************************/
+
+#ifndef _COLLISIONBROADPHASE_H_
+#define _COLLISIONBROADPHASE_H_
+
+#include <cvedpub.h>
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+class CCollisionBroadphase
+{
+public:
+	struct TPair {
+		int obj1;					// the smaller of the two CVED ids
+		int obj2;
+	};
+
+	CCollisionBroadphase( double cellSize = 64.0 );
+	~CCollisionBroadphase();
+
+	void Refresh( CVED::CCved& cved, const CVED::CObjTypeMask& mask );
+	void FindPairs( vector<TPair>& pairs ) const;
+	void FindCollisions( int objId, vector<int>& objs ) const;
+	int  NumObjs( void ) const { return (int) m_entries.size(); }
+
+private:
+	CCollisionBroadphase( const CCollisionBroadphase& );
+	CCollisionBroadphase& operator=( const CCollisionBroadphase& );
+
+	struct TEntry {
+		int     objId;
+		double  x, y, z;			// center of the footprint
+		double  ax, ay;				// half length along the tangent
+		double  bx, by;				// half width along the lateral
+		double  minX, minY, maxX, maxY;
+		int     cx0, cy0, cx1, cy1;	// range of cells the box touches
+		int     seenFrame;
+	};
+
+	static long long CellKey( int cx, int cy );
+	int  CellOf( double v ) const;
+	void File( int slot );
+	void Unfile( int slot );
+	void Remove( int slot );
+	bool Overlap( const TEntry& e1, const TEntry& e2 ) const;
+
+	double                                  m_cellSize;
+	vector<TEntry>                          m_entries;
+	vector<int>                             m_slotOfObj;	// by CVED id, -1 if none
+	unordered_map<long long, vector<int> >  m_grid;
+	int                                     m_refreshCount;
+	vector<int>                             m_ids;			// scratch
+};
+
+#endif // _COLLISIONBROADPHASE_H_
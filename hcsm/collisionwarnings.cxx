@@ -72,14 +72,14 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 	//
 	// Reset the sensor info cell.
 	//
-	CHcsmCollection::m_sSensorInfo[0] = -1.0f;
+	m_pRootColl->m_ctx.m_sSensorInfo[0] = -1.0f;
 	// these are being set since the titler is not able to look at 
 	// element 0 to see if the values in elements 1 and 4 are valid.
-	CHcsmCollection::m_sSensorInfo[1] = 0.0f;
-	CHcsmCollection::m_sSensorInfo[3] = 0.0f;
+	m_pRootColl->m_ctx.m_sSensorInfo[1] = 0.0f;
+	m_pRootColl->m_ctx.m_sSensorInfo[3] = 0.0f;
 
 	const double cAccLeadVehThresholdVel = 8.0 * cMPH_TO_MS;
-	const float cMaxRange = CHcsmCollection::m_sSensor_Config[eSENSOR_INDEX_MAX_RANGE];
+	const float cMaxRange = m_pRootColl->m_ctx.m_sSensor_Config[eSENSOR_INDEX_MAX_RANGE];
 	const float cMaxSqrdRng = cMaxRange * cMaxRange; // (ft)
 	bool leftWarn = 0, rightWarn = 0;
 	timeToWarn = 0;
@@ -129,7 +129,7 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 	int i;
 	if( printStuff )
 	{
-		fprintf( stdout, "numObj=%d  ", CHcsmCollection::m_sDynObjDataSize );
+		fprintf( stdout, "numObj=%d  ", m_pRootColl->m_ctx.m_sDynObjDataSize );
 	}
 
 	bool sensorObjectWritten = false;
@@ -150,137 +150,121 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 	if ( rightWarnOn_ct  >= 30000 ) rightWarnOn_ct  = 30000;
 
 
-	// There are three ways to prematurely exit the loop
-	//   1.  the cved ID from the array is not a valid object
-    //   x#2 is not true, it is sorted by type then distance, 
-	//   2.  the range is beyond a specified threshold (array is sorted by range)
-	//   3.  the cAlgorithm is 0, indicating no algorithm is used
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	// Transform all the objects into the own vehicle frame and run the
+	// range and heading checks in one pass, then run the algorithm's
+	// geometric tests on all the vehicles that passed at once.  The
+	// results are then visited in the order of the array, which is
+	// sorted by type then distance, so the modes that only care about
+	// one object still get the same one.  Nothing is done if cAlgorithm
+	// is 0, indicating no algorithm is used.
+	if( cAlgorithm != 0 )
 	{
-		// check for valid cved object
-		int cvedId = CHcsmCollection::m_sDynObjData.cvedId[i];
-		if( !m_pCved->IsObjValid( cvedId ) ) continue;
-		if( printStuff )
+		m_warnBatch.Prefilter(
+					cOwnVehCartPos,
+					ownVehHeading,
+					ownVehVel,
+					m_pRootColl->m_ctx.m_sDynObjData.pos,
+					m_pRootColl->m_ctx.m_sDynObjData.heading,
+					m_pRootColl->m_ctx.m_sDynObjData.vel,
+					m_pRootColl->m_ctx.m_sDynObjDataSize,
+					cMaxSqrdRng
+					);
+
+		for( i = 0; i < m_pRootColl->m_ctx.m_sDynObjDataSize; i++ )
 		{
-			fprintf( stdout, "--%d ", cvedId);
+			if( !m_warnBatch.Passed( i ) ) continue;
+
+			// check for valid cved object
+			int cvedId = m_pRootColl->m_ctx.m_sDynObjData.cvedId[i];
+			if( !m_pCved->IsObjValid( cvedId ) ) continue;
+
+			// get dimensions of obj from the SOL.
+			int solId = m_pRootColl->m_ctx.m_sDynObjData.solId[i];
+			const CSolObj* cpSolObj = m_pCved->GetSol().GetObj( solId );
+			if (!cpSolObj) //if we can't get a sol obj, we can't consider the obj
+				continue;
+			const CSolObjVehicle* cpSolObjVeh = dynamic_cast<const CSolObjVehicle*> ( cpSolObj );
+			if (!cpSolObjVeh) //our algorithm only takes vehicles into account
+				continue;
+
+			if( cAlgorithm == 6 )
+			{
+				double halfLength = cpSolObjVeh->GetLength() / 2.0;
+				m_warnBatch.AddCand( i, halfLength, halfLength, cpSolObjVeh->GetWidth() / 2.0 );
+			}
+			else
+			{
+				const CDynaParams& dynaParams = cpSolObjVeh->GetDynaParams();
+				m_warnBatch.AddCand(
+							i,
+							dynaParams.m_WheelBaseForw,
+							dynaParams.m_WheelBaseRear,
+							dynaParams.m_WheelTrack / 2.0
+							);
+			}
 		}
-		
-		// check the range between ADO's and driver obj.
-		CPoint3D objPos;
-		objPos.m_x = CHcsmCollection::m_sDynObjData.pos[3*i];
-		objPos.m_y = CHcsmCollection::m_sDynObjData.pos[3*i + 1];
-		objPos.m_z = CHcsmCollection::m_sDynObjData.pos[3*i + 2];
-		float squaredDist = (float)cOwnVehCartPos.DistSq( objPos );
-		//->this is not tr
-        if( squaredDist > cMaxSqrdRng ) continue;
-
-		// check the algorithm select switch
-		if( cAlgorithm == 0 ) break;
-
-		//
-		// All checks passed.  Now do work
-		//
-
-		// get object data
-		float     objVel = CHcsmCollection::m_sDynObjData.vel[i];
-		float objHeading = CHcsmCollection::m_sDynObjData.heading[i];
-		int        solId = CHcsmCollection::m_sDynObjData.solId[i];
-
-		// calculate heading of obj relative to ownVeh
-		float relHeading = objHeading - ownVehHeading;
-		if ( relHeading > M_PI  ) relHeading -= 2.0f * (float) M_PI;
- 		if ( relHeading < -M_PI ) relHeading += 2.0f * (float) M_PI;
-
-		// if relative heading is greater than pi/4, no warning is given
-		if( printStuff )
+
+		const float cConeAngle = m_pRootColl->m_ctx.m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE]; // degrees
+		switch ( cAlgorithm )
 		{
-			fprintf( stdout, "%.1f", fabs(relHeading));
+			case 1:
+				m_warnBatch.EvalTrwcas( ownVehVel, false );
+				break;
+			case 2:
+				m_warnBatch.EvalTrwcas( ownVehVel, true );
+				break;
+			case 3:
+				m_warnBatch.EvalLpws( ownVehVel );
+				break;
+			case 5:
+				m_warnBatch.EvalCone( cConeAngle, krvAvg, true );
+				break;
+			case 6:
+				m_warnBatch.EvalCone( cConeAngle, krvAvg, false );
+				break;
 		}
-		if ( fabs(relHeading) > M_PI_4 ) continue;
+	}
+
+	int numCands = cAlgorithm != 0 ? m_warnBatch.NumCands() : 0;
+	int cand;
+	for( cand = 0; cand < numCands; cand++ )
+	{
+		i = m_warnBatch.CandObj( cand );
+		int cvedId = m_pRootColl->m_ctx.m_sDynObjData.cvedId[i];
 		if( printStuff )
 		{
-			fprintf( stdout, "+" );
+			fprintf( stdout, "--%d ", cvedId);
 		}
 
+		CPoint3D objPos;
+		objPos.m_x = m_pRootColl->m_ctx.m_sDynObjData.pos[3*i];
+		objPos.m_y = m_pRootColl->m_ctx.m_sDynObjData.pos[3*i + 1];
+		objPos.m_z = m_pRootColl->m_ctx.m_sDynObjData.pos[3*i + 2];
+		float     objVel = m_pRootColl->m_ctx.m_sDynObjData.vel[i];
+		float distToObj = sqrt( m_warnBatch.SqrdDist( i ) );
+
 		// closing velocity > 0 if obj is faster than ownVeh
-		float closingVelocity = ( objVel - (float) ownVehVel ) * (float) cMETER_TO_FEET;
-
-		// subtract ownVehCartPos and rotate system to a heading of zero
-		CTransMat rotMatrix, transMatrix, fwdShift, bakShift;
-		transMatrix.Trans( -cOwnVehCartPos.m_x, -cOwnVehCartPos.m_y, -cOwnVehCartPos.m_z );
-		fwdShift.Trans( closingVelocity, 0.0f, 0.0f );
-		//bakShift.Trans( 0.0f, -closingVelocity, 0.0f );
-		CPoint3D transObjPos = transMatrix.Apply( objPos );
-        rotMatrix.RotZ( -ownVehHeading );
-		CPoint3D rotObjPos = rotMatrix.Apply( transObjPos );
-
-		// get dynamics parameters of obj from the SOL.
-		const CSolObj* cpSolObj = m_pCved->GetSol().GetObj( solId );
-		if (!cpSolObj) //if we can't get a sol obj, we can't consider the obj
-			continue;
-		const CSolObjVehicle* cpSolObjVeh = dynamic_cast<const CSolObjVehicle*> ( cpSolObj );
-		if (!cpSolObjVeh) //our algorithm only takes vehicles into account
-			continue;
-		const CDynaParams& dynaParams = cpSolObjVeh->GetDynaParams();
-		
-		// call one collision avoidance warning algorithm
-		float distToObj = sqrt( squaredDist );
+		float closingVelocity = m_warnBatch.ClosingVel( i );
+
+		// collect the result of the collision avoidance warning algorithm
 		int warning = 0;
 		int ttw = 0;
 		switch ( cAlgorithm )
 		{
-			case 0:
-				warning = 0; // no collision avoidance warning used
-				ttw = 0; // no time to warn since no collision avoidance warning used
-				break;
 			case 1:
-				ttw = TRWCAS( dynaParams, fwdShift.Apply(rotObjPos), relHeading, distToObj, ownVehVel, closingVelocity, 0 );
-				warning = TRWCAS( dynaParams, rotObjPos, relHeading, distToObj, ownVehVel, closingVelocity, 0 );
-				break;
 			case 2:
-				ttw = TRWCAS( dynaParams, fwdShift.Apply(rotObjPos), relHeading, distToObj, ownVehVel, closingVelocity, 1 );
-				warning = TRWCAS( dynaParams, rotObjPos, relHeading, distToObj, ownVehVel, closingVelocity, 1 );
-				break;
 			case 3:
-				ttw = LPWS( dynaParams, fwdShift.Apply(rotObjPos), relHeading, ownVehVel );
-				warning = LPWS( dynaParams, rotObjPos, relHeading, ownVehVel );
+				ttw = m_warnBatch.TimeToWarn( cand );
+				warning = m_warnBatch.Warning( cand );
 				break;
 			case 5:
 				if( objVel > cAccLeadVehThresholdVel ) 
 				{
-					double bumperToBumperDist;
-					double angleInCone;
-
-					ttw = 0;
-					warning = 0;
-					if( printStuff )
-					{
-						fprintf( stdout, "=  " );
-					}
-					foundObj = ObjInFrontCone( 
-									dynaParams, 
-									rotObjPos, 
-									relHeading, 
-									krvAvg, 
-									cMaxRange, 
-									bumperToBumperDist, 
-									angleInCone 
-									);
-
-					if( printStuff )
-					{
-						fprintf( 
-							stdout, 
-							"relPos(%.4f %.4f %.4f) relHeading %.4f %d  ", 
-							rotObjPos.m_x, rotObjPos.m_y, rotObjPos.m_z, relHeading, foundObj
-							);
-					}
+					foundObj = m_warnBatch.InCone( cand );
 					if( foundObj )
 					{
-						CPoint3D leadVehPos = m_pCved->GetObjPos( cvedId  );
-						double leadObjLength = m_pCved->GetObjLength( cvedId );
-						double cabLength = m_cpCabSolObj->GetLength();
-						double adjustDist = ( leadObjLength * 0.5f ) + ( cabLength * 0.5f );
+						double bumperToBumperDist = m_warnBatch.BumperToBumperDist( cand );
+						double angleInCone = m_warnBatch.AngleInCone( cand );
 
 						accRegion = 1;
 						if( cvedId == cvedIdMemory ) 
@@ -290,24 +274,24 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 							objVelMemory = objVel;
 							angleMemory = (float)angleInCone;
 						}
-						CHcsmCollection::m_sSensorInfo[0] = (float) cvedId;
-						CHcsmCollection::m_sSensorInfo[1] = (float) distToObj;
-						CHcsmCollection::m_sSensorInfo[2] = (float) ( bumperToBumperDist / ownVehVel );
-						CHcsmCollection::m_sSensorInfo[3] = (float) bumperToBumperDist;
+						m_pRootColl->m_ctx.m_sSensorInfo[0] = (float) cvedId;
+						m_pRootColl->m_ctx.m_sSensorInfo[1] = (float) distToObj;
+						m_pRootColl->m_ctx.m_sSensorInfo[2] = (float) ( bumperToBumperDist / ownVehVel );
+						m_pRootColl->m_ctx.m_sSensorInfo[3] = (float) bumperToBumperDist;
 						bool calcTtc = objVel < ownVehVel;
 						if( calcTtc )
 						{
-							CHcsmCollection::m_sSensorInfo[4] = (float) ( bumperToBumperDist / -closingVelocity );
+							m_pRootColl->m_ctx.m_sSensorInfo[4] = (float) ( bumperToBumperDist / -closingVelocity );
 						}
 						else
 						{
-							CHcsmCollection::m_sSensorInfo[4] = 10000.0f;
+							m_pRootColl->m_ctx.m_sSensorInfo[4] = 10000.0f;
 						}
-						CHcsmCollection::m_sSensorInfo[5] = (float) objVel;
-						CHcsmCollection::m_sSensorInfo[6] = (float) objPos.m_x;
-						CHcsmCollection::m_sSensorInfo[7] = (float) objPos.m_y;
-						CHcsmCollection::m_sSensorInfo[8] = (float) objPos.m_z;
-						CHcsmCollection::m_sSensorInfo[9] = (float) angleInCone;
+						m_pRootColl->m_ctx.m_sSensorInfo[5] = (float) objVel;
+						m_pRootColl->m_ctx.m_sSensorInfo[6] = (float) objPos.m_x;
+						m_pRootColl->m_ctx.m_sSensorInfo[7] = (float) objPos.m_y;
+						m_pRootColl->m_ctx.m_sSensorInfo[8] = (float) objPos.m_z;
+						m_pRootColl->m_ctx.m_sSensorInfo[9] = (float) angleInCone;
 
 						if( printStuff )
 						{
@@ -317,53 +301,17 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 						sensorObjectWritten = true;
 					}
 				}
-				else
-				{
-					ttw = 0;
-					warning = 0;
-				}
 				break;
 			case 6 :
 				{
-					ttw = 0;
-					warning = 0;
-
-					double bumperToBumperDist;
-					double angleInCone;
+					foundObj = m_warnBatch.InCone( cand );
 
-					ttw = 0;
-					warning = 0;
-					if( printStuff )
-					{
-						fprintf( stdout, "=  " );
-					}
-					foundObj = ObjInFrontCone( 
-										cpSolObjVeh, 
-										rotObjPos, 
-										relHeading, 
-										krvAvg, 
-										cMaxRange, 
-										bumperToBumperDist, 
-										angleInCone 
-										);
-
-					if( printStuff )
-					{
-						fprintf( 
-							stdout, 
-							"relPos(%.4f %.4f %.4f) objHeading %.4f ownVehHeading %.4f %d  ", 
-							rotObjPos.m_x, rotObjPos.m_y, rotObjPos.m_z, objHeading, ownVehHeading, foundObj
-							);
-					}
 					pFcwInfo[0] = (float) 0.0;
 					if( foundObj )
 					{
-						CPoint3D leadVehPos = m_pCved->GetObjPos( cvedId  );
-						double leadObjLength = m_pCved->GetObjLength( cvedId );
-						double cabLength = m_cpCabSolObj->GetLength();
-						double adjustDist = ( leadObjLength * 0.5f ) + ( cabLength * 0.5f );
+						double bumperToBumperDist = m_warnBatch.BumperToBumperDist( cand );
+						double angleInCone = m_warnBatch.AngleInCone( cand );
 
-//						accRegion = 1;
 						if (cvedId == cvedIdMemory)
 						{
 							rangeMemory = (float)bumperToBumperDist;
@@ -385,7 +333,7 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 
 						if( ttc < 0.0 ) ttc = 0.0;
 						double ttcMax = 2.2;
-						if( CHcsmCollection::m_sFCW_Severity == 1 )   ttcMax = 3.6;
+						if( m_pRootColl->m_ctx.m_sFCW_Severity == 1 )   ttcMax = 3.6;
 						if( ttc >= 0.0 && ttc < ttcMax )
 						{
 							if( printStuff )
@@ -452,25 +400,25 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 		if( printStuff ) 
 			fprintf(stdout,"No Object");
 		accRegion = 2;
-		CHcsmCollection::m_sSensorInfo[0] = -1.0f;
-		CHcsmCollection::m_sSensorInfo[1] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[2] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[3] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[4] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[5] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[6] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[7] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[8] = 0.0f;
-		CHcsmCollection::m_sSensorInfo[9] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[0] = -1.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[1] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[2] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[3] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[4] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[5] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[6] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[7] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[8] = 0.0f;
+		m_pRootColl->m_ctx.m_sSensorInfo[9] = 0.0f;
 	}
 
-	if (cvedIdPrev != CHcsmCollection::m_sSensorInfo[0]) {
-		if (cvedIdMemory == CHcsmCollection::m_sSensorInfo[0]) {
+	if (cvedIdPrev != m_pRootColl->m_ctx.m_sSensorInfo[0]) {
+		if (cvedIdMemory == m_pRootColl->m_ctx.m_sSensorInfo[0]) {
 			//picked up a known vehicle.  Pick it up immediately
 			accOn_ct = cAccLagOnCount;
 			accOff_ct = accOn_ct;
 		}
-		else if (CHcsmCollection::m_sSensorInfo[0] <= 0) {
+		else if (m_pRootColl->m_ctx.m_sSensorInfo[0] <= 0) {
 			//lost vehicle. start lag to lose vehicle
 			accOff_ct = 0;
 		}
@@ -483,57 +431,57 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 
 	if (accOff_ct == cAccLagOffCount && accOff_ct <=  accOn_ct) 
 	{
-		if (CHcsmCollection::m_sSensorInfo[0]>0) cvedIdMemory = (int)CHcsmCollection::m_sSensorInfo[0];
+		if (m_pRootColl->m_ctx.m_sSensorInfo[0]>0) cvedIdMemory = (int)m_pRootColl->m_ctx.m_sSensorInfo[0];
 	}
 	if (accOff_ct == 6*cAccLagOffCount && accOff_ct <=  accOn_ct) 
 	{
-		cvedIdMemory = (int)CHcsmCollection::m_sSensorInfo[0];
+		cvedIdMemory = (int)m_pRootColl->m_ctx.m_sSensorInfo[0];
 	}
 	if ( accOn_ct == cAccLagOnCount && accOn_ct <= accOff_ct) 
 	{
-		cvedIdMemory = (int)CHcsmCollection::m_sSensorInfo[0];
+		cvedIdMemory = (int)m_pRootColl->m_ctx.m_sSensorInfo[0];
 	}
 
-	cvedIdPrev = (int)CHcsmCollection::m_sSensorInfo[0];
+	cvedIdPrev = (int)m_pRootColl->m_ctx.m_sSensorInfo[0];
 
-	if (cvedIdMemory != CHcsmCollection::m_sSensorInfo[0]) 
+	if (cvedIdMemory != m_pRootColl->m_ctx.m_sSensorInfo[0]) 
 	{
 		if (cvedIdMemory > 0 && accOff_ct < cAccLagOffCount) 
 		{
 			accRegion = 3;
 			rangeMemory += rangerateMemory/frequencyOfExecution;
-			CHcsmCollection::m_sSensorInfo[0] = (float) cvedIdMemory;
-			CHcsmCollection::m_sSensorInfo[1] = (float) 0.0;
-			CHcsmCollection::m_sSensorInfo[2] = (float) ( rangeMemory / ownVehVel );
-			CHcsmCollection::m_sSensorInfo[3] = (float) rangeMemory;
+			m_pRootColl->m_ctx.m_sSensorInfo[0] = (float) cvedIdMemory;
+			m_pRootColl->m_ctx.m_sSensorInfo[1] = (float) 0.0;
+			m_pRootColl->m_ctx.m_sSensorInfo[2] = (float) ( rangeMemory / ownVehVel );
+			m_pRootColl->m_ctx.m_sSensorInfo[3] = (float) rangeMemory;
 			bool calcTtc = rangerateMemory < 0.0;
 			if( calcTtc )
 			{
-				CHcsmCollection::m_sSensorInfo[4] = (float) ( rangeMemory / -rangerateMemory );
+				m_pRootColl->m_ctx.m_sSensorInfo[4] = (float) ( rangeMemory / -rangerateMemory );
 			}
 			else
 			{
-				CHcsmCollection::m_sSensorInfo[4] = 10000.0f;
+				m_pRootColl->m_ctx.m_sSensorInfo[4] = 10000.0f;
 			}
-			CHcsmCollection::m_sSensorInfo[5] = (float) objVelMemory;
-			CHcsmCollection::m_sSensorInfo[6] = (float) 0.0;
-			CHcsmCollection::m_sSensorInfo[7] = (float) 0.0;
-			CHcsmCollection::m_sSensorInfo[8] = (float) 0.0;
-			CHcsmCollection::m_sSensorInfo[9] = (float) angleMemory;
+			m_pRootColl->m_ctx.m_sSensorInfo[5] = (float) objVelMemory;
+			m_pRootColl->m_ctx.m_sSensorInfo[6] = (float) 0.0;
+			m_pRootColl->m_ctx.m_sSensorInfo[7] = (float) 0.0;
+			m_pRootColl->m_ctx.m_sSensorInfo[8] = (float) 0.0;
+			m_pRootColl->m_ctx.m_sSensorInfo[9] = (float) angleMemory;
 		}
 		else 
 		{
 			accRegion = 4;
-			CHcsmCollection::m_sSensorInfo[0] = -1.0f;
-			CHcsmCollection::m_sSensorInfo[1] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[2] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[3] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[4] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[5] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[6] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[7] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[8] = 0.0f;
-			CHcsmCollection::m_sSensorInfo[9] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[0] = -1.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[1] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[2] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[3] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[4] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[5] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[6] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[7] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[8] = 0.0f;
+			m_pRootColl->m_ctx.m_sSensorInfo[9] = 0.0f;
 		}
 	}
 
@@ -542,7 +490,7 @@ CScenarioControl::ComputeCollisionAvoidanceWarnings(
 	if ( debug_ct2 >= 25 )
 	{
 		cout << " cvedIdMem="	<< cvedIdMemory
-			 << " cvedIdOut="	<< CHcsmCollection::m_sSensorInfo[0] 
+			 << " cvedIdOut="	<< m_pRootColl->m_ctx.m_sSensorInfo[0] 
 			 << " cvedIdPrev="	<< cvedIdPrev
 			 << " region="	<< accRegion 
 			 << " OnCt="	<< accOn_ct 
@@ -1157,7 +1105,7 @@ CScenarioControl::ObjInFrontCone(
 	rotPosMRR.m_x += rotObjPos.m_x;
 
 	//calculate angles for the four boundary lines
-	const double cConeSize = CHcsmCollection::m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE]; // degrees
+	const double cConeSize = m_pRootColl->m_ctx.m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE]; // degrees
 	double coneLeftAngle = ( cConeSize / 2 ) * cDEG_TO_RAD;
 	double coneRightAngle = ( cConeSize / 2 ) * cDEG_TO_RAD;
 	CPoint2D coneLeftPoint( tan( (M_PI / 2) - coneLeftAngle ), 1.0 );
@@ -1318,7 +1266,7 @@ CScenarioControl::ObjInFrontCone(
 	rotPosRR.m_x += rotObjPos.m_x;
 
 	//calculate angles for the four boundary lines
-	const double cConeSize = CHcsmCollection::m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE]; // degrees
+	const double cConeSize = m_pRootColl->m_ctx.m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE]; // degrees
 	double coneLeftAngle = ( cConeSize / 2 ) * cDEG_TO_RAD;
 	double coneRightAngle = ( cConeSize / 2 ) * cDEG_TO_RAD;
 	CPoint2D coneLeftPoint( tan( (M_PI / 2) - coneLeftAngle ), 1.0 );
@@ -1451,17 +1399,17 @@ CScenarioControl::FCW(
 	const float   cReaction_time = 1.5f; // reaction time (sec)
 	const float         cEpsilon = 0.0000001f; // epsilon.  prevents division by zero
 	const float       vel_follow = (float) ownVehVel * (float) cMETER_TO_FEET; // velocity of following vehicle (ft/sec)
-	const float        leadObjId = CHcsmCollection::m_sFollowInfo[0];
-	const float false_alarm_cond = CHcsmCollection::m_sFalseAlarmInfo[0];
+	const float        leadObjId = m_pRootColl->m_ctx.m_sFollowInfo[0];
+	const float false_alarm_cond = m_pRootColl->m_ctx.m_sFalseAlarmInfo[0];
 
 	// declare local variables
 	float range, ranger, vel_lead, decel_lead, headway, ttc;
 	float range_init = 0, vel_lead_init = 0;
 	int i;
 
-	 headway = CHcsmCollection::m_sFollowInfo[2];
-	   range = CHcsmCollection::m_sFollowInfo[3];
-	vel_lead = CHcsmCollection::m_sFollowInfo[5];
+	 headway = m_pRootColl->m_ctx.m_sFollowInfo[2];
+	   range = m_pRootColl->m_ctx.m_sFollowInfo[3];
+	vel_lead = m_pRootColl->m_ctx.m_sFollowInfo[5];
 	  ranger = vel_lead - vel_follow;
 	  
 	if ( abs(ranger)>0.01 ) 
@@ -1495,9 +1443,9 @@ CScenarioControl::FCW(
 	int warning = 0;
 	if ( ( false_alarm_cond == 3 ) && ( false_time < 2.0 ) ) 
 	{
-	         range_init = CHcsmCollection::m_sFalseAlarmInfo[1];
-	      vel_lead_init = CHcsmCollection::m_sFalseAlarmInfo[2];
-		     decel_lead = -CHcsmCollection::m_sFalseAlarmInfo[3];
+	         range_init = m_pRootColl->m_ctx.m_sFalseAlarmInfo[1];
+	      vel_lead_init = m_pRootColl->m_ctx.m_sFalseAlarmInfo[2];
+		     decel_lead = -m_pRootColl->m_ctx.m_sFalseAlarmInfo[3];
 			   vel_lead = vel_lead_init - decel_lead * false_time; // remember decel_lead is positive!
 		  float vel_rel = vel_lead - vel_follow;
 	              range = range_init + range_prev + vel_rel * false_time;
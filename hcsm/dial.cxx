@@ -15,6 +15,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "dial.h"
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -30,7 +31,7 @@ CDial::CDial( CHcsmCollection *pRootCollection, const string& cName ):
 }
 
 CDial::CDial( const CDial& cRhs ):
-	CHcsmCommunicate( cRhs.m_pRootCollection, cRhs.m_name )
+	CHcsmCommunicate( cRhs )
 {
 	// call the assignment operator
 	*this = cRhs;
@@ -171,3 +172,45 @@ void CDial::SetNoValue()
 		m_resetFrame = cINVALID_FRAME;
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Writes the dial's state to a checkpoint.
+//
+// Remarks:  Adds the reset flags to the data written by the parent.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CDial::SaveState( CHcsmCheckpoint& ckpt )
+{
+	CHcsmCommunicate::SaveState( ckpt );
+	ckpt.Put( m_hasBeenResetA );
+	ckpt.Put( m_hasBeenResetB );
+	ckpt.Put( m_resetFrame );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads the dial's state from a checkpoint.
+//
+// Remarks:  This function reads the data written by SaveState.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CDial::RestoreState( CHcsmCheckpoint& ckpt )
+{
+	CHcsmCommunicate::RestoreState( ckpt );
+	ckpt.Get( m_hasBeenResetA );
+	ckpt.Get( m_hasBeenResetB );
+	ckpt.Get( m_resetFrame );
+}
@@ -30,6 +30,8 @@ public:
 	void Reset();
 	bool HasBeenReset();
 	void SetNoValue();
+	virtual void SaveState( CHcsmCheckpoint& );
+	virtual void RestoreState( CHcsmCheckpoint& );
 
 protected:
 	CDial( CHcsmCollection*, const string& );
@@ -0,0 +1,549 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: gatewayio.cxx,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Implementation of the CGatewayIo class.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "gatewayio.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#ifdef _WIN32
+
+#else
+#include <sys/types.h>
+#include <netinet/in.h>
+#endif
+
+// how long the I/O thread sleeps when a pass found nothing to do
+const int cGATEWAY_IDLE_MS = 1;
+
+CGatewayIo::CGatewayIo()
+	: m_listenSock( -1 )
+	, m_commands( cGATEWAY_CMD_QUEUE_SIZE )
+	, m_snapshots( cGATEWAY_NUM_SNAPSHOTS )
+	, m_free( cGATEWAY_NUM_SNAPSHOTS )
+	, m_wantDynaObjs( false )
+	, m_wireInterval( 0 )
+	, m_quit( false )
+	, m_failed( false )
+{
+	for ( int i = 0; i < cGATEWAY_NUM_SNAPSHOTS; i++ ) {
+		m_free.Push( &m_pool[i] );
+	}
+}
+
+
+CGatewayIo::~CGatewayIo()
+{
+	Stop();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Opens the listening sockets and starts the I/O thread.
+//
+// Remarks: Failing to open the wire protocol port only disables that
+//  protocol.
+//
+// Arguments:
+// port     - the port of the TMessage protocol
+// wirePort - the port of the wire protocol
+//
+// Returns: false if the TMessage protocol port could not be opened, in
+//  which case no thread is started
+//
+bool
+CGatewayIo::Start( int port, int wirePort )
+{
+	int s = CreateNonBlockingSocket( port );
+	if ( s < 0 ) return false;
+	m_listenSock = s;
+
+	if ( !m_wire.Open( wirePort ) ) {
+		fprintf(stderr,
+			"Gateway:  cannot listen on wire port %d; wire protocol "
+			"disabled\n", wirePort);
+	}
+
+	m_quit = false;
+	m_thread = thread( &CGatewayIo::IoMain, this );
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Stops the I/O thread and closes all the sockets.
+//
+void
+CGatewayIo::Stop( void )
+{
+	if ( m_thread.joinable() ) {
+		m_quit = true;
+		m_thread.join();
+	}
+
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		if ( !CloseSocket( m_conns[i].sock ) ) {
+			printf("Gateway: CloseSocket(%d) failed.\n", m_conns[i].sock);
+		}
+	}
+	m_conns.clear();
+
+	if ( m_listenSock != -1 ) {
+		if ( !CloseSocket( m_listenSock ) ) {
+			printf("Gateway:CloseSocket(%d) failed.\n", m_listenSock);
+		}
+		m_listenSock = -1;
+	}
+
+	m_wire.Close();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the next control command received from a client.
+//
+// Remarks: Commands are returned in the order they were received.
+//
+// Returns: false if there are no more commands
+//
+bool
+CGatewayIo::PopCommand( TWireControl& control )
+{
+	return m_commands.Pop( control );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Checks whether any client is waiting for the objects of
+//  the specified frame and if so returns a snapshot to fill in.
+//
+// Remarks: The flags of the returned snapshot tell which objects to
+//  collect.  The snapshot must be handed back with EndSnapshot.
+//
+// Arguments:
+// frame - the current frame
+//
+// Returns: the snapshot, or 0 if nothing is needed or the I/O thread has
+//  not caught up with the earlier snapshots yet
+//
+TGatewaySnapshot*
+CGatewayIo::BeginSnapshot( int frame )
+{
+	bool dynaObjs = m_wantDynaObjs.load( memory_order_acquire );
+	int  interval = m_wireInterval.load( memory_order_acquire );
+	bool wireObjs = interval > 0 && ( frame % interval ) == 0;
+	if ( !dynaObjs && !wireObjs ) return 0;
+
+	TGatewaySnapshot* pSnapshot;
+	if ( !m_free.Pop( pSnapshot ) ) return 0;
+
+	pSnapshot->frame       = frame;
+	pSnapshot->hasDynaObjs = dynaObjs;
+	pSnapshot->hasWireObjs = wireObjs;
+	pSnapshot->dynaObjs.clear();
+	pSnapshot->wireObjs.clear();
+	return pSnapshot;
+}
+
+
+void
+CGatewayIo::EndSnapshot( TGatewaySnapshot* pSnapshot )
+{
+	// cannot fail, the queue holds the whole pool
+	m_snapshots.Push( pSnapshot );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: The body of the I/O thread.
+//
+void
+CGatewayIo::IoMain( void )
+{
+	vector<TWireControl> controls;
+
+	while ( !m_quit.load() ) {
+		bool busy = false;
+
+		if ( !m_failed.load() ) busy |= Accept();
+
+		for ( size_t i = 0; i < m_conns.size(); i++ ) {
+			busy |= Dispatch( m_conns[i] );
+		}
+
+		controls.clear();
+		m_wire.Poll( controls );
+		if ( !controls.empty() ) {
+			m_held.insert( m_held.end(), controls.begin(), controls.end() );
+			busy = true;
+		}
+
+		busy |= ForwardCommands();
+		busy |= SendSnapshots();
+		RemoveDead();
+
+		bool wantDynaObjs = false;
+		for ( size_t i = 0; i < m_conns.size(); i++ ) {
+			if ( m_conns[i].wantDynaObjs ) wantDynaObjs = true;
+		}
+		m_wantDynaObjs.store( wantDynaObjs, memory_order_release );
+		m_wireInterval.store( m_wire.DueInterval(), memory_order_release );
+
+		if ( !busy ) {
+			this_thread::sleep_for( chrono::milliseconds( cGATEWAY_IDLE_MS ) );
+		}
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Accepts all the pending connections.
+//
+// Remarks: If polling for connections fails, no more connections are
+//  accepted and Failed starts returning true.
+//
+// Returns: true if a connection was accepted
+//
+bool
+CGatewayIo::Accept( void )
+{
+	bool accepted = false;
+
+	for ( ;; ) {
+		int code = PollSocketForConnection( m_listenSock );
+		if ( code == 0 ) break;		// no connection yet
+
+		if ( code < 0 ) {
+			fprintf(stderr,
+				"Gateway:  error while polling for a connection\n");
+			m_failed = true;
+			break;
+		}
+
+		fprintf(stderr, "Gateway:  got a connection.\n");
+
+		// one slow client must not hold up the others
+		WireSetNonBlocking( code );
+
+		TConn conn;
+		conn.sock         = code;
+		conn.wantDynaObjs = false;
+		conn.dead         = false;
+		conn.outPos       = 0;
+		m_conns.push_back( conn );
+		accepted = true;
+	}
+
+	return accepted;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Process messages from the specified connection
+//
+// Remarks:
+// Reads what has arrived and handles every complete message; the start
+// of a message whose body has not all arrived stays buffered for the
+// next pass.  A GETDYNAOBJS request is only recorded here; it is
+// answered when the frame thread delivers the objects.  A CONTROLOBJ
+// message is acknowledged and its command queued for the frame thread.
+// A connection that is closed, whose read fails or that sends a
+// malformed message is dropped.
+//
+// Returns: true if anything was read or sent
+//
+bool
+CGatewayIo::Dispatch( TConn& conn )
+{
+	if ( conn.dead ) return false;
+
+	int  got    = WireRecv( conn.sock, conn.in );
+	bool closed = got < 0;
+	bool busy   = got != 0;
+
+	size_t pos = 0;
+	while ( conn.in.size() - pos >= sizeof(TMsgHeader) ) {
+		TMsgHeader head;
+		memcpy( &head, &conn.in[pos], sizeof(head) );
+		head.m_StartMark = ntohs(head.m_StartMark);
+		head.m_OpCode    = ntohs(head.m_OpCode);
+		head.m_MsgLen    = ntohl(head.m_MsgLen);
+
+		if ( head.m_StartMark != (short)START_MARK
+				|| head.m_MsgLen < (long)sizeof(head)
+				|| head.m_MsgLen > MAX_HCSM_MESSAGE_SIZE ) {
+			fprintf(stderr, "CGW::PM: bad message header, dropping client\n");
+			conn.dead = true;
+			return true;
+		}
+
+		if ( conn.in.size() - pos < (size_t) head.m_MsgLen ) {
+			break;		// rest of the body not here yet
+		}
+
+		const unsigned char* cpBody   = &conn.in[pos] + sizeof(head);
+		int                  bodySize = head.m_MsgLen - sizeof(head);
+		pos += head.m_MsgLen;
+
+		switch ( head.m_OpCode ) {
+			case CMD_GETDYNAOBJS :
+				conn.wantDynaObjs = true;
+				break;
+
+			case CMD_CONTROLOBJ : {
+				int ints[3];
+				if ( bodySize < (int)sizeof(ints) ) {
+					fprintf(stderr, "CGW::PM: short CONTROLOBJ, dropping client\n");
+					conn.dead = true;
+					return true;
+				}
+				memcpy( ints, cpBody, sizeof(ints) );
+
+				Queue( conn, CMD_ACKOK, 0, 0 );
+
+				TWireControl control;
+				control.hcsmId = ntohl(ints[1]);
+				control.cmd    = ntohl(ints[0]);
+				control.val    = ntohl(ints[2]);
+				m_held.push_back( control );
+				break;
+			}
+
+			default :
+				fprintf(stderr, "CGW::PM: got unexpected message\n");
+				break;
+		}
+	}
+
+	conn.in.erase( conn.in.begin(), conn.in.begin() + pos );
+
+	if ( closed ) {
+		conn.dead = true;
+		return true;
+	}
+
+	busy |= Flush( conn );
+	return busy;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Moves the received commands to the frame thread's queue.
+//
+// Remarks: Commands that do not fit are kept, in order, for the next
+//  pass, so none is lost when the frame thread falls behind.
+//
+// Returns: true if a command was moved
+//
+bool
+CGatewayIo::ForwardCommands( void )
+{
+	bool moved = false;
+	while ( !m_held.empty() && m_commands.Push( m_held.front() ) ) {
+		m_held.pop_front();
+		moved = true;
+	}
+	return moved;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sends the snapshots delivered by the frame thread to the
+//  clients waiting for them and returns the snapshots to the pool.
+//
+// Returns: true if a snapshot was sent
+//
+bool
+CGatewayIo::SendSnapshots( void )
+{
+	bool sent = false;
+	TGatewaySnapshot* pSnapshot;
+
+	while ( m_snapshots.Pop( pSnapshot ) ) {
+		if ( pSnapshot->hasDynaObjs ) {
+			for ( size_t i = 0; i < m_conns.size(); i++ ) {
+				TConn& conn = m_conns[i];
+				if ( conn.dead || !conn.wantDynaObjs ) continue;
+
+				SendDynaObjs( conn, pSnapshot->dynaObjs );
+				conn.wantDynaObjs = false;
+			}
+		}
+		if ( pSnapshot->hasWireObjs ) {
+			m_wire.PublishObjs( pSnapshot->frame, pSnapshot->wireObjs );
+		}
+
+		m_free.Push( pSnapshot );
+		sent = true;
+	}
+
+	return sent;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Replies to a GETDYNAOBJS request.
+//
+// Remarks: The reply starts with a message giving the number of objects
+//  and how they are split into messages, followed by the messages with
+//  the objects.
+//
+void
+CGatewayIo::SendDynaObjs( TConn& conn, const vector<TObjDesc>& cObjs )
+{
+	TMessage   msg;
+	int          NumObjs;			// number of dynamic objects
+	int          ObjsPerMessage;  // how many objects fit in a message
+	int          NumMessages;     // how many messages we will have to send
+	int          ObjsInLastMsg;   // objects in last message
+	int          package[4];      // storage message sending
+
+	NumObjs = (int) cObjs.size();
+
+	ObjsPerMessage = sizeof(msg.data.bytes) / sizeof(TObjDesc);
+	if ( (NumObjs % ObjsPerMessage) == 0 ) {
+		NumMessages    = NumObjs / ObjsPerMessage;
+		ObjsInLastMsg  = ObjsPerMessage;
+	}
+	else {
+		NumMessages    = 1 + NumObjs / ObjsPerMessage;
+		ObjsInLastMsg  = NumObjs % ObjsPerMessage;
+	}
+
+// i1 - number of dynamic objects
+// i2 - number of messages that will be send back
+// i3 - number of objects per message, for all but the last message
+// i4 - number of objects in the last message.
+	package[0] = htonl(NumObjs);
+	package[1] = htonl(NumMessages);
+	package[2] = htonl(ObjsPerMessage);
+	package[3] = htonl(ObjsInLastMsg);
+
+	Queue( conn, CMD_ACKOK, package, sizeof(package) );
+
+	int  ObjsInMessage = 0;
+	for ( size_t i = 0; i < cObjs.size(); i++ ) {
+		msg.data.objs[ObjsInMessage] = cObjs[i];
+		ObjsInMessage++;
+
+		if ( ObjsInMessage == ObjsPerMessage ) {
+			Queue( conn, CMD_ACKOK, &msg.data, sizeof(msg.data) );
+			ObjsInMessage = 0;
+		}
+	}
+
+	if ( ObjsInMessage != 0 ) { 	// must send last message
+		Queue( conn, CMD_ACKOK, &msg.data, sizeof(msg.data) );
+	}
+
+	Flush( conn );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Adds a message to the output of a connection.
+//
+// Remarks: Builds the same header as SendMessage.  Nothing is sent until
+//  the next Flush.
+//
+// Arguments:
+// conn  - the connection
+// cmd   - the command of the message
+// cpBuf - the body of the message; not used if size is 0
+// size  - the size of the body
+//
+void
+CGatewayIo::Queue( TConn& conn, int cmd, const void* cpBuf, int size )
+{
+	TMsgHeader head;
+	head.m_StartMark = htons(START_MARK);
+	head.m_OpCode    = htons(cmd);
+	head.m_MsgLen    = htonl(size + sizeof(TMsgHeader));
+
+	const unsigned char* cpHead = (const unsigned char*) &head;
+	conn.out.insert( conn.out.end(), cpHead, cpHead + sizeof(head) );
+	if ( size > 0 ) {
+		const unsigned char* cpData = (const unsigned char*) cpBuf;
+		conn.out.insert( conn.out.end(), cpData, cpData + size );
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sends as much of the output of a connection as the socket
+//  accepts without waiting.
+//
+// Remarks: What is not sent stays queued and the next call resumes at the
+//  first unsent byte.  A connection whose send fails, or that has more
+//  than cGATEWAY_MAX_PENDING bytes waiting, is dropped.
+//
+// Returns: true if anything was sent
+//
+bool
+CGatewayIo::Flush( TConn& conn )
+{
+	size_t pending = conn.out.size() - conn.outPos;
+	if ( conn.dead || pending == 0 ) return false;
+
+	int n = WireSend( conn.sock, &conn.out[0] + conn.outPos, (int) pending );
+	if ( n < 0 ) {
+		fprintf(stderr, "CGW: send failed, dropping client\n");
+		conn.dead = true;
+		return true;
+	}
+	conn.outPos += n;
+
+	if ( conn.outPos == conn.out.size() ) {
+		conn.out.clear();
+		conn.outPos = 0;
+	}
+	else if ( conn.out.size() - conn.outPos > (size_t) cGATEWAY_MAX_PENDING ) {
+		fprintf(stderr, "CGW: client is not reading, dropping it\n");
+		conn.dead = true;
+	}
+	else if ( conn.outPos > conn.out.size() / 2 ) {
+		conn.out.erase( conn.out.begin(), conn.out.begin() + conn.outPos );
+		conn.outPos = 0;
+	}
+
+	return n > 0;
+}
+
+
+void
+CGatewayIo::RemoveDead( void )
+{
+	size_t keep = 0;
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		if ( m_conns[i].dead ) {
+			CloseSocket( m_conns[i].sock );
+		}
+		else {
+			m_conns[keep++] = m_conns[i];
+		}
+	}
+	m_conns.resize( keep );
+}
@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: gatewayio.h,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Header file for the CGatewayIo class, which runs the
+// network side of the Gateway HCSM on its own thread.
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef _GATEWAYIO_H_
+#define _GATEWAYIO_H_
+
+#include "hcsmconnect.h"
+#include "hcsmwireserver.h"
+#include "spscqueue.h"
+
+#include <atomic>
+#include <deque>
+#include <thread>
+
+// control commands decoded but not yet applied
+const int cGATEWAY_CMD_QUEUE_SIZE = 256;
+// object snapshots in flight between the two threads
+const int cGATEWAY_NUM_SNAPSHOTS  = 3;
+// unsent bytes after which a client is considered stuck and dropped
+const int cGATEWAY_MAX_PENDING    = 4 * 1024 * 1024;
+
+//
+// The objects of one frame, collected by the frame thread for the
+// clients that asked for them.  Only the parts whose flag is set are
+// filled in.
+//
+struct TGatewaySnapshot {
+	int               frame;
+	bool              hasDynaObjs;
+	vector<TObjDesc>  dynaObjs;		// network byte order, ready to send
+	bool              hasWireObjs;
+	vector<TWireObj>  wireObjs;		// sorted by id
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Serves the TMessage protocol clients and the wire protocol clients on
+// a dedicated thread, so a slow or chatty client never adds to the
+// frame time.  There is no limit on the number of clients.
+//
+// The frame thread and the I/O thread only exchange data through
+// lock-free queues.  Control commands flow from the I/O thread to the
+// frame thread, which pops and applies them with PopCommand.  Object
+// states flow the other way: the I/O thread publishes what its clients
+// are waiting for, the frame thread asks with BeginSnapshot whether
+// anything is needed this frame, fills in the snapshot and hands it
+// over with EndSnapshot.  Snapshots come from a small fixed pool that
+// the I/O thread returns after sending them; when the I/O thread falls
+// behind the pool runs dry and the frame thread skips a frame instead
+// of waiting.
+//
+// A GETDYNAOBJS request is answered with the objects of the next frame
+// the frame thread collects, rather than inside the frame it arrived.
+//
+// Each connection buffers what it has received until a whole message
+// is there and what it could not send yet, so messages split across
+// reads or writes are neither lost nor corrupted.
+//
+class CGatewayIo
+{
+public:
+	CGatewayIo();
+	~CGatewayIo();
+
+	bool Start( int port, int wirePort );
+	void Stop( void );
+	bool Failed( void ) const { return m_failed.load(); };
+
+	// frame thread only
+	bool PopCommand( TWireControl& control );
+	TGatewaySnapshot* BeginSnapshot( int frame );
+	void EndSnapshot( TGatewaySnapshot* pSnapshot );
+
+private:
+	struct TConn {
+		SOCKET                 sock;
+		bool                   wantDynaObjs;	// a GETDYNAOBJS is waiting for a reply
+		bool                   dead;
+		vector<unsigned char>  in;		// start of an incomplete message
+		vector<unsigned char>  out;		// messages not completely sent
+		size_t                 outPos;	// bytes of out already sent
+	};
+
+	void IoMain( void );
+	bool Accept( void );
+	bool Dispatch( TConn& conn );
+	bool ForwardCommands( void );
+	bool SendSnapshots( void );
+	void SendDynaObjs( TConn& conn, const vector<TObjDesc>& cObjs );
+	void Queue( TConn& conn, int cmd, const void* cpBuf, int size );
+	bool Flush( TConn& conn );
+	void RemoveDead( void );
+
+	SOCKET                         m_listenSock;
+	vector<TConn>                  m_conns;
+	CHcsmWireServer                m_wire;
+	deque<TWireControl>            m_held;	// did not fit in the queue
+	TGatewaySnapshot               m_pool[cGATEWAY_NUM_SNAPSHOTS];
+
+	CSpscQueue<TWireControl>       m_commands;		// I/O to frame thread
+	CSpscQueue<TGatewaySnapshot*>  m_snapshots;		// frame to I/O thread
+	CSpscQueue<TGatewaySnapshot*>  m_free;			// I/O to frame thread
+
+	// what the clients are waiting for, published by the I/O thread
+	atomic<bool>                   m_wantDynaObjs;
+	atomic<int>                    m_wireInterval;
+
+	atomic<bool>                   m_quit;
+	atomic<bool>                   m_failed;
+	thread                         m_thread;
+
+	CGatewayIo( const CGatewayIo& );
+	CGatewayIo& operator=( const CGatewayIo& );
+};
+
+#endif // _GATEWAYIO_H_
@@ -22,6 +22,7 @@ using namespace std;
 
 #include "hcsm.h"
 #include "hcsmcollection.h"
+#include "hcsmcheckpoint.h"
 
 // MemLog constants
 #define HLOG_CALL_CREAT_START       11000
@@ -443,6 +444,126 @@ CHcsm::CallCreation( void )
 	m_pRootCollection->MemLog( id, HLOG_CALL_CREAT_END, 0 );
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Writes the Hcsm's state, and the state of its children, to
+//   a checkpoint.
+//
+// Remarks:  The code generator overrides this function in every Hcsm
+//   class to add the class' buttons, dials, monitors, parameters and
+//   private data members.  State that the generated code cannot reach
+//   (e.g. data behind pointers) is saved by overriding SaveUserState.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CHcsm::SaveState( CHcsmCheckpoint& ckpt )
+{
+	ckpt.BeginSection( m_name.c_str() );
+	ckpt.Put( m_state );
+	ckpt.Put( m_executionTime );
+	ckpt.Put( m_debugMode );
+	ckpt.Put( m_debugLevel );
+	ckpt.Put( m_priorityLevel );
+	ckpt.Put( m_numChildren );
+
+	int i;
+	for( i = 0; i < m_numChildren; i++ ) 
+	{
+		m_children[i]->SaveState( ckpt );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads the Hcsm's state, and the state of its children, from
+//   a checkpoint.
+//
+// Remarks:  This function reads the data written by SaveState.  The Hcsm
+//   has to have been created from the same snoblock as the Hcsm that was
+//   saved so that it has the same children.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CHcsm::RestoreState( CHcsmCheckpoint& ckpt )
+{
+	ckpt.CheckSection( m_name.c_str() );
+	ckpt.Get( m_state );
+	ckpt.Get( m_executionTime );
+	ckpt.Get( m_debugMode );
+	ckpt.Get( m_debugLevel );
+	ckpt.Get( m_priorityLevel );
+
+	int numChildren = m_numChildren;
+	ckpt.Get( numChildren );
+	if( numChildren != m_numChildren ) 
+	{
+		ckpt.SetError( m_name + ": number of children does not match" );
+		return;
+	}
+
+	int i;
+	for( i = 0; i < m_numChildren; i++ ) 
+	{
+		m_children[i]->RestoreState( ckpt );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Default user checkpoint functions.
+//
+// Remarks:  Hcsms that keep state the generated SaveState cannot reach
+//   declare these functions in their .sm file and write or read that
+//   state.  Both functions have to handle exactly the same data.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to or read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CHcsm::SaveUserState( CHcsmCheckpoint& )
+{
+}
+
+void
+CHcsm::RestoreUserState( CHcsmCheckpoint& )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Default function to recreate the Hcsm's CVED object after
+//   a checkpoint has been restored.
+//
+// Remarks:  Hcsms whose CVED object is created on activation rather than
+//   in Creation register with CHcsmCollection::RestoreCvedObjectLater 
+//   from RestoreUserState and override this function.  The collection
+//   calls it once every Hcsm has been restored, in the order of the ids
+//   the objects had when the checkpoint was taken, so that CVED hands out
+//   the same ids again.
+//
+// Arguments:
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CHcsm::RestoreCvedObject()
+{
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Executes an Hcsm.
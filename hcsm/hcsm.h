@@ -47,6 +47,7 @@ enum EDebugMode {
 const int cMAX_CHILDREN = 10;
 
 class CHcsmCollection;
+class CHcsmCheckpoint;
 
 typedef struct TSequentialDial
 {
@@ -76,6 +77,7 @@ class CHcsm : public CHcsmObject
 public:
 	virtual ~CHcsm();
 	inline const string& GetName() const;
+	inline const CSnoBlock* GetSnoBlock() const;
 	inline EHcsmState GetState();
 	inline void SetState( const EHcsmState );
 	void SetStateTree( const EHcsmState );
@@ -89,6 +91,9 @@ public:
 	virtual bool ExecutePredicate( int );
 	virtual bool SetButtonByName( const string& );
 	void CallCreation();
+	virtual void SaveState( CHcsmCheckpoint& );
+	virtual void RestoreState( CHcsmCheckpoint& );
+	virtual void RestoreCvedObject();
 
 	inline void SetDebugLevel( CHcsmDebugItem::ELevel );
 	inline CHcsmDebugItem::ELevel GetDebugLevel(void) const;
@@ -111,6 +116,8 @@ protected:
 	virtual void PreActivity( const CSnoBlock* );
 	virtual void PostActivity();
 	virtual void PostActivity( const CSnoBlock* );
+	virtual void SaveUserState( CHcsmCheckpoint& );
+	virtual void RestoreUserState( CHcsmCheckpoint& );
 	void Suicide();
 	void AddChild( CHcsm* );
 	string MessagePrefix();
@@ -42,6 +42,26 @@ CHcsm::GetName() const
 
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the snoblock the Hcsm was created from.
+//
+// Remarks:  The pointer is owned by the Hcsm.
+//
+// Arguments:
+//
+// Returns:  A pointer to the snoblock, or NULL if the Hcsm was created
+//   without one.
+//
+//////////////////////////////////////////////////////////////////////////////
+inline const CSnoBlock* 
+CHcsm::GetSnoBlock() const
+{
+
+	return m_pSnoBlock;
+
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Returns the number of children for an HCSM.
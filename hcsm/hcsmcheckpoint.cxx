@@ -0,0 +1,603 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: hcsmcheckpoint.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The implementation file for the CHcsmCheckpoint class.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "hcsmcheckpoint.h"
+
+using namespace CVED;
+
+// Provide consistency in error messages
+static const char s_Pre[] = "Hcsm Checkpoint";
+
+// Maximum length of a section tag, including the terminator
+const int cMAX_TAG_SIZE = 32;
+
+// Written after the magic number and the version.  A checkpoint holds
+// raw in-memory values so it can only be loaded by a build that agrees
+// on the sizes of the basic types.
+struct TCkptSignature {
+	int m_version;
+	int m_sizeofInt;
+	int m_sizeofLong;
+	int m_sizeofDouble;
+	int m_sizeofPtr;
+};
+
+static void
+InitSignature( TCkptSignature& sig )
+{
+	memset( &sig, 0, sizeof( sig ) );
+	sig.m_version      = cHCSM_CKPT_VERSION;
+	sig.m_sizeofInt    = sizeof( int );
+	sig.m_sizeofLong   = sizeof( long );
+	sig.m_sizeofDouble = sizeof( double );
+	sig.m_sizeofPtr    = sizeof( void* );
+}
+
+
+CHcsmCheckpoint::CHcsmCheckpoint()
+{
+	Clear();
+}
+
+CHcsmCheckpoint::~CHcsmCheckpoint()
+{
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Discards all data and resets the read position and the error state.
+//
+void
+CHcsmCheckpoint::Clear( void )
+{
+	m_data.clear();
+	m_readPos  = 0;
+	m_error    = false;
+	m_errorMsg = "";
+	m_links.clear();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Moves the read position back to the beginning of the data and resets
+// the error state, so that the same archive can be restored again.
+//
+void
+CHcsmCheckpoint::Rewind( void )
+{
+	m_readPos  = 0;
+	m_error    = false;
+	m_errorMsg = "";
+	m_links.clear();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Stores the archive in the file whose name is specified as the sole
+// argument.
+//
+// Returns:
+// True if everything was ok or false otherwise.  In case of errors, error
+// messages are printed to stderr.
+//
+bool
+CHcsmCheckpoint::Store( const string& cFileName ) const
+{
+	FILE* pF = fopen( cFileName.c_str(), "wb" );
+	if ( pF == 0 ) {
+		fprintf(
+			stderr,
+			"%s: Can't open file %s to store checkpoint: %s\n",
+			s_Pre,
+			cFileName.c_str(),
+			strerror( errno )
+			);
+		return false;
+	}
+
+	int magic = cHCSM_CKPT_MAGIC;
+	TCkptSignature sig;
+	InitSignature( sig );
+	unsigned int size = (unsigned int) m_data.size();
+
+	bool ok = fwrite( &magic, sizeof( magic ), 1, pF ) == 1 &&
+		fwrite( &sig, sizeof( sig ), 1, pF ) == 1 &&
+		fwrite( &size, sizeof( size ), 1, pF ) == 1 &&
+		( size == 0 || fwrite( &m_data[0], size, 1, pF ) == 1 ) &&
+		fwrite( &magic, sizeof( magic ), 1, pF ) == 1;
+
+	if ( fclose( pF ) != 0 ) ok = false;
+	if ( !ok ) {
+		fprintf(
+			stderr,
+			"%s: Write to %s failed.\n",
+			s_Pre,
+			cFileName.c_str()
+			);
+	}
+
+	return ok;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Loads the archive from the file whose name is specified as the sole
+// argument.  Any data previously held is discarded and reading starts
+// at the beginning of the loaded data.
+//
+// Returns:
+// True if everything was ok or false otherwise.  In case of errors, error
+// messages are printed to stderr.
+//
+bool
+CHcsmCheckpoint::Load( const string& cFileName )
+{
+	Clear();
+
+	FILE* pF = fopen( cFileName.c_str(), "rb" );
+	if ( pF == 0 ) {
+		fprintf(
+			stderr,
+			"%s: Can't open file %s to load checkpoint: %s\n",
+			s_Pre,
+			cFileName.c_str(),
+			strerror( errno )
+			);
+		return false;
+	}
+
+	int magic;
+	if ( fread( &magic, sizeof( magic ), 1, pF ) != 1 || magic != cHCSM_CKPT_MAGIC ) {
+		fprintf( stderr, "%s: Load failed: file is not a checkpoint.\n", s_Pre );
+		fclose( pF );
+		return false;
+	}
+
+	TCkptSignature sig, mySig;
+	InitSignature( mySig );
+	if ( fread( &sig, sizeof( sig ), 1, pF ) != 1 ) {
+		fprintf( stderr, "%s: Load failed: cannot read file version.\n", s_Pre );
+		fclose( pF );
+		return false;
+	}
+	if ( memcmp( &sig, &mySig, sizeof( sig ) ) ) {
+		fprintf( stderr, "%s: Load failed: incompatible versions "
+			"(file=%d, sw=%d) or platforms.\n", s_Pre, sig.m_version,
+			mySig.m_version );
+		fclose( pF );
+		return false;
+	}
+
+	unsigned int size;
+	if ( fread( &size, sizeof( size ), 1, pF ) != 1 ) {
+		fprintf( stderr, "%s: Load failed: premature end of file.\n", s_Pre );
+		fclose( pF );
+		return false;
+	}
+
+	m_data.resize( size );
+	if ( size > 0 && fread( &m_data[0], size, 1, pF ) != 1 ) {
+		fprintf( stderr, "%s: Load failed: premature end of file.\n", s_Pre );
+		Clear();
+		fclose( pF );
+		return false;
+	}
+
+	if ( fread( &magic, sizeof( magic ), 1, pF ) != 1 || magic != cHCSM_CKPT_MAGIC ) {
+		fprintf( stderr, "%s: Load failed: bad end marker.\n", s_Pre );
+		Clear();
+		fclose( pF );
+		return false;
+	}
+
+	fclose( pF );
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Marks the beginning of the data of an object.  The reader has to call
+// CheckSection with the same tag at the same point.
+//
+void
+CHcsmCheckpoint::BeginSection( const char* cpTag )
+{
+	char tag[cMAX_TAG_SIZE];
+
+	memset( tag, 0, sizeof( tag ) );
+	strncpy( tag, cpTag, cMAX_TAG_SIZE - 1 );
+	PutBytes( tag, sizeof( tag ) );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Reads a section tag and compares it against the one provided.  A
+// mismatch puts the archive in the error state.
+//
+// Returns:
+// True if the tags match.
+//
+bool
+CHcsmCheckpoint::CheckSection( const char* cpTag )
+{
+	char tag[cMAX_TAG_SIZE];
+
+	if ( !GetBytes( tag, sizeof( tag ) ) ) return false;
+	tag[cMAX_TAG_SIZE - 1] = 0;
+
+	if ( strncmp( tag, cpTag, cMAX_TAG_SIZE - 1 ) ) {
+		SetError( string( "expected section '" ) + cpTag + "' but found '" +
+			tag + "'" );
+		return false;
+	}
+
+	return true;
+}
+
+
+void
+CHcsmCheckpoint::PutBytes( const void* cpData, size_t size )
+{
+	const char* cpC = (const char*) cpData;
+	m_data.insert( m_data.end(), cpC, cpC + size );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copies the next size bytes of the archive to the provided buffer.
+//
+// Returns:
+// False, without touching the buffer, if the archive is in the error
+// state or does not hold enough data.
+//
+bool
+CHcsmCheckpoint::GetBytes( void* pData, size_t size )
+{
+	if ( m_error ) return false;
+
+	if ( m_readPos + size > m_data.size() ) {
+		SetError( "read past the end of the checkpoint" );
+		return false;
+	}
+
+	if ( size > 0 ) memcpy( pData, &m_data[m_readPos], size );
+	m_readPos += size;
+	return true;
+}
+
+
+void
+CHcsmCheckpoint::Put( const string& cVal )
+{
+	Put( (int) cVal.size() );
+	PutBytes( cVal.data(), cVal.size() );
+}
+
+void
+CHcsmCheckpoint::Get( string& val )
+{
+	int size = -1;
+	Get( size );
+	if ( m_error ) return;
+
+	if ( size < 0 || m_readPos + size > m_data.size() ) {
+		SetError( "bad string size" );
+		return;
+	}
+
+	val.assign( &m_data[0] + m_readPos, size );
+	m_readPos += size;
+}
+
+void
+CHcsmCheckpoint::Put( const CPoint2D& cVal )
+{
+	Put( cVal.m_x );
+	Put( cVal.m_y );
+}
+
+void
+CHcsmCheckpoint::Get( CPoint2D& val )
+{
+	Get( val.m_x );
+	Get( val.m_y );
+}
+
+void
+CHcsmCheckpoint::Put( const CVector2D& cVal )
+{
+	Put( cVal.m_i );
+	Put( cVal.m_j );
+}
+
+void
+CHcsmCheckpoint::Get( CVector2D& val )
+{
+	Get( val.m_i );
+	Get( val.m_j );
+}
+
+void
+CHcsmCheckpoint::Put( const CPoint3D& cVal )
+{
+	Put( cVal.m_x );
+	Put( cVal.m_y );
+	Put( cVal.m_z );
+}
+
+void
+CHcsmCheckpoint::Get( CPoint3D& val )
+{
+	Get( val.m_x );
+	Get( val.m_y );
+	Get( val.m_z );
+}
+
+void
+CHcsmCheckpoint::Put( const CVector3D& cVal )
+{
+	Put( cVal.m_i );
+	Put( cVal.m_j );
+	Put( cVal.m_k );
+}
+
+void
+CHcsmCheckpoint::Get( CVector3D& val )
+{
+	Get( val.m_i );
+	Get( val.m_j );
+	Get( val.m_k );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// The generator keeps its complete state, including which streams have
+// been handed out, in fixed size tables so it is stored as is.
+//
+void
+CHcsmCheckpoint::Put( const CRandNumGen& cVal )
+{
+	static_assert(
+		!is_polymorphic<CRandNumGen>::value,
+		"CRandNumGen can no longer be stored as is"
+		);
+	PutBytes( &cVal, sizeof( cVal ) );
+}
+
+void
+CHcsmCheckpoint::Get( CRandNumGen& val )
+{
+	GetBytes( &val, sizeof( val ) );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Road positions are stored as the ids of their road and lane, or of
+// their intersection and corridor, and their distance and offset, which
+// are stored as is so the position comes back bit for bit.  Only the
+// corridor the position reports is kept for positions on intersections.
+//
+void
+CHcsmCheckpoint::Put( const CRoadPos& cVal )
+{
+	bool valid = cVal.IsValid();
+	Put( valid );
+	if ( !valid ) return;
+
+	bool isRoad = cVal.IsRoad();
+	Put( isRoad );
+	if ( isRoad ) {
+		Put( cVal.GetRoad().GetId() );
+		Put( cVal.GetLane().GetRelativeId() );
+	}
+	else {
+		Put( cVal.GetIntrsctn().GetId() );
+		Put( cVal.GetCorridor().GetId() );
+	}
+	Put( cVal.GetDistance() );
+	Put( cVal.GetOffset() );
+}
+
+void
+CHcsmCheckpoint::Get( CRoadPos& val, const CCved& cCved )
+{
+	bool valid = false;
+	Get( valid );
+	if ( m_error ) return;
+
+	if ( !valid ) {
+		val = CRoadPos( cCved );
+		return;
+	}
+
+	bool   isRoad = true;
+	int    id     = -1;
+	int    subId  = -1;
+	double dist   = 0.0;
+	double ofs    = 0.0;
+	Get( isRoad );
+	Get( id );
+	Get( subId );
+	Get( dist );
+	Get( ofs );
+	if ( m_error ) return;
+
+	CRoadPos tmp( cCved );
+	if ( isRoad ) {
+		tmp = CRoadPos( CRoad( cCved, id ), subId, dist );
+	}
+	else {
+		tmp = CRoadPos( CIntrsctn( cCved, id ), CCrdr( cCved, subId ) );
+		tmp.SetCorridor( CCrdr( cCved, subId ), dist );
+	}
+	tmp.SetOffset( ofs );
+
+	if ( !tmp.IsValid() ) {
+		SetError( "bad road position" );
+		return;
+	}
+	val = tmp;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Roads, intersections and corridors are stored by id, lanes by the id of
+// their road and their id relative to it.  -1 stands for an invalid item.
+//
+void
+CHcsmCheckpoint::Put( const CRoad& cVal )
+{
+	Put( cVal.IsValid() ? cVal.GetId() : -1 );
+}
+
+void
+CHcsmCheckpoint::Get( CRoad& val, const CCved& cCved )
+{
+	int id = -1;
+	Get( id );
+	if ( m_error ) return;
+
+	val = id < 0 ? CRoad() : CRoad( cCved, id );
+}
+
+void
+CHcsmCheckpoint::Put( const CLane& cVal )
+{
+	bool valid = cVal.IsValid();
+	Put( valid ? cVal.GetRoad().GetId() : -1 );
+	Put( valid ? cVal.GetRelativeId() : -1 );
+}
+
+void
+CHcsmCheckpoint::Get( CLane& val, const CCved& cCved )
+{
+	int roadId = -1;
+	int relId  = -1;
+	Get( roadId );
+	Get( relId );
+	if ( m_error ) return;
+
+	val = roadId < 0 ? CLane() : CLane( CRoad( cCved, roadId ), relId );
+}
+
+void
+CHcsmCheckpoint::Put( const CIntrsctn& cVal )
+{
+	Put( cVal.IsValid() ? cVal.GetId() : -1 );
+}
+
+void
+CHcsmCheckpoint::Get( CIntrsctn& val, const CCved& cCved )
+{
+	int id = -1;
+	Get( id );
+	if ( m_error ) return;
+
+	val = id < 0 ? CIntrsctn() : CIntrsctn( cCved, id );
+}
+
+void
+CHcsmCheckpoint::Put( const CCrdr& cVal )
+{
+	Put( cVal.IsValid() ? cVal.GetId() : -1 );
+}
+
+void
+CHcsmCheckpoint::Get( CCrdr& val, const CCved& cCved )
+{
+	int id = -1;
+	Get( id );
+	if ( m_error ) return;
+
+	val = id < 0 ? CCrdr() : CCrdr( cCved, id );
+}
+
+void
+CHcsmCheckpoint::Put( const CPath& cVal )
+{
+	vector<string> strs;
+	cVal.GetString( strs );
+	Put( strs );
+}
+
+void
+CHcsmCheckpoint::Get( CPath& val, const CCved& cCved )
+{
+	vector<string> strs;
+	Get( strs );
+	if ( m_error ) return;
+
+	CPath tmp( cCved );
+	if ( !strs.empty() ) tmp.SetString( strs );
+	val = tmp;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Registers an object that was just restored so that an object restored
+// later can point to it.  Registering a name again replaces the previous
+// object.
+//
+void
+CHcsmCheckpoint::SetLink( const string& cName, void* pObj )
+{
+	m_links[cName] = pObj;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Returns the object last registered under the specified name and
+// forgets it, so that each registration is consumed by exactly one
+// object.
+//
+// Returns:
+// The object, or 0 if none has been registered under the name.
+//
+void*
+CHcsmCheckpoint::TakeLink( const string& cName )
+{
+	map<string, void*>::iterator itr = m_links.find( cName );
+	if ( itr == m_links.end() ) return 0;
+
+	void* pObj = itr->second;
+	m_links.erase( itr );
+	return pObj;
+}
+
+
+void
+CHcsmCheckpoint::SetError( const string& cMsg )
+{
+	if ( !m_error ) {
+		m_error    = true;
+		m_errorMsg = cMsg;
+	}
+}
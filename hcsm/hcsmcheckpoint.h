@@ -0,0 +1,248 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: hcsmcheckpoint.h,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The header file for the CHcsmCheckpoint class, the archive
+ *   used to save and restore the complete state of a running scenario.
+ *
+ * The archive is a flat byte buffer.  Values are appended with Put and
+ * read back, in the same order, with Get.  Every object that takes part
+ * in a checkpoint writes a short section tag before its data so that a
+ * mismatch between the writer and the reader (e.g. a checkpoint taken
+ * with a different hcsm.sm) is detected at the first object that differs
+ * instead of silently scrambling all the state that follows.
+ *
+ * Arithmetic values and enumerations are stored in their in-memory
+ * representation, so a checkpoint restores them bit for bit.  The file
+ * is therefore only meant to be read back by the same build on the same
+ * platform, which is checked with the version and the size signature
+ * stored in the file header.
+ *
+ * CVED road items hold pointers into the road network and are stored by
+ * id (paths in their string form); reading them back needs the CVED 
+ * instance they are to be bound to.
+ *
+ * Pointers between objects are not stored.  An object that is pointed to
+ * can register itself under a name with SetLink while it is restored and
+ * the object holding the pointer, restored later, picks it up with
+ * TakeLink.
+ *
+ ****************************************************************************/
+
+#ifndef _HCSMCHECKPOINT_H_
+#define _HCSMCHECKPOINT_H_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <type_traits>
+
+using namespace std;
+
+#include <point3d.h>
+#include <cvedpub.h>
+#include <randnumgen.h>
+
+// Increment every time the layout of the data written by the collection,
+// the base classes or the code generator changes.
+const int cHCSM_CKPT_VERSION = 2;
+const int cHCSM_CKPT_MAGIC   = 0xC4C7C4C7;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// An in-memory archive of scenario state that can be stored to and loaded
+// from a file.  Once an error has been detected (a read past the end of
+// the data or a section tag mismatch) all further Get calls leave their
+// argument unchanged and IsValid returns false.
+//
+class CHcsmCheckpoint
+{
+public:
+	CHcsmCheckpoint();
+	~CHcsmCheckpoint();
+
+	void Clear( void );
+	void Rewind( void );
+	bool Store( const string& cFileName ) const;
+	bool Load( const string& cFileName );
+
+	bool IsValid( void ) const { return !m_error; }
+	const string& GetError( void ) const { return m_errorMsg; }
+	void SetError( const string& cMsg );
+	bool IsAtEnd( void ) const { return m_readPos >= m_data.size(); }
+	const vector<char>& GetData( void ) const { return m_data; }
+
+	void BeginSection( const char* cpTag );
+	bool CheckSection( const char* cpTag );
+
+	void PutBytes( const void* cpData, size_t size );
+	bool GetBytes( void* pData, size_t size );
+
+	// arithmetic values and enumerations
+	template<class T> void Put( const T& cVal );
+	template<class T> void Get( T& val );
+
+	void Put( const string& cVal );
+	void Get( string& val );
+	void Put( const char* cpVal ) { Put( string( cpVal ) ); }
+	void Put( const CPoint2D& cVal );
+	void Get( CPoint2D& val );
+	void Put( const CVector2D& cVal );
+	void Get( CVector2D& val );
+	void Put( const CPoint3D& cVal );
+	void Get( CPoint3D& val );
+	void Put( const CVector3D& cVal );
+	void Get( CVector3D& val );
+
+	template<class T> void Put( const vector<T>& cVal );
+	template<class T> void Get( vector<T>& val );
+	template<class T> void Put( const deque<T>& cVal );
+	template<class T> void Get( deque<T>& val );
+
+	// structures that hold no pointers or classes
+	template<class T> void PutPod( const T& cVal );
+	template<class T> void GetPod( T& val );
+
+	void Put( const CRandNumGen& cVal );
+	void Get( CRandNumGen& val );
+
+	// CVED road items
+	void Put( const CVED::CRoadPos& cVal );
+	void Get( CVED::CRoadPos& val, const CVED::CCved& cCved );
+	void Put( const CVED::CRoad& cVal );
+	void Get( CVED::CRoad& val, const CVED::CCved& cCved );
+	void Put( const CVED::CLane& cVal );
+	void Get( CVED::CLane& val, const CVED::CCved& cCved );
+	void Put( const CVED::CIntrsctn& cVal );
+	void Get( CVED::CIntrsctn& val, const CVED::CCved& cCved );
+	void Put( const CVED::CCrdr& cVal );
+	void Get( CVED::CCrdr& val, const CVED::CCved& cCved );
+	void Put( const CVED::CPath& cVal );
+	void Get( CVED::CPath& val, const CVED::CCved& cCved );
+
+	void  SetLink( const string& cName, void* pObj );
+	void* TakeLink( const string& cName );
+
+private:
+	vector<char>         m_data;
+	size_t               m_readPos;
+	bool                 m_error;
+	string               m_errorMsg;
+	map<string, void*>   m_links;
+};
+
+template<class T>
+void
+CHcsmCheckpoint::Put( const T& cVal )
+{
+	static_assert(
+		is_arithmetic<T>::value || is_enum<T>::value,
+		"CHcsmCheckpoint::Put needs an overload for this type"
+		);
+	PutBytes( &cVal, sizeof( T ) );
+}
+
+template<class T>
+void
+CHcsmCheckpoint::Get( T& val )
+{
+	static_assert(
+		is_arithmetic<T>::value || is_enum<T>::value,
+		"CHcsmCheckpoint::Get needs an overload for this type"
+		);
+	T tmp;
+	if ( GetBytes( &tmp, sizeof( T ) ) ) val = tmp;
+}
+
+template<class T>
+void
+CHcsmCheckpoint::Put( const vector<T>& cVal )
+{
+	Put( (int) cVal.size() );
+	for ( size_t i = 0; i < cVal.size(); i++ ) {
+		Put( (const T&) cVal[i] );
+	}
+}
+
+template<class T>
+void
+CHcsmCheckpoint::Get( vector<T>& val )
+{
+	int size = 0;
+	Get( size );
+	if ( !IsValid() || size < 0 || (size_t) size > m_data.size() ) {
+		SetError( "bad vector size" );
+		return;
+	}
+
+	vector<T> tmp( size );
+	for ( int i = 0; i < size; i++ ) {
+		T elem;
+		Get( elem );
+		tmp[i] = elem;
+	}
+	if ( IsValid() ) val.swap( tmp );
+}
+
+template<class T>
+void
+CHcsmCheckpoint::Put( const deque<T>& cVal )
+{
+	Put( (int) cVal.size() );
+	for ( size_t i = 0; i < cVal.size(); i++ ) {
+		Put( (const T&) cVal[i] );
+	}
+}
+
+template<class T>
+void
+CHcsmCheckpoint::Get( deque<T>& val )
+{
+	int size = 0;
+	Get( size );
+	if ( !IsValid() || size < 0 || (size_t) size > m_data.size() ) {
+		SetError( "bad deque size" );
+		return;
+	}
+
+	deque<T> tmp;
+	for ( int i = 0; i < size; i++ ) {
+		T elem;
+		Get( elem );
+		tmp.push_back( elem );
+	}
+	if ( IsValid() ) val.swap( tmp );
+}
+
+template<class T>
+void
+CHcsmCheckpoint::PutPod( const T& cVal )
+{
+	static_assert(
+		is_trivially_copyable<T>::value,
+		"CHcsmCheckpoint::PutPod needs a type without pointers or classes"
+		);
+	PutBytes( &cVal, sizeof( T ) );
+}
+
+template<class T>
+void
+CHcsmCheckpoint::GetPod( T& val )
+{
+	static_assert(
+		is_trivially_copyable<T>::value,
+		"CHcsmCheckpoint::GetPod needs a type without pointers or classes"
+		);
+	GetBytes( &val, sizeof( T ) );
+}
+
+#endif // _HCSMCHECKPOINT_H_
@@ -52,6 +52,11 @@ CHcsmClient::CHcsmClient()
 
 	m_GetDynObjTimeSend = 0.0;
 	m_GetDynObjTimeRecv = 0.0;
+
+	m_WireSock    = cWIRE_NO_SOCK;
+	m_WireSeq     = 1;
+	m_WireLastAck = 0;
+	m_WireFrame   = -1;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -66,6 +71,7 @@ CHcsmClient::CHcsmClient()
 //
 CHcsmClient::~CHcsmClient()
 {
+	CloseWire();
 #if defined(_WIN32) && defined(_M_IX86)
 	hrt_timer_free(m_Timer);
 #endif
@@ -1483,3 +1489,282 @@ CHcsmClient::ConnectToDataSock(void)
 	}
 	return true;
 }
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Connect to the Gateway using the compact wire protocol.
+//
+// Remarks:
+// The wire protocol is independent of the mode of the library and of
+// the command and data sockets.  Once connected, call WireSubscribe to
+// start receiving object updates and WirePoll to process them; the
+// objects are then available through GetWireObjs.
+//
+// Arguments:
+// IpAddr - the ip address or ip name of the machine running the Gateway
+// port   - the port the Gateway listens for wire protocol connections
+//
+// Returns:
+// True to indicate success or false to indicate problems.  If the function
+// returns false, call the GetLastError function for diagnostics.
+//
+bool
+CHcsmClient::InitWire(const string &IpAddr, int port)
+{
+	CloseWire();
+
+	SOCKET sock = ConnectToSocket(IpAddr.c_str(), port);
+	if ( sock < 0 || !WireSetNonBlocking(sock) ) {
+		if ( sock >= 0 ) CloseSocket(sock);
+		m_ErrorCode = EModeSocketComm;
+		m_ErrorMsg  = "Cannot connect to wire socket (is HCSM running?)";
+		return false;
+	}
+
+	m_WireSock = sock;
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Close the wire protocol connection and discard the objects
+// received through it.
+//
+void
+CHcsmClient::CloseWire(void)
+{
+	if ( m_WireSock != cWIRE_NO_SOCK ) {
+		CloseSocket(m_WireSock);
+		m_WireSock = cWIRE_NO_SOCK;
+	}
+	m_WireCmds.clear();
+	m_WireIn.clear();
+	m_WireObjs.clear();
+	m_WireFrame = -1;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Ask for object updates every so many frames.
+//
+// Remarks:
+// Like all Wire* commands, the request is queued and sent, along with
+// any other queued commands, by the next call to WireFlush.
+//
+// Arguments:
+// interval - frames between updates; 0 stops the updates
+//
+bool
+CHcsmClient::WireSubscribe(int interval)
+{
+	return QueueWireCmd(eWIRE_SUBSCRIBE, interval < 0 ? 0 : interval);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Ask for all objects to be sent in full with the next
+// update, whether subscribed or not.
+//
+bool
+CHcsmClient::WireRequestSnapshot(void)
+{
+	return QueueWireCmd(eWIRE_SNAPSHOT);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Send a high level command to an HCSM under remote control.
+//
+// Remarks:
+// This is the wire protocol equivalent of ControlObj.  Any number of
+// commands can be queued and are delivered in a single round trip by
+// WireFlush.
+//
+// Arguments:
+// ObjId - the HCSM to control
+// Cmd   - the command
+//
+bool
+CHcsmClient::WireControlObj(int ObjId, const TRemCntrlCmd &Cmd)
+{
+	return QueueWireCmd(eWIRE_CONTROLOBJ, ObjId, Cmd.command, Cmd.val);
+}
+
+
+bool
+CHcsmClient::QueueWireCmd(EWireOp op, int a0, int a1, int a2)
+{
+	if ( m_WireSock == cWIRE_NO_SOCK ) {
+		m_ErrorCode = EModeError;
+		m_ErrorMsg  = "wire protocol has not been initialized";
+		return false;
+	}
+
+	TWireCmd cmd;
+	cmd.op      = op;
+	cmd.args[0] = a0;
+	cmd.args[1] = a1;
+	cmd.args[2] = a2;
+	m_WireCmds.push_back(cmd);
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Send all queued wire commands.
+//
+// Remarks:
+// The commands are packed into as few frames as possible, each of which
+// is acknowledged by the Gateway.  The function waits until everything
+// has been handed to the network, but not for the acknowledgments; those
+// are processed by WirePoll.
+//
+// Returns:
+// True to indicate success or false to indicate problems.  If the function
+// returns false, call the GetLastError function for diagnostics.
+//
+bool
+CHcsmClient::WireFlush(void)
+{
+	if ( m_WireSock == cWIRE_NO_SOCK ) {
+		m_ErrorCode = EModeError;
+		m_ErrorMsg  = "wire protocol has not been initialized";
+		return false;
+	}
+	if ( m_WireCmds.empty() ) return true;
+
+	vector<unsigned char> out;
+	CWireWriter           writer(out);
+	const size_t          cMaxRecs = 255;
+
+	for ( size_t i = 0; i < m_WireCmds.size(); i++ ) {
+		if ( i % cMaxRecs == 0 ) {
+			if ( i > 0 ) writer.EndFrame();
+			writer.BeginFrame(m_WireSeq++);
+		}
+
+		const TWireCmd &cCmd = m_WireCmds[i];
+		writer.BeginRecord(cCmd.op);
+		switch ( cCmd.op ) {
+		case eWIRE_SUBSCRIBE:
+			writer.PutVarint(cCmd.args[0]);
+			break;
+		case eWIRE_CONTROLOBJ:
+			writer.PutVarint(cCmd.args[0]);
+			writer.PutVarint(cCmd.args[1]);
+			writer.PutSigned(cCmd.args[2]);
+			break;
+		default:
+			break;
+		}
+		writer.EndRecord();
+	}
+	writer.EndFrame();
+	m_WireCmds.clear();
+
+	size_t sent = 0;
+	while ( sent < out.size() ) {
+		int n = WireSend(m_WireSock, &out[sent], (int)(out.size() - sent));
+		if ( n < 0 || ( n == 0 && WireWait(m_WireSock, true, 1000) < 0 ) ) {
+			m_ErrorCode = EModeSocketComm;
+			m_ErrorMsg  = "Could not send message.";
+			return false;
+		}
+		sent += n;
+	}
+
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Process what the Gateway has sent over the wire protocol.
+//
+// Remarks:
+// Applies all object updates received so far to the objects returned by
+// GetWireObjs and records the acknowledgments.  If nothing has arrived,
+// the function waits up to the specified time for something to arrive.
+//
+// Arguments:
+// timeoutMs - how long to wait for data, in milliseconds
+//
+// Returns:
+// False if the connection was lost or the Gateway sent invalid data.
+//
+bool
+CHcsmClient::WirePoll(int timeoutMs)
+{
+	if ( m_WireSock == cWIRE_NO_SOCK ) {
+		m_ErrorCode = EModeError;
+		m_ErrorMsg  = "wire protocol has not been initialized";
+		return false;
+	}
+
+	if ( WireWait(m_WireSock, false, timeoutMs) <= 0 ) return true;
+
+	if ( WireRecv(m_WireSock, m_WireIn) < 0 ) {
+		m_ErrorCode = EModeSocketComm;
+		m_ErrorMsg  = "Connection to the Gateway was lost.";
+		CloseWire();
+		return false;
+	}
+
+	size_t pos = 0;
+	while ( pos < m_WireIn.size() ) {
+		int size = WireFrameSize(&m_WireIn[pos], m_WireIn.size() - pos);
+		if ( size == 0 ) break;
+		if ( size < 0 || !ProcessWireFrame(&m_WireIn[pos], size) ) {
+			m_ErrorCode = EModeSocketComm;
+			m_ErrorMsg  = "Received invalid data from the Gateway.";
+			CloseWire();
+			return false;
+		}
+		pos += size;
+	}
+	m_WireIn.erase(m_WireIn.begin(), m_WireIn.begin() + pos);
+
+	return true;
+}
+
+
+bool
+CHcsmClient::ProcessWireFrame(const unsigned char *cpFrame, int size)
+{
+	unsigned int seq;
+	vector<pair<EWireOp, CWireReader> > recs;
+
+	if ( !WireForEachRecord(cpFrame, size, seq, recs) ) return false;
+
+	for ( size_t i = 0; i < recs.size(); i++ ) {
+		CWireReader &reader = recs[i].second;
+
+		switch ( recs[i].first ) {
+		case eWIRE_ACK:
+			m_WireLastAck = reader.GetU32();
+			break;
+
+		case eWIRE_OBJDELTA:
+			if ( !WireDecodeObjDelta(reader, m_WireFrame, m_WireObjs) ) {
+				return false;
+			}
+			break;
+
+		case eWIRE_ERROR:
+			reader.GetString(m_ErrorMsg);
+			m_ErrorCode = EError;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	return true;
+}
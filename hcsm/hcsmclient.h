@@ -21,6 +21,7 @@
 #endif
 #include "hcsmcollection.h"
 #include "hcsmconnect.h"
+#include "hcsmwire.h"
  
 #ifdef _PowerMAXOS
 #include <unistd.h>
@@ -141,6 +142,18 @@ public:
 	void GetDynObjTime(double &snd, double &rcv) const { 
 			snd = m_GetDynObjTimeSend; rcv = m_GetDynObjTimeRecv; };
 
+	// compact wire protocol, see hcsmwire.h
+	bool InitWire(const string &, int port = DEFAULT_WIRE_PORT);
+	void CloseWire(void);
+	bool WireSubscribe(int);
+	bool WireRequestSnapshot(void);
+	bool WireControlObj(int, const TRemCntrlCmd &);
+	bool WireFlush(void);
+	bool WirePoll(int);
+	const TWireObjMap& GetWireObjs(void) const { return m_WireObjs; };
+	int  GetWireFrame(void) const { return m_WireFrame; };
+	unsigned int GetWireLastAck(void) const { return m_WireLastAck; };
+
 private:
 	// library state
 	enum TState {
@@ -163,6 +176,22 @@ private:
 
 	double          m_GetDynObjTimeSend;
 	double          m_GetDynObjTimeRecv;
+
+	// wire protocol state; commands are queued until WireFlush
+	struct TWireCmd {
+		EWireOp     op;
+		int         args[3];
+	};
+	bool QueueWireCmd(EWireOp, int a0 = 0, int a1 = 0, int a2 = 0);
+	bool ProcessWireFrame(const unsigned char *, int);
+
+	TWireSock             m_WireSock;
+	vector<TWireCmd>      m_WireCmds;
+	vector<unsigned char> m_WireIn;
+	unsigned int          m_WireSeq;		// sequence of the next frame sent
+	unsigned int          m_WireLastAck;	// last sequence acknowledged
+	TWireObjMap           m_WireObjs;
+	int                   m_WireFrame;
 };
 
 
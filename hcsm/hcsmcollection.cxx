@@ -26,7 +26,10 @@ using namespace std;
 #include <cvedpub.h>
 
 #include <snoparse.h>
+#include <sstream>
 #include "hcsmcollection.h"
+#include "hcsmcheckpoint.h"
+#include "adoinfopool.h"
 
 const int cMAP_ERASE_ERROR = 0;
 
@@ -64,67 +67,12 @@ const int cMAP_ERASE_ERROR = 0;
 #define HLOG_DTOR_2          10501
 
 bool  CHcsmCollection::m_verbose;
-char  CHcsmCollection::m_sObjBtnDialValToHcsm[cOBJ_BTNDIAL_SIZE];
-char  CHcsmCollection::m_sExperiment[128];
-char  CHcsmCollection::m_sSubject[128];
-char  CHcsmCollection::m_sRun[128];
-char  CHcsmCollection::m_sRunInst[128];
 bool  CHcsmCollection::m_logActivities = false;;
 bool  CHcsmCollection::m_printActvLog;
-float CHcsmCollection::m_sSCC_Scen_Pos_X_Crossbeam;
-float CHcsmCollection::m_sSCC_Scen_Pos_Y_Carriage;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_X;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_Y;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_Z;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_Roll;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_Pitch;
-float CHcsmCollection::m_sSCC_Scen_Pos_Hex_Yaw;
-float CHcsmCollection::m_sSCC_Scen_Pos_TT;
-float CHcsmCollection::m_sAccelPedalPos;
-float CHcsmCollection::m_sBrakePedalForce;
-float CHcsmCollection::m_sSteeringWheelAngle;
-short CHcsmCollection::m_sCruiseControlIncoming;
-short CHcsmCollection::m_sCruiseControl;
-int   CHcsmCollection::m_sCisTurnSignal;
-float CHcsmCollection::m_sSpeedometerBackdrive;
-int   CHcsmCollection::m_sHorn;
-int   CHcsmCollection::m_sHornFiltered;
-
-int   CHcsmCollection::m_sRecasButton;
-float CHcsmCollection::m_sAuxiliaryButtons[20];
-int   CHcsmCollection::m_sBrakeCond[cBRAKE_COND_SIZE];
-int   CHcsmCollection::m_sTireCond[cTIRE_COND_SIZE];
-int   CHcsmCollection::m_sSteeringCond;
-int   CHcsmCollection::m_sAlertCond;
-int   CHcsmCollection::m_sInfoCond;
-int   CHcsmCollection::m_sCabComponentCond;
-int   CHcsmCollection::m_sSCC_Scenario_Stop_Ind;
-int   CHcsmCollection::m_sSCC_PlacePhoneCall;	// cell value
-int   CHcsmCollection::m_sPlacePhoneCallAge;	// frame on which cell value was set
-float CHcsmCollection::m_sLogStreams[cNUM_LOG_STREAMS];
-float CHcsmCollection::m_sLogStreamsExt[cNUM_LOG_STREAMS];
-char  CHcsmCollection::m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS_SIZE];
-int   CHcsmCollection::m_sSCC_DataRed_Segments[cNUM_DATARED_SEGMENTS_SIZE];
-float CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_SIZE];
-float CHcsmCollection::m_sSensorInfo[cSENSOR_INFO_SIZE];
-
-TDynObjData  CHcsmCollection::m_sDynObjData;
-int          CHcsmCollection::m_sDynObjDataSize;
-TStatObjData CHcsmCollection::m_sStatObjData;
-int          CHcsmCollection::m_sStatObjDataSize = 0;
-
-int CHcsmCollection::m_sHeadlightVisualState = 0; //<are the headlights on or off? matches SCC_HeadlightVisualState
-int CHcsmCollection::m_sHeadlightScenarioControl = 0; //<has the scenario asked to set the headlight state
-
-int   CHcsmCollection::m_sChangedStatObjOption[cMAX_CHANGED_STAT_OBJ];
-int   CHcsmCollection::m_sChangedStatObjId[cMAX_CHANGED_STAT_OBJ];
-short CHcsmCollection::m_sChangedStatObjDataSize = 0;
+
+
 const char cDefault[] = "Default";
 
-map<string, double>                          CHcsmCollection::m_exprVariables;
-map<string, shared_ptr<mt19937>>             CHcsmCollection::m_randomGenerators;
-map<string, CPoint3D>                        CHcsmCollection::m_exprPosVariables;
-map<string, vector< pair<string,double> > >  CHcsmCollection::m_varQueues;
 
 map<int, vector<float> >    CHcsmCollection::m_sDiGuyPathInfo; //<path for the DiGuys
 map<int, vector<float> >    CHcsmCollection::m_sDiGuyPathTimesInfo; //<optional time at node for DiGuys
@@ -132,15 +80,7 @@ map<int, vector<char> >     CHcsmCollection::m_sDiGuyPathActionInfo; //<optional
 
 vector<CDiGuyUpdateCommand> CHcsmCollection::m_sDiGuyCommandQueue;
 
-CActvLog         CHcsmCollection::m_sActvLog;
-int              CHcsmCollection::m_frame;
-map<CHcsm*, int> CHcsmCollection::m_hcsmMap;
-TWriteCellData   CHcsmCollection::m_sWriteCellData[cMAX_WRITE_CELL_DATA_SIZE];
-map<string,int>  CHcsmCollection::m_sAdditionalCellNamesToIds;
-int              CHcsmCollection::m_sWriteCellDataSize;
 
-TScenarioWriteCellData  CHcsmCollection::m_sScenarioWriteCellData[cMAX_SCENARIO_WRITE_CELL_EVENTS];
-int                     CHcsmCollection::m_sScenarioWriteCellDataSize = 0;
 TScenarioWriteCellData  CHcsmCollection::m_sScenarioWriteUniformData[cMAX_SET_UNIFORM_CELL_EVENTS];
 int                     CHcsmCollection::m_sScenarioWriteUniformDataSize = 0;
 TCabVisualOperations    CHcsmCollection::m_sCabOperations[cMAX_VISUAL_OPERATIONS];
@@ -152,92 +92,147 @@ int                     CHcsmCollection::m_sSetSwitchCmdsDataSize =0;
 CHcsmStaticLock         CHcsmCollection::m_sLockVisualOptions;
 
 
-float           CHcsmCollection::m_sFalseAlarmInfo[cFALSE_ALARM_SIZE];
-map<int,string> CHcsmCollection::m_sVisualDisplayText;
-string          CHcsmCollection::m_sPlayAudioText;
-string          CHcsmCollection::m_sVisualSettings;
-float           CHcsmCollection::m_sLaneDevInfo[cLANE_DEV_INFO_SIZE];
-float           CHcsmCollection::m_sSplineDevInfo[cLANE_DEV_INFO_SIZE];
-float           CHcsmCollection::m_sLaneDepartWarn[cLANE_DEPART_WARN_SIZE];
-short           CHcsmCollection::m_sLaneMarkingInfo[cLANE_MARKING_INFO_SIZE];
-float           CHcsmCollection::m_sOwnVehCurvature;
-
-int  CHcsmCollection::m_sHour = 12;
-int  CHcsmCollection::m_sMinute = 0;
-bool CHcsmCollection::m_sChangeTimeOfDay = false;
-
 bool CHcsmCollection::m_sDisableCurvature = false;
+bool CHcsmCollection::m_sAdoLod = false;
 
-#ifdef TTA_DIST_FOR_ODSS //HACK for demonstration
-double CHcsmCollection::m_sDistanceToInt = 0;
-#endif
-
-int   CHcsmCollection::m_sWarningLights;
-int   CHcsmCollection::m_sCollWarnAlg;
-float CHcsmCollection::m_sFcwInfo[4];
-short CHcsmCollection::m_sTimeToWarn;
-
-
-bool CHcsmCollection::m_sBUD_IsOn = false;
-bool CHcsmCollection::m_sLCW_IsOn = false;
-bool CHcsmCollection::m_sBLS_IsOn = false;
-bool CHcsmCollection::m_sFCW_IsOn = false;
-
-bool CHcsmCollection::m_sIsOnPath = false;
-CVED::CPath CHcsmCollection::m_sOwnshipPath;
-
-ELdwStatus CHcsmCollection::m_sLdwStatus = eLDW_NONE;
-EBswStatus CHcsmCollection::m_sBswStatus = eBSW_NONE;
-EFcwStatus CHcsmCollection::m_sFcwStatus = eFCW_NONE;
-float CHcsmCollection::m_sBackUpDistance = 35.0; //< current back up distance in feet
-
-bool                                   CHcsmCollection::m_sHapticSeat_IsEnabled = 0; //< whether haptic seat is enabled
-CHcsmCollection::eFlashingLightMode    CHcsmCollection::m_sFlashingLightMode = CHcsmCollection::eNO_LIGHTS; //< flashing lights
-CHcsmCollection::eBUDCameraDisplayMode CHcsmCollection::m_sBUDCameraDisplayMode = CHcsmCollection::eNO_DISPLAY; //< backup camera display and distance bar
-
-float CHcsmCollection::m_sBUDBarWarnLowDist = 30.0;  //< the backup distance in feet at which the distance bar starts to grow
-float CHcsmCollection::m_sBUDBarWarnHighDist = 1.0; //< the backup distance at which the distance bar reaches maximum warning level
-bool  CHcsmCollection::m_sBSWCamera_IsEnabled  = 0; //< whether blind spot warning camera is enabled
-bool  CHcsmCollection::m_sIPAlert_IsEnabled	 = 0; //< whether alert icons in instrument panel is enabled
 
 HANDLE          CHcsmCollection::m_sLastGoodLocationMutex = NULL; //< Mutex Loc for last good location
 float           CHcsmCollection::m_sLastGoodLocation[3]; //< last location the Ext Driver was on the Path
 CHcsmStaticLock CHcsmCollection::m_cabSettingsCriticalSection; //< Critical Section for Cab Settings
 CHcsmStaticLock CHcsmCollection::m_DiGuyPathCriticalSection; //< Critical Section for Cab Settings
 
-#ifdef AUDIO_TRIGGER_BYPASS
-int CHcsmCollection::m_sAudio_Trigger = 0;
-short CHcsmCollection::m_sACC_On = 0;
-#endif
-short CHcsmCollection::m_sSensor_Config[cSENSOR_CONFIG_SIZE] = {400,16,1};
 
 #if USING_RTEXPSLITE == 0
 RTEX::SubsysBase* CHcsmCollection::m_spRTEX = NULL;
 #endif
 
-float CHcsmCollection::m_sSirenEffect = 0;
-float CHcsmCollection::m_sSirenSpeed = -1;
-
-short CHcsmCollection::m_sACC_Warning = 0;
-short CHcsmCollection::m_sCruise_State= 0;
-float CHcsmCollection::m_sCruise_SetSpeed = 0;
-float CHcsmCollection::m_sACC_Gap = 0;
-short CHcsmCollection::m_sALF_State = 0;
-int   CHcsmCollection::m_sLDW_Severity = 0;
-int   CHcsmCollection::m_sFCW_Severity = 0;
 
 COnScreenGraph CHcsmCollection::m_sDisplayGraph;
-bool CHcsmCollection::m_sGraphIsOn = false;
 
-float CHcsmCollection::m_sOwnVehDistOnPath = 0;
-double CHcsmCollection::m_sSmoothForwardRoadVector[3] = {1.0,0,0};
 TReadCellFuncptr CHcsmCollection::ReadCellNumeric = NULL;
 
 
 bool  CHcsmCollection::m_ExternalDriverRehearsalControl = false;
-bool  CHcsmCollection::m_sMakeOwnVehicleChangeLanesLeft = false;
-bool  CHcsmCollection::m_sMakeOwnVehicleChangeLanesRight = false;
-float CHcsmCollection::m_sOwnVehicleSpeed = 55;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Initializes the scenario state of a collection.
+//
+// Remarks:  The members get the values they had as static members before
+//   any scenario ran.
+//
+//////////////////////////////////////////////////////////////////////////////
+CHcsmContext::CHcsmContext()
+{
+	memset( m_sObjBtnDialValToHcsm, 0, sizeof( m_sObjBtnDialValToHcsm ) );
+	memset( m_sExperiment, 0, sizeof( m_sExperiment ) );
+	memset( m_sSubject, 0, sizeof( m_sSubject ) );
+	memset( m_sRun, 0, sizeof( m_sRun ) );
+	memset( m_sRunInst, 0, sizeof( m_sRunInst ) );
+	m_sSCC_Scen_Pos_X_Crossbeam = 0;
+	m_sSCC_Scen_Pos_Y_Carriage = 0;
+	m_sSCC_Scen_Pos_Hex_X = 0;
+	m_sSCC_Scen_Pos_Hex_Y = 0;
+	m_sSCC_Scen_Pos_Hex_Z = 0;
+	m_sSCC_Scen_Pos_Hex_Roll = 0;
+	m_sSCC_Scen_Pos_Hex_Pitch = 0;
+	m_sSCC_Scen_Pos_Hex_Yaw = 0;
+	m_sSCC_Scen_Pos_TT = 0;
+	m_sAccelPedalPos = 0;
+	m_sBrakePedalForce = 0;
+	m_sSteeringWheelAngle = 0;
+	m_sCruiseControlIncoming = 0;
+	m_sCruiseControl = 0;
+	m_sCisTurnSignal = 0;
+	m_sSpeedometerBackdrive = 0;
+	m_sHorn = 0;
+	m_sHornFiltered = 0;
+	m_sRecasButton = 0;
+	memset( m_sAuxiliaryButtons, 0, sizeof( m_sAuxiliaryButtons ) );
+	memset( m_sBrakeCond, 0, sizeof( m_sBrakeCond ) );
+	memset( m_sTireCond, 0, sizeof( m_sTireCond ) );
+	m_sSteeringCond = 0;
+	m_sAlertCond = 0;
+	m_sInfoCond = 0;
+	m_sCabComponentCond = 0;
+	m_sSCC_Scenario_Stop_Ind = 0;
+	m_sSCC_PlacePhoneCall = 0;
+	m_sPlacePhoneCallAge = 0;
+	memset( m_sLogStreams, 0, sizeof( m_sLogStreams ) );
+	memset( m_sLogStreamsExt, 0, sizeof( m_sLogStreamsExt ) );
+	memset( m_sSCC_DataRed_Params, 0, sizeof( m_sSCC_DataRed_Params ) );
+	memset( m_sSCC_DataRed_Segments, 0, sizeof( m_sSCC_DataRed_Segments ) );
+	memset( m_sFollowInfo, 0, sizeof( m_sFollowInfo ) );
+	memset( m_sSensorInfo, 0, sizeof( m_sSensorInfo ) );
+	memset( m_sLaneDevInfo, 0, sizeof( m_sLaneDevInfo ) );
+	memset( m_sLaneDepartWarn, 0, sizeof( m_sLaneDepartWarn ) );
+	memset( m_sSplineDevInfo, 0, sizeof( m_sSplineDevInfo ) );
+	memset( m_sLaneMarkingInfo, 0, sizeof( m_sLaneMarkingInfo ) );
+	m_sOwnVehCurvature = 0;
+	m_sOwnVehDistOnPath = 0;
+	m_sSmoothForwardRoadVector[0] = 1.0;
+	m_sSmoothForwardRoadVector[1] = 0.0;
+	m_sSmoothForwardRoadVector[2] = 0.0;
+	memset( &m_sDynObjData, 0, sizeof( m_sDynObjData ) );
+	m_sDynObjDataSize = 0;
+	m_sHeadlightVisualState = 0;
+	m_sHeadlightScenarioControl = 0;
+	memset( &m_sStatObjData, 0, sizeof( m_sStatObjData ) );
+	m_sStatObjDataSize = 0;
+	memset( m_sChangedStatObjOption, 0, sizeof( m_sChangedStatObjOption ) );
+	memset( m_sChangedStatObjId, 0, sizeof( m_sChangedStatObjId ) );
+	m_sChangedStatObjDataSize = 0;
+	m_sWriteCellDataSize = 0;
+	m_sScenarioWriteCellDataSize = 0;
+	memset( m_sFalseAlarmInfo, 0, sizeof( m_sFalseAlarmInfo ) );
+	m_sWarningLights = 0;
+	m_sCollWarnAlg = 0;
+	memset( m_sFcwInfo, 0, sizeof( m_sFcwInfo ) );
+	m_sTimeToWarn = 0;
+	m_sBUD_IsOn = false;
+	m_sLCW_IsOn = false;
+	m_sBLS_IsOn = false;
+	m_sFCW_IsOn = false;
+	m_sIsOnPath = false;
+	m_sLdwStatus = eLDW_NONE;
+	m_sBswStatus = eBSW_NONE;
+	m_sFcwStatus = eFCW_NONE;
+	m_sBackUpDistance = 35.0f;
+	m_sACC_Warning = 0;
+	m_sCruise_State = 0;
+	m_sCruise_SetSpeed = 0;
+	m_sACC_Gap = 0;
+	m_sALF_State = 0;
+	m_sLDW_Severity = 0;
+	m_sFCW_Severity = 0;
+	m_sSirenEffect = 0;
+	m_sSirenSpeed = -1;
+	m_sHour = 12;
+	m_sMinute = 0;
+	m_sChangeTimeOfDay = false;
+	m_sSensor_Config[eSENSOR_INDEX_MAX_RANGE] = 400;
+	m_sSensor_Config[eSENSOR_INDEX_CONE_ANGLE] = 16;
+	m_sSensor_Config[eSENSOR_INDEX_LANE_CHECK] = 1;
+#ifdef AUDIO_TRIGGER_BYPASS
+	m_sACC_On = 0;
+	m_sAudio_Trigger = 0;
+#endif
+#ifdef TTA_DIST_FOR_ODSS
+	m_sDistanceToInt = 0;
+#endif
+	m_sHapticSeat_IsEnabled = false;
+	m_sFlashingLightMode = eNO_LIGHTS;
+	m_sBUDCameraDisplayMode = eNO_DISPLAY;
+	m_sBUDBarWarnLowDist = 30.0f;
+	m_sBUDBarWarnHighDist = 1.0f;
+	m_sBSWCamera_IsEnabled = false;
+	m_sIPAlert_IsEnabled = false;
+	m_sGraphIsOn = false;
+	m_sMakeOwnVehicleChangeLanesLeft = false;
+	m_sMakeOwnVehicleChangeLanesRight = false;
+	m_sOwnVehicleSpeed = 55;
+	m_sDataRedCounter = 0;
+}
 
 //bool (CHcsmCollection::*ReadCellNumeric)(const string&, int, float&) = NULL;
 //////////////////////////////////////////////////////////////////////////////
@@ -247,7 +242,8 @@ float CHcsmCollection::m_sOwnVehicleSpeed = 55;
 
 CHcsmCollection::CHcsmCollection(
 			const double timeStepDuration,
-			CCved* pCved
+			CCved* pCved,
+			int runIndex
 			)
 {
 	m_numHcsm = 0;
@@ -268,8 +264,10 @@ CHcsmCollection::CHcsmCollection(
 	// incremented at the end of every call to ExecuteAllHcsm.
 	//
 	m_frame = 1;
+	m_runIndex = runIndex;
 	m_timeStepDuration = timeStepDuration;
 	m_pCved = pCved;
+	m_pAdoInfoPool = new CAdoInfoPool;
 //	int slots = m_memLog.CreateMem( 64 * 1024 );
 //	gout << "** Creating memory log with " << slots << " slots" << endl;
 	bool result = m_memLog.Init();
@@ -301,7 +299,7 @@ CHcsmCollection::CHcsmCollection(
 	//
 	// Activity event logs.
 	//
-	m_sActvLog.Init();
+	m_ctx.m_sActvLog.Init();
 
 	//
 	// Hcsms can use this instance of the rng for any purpose they
@@ -309,23 +307,35 @@ CHcsmCollection::CHcsmCollection(
 	//
 	m_rng.SetAllSeeds( 2, 1 );
 
+	//
+	// The generators shared by the ADOs.  The run index keeps the
+	// runs of a Monte Carlo batch apart.
+	//
+	m_adoFollowRng.SetAllSeeds( 5 + m_runIndex, 5 );
+	for( i = 0; i < 5; i++ )
+	{
+		m_adoFollowStreams[i] = m_adoFollowRng.GetStream();
+	}
+	m_adoGapRng.SetAllSeeds( 5 + m_runIndex, 5 );
+	m_adoGapStream = m_adoGapRng.GetStream();
+
 	// Log streams.
 	for( i = 0; i < cNUM_LOG_STREAMS; i++ )
 	{
-		CHcsmCollection::m_sLogStreams[i] = 0.0;
+		m_ctx.m_sLogStreams[i] = 0.0;
 	}
 	for( i = 0; i < cNUM_LOG_STREAMS; i++ )
 	{
-		CHcsmCollection::m_sLogStreamsExt[i] = 0.0;
+		m_ctx.m_sLogStreamsExt[i] = 0.0;
 	}
 
 	// Initialize data reduction segments and parameters.
 	for( i = 0; i < cNUM_DATARED_SEGMENTS_SIZE; i++ )
 	{
-		CHcsmCollection::m_sSCC_DataRed_Segments[i] = 0;
+		m_ctx.m_sSCC_DataRed_Segments[i] = 0;
 	}
 	memset(
-		CHcsmCollection::m_sSCC_DataRed_Params,
+		m_ctx.m_sSCC_DataRed_Params,
 		0,
 		cNUM_DATARED_PARAMS_SIZE
 		);
@@ -334,45 +344,45 @@ CHcsmCollection::CHcsmCollection(
 	int cnt;
 	for( cnt = 0; cnt < cBRAKE_COND_SIZE; cnt++ )
 	{
-		CHcsmCollection::m_sBrakeCond[cnt] = 0;
+		m_ctx.m_sBrakeCond[cnt] = 0;
 	}
 	for( cnt = 0; cnt < cTIRE_COND_SIZE; cnt++ )
 	{
-		CHcsmCollection::m_sTireCond[cnt] = 0;
+		m_ctx.m_sTireCond[cnt] = 0;
 	}
 
 	//
 	// Dynamic object data.
 	//
-	CHcsmCollection::m_sDynObjDataSize = 0;
+	m_ctx.m_sDynObjDataSize = 0;
 
 	//
 	// Follow info.
 	//
-	m_sFollowInfo[0] = -1.0f; // no object in front
+	m_ctx.m_sFollowInfo[0] = -1.0f; // no object in front
 	for( i = 1; i < cFOLLOW_INFO_SIZE; i++ )
 	{
-		m_sFollowInfo[i] = 0.0f;
+		m_ctx.m_sFollowInfo[i] = 0.0f;
 	}
 
 	//
 	// Sensor info.
 	//
-	m_sSensorInfo[0] = -1.0f; // no object in front
+	m_ctx.m_sSensorInfo[0] = -1.0f; // no object in front
 	for( i = 1; i < cSENSOR_INFO_SIZE; i++ )
 	{
-		m_sSensorInfo[i] = 0.0f;
+		m_ctx.m_sSensorInfo[i] = 0.0f;
 	}
 
-	m_sWriteCellDataSize = 0;
+	m_ctx.m_sWriteCellDataSize = 0;
 	for( i = 0; i < cMAX_WRITE_CELL_DATA_SIZE; i++ )
 	{
-		m_sWriteCellData[i].elemId = -1;
+		m_ctx.m_sWriteCellData[i].elemId = -1;
 	}
 
 	for( i = 0; i < cFALSE_ALARM_SIZE; i++ )
 	{
-		m_sFalseAlarmInfo[i] = 0.0f;
+		m_ctx.m_sFalseAlarmInfo[i] = 0.0f;
 	}
 
 	//
@@ -388,30 +398,30 @@ CHcsmCollection::CHcsmCollection(
     m_randomGenerators[cDefault] = shared_ptr<mt19937>(new std::mt19937(std::random_device()));
 	m_exprPosVariables.clear();
 
-	m_sVisualDisplayText.clear();
-	m_sPlayAudioText.clear();
-	m_sVisualSettings.clear();
+	m_ctx.m_sVisualDisplayText.clear();
+	m_ctx.m_sPlayAudioText.clear();
+	m_ctx.m_sVisualSettings.clear();
 
 	//
 	// Initialize the static member variables.
 	//
 	for( i = 0; i < cLANE_DEV_INFO_SIZE; i++ )
 	{
-		m_sLaneDevInfo[i] = 0.0f;
+		m_ctx.m_sLaneDevInfo[i] = 0.0f;
 	}
 
 	for( i = 0; i < cLANE_DEPART_WARN_SIZE; i++ )
 	{
-		m_sLaneDepartWarn[i] = 0.0f;
+		m_ctx.m_sLaneDepartWarn[i] = 0.0f;
 	}
 
-	m_sOwnVehCurvature = 0.0f;
-	m_sSCC_Scenario_Stop_Ind = 0;
+	m_ctx.m_sOwnVehCurvature = 0.0f;
+	m_ctx.m_sSCC_Scenario_Stop_Ind = 0;
 
 	if (m_sLastGoodLocationMutex == NULL){ //this is a static
 		m_sLastGoodLocationMutex  = CreateMutex(NULL,FALSE,"LastLocationMUTEX");
 	}
-	m_sOwnshipPath.SetCved( m_pCved );
+	m_ctx.m_sOwnshipPath.SetCved( m_pCved );
 }
 
 CHcsmCollection::~CHcsmCollection()
@@ -419,8 +429,10 @@ CHcsmCollection::~CHcsmCollection()
 
 	MemLog( HLOG_DTOR_1, 0, "collection dtor 1" );
 
-	// cleanup all Hcsms
+	// cleanup all Hcsms; the Ados give their storage back to the pool
 	DeleteAllHcsm();
+	delete m_pAdoInfoPool;
+	m_pAdoInfoPool = NULL;
 
 	MemLog( HLOG_DTOR_2, 0, "collection dtor 2" );
 
@@ -469,10 +481,10 @@ CHcsmCollection::~CHcsmCollection()
 			actvLogFileName += "\\";
 		}
 
-		if( strlen( m_sRunInst ) > 0 )
+		if( strlen( m_ctx.m_sRunInst ) > 0 )
 		{
 			actvLogFileName += "actvlog_";
-			actvLogFileName += m_sRunInst;
+			actvLogFileName += m_ctx.m_sRunInst;
 		}
 		else
 		{
@@ -482,7 +494,7 @@ CHcsmCollection::~CHcsmCollection()
 #endif
 		gout << "*** Writing behaviors activity log to " << actvLogFileName;
 		gout << endl;
-		m_sActvLog.Store( actvLogFileName );
+		m_ctx.m_sActvLog.Store( actvLogFileName );
 	}
 }
 
@@ -517,8 +529,43 @@ CHcsm* CHcsmCollection::CreateHcsm(
 			const CSnoBlock& cSnoBlock
 			)
 {
+	int templateId = GetTemplateId( cHcsmName );
+	if( templateId < 0 )
+	{
+		MemLog( 0, HLOG_CREATE_6, 0 );
+		// invalid Hcsm name
+		gout << MyName() << "::CreateHcsm: Unknown Hcsm Name!" << endl;
+		return NULL;
+	}
+
+	return CreateHcsm( templateId, cSnoBlock );
+}  // CreateHcsm
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Creates an HCSM instance given its template's id.
+//
+// Remarks:  Same as the version that takes the template's name, for
+//   callers that create many HCSMs of a known template and don't want to
+//   look the name up every time.  The ids are the EHcsmTemplateId values
+//   generated along with the HCSM classes, or the result of GetTemplateId.
+//
+// Arguments:
+//   templateId - The HCSM template's id.
+//   snoBlock - The HCSM initialization information from the parser.
+//
+// Returns:  This function returns a pointer to the root HCSM.  If returns a
+//   NULL pointer if there is an error.
+//
+//////////////////////////////////////////////////////////////////////////////
+CHcsm* CHcsmCollection::CreateHcsm(
+			int templateId,
+			const CSnoBlock& cSnoBlock
+			)
+{
 
 	CHcsm* pHcsm = NULL;
+	const char* cHcsmName = GetTemplateName( templateId );
 
 	MemLog( 0, HLOG_CREATE_START, 0 );
 
@@ -528,13 +575,14 @@ CHcsm* CHcsmCollection::CreateHcsm(
 	//
 	try
 	{
-		// find the type that matches the hcsm name string
+		// find the type that matches the hcsm id
 #if defined (EDO_CONTROLLER)
-		if (cHcsmName != "Ado"
+		static const int cAdoTemplateId = GetTemplateId( "Ado" );
+		if (templateId != cAdoTemplateId
 			|| cSnoBlock.GetName() == "ExternalDriver")
-			pHcsm = GetClassFromTemplateName( cHcsmName, cSnoBlock );
+			pHcsm = GetClassFromTemplateId( templateId, cSnoBlock );
 #else
-		pHcsm = GetClassFromTemplateName( cHcsmName, cSnoBlock );
+		pHcsm = GetClassFromTemplateId( templateId, cSnoBlock );
 #endif
 		MemLog( 0, HLOG_CREATE_2, 0 );
 	}
@@ -851,6 +899,768 @@ void CHcsmCollection::ProcessHcsmDelete()
 
 }  // ProcessHcsmDelete
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Checkpoint helpers.  Both the save and the restore path go through the
+// same function so that the order in which values are handled can't get
+// out of sync.
+//
+//////////////////////////////////////////////////////////////////////////////
+template<class T>
+static void
+CkptValue( CHcsmCheckpoint& ckpt, bool save, T& val )
+{
+	if( save )
+		ckpt.Put( val );
+	else
+		ckpt.Get( val );
+}
+
+// for structures and arrays that hold no pointers or classes
+template<class T>
+static void
+CkptPod( CHcsmCheckpoint& ckpt, bool save, T& val )
+{
+	if( save )
+		ckpt.PutBytes( &val, sizeof( T ) );
+	else
+		ckpt.GetBytes( &val, sizeof( T ) );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves or restores the collection's static data.
+//
+// Remarks:  This covers the frame counter, the expression and position
+//   variables, the variable queues, the random number generators and the
+//   data that is exchanged with the cells every frame.  Inputs that the
+//   host overwrites every frame (pedals, steering, etc.) are not included.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to or read from.
+//   save - True to save, false to restore.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCollection::CheckpointStatics( CHcsmCheckpoint& ckpt, bool save )
+{
+	int size;
+
+	//
+	// Expression variables.
+	//
+	size = (int) m_exprVariables.size();
+	CkptValue( ckpt, save, size );
+	if( save )
+	{
+		map<string, double>::iterator itr;
+		for( itr = m_exprVariables.begin(); itr != m_exprVariables.end(); itr++ )
+		{
+			ckpt.Put( itr->first );
+			ckpt.Put( itr->second );
+		}
+	}
+	else
+	{
+		m_exprVariables.clear();
+		for( int i = 0; i < size && ckpt.IsValid(); i++ )
+		{
+			string name;
+			double value = 0.0;
+			ckpt.Get( name );
+			ckpt.Get( value );
+			m_exprVariables[name] = value;
+		}
+	}
+
+	//
+	// Position variables.
+	//
+	size = (int) m_exprPosVariables.size();
+	CkptValue( ckpt, save, size );
+	if( save )
+	{
+		map<string, CPoint3D>::iterator itr;
+		for( itr = m_exprPosVariables.begin(); itr != m_exprPosVariables.end(); itr++ )
+		{
+			ckpt.Put( itr->first );
+			ckpt.Put( itr->second );
+		}
+	}
+	else
+	{
+		m_exprPosVariables.clear();
+		for( int i = 0; i < size && ckpt.IsValid(); i++ )
+		{
+			string name;
+			CPoint3D value;
+			ckpt.Get( name );
+			ckpt.Get( value );
+			m_exprPosVariables[name] = value;
+		}
+	}
+
+	//
+	// Variable queues.
+	//
+	size = (int) m_varQueues.size();
+	CkptValue( ckpt, save, size );
+	if( save )
+	{
+		map<string, vector< pair<string,double> > >::iterator itr;
+		for( itr = m_varQueues.begin(); itr != m_varQueues.end(); itr++ )
+		{
+			ckpt.Put( itr->first );
+			ckpt.Put( (int) itr->second.size() );
+			for( size_t j = 0; j < itr->second.size(); j++ )
+			{
+				ckpt.Put( itr->second[j].first );
+				ckpt.Put( itr->second[j].second );
+			}
+		}
+	}
+	else
+	{
+		m_varQueues.clear();
+		for( int i = 0; i < size && ckpt.IsValid(); i++ )
+		{
+			string name;
+			int    queueSize = 0;
+			ckpt.Get( name );
+			ckpt.Get( queueSize );
+			vector< pair<string,double> >& queue = m_varQueues[name];
+			for( int j = 0; j < queueSize && ckpt.IsValid(); j++ )
+			{
+				pair<string, double> elem( "", 0.0 );
+				ckpt.Get( elem.first );
+				ckpt.Get( elem.second );
+				queue.push_back( elem );
+			}
+		}
+	}
+
+	//
+	// Random number generators; the standard library provides a
+	// textual representation of the complete engine state.
+	//
+	size = (int) m_randomGenerators.size();
+	CkptValue( ckpt, save, size );
+	if( save )
+	{
+		map<string, shared_ptr<mt19937>>::iterator itr;
+		for( itr = m_randomGenerators.begin(); itr != m_randomGenerators.end(); itr++ )
+		{
+			stringstream state;
+			state << *itr->second;
+			ckpt.Put( itr->first );
+			ckpt.Put( state.str() );
+		}
+	}
+	else
+	{
+		m_randomGenerators.clear();
+		for( int i = 0; i < size && ckpt.IsValid(); i++ )
+		{
+			string name;
+			string stateStr;
+			ckpt.Get( name );
+			ckpt.Get( stateStr );
+
+			shared_ptr<mt19937> gen = make_shared<mt19937>();
+			stringstream state( stateStr );
+			state >> *gen;
+			if( state.fail() )
+			{
+				ckpt.SetError( "bad state for random number generator " + name );
+				break;
+			}
+			m_randomGenerators[name] = gen;
+		}
+	}
+
+	//
+	// Data exchanged with the cells.
+	//
+	CkptPod( ckpt, save, m_ctx.m_sDynObjData );
+	CkptValue( ckpt, save, m_ctx.m_sDynObjDataSize );
+	CkptPod( ckpt, save, m_ctx.m_sStatObjData );
+	CkptValue( ckpt, save, m_ctx.m_sStatObjDataSize );
+	CkptPod( ckpt, save, m_ctx.m_sChangedStatObjOption );
+	CkptPod( ckpt, save, m_ctx.m_sChangedStatObjId );
+	CkptValue( ckpt, save, m_ctx.m_sChangedStatObjDataSize );
+	CkptPod( ckpt, save, m_ctx.m_sBrakeCond );
+	CkptPod( ckpt, save, m_ctx.m_sTireCond );
+	CkptValue( ckpt, save, m_ctx.m_sSteeringCond );
+	CkptValue( ckpt, save, m_ctx.m_sAlertCond );
+	CkptValue( ckpt, save, m_ctx.m_sInfoCond );
+	CkptValue( ckpt, save, m_ctx.m_sCabComponentCond );
+	CkptValue( ckpt, save, m_ctx.m_sSCC_Scenario_Stop_Ind );
+	CkptValue( ckpt, save, m_ctx.m_sSCC_PlacePhoneCall );
+	CkptValue( ckpt, save, m_ctx.m_sPlacePhoneCallAge );
+	CkptPod( ckpt, save, m_ctx.m_sLogStreams );
+	CkptPod( ckpt, save, m_ctx.m_sLogStreamsExt );
+	CkptPod( ckpt, save, m_ctx.m_sSCC_DataRed_Params );
+	CkptPod( ckpt, save, m_ctx.m_sSCC_DataRed_Segments );
+	CkptPod( ckpt, save, m_ctx.m_sFollowInfo );
+	CkptPod( ckpt, save, m_ctx.m_sSensorInfo );
+	CkptPod( ckpt, save, m_ctx.m_sLaneDevInfo );
+	CkptPod( ckpt, save, m_ctx.m_sLaneDepartWarn );
+	CkptPod( ckpt, save, m_ctx.m_sSplineDevInfo );
+	CkptPod( ckpt, save, m_ctx.m_sLaneMarkingInfo );
+	CkptValue( ckpt, save, m_ctx.m_sOwnVehCurvature );
+	CkptValue( ckpt, save, m_ctx.m_sOwnVehDistOnPath );
+	CkptPod( ckpt, save, m_ctx.m_sSmoothForwardRoadVector );
+	CkptValue( ckpt, save, m_ctx.m_sHeadlightVisualState );
+	CkptValue( ckpt, save, m_ctx.m_sHeadlightScenarioControl );
+	CkptPod( ckpt, save, m_ctx.m_sFalseAlarmInfo );
+	CkptValue( ckpt, save, m_ctx.m_sWarningLights );
+	CkptValue( ckpt, save, m_ctx.m_sCollWarnAlg );
+	CkptPod( ckpt, save, m_ctx.m_sFcwInfo );
+	CkptValue( ckpt, save, m_ctx.m_sTimeToWarn );
+	CkptValue( ckpt, save, m_ctx.m_sBUD_IsOn );
+	CkptValue( ckpt, save, m_ctx.m_sLCW_IsOn );
+	CkptValue( ckpt, save, m_ctx.m_sBLS_IsOn );
+	CkptValue( ckpt, save, m_ctx.m_sFCW_IsOn );
+	CkptValue( ckpt, save, m_ctx.m_sIsOnPath );
+	CkptValue( ckpt, save, m_ctx.m_sLdwStatus );
+	CkptValue( ckpt, save, m_ctx.m_sBswStatus );
+	CkptValue( ckpt, save, m_ctx.m_sFcwStatus );
+	CkptValue( ckpt, save, m_ctx.m_sBackUpDistance );
+	CkptValue( ckpt, save, m_ctx.m_sACC_Warning );
+	CkptValue( ckpt, save, m_ctx.m_sCruise_State );
+	CkptValue( ckpt, save, m_ctx.m_sCruise_SetSpeed );
+	CkptValue( ckpt, save, m_ctx.m_sACC_Gap );
+	CkptValue( ckpt, save, m_ctx.m_sALF_State );
+	CkptValue( ckpt, save, m_ctx.m_sLDW_Severity );
+	CkptValue( ckpt, save, m_ctx.m_sFCW_Severity );
+	CkptValue( ckpt, save, m_ctx.m_sSirenEffect );
+	CkptValue( ckpt, save, m_ctx.m_sSirenSpeed );
+	CkptValue( ckpt, save, m_ctx.m_sHour );
+	CkptValue( ckpt, save, m_ctx.m_sMinute );
+	CkptValue( ckpt, save, m_ctx.m_sChangeTimeOfDay );
+	CkptPod( ckpt, save, m_ctx.m_sSensor_Config );
+#ifdef AUDIO_TRIGGER_BYPASS
+	CkptValue( ckpt, save, m_ctx.m_sACC_On );
+	CkptValue( ckpt, save, m_ctx.m_sAudio_Trigger );
+#endif
+	CkptValue( ckpt, save, m_ctx.m_sHapticSeat_IsEnabled );
+	CkptValue( ckpt, save, m_ctx.m_sFlashingLightMode );
+	CkptValue( ckpt, save, m_ctx.m_sBUDCameraDisplayMode );
+	CkptValue( ckpt, save, m_ctx.m_sBUDBarWarnLowDist );
+	CkptValue( ckpt, save, m_ctx.m_sBUDBarWarnHighDist );
+	CkptValue( ckpt, save, m_ctx.m_sBSWCamera_IsEnabled );
+	CkptValue( ckpt, save, m_ctx.m_sIPAlert_IsEnabled );
+	CkptValue( ckpt, save, m_ctx.m_sGraphIsOn );
+	CkptValue( ckpt, save, m_ctx.m_sMakeOwnVehicleChangeLanesLeft );
+	CkptValue( ckpt, save, m_ctx.m_sMakeOwnVehicleChangeLanesRight );
+	CkptValue( ckpt, save, m_ctx.m_sOwnVehicleSpeed );
+	CkptValue( ckpt, save, m_ctx.m_sPlayAudioText );
+	CkptValue( ckpt, save, m_ctx.m_sVisualSettings );
+
+	size = (int) m_ctx.m_sVisualDisplayText.size();
+	CkptValue( ckpt, save, size );
+	if( save )
+	{
+		map<int, string>::iterator itr;
+		for( itr = m_ctx.m_sVisualDisplayText.begin(); itr != m_ctx.m_sVisualDisplayText.end(); itr++ )
+		{
+			ckpt.Put( itr->first );
+			ckpt.Put( itr->second );
+		}
+	}
+	else
+	{
+		m_ctx.m_sVisualDisplayText.clear();
+		for( int i = 0; i < size && ckpt.IsValid(); i++ )
+		{
+			int    location = 0;
+			string text;
+			ckpt.Get( location );
+			ckpt.Get( text );
+			m_ctx.m_sVisualDisplayText[location] = text;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves or restores the state that the Hcsms keep in CVED.
+//
+// Remarks:  The state of the traffic lights is restored.  The dynamic
+//   objects are recreated by the Hcsms that own them, with the ids they
+//   had, before this function runs; their pose, velocity and lights are
+//   then overwritten with the saved values.  Objects that could not be
+//   matched by id and name are reported.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to or read from.
+//   save - True to save, false to restore.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCollection::CheckpointCved( CHcsmCheckpoint& ckpt, bool save )
+{
+	if( save ) 
+		ckpt.BeginSection( "cved" );
+	else
+		ckpt.CheckSection( "cved" );
+
+	vector<int> objs;
+	int size;
+
+	//
+	// Traffic lights.
+	//
+	CObjTypeMask lightMask;
+	lightMask.Clear();
+	lightMask.Set( eCV_TRAFFIC_LIGHT );
+	if( save && m_pCved )  m_pCved->GetAllObjs( objs, lightMask );
+
+	size = (int) objs.size();
+	CkptValue( ckpt, save, size );
+	for( int i = 0; i < size && ckpt.IsValid(); i++ )
+	{
+		int id = save ? objs[i] : 0;
+		eCVTrafficLightState state = save ? m_pCved->GetTrafficLightState( id ) : eOFF;
+		CkptValue( ckpt, save, id );
+		CkptValue( ckpt, save, state );
+		if( !save && m_pCved && ckpt.IsValid() )
+		{
+			m_pCved->SetTrafficLightState( id, state );
+		}
+	}
+
+	//
+	// Dynamic objects.  Both buffers of the pose and velocity are
+	// handled, along with the lights, so that the next frame starts 
+	// from exactly the state the checkpoint was taken in.
+	//
+	objs.clear();
+	if( m_pCved )  m_pCved->GetAllDynamicObjs( objs );
+
+	int savedSize = (int) objs.size();
+	CkptValue( ckpt, save, savedSize );
+	int numDiff = 0;
+	for( int i = 0; i < savedSize && ckpt.IsValid(); i++ )
+	{
+		int       id = save ? objs[i] : -1;
+		string    name;
+		CPoint3D  pos, posImm;
+		CVector3D tan, tanImm, lat, latImm;
+		double    vel = 0.0, velImm = 0.0;
+		int       audioState = 0, visualState = 0;
+		CDynObj*  pObj = NULL;
+
+		if( save )
+		{
+			pObj = const_cast<CDynObj*>( m_pCved->BindObjIdToClass( id ) );
+			if( pObj )
+			{
+				name        = pObj->GetName();
+				pos         = pObj->GetPos();
+				posImm      = pObj->GetPosImm();
+				tan         = pObj->GetTan();
+				tanImm      = pObj->GetTanImm();
+				lat         = pObj->GetLat();
+				latImm      = pObj->GetLatImm();
+				vel         = pObj->GetVel();
+				velImm      = pObj->GetVelImm();
+				audioState  = pObj->GetAudioState();
+				visualState = pObj->GetVisualState();
+			}
+		}
+
+		CkptValue( ckpt, save, id );
+		CkptValue( ckpt, save, name );
+		CkptValue( ckpt, save, pos );
+		CkptValue( ckpt, save, posImm );
+		CkptValue( ckpt, save, tan );
+		CkptValue( ckpt, save, tanImm );
+		CkptValue( ckpt, save, lat );
+		CkptValue( ckpt, save, latImm );
+		CkptValue( ckpt, save, vel );
+		CkptValue( ckpt, save, velImm );
+		CkptValue( ckpt, save, audioState );
+		CkptValue( ckpt, save, visualState );
+		if( save || !ckpt.IsValid() )  continue;
+
+		//
+		// The owning Hcsms have recreated their objects by now; an
+		// object that is missing or that has a different name is
+		// reported but otherwise left alone.
+		//
+		if( m_pCved && m_pCved->IsObjValid( id ) )
+		{
+			pObj = const_cast<CDynObj*>( m_pCved->BindObjIdToClass( id ) );
+		}
+		if( !pObj || name != pObj->GetName() )
+		{
+			numDiff++;
+			if( m_verbose )
+			{
+				gout << MyName() << "::RestoreCheckpoint: object " << id;
+				gout << " (" << name << ") was not restored" << endl;
+			}
+			continue;
+		}
+
+		pObj->SetPos( pos, false );
+		pObj->SetTan( tan, false );
+		pObj->SetLat( lat, false );
+		pObj->SetVel( vel, false );
+		pObj->SetPos( posImm );
+		pObj->SetTan( tanImm );
+		pObj->SetLat( latImm );
+		pObj->SetVel( velImm );
+		pObj->SetAudioState( audioState );
+		pObj->SetVisualState( visualState );
+	}
+
+	if( !save && m_pCved )
+	{
+		m_pCved->GetAllDynamicObjs( objs );
+		if( numDiff > 0 || savedSize != (int) objs.size() )
+		{
+			gout << MyName() << "::RestoreCheckpoint: " << numDiff;
+			gout << " of " << savedSize << " dynamic objects were not ";
+			gout << "restored (" << objs.size() << " exist)" << endl;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves or restores the CRandNumGen generators.
+//
+// Remarks:  The Creation functions draw from these generators, and they 
+//   run again when a checkpoint is restored, so the generators are 
+//   restored after the Hcsms rather than with the rest of the statics.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to or read from.
+//   save - True to save, false to restore.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCollection::CheckpointRandom( CHcsmCheckpoint& ckpt, bool save )
+{
+	if( save ) 
+		ckpt.BeginSection( "random" );
+	else
+		ckpt.CheckSection( "random" );
+
+	CkptValue( ckpt, save, m_rng );
+	CkptValue( ckpt, save, m_adoFollowRng );
+	CkptPod( ckpt, save, m_adoFollowStreams );
+	CkptValue( ckpt, save, m_adoGapRng );
+	CkptValue( ckpt, save, m_adoGapStream );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves the state of the running scenario to a file.
+//
+// Remarks:  See the other version of this function.
+//
+// Arguments:
+//   cFileName - The name of the file to write to.
+//
+// Returns:  True if the checkpoint was written, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool CHcsmCollection::SaveCheckpoint( const string& cFileName )
+{
+	if( m_hcsmToCreate.size() > 0 || m_hcsmToDelete.size() > 0 )
+	{
+		gout << MyName() << "::SaveCheckpoint: can only save between frames";
+		gout << endl;
+		return false;
+	}
+
+	CHcsmCheckpoint ckpt;
+	SaveCheckpoint( ckpt );
+
+	return ckpt.Store( cFileName );
+}  // SaveCheckpoint
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves the state of the running scenario to a checkpoint.
+//
+// Remarks:  The checkpoint holds the collection's data, the snoblock of
+//   each root Hcsm together with its slot in the root array, the state
+//   of each Hcsm tree as written by CHcsm::SaveState, the random number
+//   generators and the state of the CVED objects.  It can only be taken
+//   between frames, i.e. when there are no pending create or delete
+//   requests.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to; it should be empty.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCollection::SaveCheckpoint( CHcsmCheckpoint& ckpt )
+{
+	ckpt.BeginSection( "collection" );
+	ckpt.Put( m_frame );
+	ckpt.Put( m_timeStepDuration );
+	CheckpointStatics( ckpt, true );
+
+	vector<int> freeList( m_freeList.begin(), m_freeList.end() );
+	ckpt.Put( freeList );
+
+	int ownDriverSurrogate = m_ownDriverSurrogate ? 
+		GetHcsmId( m_ownDriverSurrogate ) : -1;
+	ckpt.Put( ownDriverSurrogate );
+
+	//
+	// Root Hcsms, in root array order.
+	//
+	ckpt.Put( m_numHcsm );
+	int i;
+	for( i = 0; i < cMAX_ROOT_HCSM; i++ )
+	{
+		CHcsm* pHcsm = m_hcsmInstances[i];
+		if( !pHcsm )  continue;
+
+		string blockStr;
+		if( pHcsm->GetSnoBlock() )
+		{
+			CSnoBlock block( *pHcsm->GetSnoBlock() );
+			block.Store( blockStr );
+		}
+
+		ckpt.Put( i );
+		ckpt.Put( pHcsm->GetName() );
+		ckpt.Put( blockStr );
+		pHcsm->SaveState( ckpt );
+	}
+
+	CheckpointRandom( ckpt, true );
+	CheckpointCved( ckpt, true );
+}  // SaveCheckpoint
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Restores the state of a scenario from a checkpoint file.
+//
+// Remarks:  See the other version of this function.
+//
+// Arguments:
+//   cFileName - The name of the file to read from.
+//
+// Returns:  True if the checkpoint was restored, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool CHcsmCollection::RestoreCheckpoint( const string& cFileName )
+{
+	CHcsmCheckpoint ckpt;
+	if( !ckpt.Load( cFileName ) )  return false;
+
+	if( !RestoreCheckpoint( ckpt ) )
+	{
+		gout << MyName() << "::RestoreCheckpoint: " << cFileName << ": ";
+		gout << ckpt.GetError() << endl;
+		return false;
+	}
+
+	return true;
+}  // RestoreCheckpoint
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Restores the state of a scenario from a checkpoint.
+//
+// Remarks:  All existing Hcsms are deleted.  Each root Hcsm is then
+//   created again from its snoblock, in the same slot of the root array,
+//   its Creation function is called and its state is overwritten with 
+//   the checkpointed state.  The random number generators are restored
+//   next, then the Hcsms that registered through RestoreCvedObjectLater
+//   recreate their CVED objects and finally the state of those objects
+//   is overwritten.  The collection should be attached to a freshly
+//   initialized CVED instance that uses the same LRI file as the one the
+//   checkpoint was taken with, so that the objects get their old ids.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:  True if the checkpoint was restored, false otherwise; the
+//   checkpoint holds the error.  If false is returned the collection may
+//   have been partially restored.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool CHcsmCollection::RestoreCheckpoint( CHcsmCheckpoint& ckpt )
+{
+	ckpt.Rewind();
+	m_restoreCvedObjs.clear();
+
+	//
+	// Get rid of the current Hcsms.  Hcsms that have not been activated
+	// yet are deleted along with the rest.
+	//
+	m_hcsmToCreate.clear();
+	DeleteAllHcsm();
+	m_ownDriverSurrogate = NULL;
+
+	ckpt.CheckSection( "collection" );
+	ckpt.Get( m_frame );
+	double timeStepDuration = m_timeStepDuration;
+	ckpt.Get( timeStepDuration );
+	if( timeStepDuration != m_timeStepDuration )
+	{
+		gout << MyName() << "::RestoreCheckpoint: warning, checkpoint was ";
+		gout << "taken with a time step of " << timeStepDuration << endl;
+	}
+	CheckpointStatics( ckpt, false );
+
+	vector<int> freeList;
+	ckpt.Get( freeList );
+	int ownDriverSurrogate = -1;
+	ckpt.Get( ownDriverSurrogate );
+
+	//
+	// Create the root Hcsms.  The free list is manipulated so that each
+	// one ends up in its original slot.
+	//
+	int numHcsm = 0;
+	ckpt.Get( numHcsm );
+
+	vector<CHcsm*> created;
+	m_freeList.clear();
+	int i;
+	for( i = 0; i < numHcsm && ckpt.IsValid(); i++ )
+	{
+		int    slot = -1;
+		string templateName;
+		string blockStr;
+		ckpt.Get( slot );
+		ckpt.Get( templateName );
+		ckpt.Get( blockStr );
+		if( !ckpt.IsValid() )  break;
+		if( slot < 0 || slot >= cMAX_ROOT_HCSM || m_hcsmInstances[slot] )
+		{
+			ckpt.SetError( "bad root slot" );
+			break;
+		}
+
+		CSnoParser parser;
+		CSnoBlock  emptyBlock;
+		const CSnoBlock* cpBlock = &emptyBlock;
+		if( blockStr.size() > 0 )
+		{
+			bool parsed = false;
+			try
+			{
+				parsed = parser.Parse( blockStr.c_str() );
+			}
+			catch( CSnoParser::TError e )
+			{
+				gout << MyName() << "::RestoreCheckpoint: " << e.msg << endl;
+			}
+			if( !parsed || parser.Begin() == parser.End() )
+			{
+				ckpt.SetError( "cannot parse the snoblock of " + templateName );
+				break;
+			}
+			cpBlock = &*parser.Begin();
+		}
+
+		m_freeList.push_back( slot );
+		CHcsm* pHcsm = CreateHcsm( templateName, *cpBlock );
+		if( !pHcsm || m_hcsmMap[pHcsm] != slot )
+		{
+			ckpt.SetError( "cannot create " + templateName );
+			break;
+		}
+
+		created.push_back( pHcsm );
+	}
+
+	m_freeList.assign( freeList.begin(), freeList.end() );
+
+	if( ckpt.IsValid() )
+	{
+		//
+		// Activate the Hcsms, which runs their Creation functions.  Any
+		// Hcsms created by those functions already exist in the
+		// checkpoint so they are discarded.
+		//
+		ProcessHcsmCreate();
+
+		set<CHcsm*> restored( created.begin(), created.end() );
+		for( i = 0; i < cMAX_ROOT_HCSM; i++ )
+		{
+			CHcsm* pHcsm = m_hcsmInstances[i];
+			if( pHcsm && restored.find( pHcsm ) == restored.end() )
+			{
+				DeleteHcsm( pHcsm );
+			}
+		}
+		m_hcsmToCreate.clear();
+		ProcessHcsmDelete();
+		m_freeList.assign( freeList.begin(), freeList.end() );
+
+		//
+		// Now overwrite the state.
+		//
+		vector<CHcsm*>::iterator itr;
+		for( itr = created.begin(); itr != created.end() && ckpt.IsValid(); itr++ )
+		{
+			(*itr)->RestoreState( ckpt );
+		}
+
+		if( ownDriverSurrogate >= 0 )
+		{
+			m_ownDriverSurrogate = GetHcsm( ownDriverSurrogate );
+		}
+
+		if( ckpt.IsValid() )  CheckpointRandom( ckpt, false );
+
+		//
+		// Recreate the CVED objects in the order of their old ids.
+		//
+		map<int, CHcsm*>::iterator objItr;
+		for( 
+			objItr = m_restoreCvedObjs.begin(); 
+			objItr != m_restoreCvedObjs.end() && ckpt.IsValid(); 
+			objItr++ 
+			)
+		{
+			objItr->second->RestoreCvedObject();
+		}
+		m_restoreCvedObjs.clear();
+
+		if( ckpt.IsValid() )  CheckpointCved( ckpt, false );
+	}
+
+	return ckpt.IsValid();
+}  // RestoreCheckpoint
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Asks for an Hcsm's CVED object to be recreated.
+//
+// Remarks:  This function is meant to be called from RestoreUserState.
+//   Once all Hcsms have been restored, RestoreCvedObject is called on 
+//   the registered Hcsms in ascending order of the ids their objects had
+//   when the checkpoint was taken.
+//
+// Arguments:
+//   savedCvedId - The id of the object when the checkpoint was taken.
+//   pHcsm       - The Hcsm that owns the object.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCollection::RestoreCvedObjectLater( int savedCvedId, CHcsm* pHcsm )
+{
+	m_restoreCvedObjs[savedCvedId] = pHcsm;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Sets the specifed dial of the given object.
@@ -969,7 +1779,7 @@ void CHcsmCollection::SetHcsmButton(
 //////////////////////////////////////////////////////////////////////////////
 void CHcsmCollection::ReadExternalBtnDialSettings()
 {
-	string btnDialValStr = m_sObjBtnDialValToHcsm;
+	string btnDialValStr = m_ctx.m_sObjBtnDialValToHcsm;
     const size_t tokSize = 256;
 	const char* pToken = btnDialValStr.c_str();
 	char bigToken[tokSize];
@@ -1043,7 +1853,7 @@ void CHcsmCollection::ReadExternalBtnDialSettings()
 					string btnDialValStr = pBtnDialVal;
 
 					SetHcsmDial( cvedId, btnDialNameStr, btnDialValStr );
-					m_sObjBtnDialValToHcsm[0] = 0;
+					m_ctx.m_sObjBtnDialValToHcsm[0] = 0;
 				}
 				else
 				{
@@ -1051,13 +1861,13 @@ void CHcsmCollection::ReadExternalBtnDialSettings()
 					// Found a button only.  Set the button.
 					//
 					SetHcsmButton( cvedId, btnDialNameStr );
-					m_sObjBtnDialValToHcsm[0] = 0;
+					m_ctx.m_sObjBtnDialValToHcsm[0] = 0;
 				}
 			}
 			else
 			{
 				cerr << "ReadExternalBtnDialSettings: invalid setting = ";
-				cerr << m_sObjBtnDialValToHcsm << endl;
+				cerr << m_ctx.m_sObjBtnDialValToHcsm << endl;
 			}
 		}
 	} // for
@@ -1102,7 +1912,6 @@ void CHcsmCollection::ExecuteAllHcsm()
 	ReadExternalBtnDialSettings();
 
 
-
     multimap<int,CHcsm*> elemsByPriorityToExecute;
 
 
@@ -1569,7 +2378,6 @@ CHcsmCollection::GetNextPreloadFileSample( int fileHandle, string& data )
 }
 
 
-
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -1608,7 +2416,7 @@ CHcsmCollection::SetHcsmCreateLog(
 	{
 		CEventHcsmCreate event;
 		event.SetData( GetHcsmId( pHcsm ), hcsmType, cHcsmName, cPos );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1643,7 +2451,7 @@ CHcsmCollection::SetActionStartDataRedLog(
 	{
 		CEventActionStartDataRed event;
 		event.SetData( hcsmId, segment, pColumn, pParams );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1677,7 +2485,7 @@ CHcsmCollection::SetActionStopDataRedLog(
 	{
 		CEventActionStopDataRed event;
 		event.SetData( hcsmId, segment, pParams );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1710,7 +2518,7 @@ CHcsmCollection::SetActionUseTrafManSetLog(
 	{
 		CEventActionUseTrafManSet event;
 		event.SetData( hcsmId, cSetName );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1740,7 +2548,7 @@ CHcsmCollection::SetActionPlayAudioLog(
 	{
 		CEventActionPlayAudio event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1770,7 +2578,7 @@ CHcsmCollection::SetActionVehicleFailureLog(
 	{
 		CEventActionVehicleFailure event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1807,7 +2615,7 @@ CHcsmCollection::SetActionTrafficLightLog(
 	{
 		CEventActionTrafficLight event;
 		event.SetData( hcsmId, trafLightId, trafLightState, time );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1842,7 +2650,7 @@ CHcsmCollection::SetActionLogDataLog(
 	{
 		CEventActionLogData event;
 		event.SetData( hcsmId, logId, value );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1873,7 +2681,7 @@ CHcsmCollection::SetActionTerminateSimulationLog(
 	{
 		CEventActionTerminateSimulation event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1904,7 +2712,7 @@ CHcsmCollection::SetActionPreposMotionLog(
 	{
 		CEventActionPreposMotion event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1935,7 +2743,7 @@ CHcsmCollection::SetActionTuneMotionLog(
 	{
 		CEventActionTuneMotion event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1966,7 +2774,7 @@ CHcsmCollection::SetActionPhoneCallLog(
 	{
 		CEventActionPhoneCall event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -1998,7 +2806,7 @@ CHcsmCollection::SetActionResetDialLog(
 	{
 		CEventActionResetDial event;
 		event.SetData( hcsmId, cDialName );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2033,7 +2841,7 @@ CHcsmCollection::SetActionSetVariableLog(
 	{
 		CEventActionSetVariable event;
 		event.SetData( hcsmId, varName, value );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2068,7 +2876,7 @@ CHcsmCollection::SetActionSetDialLog(
 	{
 		CEventActionSetDial event;
 		event.SetData( hcsmId, cDialName, cValue );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2101,7 +2909,7 @@ CHcsmCollection::SetActionSetButtonLog(
 	{
 		CEventActionSetButton event;
 		event.SetData( hcsmId, cButtonName );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2132,7 +2940,7 @@ CHcsmCollection::SetActionCreateLog(
 	{
 		CEventActionCreate event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2163,7 +2971,7 @@ CHcsmCollection::SetActionDeleteLog(
 	{
 		CEventActionDelete event;
 		event.SetData( hcsmId );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2192,7 +3000,7 @@ CHcsmCollection::SetHcsmDeleteLog( CHcsm* pHcsm, const CPoint3D& cPos )
 	{
 		CEventHcsmDelete event;
 		event.SetData( GetHcsmId( pHcsm ), cPos );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2222,7 +3030,7 @@ CHcsmCollection::SetHcsmActivateLog( CHcsm* pHcsm, const CPoint3D& cPos )
 	{
 		CEventHcsmActivate event;
 		event.SetData( GetHcsmId( pHcsm ), cPos );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2259,7 +3067,7 @@ CHcsmCollection::SetCvedCreateLog(
 	{
 		CEventCvedCreate event;
 		event.SetData( GetHcsmId( pHcsm ), cvedId, cvedType, cPos );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2301,7 +3109,7 @@ CHcsmCollection::SetTriggerFireLog(
 					pCandidateSet,
 					candidateSetSize
 					);
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2336,7 +3144,7 @@ CHcsmCollection::SetDialSettingLog(
 	{
 		CEventDialButSet event;
 		event.SetData( GetHcsmId( pHcsm ), cDialName, cSetting );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2374,7 +3182,7 @@ CHcsmCollection::SetDialSettingLog(
 		sprintf_s( buf,128, "%g", value );
 		string valueStr = buf;
 		event.SetData( GetHcsmId( pHcsm ), cDialName, valueStr );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2404,7 +3212,7 @@ CHcsmCollection::SetButtonSettingLog( CHcsm* pHcsm, const string& cButtonName )
 	{
 		CEventDialButSet event;
 		event.SetData( GetHcsmId( pHcsm ), cButtonName, "" );
-		m_sActvLog.Add( m_frame, &event );
+		m_ctx.m_sActvLog.Add( m_frame, &event );
 
 		if( m_printActvLog )  event.Print( m_frame );
 	}
@@ -2705,8 +3513,8 @@ CHcsmCollection::GetVarQueueSize(const string& varQue, int& size){
 void
 CHcsmCollection::GetVisualDisplayText( string& displayText, int location )
 {
-    map<int,string>::iterator itr = m_sVisualDisplayText.find(location);
-    if (itr != m_sVisualDisplayText.end()){
+    map<int,string>::iterator itr = m_ctx.m_sVisualDisplayText.find(location);
+    if (itr != m_ctx.m_sVisualDisplayText.end()){
         displayText = itr->second;
     }else{
         displayText.clear();
@@ -2728,7 +3536,7 @@ CHcsmCollection::GetVisualDisplayText( string& displayText, int location )
 void
 CHcsmCollection::SetVisualDisplayText( const string& cDisplayText, int location )
 {
-	m_sVisualDisplayText[location] = cDisplayText;
+	m_ctx.m_sVisualDisplayText[location] = cDisplayText;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2746,7 +3554,7 @@ CHcsmCollection::SetVisualDisplayText( const string& cDisplayText, int location
 void
 CHcsmCollection::GetVisualSettings( string& visualSettings )
 {
-	visualSettings = m_sVisualSettings;
+	visualSettings = m_ctx.m_sVisualSettings;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2765,13 +3573,13 @@ CHcsmCollection::GetVisualSettings( string& visualSettings )
 void
 CHcsmCollection::SetVisualSettings( const string& cVisualSettings )
 {
-	m_sVisualSettings = cVisualSettings;
+	m_ctx.m_sVisualSettings = cVisualSettings;
 }
 
 bool
 CHcsmCollection::IsSimulationTerminated( void )
 {
-	return CHcsmCollection::m_sSCC_Scenario_Stop_Ind == 1;
+	return m_ctx.m_sSCC_Scenario_Stop_Ind == 1;
 }
 
 string
@@ -2789,17 +3597,17 @@ CHcsmCollection::GetActvLogFileName( void ) const
 		logFileName += "\\";
 	}
 
-	if( m_sExperiment && m_sSubject && m_sRun )
+	if( m_ctx.m_sExperiment && m_ctx.m_sSubject && m_ctx.m_sRun )
 	{
-		logFileName += m_sExperiment;
+		logFileName += m_ctx.m_sExperiment;
 		_mkdir( logFileName.c_str() );
 		logFileName += "\\";
 
-		logFileName += m_sSubject;
+		logFileName += m_ctx.m_sSubject;
 		_mkdir( logFileName.c_str() );
 		logFileName += "\\";
 
-		logFileName += m_sRun;
+		logFileName += m_ctx.m_sRun;
 		_mkdir( logFileName.c_str() );
 		logFileName += "\\";
 	}
@@ -2815,10 +3623,10 @@ CHcsmCollection::GetActvLogFileName( void ) const
 #endif
 
 	string actvLogFileName = logFileName;
-	if( strlen( m_sRunInst ) > 0 )
+	if( strlen( m_ctx.m_sRunInst ) > 0 )
 	{
 		actvLogFileName += "actvlog_";
-		actvLogFileName += m_sRunInst;
+		actvLogFileName += m_ctx.m_sRunInst;
 	}
 	else
 	{
@@ -42,6 +42,10 @@ using namespace std;
 #include "point3d.h"
 #include "path.h"
 #include "EnvVar.h"
+#include "initcondscheduler.h"
+#include "mergegaptable.h"
+
+class CAdoInfoPool;
 #define AUDIO_TRIGGER_BYPASS
 
 using namespace CVED;
@@ -284,6 +288,152 @@ private:
     CRITICAL_SECTION m_critSection;
 };
 
+//////////////////////////////////////////////////////////////////////////////
+///
+/// The scenario state of one CHcsmCollection: the data exchanged with the
+/// host through cells, the warning system state, the activity log and the
+/// names of the experiment and run.  Every collection owns one instance,
+/// CHcsmCollection::m_ctx, so collections that run side by side share none
+/// of it.  HCSMs and actions reach it through their root collection, hosts
+/// through the collection they created.
+///
+/// The members used to be static members of CHcsmCollection and keep
+/// their names.
+///\ingroup HCSM
+//////////////////////////////////////////////////////////////////////////////
+class CHcsmContext
+{
+public:
+	CHcsmContext();
+
+	enum eFlashingLightMode {
+		eNO_LIGHTS = 0,
+		eMIRROR_LIGHTS,
+		eA_PILLAR_LIGHTS,
+		eBOTH
+	};
+
+	enum eBUDCameraDisplayMode {
+		eNO_DISPLAY = 0,
+		eINSTRUMENT_PANEL,
+		eINTERIOR_MIRROR
+	};
+
+	char  m_sObjBtnDialValToHcsm[cOBJ_BTNDIAL_SIZE];
+	char  m_sExperiment[128];
+	char  m_sSubject[128];
+	char  m_sRun[128];
+	char  m_sRunInst[128];
+	CActvLog m_sActvLog;
+	float m_sSCC_Scen_Pos_X_Crossbeam;
+	float m_sSCC_Scen_Pos_Y_Carriage;
+	float m_sSCC_Scen_Pos_Hex_X;
+	float m_sSCC_Scen_Pos_Hex_Y;
+	float m_sSCC_Scen_Pos_Hex_Z;
+	float m_sSCC_Scen_Pos_Hex_Roll;
+	float m_sSCC_Scen_Pos_Hex_Pitch;
+	float m_sSCC_Scen_Pos_Hex_Yaw;
+	float m_sSCC_Scen_Pos_TT;
+	float m_sAccelPedalPos;
+	float m_sBrakePedalForce;
+	float m_sSteeringWheelAngle;
+	short m_sCruiseControlIncoming;
+	short m_sCruiseControl;
+	int m_sCisTurnSignal;
+	float m_sSpeedometerBackdrive;
+	int m_sHorn;
+	int m_sHornFiltered;
+	int m_sRecasButton;
+	float m_sAuxiliaryButtons[20];
+	int m_sBrakeCond[cBRAKE_COND_SIZE];
+	int m_sTireCond[cTIRE_COND_SIZE];
+	int m_sSteeringCond;
+	int m_sAlertCond;
+	int m_sInfoCond;
+	int m_sCabComponentCond;
+	int m_sSCC_Scenario_Stop_Ind;
+	int m_sSCC_PlacePhoneCall;	// cell value
+	int m_sPlacePhoneCallAge;	// frame on which cell value was set
+	float m_sLogStreams[cNUM_LOG_STREAMS];
+	float m_sLogStreamsExt[cNUM_LOG_STREAMS]; //extened logstream
+	char m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS_SIZE];
+	int m_sSCC_DataRed_Segments[cNUM_DATARED_SEGMENTS_SIZE];
+	float m_sFollowInfo[cFOLLOW_INFO_SIZE];
+	float m_sSensorInfo[cSENSOR_INFO_SIZE];
+	float m_sLaneDevInfo[cLANE_DEV_INFO_SIZE];
+	float m_sLaneDepartWarn[cLANE_DEPART_WARN_SIZE];
+	float m_sSplineDevInfo[cLANE_DEV_INFO_SIZE];
+	short m_sLaneMarkingInfo[cLANE_MARKING_INFO_SIZE];
+	float m_sOwnVehCurvature;
+	float m_sOwnVehDistOnPath;
+    double m_sSmoothForwardRoadVector[3];
+	TDynObjData m_sDynObjData;
+	int m_sDynObjDataSize;
+	int m_sHeadlightVisualState; //<are the headlights on or off? matches SCC_HeadlightVisualState
+	int m_sHeadlightScenarioControl; //<has the scenario asked to set the headlight state
+	TStatObjData m_sStatObjData;
+	int m_sStatObjDataSize;
+	int m_sChangedStatObjOption[cMAX_CHANGED_STAT_OBJ];
+	int m_sChangedStatObjId[cMAX_CHANGED_STAT_OBJ];
+	short m_sChangedStatObjDataSize;
+	TWriteCellData m_sWriteCellData[cMAX_WRITE_CELL_DATA_SIZE];
+	map<string,int> m_sAdditionalCellNamesToIds; //<cell names to ids that are not in m_sWriteCellData
+	int m_sWriteCellDataSize;
+	TScenarioWriteCellData m_sScenarioWriteCellData[cMAX_SCENARIO_WRITE_CELL_EVENTS];
+	int m_sScenarioWriteCellDataSize;
+	float m_sFalseAlarmInfo[cFALSE_ALARM_SIZE];
+	map<int,string> m_sVisualDisplayText;
+	string m_sPlayAudioText;
+	string m_sVisualSettings;
+	int m_sWarningLights;
+	int m_sCollWarnAlg;
+	float m_sFcwInfo[4];
+	short m_sTimeToWarn;
+	bool m_sBUD_IsOn;//<Checks to see what warning systems are on
+	bool m_sLCW_IsOn;
+	bool m_sBLS_IsOn;
+	bool m_sFCW_IsOn;
+	bool m_sIsOnPath; //<checks to see if the ownveh is on the path
+	CVED::CPath m_sOwnshipPath;
+	ELdwStatus m_sLdwStatus;
+	EBswStatus m_sBswStatus;
+	EFcwStatus m_sFcwStatus;
+	float m_sBackUpDistance; //< current back up distance in feet
+	short m_sACC_Warning;		// is 1 short.  (-1 if cruise not set.  0 normally, 1 if warning)
+	short m_sCruise_State;		//<  (0 if off, 1 if normal cruise on, 2 if normal cruise set, 3 if acc on, 4 if acc set)
+	float m_sCruise_SetSpeed;	//< (set speed in mph)
+	float m_sACC_Gap;			//<gap in seconds
+	short m_sALF_State;			//< automatic lane following (0 if off, 1 if on)
+	int   m_sLDW_Severity;		//size of gap to lane line that LDW warning is issued (1=early or 2=late)
+	int   m_sFCW_Severity;		//size of TTC at which FCW warning is issued (1=early or 2=late)
+	float m_sSirenEffect;       //< Tells the Audio engine to play a Siren, 
+	float m_sSirenSpeed;		   //< The speed value for SirenEffect to reference (and be settable by trigger)
+	int m_sHour;
+	int m_sMinute;
+	bool m_sChangeTimeOfDay;
+	short m_sSensor_Config[cSENSOR_CONFIG_SIZE];
+#ifdef AUDIO_TRIGGER_BYPASS
+	short m_sACC_On;
+    int m_sAudio_Trigger;
+#endif
+#ifdef TTA_DIST_FOR_ODSS
+	double m_sDistanceToInt;
+#endif
+	/// warning cue configuration
+	bool m_sHapticSeat_IsEnabled; //< whether haptic seat is enabled
+	eFlashingLightMode m_sFlashingLightMode; //< flashing lights mode
+	eBUDCameraDisplayMode m_sBUDCameraDisplayMode; //< backup camera and distance bar display mode
+	float m_sBUDBarWarnLowDist;  //< the backup distance at which the distance bar starts to grow
+	float m_sBUDBarWarnHighDist; //< the backup distance at which the distance bar reaches maximum warning level
+	bool m_sBSWCamera_IsEnabled; //< whether blind spot warning camera is enabled
+	bool m_sIPAlert_IsEnabled; //< whether alert icons in instrument panel is enabled
+	bool m_sGraphIsOn;
+	bool m_sMakeOwnVehicleChangeLanesLeft;
+	bool m_sMakeOwnVehicleChangeLanesRight;
+	float m_sOwnVehicleSpeed;
+	int m_sDataRedCounter;      // data reduction segments started by actions
+};
+
 //////////////////////////////////////////////////////////////////////////////
 ///
 /// This class maintains a collection of all root HCSM instances.  It provides
@@ -291,12 +441,18 @@ private:
 /// functions that can provide information about the dynamic state of the HCSM
 /// system such as how many root HCSMs are active.  Finally, it maintains
 /// the HCSM system frame counter.
+///
+/// The scenario state lives in the collection instance and its m_ctx, so
+/// several collections, each on its own CVED instance, can run independent
+/// scenarios side by side.  Configuration flags and the data that the host
+/// reads under a lock (cab settings, visual options, DiGuy paths, last
+/// good location) are static and shared by all collections.
 ///\ingroup HCSM
 //////////////////////////////////////////////////////////////////////////////
 class CHcsmCollection
 {
 public:
-	CHcsmCollection( const double = 0.1, CCved* = NULL );   // default is 10 Hz
+	CHcsmCollection( const double = 0.1, CCved* = NULL, int runIndex = 0 );   // default is 10 Hz
 //	CHcsmCollection( const CHcsmCollection& );
 //	CHcsmCollection& operator=( const CHcsmCollection& );
 	virtual ~CHcsmCollection();
@@ -304,13 +460,25 @@ public:
 	inline int NumHcsm() const;
 	inline int GetFrame() const;
 	inline double GetTimeStepDuration() const;
+	inline int GetRunIndex() const;
+	inline CInitCondScheduler& GetInitCondScheduler();
+	inline CAdoInfoPool& GetAdoInfoPool();
+	inline CMergeGapTable& GetMergeGapTable();
 	CHcsm* CreateHcsm( const string, const CSnoBlock& );
+	CHcsm* CreateHcsm( int, const CSnoBlock& );
+	static int GetTemplateId( const string& );
+	static const char* GetTemplateName( int );
 	bool DeleteHcsm( CHcsm* );
 	void DeleteAllHcsm();
 	void ExecuteAllHcsm();
+	bool SaveCheckpoint( const string& cFileName );
+	bool RestoreCheckpoint( const string& cFileName );
+	void SaveCheckpoint( CHcsmCheckpoint& ckpt );
+	bool RestoreCheckpoint( CHcsmCheckpoint& ckpt );
+	void RestoreCvedObjectLater( int savedCvedId, CHcsm* pHcsm );
 	inline CCved* GetCved() { return m_pCved; }
 
-	static int GetHcsmId( CHcsm* );
+	int GetHcsmId( CHcsm* );
 	CHcsm* GetHcsm( int ) const;
 	CHcsm* GetHcsm( const string& ) const;
 
@@ -339,98 +507,98 @@ public:
 				);
 	void SetHcsmDeleteLog( CHcsm* pHcsm, const CPoint3D& cPos );
 	void SetHcsmActivateLog( CHcsm* pHcsm, const CPoint3D& cPos );
-	static void SetCvedCreateLog(
+	void SetCvedCreateLog(
 				CHcsm* pHcsm,
 				int cvedId,
 				cvEObjType cvedType,
 				const CPoint3D& cPos
 				);
-	static void SetTriggerFireLog(
+	void SetTriggerFireLog(
 				CHcsm* pHcsm,
 				int instigatorHcsmId,
 				int* pCandidateSet,
 				int candidateSetSize
 				);
-	static void SetDialSettingLog(
+	void SetDialSettingLog(
 				CHcsm* pHcsm,
 				const string& cDialButtonName,
 				const string& cSetting
 				);
-	static void SetDialSettingLog(
+	void SetDialSettingLog(
 				CHcsm* pHcsm,
 				const string& cDialName,
 				double value
 				);
-	static void SetActionStartDataRedLog(
+	void SetActionStartDataRedLog(
 				int hcsmId,
 				int segment,
 				const char* pColumn,
 				const char* pParams
 				);
-	static void SetActionStopDataRedLog(
+	void SetActionStopDataRedLog(
 				int hcsmId,
 				int segment,
 				const char* params
 				);
-	static void SetActionUseTrafManSetLog(
+	void SetActionUseTrafManSetLog(
 				int hcsmId,
 				const string& cSetName
 				);
-	static void SetActionPlayAudioLog(
+	void SetActionPlayAudioLog(
 				int hcsmId
 				// TBD
 				);
-	static void SetActionVehicleFailureLog(
+	void SetActionVehicleFailureLog(
 				int hcsmId
 				// TBD
 				);
-	static void SetActionTrafficLightLog(
+	void SetActionTrafficLightLog(
 				int hcsmId,
 				int trafLightId,
 				int trafLightState,
 				double time
 				);
-	static void SetActionLogDataLog(
+	void SetActionLogDataLog(
 				int hcsmId,
 				int logId,
 				double value
 				);
-	static void SetActionTerminateSimulationLog(
+	void SetActionTerminateSimulationLog(
 				int hcsmId
 				);
-	static void SetActionPreposMotionLog(
+	void SetActionPreposMotionLog(
 				int hcsmId
 				// TBD
 				);
-	static void SetActionTuneMotionLog(
+	void SetActionTuneMotionLog(
 				int hcsmId
 				// TBD
 				);
-	static void SetActionPhoneCallLog(
+	void SetActionPhoneCallLog(
 				int hcsmId
 				);
-	static void SetActionResetDialLog(
+	void SetActionResetDialLog(
 				int hcsmId,
 				const string& cDialName
 				);
-	static void SetActionSetDialLog(
+	void SetActionSetDialLog(
 				int hcsmId,
 				const string& cDialName,
 				const string& cValue
 				);
-	static void SetActionSetButtonLog(
+	void SetActionSetButtonLog(
 				int hcsmId,
 				const string& cDialName
 				);
-	static void SetActionSetVariableLog(
+	void SetActionSetVariableLog(
 				int hcsmId,
 				const string& varName,
 				double value
 				);
-	static void SetActionCreateLog(
+	void SetActionCreateLog(
 				int hcsmId
 				);
-	static void SetActionDeleteLog(
+	void SetActionDeleteLog(
 				int hcsmId
 				);
 	static void SetDiGuyPathInfo(int id, 
@@ -446,24 +614,24 @@ public:
 	static void clearDiGuyCommandQueue();
 	void SetButtonSettingLog( CHcsm* pHcsm, const string& cDialButtonName );
 
-	static void SetExprVariable( const string& cName, double value );
-	static bool DoesRandomNumberGeneratorExist( const string& cName);
-    static void CreateRandomNumberGenerator( const string& cName, const vector<long> &seed);
-    static std::shared_ptr<std::mt19937> GetRandomNumberGenerator(const string& cName); 
-	static bool ExprVariableExists( const string& cName );
-	static double GetExprVariable( const string& cName );
-	static void SetExprPosVariable( const string& cName, const CPoint3D &value );
-	static bool ExprPosVariableExists( const string& cName );
-	static CPoint3D GetExprPosVariable( const string& cName );
-	static void ClearVariables();
-
-	static void SetVisualDisplayText( const string& cDisplayText, int location = 1 );
-	static void GetVisualDisplayText( string& displayText, int location = 1 );
-	static void SetVisualSettings( const string& cVisualSettings );
-	static void GetVisualSettings( string& visualSettings );
-	static bool IsSimulationTerminated( void );
-    static bool DoVarQueueOperation(const string& varQue);
-    static bool GetVarQueueSize(const string& varQue, int &size);
+	void SetExprVariable( const string& cName, double value );
+	bool DoesRandomNumberGeneratorExist( const string& cName);
+    void CreateRandomNumberGenerator( const string& cName, const vector<long> &seed);
+    std::shared_ptr<std::mt19937> GetRandomNumberGenerator(const string& cName); 
+	bool ExprVariableExists( const string& cName );
+	double GetExprVariable( const string& cName );
+	void SetExprPosVariable( const string& cName, const CPoint3D &value );
+	bool ExprPosVariableExists( const string& cName );
+	CPoint3D GetExprPosVariable( const string& cName );
+	void ClearVariables();
+
+	void SetVisualDisplayText( const string& cDisplayText, int location = 1 );
+	void GetVisualDisplayText( string& displayText, int location = 1 );
+	void SetVisualSettings( const string& cVisualSettings );
+	void GetVisualSettings( string& visualSettings );
+	bool IsSimulationTerminated( void );
+    bool DoVarQueueOperation(const string& varQue);
+    bool GetVarQueueSize(const string& varQue, int &size);
 
 	void PreloadFiles( const vector<string>& cFileNames );
 	int GetPreloadFileHandle( const string& cFileName );
@@ -472,6 +640,13 @@ public:
 	// random nubmer generator
 	CRandNumGen m_rng;
 
+	// generators shared by all ADOs for their follow and gap acceptance
+	// parameters, and the streams they draw from
+	CRandNumGen m_adoFollowRng;
+	int         m_adoFollowStreams[5];
+	CRandNumGen m_adoGapRng;
+	int         m_adoGapStream;
+
 	// vector that includes all sol ids to be excluded
 	vector<int> m_excludeSolIds;
 
@@ -493,6 +668,9 @@ private:
 				);
 	inline const char* MyName();
 	string GetActvLogFileName( void ) const;
+	void CheckpointStatics( CHcsmCheckpoint&, bool save );
+	void CheckpointCved( CHcsmCheckpoint&, bool save );
+	void CheckpointRandom( CHcsmCheckpoint&, bool save );
 
 
 	int m_numHcsm;                  // number of HCSMs
@@ -500,9 +678,10 @@ private:
 	CHcsm* m_hcsmInstances[cMAX_ROOT_HCSM];
 	list<int> m_freeList;
 	CHcsm* m_ownDriverSurrogate; //< The ADO that simulates the ownship, null when not simulated
-	static map<CHcsm*, int> m_hcsmMap;
+	map<CHcsm*, int> m_hcsmMap;
 	set<CHcsm*> m_hcsmToCreate;     // contains hcsms created in current frame
 	set<CHcsm*> m_hcsmToDelete;     // holds deletion requests from crnt frame
+	map<int, CHcsm*> m_restoreCvedObjs;  // see RestoreCvedObjectLater
 	CCved* m_pCved;                 // pointer to CVED
 	queue<TImRegisterData> m_imRegisterData;
 	CMemoryLog m_memLog;
@@ -510,16 +689,17 @@ private:
 	// debugging queue
 	queue<CHcsmDebugItem> m_DebugItems;
 
-	// the HCSM parser generates the following function
+	// the HCSM parser generates the following functions
 	CHcsm* GetClassFromTemplateName( string, const CSnoBlock& );
+	CHcsm* GetClassFromTemplateId( int, const CSnoBlock& );
 
 	// vector that includes all sol object names
 	// to be excluded
 	vector<string> m_excludeSolNames;
-	static map<string, double> m_exprVariables;
-    static map<string, shared_ptr<mt19937>> m_randomGenerators; //<mersen twister based generators
-	static map<string, CPoint3D> m_exprPosVariables;
-    static map<string, vector< pair<string,double> > > m_varQueues;
+	map<string, double> m_exprVariables;
+    map<string, shared_ptr<mt19937>> m_randomGenerators; //<mersen twister based generators
+	map<string, CPoint3D> m_exprPosVariables;
+    map<string, vector< pair<string,double> > > m_varQueues;
 	static map<int, vector<float> > m_sDiGuyPathInfo; //<path for the DiGuys
 	static map<int, vector<float> > m_sDiGuyPathTimesInfo; //<optional time at node for DiGuys
 	static map<int, vector<char> > m_sDiGuyPathActionInfo; //<optional action at node for DiGuys
@@ -532,92 +712,29 @@ private:
 	double m_currUpdateTime;    //< Current frame update time
 
 	__int64 m_lastTicks;        //< CPU ticks since last update.
+	int m_frame;                //< current frame number
+	int m_runIndex;             //< index of batch run, seeds the ADO generators
+	CInitCondScheduler m_initCondScheduler; //< creation radius tests of waiting objects
+	CAdoInfoPool* m_pAdoInfoPool; //< recycled Ado storage, outlives the Hcsms
+	CMergeGapTable m_mergeGapTable; //< approaching vehicles at merge points
 
 	static HANDLE m_sLastGoodLocationMutex; //< Mutex Loc for last good location
 	static float  m_sLastGoodLocation[3]; //< last location the Ext Driver was on the Path
 
 public:
-	static int m_frame;                    // current frame number
+	CHcsmContext m_ctx;             // scenario state shared with the host
 	static bool  m_verbose;
-	static char  m_sObjBtnDialValToHcsm[cOBJ_BTNDIAL_SIZE];
-	static char  m_sExperiment[128];
-	static char  m_sSubject[128];
-	static char  m_sRun[128];
-	static char  m_sRunInst[128];
-	static CActvLog m_sActvLog;
 	static bool  m_logActivities;
 	static bool  m_printActvLog;
-	static float m_sSCC_Scen_Pos_X_Crossbeam;
-	static float m_sSCC_Scen_Pos_Y_Carriage;
-	static float m_sSCC_Scen_Pos_Hex_X;
-	static float m_sSCC_Scen_Pos_Hex_Y;
-	static float m_sSCC_Scen_Pos_Hex_Z;
-	static float m_sSCC_Scen_Pos_Hex_Roll;
-	static float m_sSCC_Scen_Pos_Hex_Pitch;
-	static float m_sSCC_Scen_Pos_Hex_Yaw;
-	static float m_sSCC_Scen_Pos_TT;
-	static float m_sAccelPedalPos;
-	static float m_sBrakePedalForce;
-	static float m_sSteeringWheelAngle;
-	static short m_sCruiseControlIncoming;
-	static short m_sCruiseControl;
-	static int m_sCisTurnSignal;
-	static float m_sSpeedometerBackdrive;
-	static int m_sHorn;
-	static int m_sHornFiltered;
-	static int m_sRecasButton;
-	static float m_sAuxiliaryButtons[20];
-	static int m_sBrakeCond[cBRAKE_COND_SIZE];
-	static int m_sTireCond[cTIRE_COND_SIZE];
-	static int m_sSteeringCond;
-	static int m_sAlertCond;
-	static int m_sInfoCond;
-	static int m_sCabComponentCond;
-	static int m_sSCC_Scenario_Stop_Ind;
-	static int m_sSCC_PlacePhoneCall;	// cell value
-	static int m_sPlacePhoneCallAge;	// frame on which cell value was set
-	static float m_sLogStreams[cNUM_LOG_STREAMS];
-	static float m_sLogStreamsExt[cNUM_LOG_STREAMS]; //extened logstream
-	static char m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS_SIZE];
-	static int m_sSCC_DataRed_Segments[cNUM_DATARED_SEGMENTS_SIZE];
-	static float m_sFollowInfo[cFOLLOW_INFO_SIZE];
-	static float m_sSensorInfo[cSENSOR_INFO_SIZE];
-	static float m_sLaneDevInfo[cLANE_DEV_INFO_SIZE];
-	static float m_sLaneDepartWarn[cLANE_DEPART_WARN_SIZE];
-	static float m_sSplineDevInfo[cLANE_DEV_INFO_SIZE];
-	static short m_sLaneMarkingInfo[cLANE_MARKING_INFO_SIZE];
-	static float m_sOwnVehCurvature;
-	static float m_sOwnVehDistOnPath;
-
-    static double m_sSmoothForwardRoadVector[3];
-	
-    static bool m_sDisableCurvature;
-
-	static TDynObjData m_sDynObjData;
-	static int m_sDynObjDataSize;
 
-	static int m_sHeadlightVisualState; //<are the headlights on or off? matches SCC_HeadlightVisualState
-	static int m_sHeadlightScenarioControl; //<has the scenario asked to set the headlight state
-
-	static TStatObjData m_sStatObjData;
-	static int m_sStatObjDataSize;
-
-	static int m_sChangedStatObjOption[cMAX_CHANGED_STAT_OBJ];
-	static int m_sChangedStatObjId[cMAX_CHANGED_STAT_OBJ];
-	static short m_sChangedStatObjDataSize;
+    static bool m_sDisableCurvature;
+    static bool m_sAdoLod;          // level of detail scheduling for Ados
 
 	static TCabVisualOperations m_sCabOperations[cMAX_VISUAL_OPERATIONS];
 	static int m_CabOperationsSize;
     static CHcsmStaticLock m_cabSettingsCriticalSection; //< Critical Section for Cab Settings
 	static CHcsmStaticLock m_DiGuyPathCriticalSection; //< Critical adding pathNodes
 
-	static TWriteCellData m_sWriteCellData[cMAX_WRITE_CELL_DATA_SIZE];
-	static map<string,int> m_sAdditionalCellNamesToIds; //<cell names to ids that are not in m_sWriteCellData
-	static int m_sWriteCellDataSize;
-
-	static TScenarioWriteCellData m_sScenarioWriteCellData[cMAX_SCENARIO_WRITE_CELL_EVENTS];
-	static int m_sScenarioWriteCellDataSize;
-
 	static TScenarioWriteCellData m_sScenarioWriteUniformData[cMAX_SET_UNIFORM_CELL_EVENTS];
 	static int m_sScenarioWriteUniformDataSize;
 
@@ -629,68 +746,6 @@ public:
 
     static CHcsmStaticLock m_sLockVisualOptions;
 
-	static float m_sFalseAlarmInfo[cFALSE_ALARM_SIZE];
-
-	static map<int,string> m_sVisualDisplayText;
-
-	
-	static string m_sPlayAudioText;
-
-	static string m_sVisualSettings;
-
-	static int m_sWarningLights;
-	static int m_sCollWarnAlg;
-	static float m_sFcwInfo[4];
-	static short m_sTimeToWarn;
-
-	static bool m_sBUD_IsOn;//<Checks to see what warning systems are on
-	static bool m_sLCW_IsOn;
-	static bool m_sBLS_IsOn;
-	static bool m_sFCW_IsOn;
-
-	static bool m_sIsOnPath; //<checks to see if the ownveh is on the path
-	static CVED::CPath m_sOwnshipPath;
-
-	static ELdwStatus m_sLdwStatus;
-	static EBswStatus m_sBswStatus;
-	static EFcwStatus m_sFcwStatus;
-	static float m_sBackUpDistance; //< current back up distance in feet
-
-	static short m_sACC_Warning;		// is 1 short.  (-1 if cruise not set.  0 normally, 1 if warning)
-	static short m_sCruise_State;		//<  (0 if off, 1 if normal cruise on, 2 if normal cruise set, 3 if acc on, 4 if acc set)
-	static float m_sCruise_SetSpeed;	//< (set speed in mph)
-	static float m_sACC_Gap;			//<gap in seconds
-	static short m_sALF_State;			//< automatic lane following (0 if off, 1 if on)
-	static int   m_sLDW_Severity;		//size of gap to lane line that LDW warning is issued (1=early or 2=late)
-	static int   m_sFCW_Severity;		//size of TTC at which FCW warning is issued (1=early or 2=late)
-
-	static float m_sSirenEffect;       //< Tells the Audio engine to play a Siren, 
-	static float m_sSirenSpeed;		   //< The speed value for SirenEffect to reference (and be settable by trigger)
-
-
-	static int m_sHour;
-	static int m_sMinute;
-	static bool m_sChangeTimeOfDay;
-	static short m_sSensor_Config[cSENSOR_CONFIG_SIZE];
-#ifdef AUDIO_TRIGGER_BYPASS
-	static short m_sACC_On;
-    static int m_sAudio_Trigger;
-#endif
-#ifdef TTA_DIST_FOR_ODSS
-	static double m_sDistanceToInt;
-#endif
-	enum eFlashingLightMode {
-		eNO_LIGHTS = 0,
-		eMIRROR_LIGHTS,
-		eA_PILLAR_LIGHTS,
-		eBOTH
-	};
-
-	enum eBUDCameraDisplayMode {
-		eNO_DISPLAY = 0,
-		eINSTRUMENT_PANEL,
-		eINTERIOR_MIRROR
-	};
 	enum eHeadlightControlMode{
 		eDISABLE          = 0,
 		eUSER_ENABLE      = 1, //allow the driver to turn on the headlights
@@ -698,22 +753,10 @@ public:
 	};
 	//static bool (*ReadCellNumeric)(const string&, int, float&); //<Function pointer to a "readcell function"
 	static TReadCellFuncptr ReadCellNumeric;
-	/// warning cue configuration
-	static bool m_sHapticSeat_IsEnabled; //< whether haptic seat is enabled
-	static eFlashingLightMode m_sFlashingLightMode; //< flashing lights mode
-	static eBUDCameraDisplayMode m_sBUDCameraDisplayMode; //< backup camera and distance bar display mode
-	static float m_sBUDBarWarnLowDist;  //< the backup distance at which the distance bar starts to grow
-	static float m_sBUDBarWarnHighDist; //< the backup distance at which the distance bar reaches maximum warning level
-	static bool m_sBSWCamera_IsEnabled; //< whether blind spot warning camera is enabled
-	static bool m_sIPAlert_IsEnabled; //< whether alert icons in instrument panel is enabled
 
 	static COnScreenGraph m_sDisplayGraph;
-	static bool m_sGraphIsOn;
 
 	static bool m_ExternalDriverRehearsalControl;
-	static bool m_sMakeOwnVehicleChangeLanesLeft;
-	static bool m_sMakeOwnVehicleChangeLanesRight;
-	static float m_sOwnVehicleSpeed;
 #ifndef USING_RTEXPSLITE
 	static RTEX::SubsysBase *m_spRTEX;
 #endif
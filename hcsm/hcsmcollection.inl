@@ -88,6 +88,87 @@ double CHcsmCollection::GetTimeStepDuration() const
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the index of the run this collection executes.
+//
+// Remarks:  The index is 0 for a single run; a Monte Carlo batch numbers
+//   its runs so the ADO random streams differ between them.
+//
+// Arguments:
+//
+// Returns:  The run index given to the constructor.
+//
+//////////////////////////////////////////////////////////////////////////////
+int CHcsmCollection::GetRunIndex() const
+{
+
+	return m_runIndex;
+
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the scheduler that runs the creation radius tests
+//   of the objects waiting to be created.
+//
+// Remarks:  Each collection has its own scheduler, so waiting objects of
+//   one collection are never tested against another collection's CVED.
+//
+// Arguments:
+//
+// Returns:  A reference to the collection's scheduler.
+//
+//////////////////////////////////////////////////////////////////////////////
+CInitCondScheduler& CHcsmCollection::GetInitCondScheduler()
+{
+
+	return m_initCondScheduler;
+
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the pool that recycles the storage of the Ados
+//   created by this collection.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns:  A reference to the collection's pool.
+//
+//////////////////////////////////////////////////////////////////////////////
+CAdoInfoPool& CHcsmCollection::GetAdoInfoPool()
+{
+
+	return *m_pAdoInfoPool;
+
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the table of approaching vehicles' distances and
+//   times to arrival that the Merge HCSMs of this collection share.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns:  A reference to the collection's table.
+//
+//////////////////////////////////////////////////////////////////////////////
+CMergeGapTable& CHcsmCollection::GetMergeGapTable()
+{
+
+	return m_mergeGapTable;
+
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  add a debug item to the collection's queue
@@ -15,6 +15,8 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "hcsmcommunicate.h"
+#include "hcsmcheckpoint.h"
+#include "hcsmnametable.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -29,7 +31,7 @@ CHcsmCommunicate::CHcsmCommunicate(
 	m_prevSetFrame( cINVALID_FRAME )
 {
 
-	m_name = cName;
+	m_pName = CHcsmNameTable::Intern( cName );
 	m_hasValueA = false;
 	m_hasValueB = false;
 
@@ -53,7 +55,7 @@ CHcsmCommunicate& CHcsmCommunicate::operator=( const CHcsmCommunicate& cRhs )
 		// call parent's assignment operator
 		CHcsmObject::operator=( cRhs );
 
-		m_name = cRhs.m_name;
+		m_pName = cRhs.m_pName;
 		m_hasValueA = cRhs.m_hasValueA;
 		m_hasValueB = cRhs.m_hasValueB;
 		m_setFrame  = cRhs.m_setFrame;
@@ -88,7 +90,7 @@ CHcsmCommunicate::~CHcsmCommunicate()
 const string& CHcsmCommunicate::GetName() const
 {
 
-	return m_name;
+	return *m_pName;
 
 }
 
@@ -164,3 +166,46 @@ void CHcsmCommunicate::SetNoValue()
 		m_setFrame = GetFrame();
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Writes the communication object's state to a checkpoint.
+//
+// Remarks:  Derived classes that hold values override this function and
+//   call it before writing their own data.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCommunicate::SaveState( CHcsmCheckpoint& ckpt )
+{
+	ckpt.BeginSection( m_pName->c_str() );
+	ckpt.Put( m_setFrame );
+	ckpt.Put( m_prevSetFrame );
+	ckpt.Put( m_hasValueA );
+	ckpt.Put( m_hasValueB );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads the communication object's state from a checkpoint.
+//
+// Remarks:  This function reads the data written by SaveState.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmCommunicate::RestoreState( CHcsmCheckpoint& ckpt )
+{
+	ckpt.CheckSection( m_pName->c_str() );
+	ckpt.Get( m_setFrame );
+	ckpt.Get( m_prevSetFrame );
+	ckpt.Get( m_hasValueA );
+	ckpt.Get( m_hasValueB );
+}
@@ -34,6 +34,8 @@ using namespace std;
 
 const int cINVALID_FRAME = -1;
 
+class CHcsmCheckpoint;
+
 //////////////////////////////////////////////////////////////////////////////
 ///
 /// This class defines the attributes and operations needed by all dial and
@@ -50,6 +52,8 @@ public:
 	bool HasValue();
 	virtual void SetNoValue();
 	const string& GetName() const;
+	virtual void SaveState( CHcsmCheckpoint& );
+	virtual void RestoreState( CHcsmCheckpoint& );
 
 protected:
 	CHcsmCommunicate( CHcsmCollection*, const string& );
@@ -58,7 +62,7 @@ protected:
 	virtual ~CHcsmCommunicate();
 
 	inline const char* MyName();
-	string m_name;
+	const string* m_pName;		// shared, see CHcsmNameTable
 
 	long m_setFrame;
 	long m_prevSetFrame;
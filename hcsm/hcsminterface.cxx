@@ -17,7 +17,7 @@
 #include "hcsminterface.h"
 #include "hcsmcollection.h"
 
-void LogData( int streamNum, float val )
+void LogData( CHcsmCollection* pHC, int streamNum, float val )
 {
 	// For now, just print a message
 	if( CHcsmCollection::m_verbose )
@@ -28,10 +28,10 @@ void LogData( int streamNum, float val )
 
 	if( streamNum > 0 && streamNum <= cNUM_LOG_STREAMS)
 	{
-		CHcsmCollection::m_sLogStreams[streamNum-1] = val;
+		pHC->m_ctx.m_sLogStreams[streamNum-1] = val;
 	}
 	else if( streamNum - cNUM_LOG_STREAMS > 0 && streamNum <= cNUM_LOG_STREAMS * 2){
-		CHcsmCollection::m_sLogStreamsExt[streamNum-1 - cNUM_LOG_STREAMS ] = val;
+		pHC->m_ctx.m_sLogStreamsExt[streamNum-1 - cNUM_LOG_STREAMS ] = val;
 	}
 	else
 	{
@@ -55,8 +55,8 @@ void MotionBaseTune( void )
 	}
 }
 
-void TerminateSimulation( void )
+void TerminateSimulation( CHcsmCollection* pHC )
 {
-	// Simply set a global flag declared in hcsmsys/sic to "1".
-	CHcsmCollection::m_sSCC_Scenario_Stop_Ind = 1;
+	// Simply set the collection's flag that hcsmsys/sic reads to "1".
+	pHC->m_ctx.m_sSCC_Scenario_Stop_Ind = 1;
 }
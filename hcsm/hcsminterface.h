@@ -28,10 +28,12 @@
 #include <string>
 using namespace std;
 
-void LogData( int streamNum, float val );
+class CHcsmCollection;
+
+void LogData( CHcsmCollection* pHC, int streamNum, float val );
 void MotionBasePreposition( void );
 void MotionBaseTune( void );
-void TerminateSimulation( void );
+void TerminateSimulation( CHcsmCollection* pHC );
 
 #endif // _HCSM_INTERFACE_H_
 
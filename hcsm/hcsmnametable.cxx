@@ -0,0 +1,75 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: hcsmnametable.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  Implementation of the CHcsmNameTable class.
+ *
+ ****************************************************************************/
+
+#include "hcsmnametable.h"
+
+#include <mutex>
+#include <set>
+
+//
+// The names live in a set, whose nodes are never moved, so a pointer
+// to an element stays valid as the set grows.  Both are function
+// statics so they are constructed before the first HCSM object that
+// asks for a name, whatever the order of static initialization.
+//
+static set<string>& Names()
+{
+	static set<string> names;
+	return names;
+}
+
+static mutex& NamesLock()
+{
+	static mutex lock;
+	return lock;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the shared copy of a name.
+//
+// Remarks:  The name is added to the table the first time it is seen.
+//   Equal names always give the same pointer.
+//
+// Arguments:
+//   name - The name of a dial, monitor, button or parameter.
+//
+// Returns:  A pointer to the table's copy of the name, valid for the life
+//   of the program.
+//
+//////////////////////////////////////////////////////////////////////////////
+const string* CHcsmNameTable::Intern( const string& name )
+{
+	lock_guard<mutex> guard( NamesLock() );
+	return &*Names().insert( name ).first;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the number of distinct names in the table.
+//
+// Remarks:  Meant for diagnostics.
+//
+// Arguments:
+//
+// Returns:  The number of names.
+//
+//////////////////////////////////////////////////////////////////////////////
+int CHcsmNameTable::NumNames()
+{
+	lock_guard<mutex> guard( NamesLock() );
+	return (int) Names().size();
+}
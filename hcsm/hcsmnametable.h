@@ -0,0 +1,53 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: hcsmnametable.h,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The header file for the CHcsmNameTable class, which holds
+ *   one copy of each name given to a dial, monitor, button or parameter.
+ *
+ * Every HCSM instance has its own dial, monitor, button and parameter
+ * objects, and each of these used to keep its own string with its name.
+ * An ADO hierarchy repeats the same few hundred names for every vehicle,
+ * so the objects now point into this table instead.  A name is stored
+ * the first time it is seen and is never freed, so the pointers stay
+ * valid for the life of the program and copying an object copies only
+ * the pointer.
+ *
+ * The table is shared by all threads and guarded by a lock.  It is only
+ * used when an object is constructed from a name, never on a frame.
+ *
+ ****************************************************************************/
+
+#ifndef __CHCSMNAMETABLE_H
+#define __CHCSMNAMETABLE_H
+
+#ifdef _WIN32
+#if _MSC_VER >= 1000
+#pragma once
+#endif // _MSC_VER >= 1000
+
+#pragma warning(disable:4786)
+#endif
+
+#include <string>
+using namespace std;
+
+class CHcsmNameTable
+{
+public:
+	static const string* Intern( const string& name );
+	static int NumNames();
+
+private:
+	CHcsmNameTable();
+};
+
+#endif // __CHCSMNAMETABLE_H
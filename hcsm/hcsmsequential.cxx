@@ -22,6 +22,7 @@ using namespace std;
 
 #include "hcsmsequential.h"
 #include "hcsmcollection.h"
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -172,6 +173,59 @@ void CHcsmSequential::ResetActiveChild()
 	m_activeChild = m_defaultActiveChild;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Writes the HCSM's state to a checkpoint.
+//
+// Remarks:  In addition to the data written by the parent, this function
+//   writes the index of the active child.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmSequential::SaveState( CHcsmCheckpoint& ckpt )
+{
+	CHcsm::SaveState( ckpt );
+
+	int activeIdx = -1;
+	int i;
+	for( i = 0; i < m_numChildren; i++ )
+	{
+		if( m_children[i] == m_activeChild )  activeIdx = i;
+	}
+	ckpt.Put( activeIdx );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads the HCSM's state from a checkpoint.
+//
+// Remarks:  This function reads the data written by SaveState.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmSequential::RestoreState( CHcsmCheckpoint& ckpt )
+{
+	CHcsm::RestoreState( ckpt );
+
+	int activeIdx = -1;
+	ckpt.Get( activeIdx );
+	if( activeIdx >= m_numChildren )
+	{
+		ckpt.SetError( m_name + ": bad active child" );
+		return;
+	}
+
+	m_activeChild = activeIdx < 0 ? NULL : m_children[activeIdx];
+}
+
 //////////////////////////////////////////////////////////////////////
 // Execute
 //////////////////////////////////////////////////////////////////////
@@ -53,6 +53,8 @@ public:
 	CHcsm* GetDefaultActiveChild();
 	void ResetActiveChild();
 	virtual void Execute();
+	virtual void SaveState( CHcsmCheckpoint& );
+	virtual void RestoreState( CHcsmCheckpoint& );
 
 protected:
 	CHcsmSequential( CHcsmCollection*, const CSnoBlock*, string, bool = false, int typeId = -1 );
@@ -16,15 +16,17 @@
 
 
 #include "hcsmstorage.h"
+#include "hcsmcheckpoint.h"
+#include "hcsmnametable.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-CHcsmStorage::CHcsmStorage( string name )
+CHcsmStorage::CHcsmStorage( const string& name )
 {
 
-	m_name = name;
+	m_pName = CHcsmNameTable::Intern( name );
 	m_hasValue = false;
 
 }
@@ -43,7 +45,7 @@ CHcsmStorage& CHcsmStorage::operator=( const CHcsmStorage& objToCopy )
 	// check to make sure that object passed in is not me
 	if ( this != &objToCopy ) {
 
-		m_name = objToCopy.m_name;
+		m_pName = objToCopy.m_pName;
 		m_hasValue = objToCopy.m_hasValue;
 
 	}
@@ -56,3 +58,44 @@ CHcsmStorage::~CHcsmStorage()
 {
 
 }
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Writes the storage object's state to a checkpoint.
+//
+// Remarks:  Derived classes that hold values override this function and
+//   call it before writing their own data.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmStorage::SaveState( CHcsmCheckpoint& ckpt )
+{
+
+	ckpt.BeginSection( m_pName->c_str() );
+	ckpt.Put( m_hasValue );
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads the storage object's state from a checkpoint.
+//
+// Remarks:  This function reads the data written by SaveState.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void CHcsmStorage::RestoreState( CHcsmCheckpoint& ckpt )
+{
+
+	ckpt.CheckSection( m_pName->c_str() );
+	ckpt.Get( m_hasValue );
+
+}
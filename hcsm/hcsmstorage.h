@@ -24,6 +24,8 @@
 #include <string>
 using namespace std;
 
+class CHcsmCheckpoint;
+
 //////////////////////////////////////////////////////////////////////////////
 ///
 /// This class defines the attributes and operations needed by all input
@@ -42,14 +44,16 @@ public:
 	inline const string& GetName() const;
 	inline bool HasValue();
 	inline void SetNoValue();
+	virtual void SaveState( CHcsmCheckpoint& );
+	virtual void RestoreState( CHcsmCheckpoint& );
 
 protected:
-	CHcsmStorage( string );
+	CHcsmStorage( const string& );
 	CHcsmStorage( const CHcsmStorage& );
 	CHcsmStorage& operator=( const CHcsmStorage& );
 	virtual ~CHcsmStorage();
 
-	string m_name;
+	const string* m_pName;		// shared, see CHcsmNameTable
 	inline const char* MyName();
 	bool m_hasValue;
 };
@@ -77,6 +77,6 @@ inline void CHcsmStorage::SetNoValue()
 inline const string& CHcsmStorage::GetName() const
 {
 
-	return m_name;
+	return *m_pName;
 
 }
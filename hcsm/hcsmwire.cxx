@@ -0,0 +1,689 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: hcsmwire.cxx,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Encoding and decoding of the compact wire protocol
+// described in hcsmwire.h.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "hcsmwire.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <fcntl.h>
+#include <errno.h>
+#endif
+
+// size of the chunks WireRecv reads at a time
+const int cRECV_CHUNK = 16 * 1024;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// CWireWriter
+//
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Starts a new frame at the end of the buffer.  The length
+//  and the record count are filled in by EndFrame.
+//
+void
+CWireWriter::BeginFrame( unsigned int seq )
+{
+	m_frame   = m_buf.size();
+	m_numRecs = 0;
+	PutU32( 0 );
+	PutU16( cWIRE_MAGIC );
+	PutU8( cWIRE_VERSION );
+	PutU8( 0 );
+	PutU32( seq );
+}
+
+void
+CWireWriter::EndFrame( void )
+{
+	unsigned int size = (unsigned int) ( m_buf.size() - m_frame );
+	m_buf[m_frame + 0] = (unsigned char) ( size >> 24 );
+	m_buf[m_frame + 1] = (unsigned char) ( size >> 16 );
+	m_buf[m_frame + 2] = (unsigned char) ( size >> 8 );
+	m_buf[m_frame + 3] = (unsigned char) ( size );
+	m_buf[m_frame + 7] = (unsigned char) m_numRecs;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Starts a record in the current frame.  A frame can hold
+//  at most 255 records; the caller has to start a new frame before that.
+//
+void
+CWireWriter::BeginRecord( EWireOp op )
+{
+	m_record = m_buf.size();
+	PutU8( (unsigned char) op );
+	PutU32( 0 );
+	m_numRecs++;
+}
+
+void
+CWireWriter::EndRecord( void )
+{
+	unsigned int size = (unsigned int) ( m_buf.size() - m_record - cWIRE_RECORD_HDR );
+	m_buf[m_record + 1] = (unsigned char) ( size >> 24 );
+	m_buf[m_record + 2] = (unsigned char) ( size >> 16 );
+	m_buf[m_record + 3] = (unsigned char) ( size >> 8 );
+	m_buf[m_record + 4] = (unsigned char) ( size );
+}
+
+void
+CWireWriter::PutU16( unsigned short val )
+{
+	m_buf.push_back( (unsigned char) ( val >> 8 ) );
+	m_buf.push_back( (unsigned char) ( val ) );
+}
+
+void
+CWireWriter::PutU32( unsigned int val )
+{
+	m_buf.push_back( (unsigned char) ( val >> 24 ) );
+	m_buf.push_back( (unsigned char) ( val >> 16 ) );
+	m_buf.push_back( (unsigned char) ( val >> 8 ) );
+	m_buf.push_back( (unsigned char) ( val ) );
+}
+
+void
+CWireWriter::PutVarint( unsigned int val )
+{
+	while ( val >= 0x80 ) {
+		m_buf.push_back( (unsigned char) ( val | 0x80 ) );
+		val >>= 7;
+	}
+	m_buf.push_back( (unsigned char) val );
+}
+
+void
+CWireWriter::PutSigned( int val )
+{
+	PutVarint( ( (unsigned int) val << 1 ) ^ (unsigned int) ( val >> 31 ) );
+}
+
+void
+CWireWriter::PutFloat( float val )
+{
+	unsigned int bits;
+	memcpy( &bits, &val, sizeof( bits ) );
+	PutU32( bits );
+}
+
+void
+CWireWriter::PutString( const string& cVal )
+{
+	PutVarint( (unsigned int) cVal.size() );
+	m_buf.insert( m_buf.end(), cVal.begin(), cVal.end() );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// CWireReader
+//
+/////////////////////////////////////////////////////////////////////////////
+
+unsigned char
+CWireReader::GetU8( void )
+{
+	if ( m_error || m_cpCur + 1 > m_cpEnd ) {
+		m_error = true;
+		return 0;
+	}
+	return *m_cpCur++;
+}
+
+unsigned short
+CWireReader::GetU16( void )
+{
+	if ( m_error || m_cpCur + 2 > m_cpEnd ) {
+		m_error = true;
+		return 0;
+	}
+	unsigned short val = (unsigned short) ( ( m_cpCur[0] << 8 ) | m_cpCur[1] );
+	m_cpCur += 2;
+	return val;
+}
+
+unsigned int
+CWireReader::GetU32( void )
+{
+	if ( m_error || m_cpCur + 4 > m_cpEnd ) {
+		m_error = true;
+		return 0;
+	}
+	unsigned int val = ( (unsigned int) m_cpCur[0] << 24 ) |
+		( (unsigned int) m_cpCur[1] << 16 ) |
+		( (unsigned int) m_cpCur[2] << 8 ) | m_cpCur[3];
+	m_cpCur += 4;
+	return val;
+}
+
+unsigned int
+CWireReader::GetVarint( void )
+{
+	unsigned int val = 0;
+	for ( int shift = 0; shift < 35; shift += 7 ) {
+		unsigned char byte = GetU8();
+		if ( m_error ) return 0;
+		val |= (unsigned int) ( byte & 0x7F ) << shift;
+		if ( ( byte & 0x80 ) == 0 ) return val;
+	}
+	m_error = true;
+	return 0;
+}
+
+int
+CWireReader::GetSigned( void )
+{
+	unsigned int val = GetVarint();
+	return (int) ( val >> 1 ) ^ -(int) ( val & 1 );
+}
+
+float
+CWireReader::GetFloat( void )
+{
+	unsigned int bits = GetU32();
+	float val;
+	memcpy( &val, &bits, sizeof( val ) );
+	return val;
+}
+
+void
+CWireReader::GetString( string& val )
+{
+	unsigned int size = GetVarint();
+	if ( m_error || size > Remaining() ) {
+		m_error = true;
+		return;
+	}
+	val.assign( (const char*) m_cpCur, size );
+	m_cpCur += size;
+}
+
+bool
+CWireReader::Skip( size_t size )
+{
+	if ( m_error || size > Remaining() ) {
+		m_error = true;
+		return false;
+	}
+	m_cpCur += size;
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Checks if a buffer starts with a complete frame.
+//
+// Arguments:
+// cpData - the received bytes
+// size   - the number of bytes in cpData
+//
+// Returns:
+// The size of the frame if it is complete, 0 if more data is needed or
+// -1 if the data does not start with a valid frame header.
+//
+int
+WireFrameSize( const unsigned char* cpData, size_t size )
+{
+	if ( size < (size_t) cWIRE_HEADER_SIZE ) return 0;
+
+	CWireReader reader( cpData, size );
+	unsigned int   frameSize = reader.GetU32();
+	unsigned short magic     = reader.GetU16();
+	unsigned char  version   = reader.GetU8();
+
+	if ( magic != cWIRE_MAGIC || version != cWIRE_VERSION ||
+			frameSize < (unsigned int) cWIRE_HEADER_SIZE ||
+			frameSize > (unsigned int) cWIRE_MAX_FRAME ) {
+		return -1;
+	}
+
+	return frameSize <= size ? (int) frameSize : 0;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Splits a complete frame into its records.
+//
+// Arguments:
+// cpFrame - the frame, as validated by WireFrameSize
+// size    - the size of the frame
+// seq     - (output) the sequence number of the frame
+// recs    - (output) the opcode of each record along with a reader
+//           positioned at its data
+//
+// Returns:
+// False if the records do not add up to the frame size.
+//
+bool
+WireForEachRecord(
+			const unsigned char* cpFrame,
+			int                  size,
+			unsigned int&        seq,
+			vector<pair<EWireOp, CWireReader> >& recs
+			)
+{
+	CWireReader reader( cpFrame, size );
+	reader.Skip( 7 );
+	int numRecs = reader.GetU8();
+	seq = reader.GetU32();
+
+	recs.clear();
+	for ( int i = 0; i < numRecs; i++ ) {
+		EWireOp op = (EWireOp) reader.GetU8();
+		unsigned int recSize = reader.GetU32();
+		if ( !reader.IsValid() || recSize > reader.Remaining() ) return false;
+
+		recs.push_back( make_pair( op, CWireReader( reader.Cur(), recSize ) ) );
+		reader.Skip( recSize );
+	}
+
+	return reader.IsValid() && reader.IsAtEnd();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the mask of the fields that differ between two
+//  versions of the same object.  Floats are compared bit for bit so any
+//  change that can be seen on the client is sent.
+//
+static unsigned short
+ChangedFields( const TWireObj& cPrev, const TWireObj& cCur )
+{
+	unsigned short mask = 0;
+
+	if ( cPrev.type != cCur.type ) mask |= eWIRE_F_TYPE;
+	if ( cPrev.solId != cCur.solId || cPrev.hcsmId != cCur.hcsmId ) {
+		mask |= eWIRE_F_IDS;
+	}
+	if ( cPrev.name != cCur.name ) mask |= eWIRE_F_NAME;
+	if ( memcmp( cPrev.pos, cCur.pos, sizeof( cCur.pos ) ) ) mask |= eWIRE_F_POS;
+	if ( memcmp( cPrev.tan, cCur.tan, sizeof( cCur.tan ) ) ) mask |= eWIRE_F_TAN;
+	if ( memcmp( cPrev.lat, cCur.lat, sizeof( cCur.lat ) ) ) mask |= eWIRE_F_LAT;
+	if ( memcmp( &cPrev.vel, &cCur.vel, sizeof( cCur.vel ) ) ) mask |= eWIRE_F_VEL;
+	if ( cPrev.colorIndex != cCur.colorIndex ) mask |= eWIRE_F_COLOR;
+	if ( cPrev.specific != cCur.specific ) mask |= eWIRE_F_SPECIFIC;
+	if ( memcmp( cPrev.bbox, cCur.bbox, sizeof( cCur.bbox ) ) ) mask |= eWIRE_F_BBOX;
+
+	return mask;
+}
+
+static void
+PutObj( CWireWriter& writer, const TWireObj& cObj, unsigned short mask )
+{
+	int i;
+
+	writer.PutVarint( cObj.id );
+	writer.PutU16( mask );
+	if ( mask & eWIRE_F_TYPE ) writer.PutVarint( cObj.type );
+	if ( mask & eWIRE_F_IDS ) {
+		writer.PutSigned( cObj.solId );
+		writer.PutSigned( cObj.hcsmId );
+	}
+	if ( mask & eWIRE_F_NAME ) writer.PutString( cObj.name );
+	if ( mask & eWIRE_F_POS ) for ( i = 0; i < 3; i++ ) writer.PutFloat( cObj.pos[i] );
+	if ( mask & eWIRE_F_TAN ) for ( i = 0; i < 3; i++ ) writer.PutFloat( cObj.tan[i] );
+	if ( mask & eWIRE_F_LAT ) for ( i = 0; i < 3; i++ ) writer.PutFloat( cObj.lat[i] );
+	if ( mask & eWIRE_F_VEL ) writer.PutFloat( cObj.vel );
+	if ( mask & eWIRE_F_COLOR ) writer.PutSigned( cObj.colorIndex );
+	if ( mask & eWIRE_F_SPECIFIC ) writer.PutVarint( cObj.specific );
+	if ( mask & eWIRE_F_BBOX ) for ( i = 0; i < 6; i++ ) writer.PutFloat( cObj.bbox[i] );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Writes an eWIRE_OBJDELTA record that turns the object list
+//  a client holds into the current one.
+//
+// Remarks:
+// Both lists have to be sorted by object id.  Objects that did not change
+// are not written at all, changed objects carry only the changed fields,
+// new objects carry all fields and objects that are gone are listed by
+// id at the end of the record.  A keyframe ignores cPrev and sends every
+// object in full.
+//
+// Arguments:
+// writer   - where to write the record; a frame must have been started
+// frame    - the simulation frame the objects belong to
+// keyframe - whether the client should discard what it holds
+// cPrev    - the objects the client holds
+// cCur     - the current objects
+//
+void
+WireEncodeObjDelta(
+			CWireWriter&             writer,
+			int                      frame,
+			bool                     keyframe,
+			const vector<TWireObj>&  cPrev,
+			const vector<TWireObj>&  cCur
+			)
+{
+	static const vector<TWireObj> cEmpty;
+	const vector<TWireObj>& cOld = keyframe ? cEmpty : cPrev;
+
+	writer.BeginRecord( eWIRE_OBJDELTA );
+	writer.PutVarint( frame );
+	writer.PutU8( keyframe ? cWIRE_KEYFRAME : 0 );
+
+	// first pass to count the changed objects, as the count goes first
+	vector<unsigned short> masks( cCur.size() );
+	vector<int>            removed;
+	unsigned int           numChanged = 0;
+	size_t                 p = 0;
+	size_t                 c;
+
+	for ( c = 0; c < cCur.size(); c++ ) {
+		while ( p < cOld.size() && cOld[p].id < cCur[c].id ) {
+			removed.push_back( cOld[p].id );
+			p++;
+		}
+		if ( p < cOld.size() && cOld[p].id == cCur[c].id ) {
+			masks[c] = ChangedFields( cOld[p], cCur[c] );
+			p++;
+		}
+		else {
+			masks[c] = eWIRE_F_ALL;
+		}
+		if ( masks[c] ) numChanged++;
+	}
+	for ( ; p < cOld.size(); p++ ) removed.push_back( cOld[p].id );
+
+	writer.PutVarint( numChanged );
+	for ( c = 0; c < cCur.size(); c++ ) {
+		if ( masks[c] ) PutObj( writer, cCur[c], masks[c] );
+	}
+
+	writer.PutVarint( (unsigned int) removed.size() );
+	for ( size_t r = 0; r < removed.size(); r++ ) {
+		writer.PutVarint( removed[r] );
+	}
+
+	writer.EndRecord();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Applies an eWIRE_OBJDELTA record to the objects a client
+//  holds.
+//
+// Arguments:
+// reader - positioned at the data of the record
+// frame  - (output) the frame the objects now reflect
+// objs   - the objects held, updated in place
+//
+// Returns:
+// False if the record is malformed, in which case objs may have been
+// partially updated and the client should request a snapshot.
+//
+bool
+WireDecodeObjDelta( CWireReader& reader, int& frame, TWireObjMap& objs )
+{
+	int i;
+
+	frame = (int) reader.GetVarint();
+	unsigned char flags = reader.GetU8();
+	if ( flags & cWIRE_KEYFRAME ) objs.clear();
+
+	unsigned int numChanged = reader.GetVarint();
+	for ( unsigned int n = 0; n < numChanged && reader.IsValid(); n++ ) {
+		int id = (int) reader.GetVarint();
+		unsigned short mask = reader.GetU16();
+
+		TWireObj& obj = objs[id];
+		obj.id = id;
+		if ( mask & eWIRE_F_TYPE ) obj.type = (int) reader.GetVarint();
+		if ( mask & eWIRE_F_IDS ) {
+			obj.solId  = reader.GetSigned();
+			obj.hcsmId = reader.GetSigned();
+		}
+		if ( mask & eWIRE_F_NAME ) reader.GetString( obj.name );
+		if ( mask & eWIRE_F_POS ) for ( i = 0; i < 3; i++ ) obj.pos[i] = reader.GetFloat();
+		if ( mask & eWIRE_F_TAN ) for ( i = 0; i < 3; i++ ) obj.tan[i] = reader.GetFloat();
+		if ( mask & eWIRE_F_LAT ) for ( i = 0; i < 3; i++ ) obj.lat[i] = reader.GetFloat();
+		if ( mask & eWIRE_F_VEL ) obj.vel = reader.GetFloat();
+		if ( mask & eWIRE_F_COLOR ) obj.colorIndex = reader.GetSigned();
+		if ( mask & eWIRE_F_SPECIFIC ) obj.specific = (int) reader.GetVarint();
+		if ( mask & eWIRE_F_BBOX ) for ( i = 0; i < 6; i++ ) obj.bbox[i] = reader.GetFloat();
+	}
+
+	unsigned int numRemoved = reader.GetVarint();
+	for ( unsigned int r = 0; r < numRemoved && reader.IsValid(); r++ ) {
+		objs.erase( (int) reader.GetVarint() );
+	}
+
+	return reader.IsValid();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Fills a TWireObj with the current state of a CVED object.
+//  Lights get an hcsm id of -1, as in the TObjDesc protocol.
+//
+void
+WireObjFromCved( CCved& cved, int id, TWireObj& obj )
+{
+	cvTObjState state;
+	cved.GetObjState( id, state );
+
+	obj.id         = id;
+	obj.type       = cved.GetObjType( id );
+	obj.solId      = cved.GetObjSolId( id );
+	obj.hcsmId     = obj.type == eCV_TRAFFIC_LIGHT ? -1 : cved.GetObjHcsmId( id );
+	obj.colorIndex = 0;
+	obj.name       = cved.GetObjName( id );
+
+	if ( obj.type == eCV_TRAFFIC_LIGHT ) {
+		obj.specific = cved.GetTrafficLightState( id );
+	}
+	else {
+		obj.specific = cved.GetVehicleVisualState( id );
+	}
+
+	obj.pos[0]  = (float) state.anyState.position.x;
+	obj.pos[1]  = (float) state.anyState.position.y;
+	obj.pos[2]  = (float) state.anyState.position.z;
+	obj.tan[0]  = (float) state.anyState.tangent.i;
+	obj.tan[1]  = (float) state.anyState.tangent.j;
+	obj.tan[2]  = (float) state.anyState.tangent.k;
+	obj.lat[0]  = (float) state.anyState.lateral.i;
+	obj.lat[1]  = (float) state.anyState.lateral.j;
+	obj.lat[2]  = (float) state.anyState.lateral.k;
+	obj.bbox[0] = (float) state.anyState.boundBox[0].x;
+	obj.bbox[1] = (float) state.anyState.boundBox[0].y;
+	obj.bbox[2] = (float) state.anyState.boundBox[0].z;
+	obj.bbox[3] = (float) state.anyState.boundBox[1].x;
+	obj.bbox[4] = (float) state.anyState.boundBox[1].y;
+	obj.bbox[5] = (float) state.anyState.boundBox[1].z;
+	obj.vel     = (float) state.anyState.vel;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Converts a TWireObj to the TObjDesc structure used by the
+//  rest of the client library.  Unlike the TObjDesc received through
+//  CMD_GETDYNAOBJS, the result is in host byte order.
+//
+void
+WireObjToObjDesc( const TWireObj& cObj, TObjDesc& desc )
+{
+	memset( &desc, 0, sizeof( desc ) );
+
+	desc.id     = cObj.id;
+	desc.type   = (cvEObjType) cObj.type;
+	desc.solId  = cObj.solId;
+	desc.hcsmId = cObj.hcsmId;
+	strncpy( desc.name, cObj.name.c_str(), cOBJ_NAME_LEN - 1 );
+
+	desc.state.position.x    = cObj.pos[0];
+	desc.state.position.y    = cObj.pos[1];
+	desc.state.position.z    = cObj.pos[2];
+	desc.state.tangent.i     = cObj.tan[0];
+	desc.state.tangent.j     = cObj.tan[1];
+	desc.state.tangent.k     = cObj.tan[2];
+	desc.state.lateral.i     = cObj.lat[0];
+	desc.state.lateral.j     = cObj.lat[1];
+	desc.state.lateral.k     = cObj.lat[2];
+	desc.state.boundBox[0].x = cObj.bbox[0];
+	desc.state.boundBox[0].y = cObj.bbox[1];
+	desc.state.boundBox[0].z = cObj.bbox[2];
+	desc.state.boundBox[1].x = cObj.bbox[3];
+	desc.state.boundBox[1].y = cObj.bbox[4];
+	desc.state.boundBox[1].z = cObj.bbox[5];
+	desc.state.vel           = cObj.vel;
+	desc.state.colorIndex    = (short) cObj.colorIndex;
+
+	if ( cObj.type == eCV_TRAFFIC_LIGHT ) {
+		desc.state.specific.state = (eCVTrafficLightState) cObj.specific;
+	}
+	else {
+		desc.state.specific.visualState = (TU16b) cObj.specific;
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Puts a socket in non-blocking mode.
+//
+bool
+WireSetNonBlocking( TWireSock sock )
+{
+#ifdef _WIN32
+	unsigned long setit = 1;
+	return ioctlsocket( sock, FIONBIO, &setit ) != SOCKET_ERROR;
+#else
+	int flags = fcntl( sock, F_GETFL, 0 );
+	return flags >= 0 && fcntl( sock, F_SETFL, flags | O_NONBLOCK ) >= 0;
+#endif
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Appends everything that can be read from a non-blocking
+//  socket without waiting to a buffer.
+//
+// Returns:
+// The number of bytes read, or -1 if the peer closed the connection or
+// an error occurred.
+//
+int
+WireRecv( TWireSock sock, vector<unsigned char>& in )
+{
+	int total = 0;
+
+	for ( ;; ) {
+		size_t oldSize = in.size();
+		in.resize( oldSize + cRECV_CHUNK );
+		int n = recv( sock, (char*) &in[oldSize], cRECV_CHUNK, 0 );
+		in.resize( oldSize + ( n > 0 ? n : 0 ) );
+
+		if ( n > 0 ) {
+			total += n;
+			if ( n < cRECV_CHUNK ) return total;
+		}
+		else if ( n == 0 ) {
+			return -1;
+		}
+		else {
+#ifdef _WIN32
+			if ( WSAGetLastError() == WSAEWOULDBLOCK ) return total;
+#else
+			if ( errno == EAGAIN || errno == EWOULDBLOCK ) return total;
+			if ( errno == EINTR ) continue;
+#endif
+			return -1;
+		}
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sends as much of a buffer as a non-blocking socket accepts
+//  without waiting.
+//
+// Returns:
+// The number of bytes sent, which may be 0, or -1 on error.
+//
+int
+WireSend( TWireSock sock, const unsigned char* cpData, int size )
+{
+	int total = 0;
+
+	while ( total < size ) {
+#ifdef MSG_NOSIGNAL
+		int n = send( sock, (const char*) cpData + total, size - total, MSG_NOSIGNAL );
+#else
+		int n = send( sock, (const char*) cpData + total, size - total, 0 );
+#endif
+		if ( n > 0 ) {
+			total += n;
+			continue;
+		}
+#ifdef _WIN32
+		if ( n < 0 && WSAGetLastError() == WSAEWOULDBLOCK ) return total;
+#else
+		if ( n < 0 && errno == EINTR ) continue;
+		if ( n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) ) return total;
+#endif
+		return -1;
+	}
+
+	return total;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Waits until a socket can be read from or written to.
+//
+// Arguments:
+// sock      - the socket
+// forWrite  - wait for writing instead of reading
+// timeoutMs - how long to wait, in milliseconds; 0 just checks
+//
+// Returns:
+// A positive value if the socket is ready, 0 on timeout or -1 on error.
+//
+int
+WireWait( TWireSock sock, bool forWrite, int timeoutMs )
+{
+	fd_set set;
+	FD_ZERO( &set );
+	FD_SET( sock, &set );
+
+	timeval tv;
+	tv.tv_sec  = timeoutMs / 1000;
+	tv.tv_usec = ( timeoutMs % 1000 ) * 1000;
+
+	return select( (int) sock + 1, forWrite ? 0 : &set, forWrite ? &set : 0, 0, &tv );
+}
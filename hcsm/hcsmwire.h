@@ -0,0 +1,219 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: hcsmwire.h,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Header file for the compact wire protocol used by
+// monitoring clients to follow the objects of a running scenario.
+//
+// Unlike the TMessage protocol in hcsmconnect.h, which sends a full
+// TObjDesc for every object on every request, this protocol streams only
+// the fields of each object that changed since the last frame the client
+// received.
+//
+// Everything travels in frames:
+//
+//     u32   length of the frame, including this field
+//     u16   cWIRE_MAGIC
+//     u8    cWIRE_VERSION
+//     u8    number of records
+//     u32   sequence number
+//     records
+//
+// and each record is:
+//
+//     u8    opcode (EWireOp)
+//     u32   length of the data that follows
+//     data
+//
+// A client may put several commands in one frame; the server answers
+// each frame it receives with an eWIRE_ACK record carrying the frame's
+// sequence number.  All multi-byte values are in network byte order,
+// floats are IEEE single precision, and counts and ids are unsigned
+// LEB128 varints (signed values are zig-zag encoded first).
+//
+// Layout of the eWIRE_OBJDELTA record:
+//
+//     varint  frame
+//     u8      flags (cWIRE_KEYFRAME: discard all objects held so far)
+//     varint  number of objects that follow
+//       varint  object id
+//       u16     mask of EWireField values
+//       the fields present in the mask, in the order of EWireField
+//     varint  number of deleted objects
+//       varint  object id
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef _HCSMWIRE_H_
+#define _HCSMWIRE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "hcsmconnect.h"
+
+using namespace std;
+
+// where the Gateway listens for wire protocol connections
+#define DEFAULT_WIRE_PORT  (DEFAULT_PORT+2)
+
+#ifdef _WIN32
+typedef SOCKET TWireSock;
+#else
+typedef int    TWireSock;
+#endif
+const TWireSock cWIRE_NO_SOCK = (TWireSock) -1;
+
+const unsigned short cWIRE_MAGIC       = 0xCFAC;
+const unsigned char  cWIRE_VERSION     = 1;
+const int            cWIRE_HEADER_SIZE = 12;
+const int            cWIRE_RECORD_HDR  = 5;
+const int            cWIRE_MAX_FRAME   = 4 * 1024 * 1024;
+const unsigned char  cWIRE_KEYFRAME    = 0x01;
+
+enum EWireOp {
+	// client to server
+	eWIRE_PING       = 1,	// no data
+	eWIRE_SUBSCRIBE  = 2,	// varint interval in frames, 0 to stop
+	eWIRE_SNAPSHOT   = 3,	// no data, next delta is a keyframe
+	eWIRE_CONTROLOBJ = 4,	// varint hcsm id, varint cmd, zig-zag value
+
+	// server to client
+	eWIRE_ACK        = 16,	// u32 sequence number of the acknowledged frame
+	eWIRE_OBJDELTA   = 17,	// see above
+	eWIRE_ERROR      = 18	// string
+};
+
+enum EWireField {
+	eWIRE_F_TYPE     = 0x001,	// varint
+	eWIRE_F_IDS      = 0x002,	// zig-zag sol id, zig-zag hcsm id
+	eWIRE_F_NAME     = 0x004,	// string
+	eWIRE_F_POS      = 0x008,	// 3 floats
+	eWIRE_F_TAN      = 0x010,	// 3 floats
+	eWIRE_F_LAT      = 0x020,	// 3 floats
+	eWIRE_F_VEL      = 0x040,	// float
+	eWIRE_F_COLOR    = 0x080,	// zig-zag
+	eWIRE_F_SPECIFIC = 0x100,	// varint visual state or light state
+	eWIRE_F_BBOX     = 0x200,	// 6 floats
+	eWIRE_F_ALL      = 0x3FF
+};
+
+//
+// The state of one object as carried by the protocol.
+//
+struct TWireObj {
+	int     id;
+	int     type;
+	int     solId;
+	int     hcsmId;
+	int     colorIndex;
+	int     specific;		// visual state, or the light state for lights
+	float   pos[3];
+	float   tan[3];
+	float   lat[3];
+	float   bbox[6];
+	float   vel;
+	string  name;
+};
+
+typedef map<int, TWireObj> TWireObjMap;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Appends frames and records to a byte buffer.
+//
+class CWireWriter
+{
+public:
+	CWireWriter( vector<unsigned char>& buf ) : m_buf( buf ), m_frame( 0 ),
+		m_record( 0 ), m_numRecs( 0 ) {};
+
+	void BeginFrame( unsigned int seq );
+	void EndFrame( void );
+	void BeginRecord( EWireOp op );
+	void EndRecord( void );
+
+	void PutU8( unsigned char val ) { m_buf.push_back( val ); };
+	void PutU16( unsigned short val );
+	void PutU32( unsigned int val );
+	void PutVarint( unsigned int val );
+	void PutSigned( int val );
+	void PutFloat( float val );
+	void PutString( const string& cVal );
+
+private:
+	vector<unsigned char>& m_buf;
+	size_t                 m_frame;		// where the current frame starts
+	size_t                 m_record;	// where the current record starts
+	int                    m_numRecs;
+
+	CWireWriter& operator=( const CWireWriter& );
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Reads values from a byte range.  Reading past the end puts the reader
+// in the error state, after which all reads return 0.
+//
+class CWireReader
+{
+public:
+	CWireReader( const unsigned char* cpData, size_t size ) :
+		m_cpCur( cpData ), m_cpEnd( cpData + size ), m_error( false ) {};
+
+	bool IsValid( void ) const { return !m_error; };
+	bool IsAtEnd( void ) const { return m_cpCur >= m_cpEnd; };
+	size_t Remaining( void ) const { return m_cpEnd - m_cpCur; };
+
+	unsigned char  GetU8( void );
+	unsigned short GetU16( void );
+	unsigned int   GetU32( void );
+	unsigned int   GetVarint( void );
+	int            GetSigned( void );
+	float          GetFloat( void );
+	void           GetString( string& val );
+	bool           Skip( size_t size );
+	const unsigned char* Cur( void ) const { return m_cpCur; };
+
+private:
+	const unsigned char* m_cpCur;
+	const unsigned char* m_cpEnd;
+	bool                 m_error;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Helper functions.
+//
+int  WireFrameSize( const unsigned char* cpData, size_t size );
+bool WireForEachRecord(
+			const unsigned char* cpFrame,
+			int                  size,
+			unsigned int&        seq,
+			vector<pair<EWireOp, CWireReader> >& recs
+			);
+
+void WireEncodeObjDelta(
+			CWireWriter&             writer,
+			int                      frame,
+			bool                     keyframe,
+			const vector<TWireObj>&  cPrev,
+			const vector<TWireObj>&  cCur
+			);
+bool WireDecodeObjDelta( CWireReader& reader, int& frame, TWireObjMap& objs );
+
+void WireObjFromCved( CCved& cved, int id, TWireObj& obj );
+void WireObjToObjDesc( const TWireObj& cObj, TObjDesc& desc );
+
+bool WireSetNonBlocking( TWireSock sock );
+int  WireRecv( TWireSock sock, vector<unsigned char>& in );
+int  WireSend( TWireSock sock, const unsigned char* cpData, int size );
+int  WireWait( TWireSock sock, bool forWrite, int timeoutMs );
+
+#endif // _HCSMWIRE_H_
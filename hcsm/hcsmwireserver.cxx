@@ -0,0 +1,517 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: hcsmwireserver.cxx,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Implementation of the CHcsmWireServer class.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "hcsmwireserver.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#endif
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+// Provide consistency in error messages
+static const char s_Pre[] = "Hcsm Wire Server";
+
+// most events handled by one epoll_wait call
+const int cMAX_EVENTS = 64;
+
+// records sent in reply to a single client frame are kept well below the
+// 255 a frame can hold
+const int cMAX_REPLY_RECS = 200;
+
+CHcsmWireServer::CHcsmWireServer() :
+	m_listenSock( cWIRE_NO_SOCK )
+#ifdef __linux__
+	, m_epoll( -1 )
+#endif
+{
+}
+
+CHcsmWireServer::~CHcsmWireServer()
+{
+	Close();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Starts listening for clients on the specified port.
+//
+// Returns:
+// True if everything was ok or false otherwise.  In case of errors, error
+// messages are printed to stderr.
+//
+bool
+CHcsmWireServer::Open( int port )
+{
+	Close();
+
+	TWireSock sock = socket( AF_INET, SOCK_STREAM, 0 );
+	if ( sock == cWIRE_NO_SOCK ) {
+		fprintf( stderr, "%s: socket() failed\n", s_Pre );
+		return false;
+	}
+
+	sockaddr_in myAddr;
+	memset( &myAddr, 0, sizeof( myAddr ) );
+	myAddr.sin_family      = AF_INET;
+	myAddr.sin_addr.s_addr = htonl( INADDR_ANY );
+	myAddr.sin_port        = htons( port );
+
+	int doit = 1;
+	setsockopt( sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &doit, sizeof( doit ) );
+
+	if ( ::bind( sock, (sockaddr*) &myAddr, sizeof( myAddr ) ) < 0 ||
+			listen( sock, 8 ) < 0 || !WireSetNonBlocking( sock ) ) {
+		fprintf( stderr, "%s: can't listen on port %d\n", s_Pre, port );
+		CloseSocket( sock );
+		return false;
+	}
+
+#ifdef __linux__
+	m_epoll = epoll_create1( 0 );
+	if ( m_epoll < 0 ) {
+		fprintf( stderr, "%s: epoll_create1() failed\n", s_Pre );
+		CloseSocket( sock );
+		return false;
+	}
+
+	epoll_event ev;
+	memset( &ev, 0, sizeof( ev ) );
+	ev.events   = EPOLLIN;
+	ev.data.ptr = 0;			// marks the listening socket
+	epoll_ctl( m_epoll, EPOLL_CTL_ADD, sock, &ev );
+#endif
+
+	m_listenSock = sock;
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Closes all connections and stops listening.
+//
+void
+CHcsmWireServer::Close( void )
+{
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		CloseSocket( m_conns[i]->sock );
+		delete m_conns[i];
+	}
+	m_conns.clear();
+
+	if ( m_listenSock != cWIRE_NO_SOCK ) {
+		CloseSocket( m_listenSock );
+		m_listenSock = cWIRE_NO_SOCK;
+	}
+
+#ifdef __linux__
+	if ( m_epoll >= 0 ) {
+		close( m_epoll );
+		m_epoll = -1;
+	}
+#endif
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Handles everything that is ready on the server's sockets
+//  without waiting: new connections, incoming frames and pending output.
+//
+// Arguments:
+// controls - (output) control commands received, in the order received;
+//            the vector is appended to
+//
+void
+CHcsmWireServer::Poll( vector<TWireControl>& controls )
+{
+	if ( !IsOpen() ) return;
+
+#ifdef __linux__
+	epoll_event events[cMAX_EVENTS];
+	int n;
+
+	do {
+		n = epoll_wait( m_epoll, events, cMAX_EVENTS, 0 );
+		for ( int i = 0; i < n; i++ ) {
+			TConn* pConn = (TConn*) events[i].data.ptr;
+			if ( pConn == 0 ) {
+				Accept();
+				continue;
+			}
+			if ( pConn->dead ) continue;
+
+			if ( events[i].events & ( EPOLLERR | EPOLLHUP ) ) {
+				pConn->dead = true;
+				continue;
+			}
+			if ( events[i].events & EPOLLIN ) Read( pConn, controls );
+			if ( !pConn->dead && ( events[i].events & EPOLLOUT ) ) Flush( pConn );
+		}
+	} while ( n == cMAX_EVENTS );
+#else
+	fd_set readSet;
+	fd_set writeSet;
+	FD_ZERO( &readSet );
+	FD_ZERO( &writeSet );
+
+	int maxSock = (int) m_listenSock;
+	FD_SET( m_listenSock, &readSet );
+	size_t i;
+	for ( i = 0; i < m_conns.size(); i++ ) {
+		FD_SET( m_conns[i]->sock, &readSet );
+		if ( m_conns[i]->writeWatched ) FD_SET( m_conns[i]->sock, &writeSet );
+		if ( (int) m_conns[i]->sock > maxSock ) maxSock = (int) m_conns[i]->sock;
+	}
+
+	timeval zero = { 0, 0 };
+	if ( select( maxSock + 1, &readSet, &writeSet, 0, &zero ) <= 0 ) return;
+
+	// connections accepted below are not in the sets yet
+	size_t numConns = m_conns.size();
+	if ( FD_ISSET( m_listenSock, &readSet ) ) Accept();
+
+	for ( i = 0; i < numConns; i++ ) {
+		TConn* pConn = m_conns[i];
+		if ( FD_ISSET( pConn->sock, &readSet ) ) Read( pConn, controls );
+		if ( !pConn->dead && FD_ISSET( pConn->sock, &writeSet ) ) Flush( pConn );
+	}
+#endif
+
+	RemoveDead();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Checks if any client should receive the objects of the
+//  specified frame, so the caller can skip collecting them otherwise.
+//
+bool
+CHcsmWireServer::WantsObjs( int frame ) const
+{
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		if ( IsDue( m_conns[i], frame ) ) return true;
+	}
+	return false;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns a frame interval such that every frame in which
+//  some client is due is a multiple of it, for owners that decide
+//  whether to collect the objects on another thread.
+//
+// Returns: 0 if no client is subscribed, 1 if a client is waiting for
+//  a snapshot, otherwise the greatest common divisor of the client
+//  intervals.
+//
+int
+CHcsmWireServer::DueInterval( void ) const
+{
+	int interval = 0;
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		const TConn* cpConn = m_conns[i];
+		if ( cpConn->dead ) continue;
+		if ( cpConn->wantSnapshot ) return 1;
+		if ( cpConn->interval <= 0 ) continue;
+
+		int a = interval;
+		int b = cpConn->interval;
+		while ( b != 0 ) {
+			int t = a % b;
+			a = b;
+			b = t;
+		}
+		interval = a;
+	}
+	return interval;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sends the objects of a frame to every client that is due
+//  to receive them.
+//
+// Arguments:
+// frame - the current frame
+// cObjs - the current objects, sorted by id
+//
+void
+CHcsmWireServer::PublishObjs( int frame, const vector<TWireObj>& cObjs )
+{
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		TConn* pConn = m_conns[i];
+		if ( !IsDue( pConn, frame ) ) continue;
+
+		CWireWriter writer( pConn->out );
+		writer.BeginFrame( pConn->seq++ );
+		WireEncodeObjDelta( writer, frame, pConn->needKeyframe, pConn->sent, cObjs );
+		writer.EndFrame();
+
+		pConn->sent         = cObjs;
+		pConn->needKeyframe = false;
+		pConn->wantSnapshot = false;
+
+		Flush( pConn );
+	}
+
+	RemoveDead();
+}
+
+
+void
+CHcsmWireServer::Accept( void )
+{
+	for ( ;; ) {
+		TWireSock sock = accept( m_listenSock, 0, 0 );
+		if ( sock == cWIRE_NO_SOCK ) return;
+
+		if ( !WireSetNonBlocking( sock ) ) {
+			CloseSocket( sock );
+			continue;
+		}
+		int doit = 1;
+		setsockopt( sock, IPPROTO_TCP, TCP_NODELAY, (const char*) &doit, sizeof( doit ) );
+
+		TConn* pConn = new TConn;
+		pConn->sock         = sock;
+		pConn->outPos       = 0;
+		pConn->seq          = 0;
+		pConn->interval     = 0;
+		pConn->wantSnapshot = false;
+		pConn->needKeyframe = true;
+		pConn->writeWatched = false;
+		pConn->dead         = false;
+
+#ifdef __linux__
+		epoll_event ev;
+		memset( &ev, 0, sizeof( ev ) );
+		ev.events   = EPOLLIN;
+		ev.data.ptr = pConn;
+		if ( epoll_ctl( m_epoll, EPOLL_CTL_ADD, sock, &ev ) < 0 ) {
+			CloseSocket( sock );
+			delete pConn;
+			continue;
+		}
+#endif
+
+		m_conns.push_back( pConn );
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Reads what is available on a connection and processes
+//  every complete frame.
+//
+void
+CHcsmWireServer::Read( TConn* pConn, vector<TWireControl>& controls )
+{
+	if ( WireRecv( pConn->sock, pConn->in ) < 0 ) {
+		pConn->dead = true;
+		return;
+	}
+
+	size_t pos = 0;
+	while ( pos < pConn->in.size() ) {
+		int size = WireFrameSize( &pConn->in[0] + pos, pConn->in.size() - pos );
+		if ( size == 0 ) break;
+		if ( size < 0 ) {
+			fprintf( stderr, "%s: bad frame from client, dropping it\n", s_Pre );
+			pConn->dead = true;
+			return;
+		}
+
+		ProcessFrame( pConn, &pConn->in[0] + pos, size, controls );
+		pos += size;
+	}
+
+	pConn->in.erase( pConn->in.begin(), pConn->in.begin() + pos );
+	Flush( pConn );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Executes the records in a frame received from a client and
+//  queues the acknowledgment of the frame.
+//
+void
+CHcsmWireServer::ProcessFrame(
+			TConn*               pConn,
+			const unsigned char* cpFrame,
+			int                  size,
+			vector<TWireControl>& controls
+			)
+{
+	unsigned int seq;
+	vector<pair<EWireOp, CWireReader> > recs;
+
+	CWireWriter writer( pConn->out );
+	writer.BeginFrame( pConn->seq++ );
+
+	if ( !WireForEachRecord( cpFrame, size, seq, recs ) ) {
+		writer.BeginRecord( eWIRE_ERROR );
+		writer.PutString( "malformed frame" );
+		writer.EndRecord();
+		writer.EndFrame();
+		return;
+	}
+
+	int numReplies = 0;
+	for ( size_t i = 0; i < recs.size(); i++ ) {
+		CWireReader& reader = recs[i].second;
+
+		switch ( recs[i].first ) {
+		case eWIRE_PING:
+			break;
+
+		case eWIRE_SUBSCRIBE:
+			pConn->interval = (int) reader.GetVarint();
+			break;
+
+		case eWIRE_SNAPSHOT:
+			pConn->wantSnapshot = true;
+			pConn->needKeyframe = true;
+			break;
+
+		case eWIRE_CONTROLOBJ:
+			{
+				TWireControl ctrl;
+				ctrl.hcsmId = (int) reader.GetVarint();
+				ctrl.cmd    = (int) reader.GetVarint();
+				ctrl.val    = reader.GetSigned();
+				if ( reader.IsValid() ) controls.push_back( ctrl );
+			}
+			break;
+
+		default:
+			if ( numReplies < cMAX_REPLY_RECS ) {
+				char msg[64];
+				sprintf( msg, "unknown opcode %d", (int) recs[i].first );
+				writer.BeginRecord( eWIRE_ERROR );
+				writer.PutString( msg );
+				writer.EndRecord();
+				numReplies++;
+			}
+			break;
+		}
+	}
+
+	writer.BeginRecord( eWIRE_ACK );
+	writer.PutU32( seq );
+	writer.EndRecord();
+	writer.EndFrame();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sends as much pending output as the socket accepts and
+//  asks to be told when it can take more.
+//
+void
+CHcsmWireServer::Flush( TConn* pConn )
+{
+	size_t pending = pConn->out.size() - pConn->outPos;
+	if ( pending > 0 ) {
+		int n = WireSend( pConn->sock, &pConn->out[0] + pConn->outPos, (int) pending );
+		if ( n < 0 ) {
+			pConn->dead = true;
+			return;
+		}
+		pConn->outPos += n;
+	}
+
+	if ( pConn->outPos == pConn->out.size() ) {
+		pConn->out.clear();
+		pConn->outPos = 0;
+	}
+	else if ( pConn->outPos > pConn->out.size() / 2 ) {
+		pConn->out.erase( pConn->out.begin(), pConn->out.begin() + pConn->outPos );
+		pConn->outPos = 0;
+	}
+
+	WatchWrite( pConn, !pConn->out.empty() );
+}
+
+
+void
+CHcsmWireServer::WatchWrite( TConn* pConn, bool watch )
+{
+	if ( pConn->writeWatched == watch ) return;
+	pConn->writeWatched = watch;
+
+#ifdef __linux__
+	epoll_event ev;
+	memset( &ev, 0, sizeof( ev ) );
+	ev.events   = watch ? ( EPOLLIN | EPOLLOUT ) : EPOLLIN;
+	ev.data.ptr = pConn;
+	epoll_ctl( m_epoll, EPOLL_CTL_MOD, pConn->sock, &ev );
+#endif
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Checks if a client should be sent the objects of a frame.
+//  Clients whose pending output exceeds cWIRE_MAX_PENDING are held back.
+//
+bool
+CHcsmWireServer::IsDue( const TConn* cpConn, int frame ) const
+{
+	if ( cpConn->dead ) return false;
+	if ( cpConn->out.size() - cpConn->outPos > (size_t) cWIRE_MAX_PENDING ) {
+		return false;
+	}
+	if ( cpConn->wantSnapshot ) return true;
+	return cpConn->interval > 0 && ( frame % cpConn->interval ) == 0;
+}
+
+
+void
+CHcsmWireServer::RemoveDead( void )
+{
+	size_t keep = 0;
+	for ( size_t i = 0; i < m_conns.size(); i++ ) {
+		if ( m_conns[i]->dead ) {
+			// closing the socket also removes it from the epoll set
+			CloseSocket( m_conns[i]->sock );
+			delete m_conns[i];
+		}
+		else {
+			m_conns[keep++] = m_conns[i];
+		}
+	}
+	m_conns.resize( keep );
+}
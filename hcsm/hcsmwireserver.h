@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: hcsmwireserver.h,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Header file for the CHcsmWireServer class, the server
+// side of the wire protocol described in hcsmwire.h.
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef _HCSMWIRESERVER_H_
+#define _HCSMWIRESERVER_H_
+
+#include "hcsmwire.h"
+
+// output a connection can have queued before object deltas are held back
+const int cWIRE_MAX_PENDING = 1024 * 1024;
+
+//
+// A control command received from a client, to be applied by the owner
+// of the server.
+//
+struct TWireControl {
+	int  hcsmId;
+	int  cmd;		// one of CHcsmClient::ERemCntrlCmd
+	int  val;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Serves any number of wire protocol clients from the frame thread
+// without ever blocking it.
+//
+// All sockets are non-blocking and are multiplexed with epoll on Linux
+// and select elsewhere.  Poll handles connections, incoming commands and
+// pending output, and should be called once per frame.  PublishObjs
+// sends each subscribed client the difference between what it was last
+// sent and the current objects.  A client that does not keep up is
+// skipped until its pending output drains; since its deltas are always
+// computed against what it actually received, it then catches up with
+// a single delta and no state is lost.
+//
+class CHcsmWireServer
+{
+public:
+	CHcsmWireServer();
+	~CHcsmWireServer();
+
+	bool Open( int port );
+	void Close( void );
+	bool IsOpen( void ) const { return m_listenSock != cWIRE_NO_SOCK; };
+
+	void Poll( vector<TWireControl>& controls );
+	bool WantsObjs( int frame ) const;
+	int  DueInterval( void ) const;
+	void PublishObjs( int frame, const vector<TWireObj>& cObjs );
+	int  NumConnections( void ) const { return (int) m_conns.size(); };
+
+private:
+	struct TConn {
+		TWireSock              sock;
+		vector<unsigned char>  in;
+		vector<unsigned char>  out;
+		size_t                 outPos;		// bytes of out already sent
+		unsigned int           seq;		// sequence of the next frame
+		int                    interval;	// 0 when not subscribed
+		bool                   wantSnapshot;
+		bool                   needKeyframe;
+		bool                   writeWatched;	// registered for write events
+		bool                   dead;
+		vector<TWireObj>       sent;		// what the client holds
+	};
+
+	void Accept( void );
+	void Read( TConn*, vector<TWireControl>& controls );
+	void ProcessFrame(
+				TConn*,
+				const unsigned char*,
+				int,
+				vector<TWireControl>& controls
+				);
+	void Flush( TConn* );
+	void WatchWrite( TConn*, bool );
+	bool IsDue( const TConn*, int frame ) const;
+	void RemoveDead( void );
+
+	TWireSock       m_listenSock;
+	vector<TConn*>  m_conns;
+#ifdef __linux__
+	int             m_epoll;
+#endif
+
+	CHcsmWireServer( const CHcsmWireServer& );
+	CHcsmWireServer& operator=( const CHcsmWireServer& );
+};
+
+#endif // _HCSMWIRESERVER_H_
@@ -21,14 +21,14 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-CInputParameter::CInputParameter( string name ):
+CInputParameter::CInputParameter( const string& name ):
 	CHcsmStorage( name )
 {
 
 }
 
 CInputParameter::CInputParameter( const CInputParameter& objToCopy ):
-	CHcsmStorage( objToCopy.m_name )
+	CHcsmStorage( objToCopy )
 {
 
 	// call the assignment operator
@@ -16,7 +16,7 @@ using namespace std;
 class CInputParameter : public CHcsmStorage  
 {
 protected:
-	CInputParameter( string );
+	CInputParameter( const string& );
 	CInputParameter( const CInputParameter& );
 	CInputParameter& operator=( const CInputParameter& );
 	virtual ~CInputParameter();
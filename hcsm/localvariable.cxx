@@ -21,14 +21,14 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-CLocalVariable::CLocalVariable( string name ):
+CLocalVariable::CLocalVariable( const string& name ):
 	CHcsmStorage( name )
 {
 
 }
 
 CLocalVariable::CLocalVariable( const CLocalVariable& objToCopy ):
-	CHcsmStorage( objToCopy.m_name )
+	CHcsmStorage( objToCopy )
 {
 
 	// call the assignment operator
@@ -14,7 +14,7 @@
 class CLocalVariable : public CHcsmStorage  
 {
 protected:
-	CLocalVariable( string );
+	CLocalVariable( const string& );
 	CLocalVariable( const CLocalVariable& );
 	CLocalVariable& operator=( const CLocalVariable& );
 	virtual ~CLocalVariable();
@@ -21,14 +21,14 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-CMonitor::CMonitor( CHcsmCollection *pRootCollection, string name ):
+CMonitor::CMonitor( CHcsmCollection *pRootCollection, const string& name ):
 	CHcsmCommunicate( pRootCollection, name )
 {
 
 }
 
 CMonitor::CMonitor( const CMonitor& objToCopy ):
-	CHcsmCommunicate( objToCopy.m_pRootCollection, objToCopy.m_name )
+	CHcsmCommunicate( objToCopy )
 {
 
 	// call the assignment operator
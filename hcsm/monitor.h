@@ -28,7 +28,7 @@
 class CMonitor : public CHcsmCommunicate  
 {
 public:
-	CMonitor( CHcsmCollection*, string );
+	CMonitor( CHcsmCollection*, const string& );
 	CMonitor( const CMonitor& );
 	CMonitor& operator=( const CMonitor& );
 	virtual ~CMonitor();
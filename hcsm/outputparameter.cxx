@@ -21,14 +21,14 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-COutputParameter::COutputParameter( string name ):
+COutputParameter::COutputParameter( const string& name ):
 	CHcsmStorage( name )
 {
 
 }
 
 COutputParameter::COutputParameter( const COutputParameter& objToCopy ):
-	CHcsmStorage( objToCopy.m_name )
+	CHcsmStorage( objToCopy )
 {
 
 	// call the assignment operator
@@ -14,7 +14,7 @@
 class COutputParameter : public CHcsmStorage  
 {
 protected:
-	COutputParameter( string );
+	COutputParameter( const string& );
 	COutputParameter( const COutputParameter& );
 	COutputParameter& operator=( const COutputParameter& );
 	virtual ~COutputParameter();
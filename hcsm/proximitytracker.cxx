@@ -0,0 +1,141 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: proximitytracker.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The implementation of the CProximityTracker class.
+ *
+ ****************************************************************************/
+
+#include "proximitytracker.h"
+#include <algorithm>
+
+using namespace CVED;
+
+CProximityTracker::CProximityTracker( double radius, double hysteresis )
+{
+	m_updateCount = 0;
+	SetRadius( radius, hysteresis );
+}
+
+CProximityTracker::~CProximityTracker() {}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sets the radius of the neighborhood.
+//
+// Remarks: Takes effect at the next Update; objects already inside are
+//  checked against the new radius then.
+//
+// Arguments:
+//  radius     - objects within this distance of the center enter (feet)
+//  hysteresis - how much further than the radius an object inside has
+//               to be to leave (feet)
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CProximityTracker::SetRadius( double radius, double hysteresis )
+{
+	m_enterSqrd = radius * radius;
+	m_exitSqrd  = ( radius + hysteresis ) * ( radius + hysteresis );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Forgets all the members, e.g. at the start of a run, so
+//  every object inside at the next Update is reported as entering.
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CProximityTracker::Reset( void )
+{
+	m_members.clear();
+	m_entered.clear();
+	m_stayed.clear();
+	m_exited.clear();
+
+	// no entry of m_insideAt matches the previous update any more
+	m_updateCount += 2;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Finds the objects within the radius of the center and
+//  classifies them against the previous update.
+//
+// Remarks: An object that CVED no longer reports is reported as exiting.
+//  The distance is measured in the horizontal plane.
+//
+// Arguments:
+//  cved   - the CVED instance
+//  center - the center of the neighborhood
+//  mask   - the types of the objects to consider
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CProximityTracker::Update(
+			CCved& cved,
+			const CPoint3D& center,
+			const CObjTypeMask& mask
+			)
+{
+	int prevUpdate = m_updateCount;
+	m_updateCount++;
+
+	m_entered.clear();
+	m_stayed.clear();
+	m_exited.clear();
+	m_current.clear();
+
+	m_ids.clear();
+	cved.GetAllObjs( m_ids, mask );
+
+	bool sorted = true;
+	int  lastId = -1;
+	vector<int>::const_iterator i;
+	for( i = m_ids.begin(); i != m_ids.end(); i++ )
+	{
+		int objId = *i;
+		if( objId < 0 )  continue;
+		if( objId < lastId )  sorted = false;
+		lastId = objId;
+
+		if( objId >= (int) m_insideAt.size() )  m_insideAt.resize( objId + 1, -1 );
+		bool wasInside = m_insideAt[objId] == prevUpdate;
+
+		CPoint3D pos = cved.GetObjPos( objId );
+		double dx = pos.m_x - center.m_x;
+		double dy = pos.m_y - center.m_y;
+		double distSqrd = dx * dx + dy * dy;
+		if( distSqrd > ( wasInside ? m_exitSqrd : m_enterSqrd ) )  continue;
+
+		m_insideAt[objId] = m_updateCount;
+		m_current.push_back( objId );
+		if( wasInside )
+			m_stayed.push_back( objId );
+		else
+			m_entered.push_back( objId );
+	}
+
+	if( !sorted )
+	{
+		sort( m_current.begin(), m_current.end() );
+		sort( m_stayed.begin(), m_stayed.end() );
+		sort( m_entered.begin(), m_entered.end() );
+	}
+
+	// the previous members are sorted, so the exits come out sorted
+	for( i = m_members.begin(); i != m_members.end(); i++ )
+	{
+		if( m_insideAt[*i] != m_updateCount )  m_exited.push_back( *i );
+	}
+
+	m_members.swap( m_current );
+}
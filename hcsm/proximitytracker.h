@@ -0,0 +1,77 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: proximitytracker.h,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  The header file for the CProximityTracker class, which
+ *   keeps track of the CVED objects near a point, usually the driver.
+ *
+ * Update is called once per frame with the current center.  It works out
+ * which objects are within the radius and reports the difference from
+ * the previous frame as three lists: the objects that entered, the ones
+ * that stayed and the ones that left.  Membership is remembered per
+ * object id, so classifying an object is a single lookup instead of a
+ * search of the previous frame's list, and a consumer that only acts on
+ * enter and exit events does work proportional to the changes.
+ *
+ * All lists are sorted by CVED id.  They are members that are cleared
+ * and refilled each frame, so once they have grown to the number of
+ * nearby objects Update does not allocate.
+ *
+ * An optional hysteresis makes an object leave only once it is that much
+ * further than the radius, so an object moving along the boundary does
+ * not enter and leave on alternate frames.
+ *
+ ****************************************************************************/
+
+#ifndef _PROXIMITYTRACKER_H_
+#define _PROXIMITYTRACKER_H_
+
+#include <cvedpub.h>
+#include <vector>
+
+using namespace std;
+
+class CProximityTracker
+{
+public:
+	CProximityTracker( double radius = 1000.0, double hysteresis = 0.0 );
+	~CProximityTracker();
+
+	void SetRadius( double radius, double hysteresis = 0.0 );
+	void Reset( void );
+	void Update(
+			CVED::CCved& cved,
+			const CPoint3D& center,
+			const CVED::CObjTypeMask& mask
+			);
+
+	const vector<int>& Entered( void ) const { return m_entered; }
+	const vector<int>& Stayed( void ) const { return m_stayed; }
+	const vector<int>& Exited( void ) const { return m_exited; }
+	const vector<int>& Members( void ) const { return m_members; }
+
+private:
+	CProximityTracker( const CProximityTracker& );
+	CProximityTracker& operator=( const CProximityTracker& );
+
+	double       m_enterSqrd;		// squared radius
+	double       m_exitSqrd;		// squared radius plus hysteresis
+	int          m_updateCount;
+	vector<int>  m_insideAt;		// by CVED id, last update it was inside
+	vector<int>  m_members;
+	vector<int>  m_entered;
+	vector<int>  m_stayed;
+	vector<int>  m_exited;
+	vector<int>  m_ids;				// scratch
+	vector<int>  m_current;			// scratch
+};
+
+#endif // _PROXIMITYTRACKER_H_
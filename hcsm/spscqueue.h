@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1999 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: spscqueue.h,v 1.1 $
+// Author:
+// Date:         October, 2026
+//
+// Description:  Header file for the CSpscQueue class, a bounded queue
+// between one producer thread and one consumer thread.
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifndef _SPSCQUEUE_H_
+#define _SPSCQUEUE_H_
+
+#include <atomic>
+#include <vector>
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// A fixed capacity ring buffer that one thread pushes to and another
+// pops from without locks, so neither side ever waits for the other.
+// Push fails instead of blocking when the queue is full; it is up to
+// the producer to hold on to the item or drop it.
+//
+// The producer owns m_tail and the consumer owns m_head; each reads the
+// other's index with acquire ordering, which makes the slot contents
+// written before a release store visible to the other thread.
+//
+template<class T>
+class CSpscQueue
+{
+public:
+	explicit CSpscQueue( int capacity );
+
+	bool Push( const T& cItem );	// producer only
+	bool Pop( T& item );			// consumer only
+	bool IsEmpty( void ) const;
+
+private:
+	vector<T>       m_slots;		// size is a power of two
+	size_t          m_mask;
+	atomic<size_t>  m_head;			// next slot to pop
+	char            m_pad[64];		// keeps the indices on separate lines
+	atomic<size_t>  m_tail;			// next slot to push
+
+	CSpscQueue( const CSpscQueue& );
+	CSpscQueue& operator=( const CSpscQueue& );
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Constructor.
+//
+// Arguments:
+// capacity - the most items the queue holds; rounded up to a power of
+//   two
+//
+template<class T>
+CSpscQueue<T>::CSpscQueue( int capacity )
+	: m_head( 0 )
+	, m_tail( 0 )
+{
+	size_t size = 1;
+	while ( size < (size_t) capacity ) size *= 2;
+	m_slots.resize( size );
+	m_mask = size - 1;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Adds an item at the end of the queue.
+//
+// Returns: false if the queue is full, in which case nothing is added
+//
+template<class T>
+bool
+CSpscQueue<T>::Push( const T& cItem )
+{
+	size_t tail = m_tail.load( memory_order_relaxed );
+	if ( tail - m_head.load( memory_order_acquire ) > m_mask ) return false;
+
+	m_slots[tail & m_mask] = cItem;
+	m_tail.store( tail + 1, memory_order_release );
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Removes the item at the front of the queue.
+//
+// Returns: false if the queue is empty
+//
+template<class T>
+bool
+CSpscQueue<T>::Pop( T& item )
+{
+	size_t head = m_head.load( memory_order_relaxed );
+	if ( head == m_tail.load( memory_order_acquire ) ) return false;
+
+	item = m_slots[head & m_mask];
+	m_head.store( head + 1, memory_order_release );
+	return true;
+}
+
+
+template<class T>
+bool
+CSpscQueue<T>::IsEmpty( void ) const
+{
+	return m_head.load( memory_order_acquire ) ==
+		m_tail.load( memory_order_acquire );
+}
+
+#endif // _SPSCQUEUE_H_
@@ -20,11 +20,13 @@ CLoadVar::CLoadVar( const CActionParseBlock* pBlock, CHcsmCollection* pColl)
 {
 	assert(pBlock);
 	m_fileName = pBlock->GetFile();
+	m_pHC = pColl;
 }
 CLoadVar& 
 CLoadVar::operator=( const CLoadVar& cRhs ){
 	if (this != &cRhs){
 		m_fileName = cRhs.m_fileName;
+		m_pHC = cRhs.m_pHC;
 	}
 	return *this;
 }
@@ -48,7 +50,7 @@ void CLoadVar::Execute( const set<CCandidate>* cObjs ){
 	while (!iffs.fail() && !iffs.eof()){
 		iffs>>name>>value;
 		if (!iffs.fail()){
-			CHcsmCollection::SetExprVariable(name,value);
+			m_pHC->SetExprVariable(name,value);
 		}
 	}
 	iffs.close();
@@ -34,5 +34,6 @@ public:
 	inline const char* GetName() const { return "LoadVar";};
 private:
 	string m_fileName; //<input filename;
+	CHcsmCollection* m_pHC; //<collection that owns the variables
 };
 
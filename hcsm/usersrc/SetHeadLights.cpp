@@ -20,11 +20,13 @@ CSetHeadlights::CSetHeadlights( const CActionParseBlock* pBlock, CHcsmCollection
 {
 	assert(pBlock);
 	m_headlightAction = pBlock->GetHeadlightControlCommand();
+	m_pHC = pColl;
 }
 CSetHeadlights& 
 CSetHeadlights::operator=( const CSetHeadlights& cRhs ){
 	if (this != &cRhs){
 		m_headlightAction = cRhs.m_headlightAction;
+		m_pHC = cRhs.m_pHC;
 	}
 	return *this;
 }
@@ -36,7 +38,7 @@ CSetHeadlights::CSetHeadlights(const CSetHeadlights&  cRhs){
 ///		copies headlight command to m_sHeadlightScenarioControl
 ////////////////////////////////////////////////////////////////////////
 void CSetHeadlights::Execute( const set<CCandidate>* cObjs ){
-	CHcsmCollection::m_sHeadlightScenarioControl = m_headlightAction;
+	m_pHC->m_ctx.m_sHeadlightScenarioControl = m_headlightAction;
 }
 
 CSetHeadlights::~CSetHeadlights(void)
@@ -42,4 +42,5 @@ public:
 	inline const char* GetName() const { return "SetHeadlight";};
 private:
 	int m_headlightAction; //<turn on/off action;
+	CHcsmCollection* m_pHC; //<collection that owns the headlight state
 };
@@ -170,7 +170,7 @@ CWriteUniformActn::Execute( const set<CCandidate>* )
 		    if( m_isVariable )
 		    {
 			    string varName = m_varName;
-			    double varVal = CHcsmCollection::GetExprVariable( varName );
+			    double varVal = m_pHC->GetExprVariable( varName );
 			    if( m_cellType == CActionParseBlock::eFLOAT )
 			    {
                     CHcsmCollection::m_sScenarioWriteUniformData[eventNum].floatData.clear();
@@ -205,7 +205,7 @@ CWriteUniformActn::Execute( const set<CCandidate>* )
 		    }
 
 		    CHcsmCollection::m_sScenarioWriteUniformData[eventNum].cellData = m_varName;
-		    CHcsmCollection::m_sScenarioWriteUniformData[eventNum].frame = CHcsmCollection::m_frame;
+		    CHcsmCollection::m_sScenarioWriteUniformData[eventNum].frame = m_pHC->GetFrame();
 		    CHcsmCollection::m_sScenarioWriteUniformDataSize++;
 	    }
 	    else
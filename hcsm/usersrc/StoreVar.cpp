@@ -20,6 +20,7 @@ CStoreVar::CStoreVar( const CActionParseBlock* pBlock, CHcsmCollection* pColl)
 	assert(pBlock);
 	m_fileName = pBlock->GetFile();
 	m_varName  = pBlock->GetVarName();
+	m_pHC = pColl;
 }
 ////////////////////////////////////////////////////////////////////////
 ///\remark
@@ -46,7 +47,7 @@ void CStoreVar::Execute( const set<CCandidate>* cObjs  ){
 			trimmer.str("");
 			trimmer<<tempBuff;//trim anything extra we may have;
 			trimmer>>varname;
-			offs<<varname<<"	"<<CHcsmCollection::GetExprVariable(varname)<<endl;
+			offs<<varname<<"	"<<m_pHC->GetExprVariable(varname)<<endl;
 		}
 	}
 	offs.close();
@@ -57,6 +58,7 @@ CStoreVar::operator=( const CStoreVar& cRhs ){
 	if (this != &cRhs){
 		m_fileName = cRhs.m_fileName;
 		m_varName = cRhs.m_varName;
+		m_pHC = cRhs.m_pHC;
 	}
 	return *this;
 }
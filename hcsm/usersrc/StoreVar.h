@@ -21,5 +21,6 @@ public:
 private:
 	string m_fileName; //< name of the text file to save the variables to
 	string m_varName; //<tab delimited list of variables
+	CHcsmCollection* m_pHC; //<collection that owns the variables
 };
 
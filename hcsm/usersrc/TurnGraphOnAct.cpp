@@ -220,5 +220,5 @@ CTurnGraphOnActn::Execute( const set<CCandidate>* )
 	}
 	CHcsmCollection::m_sDisplayGraph.m_type = COnScreenGraph::eBARGRAPH;
 	CHcsmCollection::m_sDisplayGraph.m_position = m_position;
-	CHcsmCollection::m_sGraphIsOn = true;
+	m_pHC->m_ctx.m_sGraphIsOn = true;
 }
\ No newline at end of file
@@ -100,44 +100,44 @@ CUpdateTodActn::operator=( const CUpdateTodActn& cRhs )
 }
 	//else if (m_varName == "Hour"){
 	//	if ( m_varValue == "++" ){
-	//		CHcsmCollection::m_sHour++;
-	//		if (CHcsmCollection::m_sHour >= 24){
-	//			CHcsmCollection::m_sHour = 0;
+	//		m_pHC->m_ctx.m_sHour++;
+	//		if (m_pHC->m_ctx.m_sHour >= 24){
+	//			m_pHC->m_ctx.m_sHour = 0;
 	//		}
 	//	}
 	//	else{
 	//		sscanf(m_varValue.c_str(), "%lf", &newValue);
-	//		CHcsmCollection::m_sHour = (int)newValue;
+	//		m_pHC->m_ctx.m_sHour = (int)newValue;
 	//	}
-	//	CHcsmCollection::SetExprVariable( m_varName, CHcsmCollection::m_sHour );
-	//	CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sHour );
+	//	m_pHC->SetExprVariable( m_varName, m_pHC->m_ctx.m_sHour );
+	//	m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sHour );
 	//}
 	//else if (m_varName == "Minute"){
 	//	if ( m_varValue == "++" ){
-	//		CHcsmCollection::m_sMinute++;
-	//		if (CHcsmCollection::m_sMinute >= 60){
-	//			CHcsmCollection::m_sMinute = 0;
-	//			CHcsmCollection::m_sHour++;
-	//			if (CHcsmCollection::m_sHour >= 24){
-	//				CHcsmCollection::m_sHour = 0;
+	//		m_pHC->m_ctx.m_sMinute++;
+	//		if (m_pHC->m_ctx.m_sMinute >= 60){
+	//			m_pHC->m_ctx.m_sMinute = 0;
+	//			m_pHC->m_ctx.m_sHour++;
+	//			if (m_pHC->m_ctx.m_sHour >= 24){
+	//				m_pHC->m_ctx.m_sHour = 0;
 	//			}
 	//		}
-	//		CHcsmCollection::SetExprVariable( "Minute", CHcsmCollection::m_sMinute );
-	//		CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sMinute );
-	//		CHcsmCollection::SetExprVariable( "Hour", CHcsmCollection::m_sHour );
-	//		CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sHour );
+	//		m_pHC->SetExprVariable( "Minute", m_pHC->m_ctx.m_sMinute );
+	//		m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sMinute );
+	//		m_pHC->SetExprVariable( "Hour", m_pHC->m_ctx.m_sHour );
+	//		m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sHour );
 	//	}
 	//	else{
 	//		sscanf(m_varValue.c_str(), "%lf", &newValue);
-	//		CHcsmCollection::m_sMinute = (int)newValue;
+	//		m_pHC->m_ctx.m_sMinute = (int)newValue;
 	//	}
 	//}
 	//else if (m_varName == "UpdateTime"){
 	//	sscanf(m_varValue.c_str(), "%lf", &newValue);
 	//	if (newValue > 0){
-	//		CHcsmCollection::m_sChangeTimeOfDay = true;
+	//		m_pHC->m_ctx.m_sChangeTimeOfDay = true;
 	//	}else{
-	//		CHcsmCollection::m_sChangeTimeOfDay = false;
+	//		m_pHC->m_ctx.m_sChangeTimeOfDay = false;
 	//	}
 	//}
 /////////////////////////////////////////////////////////////////////////////
@@ -170,7 +170,7 @@ CUpdateTodActn::Execute( const set<CCandidate>* )
 	string dailstr = m_setTimeCommand;
 	tokenizer tokens(dailstr, sep);
 	tokenizer::iterator itr = tokens.begin();
-	int x = CHcsmCollection::m_sMinute;
+	int x = m_pHC->m_ctx.m_sMinute;
 	while (itr != tokens.end()){
 		if (*itr == "Time"){
 			itr++; if (itr == tokens.end()) break;
@@ -182,29 +182,29 @@ CUpdateTodActn::Execute( const set<CCandidate>* )
 			int minutes = boost::lexical_cast<int>(*itr);
 			if (hours < 0 || hours > 24) break;
 			if (minutes < 0 || minutes > 59) break;
-			CHcsmCollection::m_sHour = hours;
-			CHcsmCollection::m_sMinute = minutes;
-			CHcsmCollection::m_sChangeTimeOfDay = true;
+			m_pHC->m_ctx.m_sHour = hours;
+			m_pHC->m_ctx.m_sMinute = minutes;
+			m_pHC->m_ctx.m_sChangeTimeOfDay = true;
 			return;
 		}
 		if (*itr == "Minute++"){
-			CHcsmCollection::m_sMinute++;
-			if (CHcsmCollection::m_sMinute >= 60){
-        		CHcsmCollection::m_sMinute = 0;
-        		CHcsmCollection::m_sHour++;
-        		if (CHcsmCollection::m_sHour >= 24){
-        			CHcsmCollection::m_sHour = 0;
+			m_pHC->m_ctx.m_sMinute++;
+			if (m_pHC->m_ctx.m_sMinute >= 60){
+        		m_pHC->m_ctx.m_sMinute = 0;
+        		m_pHC->m_ctx.m_sHour++;
+        		if (m_pHC->m_ctx.m_sHour >= 24){
+        			m_pHC->m_ctx.m_sHour = 0;
         		}
 			}
-			CHcsmCollection::m_sChangeTimeOfDay = true;
+			m_pHC->m_ctx.m_sChangeTimeOfDay = true;
 			return;
 		}
 		if (*itr == "Hour++"){
-        	CHcsmCollection::m_sHour++;
-        	if (CHcsmCollection::m_sHour >= 24){
-        		CHcsmCollection::m_sHour = 0;
+        	m_pHC->m_ctx.m_sHour++;
+        	if (m_pHC->m_ctx.m_sHour >= 24){
+        		m_pHC->m_ctx.m_sHour = 0;
         	}
-			CHcsmCollection::m_sChangeTimeOfDay = true;
+			m_pHC->m_ctx.m_sChangeTimeOfDay = true;
 			return;
 		}
 		else{
@@ -22,6 +22,7 @@ CVarQueueOperationAction::CVarQueueOperationAction( const CActionParseBlock* pBl
 {
     m_varOperation = pBlock->GetVarQueueOperation();
     m_delay = pBlock->GetDelay();
+	m_pHC = pColl;
 	assert(pBlock);
 }
 ////////////////////////////////////////////////////////////////////////
@@ -31,13 +32,14 @@ CVarQueueOperationAction::CVarQueueOperationAction( const CActionParseBlock* pBl
 ///		variables are always to be doubles, variables are delimted by ;  
 ////////////////////////////////////////////////////////////////////////
 void CVarQueueOperationAction::Execute( const set<CCandidate>* cObjs  ){
-    CHcsmCollection::DoVarQueueOperation(m_varOperation);
+    m_pHC->DoVarQueueOperation(m_varOperation);
 
 }
 CVarQueueOperationAction& 
 CVarQueueOperationAction::operator=( const CVarQueueOperationAction& cRhs ){
 	if (this != &cRhs){
 		m_varOperation = cRhs.m_varOperation;
+		m_pHC = cRhs.m_pHC;
 	}
 	return *this;
 }
@@ -15,4 +15,5 @@ public:
 	inline const char* GetName() const  {return "VarQueueOperation";};
 private:
 	string m_varOperation; //<tab delimited list of variables
+	CHcsmCollection* m_pHC; //<collection that owns the queues
 };
\ No newline at end of file
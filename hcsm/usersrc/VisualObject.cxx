@@ -47,6 +47,7 @@ void CVirtualObject::UserCreation(
     m_drawScreen = (int)pSnoBlock->GetScreen();
 	m_initConditions.SetObjectInitCond(
 				*cved, 
+				m_pRootCollection->GetInitCondScheduler(),
 				GetFrame(), 
 				GetTimeStepDuration(),  
 				pSnoBlock->GetCrRad(),  
@@ -155,7 +156,7 @@ void CVirtualObject::HandleDials(){
 	if (m_dialSetStateIndex.HasValue()){
 		string val = m_dialSetStateIndex.GetValue();
 		if (val.size() > 0 && isalpha(val[0])){
-			m_stateIndex = (int)CHcsmCollection::GetExprVariable(val);
+			m_stateIndex = (int)m_pRootCollection->GetExprVariable(val);
 		}else{
 			m_stateIndex = 1;
 			stringstream converter;
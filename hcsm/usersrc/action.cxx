@@ -14,8 +14,6 @@
 
 #include "action.h"
 
-int CAction::m_sDataRedCounter = 0;
-
 CAction::CAction()
 {
 	m_delay = 0.0;
@@ -53,7 +53,6 @@ public:
 
 protected:
 	void InitCandidateSet( const CActionParseBlock* cpBlock );
-	static int		 m_sDataRedCounter;
 	int              m_triggerId;
 	double           m_delay;
 };
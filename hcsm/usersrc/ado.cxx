@@ -31,6 +31,8 @@ using namespace std;
 #include <tchar.h>
 
 #include "CvedADOctrl.h"
+#include "adoinfopool.h"
+#include "hcsmcheckpoint.h"
 
 //
 // Debugging macros.
@@ -132,18 +134,18 @@ CAdo::GetObjVel( int argC, const CExprParser::CStrNum args[] )
 	string objName = args[0].m_Str;
 	//this->cved->geto
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < m_pRootCollection->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&m_pRootCollection->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE
 			);
 		if( !strcmp( temp, objName.c_str() ) )
 		{
-			double vel = CHcsmCollection::m_sDynObjData.vel[i];
-			return CHcsmCollection::m_sDynObjData.vel[i];
+			double vel = m_pRootCollection->m_ctx.m_sDynObjData.vel[i];
+			return m_pRootCollection->m_ctx.m_sDynObjData.vel[i];
 		}
 	}
 
@@ -159,12 +161,12 @@ CAdo::ReadVar( int argC, const CExprParser::CStrNum args[] )
 	}
 
 	string varName = args[0].m_Str;
-	if( !CHcsmCollection::ExprVariableExists( varName ) )
+	if( !m_pRootCollection->ExprVariableExists( varName ) )
 	{
 		return 0.0;
 	}
 
-	return CHcsmCollection::GetExprVariable( varName );
+	return m_pRootCollection->GetExprVariable( varName );
 }
 
 double
@@ -295,51 +297,51 @@ double CAdo::ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 	if( cellName == "PlacePhoneCall" )
 	{
-		return CHcsmCollection::m_sSCC_PlacePhoneCall;
+		return m_pRootCollection->m_ctx.m_sSCC_PlacePhoneCall;
 	}
 	else if( cellName == "PhoneCallAge" )
 	{
-		return CHcsmCollection::m_sPlacePhoneCallAge;
+		return m_pRootCollection->m_ctx.m_sPlacePhoneCallAge;
 	}
 	else if( cellName == "LogStreams" )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS )  throw InvalidArgs;
-		return CHcsmCollection::m_sLogStreams[index];
+		return m_pRootCollection->m_ctx.m_sLogStreams[index];
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return CHcsmCollection::m_sAccelPedalPos;
+		return m_pRootCollection->m_ctx.m_sAccelPedalPos;
 	}
 	else if( cellName == "BrakePedalForce" )
 	{
-		return CHcsmCollection::m_sBrakePedalForce;
+		return m_pRootCollection->m_ctx.m_sBrakePedalForce;
 	}
 	else if( cellName == "SteeringWheelAngle" )
 	{
-		return CHcsmCollection::m_sSteeringWheelAngle;
+		return m_pRootCollection->m_ctx.m_sSteeringWheelAngle;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return CHcsmCollection::m_sCruiseControl;
+		return m_pRootCollection->m_ctx.m_sCruiseControl;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return CHcsmCollection::m_sCruiseControlIncoming;
+		return m_pRootCollection->m_ctx.m_sCruiseControlIncoming;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return CHcsmCollection::m_sCisTurnSignal;
+		return m_pRootCollection->m_ctx.m_sCisTurnSignal;
 	}
 	else if( cellName == "OvVel" )
 	{
-		return CHcsmCollection::m_sSpeedometerBackdrive;
+		return m_pRootCollection->m_ctx.m_sSpeedometerBackdrive;
 	}
 	else if( cellName == "Hour" )
 	{
-		return CHcsmCollection::m_sHour;
+		return m_pRootCollection->m_ctx.m_sHour;
 	}
 	else if( cellName == "Minute" )
 	{
-		return CHcsmCollection::m_sMinute;
+		return m_pRootCollection->m_ctx.m_sMinute;
 	}
 	else if( cellName == "OvVelLocal" )
 	{
@@ -350,64 +352,64 @@ double CAdo::ReadCell( int argC, const CExprParser::CStrNum args[] )
 	else if( cellName == "OvLaneDev" )
 	{
 		double laneDev = 0.0;
-		if( CHcsmCollection::m_sLaneDevInfo[0] != 0 )
+		if( m_pRootCollection->m_ctx.m_sLaneDevInfo[0] != 0 )
 		{
-			laneDev = CHcsmCollection::m_sLaneDevInfo[1];
+			laneDev = m_pRootCollection->m_ctx.m_sLaneDevInfo[1];
 		}
 		return laneDev;
 	}
 	else if( cellName == "OvHeadwayToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
+		return m_pRootCollection->m_ctx.m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
 	}
 	else if( cellName == "OvTtcToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
+		return m_pRootCollection->m_ctx.m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
 	}
 	else if( cellName == "Horn" )
 	{
-		return CHcsmCollection::m_sHorn;
+		return m_pRootCollection->m_ctx.m_sHorn;
 	}
 	else if (cellName == "HornFiltered"){
-		return CHcsmCollection::m_sHornFiltered;
+		return m_pRootCollection->m_ctx.m_sHornFiltered;
 	}
 	else if( cellName == "RECAS_Button" )
 	{
-		return CHcsmCollection::m_sRecasButton;
+		return m_pRootCollection->m_ctx.m_sRecasButton;
 	}
 	else if( cellName == "Auxiliary_Buttons" )
 	{
-		return CHcsmCollection::m_sAuxiliaryButtons[index];
+		return m_pRootCollection->m_ctx.m_sAuxiliaryButtons[index];
 	}
 	else if ( cellName == "DynObj_Vel" )
 	{
-		return CHcsmCollection::m_sDynObjData.vel[index];
+		return m_pRootCollection->m_ctx.m_sDynObjData.vel[index];
 	}
 	else if ( cellName == "FcwInfo" )
 	{
 		if( index < 0 || index >= 4)  throw InvalidArgs;
-		return CHcsmCollection::m_sFcwInfo[index];
+		return m_pRootCollection->m_ctx.m_sFcwInfo[index];
 	}
 	else if (cellName == "LdwStatus"){
-		return CHcsmCollection::m_sLdwStatus;
+		return m_pRootCollection->m_ctx.m_sLdwStatus;
 	}
 	else if (cellName == "BackUpDistance"){
-		return CHcsmCollection::m_sBackUpDistance;
+		return m_pRootCollection->m_ctx.m_sBackUpDistance;
 	}
 	else if (cellName == "WarningLights"){
-		return CHcsmCollection::m_sWarningLights;
+		return m_pRootCollection->m_ctx.m_sWarningLights;
 	}
 	else if (cellName == "ACC_Warning"){
-		return CHcsmCollection::m_sACC_Warning;
+		return m_pRootCollection->m_ctx.m_sACC_Warning;
 	}
 	else if (cellName == "Cruise_State"){
-		return CHcsmCollection::m_sCruise_State;
+		return m_pRootCollection->m_ctx.m_sCruise_State;
 	}
 	else if (cellName == "Cruise_Speed"){
-		return CHcsmCollection::m_sCruise_SetSpeed;
+		return m_pRootCollection->m_ctx.m_sCruise_SetSpeed;
 	}
 	else if (cellName == "ACC_Gap"){
-		return CHcsmCollection::m_sACC_Gap;
+		return m_pRootCollection->m_ctx.m_sACC_Gap;
 	}
 	else if (cellName == "ACC_SMV"){ //Total Hack, need to fix expression parser
 		double ownVehVel = 0.0;
@@ -448,10 +450,10 @@ double CAdo::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		cved->GetOwnVehicleVel( ownVehVel );
 		ownVehVel = ownVehVel * cMS_TO_MPH;
 		if (index == 1){
-			if (CHcsmCollection::m_sCruise_SetSpeed > 49.9 && CHcsmCollection::m_sCruise_SetSpeed < 59.9){
-				return CHcsmCollection::m_sCruise_SetSpeed - 5;
+			if (m_pRootCollection->m_ctx.m_sCruise_SetSpeed > 49.9 && m_pRootCollection->m_ctx.m_sCruise_SetSpeed < 59.9){
+				return m_pRootCollection->m_ctx.m_sCruise_SetSpeed - 5;
 			}
-			else if (CHcsmCollection::m_sCruise_SetSpeed < 49.5){
+			else if (m_pRootCollection->m_ctx.m_sCruise_SetSpeed < 49.5){
 				return 45.0;
 			}else{
 				return 55.0;
@@ -468,10 +470,10 @@ double CAdo::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		}
 	}
 	else if (cellName == "Sensor_Info"){
-		return CHcsmCollection::m_sSensorInfo[index];
+		return m_pRootCollection->m_ctx.m_sSensorInfo[index];
 	}
 	else if (cellName == "OnPath"){
-		return CHcsmCollection::m_sIsOnPath;
+		return m_pRootCollection->m_ctx.m_sIsOnPath;
 	}
 /*	else if (cellName == "OwnVehAccel"){
 		int ownVehObjId;
@@ -1047,6 +1049,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 
 	m_initConditions.SetObjectInitCond(
 				*cved,
+				m_pRootCollection->GetInitCondScheduler(),
 				GetFrame(),
 				GetTimeStepDuration(),
 				cpSnoBlock->GetCrRad(),
@@ -1071,7 +1074,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 		Suicide();
 		return;
 	}
-	m_exprEval.SetParent(this);
+	m_exprEval.SetParent(this, m_pRootCollection);
 	m_exprEval.m_functions["sin"] = &CAdo::MySin;
 	m_exprEval.m_functions["FadeIn"] = &CAdo::FadeIn;
 	m_exprEval.m_functions["FadeOut"] = &CAdo::FadeOut;
@@ -1082,7 +1085,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	m_exprEval.m_functions["GetObjVel"]	= &CAdo::GetObjVel;
 	m_exprEval.m_functions["GetObjAccel"]= &CAdo::GetObjAccel;
 
-	m_exprGapDisEvtal.SetParent(this);
+	m_exprGapDisEvtal.SetParent(this, m_pRootCollection);
 	m_exprGapDisEvtal.m_functions["sin"] = &CAdo::MySinGap;
 	m_exprGapDisEvtal.m_functions["FadeIn"] = &CAdo::FadeInGap;
 	m_exprGapDisEvtal.m_functions["FadeOut"] = &CAdo::FadeOutGap;
@@ -1093,7 +1096,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	m_exprGapDisEvtal.m_functions["GetObjVel"]	= &CAdo::GetObjVel;
 	m_exprGapDisEvtal.m_functions["GetObjAccel"]= &CAdo::GetObjAccel;
 
-	m_exprMinSpeedEvtal.SetParent(this);
+	m_exprMinSpeedEvtal.SetParent(this, m_pRootCollection);
 	m_exprMinSpeedEvtal.m_functions["sin"] = &CAdo::MySinGap;
 	m_exprMinSpeedEvtal.m_functions["FadeIn"] = &CAdo::FadeInGap;
 	m_exprMinSpeedEvtal.m_functions["FadeOut"] = &CAdo::FadeOutGap;
@@ -1104,7 +1107,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	m_exprMinSpeedEvtal.m_functions["GetObjVel"]	= &CAdo::GetObjVel;
 	m_exprMinSpeedEvtal.m_functions["GetObjAccel"]= &CAdo::GetObjAccel;
 
-	m_exprMaxSpeedEvtal.SetParent(this);
+	m_exprMaxSpeedEvtal.SetParent(this, m_pRootCollection);
 	m_exprMaxSpeedEvtal.m_functions["sin"] = &CAdo::MySinGap;
 	m_exprMaxSpeedEvtal.m_functions["FadeIn"] = &CAdo::FadeInGap;
 	m_exprMaxSpeedEvtal.m_functions["FadeOut"] = &CAdo::FadeOutGap;
@@ -1115,7 +1118,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	m_exprMaxSpeedEvtal.m_functions["GetObjVel"]	= &CAdo::GetObjVel;
 	m_exprMaxSpeedEvtal.m_functions["GetObjAccel"]= &CAdo::GetObjAccel;
 
-	m_exprMaxAccelEvtal.SetParent(this);
+	m_exprMaxAccelEvtal.SetParent(this, m_pRootCollection);
 	m_exprMaxAccelEvtal.m_functions["sin"] = &CAdo::MySinGap;
 	m_exprMaxAccelEvtal.m_functions["FadeIn"] = &CAdo::FadeInGap;
 	m_exprMaxAccelEvtal.m_functions["FadeOut"] = &CAdo::FadeOutGap;
@@ -1126,7 +1129,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	m_exprMaxAccelEvtal.m_functions["GetObjVel"]	= &CAdo::GetObjVel;
 	m_exprMaxAccelEvtal.m_functions["GetObjAccel"]= &CAdo::GetObjAccel;
 
-	m_exprMinAccelEvtal.SetParent(this);
+	m_exprMinAccelEvtal.SetParent(this, m_pRootCollection);
 	m_exprMinAccelEvtal.m_functions["sin"] = &CAdo::MySinGap;
 	m_exprMinAccelEvtal.m_functions["FadeIn"] = &CAdo::FadeInGap;
 	m_exprMinAccelEvtal.m_functions["FadeOut"] = &CAdo::FadeOutGap;
@@ -1162,7 +1165,11 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
         if (!relObjRoadPos.IsValid())
             return;
 		//gout << "## final pos = " << createRoadPos << endl;
-		m_pI = new CAdoInfo( relObjRoadPos, GetTimeStepDuration(), objType );
+		m_pI = m_pRootCollection->GetAdoInfoPool().AcquireInfo(
+					relObjRoadPos,
+					GetTimeStepDuration(),
+					objType
+					);
 	}
 	else
 	{
@@ -1177,11 +1184,11 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 				//gout << "  ##road pos = " << roadPos << endl;
 				roadPos = tempRoadPos;
 			}
-			bool updateCrdr = !roadPos.IsRoad() && CHcsmCollection::m_sOwnshipPath.IsValid();
+			bool updateCrdr = !roadPos.IsRoad() && m_pRootCollection->m_ctx.m_sOwnshipPath.IsValid();
 			if( updateCrdr )
 			{
 				int crdrId = -1;
-				bool success = CHcsmCollection::m_sOwnshipPath.GetCrdrFromIntrscn(
+				bool success = m_pRootCollection->m_ctx.m_sOwnshipPath.GetCrdrFromIntrscn(
 							roadPos.GetIntrsctn().GetId(),
 							crdrId,
 							NULL
@@ -1197,21 +1204,20 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 				}
 			}
 		}
-		m_pI = new CAdoInfo( roadPos, GetTimeStepDuration(), objType );
+		m_pI = m_pRootCollection->GetAdoInfoPool().AcquireInfo(
+					roadPos,
+					GetTimeStepDuration(),
+					objType
+					);
 	}
 	m_pI->m_objName = cpSnoBlock->GetName();
 	m_pI->m_autoControlBrakeLightState = cpSnoBlock->GetAutoControlBrakeLight();
 	m_pI->m_autoControlHeadLightsState = cpSnoBlock->GetAutoControlHeadLight();
 
-	static int randGapInit = false;
-	static CRandNumGen rgenGap(5, 5);		// 5, 5 are the seeds; just picked them!
-	static int   r1Gap;	// all the streas needed by follow
-
-	if( randGapInit == false )
-	{
-		randGapInit = true;
-		r1Gap = rgenGap.GetStream();	// get a stream for each item to randomize
-	}
+	// the generator is shared by all ADOs and is kept by the collection
+	// so that it is checkpointed along with the rest of the scenario
+	CRandNumGen& rgenGap = m_pRootCollection->m_adoGapRng;
+	int r1Gap = m_pRootCollection->m_adoGapStream;
 
 	if (cpSnoBlock->GetFwdDistThresRand())
 	{
@@ -1357,7 +1363,7 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	//
 	// Copy path from SnoBlock to the local path.
 	//
-	m_pI->m_pPath = new CPath( *cved );
+	m_pI->m_pPath = m_pRootCollection->GetAdoInfoPool().AcquirePath( *cved );
 	m_pI->m_pPath->SetString( cpSnoBlock->GetPath() );
 	bool invalidPath = m_pI->m_pPath->Size() > 0 && !m_pI->m_pPath->IsValid();
 	if( invalidPath )
@@ -1431,23 +1437,16 @@ CAdo::UserCreation( const CAdoParseBlock* cpSnoBlock )
 	// Follow algorithm parameters
 	//
 
-	// declare the generator static so all ADOs will use the same
+	// use one generator so all ADOs will use the same
 	// generator for producing their random numbers for the follow
 	// algorithm.  That way the statistical distribution will be
-	// across all ADOs which is the intention
-	static int randInit = false;
-	static CRandNumGen rgen(5, 5);		// 5, 5 are the seeds; just picked them!
-	static int   r1, r2, r3, r4, r5;	// all the streas needed by follow
-
-	if( randInit == false )
-	{
-		randInit = true;
-		r1 = rgen.GetStream();	// get a stream for each item to randomize
-		r2 = rgen.GetStream();
-		r3 = rgen.GetStream();
-		r4 = rgen.GetStream();
-		r5 = rgen.GetStream();
-	}
+	// across all ADOs which is the intention.  The generator belongs
+	// to the collection so scenarios running side by side don't share
+	// streams and so that it is checkpointed.
+	CRandNumGen& rgen = m_pRootCollection->m_adoFollowRng;
+	const int* cpStreams = m_pRootCollection->m_adoFollowStreams;
+	int r1 = cpStreams[0], r2 = cpStreams[1], r3 = cpStreams[2];
+	int r4 = cpStreams[3], r5 = cpStreams[4];
 
 	double zeroToOne = rgen.RandomDouble(r1);
 
@@ -2005,23 +2004,29 @@ CAdo::InitializeDynamicsVars(
 //   It first gets information about the object to be created from the SOL
 //   then creates the CVED object.
 //
+//   When an object is recreated while restoring a checkpoint, the SOL
+//   object that was picked originally is used again and the dials and
+//   the activity log are left alone; the pose and velocity are 
+//   overwritten afterwards by the collection.
+//
 // Arguments:
 //   cpSnoBlock - The Ado's SNO block.
+//   restore    - (optional) True when restoring a checkpoint.
 //
 // Returns:  A boolean indicating if creating the CVED was successful.
 //
 //////////////////////////////////////////////////////////////////////////////
 bool
-CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock )
+CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock, bool restore )
 {
 	// variable that gets modified if random generation
 	// flag is 'on'.
-	string tempSolName = cpSnoBlock->GetSolName();
+	string tempSolName = restore ? m_pI->m_solName : cpSnoBlock->GetSolName();
 
 	//
 	// Check for Random Sol requirement
 	//
-	if( cpSnoBlock->GetRandomSol() )
+	if( cpSnoBlock->GetRandomSol() && !restore )
 	{
 		// create a temp sol object to query object's category.
 		const CSolObj* pTempSolObj = cved->GetSol().GetObj( tempSolName );
@@ -2060,6 +2065,7 @@ CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock )
 		Suicide();
 		return false;
 	}
+	m_pI->m_solName = cSolName;
 
 	//
 	// Get the CVED object type and check to make sure it's valid.
@@ -2113,7 +2119,7 @@ CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock )
 	m_pI->m_objWidth  = cpSolObj->GetWidth();
 
 	double initVel = 0;
-	if (m_pI->m_velCntrl.initOvVel){
+	if (m_pI->m_velCntrl.initOvVel && !restore){
 		cved->GetOwnVehicleVel(initVel);
 		m_pI->m_velCntrl.initVel = initVel;
 	}else{
@@ -2288,38 +2294,41 @@ CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock )
 	pVehicleObj->SetAudioState( cpSnoBlock->GetAudioState() );
 	pVehicleObj->SetVisualState( cpSnoBlock->GetVisualState() );
 
-	//
-	// If the audio or visual has been set then assign these values
-	// to the dials.  This way the ADO will play those sounds and
-	// display those lights until they are explicity turned off.
-	//
-	if( cpSnoBlock->GetVisualState() > 0 )
-	{
-		char buf[128];
-		sprintf( buf, "%d", cpSnoBlock->GetVisualState() );
-		string str( buf );
-		m_dialVisualState.SetValue( str );
-	}
+	m_pI->m_curvature.SetCvedId( m_pI->m_pObj->GetId() );
 
-	if( cpSnoBlock->GetAudioState() > 0 )
+	if( !restore )
 	{
-		char buf[128];
-		sprintf( buf, "%d", cpSnoBlock->GetAudioState() );
-		string str( buf );
-		m_dialAudioState.SetValue( str );
-	}
+		//
+		// If the audio or visual has been set then assign these values
+		// to the dials.  This way the ADO will play those sounds and
+		// display those lights until they are explicity turned off.
+		//
+		if( cpSnoBlock->GetVisualState() > 0 )
+		{
+			char buf[128];
+			sprintf( buf, "%d", cpSnoBlock->GetVisualState() );
+			string str( buf );
+			m_dialVisualState.SetValue( str );
+		}
 
-	m_pI->m_curvature.SetCvedId( m_pI->m_pObj->GetId() );
+		if( cpSnoBlock->GetAudioState() > 0 )
+		{
+			char buf[128];
+			sprintf( buf, "%d", cpSnoBlock->GetAudioState() );
+			string str( buf );
+			m_dialAudioState.SetValue( str );
+		}
 
-	//
-	// Make an entry into the activity log for CVED creation.
-	//
-	m_pRootCollection->SetCvedCreateLog(
-				this,
-				m_pI->m_pObj->GetId(),
-				objType,
-				cartPos
-				);
+		//
+		// Make an entry into the activity log for CVED creation.
+		//
+		m_pRootCollection->SetCvedCreateLog(
+					this,
+					m_pI->m_pObj->GetId(),
+					objType,
+					cartPos
+					);
+	}
     //init control
     pVehicleObj->SetTargPos(cartPos);
     pVehicleObj->StoreOldTargPos();
@@ -2328,6 +2337,92 @@ CAdo::CreateCvedObject( const CAdoParseBlock* cpSnoBlock )
 }  // end of CreateCvedObject
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves the state that the generated SaveState can't handle.
+//
+// Remarks:  This is the vehicle info, which holds most of the ADO's 
+//   state, and the id of the CVED object, if one has been created.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdo::SaveUserState( CHcsmCheckpoint& ckpt )
+{
+	bool haveInfo = m_pI != NULL;
+	ckpt.Put( haveInfo );
+	if( !haveInfo )  return;
+
+	m_pI->SaveState( ckpt );
+
+	int cvedId = m_pI->m_pObj ? m_pI->m_pObj->GetId() : -1;
+	ckpt.Put( cvedId );
+}  // end of SaveUserState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Restores the state written by SaveUserState.
+//
+// Remarks:  The CVED object is not created here; the collection calls
+//   RestoreCvedObject once every Hcsm has been restored, so that the 
+//   objects can be created in the order of their original ids.  The
+//   lane change condition in progress is found through the link left by
+//   the LaneChange child, which is restored before this function runs.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdo::RestoreUserState( CHcsmCheckpoint& ckpt )
+{
+	bool haveInfo = false;
+	ckpt.Get( haveInfo );
+	if( !haveInfo )  return;
+	if( m_pI == NULL )
+	{
+		ckpt.SetError( "ADO " + m_name + " has no vehicle info to restore" );
+		return;
+	}
+
+	m_pI->RestoreState( ckpt, *cved );
+	m_pI->m_pObj = NULL;
+	m_pI->m_pCurrLcCond = (CLaneChangeCond*) ckpt.TakeLink( "CurrLcCond" );
+
+	int cvedId = -1;
+	ckpt.Get( cvedId );
+	if( cvedId >= 0 && ckpt.IsValid() )
+	{
+		m_pRootCollection->RestoreCvedObjectLater( cvedId, this );
+	}
+}  // end of RestoreUserState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Recreates the CVED object while restoring a checkpoint.
+//
+// Remarks:  See RestoreUserState.
+//
+// Arguments:
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdo::RestoreCvedObject()
+{
+	CreateCvedObject( dynamic_cast<const CAdoParseBlock*>( GetSnoBlock() ), true );
+}  // end of RestoreCvedObject
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Parses the MaintainGap dial settings.
@@ -5342,11 +5437,11 @@ CAdo::Activated( const CAdoParseBlock* cpSnoBlock )
 
 #ifdef DEBUG_EXTERNAL_DRIVER_SPEED
 	if (CHcsmCollection::m_ExternalDriverRehearsalControl && m_name == "ExternalDriver"){
-		m_pI->m_velCntrl.targetVel = CHcsmCollection::m_sOwnVehicleSpeed;
-		if ( CHcsmCollection::m_sMakeOwnVehicleChangeLanesLeft){
+		m_pI->m_velCntrl.targetVel = m_pRootCollection->m_ctx.m_sOwnVehicleSpeed;
+		if ( m_pRootCollection->m_ctx.m_sMakeOwnVehicleChangeLanesLeft){
 			m_dialLaneChange.SetValue("left;0.9;0.1");
 		}
-		if ( CHcsmCollection::m_sMakeOwnVehicleChangeLanesRight){
+		if ( m_pRootCollection->m_ctx.m_sMakeOwnVehicleChangeLanesRight){
 			m_dialLaneChange.SetValue("right;0.9;0.1");
 		}
 	}
@@ -5777,8 +5872,7 @@ CAdo::Activated( const CAdoParseBlock* cpSnoBlock )
 	{
 		CIntrsctn currIntrsctn;
 		currIntrsctn = m_pI->m_roadPos.GetLane().GetPrevIntrsctn();
-		static vector<CCrdr> allCrdrs;
-		allCrdrs.clear();
+		vector<CCrdr> allCrdrs;
 		currIntrsctn.GetAllCrdrs( allCrdrs );
 		vector<CCrdr>::iterator itr;
 		for( itr = allCrdrs.begin(); itr != allCrdrs.end(); itr++ )
@@ -5943,6 +6037,184 @@ CCved::TOwnVehiclePositionInfo positionInfo;
 }  // Activated
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Executes the Ado.
+//
+// Remarks:  When level of detail scheduling is enabled, an Ado far enough
+//   from the driver skips its behaviors on some frames and keeps driving
+//   on the controls computed by its last full update (see LodCoast).  All
+//   other frames go through the normal sequential execution.
+//
+// Arguments:
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdo::Execute()
+{
+	if( m_state == eACTIVE && LodCoast() )  return;
+
+	CHcsmSequential::Execute();
+}  // Execute
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Computes the level of detail the Ado should run at.
+//
+// Remarks:  Level 0 runs the behaviors every frame.  Anything that needs
+//   the behaviors to react right away (lane changes in progress,
+//   intersections, dials, buttons, remote control, logging, leaving the
+//   road) keeps the Ado at level 0.  Otherwise the level is picked by the
+//   distance to the own vehicle; distances behind the driver are
+//   stretched since those Ados are the least visible.
+//
+// Arguments:
+//
+// Returns:  The level of detail, between 0 and cADO_LOD_LEVELS - 1.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CAdo::LodLevel()
+{
+	if( m_pI->m_runMode != CAdoInfo::eAUTONOMOUS || m_pI->m_cmdMode )  return 0;
+	if( m_pI->m_pLogFile )  return 0;
+	if( m_pI->m_pCurrLcCond != NULL || m_pI->m_offroad )  return 0;
+	if( !m_pI->m_roadPos.IsValid() || !m_pI->m_roadPos.IsRoad() )  return 0;
+	if( m_pI->m_haveForcedLaneOffset || m_pI->m_forcedVelMode != eFV_NONE )
+	{
+		return 0;
+	}
+	if( m_pI->m_maintainGap.IsActive() )  return 0;
+
+	bool haveDial = (
+				m_dialAudioState.HasValue() ||
+				m_dialForcedLaneOffset.HasValue() ||
+				m_dialForcedVelocity.HasValue() ||
+				m_dialImStop.HasValue() ||
+				m_dialInhibitLaneChange.HasValue() ||
+				m_dialLaneChange.HasValue() ||
+				m_dialLaneChangeStatus.HasValue() ||
+				m_dialMaintainGap.HasValue() ||
+				m_dialTargetVelocity.HasValue() ||
+				m_dialVisualState.HasValue()
+				);
+	if( haveDial )  return 0;
+
+	bool haveButton = (
+				m_buttonChangeLaneLeft.IsButtonPressed() ||
+				m_buttonChangeLaneRight.IsButtonPressed() ||
+				m_buttonTurnLeft.IsButtonPressed() ||
+				m_buttonTurnRight.IsButtonPressed() ||
+				m_buttonProjectAndResetLaneOffset.IsButtonPressed()
+				);
+	if( haveButton )  return 0;
+
+	CPoint3D ovPos;
+	CVector3D ovTan;
+	if( !cved->GetOwnVehiclePos( ovPos ) || !cved->GetOwnVehicleTan( ovTan ) )
+	{
+		return 0;
+	}
+
+	CPoint3D pos = m_pI->m_pObj->GetPosImm();
+	double dx = pos.m_x - ovPos.m_x;
+	double dy = pos.m_y - ovPos.m_y;
+	double dist = sqrt( dx * dx + dy * dy );
+	if( dx * ovTan.m_i + dy * ovTan.m_j < 0.0 )
+	{
+		dist *= cADO_LOD_BEHIND_SCALE;
+	}
+
+	//
+	// Moving to a coarser level requires going past the threshold by
+	// the hysteresis so that an Ado near the boundary doesn't flip
+	// between levels every update.
+	//
+	int level;
+	for( level = cADO_LOD_LEVELS - 1; level > 0; level-- )
+	{
+		double threshold = cADO_LOD_DIST[level];
+		if( level > m_pI->m_lodLevel )  threshold += cADO_LOD_HYSTERESIS;
+		if( dist >= threshold )  break;
+	}
+
+	return level;
+}  // LodLevel
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Decides whether the Ado can skip its behaviors this frame
+//   and, if so, keeps it driving on the controls of the last full update.
+//
+// Remarks:  An Ado at level of detail N runs its behaviors once every
+//   cADO_LOD_PERIOD[N] frames.  A move to a finer level takes effect
+//   immediately while a move to a coarser level waits for the next full
+//   update.  On a skipped frame the init conditions still run so the Ado
+//   is deleted on time, and the target point handed to dynamics is moved
+//   along by the distance the vehicle travelled since it was computed;
+//   acceleration, steering and the steering rate limit are held.
+//
+// Arguments:
+//
+// Returns:  true if the frame was skipped, false if the behaviors have to
+//   run.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CAdo::LodCoast()
+{
+	if( !m_pRootCollection->m_sAdoLod )  return false;
+	if( !m_pI || !m_pI->m_pObj )  return false;
+	if( m_pI->m_initCondState != eUNDER_CONTROL )  return false;
+
+	int level = LodLevel();
+	if( !m_pI->m_lodHaveControls || level < m_pI->m_lodLevel ||
+		m_pI->m_lodCoastCount + 1 >= cADO_LOD_PERIOD[m_pI->m_lodLevel] )
+	{
+		m_pI->m_lodLevel = level;
+		m_pI->m_lodCoastCount = 0;
+		return false;
+	}
+
+	m_pI->m_lodCoastCount++;
+	m_pI->m_ageFrame++;
+	m_pI->m_pathRefreshCounter--;
+	m_pI->m_prevVel = m_pI->m_currVel;
+	m_pI->m_currVel = m_pI->m_pObj->GetVelImm();
+
+	m_pI->m_initCondState = m_initConditions.Execute(
+											m_pI->m_roadPos.GetXYZ(),
+											GetFrame()
+											);
+	if( m_pI->m_initCondState == eDELETE )
+	{
+		DeleteHcsm( this );
+		return true;
+	}
+
+	CVehicleObj* pVehicleObj = dynamic_cast<CVehicleObj *>( m_pI->m_pObj );
+	CPoint3D pos = m_pI->m_pObj->GetPosImm();
+	CPoint3D targPos = m_pI->m_lodTargPos;
+	targPos.m_x += pos.m_x - m_pI->m_lodPos.m_x;
+	targPos.m_y += pos.m_y - m_pI->m_lodPos.m_y;
+	targPos.m_z += pos.m_z - m_pI->m_lodPos.m_z;
+
+	pVehicleObj->StoreOldTargPos();
+	pVehicleObj->SetTargPos( targPos );
+	pVehicleObj->SetHaveAccel( m_pI->m_lodHaveAccel );
+	if( m_pI->m_lodHaveAccel )  pVehicleObj->SetTargAccel( m_pI->m_lodTargAccel );
+	pVehicleObj->SetHaveSteer( m_pI->m_lodHaveSteer );
+	if( m_pI->m_lodHaveSteer )  pVehicleObj->SetTargSteer( m_pI->m_lodTargSteer );
+	pVehicleObj->SetSteerMax( m_pI->m_lodSteerMax );
+
+	return true;
+}  // LodCoast
+
+
 void
 CAdo::UserPreActivity( const CAdoParseBlock* cpSnoBlock )
 {
@@ -6241,6 +6513,20 @@ CAdo::UserPostActivity( const CAdoParseBlock* cpSnoBlock )
     }else{
        pVehicleObj->SetSteerMax(cDefaultMaxSteerRateRadspS);
     }
+
+	//
+	// Remember the controls for the frames skipped by level of detail
+	// scheduling.
+	//
+	m_pI->m_lodHaveControls = true;
+	m_pI->m_lodPos = m_pI->m_pObj->GetPosImm();
+	m_pI->m_lodTargPos = targPos;
+	m_pI->m_lodHaveAccel = haveAccel;
+	if( haveAccel )  m_pI->m_lodTargAccel = targAccel;
+	m_pI->m_lodHaveSteer = haveSteer;
+	if( haveSteer )  m_pI->m_lodTargSteer = GetOutputTargSteerFromRemoteControl();
+	m_pI->m_lodSteerMax = haveSteerMax ?
+		GetOutputMaxSteerFromRemoteControl() : cDefaultMaxSteerRateRadspS;
 #if 0
 	if( m_pI->m_objName == "Ado2" )
 	{
@@ -6258,7 +6544,7 @@ CAdo::UserPostActivity( const CAdoParseBlock* cpSnoBlock )
 	if (m_pI->m_autoControlHeadLightsState){
 
 		//turn the headlights on
-		if (::CHcsmCollection::m_sHour > 18 || ::CHcsmCollection::m_sHour < 7){
+		if (::m_pRootCollection->m_ctx.m_sHour > 18 || ::m_pRootCollection->m_ctx.m_sHour < 7){
 			visState|= cCV_OPERATING_LIGHTS;
 			visState|= cCV_HIGHBEAM_LIGHTS;
 		}else{
@@ -6390,10 +6676,10 @@ CAdo::UserDeletion( const CAdoParseBlock* cpSnoBlock )
 	{
 		delete m_pI->m_pLogFile;
 	}
-	if( m_pI->m_pPath )  delete m_pI->m_pPath;
+	m_pRootCollection->GetAdoInfoPool().ReleasePath( m_pI->m_pPath );
 	if( m_pI )
 	{
-		delete m_pI;
+		m_pRootCollection->GetAdoInfoPool().ReleaseInfo( m_pI );
 		m_pI = NULL;
 	}
 
@@ -132,25 +132,25 @@ CFollow::GetLeadObjectId(
 			continue;
 		}
 
-		CRoadPos leadRoadPos;
+		const CRoadPos* pLeadRoadPos;
 		bool haveValFromMonitor;
 
 		if ( objId == 1 )  // external trailer 
 		{
-			haveValFromMonitor = pLeadHcsm->GetMonitorByName( 
+			haveValFromMonitor = pLeadHcsm->BorrowMonitorByName( 
 															"TrailerPos", 
-															&leadRoadPos
+															&pLeadRoadPos
 															);
 		}
 		else
 		{
-			haveValFromMonitor = pLeadHcsm->GetMonitorByName( 
+			haveValFromMonitor = pLeadHcsm->BorrowMonitorByName( 
 															"RoadPos", 
-															&leadRoadPos
+															&pLeadRoadPos
 															);
 		}
 
-		if( !haveValFromMonitor || !leadRoadPos.IsValid() ) 
+		if( !haveValFromMonitor || !pLeadRoadPos->IsValid() ) 
 		{
 //			gout << MessagePrefix( pI->m_pObj->GetId() );
 //			gout << "failed to get lead road position for object ";
@@ -158,6 +158,7 @@ CFollow::GetLeadObjectId(
 
 			continue;
 		}
+		const CRoadPos& leadRoadPos = *pLeadRoadPos;
 
 		//
 		// Look at offsets and stuff.
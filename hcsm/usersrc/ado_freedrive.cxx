@@ -18,6 +18,7 @@
 #include "support.h"
 #include "vehdyncommand.h"
 #include "controllers.h"
+#include "adoinfopool.h"
 
 #include <pi_iostream>
 using namespace std;
@@ -1432,8 +1433,8 @@ CFreeDrive::PostActivity()
 						gout << "  oldPath[" << pI->m_pPath->Size() << "]:" << endl;
 						gout << *pI->m_pPath;
 
-						delete pI->m_pPath;
-						pI->m_pPath = new CPath( *cved );
+						m_pRootCollection->GetAdoInfoPool().ReleasePath( pI->m_pPath );
+						pI->m_pPath = m_pRootCollection->GetAdoInfoPool().AcquirePath( *cved );
 
 						NewPath( pI );
 						ExtendPath( pI );
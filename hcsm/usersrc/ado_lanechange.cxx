@@ -21,6 +21,7 @@
 #include <stack>
 #include "ado_lc_data.h"
 #include "controllers.h"
+#include "hcsmcheckpoint.h"
 
 using namespace std;
 
@@ -219,6 +220,66 @@ CLaneChange::Deletion()
 }  // end of LaneChangeCreation
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves which of the conditions is in progress.
+//
+// Remarks: The vehicle info points at the condition in progress, which
+//   lives in m_conditions.  The pointer can't be saved, so the type of
+//   the condition is saved instead.
+//
+// Arguments:
+//   ckpt - The checkpoint to write to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChange::SaveUserState( CHcsmCheckpoint& ckpt )
+{
+
+	int type = eLC_NONE;
+	if( HasValueInputpI() )
+	{
+		CAdoInfoPtr pI = GetInputpI();
+		if( pI && pI->m_pCurrLcCond )  type = pI->m_pCurrLcCond->GetType();
+	}
+	ckpt.Put( type );
+
+}  // end of SaveUserState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Restores the state written by SaveUserState.
+//
+// Remarks: The input parameters aren't set while restoring, so the
+//   condition is handed to the ADO, which restores the vehicle info,
+//   through a checkpoint link.
+//
+// Arguments:
+//   ckpt - The checkpoint to read from.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChange::RestoreUserState( CHcsmCheckpoint& ckpt )
+{
+
+	int type = eLC_NONE;
+	ckpt.Get( type );
+	if( type != eLC_NONE && ckpt.IsValid() )
+	{
+		ckpt.SetLink( 
+				"CurrLcCond", 
+				&m_conditions.GetCondition( (ELcCondition) type ) 
+				);
+	}
+
+}  // end of RestoreUserState
+
+
 void 
 CLaneChange::PreActivity()
 {
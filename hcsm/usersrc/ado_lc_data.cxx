@@ -86,10 +86,38 @@ using std::map;
 
 
 //
-// Mapping function
+// Mapping function: returns the row of the tables below that holds the
+// data of SOL model solId.  Models without data of their own use the
+// row of SOL id 1.
 //
-static int solIdIndex=0;
-map<int,int> solIdToIndexMap; // solIdIndex -> solId
+static int
+SolIdToIndex( int solId )
+{
+	switch( solId )
+	{
+	case 1:   return 0;
+	case 19:  return 1;
+	case 35:  return 2;
+	case 37:  return 3;
+	case 38:  return 4;
+	case 42:  return 5;
+	case 43:  return 6;
+	case 56:  return 7;
+	case 67:  return 8;
+	case 69:  return 9;
+	case 71:  return 10;
+	case 72:  return 11;
+	case 84:  return 12;
+	case 101: return 13;
+	case 2:   return 14;
+	case 18:  return 15;
+	case 36:  return 16;
+	case 39:  return 17;
+	case 40:  return 18;
+	case 41:  return 19;
+	default:  return 0;
+	}
+}
 
 //
 // Longitudinal Distance
@@ -1259,36 +1287,8 @@ LcLookupDistTime(
 			double& time 
 			)
 {
-	// Adding  solid to map
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }
-	//// Getting the position of the particluar SolModel in the array 
-	//solIdIndex = solIdToIndexMap[solId]; 
+	// Row of the SOL model in the tables
+	int solIdIndex = SolIdToIndex( solId );
 
 	// Testing the input velocity
 	bool velLimits = (velocity >= 5.0 && velocity <= 120.0);
@@ -1394,37 +1394,9 @@ LcLookupVelocityfromDist(
 	bool matchFound = false;
 	if (withinLimits) 
 	{ 
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-		// Getting the position of the particluar SolModel in the array 
-		//solIdIndex = solIdToIndexMap[solId]; 
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }
+		// Row of the SOL model in the tables
+		int solIdIndex = SolIdToIndex( solId );
+
 		// Coverting the urgency into a position in the array
 		int urgCounter = int(urgency*10) - 1; 
 
@@ -1519,38 +1491,9 @@ LcLookupVelocityfromDist(
 	bool matchFound = false; 
 	if(withinLimits) 
 	{ 
-		// Adding  solid to map 
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-		// Getting the position of the particluar SolModel in the array 
-		//solIdIndex = solIdToIndexMap[solId];  
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }		 
+		// Row of the SOL model in the tables
+		int solIdIndex = SolIdToIndex( solId );
+
 		// 
 		// Vector that holds the matching vel-urg pair 
 		// 
@@ -1684,38 +1627,9 @@ LcLookupVelocityfromTime(
 	bool matchFound = false;
 	if(withinLimits) 
 	{ 
-		// Adding  solid to map 
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-		// Getting the position of the particluar SolModel in the array  
-		//solIdIndex = solIdToIndexMap[solId];  
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }
+		// Row of the SOL model in the tables
+		int solIdIndex = SolIdToIndex( solId );
+
 		// Coverting the urgency into a position in the array 
 		int urgCounter = int(urgency*10) - 1; 
 		for (int velCounter = 23; velCounter >= 0; velCounter--) 
@@ -1818,38 +1732,9 @@ LcLookupVelocityfromTime(
 	bool matchFound = false; 
 	if (withinLimits) 
 	{ 
-		// Adding  solid to map 
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-		// Getting the position of the particluar SolModel in the array  
-		//solIdIndex = solIdToIndexMap[solId];  
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }
+		// Row of the SOL model in the tables
+		int solIdIndex = SolIdToIndex( solId );
+
 		// 
 		// Pair vector to hold the matching vel and urg 
 		// 
@@ -1977,38 +1862,9 @@ LcLookupUrgencyfromDist(
 			double& urgency 
 			)
 {
-	// Adding  solid to map
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-	// Getting the position of the particluar SolModel in the array 
-	//solIdIndex = solIdToIndexMap[solId]; 
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }	
+	// Row of the SOL model in the tables
+	int solIdIndex = SolIdToIndex( solId );
+
 	double tempDist[10];
 
 	bool withinLimits = (velocity > 0.0 && velocity <= 120.0); // Testing the input velocity;
@@ -2160,38 +2016,9 @@ LcLookupUrgencyfromTime(
 			double& urgency 
 			)
 {
-	// Adding  solid to map
-	solIdToIndexMap[1] = 0;
-	solIdToIndexMap[19] = 1;
-	solIdToIndexMap[35] = 2;
-	solIdToIndexMap[37] = 3;
-	solIdToIndexMap[38] = 4;
-	solIdToIndexMap[42] = 5;
-	solIdToIndexMap[43] = 6;
-	solIdToIndexMap[56] = 7;
-	solIdToIndexMap[67] = 8;
-	solIdToIndexMap[69] = 9;
-	solIdToIndexMap[71] = 10;
-	solIdToIndexMap[72] = 11;
-	solIdToIndexMap[84] = 12;
-	solIdToIndexMap[101] = 13;
-	solIdToIndexMap[2] = 14;
-	solIdToIndexMap[18] = 15;
-	solIdToIndexMap[36] = 16;
-	solIdToIndexMap[39] = 17;
-	solIdToIndexMap[40] = 18;
-	solIdToIndexMap[41] = 19;
-
-
-	// Getting the position of the particluar SolModel in the array 
-	//solIdIndex = solIdToIndexMap[solId]; 
-
-    auto itr = solIdToIndexMap.find(solId);
-    if (itr != solIdToIndexMap.end()){
-        solIdIndex = itr->second; 
-    }else{
-        solIdIndex = solIdToIndexMap.begin()->second;
-    }
+	// Row of the SOL model in the tables
+	int solIdIndex = SolIdToIndex( solId );
+
 	double tempTime[10];
 
 	bool withinLimits = (velocity > 0.0 && velocity <= 120.0); // Testing the input velocity;
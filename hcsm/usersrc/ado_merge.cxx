@@ -18,6 +18,7 @@
 #include "hcsmpch.h"
 #include "controllers.h"
 #include "support.h"
+#include "mergegaptable.h"
 #include <pi_iostream>
 using namespace std;
 
@@ -255,8 +256,6 @@ CMerge::GapSearch( CAdoInfoPtr& pI, int& gapObjId, double& targAccel )
 	}
 #endif
 
-	CLane targCrdrSrcLn = m_targCrdr.GetSrcLn();
-	CRoad targCrdrSrcRd = targCrdrSrcLn.GetRoad();
 	bool isGapFound = false;
 
 	if( numObjs == 0 )
@@ -296,9 +295,6 @@ CMerge::GapSearch( CAdoInfoPtr& pI, int& gapObjId, double& targAccel )
 #endif
 
 
-		// Get obj dist to point P1
-		double objDistToP1;
-
 		if( !isObjOnRoad )	// If obj is on intersection
 		{
 			// Ignore obj passed point P1.
@@ -332,26 +328,20 @@ CMerge::GapSearch( CAdoInfoPtr& pI, int& gapObjId, double& targAccel )
 					return true;
 				}
 			}
-
-			objDistToP1 = m_distAtP1 - objDist;
-		}
-		else	// If obj on target corridor source road
-		{
-			if( targCrdrSrcLn.GetDirection() == ePOS )
-			{
-				objDistToP1 = targCrdrSrcRd.GetLinearLength() - objDist + m_distAtP1;
-			}
-			else
-			{
-				objDistToP1 = objDist + m_distAtP1;
-			}
 		}
 
-		m_distToP1ApprchObj = objDistToP1;
+		// Get the dist and tta to P1, shared with the other ADOs merging here
+		TMergeApprchObj apprchObj = m_pRootCollection->GetMergeGapTable().Get( 
+									*cved,
+									GetFrame(),
+									m_targCrdr,
+									m_distAtP1,
+									pI->m_objsApprch[j]
+									);
+		double objDistToP1 = apprchObj.distToP1;
+		double ttaObjAtP1 = apprchObj.tta;
 
-		// Compute tta to P1
-		double ttaObjAtP1;
-		ComputeTimeToArrival( pI, objId, objDistToP1, ttaObjAtP1 ); 
+		m_distToP1ApprchObj = objDistToP1;
 
 
 		// If ado passed p1, go from GS to OFF.
@@ -634,33 +624,13 @@ CMerge::GapSearch( CAdoInfoPtr& pI, int& gapObjId, double& targAccel )
 #endif
 
 				// Get the tta of the follower behind the approaching obj
-				int followObjId = pI->m_objsApprch[j+1].objId;
-				double followObjDist = pI->m_objsApprch[j+1].objDist;
-				bool isFollowObjOnRoad = pI->m_objsApprch[j+1].isOnRoad;
-
-				double followObjDistToP1;
-
-				if( !isFollowObjOnRoad )	// If follow obj is on intersection
-				{
-
-					followObjDistToP1 = m_distAtP1 - followObjDist;
-				}
-				else	// If follow obj on target corridor source road
-				{
-					if( targCrdrSrcLn.GetDirection() == ePOS )
-					{
-						followObjDistToP1 = targCrdrSrcRd.GetLinearLength() - followObjDist
-											+ m_distAtP1;
-					}
-					else
-					{
-						followObjDistToP1 = followObjDist + m_distAtP1;
-					}
-				}	
-					
-				// Compute follow obj tta to P1
-				double ttaFollowObjAtP1;
-				ComputeTimeToArrival( pI, followObjId, followObjDistToP1, ttaFollowObjAtP1 );
+				double ttaFollowObjAtP1 = m_pRootCollection->GetMergeGapTable().Get( 
+									*cved,
+									GetFrame(),
+									m_targCrdr,
+									m_distAtP1,
+									pI->m_objsApprch[j+1]
+									).tta;
 
 				double gapBetweenApprchObjs = fabs( ttaObjAtP1 - ttaFollowObjAtP1 );
 
@@ -1615,8 +1585,6 @@ CMerge::ComputeApprchObjDistToP1( CAdoInfoPtr& pI, int gapObjId, double& distToP
 	for ( int i = 0; i < numObjs; i++ )
 	{
 		int objId = pI->m_objsApprch[i].objId;
-		double objDist = pI->m_objsApprch[i].objDist;
-		bool isObjOnRoad = pI->m_objsApprch[i].isOnRoad;
 
 #ifdef	DEBUG_COMPUTE_APPRCH_OBJDIST_TOP1
 		if( debugThisObj )
@@ -1644,25 +1612,13 @@ CMerge::ComputeApprchObjDistToP1( CAdoInfoPtr& pI, int gapObjId, double& distToP
 #endif
 
 
-			if( !isObjOnRoad )	// If obj is on intersection
-			{
-				distToP1 = m_distAtP1 - objDist;
-			}
-			else	
-			{
-				// Obj is on target corridor source road.
-				CLane targCrdrSrcLn = m_targCrdr.GetSrcLn();
-				CRoad targCrdrSrcRd = targCrdrSrcLn.GetRoad();
-
-				if( targCrdrSrcLn.GetDirection() == ePOS )
-				{
-					distToP1 = targCrdrSrcRd.GetLinearLength() - objDist + m_distAtP1;
-				}
-				else
-				{
-					distToP1 = objDist + m_distAtP1;
-				}
-			}
+			distToP1 = m_pRootCollection->GetMergeGapTable().Get( 
+							*cved,
+							GetFrame(),
+							m_targCrdr,
+							m_distAtP1,
+							pI->m_objsApprch[i]
+							).distToP1;
 			return true;
 		}
 	} // for
@@ -15,6 +15,7 @@
  ****************************************************************************/
 
 #include "adoinfo.h"
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -26,6 +27,7 @@ CAdoInfo::CAdoInfo(
 			const cvEObjType objType 
 			):
 	m_objName( "" ), 
+	m_solName( "" ), 
 	m_objType( objType ),
 	m_ageFrame( 0 ),
 	m_prevRoadPos( roadPos ),
@@ -94,7 +96,15 @@ CAdoInfo::CAdoInfo(
 	m_audioStateFromDialCount( -1 ),
 	m_lastOvel(-1),
 	m_hasMoved(false),
-    m_gapStartFrame(-1)
+    m_gapStartFrame(-1),
+	m_lodLevel( 0 ),
+	m_lodCoastCount( 0 ),
+	m_lodHaveControls( false ),
+	m_lodHaveAccel( false ),
+	m_lodTargAccel( 0.0 ),
+	m_lodHaveSteer( false ),
+	m_lodTargSteer( 0.0 ),
+	m_lodSteerMax( cDefaultMaxSteerRateRadspS )
 {
 
 	SetCurrRoadPos( roadPos );
@@ -207,6 +217,7 @@ CAdoInfo::operator=( const CAdoInfo& cRhs )
 	if( this != &cRhs ) 
 	{
 		m_objName                  = cRhs.m_objName;
+		m_solName                  = cRhs.m_solName;
 		m_objType                  = cRhs.m_objType;
 		SetCurrRoadPos( m_roadPos );
 		m_prevRoadPos              = cRhs.m_prevRoadPos;
@@ -288,6 +299,16 @@ CAdoInfo::operator=( const CAdoInfo& cRhs )
 		m_audioStateFromDial       = cRhs.m_audioStateFromDial;
 		m_audioStateFromDialCount  = cRhs.m_audioStateFromDialCount;
         m_gapStartFrame            = cRhs.m_gapStartFrame;
+		m_lodLevel                 = cRhs.m_lodLevel;
+		m_lodCoastCount            = cRhs.m_lodCoastCount;
+		m_lodHaveControls          = cRhs.m_lodHaveControls;
+		m_lodPos                   = cRhs.m_lodPos;
+		m_lodTargPos               = cRhs.m_lodTargPos;
+		m_lodHaveAccel             = cRhs.m_lodHaveAccel;
+		m_lodTargAccel             = cRhs.m_lodTargAccel;
+		m_lodHaveSteer             = cRhs.m_lodHaveSteer;
+		m_lodTargSteer             = cRhs.m_lodTargSteer;
+		m_lodSteerMax              = cRhs.m_lodSteerMax;
 	}
 
 	return *this;
@@ -385,3 +406,449 @@ CRandLaneDevInfo::CRandLaneDevInfo()
 CRandLaneDevInfo::~CRandLaneDevInfo()
 {
 }
+
+//////////////////////////////////////////////////////////////////////
+// Checkpoints
+//////////////////////////////////////////////////////////////////////
+
+static void
+SaveRandLaneDev( CHcsmCheckpoint& ckpt, const CRandLaneDevInfo& cInfo )
+{
+	ckpt.Put( cInfo.m_Model );
+	ckpt.Put( cInfo.m_Enable );
+	ckpt.Put( cInfo.m_Rnd );
+	ckpt.Put( cInfo.m_Rise );
+	ckpt.Put( cInfo.m_Rise1 );
+	ckpt.Put( cInfo.m_Rise2 );
+	ckpt.Put( cInfo.m_Fall );
+	ckpt.Put( cInfo.m_Fall1 );
+	ckpt.Put( cInfo.m_Fall2 );
+	ckpt.Put( cInfo.m_Idle );
+	ckpt.Put( cInfo.m_Idle1 );
+	ckpt.Put( cInfo.m_Idle2 );
+	ckpt.Put( cInfo.m_RampAmp );
+	ckpt.Put( cInfo.m_RampAmp1 );
+	ckpt.Put( cInfo.m_RampAmp2 );
+	ckpt.Put( cInfo.m_Pos );
+	ckpt.Put( cInfo.m_RampStartTime );
+	ckpt.Put( cInfo.m_Bias );
+	ckpt.Put( cInfo.m_Bias1 );
+	ckpt.Put( cInfo.m_Bias2 );
+	ckpt.Put( cInfo.m_SinAmp );
+	ckpt.Put( cInfo.m_SinAmp1 );
+	ckpt.Put( cInfo.m_SinAmp2 );
+	ckpt.Put( cInfo.m_Frequ );
+	ckpt.Put( cInfo.m_Frequ1 );
+	ckpt.Put( cInfo.m_Frequ2 );
+	ckpt.Put( cInfo.m_Phase );
+	ckpt.Put( cInfo.m_Phase1 );
+	ckpt.Put( cInfo.m_Phase2 );
+	ckpt.Put( cInfo.m_ReevalTime );
+	ckpt.Put( cInfo.m_ReevalTime1 );
+	ckpt.Put( cInfo.m_ReevalTime2 );
+	ckpt.Put( cInfo.m_Timer );
+	ckpt.Put( cInfo.m_Last );
+}
+
+static void
+RestoreRandLaneDev( CHcsmCheckpoint& ckpt, CRandLaneDevInfo& info )
+{
+	ckpt.Get( info.m_Model );
+	ckpt.Get( info.m_Enable );
+	ckpt.Get( info.m_Rnd );
+	ckpt.Get( info.m_Rise );
+	ckpt.Get( info.m_Rise1 );
+	ckpt.Get( info.m_Rise2 );
+	ckpt.Get( info.m_Fall );
+	ckpt.Get( info.m_Fall1 );
+	ckpt.Get( info.m_Fall2 );
+	ckpt.Get( info.m_Idle );
+	ckpt.Get( info.m_Idle1 );
+	ckpt.Get( info.m_Idle2 );
+	ckpt.Get( info.m_RampAmp );
+	ckpt.Get( info.m_RampAmp1 );
+	ckpt.Get( info.m_RampAmp2 );
+	ckpt.Get( info.m_Pos );
+	ckpt.Get( info.m_RampStartTime );
+	ckpt.Get( info.m_Bias );
+	ckpt.Get( info.m_Bias1 );
+	ckpt.Get( info.m_Bias2 );
+	ckpt.Get( info.m_SinAmp );
+	ckpt.Get( info.m_SinAmp1 );
+	ckpt.Get( info.m_SinAmp2 );
+	ckpt.Get( info.m_Frequ );
+	ckpt.Get( info.m_Frequ1 );
+	ckpt.Get( info.m_Frequ2 );
+	ckpt.Get( info.m_Phase );
+	ckpt.Get( info.m_Phase1 );
+	ckpt.Get( info.m_Phase2 );
+	ckpt.Get( info.m_ReevalTime );
+	ckpt.Get( info.m_ReevalTime1 );
+	ckpt.Get( info.m_ReevalTime2 );
+	ckpt.Get( info.m_Timer );
+	ckpt.Get( info.m_Last );
+}
+
+static void
+SaveMaintainGap( CHcsmCheckpoint& ckpt, const CMaintainGapInfo& cInfo )
+{
+	ckpt.Put( cInfo.m_objName );
+	ckpt.Put( cInfo.m_objId );
+	ckpt.Put( cInfo.m_distMode );
+	ckpt.Put( cInfo.m_value );
+	ckpt.Put( cInfo.m_maxSpeed );
+	ckpt.Put( cInfo.m_minSpeed );
+	ckpt.Put( cInfo.m_distKp );
+	ckpt.Put( cInfo.m_velKp );
+	ckpt.Put( cInfo.m_maxAccel );
+	ckpt.Put( cInfo.m_maxDecel );
+	ckpt.Put( cInfo.m_percentAroundTarget );
+	ckpt.Put( cInfo.m_distDuration );
+	ckpt.Put( cInfo.m_duration );
+	ckpt.Put( cInfo.m_disableSpeed );
+	ckpt.Put( cInfo.m_duration2 );
+	ckpt.Put( cInfo.m_hasExpr );
+}
+
+static void
+RestoreMaintainGap( CHcsmCheckpoint& ckpt, CMaintainGapInfo& info )
+{
+	ckpt.Get( info.m_objName );
+	ckpt.Get( info.m_objId );
+	ckpt.Get( info.m_distMode );
+	ckpt.Get( info.m_value );
+	ckpt.Get( info.m_maxSpeed );
+	ckpt.Get( info.m_minSpeed );
+	ckpt.Get( info.m_distKp );
+	ckpt.Get( info.m_velKp );
+	ckpt.Get( info.m_maxAccel );
+	ckpt.Get( info.m_maxDecel );
+	ckpt.Get( info.m_percentAroundTarget );
+	ckpt.Get( info.m_distDuration );
+	ckpt.Get( info.m_duration );
+	ckpt.Get( info.m_disableSpeed );
+	ckpt.Get( info.m_duration2 );
+	ckpt.Get( info.m_hasExpr );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves the information in a checkpoint.
+//
+// Remarks: The CVED object, the log file and the current lane change
+//   condition are not saved.  The first two belong to the ADO, which
+//   sets them up again when it is recreated; the condition belongs to
+//   the ADO's LaneChange child, which links it back in when it is 
+//   restored.  The object lists are rebuilt every frame.
+//
+// Arguments:
+//   ckpt - The checkpoint.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdoInfo::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+	ckpt.Put( m_objName );
+	ckpt.Put( m_solName );
+	ckpt.Put( m_objType );
+	ckpt.Put( m_ageFrame );
+	ckpt.Put( m_timeStepDuration );
+	ckpt.Put( m_pathRefreshCounter );
+	ckpt.Put( m_roadPos );
+	ckpt.Put( m_currLane );
+	ckpt.Put( m_currRoad );
+	ckpt.Put( m_currIntrsctn );
+	ckpt.Put( m_currCrdr );
+	ckpt.Put( m_prevRoadPos );
+	ckpt.Put( m_offroad );
+	ckpt.Put( m_offroadCartPos );
+	ckpt.Put( m_offroadGuideRoadPos );
+	ckpt.Put( m_trackLane );
+	ckpt.Put( m_initCondState );
+	ckpt.Put( m_dynModel );
+	ckpt.Put( m_currVel );
+	ckpt.Put( m_prevVel );
+	ckpt.Put( m_aggressiveness );
+	ckpt.Put( m_runMode );
+	ckpt.Put( m_cmdMode );
+	ckpt.Put( m_commands.GetPosition() );
+	ckpt.Put( m_rngStreamId );
+	ckpt.Put( m_pPath != NULL );
+	if( m_pPath != NULL )  ckpt.Put( *m_pPath );
+	ckpt.Put( m_avoidTurnsAtIntersection );
+	ckpt.Put( m_velCntrl.initVel );
+	ckpt.Put( m_velCntrl.initOvVel );
+	ckpt.Put( m_velCntrl.refreshTime );
+	ckpt.Put( m_velCntrl.targetVel );
+	ckpt.Put( m_velCntrl.targetVelDurationCount );
+	ckpt.Put( m_velCntrl.followSpeedLimit );
+	m_curvature.SaveState( ckpt );
+	ckpt.Put( m_maxAccelDueToCurv );
+	ckpt.Put( m_pastLcCond );
+	ckpt.Put( m_prevLcCompleteFrame );
+	ckpt.Put( m_targLaneSplitsFromCurrLane );
+	ckpt.Put( m_lcSinAngle );
+	ckpt.Put( m_lcLatDistTraveled );
+	ckpt.Put( m_lcTotalLatDist );
+	ckpt.Put( m_lcTargPointLatDistToTarget );
+	ckpt.Put( m_lcTargPointTotalLatDist );
+	ckpt.Put( m_lcMaxSinAngle );
+	ckpt.Put( m_lightState );
+	ckpt.PutPod( m_lcInfo );
+	ckpt.Put( m_nextTurnSignalComputed );
+	ckpt.Put( m_nextTurnSignal );
+	ckpt.Put( m_signalTimeFromDial );
+	ckpt.Put( m_hasSignalTimeFromDial );
+	ckpt.Put( m_leftLaneChangeButton );
+	ckpt.Put( m_rightLaneChangeButton );
+	ckpt.Put( m_reporjectAndResetLaneOffsetButton );
+	ckpt.Put( m_laneChangeUrgency );
+	ckpt.Put( m_laneChangeWaitCount );
+	ckpt.Put( m_laneChangeDurationCount );
+	ckpt.Put( m_lcInhibitCount );
+	ckpt.Put( m_lcStatus );
+	ckpt.Put( m_lcStatusCount );
+	ckpt.Put( m_haveForcedLaneOffset );
+	ckpt.Put( m_forcedLaneOffset );
+	ckpt.Put( m_prevForcedLaneOffset );
+	ckpt.Put( m_forcedLaneOffsetUrgency );
+	ckpt.Put( m_forcedLaneOffsetTurnRate );
+	ckpt.Put( m_forcedOffsetFrameCounter );
+	ckpt.Put( m_forcedOffsetDelay );
+	ckpt.Put( m_forcedOffsetMaxSteerDistance );
+	ckpt.Put( m_forcedOffsetMaxSteerForce );
+	ckpt.Put( m_forcedOffsetTolerance );
+	ckpt.Put( m_forcedOffsetMinLookAhead );
+	ckpt.Put( m_visualStateFromDial );
+	ckpt.Put( m_visualStateFromDialCount );
+	ckpt.Put( m_audioStateFromDial );
+	ckpt.Put( m_audioStateFromDialCount );
+	ckpt.Put( m_hasMoved );
+	ckpt.Put( m_objLength );
+	ckpt.Put( m_objWidth );
+	SaveMaintainGap( ckpt, m_maintainGap );
+	ckpt.Put( m_isFollowTime );
+	ckpt.Put( m_followMin );
+	ckpt.Put( m_followMax );
+	ckpt.Put( m_followRefreshFrame );
+	ckpt.Put( m_imStopHasValue );
+	ckpt.Put( m_imStopHldOfsDist );
+	ckpt.PutBytes( m_acgoutHcsmText, sizeof( m_acgoutHcsmText ) );
+	ckpt.Put( (int) m_mergeInfo.size() );
+	for( size_t i = 0; i < m_mergeInfo.size(); i++ )
+	{
+		ckpt.Put( m_mergeInfo[i].pos );
+		ckpt.Put( m_mergeInfo[i].radius );
+		ckpt.Put( m_mergeInfo[i].leadObjId );
+	}
+	ckpt.Put( m_mergeLaneChangeIsNeeded );
+	ckpt.Put( m_mergeTargCrdr );
+	ckpt.PutPod( m_FollowParams );
+	ckpt.Put( m_FollowInfo.m_OldState );
+	ckpt.Put( m_FollowInfo.m_OldAccel );
+	ckpt.Put( m_FollowInfo.m_Timer );
+	ckpt.Put( m_FollowInfo.m_Counting );
+	ckpt.Put( m_followTtc );
+	ckpt.Put( m_followDist );
+	ckpt.Put( m_followTarget );
+	ckpt.Put( m_lastOvel );
+	ckpt.Put( m_forcedVel );
+	ckpt.Put( m_forcedVelAccel );
+	ckpt.Put( m_forcedVelStart );
+	ckpt.Put( m_forcedVelEnd );
+	ckpt.Put( m_forcedVelMode );
+	ckpt.Put( m_forcedVelChange );
+	ckpt.Put( m_forcedVelFileHandle );
+	ckpt.Put( m_forcedVelFileMultiplier );
+	ckpt.Put( m_DisableLaneDevWhenForcedOffsetDial );
+	SaveRandLaneDev( ckpt, m_randLaneDev );
+	SaveRandLaneDev( ckpt, m_lcNeutralizeOffset );
+	ckpt.Put( m_forcedVelExpression );
+	ckpt.Put( m_signalFadeIn );
+	ckpt.Put( m_autoControlBrakeLightState );
+	ckpt.Put( m_autoControlHeadLightsState );
+	ckpt.Put( m_gapStartFrame );
+	ckpt.Put( m_fwdDistThreshold );
+	ckpt.Put( m_backDistThreshold );
+	ckpt.Put( m_fwdTimeThreshold );
+	ckpt.Put( m_backTimeThreshold );
+	ckpt.Put( m_lodLevel );
+	ckpt.Put( m_lodCoastCount );
+	ckpt.Put( m_lodHaveControls );
+	ckpt.Put( m_lodPos );
+	ckpt.Put( m_lodTargPos );
+	ckpt.Put( m_lodHaveAccel );
+	ckpt.Put( m_lodTargAccel );
+	ckpt.Put( m_lodHaveSteer );
+	ckpt.Put( m_lodTargSteer );
+	ckpt.Put( m_lodSteerMax );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Restores the information from a checkpoint.
+//
+// Remarks: The information is expected to belong to an ADO that has been
+//   recreated from the same snoblock, so that its path and command file
+//   already exist.
+//
+// Arguments:
+//   ckpt  - The checkpoint.
+//   cCved - The CVED instance the road positions refer to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CAdoInfo::RestoreState( CHcsmCheckpoint& ckpt, const CCved& cCved )
+{
+	ckpt.Get( m_objName );
+	ckpt.Get( m_solName );
+	ckpt.Get( m_objType );
+	ckpt.Get( m_ageFrame );
+	ckpt.Get( m_timeStepDuration );
+	ckpt.Get( m_pathRefreshCounter );
+	ckpt.Get( m_roadPos, cCved );
+	ckpt.Get( m_currLane, cCved );
+	ckpt.Get( m_currRoad, cCved );
+	ckpt.Get( m_currIntrsctn, cCved );
+	ckpt.Get( m_currCrdr, cCved );
+	ckpt.Get( m_prevRoadPos, cCved );
+	ckpt.Get( m_offroad );
+	ckpt.Get( m_offroadCartPos );
+	ckpt.Get( m_offroadGuideRoadPos, cCved );
+	ckpt.Get( m_trackLane, cCved );
+	ckpt.Get( m_initCondState );
+	ckpt.Get( m_dynModel );
+	ckpt.Get( m_currVel );
+	ckpt.Get( m_prevVel );
+	ckpt.Get( m_aggressiveness );
+	ckpt.Get( m_runMode );
+	ckpt.Get( m_cmdMode );
+	int commandPos = 0;
+	ckpt.Get( commandPos );
+	m_commands.Seek( commandPos );
+	ckpt.Get( m_rngStreamId );
+	bool hasPath = false;
+	ckpt.Get( hasPath );
+	if( hasPath && m_pPath == NULL )
+	{
+		ckpt.SetError( "ADO " + m_objName + " has no path to restore" );
+	}
+	if( hasPath && m_pPath != NULL )  ckpt.Get( *m_pPath, cCved );
+	ckpt.Get( m_avoidTurnsAtIntersection );
+	ckpt.Get( m_velCntrl.initVel );
+	ckpt.Get( m_velCntrl.initOvVel );
+	ckpt.Get( m_velCntrl.refreshTime );
+	ckpt.Get( m_velCntrl.targetVel );
+	ckpt.Get( m_velCntrl.targetVelDurationCount );
+	ckpt.Get( m_velCntrl.followSpeedLimit );
+	m_curvature.RestoreState( ckpt, cCved );
+	ckpt.Get( m_maxAccelDueToCurv );
+	ckpt.Get( m_pastLcCond );
+	ckpt.Get( m_prevLcCompleteFrame );
+	ckpt.Get( m_targLaneSplitsFromCurrLane );
+	ckpt.Get( m_lcSinAngle );
+	ckpt.Get( m_lcLatDistTraveled );
+	ckpt.Get( m_lcTotalLatDist );
+	ckpt.Get( m_lcTargPointLatDistToTarget );
+	ckpt.Get( m_lcTargPointTotalLatDist );
+	ckpt.Get( m_lcMaxSinAngle );
+	ckpt.Get( m_lightState );
+	ckpt.GetPod( m_lcInfo );
+	ckpt.Get( m_nextTurnSignalComputed );
+	ckpt.Get( m_nextTurnSignal );
+	ckpt.Get( m_signalTimeFromDial );
+	ckpt.Get( m_hasSignalTimeFromDial );
+	ckpt.Get( m_leftLaneChangeButton );
+	ckpt.Get( m_rightLaneChangeButton );
+	ckpt.Get( m_reporjectAndResetLaneOffsetButton );
+	ckpt.Get( m_laneChangeUrgency );
+	ckpt.Get( m_laneChangeWaitCount );
+	ckpt.Get( m_laneChangeDurationCount );
+	ckpt.Get( m_lcInhibitCount );
+	ckpt.Get( m_lcStatus );
+	ckpt.Get( m_lcStatusCount );
+	ckpt.Get( m_haveForcedLaneOffset );
+	ckpt.Get( m_forcedLaneOffset );
+	ckpt.Get( m_prevForcedLaneOffset );
+	ckpt.Get( m_forcedLaneOffsetUrgency );
+	ckpt.Get( m_forcedLaneOffsetTurnRate );
+	ckpt.Get( m_forcedOffsetFrameCounter );
+	ckpt.Get( m_forcedOffsetDelay );
+	ckpt.Get( m_forcedOffsetMaxSteerDistance );
+	ckpt.Get( m_forcedOffsetMaxSteerForce );
+	ckpt.Get( m_forcedOffsetTolerance );
+	ckpt.Get( m_forcedOffsetMinLookAhead );
+	ckpt.Get( m_visualStateFromDial );
+	ckpt.Get( m_visualStateFromDialCount );
+	ckpt.Get( m_audioStateFromDial );
+	ckpt.Get( m_audioStateFromDialCount );
+	ckpt.Get( m_hasMoved );
+	ckpt.Get( m_objLength );
+	ckpt.Get( m_objWidth );
+	RestoreMaintainGap( ckpt, m_maintainGap );
+	ckpt.Get( m_isFollowTime );
+	ckpt.Get( m_followMin );
+	ckpt.Get( m_followMax );
+	ckpt.Get( m_followRefreshFrame );
+	ckpt.Get( m_imStopHasValue );
+	ckpt.Get( m_imStopHldOfsDist );
+	ckpt.GetBytes( m_acgoutHcsmText, sizeof( m_acgoutHcsmText ) );
+	int numMergeInfo = 0;
+	ckpt.Get( numMergeInfo );
+	m_mergeInfo.clear();
+	for( int i = 0; i < numMergeInfo && ckpt.IsValid(); i++ )
+	{
+		TMergeInfo info;
+		ckpt.Get( info.pos );
+		ckpt.Get( info.radius );
+		ckpt.Get( info.leadObjId );
+		m_mergeInfo.push_back( info );
+	}
+	ckpt.Get( m_mergeLaneChangeIsNeeded );
+	ckpt.Get( m_mergeTargCrdr, cCved );
+	ckpt.GetPod( m_FollowParams );
+	ckpt.Get( m_FollowInfo.m_OldState );
+	ckpt.Get( m_FollowInfo.m_OldAccel );
+	ckpt.Get( m_FollowInfo.m_Timer );
+	ckpt.Get( m_FollowInfo.m_Counting );
+	ckpt.Get( m_followTtc );
+	ckpt.Get( m_followDist );
+	ckpt.Get( m_followTarget );
+	ckpt.Get( m_lastOvel );
+	ckpt.Get( m_forcedVel );
+	ckpt.Get( m_forcedVelAccel );
+	ckpt.Get( m_forcedVelStart );
+	ckpt.Get( m_forcedVelEnd );
+	ckpt.Get( m_forcedVelMode );
+	ckpt.Get( m_forcedVelChange );
+	ckpt.Get( m_forcedVelFileHandle );
+	ckpt.Get( m_forcedVelFileMultiplier );
+	ckpt.Get( m_DisableLaneDevWhenForcedOffsetDial );
+	RestoreRandLaneDev( ckpt, m_randLaneDev );
+	RestoreRandLaneDev( ckpt, m_lcNeutralizeOffset );
+	ckpt.Get( m_forcedVelExpression );
+	ckpt.Get( m_signalFadeIn );
+	ckpt.Get( m_autoControlBrakeLightState );
+	ckpt.Get( m_autoControlHeadLightsState );
+	ckpt.Get( m_gapStartFrame );
+	ckpt.Get( m_fwdDistThreshold );
+	ckpt.Get( m_backDistThreshold );
+	ckpt.Get( m_fwdTimeThreshold );
+	ckpt.Get( m_backTimeThreshold );
+	ckpt.Get( m_lodLevel );
+	ckpt.Get( m_lodCoastCount );
+	ckpt.Get( m_lodHaveControls );
+	ckpt.Get( m_lodPos );
+	ckpt.Get( m_lodTargPos );
+	ckpt.Get( m_lodHaveAccel );
+	ckpt.Get( m_lodTargAccel );
+	ckpt.Get( m_lodHaveSteer );
+	ckpt.Get( m_lodTargSteer );
+	ckpt.Get( m_lodSteerMax );
+}
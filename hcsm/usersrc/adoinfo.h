@@ -41,7 +41,20 @@ using namespace CVED;
 
 const double cPATH_REFRESH_TIME = 5.0;  // seconds
 const double cDefaultMaxSteerRateRadspS =  2.256; //<The defualt max steering rate used by the dynamics
+
+// Behavior level of detail.  An ADO farther than a band's distance from
+// the own vehicle runs its behaviors once every cADO_LOD_PERIOD[level]
+// frames and coasts on its last controls in between.  Distances behind
+// the driver are scaled up since those vehicles are seen only in the
+// mirrors.  Level 0 is the full rate.
+const int    cADO_LOD_LEVELS = 3;
+const double cADO_LOD_DIST[cADO_LOD_LEVELS] = { 0.0, 1500.0, 4000.0 };  // feet
+const int    cADO_LOD_PERIOD[cADO_LOD_LEVELS] = { 1, 2, 4 };
+const double cADO_LOD_BEHIND_SCALE = 1.5;
+const double cADO_LOD_HYSTERESIS = 200.0;           // feet
+const int    cADO_LOD_NO_DISCRETIONARY_LC = 2;      // level at which discretionary lane changes stop
 class CLaneChangeCond;
+class CHcsmCheckpoint;
 
 // Data structures to facilitate the randomized lane deviation
 
@@ -258,7 +271,11 @@ public:
 	void SetCurrRoadPos( const CRoadPos& );
 	void SyncRoadPosVars();
 
+	void SaveState( CHcsmCheckpoint& ) const;
+	void RestoreState( CHcsmCheckpoint&, const CCved& );
+
 	string      m_objName;
+	string      m_solName;      // SOL the CVED object was created with
 	CDynObj*    m_pObj;
 	cvEObjType  m_objType;
 	long        m_ageFrame;
@@ -393,6 +410,17 @@ public:
 
 	float       m_fwdTimeThreshold;
 	float		m_backTimeThreshold;
+
+	int         m_lodLevel;                 // behavior level of detail
+	int         m_lodCoastCount;            // frames coasted since the last full update
+	bool        m_lodHaveControls;          // the m_lod* controls below are valid
+	CPoint3D    m_lodPos;                   // position when the controls were computed
+	CPoint3D    m_lodTargPos;
+	bool        m_lodHaveAccel;
+	double      m_lodTargAccel;
+	bool        m_lodHaveSteer;
+	double      m_lodTargSteer;
+	double      m_lodSteerMax;
 };
 
 #endif // __CADOINFO_H
@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: adoinfopool.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The implementation of the class CAdoInfoPool.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include "hcsmpch.h"
+#include "adoinfopool.h"
+#include <new>
+
+CAdoInfoPool::CAdoInfoPool()
+{
+	m_infoCount = 0;
+	m_pathCount = 0;
+}
+
+CAdoInfoPool::~CAdoInfoPool()
+{
+	vector<void*>::iterator i;
+	for( i = m_freeInfos.begin(); i != m_freeInfos.end(); i++ )
+	{
+		::operator delete( *i );
+	}
+	for( i = m_freePaths.begin(); i != m_freePaths.end(); i++ )
+	{
+		::operator delete( *i );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Makes sure the pool can hold the specified number of Ados
+//  without allocating.
+//
+// Remarks: Blocks are only ever added; a smaller count than what the pool
+//  already holds is ignored.
+//
+// Arguments:
+//  count - the number of Ados expected to exist at the same time
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CAdoInfoPool::Reserve( int count )
+{
+	Grow( m_freeInfos, sizeof( CAdoInfo ), m_infoCount, count );
+	Grow( m_freePaths, sizeof( CPath ), m_pathCount, count );
+	m_freeLists.reserve( m_infoCount );
+}
+
+void
+CAdoInfoPool::Grow( vector<void*>& freeList, size_t size, int& count, int total )
+{
+	if( count >= total )  return;
+
+	// room for every block so that releasing never allocates
+	freeList.reserve( total );
+	while( count < total )
+	{
+		freeList.push_back( ::operator new( size ) );
+		count++;
+	}
+}
+
+void*
+CAdoInfoPool::GetBlock( vector<void*>& freeList, size_t size, int& count )
+{
+	if( freeList.empty() )
+	{
+		count++;
+		freeList.reserve( count );
+		return ::operator new( size );
+	}
+
+	void* pBlock = freeList.back();
+	freeList.pop_back();
+	return pBlock;
+}
+
+void
+CAdoInfoPool::SwapLists( CAdoInfo& info, TInfoLists& lists )
+{
+	info.m_objsFwd.swap( lists.objsFwd );
+	info.m_objsBack.swap( lists.objsBack );
+	info.m_objsBack2.swap( lists.objsBack2 );
+	info.m_objsApprch.swap( lists.objsApprch );
+	info.m_objsOncom.swap( lists.objsOncom );
+	info.m_mergeInfo.swap( lists.mergeInfo );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Constructs a CAdoInfo, reusing a free block if there is one.
+//
+// Remarks: A new CAdoInfo has empty lists; if a released info left its
+//  emptied lists behind, they are swapped in so their capacity is reused.
+//
+// Arguments:
+//  cRoadPos    - passed on to the CAdoInfo constructor
+//  timeStepDur - passed on to the CAdoInfo constructor
+//  objType     - passed on to the CAdoInfo constructor
+//
+// Returns: A pointer to the new object, to be given back to ReleaseInfo.
+//
+/////////////////////////////////////////////////////////////////////////////
+CAdoInfo*
+CAdoInfoPool::AcquireInfo(
+			const CRoadPos& cRoadPos,
+			double timeStepDur,
+			cvEObjType objType
+			)
+{
+	void* pBlock = GetBlock( m_freeInfos, sizeof( CAdoInfo ), m_infoCount );
+	m_freeLists.reserve( m_infoCount );
+	CAdoInfo* pInfo;
+	try
+	{
+		pInfo = new( pBlock ) CAdoInfo( cRoadPos, timeStepDur, objType );
+	}
+	catch( ... )
+	{
+		m_freeInfos.push_back( pBlock );
+		throw;
+	}
+
+	if( !m_freeLists.empty() )
+	{
+		SwapLists( *pInfo, m_freeLists.back() );
+		m_freeLists.pop_back();
+	}
+	return pInfo;
+}
+
+void
+CAdoInfoPool::ReleaseInfo( CAdoInfo* pInfo )
+{
+	if( !pInfo )  return;
+
+	m_freeLists.push_back( TInfoLists() );
+	TInfoLists& lists = m_freeLists.back();
+	SwapLists( *pInfo, lists );
+	lists.objsFwd.clear();
+	lists.objsBack.clear();
+	lists.objsBack2.clear();
+	lists.objsApprch.clear();
+	lists.objsOncom.clear();
+	lists.mergeInfo.clear();
+
+	pInfo->~CAdoInfo();
+	m_freeInfos.push_back( pInfo );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Constructs an empty CPath, reusing a free block if there
+//  is one.
+//
+// Arguments:
+//  cved - the cved instance the path refers to
+//
+// Returns: A pointer to the new path, to be given back to ReleasePath.
+//
+/////////////////////////////////////////////////////////////////////////////
+CPath*
+CAdoInfoPool::AcquirePath( CCved& cved )
+{
+	void* pBlock = GetBlock( m_freePaths, sizeof( CPath ), m_pathCount );
+	try
+	{
+		return new( pBlock ) CPath( cved );
+	}
+	catch( ... )
+	{
+		m_freePaths.push_back( pBlock );
+		throw;
+	}
+}
+
+void
+CAdoInfoPool::ReleasePath( CPath* pPath )
+{
+	if( !pPath )  return;
+
+	pPath->~CPath();
+	m_freePaths.push_back( pPath );
+}
@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: adoinfopool.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The definition of the class CAdoInfoPool, which recycles
+//              the storage of the per-Ado CAdoInfo and CPath objects
+//              and of the object lists inside CAdoInfo.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _ADOINFOPOOL_H_
+#define _ADOINFOPOOL_H_
+
+#include "adoinfo.h"
+#include <vector>
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Ados are created and deleted in bursts by traffic sources and the
+// traffic manager.  Instead of going to the heap for every CAdoInfo and
+// CPath, the blocks of deleted Ados are kept here and the next Ado is
+// constructed in place in one of them.  Objects are always fully
+// constructed and destroyed, so a recycled object starts out exactly
+// like a new one.
+//
+// The object lists and merge list of a CAdoInfo grow every frame while
+// the Ado runs.  When the info is released they are emptied and kept,
+// and the next info takes them over in place of its own empty ones, so
+// it starts with buffers the size the previous Ado needed.
+//
+// Reserve pre-allocates blocks when the number of Ados is known ahead of
+// time, e.g. when the traffic manager reads its maximum object count.
+//
+// Each collection owns one pool, reached through
+// CHcsmCollection::GetAdoInfoPool.
+//
+class CAdoInfoPool
+{
+public:
+	CAdoInfoPool();
+	~CAdoInfoPool();
+
+	void      Reserve( int count );
+	CAdoInfo* AcquireInfo( const CRoadPos&, double timeStepDur, cvEObjType );
+	void      ReleaseInfo( CAdoInfo* );
+	CPath*    AcquirePath( CCved& );
+	void      ReleasePath( CPath* );
+
+private:
+	CAdoInfoPool( const CAdoInfoPool& );
+	CAdoInfoPool& operator=( const CAdoInfoPool& );
+
+	struct TInfoLists {
+		vector<CCved::TObjListInfo> objsFwd;
+		vector<CCved::TObjListInfo> objsBack;
+		vector<CCved::TObjListInfo> objsBack2;
+		vector<CCved::TObjListInfo> objsApprch;
+		vector<CCved::TObjListInfo> objsOncom;
+		vector<TMergeInfo>          mergeInfo;
+	};
+
+	static void* GetBlock( vector<void*>& freeList, size_t size, int& count );
+	static void  Grow( vector<void*>& freeList, size_t size, int& count, int total );
+	static void  SwapLists( CAdoInfo& info, TInfoLists& lists );
+
+	vector<void*>       m_freeInfos;
+	vector<void*>       m_freePaths;
+	vector<TInfoLists>  m_freeLists;		// emptied lists of released infos
+	int                 m_infoCount;	// blocks allocated, in use or free
+	int                 m_pathCount;
+};
+
+#endif // _ADOINFOPOOL_H_
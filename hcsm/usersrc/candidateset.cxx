@@ -576,8 +576,7 @@ CCandidateSet::GetCandidates(const CVED::CCved& cved,
 
 	if (m_useRel) 
 	{
-		static vector<CCandidate> curSetCand;
-		curSetCand.clear();
+		vector<CCandidate> curSetCand;
 		// Get the location of the object we're looking relative to.
 		CVED::CRoadPos relObjPos(cved);
 		CPoint3D relObjPt;
@@ -634,8 +633,7 @@ CCandidateSet::GetCandidates(const CVED::CCved& cved,
 #endif
 
 				optPos.Travel( iter->m_yIdeal );
-				static bitset<cCV_MAX_CRDRS> laneMask;
-				laneMask.reset();
+				bitset<cCV_MAX_CRDRS> laneMask;
 				int targetObjLane = 0;
                 if (relObjPos.IsRoad()){
                     targetObjLane = relObjPos.GetLane().GetRelativeId();
@@ -662,8 +660,7 @@ CCandidateSet::GetCandidates(const CVED::CCved& cved,
 				gout << "Path is " << path << endl;
 #endif
 				
-				static vector<int> objIds;
-				objIds.clear();
+				vector<int> objIds;
 				path.GetObjectsOnPath( objIds );
 				{
 					// check if relative dial is set to
@@ -753,8 +750,7 @@ CCandidateSet::GetCandidates(const CVED::CCved& cved,
 					// keep the N object in objIds that are closest to Y (distance along lane)
 					while ((objIds.size() > 0) && (objIds.size() > numNeeded)) 
 					{
-						static vector<double> distAway;
-						distAway.clear();
+						vector<double> distAway;
 						for (vector<int>::iterator i = objIds.begin(); i != objIds.end(); i++) 
 						{
 							CPoint3D pos = cved.GetObjPos( *i );
@@ -17,6 +17,7 @@
 #include "genhcsm.h"
 #include "clg.h"
 #include "cvedpub.h"
+#include "hcsmcheckpoint.h"
 
 /* borrowed from cved/libsrc/ */
 eCVTrafficLightState cvStringToTrafficLightState(const char *pStr);
@@ -394,6 +395,35 @@ CClg::Execute(double currTimeInSecs, double timeStep, CVED::CCved& cved)
 	}
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: compute when Execute will next move to another pattern
+//
+// Remarks: The result is exact as long as no dial is active and nothing
+//  calls SetCycleStartTime or SetTargetStateAndFactor in the meantime;
+//  while a dial is active Execute also has to watch for the dial's
+//  target state and should be called every frame.
+//
+// Arguments: 
+//
+// Returns: the time, in seconds, at which the next transition is due,
+//  or -1 if the group never transitions
+//
+/////////////////////////////////////////////////////////////////////////////
+double
+CClg::NextTransitionTime() const
+{
+	if( !m_active || m_numOfPatterns == 0 )  return -1.0;
+
+	double offset = m_accumDuration[m_curIdx];
+	if( m_dialActive && m_factor > 0.0 )
+	{
+		offset /= m_factor;
+	}
+
+	return m_cycleStartTime + offset;
+}
+
 void
 CClg::DumpStates(int nth, CVED::CCved& cved, double t)
 {
@@ -418,6 +448,55 @@ CClg::DumpStates(int nth, CVED::CCved& cved, double t)
 	gout<<"\t\ttime : "<<t;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves or restores the position of the group in its cycle
+//              and the state of any dial in effect.
+//
+// Remarks: The table itself comes from the scenario and is rebuilt when
+//		the traffic light manager is created, so it is not saved.  The
+//		restored group has to have the same number of patterns as the
+//		saved one.
+//
+// Arguments: ckpt is the checkpoint.
+//
+// Returns:
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CClg::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+	ckpt.Put( m_active );
+	ckpt.Put( m_curIdx );
+	ckpt.Put( m_cycleStartTime );
+	ckpt.Put( m_factor );
+	ckpt.Put( m_dialTargState );
+	ckpt.Put( m_dialActive );
+	ckpt.Put( m_dialLight );
+	ckpt.Put( m_dialStartTime );
+	ckpt.Put( m_count );
+}
+
+void
+CClg::RestoreState( CHcsmCheckpoint& ckpt )
+{
+	ckpt.Get( m_active );
+	ckpt.Get( m_curIdx );
+	ckpt.Get( m_cycleStartTime );
+	ckpt.Get( m_factor );
+	ckpt.Get( m_dialTargState );
+	ckpt.Get( m_dialActive );
+	ckpt.Get( m_dialLight );
+	ckpt.Get( m_dialStartTime );
+	ckpt.Get( m_count );
+
+	if( m_curIdx < 0 || ( m_numOfPatterns > 0 && m_curIdx >= m_numOfPatterns ) )
+	{
+		ckpt.SetError( "light group " + m_intrsctnName + " has no such pattern" );
+		m_curIdx = 0;
+	}
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Description: get the current status of each traffic light and store them
@@ -20,6 +20,7 @@
 
 #include <cvedpub.h>
 
+class CHcsmCheckpoint;
 
 class CClg {
 public:
@@ -35,6 +36,8 @@ public:
 
 
 	bool IsActive() const { return m_active; }
+	bool IsDialActive() const { return m_dialActive; }
+	double NextTransitionTime() const;
 	void GetState(vector<eCVTrafficLightState>&) const;
 	void Execute(double time, double timeStep, CVED::CCved&);
 	void MakeStringUpper(string& s);
@@ -54,6 +57,9 @@ public:
 			m_cycleStartTime = currTimeInSecs - m_accumDuration[m_curIdx - 1];
 	};
 
+	void SaveState( CHcsmCheckpoint& ) const;
+	void RestoreState( CHcsmCheckpoint& );
+
 private:
 	void SendTrafficLights( CCved& cved );
 
@@ -122,7 +122,7 @@ CCreateHcsmActn::Execute( const set<CCandidate>* )
 	CSnoBlock::cTChildIterator i;
 	CHcsm *pHcsm;
 
-	CHcsmCollection::SetActionCreateLog( m_triggerId );
+	m_pHC->SetActionCreateLog( m_triggerId );
 
 	for( 
 		i = m_pActionBlock->BeginChild(); 
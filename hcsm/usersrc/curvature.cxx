@@ -16,6 +16,7 @@
 
 #include "curvature.h"
 #include "util.h"
+#include "hcsmcheckpoint.h"
 
 #undef DEBUG_REFRESH_CURVATURE
 
@@ -1122,3 +1123,128 @@ CCurvature::DebugBuckets()
 	}
 
 }  // end of DebugBuckets
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Saves the curvature samples and buckets in a checkpoint.
+//
+// Remarks: The data is read back by RestoreState.
+//
+// Arguments:
+//   ckpt - The checkpoint.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCurvature::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+
+	ckpt.Put( m_cvedId );
+	ckpt.Put( m_startRoadPos );
+	ckpt.Put( m_path );
+	ckpt.Put( m_latAccelms2 );
+
+	ckpt.Put( (int) m_curvature.size() );
+	deque<TCurvature>::const_iterator i;
+	for ( i = m_curvature.begin(); i != m_curvature.end(); i++ ) {
+
+		ckpt.Put( i->curvature );
+		ckpt.Put( i->roadPos );
+		ckpt.Put( i->dist );
+
+	}
+
+	ckpt.Put( (int) m_limits.size() );
+	vector<TCurvLimit>::const_iterator j;
+	for ( j = m_limits.begin(); j != m_limits.end(); j++ ) {
+
+		ckpt.PutPod( *j );
+
+	}
+
+	ckpt.Put( (int) m_buckets.size() );
+	vector<TBucket>::const_iterator k;
+	for ( k = m_buckets.begin(); k != m_buckets.end(); k++ ) {
+
+		ckpt.Put( k->code );
+		ckpt.Put( k->lowCurv );
+		ckpt.Put( k->roadPos );
+		ckpt.Put( k->distToLowCurv );
+		ckpt.Put( k->curvVel );
+		ckpt.Put( k->curvAccel );
+
+	}
+
+	ckpt.Put( m_bucketRoadPos );
+
+}  // end of SaveState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Restores the curvature samples and buckets from a 
+//   checkpoint.
+//
+// Remarks: 
+//
+// Arguments:
+//   ckpt  - The checkpoint.
+//   cCved - The CVED instance the road positions refer to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCurvature::RestoreState( CHcsmCheckpoint& ckpt, const CCved& cCved )
+{
+
+	int size = 0;
+	int i;
+
+	ckpt.Get( m_cvedId );
+	ckpt.Get( m_startRoadPos, cCved );
+	ckpt.Get( m_path, cCved );
+	ckpt.Get( m_latAccelms2 );
+
+	m_curvature.clear();
+	ckpt.Get( size );
+	for ( i = 0; i < size && ckpt.IsValid(); i++ ) {
+
+		TCurvature elem;
+		ckpt.Get( elem.curvature );
+		ckpt.Get( elem.roadPos, cCved );
+		ckpt.Get( elem.dist );
+		m_curvature.push_back( elem );
+
+	}
+
+	m_limits.clear();
+	ckpt.Get( size );
+	for ( i = 0; i < size && ckpt.IsValid(); i++ ) {
+
+		TCurvLimit elem;
+		ckpt.GetPod( elem );
+		m_limits.push_back( elem );
+
+	}
+
+	m_buckets.clear();
+	ckpt.Get( size );
+	for ( i = 0; i < size && ckpt.IsValid(); i++ ) {
+
+		TBucket elem;
+		ckpt.Get( elem.code );
+		ckpt.Get( elem.lowCurv );
+		ckpt.Get( elem.roadPos, cCved );
+		ckpt.Get( elem.distToLowCurv );
+		ckpt.Get( elem.curvVel );
+		ckpt.Get( elem.curvAccel );
+		m_buckets.push_back( elem );
+
+	}
+
+	ckpt.Get( m_bucketRoadPos, cCved );
+
+}  // end of RestoreState
@@ -35,6 +35,8 @@ using namespace std;
 #include <cvedpub.h>
 using namespace CVED;
 
+class CHcsmCheckpoint;
+
 
 typedef struct TCurvature 
 {
@@ -96,6 +98,9 @@ public:
 	void   DebugCurvature();
 	void   DebugBuckets();
 
+	void   SaveState( CHcsmCheckpoint& ) const;
+	void   RestoreState( CHcsmCheckpoint&, const CCved& );
+
 private:
 	void   InitializeLimits();
 	int    FindCode( const double& );
@@ -15,33 +15,48 @@
  ****************************************************************************/
 
 #include "hcsmpch.h"
-#include <fstream>
-#include "fastdeque.h"
 
 using namespace CVED;
 
 // Debugging macros
 #undef DEBUG_DAQ_DRIVER
 
+//
+// Computes the tangent and lateral vectors of the driver from its roll,
+// pitch and yaw.
+//
+static void
+DaqOriToTanLat( const CVector3D& ori, CVector3D& tan, CVector3D& lat )
+{
+	double roll  = ori.m_i;
+	double pitch = ori.m_j;
+	double yaw   = ori.m_k;
+
+	tan.m_i = cos(yaw) * cos(pitch);
+	tan.m_j = -sin(yaw) * cos(roll) - cos(yaw) * sin(pitch) * sin(roll);
+	tan.m_k = sin(yaw) * sin(roll) - cos(yaw) * sin(pitch) * cos(roll);
+
+	lat.m_i = sin(yaw) * cos(pitch);
+	lat.m_j = cos(yaw) * cos(roll) - sin(yaw) * sin(pitch) * sin(roll);
+	lat.m_k = -cos(yaw) * sin(roll) - sin(yaw) * sin(pitch) * cos(roll);
+}
+
 void 
 CDaqDriver::UserCreation( const CDaqDriverParseBlock* cpSnoBlock )
 {
 	m_dataFreq = cpSnoBlock->GetFreq();
 	double behavFreq = 1 / GetTimeStepDuration();
 	m_executionMultiplier = m_dataFreq / behavFreq;
+	m_traceIdx = 0.0;
 
 	PrintCreationMessage();
 	gout << "--- DaqDriver is running at " << m_dataFreq;
 	gout << "Hz  multipler = " << m_executionMultiplier << " ---" << endl;
 
-	if( m_executionMultiplier - ((int) m_executionMultiplier) > 0.01 )
-	{
-		gout << MessagePrefix();
-		gout << "** DaqDriver doesn't handle non-whole multiplers **" << endl;
-	}
-
 	//
-	// Reading the DaqData file name and frequency.
+	// Reading the DaqData file names.  The position file may instead be
+	// a binary trace made by CDaqTrace::Convert, in which case the
+	// orientation file is not used.
 	//
 	const string drvrPosFileName = cpSnoBlock->GetDriverPosFileName();
 	const string drvrOriFileName = cpSnoBlock->GetDriverOriFileName();
@@ -49,12 +64,11 @@ CDaqDriver::UserCreation( const CDaqDriverParseBlock* cpSnoBlock )
 	//
 	// Get the path to the data directory.
 	//
-	char pDaqPosFilePath[1024];
-	char pDaqOriFilePath[1024];
-	if( getenv( "NADSSDC_SCN" ) ) 
+	string dataDir;
+	const char* pScnDir = getenv( "NADSSDC_SCN" );
+	if( pScnDir ) 
 	{
-		strncpy( pDaqPosFilePath, getenv( "NADSSDC_SCN" ),1024);
-		strncpy( pDaqOriFilePath, getenv( "NADSSDC_SCN" ),2014);
+		dataDir = pScnDir;
 	}
 	else
 	{
@@ -62,76 +76,19 @@ CDaqDriver::UserCreation( const CDaqDriverParseBlock* cpSnoBlock )
 		cerr << "variable 'NADSSDC_SCN'" << endl;
 	}
 	
-	strcat( pDaqPosFilePath, drvrPosFileName.c_str() );
-	strcat( pDaqOriFilePath, drvrOriFileName.c_str() );
-
 	//
-	// Opening the Daq data files.
-	//
-	ifstream daqPosFile, daqOriFile;
-	daqPosFile.open( pDaqPosFilePath );
-	daqOriFile.open( pDaqOriFilePath );
-
+	// Open the trace; a binary trace is mapped, so this is quick no
+	// matter how long the recording is.
 	//
-	// Make sure that the files opened properly.
-	//
-	bool fileOpenError = !daqPosFile || !daqOriFile;
-	if( fileOpenError )
+	if( !m_trace.Open( dataDir + drvrPosFileName, dataDir + drvrOriFileName ) )
 	{
-		cerr << MessagePrefix() << "unable to open '";
-
-		if( !daqPosFile ) 
-		{
-			cerr << pDaqPosFilePath << "'" << endl;
-		}
-		else if( !daqOriFile) {
-			cerr << pDaqOriFilePath << "'" << endl;
-		}
+		cerr << MessagePrefix() << "unable to load driver trace '";
+		cerr << dataDir + drvrPosFileName << "'" << endl;
 
 		Suicide();
 		return;
 	}
 
-	// DaqData structure
-	TDaqData daqData;
-	CPoint3D drvObjPos;
-	CVector3D drvObjOri; // roll.i + pitch.j + yaw.k
-	double drvFrame;
-	char ignore;
-	char ignorePosLine[1024];
-	char ignoreOriLine[1024];
-	
-		
-	// 
-	// Reading values from the Daq Data files into daqData structure
-	// and storing them into the fastdeque container.
-	//
-	while( daqPosFile && daqOriFile )
-	{
-		if( daqPosFile.get() == '#' && daqOriFile.get() == '#' )
-		{
-			// comment...ignore
-			daqPosFile.getline( ignorePosLine, 1024 );
-			daqOriFile.getline( ignoreOriLine, 1024 );
-
-			continue;
-		}
-		else
-		{
-			daqPosFile >> drvFrame >> drvObjPos.m_y >> drvObjPos.m_x >> drvObjPos.m_z;
-			daqOriFile >> drvFrame >> drvObjOri.m_j >> drvObjOri.m_i >> drvObjOri.m_k;
-
-			// set the values in the daqData structure
-			daqData.objPosition = drvObjPos; 
-			daqData.objOrientation = drvObjOri;
-			daqData.signal = 0; 
-			daqData.brake = 0;
-			
-			// push the value into Deque
-			m_DaqDataContainer.push_back(daqData);
-		}
-	}
-
 	cved->SetFakeExternalDriver( false );
 	
 	//
@@ -145,25 +102,14 @@ CDaqDriver::UserCreation( const CDaqDriverParseBlock* cpSnoBlock )
 	}
 	
 	// Initial cart position
-	TDaqData startData = m_DaqDataContainer[m_DaqDataContainer.begin()];
-	CPoint3D cartPos = startData.objPosition;
-	CVector3D cartOri = startData.objOrientation;
+	CPoint3D cartPos;
+	CVector3D cartOri;
+	m_trace.GetSample( 0.0, cartPos, cartOri );
 
 	// Calculating the Tangent and Lateral vectors for the object
-	// using values from the DaqDataC Container
-	double roll  = cartOri.m_i;
-	double pitch = cartOri.m_j;
-	double yaw   = cartOri.m_k;
-
 	CVector3D initTan; 
-	initTan.m_i = cos(yaw) * cos(pitch);
-    initTan.m_j = -sin(yaw) * cos(roll) - cos(yaw) * sin(pitch) * sin(roll);
-    initTan.m_k = sin(yaw) * sin(roll) - cos(yaw) * sin(pitch) * cos(roll);
-
 	CVector3D initLat;
-	initLat.m_i= sin(yaw) * cos(pitch);
-    initLat.m_j = cos(yaw) * cos(roll) - sin(yaw) * sin(pitch) * sin(roll);
-    initLat.m_k = -cos(yaw) * sin(roll) - sin(yaw) * sin(pitch) * cos(roll);
+	DaqOriToTanLat( cartOri, initTan, initLat );
 
 	// 
 	// Set attributes and crate a CVED object to represent the driver.
@@ -223,42 +169,17 @@ CDaqDriver::UserPreActivity( const CDaqDriverParseBlock* cpSnoBlock )
 
 
 void
-CDaqDriver::ProcessOneDaqFrame()
+CDaqDriver::SetDriverState( const CPoint3D& pos, const CVector3D& ori )
 {
-	if( m_DaqDataContainer.size() > 1 )
-	{
-		m_DaqDataContainer.pop_front();
-		TDaqData nextData = m_DaqDataContainer[ m_DaqDataContainer.begin() ];
-		CPoint3D currPos = nextData.objPosition;
-		CVector3D currOri = nextData.objOrientation;
-		
-		// Calculating the Tangent and Lateral vectors for the object
-		// using values from the DaqData Container
-		double roll = currOri.m_i;
-		double pitch =  currOri.m_j;
-		double yaw =  currOri.m_k;
-
-		CVector3D currTan; 
-		currTan.m_i = cos(yaw) * cos(pitch);
-		currTan.m_j = -sin(yaw) * cos(roll) - cos(yaw) * sin(pitch) * sin(roll);
-		currTan.m_k = sin(yaw) * sin(roll) - cos(yaw) * sin(pitch) * cos(roll);
-
-		CVector3D currLat;
-		currLat.m_i= sin(yaw) * cos(pitch);
-		currLat.m_j = cos(yaw) * cos(roll) - sin(yaw) * sin(pitch) * sin(roll);
-		currLat.m_k = -cos(yaw) * sin(roll) - sin(yaw) * sin(pitch) * cos(roll);
-
-
-		CExternalDriverObj* pExternalDriverObj = dynamic_cast<CExternalDriverObj *>(m_pObj);
-		// Setting the position, tan and lat vectors
-		pExternalDriverObj->SetPos( currPos );
-		pExternalDriverObj->SetTan( currTan );
-		pExternalDriverObj->SetLat( currLat );
-	}
-	else
-	{
-		Suicide();
-	}
+	CVector3D currTan; 
+	CVector3D currLat;
+	DaqOriToTanLat( ori, currTan, currLat );
+
+	CExternalDriverObj* pExternalDriverObj = dynamic_cast<CExternalDriverObj *>(m_pObj);
+	// Setting the position, tan and lat vectors
+	pExternalDriverObj->SetPos( pos );
+	pExternalDriverObj->SetTan( currTan );
+	pExternalDriverObj->SetLat( currLat );
 }
 
 
@@ -266,28 +187,22 @@ void
 CDaqDriver::UserPostActivity( const CDaqDriverParseBlock* cpSnoBlock )
 {
 	//
-	// Execute n frames of daq data.
+	// Advance through the trace by the number of daq samples per frame;
+	// when that isn't a whole number the driver is placed between the
+	// two nearest samples.
 	//
-	bool executeMoreThanOncePerFrame = m_executionMultiplier > 1;
-	if( executeMoreThanOncePerFrame )
-	{
-		int executeCount = (int) m_executionMultiplier;
-		int i;
-		for( i = 0; i < executeCount; i++ )
-		{
-			ProcessOneDaqFrame();
-		}
-	}
-	else
+	m_traceIdx += m_executionMultiplier;
+	if( m_traceIdx > m_trace.NumSamples() - 1 )
 	{
-		m_framesSinceLastExecution++;
-		if( m_framesSinceLastExecution >= 1 / m_executionMultiplier )
-		{
-			ProcessOneDaqFrame();
-			m_framesSinceLastExecution = 0;
-		}
+		Suicide();
+		return;
 	}
 
+	CPoint3D currPos;
+	CVector3D currOri;
+	m_trace.GetSample( m_traceIdx, currPos, currOri );
+	SetDriverState( currPos, currOri );
+
 #ifdef DEBUG_DAQ_DRIVER
 	gout << MessagePrefix();
 	gout << "=== DAQ DRIVER - POST_ACTIVITY =================" << endl;
@@ -316,4 +231,6 @@ void CDaqDriver::UserDeletion( const CDaqDriverParseBlock* cpSnoBlock )
 	}
 	cved->SetFakeExternalDriver( true );
 
+	m_trace.Close();
+
 }  // end of UserDeletion
@@ -0,0 +1,583 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: daqtrace.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  Contains the implementation for the CDaqTrace class.
+ *
+ ****************************************************************************/
+
+#include "daqtrace.h"
+
+#include <pi_iostream>
+#include <pi_fstream>
+#include <algorithm>
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads a whole file into a string.
+//
+// Returns:  A boolean indicating if the file could be read.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+ReadWholeFile( const string& fileName, string& contents )
+{
+
+	ifstream inFile( fileName.c_str(), ios::in | ios::binary );
+	if ( inFile.fail() )  return false;
+
+	inFile.seekg( 0, ios::end );
+	streamoff size = inFile.tellg();
+	inFile.seekg( 0, ios::beg );
+	if ( size < 0 )  return false;
+
+	contents.resize( (size_t) size );
+	if ( size > 0 )  inFile.read( &contents[0], size );
+
+	return !inFile.bad();
+
+}  // ReadWholeFile
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Parses the data lines of a DAQ text file.
+//
+// Remarks:  Each data line holds a frame number followed by three values.
+//   Blank lines and lines that start with '#' are skipped.
+//
+// Arguments:
+//   fileName - The file's name, for messages.
+//   contents - The contents of the file.
+//   rows - (output) Four values per data line.
+//   err - Where to print the problems found.
+//
+// Returns:  A boolean indicating if all the data lines were valid.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+ParseDaqText(
+			const string& fileName,
+			const string& contents,
+			vector<double>& rows,
+			ostream& err
+			)
+{
+
+	const char* pCurr = contents.c_str();
+	int line = 0;
+
+	while ( *pCurr != '\0' ) {
+
+		line++;
+		const char* pEol = pCurr;
+		while ( *pEol != '\0' && *pEol != '\n' )  pEol++;
+
+		const char* p = pCurr;
+		while ( p < pEol && isspace( (unsigned char) *p ) )  p++;
+
+		if ( p < pEol && *p != '#' ) {
+
+			for ( int v = 0; v < 4; v++ ) {
+
+				char* pEnd;
+				double value = strtod( p, &pEnd );
+				if ( pEnd == p || pEnd > pEol ) {
+
+					err << "DaqTrace: expected 4 values at line " << line;
+					err << " of '" << fileName << "'" << endl;
+
+					return false;
+
+				}
+
+				rows.push_back( value );
+				p = pEnd;
+
+			}
+
+		}
+
+		pCurr = *pEol == '\0' ? pEol : pEol + 1;
+
+	}
+
+	return true;
+
+}  // ParseDaqText
+
+
+CDaqTrace::CDaqTrace()
+	: m_pSamples( 0 )
+	, m_numSamples( 0 )
+	, m_pMapping( 0 )
+	, m_mapSize( 0 )
+#ifdef _WIN32
+	, m_hFile( INVALID_HANDLE_VALUE )
+	, m_hMap( 0 )
+#endif
+{
+
+}
+
+CDaqTrace::~CDaqTrace()
+{
+
+	Close();
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Opens a driver trace.
+//
+// Remarks:  If the position file is a binary trace it is mapped and the
+//   orientation file is not used; otherwise the two are parsed as a pair
+//   of DAQ text files.
+//
+// Arguments:
+//   posFileName - The binary trace, or the DAQ position file.
+//   oriFileName - The DAQ orientation file.
+//
+// Returns:  A boolean indicating if the trace was opened and has at least
+//   one sample.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CDaqTrace::Open( const string& posFileName, const string& oriFileName )
+{
+
+	Close();
+
+	if ( IsBinary( posFileName ) ) {
+
+		if ( !OpenBinary( posFileName, cerr ) )  return false;
+
+	}
+	else {
+
+		if ( !ParseText( posFileName, oriFileName, m_parsed, cerr ) ) {
+
+			return false;
+
+		}
+
+		m_pSamples   = m_parsed.empty() ? 0 : &m_parsed[0];
+		m_numSamples = (int) m_parsed.size();
+
+	}
+
+	if ( m_numSamples <= 0 ) {
+
+		cerr << "DaqTrace: '" << posFileName << "' has no samples" << endl;
+		Close();
+
+		return false;
+
+	}
+
+	return true;
+
+}  // Open
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Releases the samples and any mapping.
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CDaqTrace::Close()
+{
+
+#ifdef _WIN32
+	if ( m_pMapping )  UnmapViewOfFile( m_pMapping );
+	if ( m_hMap )  CloseHandle( (HANDLE) m_hMap );
+	if ( m_hFile != INVALID_HANDLE_VALUE )  CloseHandle( (HANDLE) m_hFile );
+	m_hMap  = 0;
+	m_hFile = INVALID_HANDLE_VALUE;
+#else
+	if ( m_pMapping )  munmap( m_pMapping, m_mapSize );
+#endif
+	m_pMapping = 0;
+	m_mapSize  = 0;
+
+	vector<TDaqTraceSample>().swap( m_parsed );
+	m_pSamples   = 0;
+	m_numSamples = 0;
+
+}  // Close
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the driver's state at a fractional sample.
+//
+// Remarks:  The position and the angles are interpolated linearly between
+//   the two neighboring samples, so a trace can be played back at any rate.
+//   Angles take the short way around.  Indices outside the trace are
+//   clamped to its ends.
+//
+// Arguments:
+//   idx - The sample index.
+//   pos - (output) The position.
+//   ori - (output) The roll (i), pitch (j) and yaw (k).
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CDaqTrace::GetSample( double idx, CPoint3D& pos, CVector3D& ori ) const
+{
+
+	if ( idx < 0.0 )  idx = 0.0;
+	int i0 = (int) idx;
+	if ( i0 >= m_numSamples - 1 ) {
+
+		i0  = m_numSamples - 1;
+		idx = i0;
+
+	}
+	int    i1 = i0 + 1 < m_numSamples ? i0 + 1 : i0;
+	double t  = idx - i0;
+
+	const TDaqTraceSample& s0 = m_pSamples[i0];
+	const TDaqTraceSample& s1 = m_pSamples[i1];
+
+	double p[3], o[3];
+	for ( int k = 0; k < 3; k++ ) {
+
+		p[k] = s0.pos[k] + t * ( s1.pos[k] - s0.pos[k] );
+
+		double diff = s1.ori[k] - s0.ori[k];
+		if ( diff > M_PI )  diff -= 2.0 * M_PI;
+		else if ( diff < -M_PI )  diff += 2.0 * M_PI;
+		o[k] = s0.ori[k] + t * diff;
+
+	}
+
+	pos.m_x = p[0];
+	pos.m_y = p[1];
+	pos.m_z = p[2];
+	ori.m_i = o[0];
+	ori.m_j = o[1];
+	ori.m_k = o[2];
+
+}  // GetSample
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Finds the sample of a DAQ frame.
+//
+// Remarks:  The samples are assumed to be in increasing frame order, as
+//   recorded.
+//
+// Arguments:
+//   frame - The DAQ frame number.
+//
+// Returns:  The index of the first sample at or after the frame, or -1 if
+//   the trace ends before it.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CDaqTrace::FindFrame( double frame ) const
+{
+
+	int lo = 0;
+	int hi = m_numSamples;
+	while ( lo < hi ) {
+
+		int mid = lo + ( hi - lo ) / 2;
+		if ( m_pSamples[mid].frame < frame )
+			lo = mid + 1;
+		else
+			hi = mid;
+
+	}
+
+	return lo < m_numSamples ? lo : -1;
+
+}  // FindFrame
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Checks if a file is a binary trace.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CDaqTrace::IsBinary( const string& fileName )
+{
+
+	FILE* pFile = fopen( fileName.c_str(), "rb" );
+	if ( !pFile )  return false;
+
+	TDaqTraceHeader header;
+	bool isBinary = fread( &header, sizeof( header ), 1, pFile ) == 1 &&
+					header.magic == DAQ_TRACE_MAGIC;
+	fclose( pFile );
+
+	return isBinary;
+
+}  // IsBinary
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Converts a pair of DAQ text files to a binary trace.
+//
+// Arguments:
+//   posFileName - The DAQ position file.
+//   oriFileName - The DAQ orientation file.
+//   outFileName - The binary trace to write.
+//   err - Where to print the problems found.
+//
+// Returns:  A boolean indicating if the trace was written.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CDaqTrace::Convert(
+			const string& posFileName,
+			const string& oriFileName,
+			const string& outFileName,
+			ostream& err
+			)
+{
+
+	vector<TDaqTraceSample> samples;
+	if ( !ParseText( posFileName, oriFileName, samples, err ) )  return false;
+
+	FILE* pFile = fopen( outFileName.c_str(), "wb" );
+	if ( !pFile ) {
+
+		err << "DaqTrace: unable to create '" << outFileName << "'" << endl;
+		return false;
+
+	}
+
+	TDaqTraceHeader header;
+	header.magic      = DAQ_TRACE_MAGIC;
+	header.version    = DAQ_TRACE_VERSION;
+	header.numSamples = (int) samples.size();
+	header.reserved   = 0;
+
+	bool ok = fwrite( &header, sizeof( header ), 1, pFile ) == 1;
+	if ( ok && !samples.empty() ) {
+
+		ok = fwrite(
+				&samples[0],
+				sizeof( TDaqTraceSample ),
+				samples.size(),
+				pFile
+				) == samples.size();
+
+	}
+	ok = fclose( pFile ) == 0 && ok;
+
+	if ( !ok ) {
+
+		err << "DaqTrace: error writing '" << outFileName << "'" << endl;
+		remove( outFileName.c_str() );
+
+	}
+
+	return ok;
+
+}  // Convert
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Maps a binary trace.
+//
+// Returns:  A boolean indicating if the file was mapped and its size
+//   matches its header.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CDaqTrace::OpenBinary( const string& fileName, ostream& err )
+{
+
+#ifdef _WIN32
+	HANDLE hFile = CreateFileA(
+				fileName.c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ,
+				0,
+				OPEN_EXISTING,
+				FILE_FLAG_RANDOM_ACCESS,
+				0
+				);
+	if ( hFile == INVALID_HANDLE_VALUE ) {
+
+		err << "DaqTrace: unable to open '" << fileName << "'" << endl;
+		return false;
+
+	}
+	m_hFile = hFile;
+
+	LARGE_INTEGER size;
+	if ( !GetFileSizeEx( hFile, &size ) || size.QuadPart <= 0 ) {
+
+		err << "DaqTrace: unable to map '" << fileName << "'" << endl;
+		Close();
+		return false;
+
+	}
+	m_mapSize = (size_t) size.QuadPart;
+
+	HANDLE hMap = CreateFileMappingA( hFile, 0, PAGE_READONLY, 0, 0, 0 );
+	if ( hMap )  m_hMap = hMap;
+	m_pMapping = hMap ? MapViewOfFile( hMap, FILE_MAP_READ, 0, 0, 0 ) : 0;
+#else
+	int fd = open( fileName.c_str(), O_RDONLY );
+	if ( fd < 0 ) {
+
+		err << "DaqTrace: unable to open '" << fileName << "'" << endl;
+		return false;
+
+	}
+
+	struct stat st;
+	if ( fstat( fd, &st ) == 0 && st.st_size > 0 ) {
+
+		m_mapSize = (size_t) st.st_size;
+		void* pMap = mmap( 0, m_mapSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+		m_pMapping = pMap == MAP_FAILED ? 0 : pMap;
+
+	}
+	close( fd );
+#endif
+
+	if ( !m_pMapping ) {
+
+		err << "DaqTrace: unable to map '" << fileName << "'" << endl;
+		Close();
+		return false;
+
+	}
+
+	const TDaqTraceHeader* pHeader = (const TDaqTraceHeader*) m_pMapping;
+	bool valid =
+		m_mapSize >= sizeof( TDaqTraceHeader ) &&
+		pHeader->magic == DAQ_TRACE_MAGIC &&
+		pHeader->version == DAQ_TRACE_VERSION &&
+		pHeader->numSamples >= 0 &&
+		m_mapSize == sizeof( TDaqTraceHeader ) +
+					 (size_t) pHeader->numSamples * sizeof( TDaqTraceSample );
+	if ( !valid ) {
+
+		err << "DaqTrace: '" << fileName << "' is not a valid trace" << endl;
+		Close();
+		return false;
+
+	}
+
+	m_pSamples   = (const TDaqTraceSample*) ( pHeader + 1 );
+	m_numSamples = pHeader->numSamples;
+
+	return true;
+
+}  // OpenBinary
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Parses a pair of DAQ text files into samples.
+//
+// Remarks:  The position file lists frame, y, x, z and the orientation
+//   file lists frame, pitch, roll, yaw.  The n-th data lines of the two
+//   files make the n-th sample; extra lines in the longer file are
+//   ignored.
+//
+// Arguments:
+//   posFileName - The DAQ position file.
+//   oriFileName - The DAQ orientation file.
+//   samples - (output) The samples.
+//   err - Where to print the problems found.
+//
+// Returns:  A boolean indicating if both files were read and parsed.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CDaqTrace::ParseText(
+			const string& posFileName,
+			const string& oriFileName,
+			vector<TDaqTraceSample>& samples,
+			ostream& err
+			)
+{
+
+	string posText, oriText;
+	if ( !ReadWholeFile( posFileName, posText ) ) {
+
+		err << "DaqTrace: unable to open '" << posFileName << "'" << endl;
+		return false;
+
+	}
+	if ( !ReadWholeFile( oriFileName, oriText ) ) {
+
+		err << "DaqTrace: unable to open '" << oriFileName << "'" << endl;
+		return false;
+
+	}
+
+	vector<double> posRows, oriRows;
+	if ( !ParseDaqText( posFileName, posText, posRows, err ) )  return false;
+	if ( !ParseDaqText( oriFileName, oriText, oriRows, err ) )  return false;
+
+	size_t numSamples = min( posRows.size(), oriRows.size() ) / 4;
+	if ( posRows.size() != oriRows.size() ) {
+
+		err << "DaqTrace: '" << posFileName << "' and '" << oriFileName;
+		err << "' differ in length; using the first " << numSamples;
+		err << " samples" << endl;
+
+	}
+
+	samples.resize( numSamples );
+	for ( size_t i = 0; i < numSamples; i++ ) {
+
+		const double* pPos = &posRows[i * 4];
+		const double* pOri = &oriRows[i * 4];
+		TDaqTraceSample& sample = samples[i];
+
+		sample.frame  = pPos[0];
+		sample.pos[0] = pPos[2];
+		sample.pos[1] = pPos[1];
+		sample.pos[2] = pPos[3];
+		sample.ori[0] = pOri[2];
+		sample.ori[1] = pOri[1];
+		sample.ori[2] = pOri[3];
+
+	}
+
+	return true;
+
+}  // ParseText
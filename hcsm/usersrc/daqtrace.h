@@ -0,0 +1,111 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version:      $Id: daqtrace.h,v 1.1 $
+ *
+ * Author(s):
+ *
+ * Date:         October, 2026
+ *
+ * Description:  Interface for the CDaqTrace class, which holds a recorded
+ *   driver trace for the DaqDriver HCSM.
+ *
+ * A trace comes either as a pair of DAQ text files, one with the driver's
+ * position and one with its orientation, or as a single binary file made
+ * from such a pair with Convert.  A binary trace is memory mapped, so
+ * opening it costs the same no matter how long the drive was and only
+ * the pages that are played back are ever read.  A text pair is parsed
+ * into memory, as before.
+ *
+ * The binary file is a TDaqTraceHeader followed by one TDaqTraceSample per
+ * recorded frame, in the byte order of the machine that converted it.
+ * Samples are fixed size and 8-byte aligned, so sample i is read in place
+ * and FindFrame finds a DAQ frame number with a binary search.
+ *
+ ****************************************************************************/
+
+#ifndef __CDAQTRACE_H
+#define __CDAQTRACE_H
+
+#ifdef _WIN32
+#if _MSC_VER >= 1000
+#pragma once
+#endif // _MSC_VER >= 1000
+
+#pragma warning(disable:4786)
+#endif
+
+#include <cvedpub.h>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#define DAQ_TRACE_MAGIC    0x54514144		// "DAQT"
+#define DAQ_TRACE_VERSION  1
+
+typedef struct TDaqTraceHeader {
+	int    magic;
+	int    version;
+	int    numSamples;
+	int    reserved;
+} TDaqTraceHeader;
+
+typedef struct TDaqTraceSample {
+	double frame;			// the DAQ frame number
+	double pos[3];			// x, y, z
+	double ori[3];			// roll, pitch, yaw
+} TDaqTraceSample;
+
+class CDaqTrace
+{
+public:
+	CDaqTrace();
+	~CDaqTrace();
+
+	bool Open( const string& posFileName, const string& oriFileName );
+	void Close();
+
+	int  NumSamples() const { return m_numSamples; }
+	bool IsMapped() const { return m_pMapping != 0; }
+	const TDaqTraceSample& GetSample( int idx ) const { return m_pSamples[idx]; }
+	void GetSample( double idx, CPoint3D& pos, CVector3D& ori ) const;
+	int  FindFrame( double frame ) const;
+
+	static bool IsBinary( const string& fileName );
+	static bool Convert(
+				const string& posFileName,
+				const string& oriFileName,
+				const string& outFileName,
+				ostream& err
+				);
+
+private:
+	bool OpenBinary( const string& fileName, ostream& err );
+	static bool ParseText(
+				const string& posFileName,
+				const string& oriFileName,
+				vector<TDaqTraceSample>& samples,
+				ostream& err
+				);
+
+	const TDaqTraceSample*   m_pSamples;
+	int                      m_numSamples;
+	vector<TDaqTraceSample>  m_parsed;		// samples of a text trace
+
+	// the binary trace mapping
+	void*                    m_pMapping;
+	size_t                   m_mapSize;
+#ifdef _WIN32
+	void*                    m_hFile;
+	void*                    m_hMap;
+#endif
+
+	CDaqTrace( const CDaqTrace& );
+	CDaqTrace& operator=( const CDaqTrace& );
+};
+
+#endif // __CDAQTRACE_H
@@ -50,6 +50,7 @@ CDdo::UserCreation( const CDdoParseBlock* cpSnoBlock )
 	//
 	m_initConditions.SetObjectInitCond(
 				*cved, 
+				m_pRootCollection->GetInitCondScheduler(),
 				GetFrame(), 
 				GetTimeStepDuration(),  
 				cpSnoBlock->GetCrRad(),  
@@ -122,7 +122,7 @@ CDeleteHcsmActn::Execute( const set<CCandidate>* cpInstigators )
 	set<CCandidate> candidateSet;
 	set<CCandidate>::const_iterator itr;
 
-	CHcsmCollection::SetActionDeleteLog( m_triggerId );
+	m_pHC->SetActionDeleteLog( m_triggerId );
 
 	m_candidateSet.GetCandidates( *(m_pHC->GetCved()), candidateSet, *m_pHC );
 
@@ -87,11 +87,11 @@ CDriverMirror::UserPreActivity()
 		gout << "  before obj pos = " << objPos << "  valid roadPos = " <<	roadPos << endl;
 #endif
 		// update corridor if on intersection to make sure it's the same as the path if a path exists
-		bool updateCrdr = !roadPos.IsRoad() && CHcsmCollection::m_sOwnshipPath.IsValid();
+		bool updateCrdr = !roadPos.IsRoad() && m_pRootCollection->m_ctx.m_sOwnshipPath.IsValid();
 		if( updateCrdr )
 		{
 			int crdrId = -1;
-			bool success = CHcsmCollection::m_sOwnshipPath.GetCrdrFromIntrscn( 
+			bool success = m_pRootCollection->m_ctx.m_sOwnshipPath.GetCrdrFromIntrscn( 
 						roadPos.GetIntrsctn().GetId(), 
 						crdrId,
 						&roadPos
@@ -223,11 +223,11 @@ CDriverMirror::UserPreActivity()
 	// Look at intersections along my path and register myself with the
 	// ones that fall within the register range.
 	//
-    if( m_currRoadPos.IsValid() && CHcsmCollection::m_sOwnshipPath.IsValid() )
+    if( m_currRoadPos.IsValid() && m_pRootCollection->m_ctx.m_sOwnshipPath.IsValid() )
 	{
 		const double cINTRSCTN_REGISTER_RANGE = 500.0;  // ft.
 		vector<int> intrsctns;
-		CHcsmCollection::m_sOwnshipPath.GetIntrsctnsWithinDist(
+		m_pRootCollection->m_ctx.m_sOwnshipPath.GetIntrsctnsWithinDist(
 							m_currRoadPos,
 							cINTRSCTN_REGISTER_RANGE,
 							intrsctns,
@@ -337,7 +337,7 @@ CDriverMirror::UserPostActivity()
 			//This needs to be changed so we follow our current lane to the intersection, but this 
 			//version of the CVED call does not, it will only look to see if the imediate lane is connected to 
 			//the intersection that is passed in.
-			success = CHcsmCollection::m_sOwnshipPath.GetCrdrFromIntrscn( 
+			success = m_pRootCollection->m_ctx.m_sOwnshipPath.GetCrdrFromIntrscn( 
 								*i,
 								crdrId,
 								&m_currRoadPos,
@@ -347,7 +347,7 @@ CDriverMirror::UserPostActivity()
 			//if we are that far out we will assume we can change lanes......
 			if( !success ) 
 			{
-				success = CHcsmCollection::m_sOwnshipPath.GetCrdrFromIntrscn( 
+				success = m_pRootCollection->m_ctx.m_sOwnshipPath.GetCrdrFromIntrscn( 
 									*i,
 									crdrId,
 									&m_currRoadPos
@@ -356,7 +356,7 @@ CDriverMirror::UserPostActivity()
 		}
 		else
 		{
-			success = CHcsmCollection::m_sOwnshipPath.GetCrdrFromIntrscn( 
+			success = m_pRootCollection->m_ctx.m_sOwnshipPath.GetCrdrFromIntrscn( 
 								*i,
 								crdrId,
 								&m_currRoadPos
@@ -313,6 +313,8 @@ double Rand( int argC, const CExprParser::CStrNum args[] ){
 
 CExpEval::CExpEval()
 {
+	cved = NULL;
+	m_pHC = NULL;
 }
 
 CExpEval::CExpEval( const CExpEval& objToCopy )
@@ -327,7 +329,8 @@ CExpEval::operator=( const CExpEval& objToCopy )
 	// check to make sure that object passed in is not me
 	if ( this != &objToCopy ) 
 	{
-
+		cved = objToCopy.cved;
+		m_pHC = objToCopy.m_pHC;
 	}
 
 	return *this;
@@ -350,8 +353,8 @@ CExpEval::EvaluateVariable( const char* cpName )
 	}
 	else
 	{
-		if (CHcsmCollection::ExprVariableExists( cpName )){
-            return CHcsmCollection::GetExprVariable(cpName);
+		if (m_pHC->ExprVariableExists( cpName )){
+            return m_pHC->GetExprVariable(cpName);
         }else{
 			if (cpName){
 				if (m_unkownVariables.find(cpName) == m_unkownVariables.end()){
@@ -378,7 +381,7 @@ CExpEval::EvaluateFunction(
 
 	if( foundFunction )
 	{
-		result.SetVal( (*p->second)( numArg, args ) );
+		result.SetVal( (*p->second)( *this, numArg, args ) );
 		return true;
 	}
 	else
@@ -423,18 +426,18 @@ CExpEval::GetObjVel( int argC, const CExprParser::CStrNum args[] )
 	string objName = args[0].m_Str;
 	//this->cved->geto
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < m_pHC->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&m_pHC->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE 
 			);
 		if( !strcmp( temp, objName.c_str() ) )
 		{
-			double vel = CHcsmCollection::m_sDynObjData.vel[i];
-			return CHcsmCollection::m_sDynObjData.vel[i];
+			double vel = m_pHC->m_ctx.m_sDynObjData.vel[i];
+			return m_pHC->m_ctx.m_sDynObjData.vel[i];
 		}
 	}
 
@@ -451,7 +454,7 @@ CExpEval::GetQueueSize( int argC, const CExprParser::CStrNum args[] ){
         return 0;
     }
     int size = 0;
-    CHcsmCollection::GetVarQueueSize(args[0].m_Str,size);
+    m_pHC->GetVarQueueSize(args[0].m_Str,size);
     return (double)size;
 }
 double
@@ -551,55 +554,55 @@ double CExpEval::ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 	if( cellName == "PlacePhoneCall" )
 	{
-		return CHcsmCollection::m_sSCC_PlacePhoneCall;
+		return m_pHC->m_ctx.m_sSCC_PlacePhoneCall;
 	}
 	else if( cellName == "PhoneCallAge" )
 	{
-		return CHcsmCollection::m_sPlacePhoneCallAge;
+		return m_pHC->m_ctx.m_sPlacePhoneCallAge;
 	}
 	else if( cellName == "LogStreams" )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS *2 )  throw InvalidArgs;
 		else if (index < 0 || index < cNUM_LOG_STREAMS){
-			return CHcsmCollection::m_sLogStreams[index];
+			return m_pHC->m_ctx.m_sLogStreams[index];
 		}else{
-			return CHcsmCollection::m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
+			return m_pHC->m_ctx.m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
 		}
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return CHcsmCollection::m_sAccelPedalPos;
+		return m_pHC->m_ctx.m_sAccelPedalPos;
 	}
 	else if( cellName == "BrakePedalForce" )
 	{
-		return CHcsmCollection::m_sBrakePedalForce;
+		return m_pHC->m_ctx.m_sBrakePedalForce;
 	}
 	else if( cellName == "SteeringWheelAngle" )
 	{
-		return CHcsmCollection::m_sSteeringWheelAngle;
+		return m_pHC->m_ctx.m_sSteeringWheelAngle;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return CHcsmCollection::m_sCruiseControl;
+		return m_pHC->m_ctx.m_sCruiseControl;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return CHcsmCollection::m_sCruiseControlIncoming;
+		return m_pHC->m_ctx.m_sCruiseControlIncoming;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return CHcsmCollection::m_sCisTurnSignal;
+		return m_pHC->m_ctx.m_sCisTurnSignal;
 	}
 	else if( cellName == "OvVel" )
 	{
-		return CHcsmCollection::m_sSpeedometerBackdrive;
+		return m_pHC->m_ctx.m_sSpeedometerBackdrive;
 	}
 	else if( cellName == "Hour" )
 	{
-		return CHcsmCollection::m_sHour;
+		return m_pHC->m_ctx.m_sHour;
 	}
 	else if( cellName == "Minute" )
 	{
-		return CHcsmCollection::m_sMinute;
+		return m_pHC->m_ctx.m_sMinute;
 	}
 	else if( cellName == "OvVelLocal" )
 	{
@@ -610,64 +613,64 @@ double CExpEval::ReadCell( int argC, const CExprParser::CStrNum args[] )
 	else if( cellName == "OvLaneDev" )
 	{
 		double laneDev = 0.0;
-		if( CHcsmCollection::m_sLaneDevInfo[0] != 0 )
+		if( m_pHC->m_ctx.m_sLaneDevInfo[0] != 0 )
 		{
-			laneDev = CHcsmCollection::m_sLaneDevInfo[1];
+			laneDev = m_pHC->m_ctx.m_sLaneDevInfo[1];
 		}
 		return laneDev;
 	}
 	else if( cellName == "OvHeadwayToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
+		return m_pHC->m_ctx.m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
 	}
 	else if( cellName == "OvTtcToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
+		return m_pHC->m_ctx.m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
 	}
 	else if( cellName == "Horn" )
 	{
-		return CHcsmCollection::m_sHorn;
+		return m_pHC->m_ctx.m_sHorn;
 	}
 	else if (cellName == "HornFiltered"){
-		return CHcsmCollection::m_sHornFiltered;	
+		return m_pHC->m_ctx.m_sHornFiltered;	
 	}
 	else if( cellName == "RECAS_Button" )
 	{
-		return CHcsmCollection::m_sRecasButton;
+		return m_pHC->m_ctx.m_sRecasButton;
 	}
 	else if( cellName == "Auxiliary_Buttons" )
 	{
-		return CHcsmCollection::m_sAuxiliaryButtons[index];
+		return m_pHC->m_ctx.m_sAuxiliaryButtons[index];
 	}
 	else if ( cellName == "DynObj_Vel" )
 	{
-		return CHcsmCollection::m_sDynObjData.vel[index];
+		return m_pHC->m_ctx.m_sDynObjData.vel[index];
 	}
 	else if ( cellName == "FcwInfo" )
 	{
 		if( index < 0 || index >= 4)  throw InvalidArgs;
-		return CHcsmCollection::m_sFcwInfo[index];
+		return m_pHC->m_ctx.m_sFcwInfo[index];
 	}
 	else if (cellName == "LdwStatus"){
-		return CHcsmCollection::m_sLdwStatus;
+		return m_pHC->m_ctx.m_sLdwStatus;
 	}
 	else if (cellName == "BackUpDistance"){
-		return CHcsmCollection::m_sBackUpDistance;
+		return m_pHC->m_ctx.m_sBackUpDistance;
 	}
 	else if (cellName == "WarningLights"){
-		return CHcsmCollection::m_sWarningLights;
+		return m_pHC->m_ctx.m_sWarningLights;
 	}
 	else if (cellName == "ACC_Warning"){
-		return CHcsmCollection::m_sACC_Warning;
+		return m_pHC->m_ctx.m_sACC_Warning;
 	}
 	else if (cellName == "Cruise_State"){
-		return CHcsmCollection::m_sCruise_State;
+		return m_pHC->m_ctx.m_sCruise_State;
 	}
 	else if (cellName == "Cruise_Speed"){
-		return CHcsmCollection::m_sCruise_SetSpeed;
+		return m_pHC->m_ctx.m_sCruise_SetSpeed;
 	}
 	else if (cellName == "ACC_Gap"){
-		return CHcsmCollection::m_sACC_Gap;
+		return m_pHC->m_ctx.m_sACC_Gap;
 	}
 	else if (cellName == "ACC_SMV"){ //Total Hack, need to fix expression parser
 		double ownVehVel = 0.0;
@@ -694,10 +697,10 @@ double CExpEval::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		cved->GetOwnVehicleVel( ownVehVel );
 		ownVehVel = ownVehVel * cMS_TO_MPH;
 		if (index == 1){
-			if (CHcsmCollection::m_sCruise_SetSpeed > 49.9 && CHcsmCollection::m_sCruise_SetSpeed < 59.9){
-				return CHcsmCollection::m_sCruise_SetSpeed - 5;
+			if (m_pHC->m_ctx.m_sCruise_SetSpeed > 49.9 && m_pHC->m_ctx.m_sCruise_SetSpeed < 59.9){
+				return m_pHC->m_ctx.m_sCruise_SetSpeed - 5;
 			}
-			else if (CHcsmCollection::m_sCruise_SetSpeed < 49.5){
+			else if (m_pHC->m_ctx.m_sCruise_SetSpeed < 49.5){
 				return 45.0;
 			}else{
 				return 55.0;
@@ -714,10 +717,10 @@ double CExpEval::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		}
 	}
 	else if (cellName == "Sensor_Info"){
-		return CHcsmCollection::m_sSensorInfo[index];
+		return m_pHC->m_ctx.m_sSensorInfo[index];
 	}
 	else if (cellName == "OnPath"){
-		return CHcsmCollection::m_sIsOnPath;
+		return m_pHC->m_ctx.m_sIsOnPath;
 	}
 	else if (CHcsmCollection::ReadCellNumeric != NULL){
 		//bool (*func) (const string&, int, float&);// = CHcsmCollection::ReadCellNumeric;
@@ -920,8 +923,8 @@ double CExpEval::GetCalcDist( int argC, const CExprParser::CStrNum args[] ){
 	if (argC != 2 && args[0].m_IsNum || args[1].m_IsNum){
 		return 1000000000000000000000.0f;
 	}
-	CPoint3D pos1 = CHcsmCollection::GetExprPosVariable(args[0].m_Str);
-	CPoint3D pos2 = CHcsmCollection::GetExprPosVariable(args[1].m_Str);
+	CPoint3D pos1 = m_pHC->GetExprPosVariable(args[0].m_Str);
+	CPoint3D pos2 = m_pHC->GetExprPosVariable(args[1].m_Str);
 	return pos1.Dist(pos2);
 
 	
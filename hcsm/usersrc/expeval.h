@@ -33,7 +33,10 @@
 
 using namespace std;
 
-typedef double (*pFunc)(int, const CExprParser::CStrNum []);
+class CHcsmCollection;
+class CExpEval;
+
+typedef double (*pFunc)(CExpEval&, int, const CExprParser::CStrNum []);
 /////////////////////////////////////////////////////////////////////////////
 ///\brief
 ///    expression parser
@@ -57,6 +60,7 @@ public:
 	map<string, pFunc>  m_functions;
 	set<string> m_unkownVariables;
 	CVED::CCved* cved;
+	CHcsmCollection* m_pHC; //< collection whose variables and cells are read
 protected:
 	//common functions
     double GetQueueSize(int argC, const CExprParser::CStrNum args[]);
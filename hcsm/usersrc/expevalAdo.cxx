@@ -63,8 +63,8 @@ CExpEvalAdo::EvaluateVariable( const char* cpName )
 	}
 	else
 	{
-		if (CHcsmCollection::ExprVariableExists( cpName )){
-            return CHcsmCollection::GetExprVariable(cpName);
+		if (m_pHC->ExprVariableExists( cpName )){
+            return m_pHC->GetExprVariable(cpName);
         }else{
             cerr << "CExpEval: unknown variable '" << cpName << "'" << endl;
             return 0.0;
@@ -28,6 +28,7 @@
 #include <pi_string>
 #include <map>
 class CAdo;
+class CHcsmCollection;
 using namespace std;
 
 //typedef double (*pFunc)(int, const CExprParser::CStrNum []);
@@ -50,10 +51,12 @@ public:
 
 	virtual double EvaluateVariable( const char* ) override;
 	virtual bool EvaluateFunction( const string&, int, const CStrNum[], CStrNum& ) override;
-	void SetParent(CAdo * parent){
+	void SetParent(CAdo * parent, CHcsmCollection* pHC){
 		m_pParent = parent;
+		m_pHC = pHC;
 	}
 	CAdo *m_pParent;
+	CHcsmCollection* m_pHC; //< collection whose variables are read
 	map<string, double> m_variables;
 	map<string, pAdoFunc>  m_functions;
 	
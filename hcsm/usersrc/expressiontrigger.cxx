@@ -21,8 +21,6 @@
 #include <strstream>
 #undef DEBUG
 
-CCved* g_pCved = NULL;
-
 extern void 
 StringFlip( const volatile char from[], char to[], int size );
 extern void
@@ -58,7 +56,7 @@ PrintInvalidArgs(
 }
 
 static double
-MySin( int argC, const CExprParser::CStrNum args[] )
+MySin( CExpEval&, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || !args[0].m_IsNum;
 	if( invalidArgs )  throw InvalidArgs;
@@ -67,7 +65,7 @@ MySin( int argC, const CExprParser::CStrNum args[] )
 
 
 static double
-MyCos( int argC, const CExprParser::CStrNum args[] )
+MyCos( CExpEval&, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || !args[0].m_IsNum;
 	if( invalidArgs )  throw InvalidArgs;
@@ -76,7 +74,7 @@ MyCos( int argC, const CExprParser::CStrNum args[] )
 
 
 static double
-CellEquals( int argC, const CExprParser::CStrNum args[] )
+CellEquals( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 3 || args[0].m_IsNum || !args[1].m_IsNum || !args[2].m_IsNum;
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "CellEquals" );
@@ -89,33 +87,33 @@ CellEquals( int argC, const CExprParser::CStrNum args[] )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS *2 )  throw InvalidArgs;
 		else if (index < 0 || index < cNUM_LOG_STREAMS){
-			return fabs( CHcsmCollection::m_sLogStreams[index] - doubleVal ) < cNEAR_ZERO;
+			return fabs( eval.m_pHC->m_ctx.m_sLogStreams[index] - doubleVal ) < cNEAR_ZERO;
 		}else{
-			return fabs( CHcsmCollection::m_sLogStreamsExt[index - cNUM_LOG_STREAMS] - doubleVal ) < cNEAR_ZERO;
+			return fabs( eval.m_pHC->m_ctx.m_sLogStreamsExt[index - cNUM_LOG_STREAMS] - doubleVal ) < cNEAR_ZERO;
 		}		
 		
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return fabs( CHcsmCollection::m_sAccelPedalPos - doubleVal ) < cNEAR_ZERO;
+		return fabs( eval.m_pHC->m_ctx.m_sAccelPedalPos - doubleVal ) < cNEAR_ZERO;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return fabs( CHcsmCollection::m_sCruiseControl - doubleVal ) < cNEAR_ZERO;
+		return fabs( eval.m_pHC->m_ctx.m_sCruiseControl - doubleVal ) < cNEAR_ZERO;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return fabs( CHcsmCollection::m_sCruiseControlIncoming - doubleVal ) < cNEAR_ZERO;
+		return fabs( eval.m_pHC->m_ctx.m_sCruiseControlIncoming - doubleVal ) < cNEAR_ZERO;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return fabs( CHcsmCollection::m_sCisTurnSignal - doubleVal ) < cNEAR_ZERO;
+		return fabs( eval.m_pHC->m_ctx.m_sCisTurnSignal - doubleVal ) < cNEAR_ZERO;
 	}
 
 	return 0.0;
 }
 
 static double
-SquareRoot( int argC, const CExprParser::CStrNum args[] )
+SquareRoot( CExpEval&, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || !args[0].m_IsNum;
 	if( invalidArgs )  throw InvalidArgs;
@@ -123,29 +121,29 @@ SquareRoot( int argC, const CExprParser::CStrNum args[] )
 }
 
 static double
-MyAbs( int argC, const CExprParser::CStrNum args[] )
+MyAbs( CExpEval&, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || !args[0].m_IsNum;
 	if( invalidArgs )  throw InvalidArgs;
 	return abs( args[0].m_Num );
 }
 static double
-ReadVar( int argC, const CExprParser::CStrNum args[] )
+ReadVar( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = (argC != 1) || (args[0].m_IsNum);
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "ReadVar" );
 
 	string varName = args[0].m_Str;
-	if( !CHcsmCollection::ExprVariableExists( varName ) )
+	if( !eval.m_pHC->ExprVariableExists( varName ) )
 	{
 		return 0.0;
 	}
 	
-	return CHcsmCollection::GetExprVariable( varName );
+	return eval.m_pHC->GetExprVariable( varName );
 }
 
 static double
-ReadCell( int argC, const CExprParser::CStrNum args[] )
+ReadCell( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 2 || args[0].m_IsNum || !args[1].m_IsNum;
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "ReadCell" );
@@ -155,129 +153,129 @@ ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 	if( cellName == "PlacePhoneCall" )
 	{
-		return CHcsmCollection::m_sSCC_PlacePhoneCall;
+		return eval.m_pHC->m_ctx.m_sSCC_PlacePhoneCall;
 	}
 	else if( cellName == "PhoneCallAge" )
 	{
-		return CHcsmCollection::m_sPlacePhoneCallAge;
+		return eval.m_pHC->m_ctx.m_sPlacePhoneCallAge;
 	}
 	else if( cellName == "LogStreams" )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS *2 )  throw InvalidArgs;
 		else if (index < 0 || index < cNUM_LOG_STREAMS){
-			return CHcsmCollection::m_sLogStreams[index];
+			return eval.m_pHC->m_ctx.m_sLogStreams[index];
 		}else{
-			return CHcsmCollection::m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
+			return eval.m_pHC->m_ctx.m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
 		}
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return CHcsmCollection::m_sAccelPedalPos;
+		return eval.m_pHC->m_ctx.m_sAccelPedalPos;
 	}
 	else if( cellName == "BrakePedalForce" )
 	{
-		return CHcsmCollection::m_sBrakePedalForce;
+		return eval.m_pHC->m_ctx.m_sBrakePedalForce;
 	}
 	else if( cellName == "SteeringWheelAngle" )
 	{
-		return CHcsmCollection::m_sSteeringWheelAngle;
+		return eval.m_pHC->m_ctx.m_sSteeringWheelAngle;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return CHcsmCollection::m_sCruiseControl;
+		return eval.m_pHC->m_ctx.m_sCruiseControl;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return CHcsmCollection::m_sCruiseControlIncoming;
+		return eval.m_pHC->m_ctx.m_sCruiseControlIncoming;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return CHcsmCollection::m_sCisTurnSignal;
+		return eval.m_pHC->m_ctx.m_sCisTurnSignal;
 	}
 	else if( cellName == "OvVel" )
 	{
-		return CHcsmCollection::m_sSpeedometerBackdrive;
+		return eval.m_pHC->m_ctx.m_sSpeedometerBackdrive;
 	}
 	else if( cellName == "Hour" )
 	{
-		return CHcsmCollection::m_sHour;
+		return eval.m_pHC->m_ctx.m_sHour;
 	}
 	else if( cellName == "Minute" )
 	{
-		return CHcsmCollection::m_sMinute;
+		return eval.m_pHC->m_ctx.m_sMinute;
 	}
 	else if( cellName == "OvVelLocal" )
 	{
 		double ownVehVel = 0.0;
-		g_pCved->GetOwnVehicleVel( ownVehVel );
+		eval.cved->GetOwnVehicleVel( ownVehVel );
 		return ownVehVel * cMS_TO_MPH;
 	}
 	else if( cellName == "OvLaneDev" )
 	{
 		double laneDev = 0.0;
-		if( CHcsmCollection::m_sLaneDevInfo[0] != 0 )
+		if( eval.m_pHC->m_ctx.m_sLaneDevInfo[0] != 0 )
 		{
-			laneDev = CHcsmCollection::m_sLaneDevInfo[1];
+			laneDev = eval.m_pHC->m_ctx.m_sLaneDevInfo[1];
 		}
 		return laneDev;
 	}
 	else if( cellName == "OvHeadwayToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
+		return eval.m_pHC->m_ctx.m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
 	}
 	else if( cellName == "OvTtcToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
+		return eval.m_pHC->m_ctx.m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
 	}
 	else if( cellName == "Horn" )
 	{
-		return CHcsmCollection::m_sHorn;
+		return eval.m_pHC->m_ctx.m_sHorn;
 	}
 	else if (cellName == "HornFiltered"){
-		return CHcsmCollection::m_sHornFiltered;	
+		return eval.m_pHC->m_ctx.m_sHornFiltered;	
 	}
 	else if( cellName == "RECAS_Button" )
 	{
-		return CHcsmCollection::m_sRecasButton;
+		return eval.m_pHC->m_ctx.m_sRecasButton;
 	}
 	else if( cellName == "Auxiliary_Buttons" )
 	{
-		return CHcsmCollection::m_sAuxiliaryButtons[index];
+		return eval.m_pHC->m_ctx.m_sAuxiliaryButtons[index];
 	}
 	else if ( cellName == "DynObj_Vel" )
 	{
-		return CHcsmCollection::m_sDynObjData.vel[index];
+		return eval.m_pHC->m_ctx.m_sDynObjData.vel[index];
 	}
 	else if ( cellName == "FcwInfo" )
 	{
 		if( index < 0 || index >= 4)  throw InvalidArgs;
-		return CHcsmCollection::m_sFcwInfo[index];
+		return eval.m_pHC->m_ctx.m_sFcwInfo[index];
 	}
 	else if (cellName == "LdwStatus"){
-		return CHcsmCollection::m_sLdwStatus;
+		return eval.m_pHC->m_ctx.m_sLdwStatus;
 	}
 	else if (cellName == "BackUpDistance"){
-		return CHcsmCollection::m_sBackUpDistance;
+		return eval.m_pHC->m_ctx.m_sBackUpDistance;
 	}
 	else if (cellName == "WarningLights"){
-		return CHcsmCollection::m_sWarningLights;
+		return eval.m_pHC->m_ctx.m_sWarningLights;
 	}
 	else if (cellName == "ACC_Warning"){
-		return CHcsmCollection::m_sACC_Warning;
+		return eval.m_pHC->m_ctx.m_sACC_Warning;
 	}
 	else if (cellName == "Cruise_State"){
-		return CHcsmCollection::m_sCruise_State;
+		return eval.m_pHC->m_ctx.m_sCruise_State;
 	}
 	else if (cellName == "Cruise_Speed"){
-		return CHcsmCollection::m_sCruise_SetSpeed;
+		return eval.m_pHC->m_ctx.m_sCruise_SetSpeed;
 	}
 	else if (cellName == "ACC_Gap"){
-		return CHcsmCollection::m_sACC_Gap;
+		return eval.m_pHC->m_ctx.m_sACC_Gap;
 	}
 	else if (cellName == "Sensor_Info"){
-		return CHcsmCollection::m_sSensorInfo[index];
+		return eval.m_pHC->m_ctx.m_sSensorInfo[index];
 	}
 	else if (cellName == "OnPath"){
-		return CHcsmCollection::m_sIsOnPath;
+		return eval.m_pHC->m_ctx.m_sIsOnPath;
 	}
 	else if (CHcsmCollection::ReadCellNumeric != NULL){
 		float result = 0;
@@ -291,8 +289,8 @@ ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 /*	else if (cellName == "OwnVehAccel"){
 		int ownVehObjId;
-		g_pCved->GetObj( "ExternalDriver", ownVehObjId );
-		const CDynObj* pOwnVehObj = g_pCved->BindObjIdToClass( ownVehObjId );
+		eval.cved->GetObj( "ExternalDriver", ownVehObjId );
+		const CDynObj* pOwnVehObj = eval.cved->BindObjIdToClass( ownVehObjId );
 		return (pOwnVehObj->GetVel()  - pOwnVehObj->GetVelImm()) / CHcsmCollection::GetTimeStepDuration();	
 	}*/
 	else
@@ -306,7 +304,7 @@ ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 
 static double
-GetObjVel( int argC, const CExprParser::CStrNum args[] )
+GetObjVel( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || args[0].m_IsNum;
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "GetObjVel" );
@@ -314,25 +312,25 @@ GetObjVel( int argC, const CExprParser::CStrNum args[] )
 	string objName = args[0].m_Str;
 
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < eval.m_pHC->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&eval.m_pHC->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE 
 			);
 		if( !strcmp( temp, objName.c_str() ) )
 		{
-			double vel = CHcsmCollection::m_sDynObjData.vel[i];
-			return CHcsmCollection::m_sDynObjData.vel[i];
+			double vel = eval.m_pHC->m_ctx.m_sDynObjData.vel[i];
+			return eval.m_pHC->m_ctx.m_sDynObjData.vel[i];
 		}
 	}
 
 	return 0.0;
 }
 static double
-GetObjAccel( int argC, const CExprParser::CStrNum args[] ){
+GetObjAccel( CExpEval& eval, int argC, const CExprParser::CStrNum args[] ){
 
 	int objId;
 	if (argC != 1 || args[0].m_IsNum){
@@ -340,7 +338,7 @@ GetObjAccel( int argC, const CExprParser::CStrNum args[] ){
 		return 0;
 	}
 	int id;
-	bool foundObj = g_pCved->GetObj(args[0].m_Str,id);
+	bool foundObj = eval.cved->GetObj(args[0].m_Str,id);
 	if( !foundObj )
 	{
 		gout << "GetObjAccel: unable to find object named '";
@@ -349,7 +347,7 @@ GetObjAccel( int argC, const CExprParser::CStrNum args[] ){
 		return 0.0;
 	}
 
-	const CObj* pObj = g_pCved->BindObjIdToClass( id);
+	const CObj* pObj = eval.cved->BindObjIdToClass( id);
 
 	const CVehicleObj* cpVehObj = 
 				dynamic_cast<const CVehicleObj *>( pObj );
@@ -376,7 +374,7 @@ GetObjAccel( int argC, const CExprParser::CStrNum args[] ){
 ///
 //////////////////////////////////////////////////////////////////////////////
 static double
-GetObjDistPow2( int argC, const CExprParser::CStrNum args[] )
+GetObjDistPow2( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	bool invalidArgs = argC != 1 || args[0].m_IsNum;
 //	if( invalidArgs )  PrintInvalidArgs( argC, args, "GetObjDistPow2" );
@@ -384,14 +382,14 @@ GetObjDistPow2( int argC, const CExprParser::CStrNum args[] )
 	string objName = args[0].m_Str;
 
 	CPoint3D ovPos;
-	g_pCved->GetOwnVehiclePos( ovPos );
+	eval.cved->GetOwnVehiclePos( ovPos );
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < eval.m_pHC->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&eval.m_pHC->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE 
 			);
 		if( !strcmp( temp, objName.c_str() ) )
@@ -399,25 +397,25 @@ GetObjDistPow2( int argC, const CExprParser::CStrNum args[] )
 			if (argC == 2)
 			{ //if we are looking for another object
 				string objName2 = args[1].m_Str;
-				for(int j = 0; j < CHcsmCollection::m_sDynObjDataSize; j++ )
+				for(int j = 0; j < eval.m_pHC->m_ctx.m_sDynObjDataSize; j++ )
 				{
 					char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 					StrncpyFlip(
 						temp,
-						&CHcsmCollection::m_sDynObjData.name[j*cMAX_DYN_OBJ_NAME_SIZE],
+						&eval.m_pHC->m_ctx.m_sDynObjData.name[j*cMAX_DYN_OBJ_NAME_SIZE],
 						cMAX_DYN_OBJ_NAME_SIZE 
 					);
 					if( !strcmp( temp, objName2.c_str() ) )
 					{
-						ovPos.m_x = CHcsmCollection::m_sDynObjData.pos[j*3];
-						ovPos.m_y = CHcsmCollection::m_sDynObjData.pos[j*3+1];
-						ovPos.m_z = CHcsmCollection::m_sDynObjData.pos[j*3+2];
+						ovPos.m_x = eval.m_pHC->m_ctx.m_sDynObjData.pos[j*3];
+						ovPos.m_y = eval.m_pHC->m_ctx.m_sDynObjData.pos[j*3+1];
+						ovPos.m_z = eval.m_pHC->m_ctx.m_sDynObjData.pos[j*3+2];
 					}
 				}
 			}
-			float deltaX = ovPos.m_x - CHcsmCollection::m_sDynObjData.pos[i*3];
-			float deltaY = ovPos.m_y - CHcsmCollection::m_sDynObjData.pos[i*3+1];
-			float deltaZ = ovPos.m_z - CHcsmCollection::m_sDynObjData.pos[i*3+2];
+			float deltaX = ovPos.m_x - eval.m_pHC->m_ctx.m_sDynObjData.pos[i*3];
+			float deltaY = ovPos.m_y - eval.m_pHC->m_ctx.m_sDynObjData.pos[i*3+1];
+			float deltaZ = ovPos.m_z - eval.m_pHC->m_ctx.m_sDynObjData.pos[i*3+2];
 			return deltaX*deltaX + deltaY*deltaY + deltaZ*deltaZ;
 		}
 	}
@@ -443,10 +441,10 @@ GetObjDistPow2( int argC, const CExprParser::CStrNum args[] )
 //
 //////////////////////////////////////////////////////////////////////////////
 static double 
-GetObjTtcToOv( int argC, const CExprParser::CStrNum args[] )
+GetObjTtcToOv( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	// make sure CVED is valid
-	if( !g_pCved )  return 0;
+	if( !eval.cved )  return 0;
 
 	bool invalidArgs = argC != 1 || args[0].m_IsNum;
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "GetObjTtcToOv" );
@@ -456,7 +454,7 @@ GetObjTtcToOv( int argC, const CExprParser::CStrNum args[] )
 	//
 	string objName = args[0].m_Str;
 	int objId;
-	bool foundObj = g_pCved->GetObj( objName, objId );
+	bool foundObj = eval.cved->GetObj( objName, objId );
 	if( !foundObj )
 	{
 		gout << "GetObjTtcToOv: unable to find object named '";
@@ -468,9 +466,9 @@ GetObjTtcToOv( int argC, const CExprParser::CStrNum args[] )
 	//
 	// Calculate the distance from the object to the OV.
 	//
-	CPoint3D objPos = g_pCved->GetObjPos( objId );
+	CPoint3D objPos = eval.cved->GetObjPos( objId );
 	CPoint3D ovPos;
-	bool gotOvInfo = g_pCved->GetOwnVehiclePos( ovPos );
+	bool gotOvInfo = eval.cved->GetOwnVehiclePos( ovPos );
 	if( !gotOvInfo )  return 0.0;
 	double dist = fabs( (ovPos - objPos).Length() );
 
@@ -478,9 +476,9 @@ GetObjTtcToOv( int argC, const CExprParser::CStrNum args[] )
 	// Calculate the difference in velocities between the object and
 	// the OV.
 	//
-	double objVel = g_pCved->GetObjVel( objId );
+	double objVel = eval.cved->GetObjVel( objId );
 	double ovVel;
-	gotOvInfo = g_pCved->GetOwnVehicleVel( ovVel );
+	gotOvInfo = eval.cved->GetOwnVehicleVel( ovVel );
 	if( !gotOvInfo )  return 0.0;
 	double velDiff = ( objVel - ovVel ) * cMETER_TO_FEET;  // convert to ft/s
 
@@ -509,10 +507,10 @@ GetObjTtcToOv( int argC, const CExprParser::CStrNum args[] )
 //
 //////////////////////////////////////////////////////////////////////////////
 static double 
-GetOvTtcToObj( int argC, const CExprParser::CStrNum args[] )
+GetOvTtcToObj( CExpEval& eval, int argC, const CExprParser::CStrNum args[] )
 {
 	// make sure CVED is valid
-	if( !g_pCved )  return 0;
+	if( !eval.cved )  return 0;
 
 	bool invalidArgs = argC != 1 || args[0].m_IsNum;
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "GetOvTtcToObj" );
@@ -522,7 +520,7 @@ GetOvTtcToObj( int argC, const CExprParser::CStrNum args[] )
 	//
 	string objName = args[0].m_Str;
 	int objId;
-	bool foundObj = g_pCved->GetObj( objName, objId );
+	bool foundObj = eval.cved->GetObj( objName, objId );
 	if( !foundObj )
 	{
 		gout << "GetObjTtcToOv: unable to find object named '";
@@ -534,9 +532,9 @@ GetOvTtcToObj( int argC, const CExprParser::CStrNum args[] )
 	//
 	// Calculate the distance from the object to the OV.
 	//
-	CPoint3D objPos = g_pCved->GetObjPos( objId );
+	CPoint3D objPos = eval.cved->GetObjPos( objId );
 	CPoint3D ovPos;
-	bool gotOvInfo = g_pCved->GetOwnVehiclePos( ovPos );
+	bool gotOvInfo = eval.cved->GetOwnVehiclePos( ovPos );
 	if( !gotOvInfo )  return 0.0;
 	double dist = fabs( (ovPos - objPos).Length() );
 
@@ -544,9 +542,9 @@ GetOvTtcToObj( int argC, const CExprParser::CStrNum args[] )
 	// Calculate the difference in velocities between the object and
 	// the OV.
 	//
-	double objVel = g_pCved->GetObjVel( objId );
+	double objVel = eval.cved->GetObjVel( objId );
 	double ovVel;
-	gotOvInfo = g_pCved->GetOwnVehicleVel( ovVel );
+	gotOvInfo = eval.cved->GetOwnVehicleVel( ovVel );
 	if( !gotOvInfo )  return 0.0;
 	double velDiff = ( ovVel - objVel ) * cMETER_TO_FEET;  // convert to ft/s
 
@@ -566,6 +564,7 @@ CExpressionTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object.
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								GetFrame(), 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -595,6 +594,8 @@ CExpressionTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		gout << m_expression << endl;
 #endif
 
+		m_expEval.cved = cved;
+		m_expEval.m_pHC = m_pRootCollection;
 		m_expEval.m_functions["sin"] = MySin;
 		m_expEval.m_functions["cos"] = MyCos;
 		m_expEval.m_functions["ReadCell"] = ReadCell;
@@ -632,8 +633,6 @@ CExpressionTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 
 		InitCandidates( cpBlock );
 
-		g_pCved = cved;
-
 		//
 		// Make an entry into the activity log for HCSM creation.
 		//
@@ -36,6 +36,7 @@ CFollowTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object.
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								GetFrame(), 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -77,6 +78,7 @@ CFollowTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		if (m_isExpression)
 			m_exprEval.Parse(m_expression.c_str());
 		m_exprEval.cved = cved;
+		m_exprEval.m_pHC = m_pRootCollection;
 #ifdef DEBUG_TRIGGER
 		gout << "**the current path:" << endl;
 		gout << m_path;
@@ -35,6 +35,7 @@ CGmtrcPstnTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object
 		m_initCondition.SetObjectInitCond( 
 									*cved, 
+									m_pRootCollection->GetInitCondScheduler(),
 									GetFrame(), 
 									GetTimeStepDuration(),  
 									cpBlock->GetCrRad(),  
@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: initcondscheduler.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The implementation of the class CInitCondScheduler.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include "hcsmpch.h"
+#include "initcondscheduler.h"
+#include <math.h>
+#include <algorithm>
+
+// Size of a grid cell in feet
+const double cINITCOND_CELL_SIZE = 1000.0;
+// Registrations covering more cells than this are checked every frame
+const int cINITCOND_MAX_CELLS = 1024;
+
+CInitCondScheduler::CInitCondScheduler()
+{
+	m_pCved = 0;
+	m_frame = 0;
+	m_refreshed = false;
+}
+
+long long
+CInitCondScheduler::CellKey( int cx, int cy )
+{
+	return ( (long long) cx << 32 ) ^ (unsigned int) cy;
+}
+
+int
+CInitCondScheduler::CellOf( double v )
+{
+	return (int) floor( v / cINITCOND_CELL_SIZE );
+}
+
+void
+CInitCondScheduler::RemoveSlot( vector<int>& list, int slot )
+{
+	vector<int>::iterator i = find( list.begin(), list.end(), slot );
+	if( i != list.end() )
+	{
+		*i = list.back();
+		list.pop_back();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Registers a waiting object.
+//
+// Remarks: The object is filed under every cell of the square that
+//  bounds its radius, so the own vehicle can only be within the radius
+//  while it is in one of those cells.  Only the magnitude of the radius
+//  matters, as in CObjectInitCond::InRadius.
+//
+// Arguments:
+//  cPos   - the position of the object; the Z component is ignored
+//  radius - the creation radius, in feet
+//
+// Returns: The slot that identifies the registration.
+//
+/////////////////////////////////////////////////////////////////////////////
+int
+CInitCondScheduler::Register( const CPoint3D& cPos, double radius )
+{
+	int slot;
+	if( m_freeSlots.empty() )
+	{
+		slot = (int)m_entries.size();
+		m_entries.push_back( TEntry() );
+	}
+	else
+	{
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+
+	TEntry& entry = m_entries[slot];
+	entry.x = cPos.m_x;
+	entry.y = cPos.m_y;
+	entry.radius = radius;
+	entry.inRadiusFrame = m_frame - 1;
+	entry.cells.clear();
+
+	double reach = fabs( radius );
+	int minX = CellOf( entry.x - reach );
+	int maxX = CellOf( entry.x + reach );
+	int minY = CellOf( entry.y - reach );
+	int maxY = CellOf( entry.y + reach );
+	double numCells = ( (double)maxX - minX + 1 ) * ( (double)maxY - minY + 1 );
+
+	entry.wide = numCells > cINITCOND_MAX_CELLS;
+	if( entry.wide )
+	{
+		m_wide.push_back( slot );
+	}
+	else
+	{
+		int cx, cy;
+		for( cx = minX; cx <= maxX; cx++ )
+		{
+			for( cy = minY; cy <= maxY; cy++ )
+			{
+				long long key = CellKey( cx, cy );
+				m_grid[key].push_back( slot );
+				entry.cells.push_back( key );
+			}
+		}
+	}
+
+	// a registration made after this frame's refresh has to be checked
+	// now, otherwise it would miss a frame in which it is in range
+	if( m_refreshed && m_pCved )
+	{
+		CPoint3D ownVehPos( 0, 0, 0 );
+		if( m_pCved->GetOwnVehiclePos( ownVehPos ) )
+		{
+			Check( slot, ownVehPos.m_x, ownVehPos.m_y, m_frame );
+		}
+	}
+
+	return slot;
+}
+
+void
+CInitCondScheduler::Unregister( int slot )
+{
+	if( slot < 0 || slot >= (int)m_entries.size() )  return;
+
+	TEntry& entry = m_entries[slot];
+	if( entry.wide )
+	{
+		RemoveSlot( m_wide, slot );
+	}
+	else
+	{
+		vector<long long>::const_iterator i;
+		for( i = entry.cells.begin(); i != entry.cells.end(); i++ )
+		{
+			unordered_map<long long, vector<int> >::iterator cell = m_grid.find( *i );
+			if( cell == m_grid.end() )  continue;
+
+			RemoveSlot( cell->second, slot );
+			if( cell->second.empty() )  m_grid.erase( cell );
+		}
+	}
+	entry.cells.clear();
+	m_freeSlots.push_back( slot );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Tells whether a registration was made with the given
+//  position and radius.
+//
+/////////////////////////////////////////////////////////////////////////////
+bool
+CInitCondScheduler::Matches( int slot, const CPoint3D& cPos, double radius ) const
+{
+	const TEntry& entry = m_entries[slot];
+	return entry.x == cPos.m_x && entry.y == cPos.m_y && entry.radius == radius;
+}
+
+void
+CInitCondScheduler::Check( int slot, double ovX, double ovY, int frame )
+{
+	TEntry& entry = m_entries[slot];
+	const CPoint2D cPos2d( entry.x, entry.y );
+	double distSq = cPos2d.DistSq( CPoint2D( ovX, ovY ) );
+	if( distSq < entry.radius * entry.radius )
+	{
+		entry.inRadiusFrame = frame;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Reads the own vehicle position and marks the registrations
+//  that have it within their radius.
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CInitCondScheduler::Refresh( const CVED::CCved& cCved, int frame )
+{
+	m_pCved = &cCved;
+	m_frame = frame;
+	m_refreshed = true;
+
+	CPoint3D ownVehPos( 0, 0, 0 );
+	if( !cCved.GetOwnVehiclePos( ownVehPos ) )  return;
+
+	long long key = CellKey( CellOf( ownVehPos.m_x ), CellOf( ownVehPos.m_y ) );
+	unordered_map<long long, vector<int> >::const_iterator cell = m_grid.find( key );
+	vector<int>::const_iterator i;
+	if( cell != m_grid.end() )
+	{
+		for( i = cell->second.begin(); i != cell->second.end(); i++ )
+		{
+			Check( *i, ownVehPos.m_x, ownVehPos.m_y, frame );
+		}
+	}
+	for( i = m_wide.begin(); i != m_wide.end(); i++ )
+	{
+		Check( *i, ownVehPos.m_x, ownVehPos.m_y, frame );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns true if the own vehicle is within the radius of a
+//  registered object at the given frame.
+//
+// Remarks: The first call for a frame refreshes the scheduler, so the own
+//  vehicle position is read from CVED once per frame rather than once
+//  per waiting object.
+//
+// Arguments:
+//  slot  - the registration
+//  cCved - the cved instance holding the own vehicle
+//  frame - the current frame
+//
+/////////////////////////////////////////////////////////////////////////////
+bool
+CInitCondScheduler::IsInRadius( int slot, const CVED::CCved& cCved, int frame )
+{
+	if( !m_refreshed || frame != m_frame || &cCved != m_pCved )
+	{
+		Refresh( cCved, frame );
+	}
+	return m_entries[slot].inRadiusFrame == frame;
+}
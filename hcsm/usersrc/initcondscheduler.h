@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: initcondscheduler.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The definition of the class CInitCondScheduler, which
+//              decides once per frame which of the objects waiting on
+//              their creation radius have the own vehicle inside it.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _INITCONDSCHEDULER_H_
+#define _INITCONDSCHEDULER_H_
+
+#include <point3d.h>
+#include <cved.h>
+#include <vector>
+#include <unordered_map>
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Objects in the eWAIT state register their position and creation radius
+// here.  Each registration is filed under every cell of a uniform grid
+// that its radius touches, so that once per frame the scheduler reads the
+// own vehicle position, looks up the one cell it is in and computes the
+// distance only for the registrations filed under that cell.  All other
+// waiting objects are known to be out of range without any work.
+//
+// Registrations whose radius covers too many cells are kept in a separate
+// list that is checked every frame.
+//
+// Each collection owns one scheduler, reached through
+// CHcsmCollection::GetInitCondScheduler.
+//
+class CInitCondScheduler
+{
+public:
+	CInitCondScheduler();
+
+	int  Register( const CPoint3D& cPos, double radius );
+	void Unregister( int slot );
+	bool Matches( int slot, const CPoint3D& cPos, double radius ) const;
+	bool IsInRadius( int slot, const CVED::CCved& cCved, int frame );
+
+private:
+	CInitCondScheduler( const CInitCondScheduler& );
+	CInitCondScheduler& operator=( const CInitCondScheduler& );
+
+	struct TEntry {
+		double             x;
+		double             y;
+		double             radius;
+		bool               wide;		// in m_wide instead of the grid
+		int                inRadiusFrame;
+		vector<long long>  cells;
+	};
+
+	static long long CellKey( int cx, int cy );
+	static int       CellOf( double v );
+	void             Refresh( const CVED::CCved& cCved, int frame );
+	void             Check( int slot, double ovX, double ovY, int frame );
+	static void      RemoveSlot( vector<int>& list, int slot );
+
+	vector<TEntry>                          m_entries;
+	vector<int>                             m_freeSlots;
+	unordered_map<long long, vector<int> >  m_grid;
+	vector<int>                             m_wide;
+	const CVED::CCved*                      m_pCved;	// cved of last refresh
+	int                                     m_frame;	// frame of last refresh
+	bool                                    m_refreshed;
+};
+
+#endif // _INITCONDSCHEDULER_H_
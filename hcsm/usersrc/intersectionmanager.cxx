@@ -406,17 +406,16 @@ CIntersectionManager::UserPreActivity(
 		//
 		// Get the prioritized corridors list for the current intersection.
 		//
-		static vector<TCrdrPriorityList> crdrList;
-		crdrList.clear();
-		intrsctn.PrioritizeCorridors( crdrList );
+		m_crdrList.clear();
+		intrsctn.PrioritizeCorridors( m_crdrList );
 
 #if 0 //def DEBUG_PREACTIVITY
 		gout << "  the crdr priority list:" << endl;
 		int crdrId;
 		vector<TCrdrPriorityList>::iterator crdrListNode;
 		for( 
-			crdrId = 0, crdrListNode = crdrList.begin(); 
-			crdrListNode != crdrList.end();
+			crdrId = 0, crdrListNode = m_crdrList.begin(); 
+			crdrListNode != m_crdrList.end();
 			crdrId++, crdrListNode++
 			)
 		{
@@ -434,24 +433,23 @@ CIntersectionManager::UserPreActivity(
 		}
 #endif
 
-		static vector<TVehiclePriorityList> vehPriorityList;
-		vehPriorityList.clear();
+		m_vehPriorityList.clear();
 		PrioritizeVehicles( 
 					intrsctn,
 					m_activeIntrsctns[i].m_objs,
 					m_activeIntrsctns[i].m_objInfo,
-					crdrList, 
+					m_crdrList, 
 					objMask,
-					vehPriorityList,
+					m_vehPriorityList,
 					m_activeIntrsctns[i].m_removeObjs
 					);
 
 #ifdef DEBUG_PREACTIVITY
 		{
-			gout << "  vehicle priority list [size = " << vehPriorityList.size() << "]";
+			gout << "  vehicle priority list [size = " << m_vehPriorityList.size() << "]";
 			gout << endl;
 			vector<TVehiclePriorityList>::iterator i;
-			for( i = vehPriorityList.begin(); i != vehPriorityList.end(); i++ )
+			for( i = m_vehPriorityList.begin(); i != m_vehPriorityList.end(); i++ )
 			{
 				TVehiclePriorityList node = *i;
 				gout << "    " << node.objId << ":";
@@ -483,7 +481,7 @@ CIntersectionManager::UserPreActivity(
 		gout << endl;
 #endif
 
-		SignalVehicles( intrsctn, vehPriorityList );
+		SignalVehicles( intrsctn, m_vehPriorityList );
 	}
 
 }  // end of UserPreActivity
@@ -1093,8 +1091,7 @@ CIntersectionManager::PrioritizeVehicles(
 		
 		vector<int> interCrdrIds = cCrdrList[objCrdrId].intrsctingCrdrs;
 
-		static vector<TAttachedList> vec;
-		vec.clear();
+		m_attachedList.clear();
 		vector<int>::iterator j;
 		for( j = interCrdrIds.begin(); j != interCrdrIds.end(); j++ )
 		{
@@ -1545,7 +1542,7 @@ CIntersectionManager::PrioritizeVehicles(
 #endif
 	
 			list.priority = otherVehicleHasPriority;
-			vec.push_back( list );
+			m_attachedList.push_back( list );
 
 
 #ifdef DEBUG_PRIORITIZE_VEHICLES
@@ -1565,7 +1562,7 @@ CIntersectionManager::PrioritizeVehicles(
 
  		TVehiclePriorityList node;
 		node.objId = objId;
-		node.vehicleList = vec;
+		node.vehicleList = m_attachedList;
 		node.hldOfsDist = distToHldOfs;
 		node.stopDueToLight = stopDueToLight; 
 		node.stopDueToAvoidCollision = stopDueToAvoidCollision;
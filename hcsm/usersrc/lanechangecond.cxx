@@ -15,6 +15,7 @@
  ****************************************************************************/
 
 #include "lanechangecond.h"
+#include "hcsmcheckpoint.h"
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -105,3 +106,68 @@ CLaneChangeCond::~CLaneChangeCond()
 
 
 }
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves the condition in a checkpoint.
+//
+// Remarks: The data is read back by RestoreState.
+//
+// Arguments:
+//   ckpt - The checkpoint.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChangeCond::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+
+	ckpt.Put( m_active );
+	ckpt.Put( m_urgency );
+	ckpt.Put( m_isTargLane );
+	ckpt.Put( m_targLane );
+	ckpt.Put( m_targCrdr );
+	ckpt.Put( m_type );
+	ckpt.Put( m_leftLaneChange );
+	ckpt.Put( m_isForcedLaneOffset );
+	ckpt.Put( m_forcedLaneOffset );
+	ckpt.Put( m_skipSignal );
+	ckpt.Put( m_isFinishing );
+	ckpt.Put( m_scenarioInducedAbort );
+
+}  // end of SaveState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Restores the condition from a checkpoint.
+//
+// Remarks: 
+//
+// Arguments:
+//   ckpt  - The checkpoint.
+//   cCved - The CVED instance the target lane and corridor belong to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChangeCond::RestoreState( CHcsmCheckpoint& ckpt, const CCved& cCved )
+{
+
+	ckpt.Get( m_active );
+	ckpt.Get( m_urgency );
+	ckpt.Get( m_isTargLane );
+	ckpt.Get( m_targLane, cCved );
+	ckpt.Get( m_targCrdr, cCved );
+	ckpt.Get( m_type );
+	ckpt.Get( m_leftLaneChange );
+	ckpt.Get( m_isForcedLaneOffset );
+	ckpt.Get( m_forcedLaneOffset );
+	ckpt.Get( m_skipSignal );
+	ckpt.Get( m_isFinishing );
+	ckpt.Get( m_scenarioInducedAbort );
+
+}  // end of RestoreState
@@ -29,6 +29,8 @@
 #include <cvedpub.h>
 using namespace CVED;
 
+class CHcsmCheckpoint;
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // This class contains the functionality than an ADO needs to keep track
@@ -81,6 +83,9 @@ public:
     inline void   SetFinishing(bool);
     inline void   SetScenarioInducedAbort(bool);
     inline bool   GetScenarioInducedAbort();
+
+	void SaveState( CHcsmCheckpoint& ) const;
+	void RestoreState( CHcsmCheckpoint&, const CCved& );
 	
 private:
 	bool         m_active;
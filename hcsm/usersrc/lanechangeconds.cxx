@@ -22,6 +22,7 @@
 #include "hcsmcollection.h"
 #include "ado_lc_data.h"
 #include "support.h"
+#include "hcsmcheckpoint.h"
 
 
 #undef DEBUG_CHECK_PATH_GUIDANCE            //17  // needs CVED id
@@ -81,7 +82,15 @@ ComputeUrgency( const double cDistToIntrsctn, const double cUrgency )
 CLaneChangeConds::CLaneChangeConds() :
 	m_pCved( NULL ),
 	m_pRootCollection( NULL ),
-	m_slowLcWaitStartFrame( -1 )
+	m_slowLcWaitStartFrame( -1 ),
+	m_nextDiscretionaryFrame( -1 ),
+	m_lastLeadObjId( -1 ),
+	m_lastOnRoad( false ),
+	m_lastLaneOrCrdrId( -1 ),
+	m_lastPrevLcCompleteFrame( -1 ),
+	m_lastNumMergeInfo( 0 ),
+	m_lastVel( 0.0 ),
+	m_lastTargVel( 0.0 )
 {
 
 	//
@@ -140,6 +149,14 @@ CLaneChangeConds::operator=( const CLaneChangeConds& cObjToCopy )
 		m_pCved = cObjToCopy.m_pCved;
 		m_pRootCollection = cObjToCopy.m_pRootCollection;
 		m_slowLcWaitStartFrame = cObjToCopy.m_slowLcWaitStartFrame;	
+		m_nextDiscretionaryFrame = cObjToCopy.m_nextDiscretionaryFrame;
+		m_lastLeadObjId = cObjToCopy.m_lastLeadObjId;
+		m_lastOnRoad = cObjToCopy.m_lastOnRoad;
+		m_lastLaneOrCrdrId = cObjToCopy.m_lastLaneOrCrdrId;
+		m_lastPrevLcCompleteFrame = cObjToCopy.m_lastPrevLcCompleteFrame;
+		m_lastNumMergeInfo = cObjToCopy.m_lastNumMergeInfo;
+		m_lastVel = cObjToCopy.m_lastVel;
+		m_lastTargVel = cObjToCopy.m_lastTargVel;
 	}
 
 	return *this;
@@ -456,6 +473,87 @@ CLaneChangeConds::IsLeftLaneChange(
 
 }  // end of IsLeftLaneChange
 
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves the conditions and the discretionary check schedule
+//   in a checkpoint.
+//
+// Remarks: The data is read back by RestoreState.
+//
+// Arguments:
+//   ckpt - The checkpoint.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChangeConds::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+
+	ckpt.Put( (int) m_conditions.size() );
+	TLcConditions::const_iterator i;
+	for( i = m_conditions.begin(); i != m_conditions.end(); i++ ) 
+	{
+		ckpt.Put( i->first );
+		i->second.SaveState( ckpt );
+	}
+
+	ckpt.Put( m_slowLcWaitStartFrame );
+	ckpt.Put( m_nextDiscretionaryFrame );
+	ckpt.Put( m_lastLeadObjId );
+	ckpt.Put( m_lastOnRoad );
+	ckpt.Put( m_lastLaneOrCrdrId );
+	ckpt.Put( m_lastPrevLcCompleteFrame );
+	ckpt.Put( (int) m_lastNumMergeInfo );
+	ckpt.Put( m_lastVel );
+	ckpt.Put( m_lastTargVel );
+
+}  // end of SaveState
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Restores the conditions and the discretionary check 
+//   schedule from a checkpoint.
+//
+// Remarks: Conditions that already exist are overwritten in place, so 
+//   references obtained through GetCondition remain valid.
+//
+// Arguments:
+//   ckpt  - The checkpoint.
+//   cCved - The CVED instance the conditions refer to.
+//
+// Returns:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CLaneChangeConds::RestoreState( CHcsmCheckpoint& ckpt, const CCved& cCved )
+{
+
+	int size = 0;
+	ckpt.Get( size );
+	for( int i = 0; i < size && ckpt.IsValid(); i++ ) 
+	{
+		ELcCondition type = eLC_NONE;
+		ckpt.Get( type );
+		m_conditions[type].RestoreState( ckpt, cCved );
+	}
+
+	int numMergeInfo = 0;
+	ckpt.Get( m_slowLcWaitStartFrame );
+	ckpt.Get( m_nextDiscretionaryFrame );
+	ckpt.Get( m_lastLeadObjId );
+	ckpt.Get( m_lastOnRoad );
+	ckpt.Get( m_lastLaneOrCrdrId );
+	ckpt.Get( m_lastPrevLcCompleteFrame );
+	ckpt.Get( numMergeInfo );
+	m_lastNumMergeInfo = numMergeInfo;
+	ckpt.Get( m_lastVel );
+	ckpt.Get( m_lastTargVel );
+
+}  // end of RestoreState
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Checks if a lane change is necessary due to an 
@@ -3738,6 +3836,81 @@ CLaneChangeConds::CheckNonPassingLane(
 
 }  // end of CheckNonPassingLane
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Decides if the discretionary lane change conditions
+//   should be checked this frame.
+//
+// Remarks: Most frames these checks reach the same decision as the frame
+//   before, and they are the expensive ones since they scan the lanes
+//   around the ADO.  They are run on a fixed schedule, and sooner when
+//   one of the inputs they depend on changes.  See
+//   cLC_DISCRETIONARY_PERIOD.
+//
+// Arguments:
+//   cInfo  - Vehicle information.
+//   currentFrame - The simulation's current frame of execution.
+//   freeDriveTargVel - The target velocity according to FreeDrive.
+//
+// Returns: A boolean indicating if the checks should be run.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CLaneChangeConds::DiscretionaryChecksDue( 
+			const CAdoInfo& cInfo, 
+			long currentFrame,
+			double freeDriveTargVel
+			)
+{
+	bool onRoad = cInfo.m_roadPos.IsRoad();
+	int laneOrCrdrId = (
+				onRoad ? 
+				cInfo.m_roadPos.GetLane().GetId() : 
+				cInfo.m_roadPos.GetCorridor().GetId()
+				);
+
+	bool firstCheck = m_nextDiscretionaryFrame < 0;
+	bool due = (
+				firstCheck ||
+				currentFrame >= m_nextDiscretionaryFrame ||
+				m_conditions[eLC_NONPASSING_LANE].GetActive() ||
+				m_conditions[eLC_SLOW_VEHICLE].GetActive() ||
+				m_conditions[eLC_VERY_SLOW_VEHICLE].GetActive() ||
+				m_conditions[eLC_HIGHWAY_MERGE].GetActive() ||
+				m_conditions[eLC_AVOID_MERGING_VEHICLE].GetActive() ||
+				cInfo.m_followTarget != m_lastLeadObjId ||
+				onRoad != m_lastOnRoad ||
+				laneOrCrdrId != m_lastLaneOrCrdrId ||
+				cInfo.m_prevLcCompleteFrame != m_lastPrevLcCompleteFrame ||
+				cInfo.m_mergeInfo.size() != m_lastNumMergeInfo ||
+				fabs( cInfo.m_currVel - m_lastVel ) > cLC_RECHECK_VEL_DELTA ||
+				fabs( freeDriveTargVel - m_lastTargVel ) > cLC_RECHECK_VEL_DELTA
+				);
+	if( !due )  return false;
+
+	//
+	// Schedule the next check.  The first one picks the ADO's place in
+	// the rotation, which it keeps afterwards.
+	//
+	m_nextDiscretionaryFrame = currentFrame + cLC_DISCRETIONARY_PERIOD;
+	if( firstCheck )
+	{
+		m_nextDiscretionaryFrame -= 
+			cInfo.m_pObj->GetId() % cLC_DISCRETIONARY_PERIOD;
+	}
+
+	m_lastLeadObjId = cInfo.m_followTarget;
+	m_lastOnRoad = onRoad;
+	m_lastLaneOrCrdrId = laneOrCrdrId;
+	m_lastPrevLcCompleteFrame = cInfo.m_prevLcCompleteFrame;
+	m_lastNumMergeInfo = cInfo.m_mergeInfo.size();
+	m_lastVel = cInfo.m_currVel;
+	m_lastTargVel = freeDriveTargVel;
+
+	return true;
+}  // end of DiscretionaryChecksDue
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Check all lane change conditions.
@@ -3791,11 +3964,16 @@ CLaneChangeConds::CheckAllConditions(
 		CheckLosingCorridor( cInfo, m_conditions[eLC_LOSING_CORRIDOR] );
 	}
 
+	// far from the driver only the essential lane changes are evaluated
 	bool checkNonEssentialLaneChanges = (
 				cInfo.m_lcInhibitCount < 0 && 
-				cInfo.m_maintainGap.m_objId < 0
+				cInfo.m_maintainGap.m_objId < 0 &&
+				cInfo.m_lodLevel < cADO_LOD_NO_DISCRETIONARY_LC
 				);
-	if( checkNonEssentialLaneChanges )
+	if( 
+		checkNonEssentialLaneChanges && 
+		DiscretionaryChecksDue( cInfo, currentFrame, freeDriveTargVel ) 
+		)
 	{
 		if( cInfo.m_lcInfo.enableNonPassingLane )
 		{
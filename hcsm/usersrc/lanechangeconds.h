@@ -35,7 +35,19 @@ using namespace std;
 
 typedef map<ELcCondition, CLaneChangeCond> TLcConditions;
 
+// The discretionary lane change conditions (non-passing lane, slow and
+// very slow vehicles, highway merge, merging vehicles) are checked once
+// every cLC_DISCRETIONARY_PERIOD frames, with the ADOs spread evenly over
+// the frames.  They are checked right away when the ADO's lead vehicle,
+// lane or corridor, or merge situation changes, when it completes a lane
+// change, or when its speed or target speed has changed by more than
+// cLC_RECHECK_VEL_DELTA since the last check.  While one of them is
+// active they are checked every frame.
+const int    cLC_DISCRETIONARY_PERIOD = 4;
+const double cLC_RECHECK_VEL_DELTA = 1.0;    // m/s
+
 class CHcsmCollection;
+class CHcsmCheckpoint;
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -67,7 +79,11 @@ public:
 	bool AbortCondition( const CAdoInfo&, bool );
 	bool IsLeftLaneChange( const CLane&, const CLane& );
 
+	void SaveState( CHcsmCheckpoint& ) const;
+	void RestoreState( CHcsmCheckpoint&, const CCved& );
+
 private:
+	bool DiscretionaryChecksDue( const CAdoInfo&, long, double );
 	bool GetLeadObjectId( const CAdoInfo&, vector<int>&, int& );
 	void InsertCondition( const ELcCondition, const CLaneChangeCond& );
 	void CheckExternalCommand( const CAdoInfo&, CLaneChangeCond& );
@@ -110,6 +126,16 @@ private:
 	CHcsmCollection* m_pRootCollection;
 	long m_slowLcWaitStartFrame;    // frame # in which vehicle started waiting
 
+	// discretionary check schedule, and the inputs at the last check
+	long   m_nextDiscretionaryFrame;
+	int    m_lastLeadObjId;
+	bool   m_lastOnRoad;
+	int    m_lastLaneOrCrdrId;
+	long   m_lastPrevLcCompleteFrame;
+	size_t m_lastNumMergeInfo;
+	double m_lastVel;
+	double m_lastTargVel;
+
 };
 
 #endif // __CLANECHANGECONDS_H
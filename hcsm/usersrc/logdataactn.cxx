@@ -113,8 +113,8 @@ void
 CLogDataActn::Execute( const set<CCandidate>* )
 {
 	// Call global function
-	LogData( m_streamNum, m_streamVal );
+	LogData( m_pHC, m_streamNum, m_streamVal );
 
 	// set the activity log
-	CHcsmCollection::SetActionLogDataLog( m_triggerId, m_streamNum, m_streamVal );
+	m_pHC->SetActionLogDataLog( m_triggerId, m_streamNum, m_streamVal );
 }
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: mergegaptable.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The implementation of the class CMergeGapTable.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "mergegaptable.h"
+#include "util.h"
+
+using namespace CVED;
+
+CMergeGapTable::CMergeGapTable()
+{
+	m_pCved     = 0;
+	m_frame     = -1;
+	m_numPoints = 0;
+}
+
+CMergeGapTable::~CMergeGapTable() {}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns an approaching vehicle's distance and time to
+//  arrival at a merge point.
+//
+// Remarks: The values are computed the first time a vehicle is asked
+//  for in a frame, in the same way the Merge HCSM computed them itself.
+//  Vehicles on the intersection measure their distance along the target
+//  corridor; the others are on its source road.
+//
+// Arguments:
+//  cved      - the CVED instance
+//  frame     - the current frame; the table starts over when it changes
+//  targCrdr  - the corridor the ADO merges into
+//  distAtP1  - the distance of P1 along the target corridor (feet)
+//  cObj      - the vehicle, from the ADO's approaching objects list
+//
+// Returns: a copy of the vehicle's entry
+//
+/////////////////////////////////////////////////////////////////////////////
+TMergeApprchObj
+CMergeGapTable::Get(
+			CCved& cved,
+			long frame,
+			const CCrdr& targCrdr,
+			double distAtP1,
+			const CCved::TObjListInfo& cObj
+			)
+{
+	if( frame != m_frame || &cved != m_pCved )
+	{
+		m_frame     = frame;
+		m_pCved     = &cved;
+		m_numPoints = 0;
+	}
+
+	TMergePoint& point = FindPoint( targCrdr, distAtP1 );
+
+	int lo = 0;
+	int hi = (int) point.objs.size();
+	while( lo < hi )
+	{
+		int mid = ( lo + hi ) / 2;
+		if( point.objs[mid].objId < cObj.objId )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if( lo < (int) point.objs.size() && point.objs[lo].objId == cObj.objId )
+	{
+		return point.objs[lo];
+	}
+
+	TMergeApprchObj entry;
+	entry.objId = cObj.objId;
+	if( !cObj.isOnRoad )
+	{
+		entry.distToP1 = point.distAtP1 - cObj.objDist;
+	}
+	else if( point.srcLnPos )
+	{
+		entry.distToP1 = point.srcRdLength - cObj.objDist + point.distAtP1;
+	}
+	else
+	{
+		entry.distToP1 = cObj.objDist + point.distAtP1;
+	}
+
+	const CDynObj* pObj = cved.BindObjIdToClass( cObj.objId );
+	if( !pObj || !pObj->IsValid() )
+	{
+		entry.tta = -1;
+	}
+	else
+	{
+		double vel = pObj->GetVelImm();
+		entry.tta = vel > cNEAR_ZERO ? entry.distToP1 * cFEET_TO_METER / vel : 1000.0;
+	}
+
+	point.objs.insert( point.objs.begin() + lo, entry );
+	return entry;
+}
+
+CMergeGapTable::TMergePoint&
+CMergeGapTable::FindPoint( const CCrdr& targCrdr, double distAtP1 )
+{
+	int crdrId = targCrdr.GetId();
+
+	int i;
+	for( i = 0; i < m_numPoints; i++ )
+	{
+		TMergePoint& point = m_points[i];
+		if( point.crdrId == crdrId && point.distAtP1 == distAtP1 )  return point;
+	}
+
+	if( m_numPoints == (int) m_points.size() )  m_points.resize( m_numPoints + 1 );
+	TMergePoint& point = m_points[m_numPoints++];
+
+	CLane srcLn = targCrdr.GetSrcLn();
+	point.crdrId      = crdrId;
+	point.distAtP1    = distAtP1;
+	point.srcLnPos    = srcLn.GetDirection() == ePOS;
+	point.srcRdLength = srcLn.GetRoad().GetLinearLength();
+	point.objs.clear();
+
+	return point;
+}
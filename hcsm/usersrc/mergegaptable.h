@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: mergegaptable.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The definition of the class CMergeGapTable, which shares
+//              the approaching vehicles' distances and times to arrival
+//              at a merge point among the ADOs merging there.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _MERGEGAPTABLE_H_
+#define _MERGEGAPTABLE_H_
+
+#include <cvedpub.h>
+#include <vector>
+using namespace std;
+
+//
+// An approaching vehicle as seen from a merge point.
+//
+struct TMergeApprchObj {
+	int    objId;
+	double distToP1;		// feet, negative once past the point
+	double tta;				// seconds; 1000 if stopped, -1 if not valid
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// The Merge HCSM of every ADO on a merge road works out, each frame, how
+// far each vehicle approaching on the target corridor is from the merge
+// point P1 and when it will get there.  These values only depend on the
+// vehicle and the merge point, so on a busy ramp all the merging ADOs
+// compute the same numbers.  This table computes them once per frame
+// per merge point and hands them out to the rest.
+//
+// A merge point is the target corridor and the distance of P1 along it.
+// The vehicles of a merge point are kept sorted by CVED id and found with
+// a binary search.  The storage is reused from frame to frame, so entries
+// are handed out by value.
+//
+// Each collection owns one table, reached through
+// CHcsmCollection::GetMergeGapTable.
+//
+class CMergeGapTable
+{
+public:
+	CMergeGapTable();
+	~CMergeGapTable();
+
+	TMergeApprchObj Get(
+				CVED::CCved& cved,
+				long frame,
+				const CVED::CCrdr& targCrdr,
+				double distAtP1,
+				const CVED::CCved::TObjListInfo& cObj
+				);
+
+private:
+	struct TMergePoint {
+		int                      crdrId;
+		double                   distAtP1;
+		bool                     srcLnPos;		// source lane runs along +
+		double                   srcRdLength;
+		vector<TMergeApprchObj>  objs;			// sorted by objId
+	};
+
+	TMergePoint& FindPoint( const CVED::CCrdr& targCrdr, double distAtP1 );
+
+	const CVED::CCved*   m_pCved;
+	long                 m_frame;
+	vector<TMergePoint>  m_points;
+	int                  m_numPoints;			// used this frame
+
+	CMergeGapTable( const CMergeGapTable& );
+	CMergeGapTable& operator=( const CMergeGapTable& );
+};
+
+#endif // _MERGEGAPTABLE_H_
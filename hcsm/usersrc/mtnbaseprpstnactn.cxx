@@ -35,6 +35,7 @@ CMtnBasePrpstnActn::CMtnBasePrpstnActn(
 			CHcsmCollection* pHc
 			)
 {
+	m_pHC = pHc;
 	m_delay = cpBlock->GetDelay();
 	m_pos = CActionParseBlock::StringToPreposition(
 									cpBlock->GetMotionPreposition()
@@ -91,6 +92,7 @@ CMtnBasePrpstnActn::operator=( const CMtnBasePrpstnActn& cRhs )
 	if( this != &cRhs )
 	{
 		m_pos = cRhs.m_pos;
+		m_pHC = cRhs.m_pHC;
 	}
 
 	return *this;
@@ -110,16 +112,16 @@ CMtnBasePrpstnActn::operator=( const CMtnBasePrpstnActn& cRhs )
 void 
 CMtnBasePrpstnActn::Execute( const set<CCandidate>* )
 {
-	CHcsmCollection::m_sSCC_Scen_Pos_X_Crossbeam = m_pos.crossbeam;
-	CHcsmCollection::m_sSCC_Scen_Pos_Y_Carriage = m_pos.carriage;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_X = m_pos.hexX;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Y = m_pos.hexY;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Z = m_pos.hexZ;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Roll = m_pos.hexRoll;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Pitch = m_pos.hexPitch;
-	CHcsmCollection::m_sSCC_Scen_Pos_Hex_Yaw = m_pos.hexYaw;
-	CHcsmCollection::m_sSCC_Scen_Pos_TT = m_pos.turntable;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_X_Crossbeam = m_pos.crossbeam;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Y_Carriage = m_pos.carriage;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_X = m_pos.hexX;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_Y = m_pos.hexY;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_Z = m_pos.hexZ;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_Roll = m_pos.hexRoll;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_Pitch = m_pos.hexPitch;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_Hex_Yaw = m_pos.hexYaw;
+	m_pHC->m_ctx.m_sSCC_Scen_Pos_TT = m_pos.turntable;
 
 	// set the activity log
-	CHcsmCollection::SetActionPreposMotionLog( m_triggerId );
+	m_pHC->SetActionPreposMotionLog( m_triggerId );
 }
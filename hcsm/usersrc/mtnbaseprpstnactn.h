@@ -35,6 +35,7 @@ public:
 
 protected:
 	CActionParseBlock::pbTMotionPreposition m_pos;
+	CHcsmCollection* m_pHC;
 };
 
 #endif	// _MTN_BASE_PRPSTN_ACTN_H_
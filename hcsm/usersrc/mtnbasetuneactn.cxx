@@ -34,9 +34,10 @@
 /////////////////////////////////////////////////////////////////////////////
 CMtnBaseTuneActn::CMtnBaseTuneActn(
 			const CActionParseBlock* cpBlock, 
-			CHcsmCollection*
+			CHcsmCollection* pHC
 			)
 {
+	m_pHC = pHC;
 	m_delay = cpBlock->GetDelay();
 }
 
@@ -89,7 +90,7 @@ CMtnBaseTuneActn::operator=( const CMtnBaseTuneActn &cRhs )
 
 	if( this != &cRhs )
 	{
-		;
+		m_pHC = cRhs.m_pHC;
 	}
 
 	return *this;
@@ -112,5 +113,5 @@ CMtnBaseTuneActn::Execute( const set<CCandidate>* )
 {
 	// Call global function
 	MotionBaseTune();
-	CHcsmCollection::SetActionTuneMotionLog( m_triggerId );
+	m_pHC->SetActionTuneMotionLog( m_triggerId );
 }
@@ -45,6 +45,7 @@ public:
 	inline const char* GetName() const { return "MotionBaseTune"; };
 
 protected:
+	CHcsmCollection* m_pHC;
 };
 
 #endif	// _MTN_BASE_TUNE_ACTN_H_
@@ -16,6 +16,8 @@
 
 #include "hcsmpch.h"
 #include "objectinitcond.h"
+#include "initcondscheduler.h"
+#include "hcsmcheckpoint.h"
 #include <math.h>
 
 /////////////////////////////////////////////////////////////////////////////
@@ -38,6 +40,46 @@ CObjectInitCond::CObjectInitCond()
 	m_objectState = eEXIT;
 	m_startLifetime = 0;	
 	m_startActivationTime = 0; 
+	m_pScheduler = 0;
+	m_waitSlot = -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: The copy constructor and assignment operator copy the
+// state but not the registration with the scheduler; the copy registers
+// itself the next time it is executed while waiting.
+//
+/////////////////////////////////////////////////////////////////////////////
+CObjectInitCond::CObjectInitCond( const CObjectInitCond& cRhs )
+{
+	m_pScheduler = 0;
+	m_waitSlot = -1;
+	*this = cRhs;
+}
+
+CObjectInitCond&
+CObjectInitCond::operator=( const CObjectInitCond& cRhs )
+{
+	if( this != &cRhs )
+	{
+		StopWaiting();
+		m_startLifetime = cRhs.m_startLifetime;
+		m_startActivationTime = cRhs.m_startActivationTime;
+		m_radius = cRhs.m_radius;
+		m_activationDelay = cRhs.m_activationDelay;
+		m_lifetime = cRhs.m_lifetime;
+		m_deltaT = cRhs.m_deltaT;
+		m_cCved = cRhs.m_cCved;
+		m_pScheduler = cRhs.m_pScheduler;
+		m_objectState = cRhs.m_objectState;
+	}
+	return *this;
+}
+
+CObjectInitCond::~CObjectInitCond()
+{
+	StopWaiting();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -48,8 +90,9 @@ CObjectInitCond::CObjectInitCond()
 //		the class with the parameters that are after used to 
 //		determinate in wich state the class is.
 //
-// Arguments: The actualTime, deltaT is the creation delay, radius is the 
-//		creation / deletion radius
+// Arguments: cCved is the CVED instance, scheduler is the creation radius
+//		scheduler of the owning collection, the actualTime, deltaT is the
+//		creation delay, radius is the creation / deletion radius
 //
 // Returns:
 //
@@ -57,6 +100,7 @@ CObjectInitCond::CObjectInitCond()
 void 
 CObjectInitCond::SetObjectInitCond(
 			const CVED::CCved& cCved, 
+			CInitCondScheduler& scheduler,
 			const int actualTime, 
 			double deltaT, 
 			double radius, 
@@ -65,6 +109,7 @@ CObjectInitCond::SetObjectInitCond(
 			)		
 {
 	
+	StopWaiting();
 	m_radius = radius;
 	m_activationDelay = activationDelay;
 	m_lifetime = lifetime;
@@ -72,6 +117,7 @@ CObjectInitCond::SetObjectInitCond(
 	m_deltaT = deltaT;
 	m_startActivationTime = actualTime; 
 	m_cCved = &cCved;
+	m_pScheduler = &scheduler;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -123,6 +169,41 @@ CObjectInitCond::InRadius( const CPoint3D& cObjPos )
 	return result;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// Same as InRadius, for use in the eWAIT state.  The object registers with
+// the scheduler the first time and again if its position changes, so
+// that it costs nothing while the ownship is far away.
+/////////////////////////////////////////////////////////////////////////////
+bool
+CObjectInitCond::WaitInRadius( const CPoint3D& cObjPos, int actualTime )
+{
+	bool noCreationRadius = fabs( m_radius ) < cNEAR_ZERO;
+	if( noCreationRadius )  return true;
+	if( !m_pScheduler )  return InRadius( cObjPos );
+
+	CInitCondScheduler& scheduler = *m_pScheduler;
+	if( m_waitSlot >= 0 && !scheduler.Matches( m_waitSlot, cObjPos, m_radius ) )
+	{
+		StopWaiting();
+	}
+	if( m_waitSlot < 0 )
+	{
+		m_waitSlot = scheduler.Register( cObjPos, m_radius );
+	}
+
+	return scheduler.IsInRadius( m_waitSlot, *m_cCved, actualTime );
+}
+
+void
+CObjectInitCond::StopWaiting()
+{
+	if( m_waitSlot >= 0 )
+	{
+		m_pScheduler->Unregister( m_waitSlot );
+		m_waitSlot = -1;
+	}
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Description: This function will be called at every HCSM step and will 
@@ -152,13 +233,14 @@ CObjectInitCond::Execute(
 			// If the distance is less then the creation radius it 
 			// increment the creation delay timer otherweise it set
 			// the creation delay timer to 0
-			if( InRadius( cObjPos ) )
+			if( WaitInRadius( cObjPos, actualTime ) )
 			{
 				// If the creation delay timer is higher than tha 
 				// creation delay the object goes to the Create state
 				deltaTime = (actualTime - m_startActivationTime) * m_deltaT;
 				if( deltaTime > m_activationDelay )
 				{
+					StopWaiting();
 					m_objectState = eACTIVATE;
 				}
 			}
@@ -210,3 +292,43 @@ CObjectInitCond::Execute(
 	return m_objectState;
 }
 	
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves or restores the state of the object in a checkpoint.
+//
+// Remarks: The registration with the scheduler is not saved; a restored
+//		object that is waiting registers again the next time it is
+//		executed.
+//
+// Arguments: ckpt is the checkpoint, cCved is the CVED instance that the
+//		restored object works with.
+//
+// Returns:
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CObjectInitCond::SaveState( CHcsmCheckpoint& ckpt ) const
+{
+	ckpt.Put( m_startLifetime );
+	ckpt.Put( m_startActivationTime );
+	ckpt.Put( m_radius );
+	ckpt.Put( m_activationDelay );
+	ckpt.Put( m_lifetime );
+	ckpt.Put( m_deltaT );
+	ckpt.Put( m_objectState );
+}
+
+void
+CObjectInitCond::RestoreState( CHcsmCheckpoint& ckpt, const CVED::CCved& cCved )
+{
+	StopWaiting();
+	ckpt.Get( m_startLifetime );
+	ckpt.Get( m_startActivationTime );
+	ckpt.Get( m_radius );
+	ckpt.Get( m_activationDelay );
+	ckpt.Get( m_lifetime );
+	ckpt.Get( m_deltaT );
+	ckpt.Get( m_objectState );
+	m_cCved = &cCved;
+}
@@ -21,6 +21,9 @@
 #include <point3d.h>
 #include <cved.h>
 
+class CHcsmCheckpoint;
+class CInitCondScheduler;
+
 // The different states that an instance of the class CObjectInitCond 
 // can be in.
 enum EInitCond { eWAIT, eACTIVATE, eUNDER_CONTROL, eDELETE, eEXIT };
@@ -32,13 +35,21 @@ enum EInitCond { eWAIT, eACTIVATE, eUNDER_CONTROL, eDELETE, eEXIT };
 // This parameters are the creation radius, the creation delay and the
 // lifetime.
 //
+// While waiting, the creation radius test is handed to the collection's
+// CInitCondScheduler, which reads the own vehicle position once a frame
+// and only measures distances for objects near it.
+//
 /////////////////////////////////////////////////////////////////////////////
 class CObjectInitCond 
 {
 public:
 	CObjectInitCond();
+	CObjectInitCond( const CObjectInitCond& );
+	CObjectInitCond& operator=( const CObjectInitCond& );
+	~CObjectInitCond();
 	void SetObjectInitCond(
 			const CVED::CCved& cved, 
+			CInitCondScheduler& scheduler,
 			const int actualTime,
 			double deltaT, 
 			double radius, 
@@ -48,9 +59,14 @@ public:
 	// This function will be called at every HCSM step and will return the
 	// next status of the object.
 	EInitCond Execute( const CPoint3D &objectPosition, const int actualTime );
+
+	void SaveState( CHcsmCheckpoint& ckpt ) const;
+	void RestoreState( CHcsmCheckpoint& ckpt, const CVED::CCved& cCved );
 	
 private: 
 	bool InRadius( const CPoint3D& pos );
+	bool WaitInRadius( const CPoint3D& pos, int actualTime );
+	void StopWaiting();
 
 	int m_startLifetime;        // The start time for the life time
 	int m_startActivationTime;  // The start time for the activation 
@@ -59,7 +75,9 @@ private:
 	double m_lifetime;          // How long will the object be alife
 	double m_deltaT;            // Time constant for each step
 	const CVED::CCved *m_cCved; // The reference to cved
+	CInitCondScheduler* m_pScheduler; // Scheduler of the owning collection
 	EInitCond m_objectState;    // The actual state of the object			
+	int m_waitSlot;             // Registration with the scheduler, or -1
 };
 
 
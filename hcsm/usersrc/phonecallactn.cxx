@@ -108,10 +108,10 @@ CPhoneCallActn::operator=( const CPhoneCallActn& cRhs )
 void 
 CPhoneCallActn::Execute( const set<CCandidate>* ) 
 {
-	CHcsmCollection::m_sPlacePhoneCallAge = 60;
-	CHcsmCollection::m_sSCC_PlacePhoneCall = 1;
+	m_pHC->m_ctx.m_sPlacePhoneCallAge = 60;
+	m_pHC->m_ctx.m_sSCC_PlacePhoneCall = 1;
 
 	// write the activity log
-	CHcsmCollection::SetActionPhoneCallLog( m_triggerId );
+	m_pHC->SetActionPhoneCallLog( m_triggerId );
 }
 
@@ -179,25 +179,25 @@ CPlayAudioActn::Execute( const set<CCandidate>* cpInstigators )
 
 
 	if (!m_started){
-		CHcsmCollection::m_sPlayAudioText = m_audio;
+		m_pHC->m_ctx.m_sPlayAudioText = m_audio;
 		stringstream converter;
 		int valOut = 0;
 		converter<<m_audio;
 		converter>>valOut;
 		// write activity log
-		CHcsmCollection::SetActionPlayAudioLog( m_triggerId );
-		//CHcsmCollection::m_sAudio_Trigger = valOut;
-		CHcsmCollection::m_sScenarioWriteCellData[CHcsmCollection::m_sScenarioWriteCellDataSize].cellName = "SCC_Audio_Trigger";
-		CHcsmCollection::m_sScenarioWriteCellData[CHcsmCollection::m_sScenarioWriteCellDataSize].intData.clear();
-		CHcsmCollection::m_sScenarioWriteCellData[CHcsmCollection::m_sScenarioWriteCellDataSize].intData.push_back(valOut);
-		CHcsmCollection::m_sScenarioWriteCellData[CHcsmCollection::m_sScenarioWriteCellDataSize].cellData = m_audio;
-		CHcsmCollection::m_sScenarioWriteCellData[CHcsmCollection::m_sScenarioWriteCellDataSize].frame = CHcsmCollection::m_frame;
-		CHcsmCollection::m_sScenarioWriteCellDataSize++;
+		m_pHC->SetActionPlayAudioLog( m_triggerId );
+		//m_pHC->m_ctx.m_sAudio_Trigger = valOut;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[m_pHC->m_ctx.m_sScenarioWriteCellDataSize].cellName = "SCC_Audio_Trigger";
+		m_pHC->m_ctx.m_sScenarioWriteCellData[m_pHC->m_ctx.m_sScenarioWriteCellDataSize].intData.clear();
+		m_pHC->m_ctx.m_sScenarioWriteCellData[m_pHC->m_ctx.m_sScenarioWriteCellDataSize].intData.push_back(valOut);
+		m_pHC->m_ctx.m_sScenarioWriteCellData[m_pHC->m_ctx.m_sScenarioWriteCellDataSize].cellData = m_audio;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[m_pHC->m_ctx.m_sScenarioWriteCellDataSize].frame = m_pHC->GetFrame();
+		m_pHC->m_ctx.m_sScenarioWriteCellDataSize++;
 		m_FrameCnt = 0;
 	}
 	m_FrameCnt++;
 	if (m_FrameCnt > 15){
-		CHcsmCollection::m_sAudio_Trigger = 0;
+		m_pHC->m_ctx.m_sAudio_Trigger = 0;
 		m_isFinished = true;
 	}
 
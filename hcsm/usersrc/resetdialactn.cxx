@@ -193,6 +193,6 @@ CResetDialActn::Execute( const set<CCandidate>* cpInstigators )
 #endif
 		}
 	}
-	CHcsmCollection::SetActionResetDialLog( m_triggerId, m_dialName );
+	m_pHC->SetActionResetDialLog( m_triggerId, m_dialName );
 }
 
@@ -40,6 +40,7 @@ CRoadPadTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object.
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								GetFrame(), 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -122,7 +122,7 @@ CSetButtonActn::Execute( const set<CCandidate>* cpInstigators )
 
 	m_candidateSet.GetCandidates( *(m_pHC->GetCved() ), candidateSet, *m_pHC );
 
-	CHcsmCollection::SetActionSetButtonLog( m_triggerId, m_buttonName );
+	m_pHC->SetActionSetButtonLog( m_triggerId, m_buttonName );
 
 	//
 	// If we use the instigator set and the user gave us a set of 
@@ -258,7 +258,7 @@ CSetDialActn::Execute( const set<CCandidate>* cpInstigators )
 		m_waitingForResetHcsm.clear();
 	}
 
-	CHcsmCollection::SetActionSetDialLog( m_triggerId, m_dialName, m_dialValue );
+	m_pHC->SetActionSetDialLog( m_triggerId, m_dialName, m_dialValue );
 
 	set<CCandidate> candidateSet;
  	m_candidateSet.GetCandidates( *(m_pHC->GetCved()), candidateSet, *m_pHC );
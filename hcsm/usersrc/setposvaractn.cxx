@@ -135,7 +135,7 @@ CSetPosVarActn::Execute( const set<CCandidate>* )
 		CVED::CCved* pCved= m_pHC->GetCved();
 		CPoint3D pos;
 		if (pCved->GetOwnVehiclePos(pos))
-			CHcsmCollection::SetExprPosVariable(m_varName,pos);
+			m_pHC->SetExprPosVariable(m_varName,pos);
 
 	}
 
@@ -45,6 +45,7 @@ CSetVarActn::CSetVarActn(
 	m_varValue = cpBlock->GetVarValue();
 	m_isExpr = cpBlock->GetIsVarValExpression();
     m_expr.cved = m_pHC->GetCved();
+    m_expr.m_pHC = m_pHC;
 	if (m_isExpr)
 		m_expr.Parse(m_varValue.c_str());
 }
@@ -108,6 +109,8 @@ CSetVarActn::operator=( const CSetVarActn& cRhs )
 			cRhs.m_expr.Store(temps);
 			m_expr.Load(temps);
 		}
+		m_expr.cved = cRhs.m_expr.cved;
+		m_expr.m_pHC = m_pHC;
 	}
 
 	return *this;
@@ -154,211 +157,211 @@ CSetVarActn::Execute( const set<CCandidate>* )
         }catch(...){
             gout<<"Unkown excpetion while evaluating "<<m_varValue<<endl;
         }
-		CHcsmCollection::SetExprVariable( m_varName, newValue );
-		CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, newValue );
+		m_pHC->SetExprVariable( m_varName, newValue );
+		m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, newValue );
 		return;
 	}
 	else if( m_varName == "VisualDisplayText" )
 	{
-		CHcsmCollection::SetVisualDisplayText( m_varValue );
+		m_pHC->SetVisualDisplayText( m_varValue );
 		// TO DO: need to set the action variable log....
 	}
 
 	else if (m_varName == "HapticSeat"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
-		CHcsmCollection::m_sHapticSeat_IsEnabled = (int)newValue;
+		m_pHC->m_ctx.m_sHapticSeat_IsEnabled = (int)newValue;
 	}
 
 	else if (m_varName == "SirenSpeed")
 	{
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
-		CHcsmCollection::m_sSirenSpeed = (int)newValue * cMPH_TO_MS;
+		m_pHC->m_ctx.m_sSirenSpeed = (int)newValue * cMPH_TO_MS;
 	}
 
 	// warning system statuses
 	else if (m_varName == "BswStatus"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue == 0)
-			CHcsmCollection::m_sBswStatus = eBSW_NONE;
+			m_pHC->m_ctx.m_sBswStatus = eBSW_NONE;
 		else if (newValue == 1)
-			CHcsmCollection::m_sBswStatus =  eBSW_LOW_LEFT;
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_LOW_LEFT;
 		else if (newValue == 2)
-			CHcsmCollection::m_sBswStatus =  eBSW_LOW_RIGHT;
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_LOW_RIGHT;
 		else if (newValue == 3)
-			CHcsmCollection::m_sBswStatus =  eBSW_LOW_BOTH;
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_LOW_BOTH;
 		else if (newValue == 4)
-			CHcsmCollection::m_sBswStatus =  eBSW_HIGH_LEFT; 
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_HIGH_LEFT; 
 		else if (newValue == 5)
-			CHcsmCollection::m_sBswStatus =  eBSW_HIGH_RIGHT; 
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_HIGH_RIGHT; 
 		else if (newValue == 6)
-			CHcsmCollection::m_sBswStatus =  eBSW_HIGH_BOTH;
+			m_pHC->m_ctx.m_sBswStatus =  eBSW_HIGH_BOTH;
 	}
 	else if (m_varName == "FcwStatus"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue == 0)
-			CHcsmCollection::m_sFcwStatus = eFCW_NONE;
+			m_pHC->m_ctx.m_sFcwStatus = eFCW_NONE;
 		else if (newValue == 1)
-			CHcsmCollection::m_sFcwStatus =  eFCW_LOW;
+			m_pHC->m_ctx.m_sFcwStatus =  eFCW_LOW;
 		else if (newValue == 2)
-			CHcsmCollection::m_sFcwStatus =  eFCW_HIGH;
+			m_pHC->m_ctx.m_sFcwStatus =  eFCW_HIGH;
 	}
 	else if (m_varName == "LdwStatus"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue == 0)
-			CHcsmCollection::m_sLdwStatus = eLDW_NONE;
+			m_pHC->m_ctx.m_sLdwStatus = eLDW_NONE;
 		else if (newValue == 1)
-			CHcsmCollection::m_sLdwStatus =  eLDW_MONITORING;
+			m_pHC->m_ctx.m_sLdwStatus =  eLDW_MONITORING;
 		else if (newValue == 2)
-			CHcsmCollection::m_sLdwStatus =  eLDW_LEFT;
+			m_pHC->m_ctx.m_sLdwStatus =  eLDW_LEFT;
 		else if (newValue == 3)
-			CHcsmCollection::m_sLdwStatus =  eLDW_RIGHT;
+			m_pHC->m_ctx.m_sLdwStatus =  eLDW_RIGHT;
 	}
 	else if (m_varName == "BackUpDistance"){
 		if (m_varValue == "--") {
-			newValue = CHcsmCollection::m_sBackUpDistance - 1;
+			newValue = m_pHC->m_ctx.m_sBackUpDistance - 1;
 		}else{
 			sscanf(m_varValue.c_str(), "%lf", &newValue);
 		}
-		CHcsmCollection::m_sBackUpDistance = (float)newValue;
+		m_pHC->m_ctx.m_sBackUpDistance = (float)newValue;
 	}
 	// warning cue configuration
 	else if (m_varName == "HapticSeat"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
-		CHcsmCollection::m_sHapticSeat_IsEnabled = (int)newValue;
+		m_pHC->m_ctx.m_sHapticSeat_IsEnabled = (int)newValue;
 	}
 	else if (m_varName == "FlashingLightMode"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue == 0.0)
-			CHcsmCollection::m_sFlashingLightMode = (CHcsmCollection::eNO_LIGHTS);
+			m_pHC->m_ctx.m_sFlashingLightMode = (CHcsmContext::eNO_LIGHTS);
 		else if (newValue == 1.0)
-			CHcsmCollection::m_sFlashingLightMode = (CHcsmCollection::eMIRROR_LIGHTS);
+			m_pHC->m_ctx.m_sFlashingLightMode = (CHcsmContext::eMIRROR_LIGHTS);
 		else if (newValue == 2.0)
-			CHcsmCollection::m_sFlashingLightMode = (CHcsmCollection::eA_PILLAR_LIGHTS);
+			m_pHC->m_ctx.m_sFlashingLightMode = (CHcsmContext::eA_PILLAR_LIGHTS);
 		else if (newValue == 3.0)
-			CHcsmCollection::m_sFlashingLightMode = (CHcsmCollection::eBOTH);
+			m_pHC->m_ctx.m_sFlashingLightMode = (CHcsmContext::eBOTH);
 	}
 	else if (m_varName == "BUDCameraMode"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue == 0)
-			CHcsmCollection::m_sBUDCameraDisplayMode =(CHcsmCollection::eNO_DISPLAY);
+			m_pHC->m_ctx.m_sBUDCameraDisplayMode =(CHcsmContext::eNO_DISPLAY);
 		else if (newValue == 1)
-			CHcsmCollection::m_sBUDCameraDisplayMode =(CHcsmCollection::eINSTRUMENT_PANEL);
+			m_pHC->m_ctx.m_sBUDCameraDisplayMode =(CHcsmContext::eINSTRUMENT_PANEL);
 		else if (newValue == 2)
-			CHcsmCollection::m_sBUDCameraDisplayMode =(CHcsmCollection::eINTERIOR_MIRROR);
+			m_pHC->m_ctx.m_sBUDCameraDisplayMode =(CHcsmContext::eINTERIOR_MIRROR);
 	}
 	else if (m_varName == "BSWCamera"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0) {
-			CHcsmCollection::m_sBSWCamera_IsEnabled = true;
+			m_pHC->m_ctx.m_sBSWCamera_IsEnabled = true;
 		}else {
-			CHcsmCollection::m_sBSWCamera_IsEnabled = false;
+			m_pHC->m_ctx.m_sBSWCamera_IsEnabled = false;
 		}
 	}
 	else if (m_varName == "IPAlert"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0) {
-			CHcsmCollection::m_sIPAlert_IsEnabled = true;
+			m_pHC->m_ctx.m_sIPAlert_IsEnabled = true;
 		}else {
-			CHcsmCollection::m_sIPAlert_IsEnabled = false;
+			m_pHC->m_ctx.m_sIPAlert_IsEnabled = false;
 		}
 	}
 	// warning system switch
 	else if (m_varName == "BUD_IsOn"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0){
-			CHcsmCollection::m_sBUD_IsOn = true;
+			m_pHC->m_ctx.m_sBUD_IsOn = true;
 		}else{
-			CHcsmCollection::m_sBUD_IsOn = false;
+			m_pHC->m_ctx.m_sBUD_IsOn = false;
 		}
 	}
 	else if (m_varName == "LCW_IsOn"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0){
-			CHcsmCollection::m_sLCW_IsOn = true;
+			m_pHC->m_ctx.m_sLCW_IsOn = true;
 		}else{
-			CHcsmCollection::m_sLCW_IsOn = false;
+			m_pHC->m_ctx.m_sLCW_IsOn = false;
 		}
 	}
 	else if (m_varName == "BLS_IsOn"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0){
-			CHcsmCollection::m_sBLS_IsOn = true;
+			m_pHC->m_ctx.m_sBLS_IsOn = true;
 		}else{
-			CHcsmCollection::m_sBLS_IsOn = false;
+			m_pHC->m_ctx.m_sBLS_IsOn = false;
 		}
 	}
 	else if (m_varName == "FCW_IsOn"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0){
-			CHcsmCollection::m_sFCW_IsOn = true;
+			m_pHC->m_ctx.m_sFCW_IsOn = true;
 		}else{
-			CHcsmCollection::m_sFCW_IsOn = false;
+			m_pHC->m_ctx.m_sFCW_IsOn = false;
 		}
 	}
 
 	else if (m_varName == "Hour"){
 		if ( m_varValue == "++" ){
-			CHcsmCollection::m_sHour++;
-			if (CHcsmCollection::m_sHour >= 24){
-				CHcsmCollection::m_sHour = 0;
+			m_pHC->m_ctx.m_sHour++;
+			if (m_pHC->m_ctx.m_sHour >= 24){
+				m_pHC->m_ctx.m_sHour = 0;
 			}
 		}
 		else{
 			sscanf(m_varValue.c_str(), "%lf", &newValue);
-			CHcsmCollection::m_sHour = (int)newValue;
+			m_pHC->m_ctx.m_sHour = (int)newValue;
 		}
-		CHcsmCollection::SetExprVariable( m_varName, CHcsmCollection::m_sHour );
-		CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sHour );
+		m_pHC->SetExprVariable( m_varName, m_pHC->m_ctx.m_sHour );
+		m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sHour );
 	}
 	else if (m_varName == "Minute"){
 		if ( m_varValue == "++" ){
-			CHcsmCollection::m_sMinute++;
-			if (CHcsmCollection::m_sMinute >= 60){
-				CHcsmCollection::m_sMinute = 0;
-				CHcsmCollection::m_sHour++;
-				if (CHcsmCollection::m_sHour >= 24){
-					CHcsmCollection::m_sHour = 0;
+			m_pHC->m_ctx.m_sMinute++;
+			if (m_pHC->m_ctx.m_sMinute >= 60){
+				m_pHC->m_ctx.m_sMinute = 0;
+				m_pHC->m_ctx.m_sHour++;
+				if (m_pHC->m_ctx.m_sHour >= 24){
+					m_pHC->m_ctx.m_sHour = 0;
 				}
 			}
-			CHcsmCollection::SetExprVariable( "Minute", CHcsmCollection::m_sMinute );
-			CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sMinute );
-			CHcsmCollection::SetExprVariable( "Hour", CHcsmCollection::m_sHour );
-			CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, CHcsmCollection::m_sHour );
+			m_pHC->SetExprVariable( "Minute", m_pHC->m_ctx.m_sMinute );
+			m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sMinute );
+			m_pHC->SetExprVariable( "Hour", m_pHC->m_ctx.m_sHour );
+			m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, m_pHC->m_ctx.m_sHour );
 		}
 		else{
 			sscanf(m_varValue.c_str(), "%lf", &newValue);
-			CHcsmCollection::m_sMinute = (int)newValue;
+			m_pHC->m_ctx.m_sMinute = (int)newValue;
 		}
 	}
 	else if (m_varName == "UpdateTime"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
 		if (newValue > 0){
-			CHcsmCollection::m_sChangeTimeOfDay = true;
+			m_pHC->m_ctx.m_sChangeTimeOfDay = true;
 		}else{
-			CHcsmCollection::m_sChangeTimeOfDay = false;
+			m_pHC->m_ctx.m_sChangeTimeOfDay = false;
 		}
 	}
 	else if (m_varName == "ACC_Range"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
-		CHcsmCollection::m_sSensor_Config[0] = (short)newValue;
+		m_pHC->m_ctx.m_sSensor_Config[0] = (short)newValue;
 	}
 	else if (m_varName == "ACC_ConeSize"){
 		sscanf(m_varValue.c_str(), "%lf", &newValue);
-		CHcsmCollection::m_sSensor_Config[1] = (short)newValue;
+		m_pHC->m_ctx.m_sSensor_Config[1] = (short)newValue;
 	}
 	else if (m_varName == "ACC_LaneCheck"){
 		if (m_varValue == "true")
-			CHcsmCollection::m_sSensor_Config[2] = 1;
+			m_pHC->m_ctx.m_sSensor_Config[2] = 1;
 		else if (m_varValue == "false")
-			CHcsmCollection::m_sSensor_Config[2] = 0;
+			m_pHC->m_ctx.m_sSensor_Config[2] = 0;
 		else{
 			sscanf(m_varValue.c_str(), "%lf", &newValue);
-			CHcsmCollection::m_sSensor_Config[2] = (short)newValue;
+			m_pHC->m_ctx.m_sSensor_Config[2] = (short)newValue;
 		}
 	}
 	else
 	{
-		double oldValue = CHcsmCollection::GetExprVariable(m_varName);
+		double oldValue = m_pHC->GetExprVariable(m_varName);
 		if (m_varValue == "++") {
 			newValue = oldValue + 1;
 		}
@@ -368,8 +371,8 @@ CSetVarActn::Execute( const set<CCandidate>* )
 		else {
 			sscanf(m_varValue.c_str(), "%lf", &newValue);
 		}
-		CHcsmCollection::SetExprVariable( m_varName, newValue );
-		CHcsmCollection::SetActionSetVariableLog( m_triggerId, m_varName, newValue );
+		m_pHC->SetExprVariable( m_varName, newValue );
+		m_pHC->SetActionSetVariableLog( m_triggerId, m_varName, newValue );
 	}
 }
 
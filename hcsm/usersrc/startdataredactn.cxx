@@ -125,12 +125,12 @@ CStartDataredActn::Execute( const set<CCandidate>* )
 			bitnum++;
 		}
 
-		int before = CHcsmCollection::m_sSCC_DataRed_Segments[blockNum];
-		CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] |= i->type;
-		if (CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] != before) {  // only run this if the data has actually changed.
-			CHcsmCollection::SetActionStartDataRedLog(m_triggerId, i->type + 32 * blockNum, i->data, &(i->data[8]) );
+		int before = m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum];
+		m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] |= i->type;
+		if (m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] != before) {  // only run this if the data has actually changed.
+			m_pHC->SetActionStartDataRedLog(m_triggerId, i->type + 32 * blockNum, i->data, &(i->data[8]) );
 //			gout << "START DATARED - " << i->type << ": " << i->data << " : " << &(i->data[8]) << endl;
-			int dataRedCounter = ++m_sDataRedCounter;
+			int dataRedCounter = ++m_pHC->m_ctx.m_sDataRedCounter;
 			HANDLE hThread = GetCurrentThread();
 			DWORD threadPri = GetThreadPriority(hThread);
 			//Begin Critical Section
@@ -143,11 +143,11 @@ CStartDataredActn::Execute( const set<CCandidate>* )
 			SetThreadPriority(hThread, REALTIME_PRIORITY_CLASS);
 
 //			gout << " (Count " << dataRedCounter << ")";
-			CHcsmCollection::m_sSCC_DataRed_Segments[0] = dataRedCounter;
+			m_pHC->m_ctx.m_sSCC_DataRed_Segments[0] = dataRedCounter;
 			
 			int copyTo = (cDR_COLSIZE + cDR_DATASIZE) * bitnum + ((blockNum-1) * (cDR_COLSIZE + cDR_DATASIZE) * 32);
-			memcpy( &CHcsmCollection::m_sSCC_DataRed_Params[copyTo], i->data, cDR_COLSIZE + cDR_DATASIZE);
-			memcpy( &CHcsmCollection::m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS], &dataRedCounter, sizeof(int));
+			memcpy( &m_pHC->m_ctx.m_sSCC_DataRed_Params[copyTo], i->data, cDR_COLSIZE + cDR_DATASIZE);
+			memcpy( &m_pHC->m_ctx.m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS], &dataRedCounter, sizeof(int));
 			//End Critical Section
 #if USING_RTEXPSLITE == 0
 			if (CHcsmCollection::m_spRTEX)
@@ -157,7 +157,7 @@ CStartDataredActn::Execute( const set<CCandidate>* )
 			//Restore the original thread priority
 			SetThreadPriority(hThread,threadPri);
 
-//			gout << " - Segments[" << blockNum << "] |= " << i->type << "( " << CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] << ")";
+//			gout << " - Segments[" << blockNum << "] |= " << i->type << "( " << m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] << ")";
 //			gout << " - Params[" << copyTo << "] = " << i->data << " : " << &(i->data[8]) << endl;
 		}
 		
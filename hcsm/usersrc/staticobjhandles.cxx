@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: staticobjhandles.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The implementation of the class CStaticObjHandles.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "staticobjhandles.h"
+#include <string.h>
+
+const int cSTATIC_HANDLES_MIN_SIZE = 64;
+
+CStaticObjHandles::CStaticObjHandles()
+{
+	m_count = 0;
+	m_built = false;
+}
+
+CStaticObjHandles::~CStaticObjHandles() {}
+
+void
+CStaticObjHandles::Clear( void )
+{
+	m_slots.clear();
+	m_count = 0;
+	m_built = false;
+}
+
+unsigned int
+CStaticObjHandles::Hash( const char* cpName, int len )
+{
+	unsigned int hash = 2166136261u;
+	int i;
+	for( i = 0; i < len; i++ )
+	{
+		hash ^= (unsigned char) cpName[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+void
+CStaticObjHandles::Build( CCved& cved )
+{
+	m_built = true;
+
+	CCved::TIntVec objs;
+	cved.GetAllStaticObjs( objs );
+
+	int size = cSTATIC_HANDLES_MIN_SIZE;
+	while( size < 2 * (int) objs.size() )  size *= 2;
+	TSlot empty;
+	empty.hash   = 0;
+	empty.used   = false;
+	empty.cvedId = -1;
+	m_slots.assign( size, empty );
+	m_count = 0;
+
+	CCved::TIntVec::const_iterator i;
+	for( i = objs.begin(); i != objs.end(); i++ )
+	{
+		const char* cpName = cved.GetObjName( *i );
+		int len = (int) strlen( cpName );
+		Insert( Hash( cpName, len ), *i, cpName, len, false );
+	}
+}
+
+void
+CStaticObjHandles::Insert(
+			unsigned int hash,
+			int cvedId,
+			const char* cpName,
+			int len,
+			bool replace
+			)
+{
+	if( 2 * ( m_count + 1 ) > (int) m_slots.size() )  Grow();
+
+	unsigned int mask = (unsigned int) m_slots.size() - 1;
+	unsigned int s = hash & mask;
+	while( m_slots[s].used )
+	{
+		TSlot& slot = m_slots[s];
+		if( slot.hash == hash && (int) slot.name.size() == len &&
+			memcmp( slot.name.data(), cpName, len ) == 0 )
+		{
+			// same name: a second object with that name, which is
+			// ignored, or a new lookup of a stale entry
+			if( replace )  slot.cvedId = cvedId;
+			return;
+		}
+		s = ( s + 1 ) & mask;
+	}
+
+	m_slots[s].hash   = hash;
+	m_slots[s].used   = true;
+	m_slots[s].cvedId = cvedId;
+	m_slots[s].name.assign( cpName, len );
+	m_count++;
+}
+
+void
+CStaticObjHandles::Grow( void )
+{
+	vector<TSlot> old;
+	old.swap( m_slots );
+
+	int size = old.empty() ? cSTATIC_HANDLES_MIN_SIZE : 2 * (int) old.size();
+	TSlot empty;
+	empty.hash   = 0;
+	empty.used   = false;
+	empty.cvedId = -1;
+	m_slots.assign( size, empty );
+	m_count = 0;
+
+	vector<TSlot>::const_iterator i;
+	for( i = old.begin(); i != old.end(); i++ )
+	{
+		if( i->used )  Insert( i->hash, i->cvedId, i->name.data(), (int) i->name.size(), true );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the CVED id of the object with the given name.
+//
+// Remarks: The table is built from all the CVED static objects on the
+//  first call.  A name that is not in the table, or whose object is no
+//  longer in CVED, is looked up in CVED and the result cached if the
+//  object is found.  Names that are not found are not cached, so an
+//  object created later is found by the next call.
+//
+// Arguments:
+//  cved    - the CVED instance
+//  cpName  - the name, which need not be null terminated
+//  len     - the length of the name
+//
+// Returns: the CVED id, or -1 if there is no object with that name.
+//
+/////////////////////////////////////////////////////////////////////////////
+int
+CStaticObjHandles::Find( CCved& cved, const char* cpName, int len )
+{
+	if( !m_built )  Build( cved );
+
+	unsigned int hash = Hash( cpName, len );
+	if( !m_slots.empty() )
+	{
+		unsigned int mask = (unsigned int) m_slots.size() - 1;
+		unsigned int s = hash & mask;
+		while( m_slots[s].used )
+		{
+			const TSlot& slot = m_slots[s];
+			if( slot.hash == hash && (int) slot.name.size() == len &&
+				memcmp( slot.name.data(), cpName, len ) == 0 )
+			{
+				if( cved.IsObjValid( slot.cvedId ) &&
+					slot.name == cved.GetObjName( slot.cvedId ) )
+				{
+					return slot.cvedId;
+				}
+				break;
+			}
+			s = ( s + 1 ) & mask;
+		}
+	}
+
+	// not known, or stale
+	int cvedId;
+	if( !cved.GetObj( string( cpName, len ), cvedId ) )  return -1;
+	Insert( hash, cvedId, cpName, len, true );
+	return cvedId;
+}
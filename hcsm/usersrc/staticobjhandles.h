@@ -0,0 +1,82 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: staticobjhandles.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The definition of the class CStaticObjHandles, which maps
+//              static object names to CVED ids for the static object
+//              manager, and of the option updates it applies.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _STATICOBJHANDLES_H_
+#define _STATICOBJHANDLES_H_
+
+#include <cvedpub.h>
+#include <string>
+#include <vector>
+using namespace std;
+
+//
+// The option switches of one static object.  Non-composite objects
+// only use the first one; unused pieces of composite objects are -1.
+//
+struct TStaticObjOptions {
+	int cvedId;
+	int options[cMAX_PIECES_IN_COMPOSITE_SIGN];
+};
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// An open addressing hash table from object name to CVED id, filled with
+// all the static objects the first time it is used.  Lookups take the
+// name as a pointer and length into the dial string, so resolving a name
+// doesn't copy it.  When several objects share a name the table keeps
+// the first one, as CVED's own lookup by name does.
+//
+// A name that is not in the table is looked up in CVED and added if it is
+// found.  Names that are not found are not kept, since static objects can
+// be created after the table is built; each such call goes to CVED again.
+// Each hit is checked against CVED so a deleted object, or an id reused
+// by another object, is never returned; such an entry is looked up again.
+//
+class CStaticObjHandles
+{
+public:
+	CStaticObjHandles();
+	~CStaticObjHandles();
+
+	void Clear( void );
+	int  Find( CCved& cved, const char* cpName, int len );
+
+private:
+	struct TSlot {
+		unsigned int  hash;
+		bool          used;
+		int           cvedId;
+		string        name;
+	};
+
+	static unsigned int Hash( const char* cpName, int len );
+	void Build( CCved& cved );
+	void Insert(
+				unsigned int hash,
+				int cvedId,
+				const char* cpName,
+				int len,
+				bool replace
+				);
+	void Grow( void );
+
+	vector<TSlot>  m_slots;			// size is a power of two
+	int            m_count;
+	bool           m_built;
+};
+
+#endif // _STATICOBJHANDLES_H_
@@ -20,7 +20,8 @@
 #include <pi_iostream>
 #include <pi_string>
 #include <transmat.h>
-#include <sstream>
+#include <ctype.h>
+#include <string.h>
 using namespace std;
 
 const CSol& solLib()
@@ -35,137 +36,210 @@ CStaticObjManager::Creation( const CSobjMngrParseBlock* cpSnoBlock )
 }
 
 
-bool
-CStaticObjManager::SetObjectOptions( const string& cName, int *pValues )
+// the most pieces a SetOption1 entry can set
+const int cMAX_DIAL_PIECES = 10;
+
+static const char*
+SkipSpace( const char* cpStr )
+{
+	while( isspace( (unsigned char) *cpStr ) )  cpStr++;
+	return cpStr;
+}
+
+//
+// Reads an integer after optional white space.  Returns the position
+// after it, or 0 if there is no integer there.
+//
+static const char*
+ReadInt( const char* cpStr, int& val )
 {
-	int cvedId;
-	bool success = cved->GetObj( cName, cvedId );
-	if( success )
+	cpStr = SkipSpace( cpStr );
+	bool negative = *cpStr == '-';
+	if( *cpStr == '-' || *cpStr == '+' )  cpStr++;
+	if( !isdigit( (unsigned char) *cpStr ) )  return 0;
+
+	int v = 0;
+	while( isdigit( (unsigned char) *cpStr ) )
 	{
-		cvEObjType objType = cved->GetObjType( cvedId );
-		bool compositeObj = objType == eCV_COMPOSITE_SIGN;
-		if( compositeObj )
+		v = v * 10 + ( *cpStr - '0' );
+		cpStr++;
+	}
+	val = negative ? -v : v;
+	return cpStr;
+}
+
+//
+// Reads a name terminated by ':', without the surrounding white space.
+// Returns the position after the ':', or 0 if there is no ':'.
+//
+static const char*
+ReadName( const char* cpStr, const char*& cpName, int& len )
+{
+	cpStr = SkipSpace( cpStr );
+	const char* cpColon = strchr( cpStr, ':' );
+	if( !cpColon )  return 0;
+
+	const char* cpEnd = cpColon;
+	while( cpEnd > cpStr && isspace( (unsigned char) cpEnd[-1] ) )  cpEnd--;
+	cpName = cpStr;
+	len    = (int)( cpEnd - cpStr );
+	return cpColon + 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Parses an option dial into m_options.
+//
+// Remarks: The dial string format is
+//     name : option [ : name : option ... ]
+//  where, for composite objects, option is a comma separated list of
+//  the options of the pieces.  The string is scanned in place and the
+//  names resolved through the handle table, so nothing is allocated
+//  once m_options has grown to the largest dial seen.  Entries naming
+//  objects that don't exist are skipped.
+//
+// Arguments:
+//  cValue    - the dial string
+//  composite - whether an entry can list several pieces
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CStaticObjManager::ParseOptionDial( const string& cValue, bool composite )
+{
+	m_options.clear();
+
+	const char* cpStr = cValue.c_str();
+	while( *SkipSpace( cpStr ) != '\0' )
+	{
+		const char* cpName;
+		int len;
+		cpStr = ReadName( cpStr, cpName, len );
+		if( !cpStr )  break;
+
+		TStaticObjOptions entry;
+		int n;
+		for( n = 0; n < cMAX_PIECES_IN_COMPOSITE_SIGN; n++ )
 		{
-			success = cved->SetObjCompositeOptions( cvedId, pValues );
-			return success;
+			entry.options[n] = -1;
 		}
-		else
+
+		int numPieces = 0;
+		const char* cpNext;
+		while( ( cpNext = ReadInt( cpStr, entry.options[numPieces] ) ) != 0 )
 		{
-			// send only the first option for non-composite objects
-//		gout << "StaticObjMan: SetOption(" << name << " " << value << endl;
-			cved->SetObjOption( cvedId, pValues[0] );
-			return true;
+			numPieces++;
+			cpStr = SkipSpace( cpNext );
+			bool more = composite && *cpStr == ',' &&
+				numPieces < cMAX_PIECES_IN_COMPOSITE_SIGN &&
+				numPieces < cMAX_DIAL_PIECES;
+			if( !more )  break;
+			cpStr++;
 		}
-	}
 
-	return false;
-}
-bool 
-CStaticObjManager::SetObjectAudioState( const string& name, short val){
-	int cvedId;
-	bool success = cved->GetObj( name, cvedId );
-	if( success )
-	{
-		cved->SetObjAudioState(cvedId,val,true);
+		if( numPieces > 0 )
+		{
+			entry.cvedId = m_handles.Find( *cved, cpName, len );
+			if( entry.cvedId >= 0 )  m_options.push_back( entry );
+		}
+
+		// anything but the ':' before the next entry ends the dial
+		cpStr = SkipSpace( cpStr );
+		if( *cpStr != ':' )  break;
+		cpStr++;
 	}
-	return success;
 }
-bool 
-CStaticObjManager::SetObjectVisualState( const string& name, short val ){
-	int cvedId;
-	bool success = cved->GetObj( name, cvedId );
-	if( success )
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Parses an audio or visual state dial.
+//
+// Remarks: The dial string format is
+//     name : state
+//  where a missing state reads as 0.
+//
+// Arguments:
+//  cValue - the dial string
+//  val    - (output) the state
+//
+// Returns: the CVED id of the named object, or -1 if there is none.
+//
+/////////////////////////////////////////////////////////////////////////////
+int
+CStaticObjManager::ParseStateDial( const string& cValue, short& val )
+{
+	const char* cpName;
+	int len;
+	const char* cpStr = ReadName( cValue.c_str(), cpName, len );
+	if( !cpStr )  return -1;
+
+	int state = 0;
+	ReadInt( cpStr, state );
+	val = (short)(unsigned short) state;
+
+	return m_handles.Find( *cved, cpName, len );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Sets the options of several static objects at once.
+//
+// Remarks: Composite objects get the options of all their pieces, the
+//  others only the first option.  The entries are applied in order, so
+//  the last entry for an object wins.
+//
+// Arguments:
+//  options - the objects and their options
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CStaticObjManager::ApplyOptions( vector<TStaticObjOptions>& options )
+{
+	vector<TStaticObjOptions>::iterator i;
+	for( i = options.begin(); i != options.end(); i++ )
 	{
-		cved->SetObjVisualState(cvedId,val,true);
+		cvEObjType objType = cved->GetObjType( i->cvedId );
+		bool compositeObj = objType == eCV_COMPOSITE_SIGN;
+		if( compositeObj )
+		{
+			cved->SetObjCompositeOptions( i->cvedId, i->options );
+		}
+		else
+		{
+			// send only the first option for non-composite objects
+			cved->SetObjOption( i->cvedId, i->options[0] );
+		}
 	}
-	return success;
 }
 
 void 
 CStaticObjManager::PostActivity( const CSobjMngrParseBlock* cpSnoBlock )
 {
-	const int cBUFSIZE = 1024;
-	static char buffer[cBUFSIZE];
-	char ch;
-	static int* spNums = new int[cMAX_PIECES_IN_COMPOSITE_SIGN];
-
 	//
 	// Dial string format:
 	//   name : option [ : name : option ... ]
 	//
 	if( m_dialSetOption1.HasValue() ) 
 	{
-		// reset values in composite structure
-		int n;
-		for( n = 0; n < cMAX_PIECES_IN_COMPOSITE_SIGN; n++ )
-		{
-			spNums[n] = -1;
-		}
-
-		// read the dial
-		string value = GetDialSetOption1();
-		istringstream istr( value.c_str() );
-		while( !istr.eof() ) 
-		{
-			istr.get( buffer, cBUFSIZE, ':' );	// read the static obj name
-			istr.get( ch );                     // read the ':'
-
-			int childNum = 0;
-			do 
-			{
-				istr >> spNums[childNum];              // switch
-				istr >> ch;
-				childNum++;
-			} 
-			while( (ch == ',') && (childNum < 10) );
-			if( childNum > 0 ) SetObjectOptions( buffer, spNums );
-			if( !istr.eof() )  istr.get( ch );        // :
-		}
-
+		ParseOptionDial( GetDialSetOption1(), true );
+		ApplyOptions( m_options );
 		m_dialSetOption1.SetNoValue();
 	}
 	if( m_dialSetOption2.HasValue() ) 
 	{
-		// reset values in composite structure
-		int n;
-		for( n = 0; n < cMAX_PIECES_IN_COMPOSITE_SIGN; n++ )
-		{
-			spNums[n] = -1;
-		}
-
-		string value = GetDialSetOption2();
-		istringstream istr( value.c_str() );
-		while( !istr.eof() ) 
-		{
-			istr.get( buffer, cBUFSIZE, ':' );
-			istr.get( ch );
-			istr >> spNums[0];
-			if( istr ) SetObjectOptions( buffer, spNums );
-			if( !istr.eof() )  istr.get( ch );        // :
-		}
-
+		ParseOptionDial( GetDialSetOption2(), false );
+		ApplyOptions( m_options );
 		m_dialSetOption2.SetNoValue();
 	}
 	if (m_dialVisualState.HasValue()){
-		string value = m_dialVisualState.GetValueStr();
-		stringstream istr(value);
-		istr.get( buffer, cBUFSIZE, ':' );
-		istr.get( ch );
-		unsigned short bitMask =0;
-		istr>>bitMask;
-		SetObjectVisualState(buffer,bitMask);
+		short state;
+		int cvedId = ParseStateDial( m_dialVisualState.GetValueStr(), state );
+		if( cvedId >= 0 )  cved->SetObjVisualState( cvedId, state, true );
 		m_dialVisualState.SetNoValue();
-
-
 	}
 	if (m_dialAudioState.HasValue()){
-		string value = m_dialAudioState.GetValueStr();
-		stringstream istr(value);
-		istr.get( buffer, cBUFSIZE, ':' );
-		istr.get( ch );
-		unsigned short bitMask =0;
-		istr>>bitMask;
-		SetObjectAudioState(buffer,bitMask);
+		short state;
+		int cvedId = ParseStateDial( m_dialAudioState.GetValueStr(), state );
+		if( cvedId >= 0 )  cved->SetObjAudioState( cvedId, state, true );
 		m_dialAudioState.SetNoValue();
 	}
 
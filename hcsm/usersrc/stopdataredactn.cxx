@@ -127,13 +127,13 @@ CStopDataredActn::Execute( const set<CCandidate>* )
 			bitnum++;
 		}
 
-		int before = CHcsmCollection::m_sSCC_DataRed_Segments[blockNum];
-		CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] &= ~(i->type);
-		if( CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] != before ) 
+		int before = m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum];
+		m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] &= ~(i->type);
+		if( m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] != before ) 
 		{  // only run this if the data has actually changed.
-			CHcsmCollection::SetActionStopDataRedLog(m_triggerId, i->type + 32 * blockNum, i->data	);
+			m_pHC->SetActionStopDataRedLog(m_triggerId, i->type + 32 * blockNum, i->data	);
 //			gout << "STOP DATARED - " << i->type << ": " << i->data << " : " << &(i->data[8]) << endl;
-			int dataRedCounter = ++m_sDataRedCounter;
+			int dataRedCounter = ++m_pHC->m_ctx.m_sDataRedCounter;
 //			gout << " (Count " << dataRedCounter << ")";
 
 			HANDLE hThread = GetCurrentThread();
@@ -148,12 +148,12 @@ CStopDataredActn::Execute( const set<CCandidate>* )
 			SetThreadPriority(hThread, REALTIME_PRIORITY_CLASS);
 
 //			gout << " (Count " << dataRedCounter << ")";
-			CHcsmCollection::m_sSCC_DataRed_Segments[0] = dataRedCounter;
-			CHcsmCollection::m_sSCC_DataRed_Segments[0] = dataRedCounter;
+			m_pHC->m_ctx.m_sSCC_DataRed_Segments[0] = dataRedCounter;
+			m_pHC->m_ctx.m_sSCC_DataRed_Segments[0] = dataRedCounter;
 
 			int copyTo = (cDR_COLSIZE + cDR_DATASIZE) * bitnum + ((blockNum-1) * (cDR_COLSIZE + cDR_DATASIZE) * 32);
-			memcpy( &CHcsmCollection::m_sSCC_DataRed_Params[copyTo], i->data, cDR_COLSIZE + cDR_DATASIZE);
-			memcpy( &CHcsmCollection::m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS], &dataRedCounter, sizeof(int));
+			memcpy( &m_pHC->m_ctx.m_sSCC_DataRed_Params[copyTo], i->data, cDR_COLSIZE + cDR_DATASIZE);
+			memcpy( &m_pHC->m_ctx.m_sSCC_DataRed_Params[cNUM_DATARED_PARAMS], &dataRedCounter, sizeof(int));
 
 			//End Critical Section
 #if USING_RTEXPSLITE == 0
@@ -164,7 +164,7 @@ CStopDataredActn::Execute( const set<CCandidate>* )
 			//Restore the original thread priority
 			SetThreadPriority(hThread,threadPri);
 
-//			gout << " - Segments[" << blockNum << "] &= ~" << i->type << "( " << CHcsmCollection::m_sSCC_DataRed_Segments[blockNum] << ")" << endl;
+//			gout << " - Segments[" << blockNum << "] &= ~" << i->type << "( " << m_pHC->m_ctx.m_sSCC_DataRed_Segments[blockNum] << ")" << endl;
 //			gout << " - Params = " << i->data << " : " << &(i->data[8]) << endl;
 		}		
 	}
@@ -104,25 +104,25 @@ CTimeToArrvlTrigger::CellEquals( int argC, const CExprParser::CStrNum args[] )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS *2 )  throw InvalidArgs;
 		else if (index < 0 || index < cNUM_LOG_STREAMS){
-			return fabs( CHcsmCollection::m_sLogStreams[index] - doubleVal ) < cNEAR_ZERO;
+			return fabs( m_pRootCollection->m_ctx.m_sLogStreams[index] - doubleVal ) < cNEAR_ZERO;
 		}else{
-			return fabs( CHcsmCollection::m_sLogStreamsExt[index -cNUM_LOG_STREAMS] - doubleVal ) < cNEAR_ZERO;
+			return fabs( m_pRootCollection->m_ctx.m_sLogStreamsExt[index -cNUM_LOG_STREAMS] - doubleVal ) < cNEAR_ZERO;
 		}
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return fabs( CHcsmCollection::m_sAccelPedalPos - doubleVal ) < cNEAR_ZERO;
+		return fabs( m_pRootCollection->m_ctx.m_sAccelPedalPos - doubleVal ) < cNEAR_ZERO;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return fabs( CHcsmCollection::m_sCruiseControl - doubleVal ) < cNEAR_ZERO;
+		return fabs( m_pRootCollection->m_ctx.m_sCruiseControl - doubleVal ) < cNEAR_ZERO;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return fabs( CHcsmCollection::m_sCruiseControlIncoming - doubleVal ) < cNEAR_ZERO;
+		return fabs( m_pRootCollection->m_ctx.m_sCruiseControlIncoming - doubleVal ) < cNEAR_ZERO;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return fabs( CHcsmCollection::m_sCisTurnSignal - doubleVal ) < cNEAR_ZERO;
+		return fabs( m_pRootCollection->m_ctx.m_sCisTurnSignal - doubleVal ) < cNEAR_ZERO;
 	}
 
 	return 0.0;
@@ -135,12 +135,12 @@ CTimeToArrvlTrigger::ReadVar( int argC, const CExprParser::CStrNum args[] )
 	if( invalidArgs )  PrintInvalidArgs( argC, args, "ReadVar" );
 
 	string varName = args[0].m_Str;
-	if( !CHcsmCollection::ExprVariableExists( varName ) )
+	if( !m_pRootCollection->ExprVariableExists( varName ) )
 	{
 		return 0.0;
 	}
 	
-	return CHcsmCollection::GetExprVariable( varName );
+	return m_pRootCollection->GetExprVariable( varName );
 }
 
 
@@ -156,44 +156,44 @@ CTimeToArrvlTrigger::ReadCell( int argC, const CExprParser::CStrNum args[] )
 
 	if( cellName == "PlacePhoneCall" )
 	{
-		return CHcsmCollection::m_sSCC_PlacePhoneCall;
+		return m_pRootCollection->m_ctx.m_sSCC_PlacePhoneCall;
 	}
 	else if( cellName == "PhoneCallAge" )
 	{
-		return CHcsmCollection::m_sPlacePhoneCallAge;
+		return m_pRootCollection->m_ctx.m_sPlacePhoneCallAge;
 	}
 	else if( cellName == "LogStreams" )
 	{
 		if( index < 0 || index >= cNUM_LOG_STREAMS *2 )  
 			throw InvalidArgs;
 		else if (index < 0 || index < cNUM_LOG_STREAMS){
-			return CHcsmCollection::m_sLogStreams[index];
+			return m_pRootCollection->m_ctx.m_sLogStreams[index];
 		}else{
-			return CHcsmCollection::m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
+			return m_pRootCollection->m_ctx.m_sLogStreamsExt[index - cNUM_LOG_STREAMS];
 		}
 	}
 	else if( cellName == "AccelPedalPos" )
 	{
-		return CHcsmCollection::m_sAccelPedalPos;
+		return m_pRootCollection->m_ctx.m_sAccelPedalPos;
 	}
 	else if( cellName == "BrakePedalForce" )
 	{
-		return CHcsmCollection::m_sBrakePedalForce;
+		return m_pRootCollection->m_ctx.m_sBrakePedalForce;
 	}
 	else if( cellName == "SteeringWheelAngle" )
 	{
-		return CHcsmCollection::m_sSteeringWheelAngle;
+		return m_pRootCollection->m_ctx.m_sSteeringWheelAngle;
 	}
 	else if( cellName == "CruiseControl" )
 	{
-		return CHcsmCollection::m_sCruiseControl;
+		return m_pRootCollection->m_ctx.m_sCruiseControl;
 	}
 	else if ( cellName == "CruiseControlUF"){
-		return CHcsmCollection::m_sCruiseControlIncoming;
+		return m_pRootCollection->m_ctx.m_sCruiseControlIncoming;
 	}
 	else if( cellName == "TurnSignal" )
 	{
-		return CHcsmCollection::m_sCisTurnSignal;
+		return m_pRootCollection->m_ctx.m_sCisTurnSignal;
 	}
 	else if( cellName == "OvVel" )
 	{
@@ -201,7 +201,7 @@ CTimeToArrvlTrigger::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		g_pCved2->GetOwnVehicleVel( ownVehVel );
 		ownVehVel *= cMS_TO_MPH;
 #ifdef TTA_DIST_FOR_ODSS	//quick hack to grab Distance to Intersection for a specific scenario	
-		CHcsmCollection::m_sDistanceToInt = m_currTimeToArrival;//*(ownVehVel * 1.46667f);
+		m_pRootCollection->m_ctx.m_sDistanceToInt = m_currTimeToArrival;//*(ownVehVel * 1.46667f);
 #endif
 		return ownVehVel;
 	}
@@ -214,38 +214,38 @@ CTimeToArrvlTrigger::ReadCell( int argC, const CExprParser::CStrNum args[] )
 	else if( cellName == "OvLaneDev" )
 	{
 		double laneDev = 0.0;
-		if( CHcsmCollection::m_sLaneDevInfo[0] != 0 )
+		if( m_pRootCollection->m_ctx.m_sLaneDevInfo[0] != 0 )
 		{
-			laneDev = CHcsmCollection::m_sLaneDevInfo[1];
+			laneDev = m_pRootCollection->m_ctx.m_sLaneDevInfo[1];
 		}
 		return laneDev;
 	}
 	else if( cellName == "OvHeadwayToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
+		return m_pRootCollection->m_ctx.m_sFollowInfo[cFOLLOW_INFO_HEADWAY_IDX];
 	}
 	else if( cellName == "OvTtcToLeadVeh" )
 	{
-		return CHcsmCollection::m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
+		return m_pRootCollection->m_ctx.m_sFollowInfo[cFOLLOW_INFO_TTC_IDX];
 	}
 	else if( cellName == "Horn" )
 	{
-		return CHcsmCollection::m_sHorn;
+		return m_pRootCollection->m_ctx.m_sHorn;
 	}
 	else if (cellName == "HornFiltered"){
-		return CHcsmCollection::m_sHornFiltered;	
+		return m_pRootCollection->m_ctx.m_sHornFiltered;	
 	}
 	else if( cellName == "RECAS_Button" )
 	{
-		return CHcsmCollection::m_sRecasButton;
+		return m_pRootCollection->m_ctx.m_sRecasButton;
 	}
 	else if( cellName == "Auxiliary_Buttons" )
 	{
-		return CHcsmCollection::m_sAuxiliaryButtons[index];
+		return m_pRootCollection->m_ctx.m_sAuxiliaryButtons[index];
 	}
 	else if ( cellName == "DynObj_Vel" )
 	{
-		return CHcsmCollection::m_sDynObjData.vel[index];
+		return m_pRootCollection->m_ctx.m_sDynObjData.vel[index];
 	}
 	else if ( cellName == "My_Lifetime" )
 	{
@@ -262,25 +262,25 @@ CTimeToArrvlTrigger::ReadCell( int argC, const CExprParser::CStrNum args[] )
 		return m_currTimeToArrival;
 	}
 	else if (cellName == "WarningLights"){
-		return CHcsmCollection::m_sWarningLights;
+		return m_pRootCollection->m_ctx.m_sWarningLights;
 	}
 	else if (cellName == "ACC_Warning"){
-		return CHcsmCollection::m_sACC_Warning;
+		return m_pRootCollection->m_ctx.m_sACC_Warning;
 	}
 	else if (cellName == "Cruise_State"){
-		return CHcsmCollection::m_sCruise_State;
+		return m_pRootCollection->m_ctx.m_sCruise_State;
 	}
 	else if (cellName == "Cruise_Speed"){
-		return CHcsmCollection::m_sCruise_SetSpeed;
+		return m_pRootCollection->m_ctx.m_sCruise_SetSpeed;
 	}
 	else if (cellName == "ACC_Gap"){
-		return CHcsmCollection::m_sACC_Gap;
+		return m_pRootCollection->m_ctx.m_sACC_Gap;
 	}
 	else if (cellName == "Sensor_Info"){
-		return CHcsmCollection::m_sSensorInfo[index];
+		return m_pRootCollection->m_ctx.m_sSensorInfo[index];
 	}
 	else if (cellName == "OnPath"){
-		return CHcsmCollection::m_sIsOnPath;
+		return m_pRootCollection->m_ctx.m_sIsOnPath;
 	}
 	else if (CHcsmCollection::ReadCellNumeric != NULL){
 		float result = 0;
@@ -313,17 +313,17 @@ CTimeToArrvlTrigger::GetObjVel( int argC, const CExprParser::CStrNum args[] )
 	string objName = args[0].m_Str;
 
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < m_pRootCollection->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&m_pRootCollection->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE 
 			);
 		if( !strcmp( temp, objName.c_str() ) )
 		{
-			return CHcsmCollection::m_sDynObjData.vel[i];
+			return m_pRootCollection->m_ctx.m_sDynObjData.vel[i];
 		}
 	}
 
@@ -354,21 +354,21 @@ CTimeToArrvlTrigger::GetObjDistPow( int argC, const CExprParser::CStrNum args[]
 	string objName = args[0].m_Str;
 
 	int i;
-	for( i = 0; i < CHcsmCollection::m_sDynObjDataSize; i++ )
+	for( i = 0; i < m_pRootCollection->m_ctx.m_sDynObjDataSize; i++ )
 	{
 		char temp[cMAX_DYN_OBJ_NAME_SIZE] = { 0 };
 		StrncpyFlip(
 			temp,
-			&CHcsmCollection::m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
+			&m_pRootCollection->m_ctx.m_sDynObjData.name[i*cMAX_DYN_OBJ_NAME_SIZE],
 			cMAX_DYN_OBJ_NAME_SIZE 
 			);
 		if( !strcmp( temp, objName.c_str() ) )
 		{
 			CPoint3D ovPos;
 			g_pCved2->GetOwnVehiclePos( ovPos );
-			float deltaX = ovPos.m_x - CHcsmCollection::m_sDynObjData.pos[i*3];
-			float deltaY = ovPos.m_y - CHcsmCollection::m_sDynObjData.pos[i*3+1];
-			float deltaZ = ovPos.m_z - CHcsmCollection::m_sDynObjData.pos[i*3+2];
+			float deltaX = ovPos.m_x - m_pRootCollection->m_ctx.m_sDynObjData.pos[i*3];
+			float deltaY = ovPos.m_y - m_pRootCollection->m_ctx.m_sDynObjData.pos[i*3+1];
+			float deltaZ = ovPos.m_z - m_pRootCollection->m_ctx.m_sDynObjData.pos[i*3+2];
 			return deltaX*deltaX + deltaY*deltaY + deltaZ*deltaZ;
 		}
 	}
@@ -574,6 +574,7 @@ CTimeToArrvlTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								GetFrame(), 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -944,7 +945,7 @@ CTimeToArrvlTrigger::Evaluate( void )
 		}
 	}
 	if (m_logTTA){
-		LogData(m_logTTANum,lowestTTA);
+		LogData(m_pRootCollection, m_logTTANum,lowestTTA);
 	}
 
 	//
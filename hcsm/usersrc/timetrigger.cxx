@@ -38,6 +38,7 @@ void CTimeTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								GetFrame(), 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -0,0 +1,171 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: timingwheel.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The implementation of the class CTimingWheel.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include "timingwheel.h"
+
+CTimingWheel::CTimingWheel()
+{
+	m_now = 0;
+}
+
+CTimingWheel::~CTimingWheel() {}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Discards all scheduled items and sets the current frame.
+//
+// Arguments:
+//  frame - the frame considered processed; items scheduled for it or
+//          earlier become due at the next Advance
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CTimingWheel::Reset( int frame )
+{
+	int i;
+	for( i = 0; i < cWHEEL_L0_SIZE; i++ ) m_level0[i].clear();
+	for( i = 0; i < cWHEEL_L1_SIZE; i++ ) m_level1[i].clear();
+	m_overflow.clear();
+	m_gen.clear();
+	m_scheduled.clear();
+	m_now = frame;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Schedules an item to be returned by Advance when the
+//  specified frame is reached, replacing any earlier schedule.
+//
+// Remarks: Frames at or before the last frame passed to Advance are due
+//  at the next call to Advance.
+//
+// Arguments:
+//  item  - the item, a non-negative integer
+//  frame - the frame at which the item is due
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CTimingWheel::Schedule( int item, int frame )
+{
+	if( item >= (int)m_gen.size() )
+	{
+		m_gen.resize( item + 1, 0 );
+		m_scheduled.resize( item + 1, false );
+	}
+
+	m_gen[item]++;
+	m_scheduled[item] = true;
+
+	TEntry e;
+	e.item  = item;
+	e.gen   = m_gen[item];
+	e.frame = frame > m_now ? frame : m_now + 1;
+	Insert( e );
+}
+
+void
+CTimingWheel::Cancel( int item )
+{
+	if( item < (int)m_gen.size() )
+	{
+		m_gen[item]++;
+		m_scheduled[item] = false;
+	}
+}
+
+bool
+CTimingWheel::IsScheduled( int item ) const
+{
+	return item < (int)m_scheduled.size() && m_scheduled[item];
+}
+
+void
+CTimingWheel::Insert( const TEntry& e )
+{
+	if( ( e.frame >> cWHEEL_L0_BITS ) == ( m_now >> cWHEEL_L0_BITS ) )
+	{
+		m_level0[e.frame & ( cWHEEL_L0_SIZE - 1 )].push_back( e );
+	}
+	else if( ( e.frame >> cWHEEL_SPAN_BITS ) == ( m_now >> cWHEEL_SPAN_BITS ) )
+	{
+		m_level1[( e.frame >> cWHEEL_L0_BITS ) & ( cWHEEL_L1_SIZE - 1 )].push_back( e );
+	}
+	else
+	{
+		m_overflow.push_back( e );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Moves the wheel forward to the specified frame and
+//  returns the items that became due.
+//
+// Remarks: The frames between the previous call and this one are all
+//  visited, so nothing is missed if frames are skipped.  Items are
+//  returned in the order of their due frame and, within a frame, in the
+//  order they were scheduled.  A returned item is no longer scheduled.
+//
+// Arguments:
+//  frame - the current frame
+//  due   - (output) the items due at or before frame
+//
+/////////////////////////////////////////////////////////////////////////////
+void
+CTimingWheel::Advance( int frame, vector<int>& due )
+{
+	due.clear();
+
+	while( m_now < frame )
+	{
+		m_now++;
+
+		if( ( m_now & ( ( 1 << cWHEEL_SPAN_BITS ) - 1 ) ) == 0 )
+		{
+			// a new span: bring in what the overflow holds for it
+			m_scratch.swap( m_overflow );
+			m_overflow.clear();
+			vector<TEntry>::const_iterator i;
+			for( i = m_scratch.begin(); i != m_scratch.end(); i++ )
+			{
+				if( IsCurrent( *i ) ) Insert( *i );
+			}
+			m_scratch.clear();
+		}
+
+		if( ( m_now & ( cWHEEL_L0_SIZE - 1 ) ) == 0 )
+		{
+			// a new block: spread its level 1 slot over level 0
+			m_scratch.swap( m_level1[( m_now >> cWHEEL_L0_BITS ) & ( cWHEEL_L1_SIZE - 1 )] );
+			vector<TEntry>::const_iterator i;
+			for( i = m_scratch.begin(); i != m_scratch.end(); i++ )
+			{
+				if( IsCurrent( *i ) ) Insert( *i );
+			}
+			m_scratch.clear();
+		}
+
+		vector<TEntry>& slot = m_level0[m_now & ( cWHEEL_L0_SIZE - 1 )];
+		vector<TEntry>::const_iterator i;
+		for( i = slot.begin(); i != slot.end(); i++ )
+		{
+			if( IsCurrent( *i ) )
+			{
+				m_scheduled[i->item] = false;
+				due.push_back( i->item );
+			}
+		}
+		slot.clear();
+	}
+}
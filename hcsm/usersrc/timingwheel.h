@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: timingwheel.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:        October, 2026
+//
+// Description: The definition of the class CTimingWheel, a scheduler
+//              that hands back items at the frame they were scheduled
+//              for.  Frames in which nothing is due cost a couple of
+//              array lookups no matter how many items are scheduled.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TIMINGWHEEL_H_
+#define _TIMINGWHEEL_H_
+
+#include <vector>
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// A two level hierarchical timing wheel keyed by frame number.
+//
+// Items are small non-negative integers (typically indices into a
+// vector owned by the caller) and each item is scheduled at most once;
+// scheduling it again replaces the earlier request.  Items due within
+// the current block of cWHEEL_L0_SIZE frames sit in the first level,
+// items due within the next cWHEEL_L1_SIZE blocks in the second, and
+// anything further out in an overflow list.  Entries move down a level
+// when their block comes up, so each entry is touched at most three
+// times before it is due.
+//
+class CTimingWheel {
+public:
+	CTimingWheel();
+	~CTimingWheel();
+
+	void Reset( int frame );
+	void Schedule( int item, int frame );
+	void Cancel( int item );
+	bool IsScheduled( int item ) const;
+	void Advance( int frame, vector<int>& due );
+
+private:
+	enum {
+		cWHEEL_L0_BITS = 8,
+		cWHEEL_L1_BITS = 6,
+		cWHEEL_L0_SIZE = 1 << cWHEEL_L0_BITS,
+		cWHEEL_L1_SIZE = 1 << cWHEEL_L1_BITS,
+		cWHEEL_SPAN_BITS = cWHEEL_L0_BITS + cWHEEL_L1_BITS
+	};
+
+	struct TEntry {
+		int           item;
+		unsigned int  gen;
+		int           frame;
+	};
+
+	void Insert( const TEntry& );
+	bool IsCurrent( const TEntry& e ) const
+	{
+		return e.item < (int)m_gen.size() && m_gen[e.item] == e.gen &&
+			m_scheduled[e.item];
+	}
+
+	int                   m_now;		// last frame handed to Advance
+	vector<TEntry>        m_level0[cWHEEL_L0_SIZE];
+	vector<TEntry>        m_level1[cWHEEL_L1_SIZE];
+	vector<TEntry>        m_overflow;
+	vector<unsigned int>  m_gen;		// per item; stale entries are skipped
+	vector<bool>          m_scheduled;
+	vector<TEntry>        m_scratch;
+};
+
+#endif // _TIMINGWHEEL_H_
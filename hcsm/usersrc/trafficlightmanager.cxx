@@ -18,6 +18,7 @@
 #include "genericinclude.h"
 #include "genhcsm.h"
 #include "hcsmcollection.h"
+#include "hcsmcheckpoint.h"
 
 #ifdef __sgi
 #include <strstream.h>
@@ -49,6 +50,17 @@ CTrafficLightManager::MakeStringUpper( string& s )
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Splits a TrafficLight dial value of the form
+//  "name:state:time" into its fields.
+//
+// Remarks: Any run of spaces, tabs and colons separates the fields.  The
+//  output strings are assigned in place, so when the caller keeps them
+//  around their storage is reused from one dial to the next.  Fields
+//  missing from the dial leave the corresponding argument untouched.
+//
+//////////////////////////////////////////////////////////////////////////////
 void 
 CTrafficLightManager::ParseDialString(
 			const string& cStr, 
@@ -57,24 +69,70 @@ CTrafficLightManager::ParseDialString(
 			double* pTime
 			)
 {
-	const size_t strSize = cStr.size() + 1;
-    char* pBuf = new char[strSize+1];
-    char* pTokDel = " \t:";
-    char* pTok;
-	char* pCurrPos = NULL;
-    strncpy( pBuf, cStr.c_str(),strSize );
-    pTok = strtok_s( pBuf, pTokDel, &pCurrPos );
-	if (!pTok)
+	static const char cDelims[] = " \t:";
+	string::size_type begin[3];
+	string::size_type end[3];
+	int numFields = 0;
+
+	string::size_type pos = 0;
+	while( numFields < 3 )
+	{
+		pos = cStr.find_first_not_of( cDelims, pos );
+		if( pos == string::npos )  break;
+		begin[numFields] = pos;
+		pos = cStr.find_first_of( cDelims, pos );
+		if( pos == string::npos )  pos = cStr.size();
+		end[numFields] = pos;
+		numFields++;
+	}
+
+	if( numFields < 1 )
+		return;
+	name.assign( cStr, begin[0], end[0] - begin[0] );
+	if( numFields < 2 )
 		return;
-    name = pTok;
-    pTok = strtok_s( NULL, pTokDel, &pCurrPos );
-	if (!pTok)
+	state.assign( cStr, begin[1], end[1] - begin[1] );
+	if( numFields < 3 )
 		return;
-    state = pTok;
-    pTok = strtok_s( NULL, pTokDel, &pCurrPos );
-	if (!pTok)
+	*pTime = atof( cStr.c_str() + begin[2] );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Puts a light group on the timing wheel for the frame in
+//  which its next pattern transition is due.
+//
+// Remarks: The group is scheduled one frame early, so rounding in the
+//  time to frame conversion can never make it miss a transition; when
+//  woken up too early, Execute does nothing and the group is simply
+//  scheduled again.  Groups under the effect of a dial are run every
+//  frame until the dial's target state comes up.
+//
+// Arguments:
+//  idx      - index of the group in m_clgs
+//  minFrame - the earliest frame to schedule the group for
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CTrafficLightManager::ScheduleClg( int idx, int minFrame )
+{
+	double nextTime = m_clgs[idx].NextTransitionTime();
+	if( nextTime < 0.0 )
+	{
+		m_clgWheel.Cancel( idx );
 		return;
-    *pTime = atof( pTok );
+	}
+
+	double nextFrame = floor( nextTime / GetTimeStepDuration() ) - 1.0;
+	if( nextFrame > 1.0e9 )  nextFrame = 1.0e9;
+
+	int frame = minFrame;
+	if( !m_clgs[idx].IsDialActive() && nextFrame > minFrame )
+	{
+		frame = (int)nextFrame;
+	}
+	m_clgWheel.Schedule( idx, frame );
 }
 
 
@@ -96,6 +154,13 @@ CTrafficLightManager::UserCreation(
 		m_clgs.push_back(tempClg);
 	}
 
+	// groups only need to run when one of their transitions is due
+	m_clgWheel.Reset( GetFrame() - 1 );
+	for( int i = 0; i < (int)m_clgs.size(); i++ )
+	{
+		ScheduleClg( i, GetFrame() );
+	}
+
 #if DEBUG_LEVEL_TRAFFIC_LIGHT_MANAGER > 0
 	vector<CClg>::const_iterator cItr = m_clgs.begin();
 	gout<<"\n---------------------------------------"<<endl;	
@@ -111,33 +176,34 @@ void CTrafficLightManager::UserPreActivity(
 			const CTrafLghtMngrParseBlock* pSnoBlock 
 			)
 {
-	double currTimeInSecs = GetFrame() * GetTimeStepDuration();
-	vector<CClg>::iterator cItr;
+	int    frame = GetFrame();
+	double currTimeInSecs = frame * GetTimeStepDuration();
+	int    i;
 
 	// to process here if a dial's been set 
-	string lightName;
-	string lightState;
-	double  dTime;      // dial Time
+	double dTime = 0.0; // dial Time
 	int    lightId;
 	if( m_dialTrafficLight.HasValue() )
 	{
-		ParseDialString( GetDialTrafficLight(), lightName, lightState, &dTime );
-		MakeStringUpper( lightState );
-		eCVTrafficLightState state = cvStringToTrafficLightState( lightState.c_str() );
-		bool isValidObj = cved->GetObj( lightName, lightId );
+		ParseDialString( GetDialTrafficLight(), m_dialLightName, m_dialLightState, &dTime );
+		MakeStringUpper( m_dialLightState );
+		eCVTrafficLightState state = cvStringToTrafficLightState( m_dialLightState.c_str() );
+		bool isValidObj = cved->GetObj( m_dialLightName, lightId );
 		if( isValidObj && state != eOFF )
 		{
 //			fprintf( stdout, "** currTimeInSecs = %.2f  dTime = %.2f  state = %d\n", currTimeInSecs, dTime, state );
 
-			for( cItr = m_clgs.begin(); cItr != m_clgs.end(); cItr++ )
+			for( i = 0; i < (int)m_clgs.size(); i++ )
 			{
-				double timeToTargetLightState = cItr->TimeToLightState( currTimeInSecs, lightId, state );
+				CClg& clg = m_clgs[i];
+				double timeToTargetLightState = clg.TimeToLightState( currTimeInSecs, lightId, state );
 //				fprintf( stdout, "%% Id %d:   timeToState = %.2f\n", lightId, timeToTargetLightState );
 
 				if( timeToTargetLightState == 0.0 ) 
 				{
 					// current light state is one being asked for
-					cItr->SetCycleStartTime( currTimeInSecs + dTime );
+					clg.SetCycleStartTime( currTimeInSecs + dTime );
+					m_clgWheel.Schedule( i, frame );
 				}
 				else if ( timeToTargetLightState > 0.0 )
 				{
@@ -150,7 +216,8 @@ void CTrafficLightManager::UserPreActivity(
 					{
 						factor = 999999.9;
 					}
-					cItr->SetTargetStateAndFactor( lightId, state, factor , currTimeInSecs );
+					clg.SetTargetStateAndFactor( lightId, state, factor , currTimeInSecs );
+					m_clgWheel.Schedule( i, frame );
 				}
 			}
 		}
@@ -169,29 +236,31 @@ void CTrafficLightManager::UserPreActivity(
 
 #if DEBUG_LEVEL_TRAFFIC_LIGHT_MANAGER > 1
 		gout<<"\n Dial Value : "<<GetDialTrafficLight();
-		gout<<"\n LightName  : "<<lightName;
+		gout<<"\n LightName  : "<<m_dialLightName;
 		gout<<"\n LightId    : "<<lightId;
-		gout<<"\n LightState : "<<lightState;
+		gout<<"\n LightState : "<<m_dialLightState;
 		gout<<"\n dTime      : "<<dTime;
-		if (lightFound)
-			gout<<"\n lightFound";
-		else
-			gout<<"\n lightNotFound";
 		gout<<endl;
 #endif 
 	}
-		
-	for( cItr = m_clgs.begin(); cItr != m_clgs.end(); cItr++ )
+
+	//
+	// Only the groups with a transition due this frame are executed.
+	//
+	m_clgWheel.Advance( frame, m_dueClgs );
+	vector<int>::const_iterator dItr;
+	for( dItr = m_dueClgs.begin(); dItr != m_dueClgs.end(); dItr++ )
 	{
 		try 
 		{ 
-			cItr->Execute( currTimeInSecs, GetTimeStepDuration(), *cved );
+			m_clgs[*dItr].Execute( currTimeInSecs, GetTimeStepDuration(), *cved );
 		}
 		catch ( ... ) 
 		{
 			cerr << "TrafficLightManager: caught exception in Clg::Execute";
 			cerr << endl;
 		}
+		ScheduleClg( *dItr, frame + 1 );
 	}
 
 #if DEBUG_LEVEL_TRAFFIC_LIGHT_MANAGER > 1
@@ -217,3 +286,67 @@ CTrafficLightManager::UserDeletion(
 {
 	PrintDeletionMessage();
 }
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Saves the state of the light groups, which the generated
+//  SaveState skips.
+//
+// Remarks: The timing wheel is not saved; it is rebuilt from the groups
+//  when the state is restored.
+//
+// Arguments:
+//  ckpt - the checkpoint to write to
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CTrafficLightManager::SaveUserState( CHcsmCheckpoint& ckpt )
+{
+	int numClgs = (int)m_clgs.size();
+	ckpt.Put( numClgs );
+
+	vector<CClg>::const_iterator cItr;
+	for( cItr = m_clgs.begin(); cItr != m_clgs.end(); cItr++ )
+	{
+		cItr->SaveState( ckpt );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Restores the state written by SaveUserState.
+//
+// Remarks: The groups were created from the scenario by UserCreation
+//  before this runs, so only their position in the cycle is read back.
+//  Each group is then scheduled again as UserCreation does, for the frame
+//  of its next transition.
+//
+// Arguments:
+//  ckpt - the checkpoint to read from
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CTrafficLightManager::RestoreUserState( CHcsmCheckpoint& ckpt )
+{
+	int numClgs = 0;
+	ckpt.Get( numClgs );
+	if( numClgs != (int)m_clgs.size() )
+	{
+		ckpt.SetError( "TrafficLightManager: light group count differs" );
+		return;
+	}
+
+	vector<CClg>::iterator cItr;
+	for( cItr = m_clgs.begin(); cItr != m_clgs.end() && ckpt.IsValid(); cItr++ )
+	{
+		cItr->RestoreState( ckpt );
+	}
+
+	m_clgWheel.Reset( GetFrame() - 1 );
+	for( int i = 0; i < (int)m_clgs.size(); i++ )
+	{
+		ScheduleClg( i, GetFrame() );
+	}
+}
@@ -18,6 +18,7 @@
 #include "genericinclude.h"
 #include "genhcsm.h"
 #include "hcsmcollection.h"
+#include "adoinfopool.h"
 #include <cvedpub.h>
 #include <ctype.h>
 #include <strstream>
@@ -71,18 +72,27 @@ CTrafficManager::UserCreation( const CTrafMngrParseBlock* cpBlock )
 	}
 	m_cInputSetItr = m_inputSets.begin();
 
+	// have the Ado storage ready for the most objects any input set allows
+	int maxObjects = 0;
+	vector<CTrafMngrParseBlock::TInputSet>::const_iterator setItr;
+	for( setItr = m_inputSets.begin(); setItr != m_inputSets.end(); setItr++ )
+	{
+		if( setItr->maxObjects > maxObjects )  maxObjects = setItr->maxObjects;
+	}
+	m_pRootCollection->GetAdoInfoPool().Reserve( maxObjects );
+
 	// initialize path information
 	m_pPath = NULL;
 	bool haveOwnshipPath = (
-				CHcsmCollection::m_sOwnshipPath.IsValid() && 
-				CHcsmCollection::m_sOwnshipPath.Size() > 0
+				m_pRootCollection->m_ctx.m_sOwnshipPath.IsValid() && 
+				m_pRootCollection->m_ctx.m_sOwnshipPath.Size() > 0
 				);
 	if( haveOwnshipPath )
 	{
 		// if the ownship already has a path from scenario then we assume that this what's to be used
 		m_pPath = new CPath( *cved );
-		*m_pPath = CHcsmCollection::m_sOwnshipPath;
-		//double pathLength = CHcsmCollection::m_sOwnshipPath.GetLength( &m_roadPos );
+		*m_pPath = m_pRootCollection->m_ctx.m_sOwnshipPath;
+		//double pathLength = m_pRootCollection->m_ctx.m_sOwnshipPath.GetLength( &m_roadPos );
 	}
 } // end of UserCreation
 
@@ -128,12 +138,12 @@ CTrafficManager::GetOwnVehRoadPos( )
 	}
 	
 
-	CRoadPos ownVehRoadPos;
-	bool haveValFromMonitor = pHcsm->GetMonitorByName( 
+	const CRoadPos* pOwnVehRoadPos;
+	bool haveValFromMonitor = pHcsm->BorrowMonitorByName( 
 												"RoadPos", 
-												&ownVehRoadPos
+												&pOwnVehRoadPos
 												);
-	if( !haveValFromMonitor || !ownVehRoadPos.IsValid() ) 
+	if( !haveValFromMonitor || !pOwnVehRoadPos->IsValid() ) 
 	{
 
 #ifdef  DEBUG_GET_OWNVEH_ROADPOS
@@ -144,7 +154,7 @@ CTrafficManager::GetOwnVehRoadPos( )
 
 	}
 
-	m_roadPos = ownVehRoadPos;
+	m_roadPos = *pOwnVehRoadPos;
 	return;
 }
 
@@ -395,12 +405,12 @@ CTrafficManager::FindCreationPointsOnHighway (
 			continue;
 		}
 		
-		CRoadPos roadPos;
-		bool haveValFromMonitor = pHcsm->GetMonitorByName( 
+		const CRoadPos* pRoadPos;
+		bool haveValFromMonitor = pHcsm->BorrowMonitorByName( 
 												"RoadPos", 
-												&roadPos
+												&pRoadPos
 												);
-		if( !haveValFromMonitor || !roadPos.IsValid() ) 
+		if( !haveValFromMonitor || !pRoadPos->IsValid() ) 
 		{
 				
 #ifdef DEBUG_FIND_CREATION_POINTS_ON_HIGHWAY
@@ -409,6 +419,7 @@ CTrafficManager::FindCreationPointsOnHighway (
 #endif
 			continue;
 		}
+		const CRoadPos& roadPos = *pRoadPos;
 
 #ifdef DEBUG_FIND_CREATION_POINTS_ON_HIGHWAY
 		gout << "  looking at obj " << objs[i] << endl;
@@ -815,11 +826,8 @@ CTrafficManager::CreateObjects(
 				}
 			}
 
-			string blockStr;
-			blk.Store( blockStr );
-
-			vector<string> adoPath = blk.GetPath();
 #ifdef DEBUG_CREATE_OBJECTS
+			vector<string> adoPath = blk.GetPath();
 			gout << "  blk name = " << blk.GetName() << endl;
 			gout << "  blk solName = " << blk.GetSolName() << endl;
 	//		gout << "  blk path = " << blk.GetPath() << end;
@@ -828,7 +836,7 @@ CTrafficManager::CreateObjects(
 			gout << "  blk initVel = " << blk.GetVelCtrlInitVel() << endl;
 #endif
 
-			CHcsm* pTM_Ado = m_pRootCollection->CreateHcsm( "Ado", blk);
+			CHcsm* pTM_Ado = m_pRootCollection->CreateHcsm( eHCSM_Ado, blk );
 
 
 			if( !pTM_Ado )
@@ -938,12 +946,12 @@ CTrafficManager::DeleteObjects()
 			continue;
 		}
 				
-		CRoadPos roadPos;
-		bool haveValFromMonitor = pHcsm->GetMonitorByName( 
+		const CRoadPos* pRoadPos;
+		bool haveValFromMonitor = pHcsm->BorrowMonitorByName( 
 												"RoadPos", 
-												&roadPos
+												&pRoadPos
 												);
-		bool haveValidRoadPos = haveValFromMonitor && roadPos.IsValid(); 
+		bool haveValidRoadPos = haveValFromMonitor && pRoadPos->IsValid(); 
 		if( !haveValidRoadPos ) 
 		{					
 #ifdef DEBUG_DELETE_OBJECTS
@@ -952,6 +960,7 @@ CTrafficManager::DeleteObjects()
 #endif
 			continue;
 		}
+		const CRoadPos& roadPos = *pRoadPos;
 
 #ifdef DEBUG_DELETE_OBJECTS
 		gout << "  looking at obj " << objs[i] << endl;
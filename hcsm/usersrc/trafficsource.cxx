@@ -45,6 +45,7 @@ CTrafficSource::UserCreation( const CTrafSrcParseBlock* cpBlock	)
 		int curFrame = GetFrame();
 		m_initCondition.SetObjectInitCond(
 								*cved, 
+								m_pRootCollection->GetInitCondScheduler(),
 								curFrame, 
 								GetTimeStepDuration(),  
 								cpBlock->GetCrRad(),  
@@ -109,6 +110,16 @@ CTrafficSource::UserCreation( const CTrafSrcParseBlock* cpBlock	)
 			}
 		}
 
+		// look the templates up once, MakeTraffic creates them by id
+		m_trafficIds.clear();
+		vector<CSnoBlock>::const_iterator tItr;
+		for( tItr = m_traffic.begin(); tItr != m_traffic.end(); tItr++ )
+		{
+			m_trafficIds.push_back( 
+						CHcsmCollection::GetTemplateId( tItr->GetBlockName() )
+						);
+		}
+
 		m_rng.SetAllSeeds( 2, 1 );
 		m_rngTime = m_rng.GetStream();
 		m_rngTraffic = m_rng.GetStream();
@@ -442,7 +453,7 @@ CTrafficSource::MakeTraffic( void )
 #endif
 
 	CHcsm* pHcsm = m_pRootCollection->CreateHcsm(
-				m_traffic[idx].GetBlockName(), m_traffic[idx]
+				m_trafficIds[idx], m_traffic[idx]
 				);
 
 	if( !pHcsm ) 
@@ -34,6 +34,7 @@ CTrffcLghtTrigger::UserCreation( const CTriggerParseBlock* cpBlock )
 		// Initialize CObjectInitCond object
 		m_initCondition.SetObjectInitCond(
 									*cved, 
+									m_pRootCollection->GetInitCondScheduler(),
 									GetFrame(), 
 									GetTimeStepDuration(),  
 									cpBlock->GetCrRad(),  
@@ -14,6 +14,7 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "triggerfirecond.h"
+#include "hcsmcheckpoint.h"
 
 #define	FC_STATE_DEBUG	0
 
@@ -151,6 +152,37 @@ void CTriggerFireCond::SetPredicate(bool val)
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: These functions save and restore the state of the object
+//		in a checkpoint.
+//
+/////////////////////////////////////////////////////////////////////////////
+void CTriggerFireCond::SaveState(CHcsmCheckpoint& ckpt) const
+{
+	ckpt.Put(m_state);
+	ckpt.Put(m_deltaT);
+	ckpt.Put(m_fireDelay);
+	ckpt.Put(m_debounce);
+	ckpt.Put(m_oneShot);
+	ckpt.Put(m_predValue);
+	ckpt.Put(m_startPredTrue);
+	ckpt.Put(m_startDebounce);
+}
+
+void CTriggerFireCond::RestoreState(CHcsmCheckpoint& ckpt, const CVED::CCved&)
+{
+	ckpt.Get(m_state);
+	ckpt.Get(m_deltaT);
+	ckpt.Get(m_fireDelay);
+	ckpt.Get(m_debounce);
+	ckpt.Get(m_oneShot);
+	ckpt.Get(m_predValue);
+	ckpt.Get(m_startPredTrue);
+	ckpt.Get(m_startDebounce);
+}
+
+
 void CTriggerFireCond::DoPredTransition(const int actualTime) {
 
 	// Protected method to prevent repetition in the code.
@@ -28,6 +28,9 @@ using namespace std;
 #include <iostream>
 #endif
 
+class CHcsmCheckpoint;
+namespace CVED { class CCved; }
+
 // The different states that an instance of the class CTriggerFireCond 
 // can be in.  They occur under the following conditions:
 //	eNOT_INIT:		Default initial condition.  Indicates that the object has
@@ -76,6 +79,10 @@ class CTriggerFireCond {
 		// Sets the local m_predValue variable to the parameter.
 		void SetPredicate(bool val);
 
+		// Save or restore the state of the object in a checkpoint.
+		void SaveState(CHcsmCheckpoint& ckpt) const;
+		void RestoreState(CHcsmCheckpoint& ckpt, const CVED::CCved&);
+
 	protected: 
 		EFireCond	m_state;
 		double		m_deltaT;
@@ -31,9 +31,10 @@
 /////////////////////////////////////////////////////////////////////////////
 CTrmntSmltnActn::CTrmntSmltnActn( 
 			const CActionParseBlock* cpBlock, 
-			CHcsmCollection*
+			CHcsmCollection* pHC
 			)
 {
+	m_pHC = pHC;
 	m_delay = cpBlock->GetDelay();
 }
 
@@ -86,7 +87,7 @@ CTrmntSmltnActn::operator=( const CTrmntSmltnActn& cRhs )
 
 	if( this != &cRhs )
 	{
-		;
+		m_pHC = cRhs.m_pHC;
 	}
 
 	return *this;
@@ -107,5 +108,5 @@ void
 CTrmntSmltnActn::Execute( const set<CCandidate>* )
 {
 	// Call global function
-	TerminateSimulation();
+	TerminateSimulation( m_pHC );
 }
@@ -34,6 +34,7 @@ public:
 	inline const char* GetName() const { return "TrmntSmltn"; };
 
 protected:
+	CHcsmCollection* m_pHC;
 };
 
 #endif	// _TRMNT_SMLTN_ACTN_H_
@@ -116,5 +116,5 @@ CTurnGraphOffActn::operator=( const CTurnGraphOffActn& cRhs )
 void 
 CTurnGraphOffActn::Execute( const set<CCandidate>* ) 
 {
-	CHcsmCollection::m_sGraphIsOn = false;
+	m_pHC->m_ctx.m_sGraphIsOn = false;
 }
\ No newline at end of file
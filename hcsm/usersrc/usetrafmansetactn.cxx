@@ -118,5 +118,5 @@ CUseTrafManSetActn::Execute( const set<CCandidate>* )
 	{
 		pTrafMan->SetDialInputSet( m_setName );
 	}
-	CHcsmCollection::SetActionUseTrafManSetLog( this->m_triggerId, m_setName );
+	m_pHC->SetActionUseTrafManSetLog( this->m_triggerId, m_setName );
 }
@@ -18,8 +18,37 @@
 
 #include <pi_iostream>
 #include <pi_fstream>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
 using namespace std;
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Reads a whole file into a string.
+//
+// Returns:  A boolean indicating if the file could be read.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+ReadFile( const string& fileName, string& contents )
+{
+
+	ifstream inFile( fileName.c_str(), ios::in | ios::binary );
+	if ( inFile.fail() )  return false;
+
+	inFile.seekg( 0, ios::end );
+	streamoff size = inFile.tellg();
+	inFile.seekg( 0, ios::beg );
+	if ( size < 0 )  return false;
+
+	contents.resize( (size_t) size );
+	if ( size > 0 )  inFile.read( &contents[0], size );
+
+	return !inFile.bad();
+
+}  // ReadFile
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: Prints the contents of the TVehDynCommand parameter.
@@ -76,11 +105,13 @@ operator<<( ostream& out, const CVehDynCommand::TVehDynCommand& command )
 //////////////////////////////////////////////////////////////////////
 
 CVehDynCommand::CVehDynCommand()
+	: m_next( 0 )
 {
 
 }
 
 CVehDynCommand::CVehDynCommand( const string& cmdFileName )
+	: m_next( 0 )
 {
 
 	if ( !ParseCommandFile( cmdFileName ) ) {
@@ -107,6 +138,7 @@ CVehDynCommand::operator=( const CVehDynCommand& objToCopy )
 	if ( this != &objToCopy ) {
 
 		m_commands = objToCopy.m_commands;
+		m_next     = objToCopy.m_next;
 
 	}
 
@@ -121,95 +153,150 @@ CVehDynCommand::~CVehDynCommand()
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Description:  Parses a vehicle dynamics command file.
+// Description:  Parses the contents of a vehicle dynamics command file.
 //
-// Remarks:  This function accepts a string that represents the name of
-//   of a file that contains vehicle dynamics commands.  The function
-//   parses this file and builds a list of commands.
+// Remarks:  A command file is a sequence of whitespace separated
+//   commands: "speed <value1> <value2>", "speeddist <value1> <value2>"
+//   or "wait <value1>".  The whole file is parsed in place with strtod,
+//   so large files are parsed in a single pass without any stream
+//   overhead.
 //
 // Arguments:
-//   cmdFileName - The command file's name.
+//   cmdFileName - The command file's name, for messages.
+//   contents - The contents of the file.
+//   commands - (output) The parsed commands are appended to this.
+//   err - Where to print the problems found.
 //
-// Returns:  A boolean indicating if the file was successfully parsed.
+// Returns:  A boolean indicating if the contents were parsed without
+//   errors.
 //
 //////////////////////////////////////////////////////////////////////////////
-bool  
-CVehDynCommand::ParseCommandFile( const string& cmdFileName )
+bool
+CVehDynCommand::ParseBuffer(
+			const string& cmdFileName,
+			const string& contents,
+			vector<TVehDynCommand>& commands,
+			ostream& err
+			)
 {
 
-	//gout << "cmd file size = " << cmdFileName.size() << endl;
-	if ( cmdFileName.size() <= 0 )  return false;
+	const char* pCurr = contents.c_str();
+	int line = 1;
 
-	// open the command file for input
-	//gout << "** Command file name is " << cmdFileName << endl;
-	ifstream inFile( cmdFileName.c_str() );
-	
-	if ( inFile.fail() ) {
+	for ( ;; ) {
 
-		cerr << "Cannot open command file named '" << cmdFileName;
-		cerr << "'" << endl;
+		// skip whitespace, counting lines for the messages
+		while ( *pCurr != '\0' && isspace( (unsigned char) *pCurr ) ) {
 
-		return false;
+			if ( *pCurr == '\n' )  line++;
+			pCurr++;
 
-	}
-	else {
+		}
+		if ( *pCurr == '\0' )  break;
 
-		while ( !inFile.eof() ) {
+		const char* pWord = pCurr;
+		while ( *pCurr != '\0' && !isspace( (unsigned char) *pCurr ) )  pCurr++;
+		size_t wordLen = pCurr - pWord;
 
-			TVehDynCommand command;
+		TVehDynCommand command;
+		int numValues;
+		if ( wordLen == 5 && strncmp( pWord, "speed", 5 ) == 0 ) {
 
-			string str;
-			inFile >> str;
+			command.type = eCMD_SPEED;
+			numValues = 2;
 
-			//gout << "**str = " << str << endl;
+		}
+		else if ( wordLen == 9 && strncmp( pWord, "speeddist", 9 ) == 0 ) {
 
-			if ( str == "speed" ) {
+			command.type = eCMD_SPEED_DIST;
+			numValues = 2;
 
-				command.type = eCMD_SPEED;
+		}
+		else if ( wordLen == 4 && strncmp( pWord, "wait", 4 ) == 0 ) {
 
-				inFile >> command.value1;
-				inFile >> command.value2;
+			command.type = eCMD_WAIT;
+			numValues = 1;
 
-				m_commands.push_back( command );
+		}
+		else {
 
-			}
-			else if ( str == "speeddist" ) {
+			err << "CVehDynCommand: unknown command in file named '";
+			err << cmdFileName << "' at line " << line << endl;
+			err << "  command = " << string( pWord, wordLen ) << endl;
 
-				command.type = eCMD_SPEED_DIST;
+			return false;
 
-				inFile >> command.value1;
-				inFile >> command.value2;
+		}
 
-				m_commands.push_back( command );
+		double* pValues[2] = { &command.value1, &command.value2 };
+		command.value2 = 0.0;
+		for ( int v = 0; v < numValues; v++ ) {
 
-			}
-			else if ( str == "wait" ) {
+			char* pEnd;
+			*pValues[v] = strtod( pCurr, &pEnd );
+			if ( pEnd == pCurr ||
+				 ( *pEnd != '\0' && !isspace( (unsigned char) *pEnd ) ) ) {
 
-				command.type = eCMD_WAIT;
-				inFile >> command.value1;
+				err << "CVehDynCommand: bad or missing value for '";
+				err << string( pWord, wordLen ) << "' in file named '";
+				err << cmdFileName << "' at line " << line << endl;
 
-				m_commands.push_back( command );
+				return false;
 
 			}
-			else if ( str == "" ) {
 
-				// ignore
+			// strtod skipped any newlines before the number
+			for ( const char* p = pCurr; p < pEnd; p++ ) {
+
+				if ( *p == '\n' )  line++;
 
 			}
-			else {
+			pCurr = pEnd;
 
-				cerr << "CVehDynCommand: unknown command in file named '";
-				cerr << cmdFileName << "'" << endl;
-				cerr << "  command = " << str << endl;
+		}
 
-				return false;
+		commands.push_back( command );
 
-			}
+	}
+
+	return true;
+
+}  // ParseBuffer
 
 
-		}  // while
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Parses a vehicle dynamics command file.
+//
+// Remarks:  This function accepts a string that represents the name of
+//   of a file that contains vehicle dynamics commands.  The function
+//   parses this file and appends its commands to the list.
+//
+// Arguments:
+//   cmdFileName - The command file's name.
+//
+// Returns:  A boolean indicating if the file was successfully parsed.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool  
+CVehDynCommand::ParseCommandFile( const string& cmdFileName )
+{
+
+	if ( cmdFileName.size() <= 0 )  return false;
+
+	string contents;
+	if ( !ReadFile( cmdFileName, contents ) ) {
+
+		cerr << "Cannot open command file named '" << cmdFileName;
+		cerr << "'" << endl;
+
+		return false;
+
+	}
+
+	if ( !ParseBuffer( cmdFileName, contents, m_commands, cerr ) ) {
 
-		inFile.close();
+		return false;
 
 	}
 
@@ -230,12 +317,67 @@ CVehDynCommand::ParseCommandFile( const string& cmdFileName )
 }  // ParseCommandFile
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Checks a vehicle dynamics command file without loading it.
+//
+// Remarks:  This function lets tools and scenario editors validate a
+//   command file ahead of a run; it applies the same rules as
+//   ParseCommandFile.
+//
+// Arguments:
+//   cmdFileName - The command file's name.
+//   numCommands - (output) The number of commands in the file.
+//   err - Where to print the problems found.
+//
+// Returns:  A boolean indicating if the file is valid.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CVehDynCommand::CheckCommandFile(
+			const string& cmdFileName,
+			int& numCommands,
+			ostream& err
+			)
+{
+
+	numCommands = 0;
+
+	string contents;
+	if ( !ReadFile( cmdFileName, contents ) ) {
+
+		err << "Cannot open command file named '" << cmdFileName;
+		err << "'" << endl;
+
+		return false;
+
+	}
+
+	vector<TVehDynCommand> commands;
+	if ( !ParseBuffer( cmdFileName, contents, commands, err ) )  return false;
+
+	numCommands = (int) commands.size();
+	if ( numCommands <= 0 ) {
+
+		err << "Command file named '" << cmdFileName;
+		err << "' has no commands" << endl;
+
+		return false;
+
+	}
+
+	return true;
+
+}  // CheckCommandFile
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Returns the next command in the list.
 //
-// Remarks:  This functions returns the next command in the list.  It
-//   also removes the command from the list.
+// Remarks:  This functions returns the next command in the list and
+//   advances past it.  The commands stay in memory so that Seek can
+//   go back to them.
 //
 // Arguments:
 //
@@ -246,12 +388,10 @@ void
 CVehDynCommand::GetNextCommand( TVehDynCommand& command )
 {
 
-	if ( m_commands.size() > 0 ) {
+	if ( m_next < m_commands.size() ) {
 
-		vector<TVehDynCommand>::iterator i;
-		i = m_commands.begin();
-		command = *i;
-		m_commands.erase( i );
+		command = m_commands[m_next];
+		m_next++;
 
 	}
 	else {
@@ -263,13 +403,67 @@ CVehDynCommand::GetNextCommand( TVehDynCommand& command )
 }  // GetNextCommand
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Returns the number of commands dequeued so far.
+//
+// Remarks:  The value can be saved with the rest of the simulation state
+//   and passed back to Seek to resume from the same command.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CVehDynCommand::GetPosition() const
+{
+
+	return (int) m_next;
+
+}  // GetPosition
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Moves to the given command.
+//
+// Arguments:
+//   position - The number of commands to consider dequeued, as returned
+//     by GetPosition.
+//
+// Returns:  A boolean indicating if the position is valid; if not the
+//   position does not change.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CVehDynCommand::Seek( int position )
+{
+
+	if ( position < 0 || position > (int) m_commands.size() )  return false;
+
+	m_next = position;
+	return true;
+
+}  // Seek
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:  Moves back to the first command.
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CVehDynCommand::Rewind()
+{
+
+	m_next = 0;
+
+}  // Rewind
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Returns the number of commands in the list.
 //
-// Remarks:  This function returns the current number of commands in
-//   the list.
+// Remarks:  This function returns the number of commands that have
+//   not been dequeued yet.
 //
 // Arguments:
 //
@@ -280,6 +474,6 @@ int
 CVehDynCommand::NumCommands()
 {
 
-	return m_commands.size();
+	return (int) ( m_commands.size() - m_next );
 
 }  // NumCommands
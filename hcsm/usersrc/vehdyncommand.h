@@ -57,8 +57,23 @@ public:
 	void GetNextCommand( TVehDynCommand& );
 	int  NumCommands();
 
+	// replay support; positions count the commands already dequeued
+	int  GetPosition() const;
+	bool Seek( int );
+	void Rewind();
+
+	static bool CheckCommandFile( const string&, int&, ostream& );
+
 private:
+	static bool ParseBuffer(
+				const string&,
+				const string&,
+				vector<TVehDynCommand>&,
+				ostream&
+				);
+
 	vector<TVehDynCommand> m_commands;
+	size_t                 m_next;		// index of the next command to return
 
 };
 
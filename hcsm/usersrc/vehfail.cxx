@@ -116,18 +116,13 @@ void CVehFail::UserPreActivity(
 		}
 		else {				// received a valid message
 			TMessage                        msg;
-			CVehFailClient::TVehFailure*    pFailure;
+			CVehFailClient::TVehFailure     failure;
 
 			if ( ReadMessage(m_CmdSock, msgHeader, msg) ) {
 				SendMessage(m_CmdSock, 0, 0, 0);
 
-				pFailure = (CVehFailClient::TVehFailure*) &msg.data;
-				pFailure->m_type = (CVehFailClient::EVehFailureType)ntohl( pFailure->m_type );
-				for (int n=0; n < 11; n++) {
-					pFailure->m_flags[n] = ntohl( pFailure->m_flags[n] );
-				}
-				
-				m_Failures.push(*pFailure);
+				CVehFailClient::DecodeFailure( msg, failure );
+				m_Failures.push(failure);
 			}
 			else {
 				fprintf(stderr, "Couldn't read whole message\n");
@@ -167,25 +162,25 @@ void CVehFail::UserPostActivity(
 			case CVehFailClient::eTIRE:
 				for (n=0; n<10; n++)
 					if ((int)failure.m_flags[n] != -1)
-						CHcsmCollection::m_sTireCond[n] = failure.m_flags[n];
+						m_pRootCollection->m_ctx.m_sTireCond[n] = failure.m_flags[n];
 				break;
 			case CVehFailClient::eBRAKE:
 				for (n=0; n<11; n++)
-					CHcsmCollection::m_sBrakeCond[n] = failure.m_flags[n];
+					m_pRootCollection->m_ctx.m_sBrakeCond[n] = failure.m_flags[n];
 				break;
 			case CVehFailClient::eSHOCKS:
 				break;
 			case CVehFailClient::eSTEERING:
-				CHcsmCollection::m_sSteeringCond = failure.m_flags[0];
+				m_pRootCollection->m_ctx.m_sSteeringCond = failure.m_flags[0];
 				break;
 			case CVehFailClient::eALERTS:
-				CHcsmCollection::m_sAlertCond = failure.m_flags[0];
+				m_pRootCollection->m_ctx.m_sAlertCond = failure.m_flags[0];
 				break;
 			case CVehFailClient::eINFORMATION:
-				CHcsmCollection::m_sInfoCond = failure.m_flags[0];
+				m_pRootCollection->m_ctx.m_sInfoCond = failure.m_flags[0];
 				break;
 			case CVehFailClient::eCABCOMPONENT:
-				CHcsmCollection::m_sCabComponentCond = failure.m_flags[0];
+				m_pRootCollection->m_ctx.m_sCabComponentCond = failure.m_flags[0];
 				break;
 		}
 	}
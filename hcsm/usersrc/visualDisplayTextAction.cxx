@@ -147,12 +147,12 @@ CSetDisplayText::Execute( const set<CCandidate>* )
 				varValue = "";
 				int varNameLength = pos_end - (pos + 1);
 				varName = varValOut.substr(pos + 1, varNameLength);
-				if (CHcsmCollection::ExprVariableExists(varName)) {
+				if (m_pHC->ExprVariableExists(varName)) {
 					converter.str("");
 					converter.clear();
 					converter.setf(ios::fixed);
 					converter.precision(2);
-					converter << CHcsmCollection::GetExprVariable(varName);
+					converter << m_pHC->GetExprVariable(varName);
 					converter >> varValue;
 				} else {
 					//gout << "Set Display Text Action: Warning Cannot Find Variable " << varName << endl;
@@ -166,6 +166,6 @@ CSetDisplayText::Execute( const set<CCandidate>* )
 			isDone = true;
 		}
 	}
-	CHcsmCollection::SetVisualDisplayText(varValOut, m_location);
-	//CHcsmCollection::SetActionSetVariableLog(m_triggerId, "VisualDisplayText", newValue);
+	m_pHC->SetVisualDisplayText(varValOut, m_location);
+	//m_pHC->SetActionSetVariableLog(m_triggerId, "VisualDisplayText", newValue);
 }
@@ -150,37 +150,37 @@ CWriteCellActn::operator=( const CWriteCellActn& cRhs )
 void 
 CWriteCellActn::Execute( const set<CCandidate>* ) 
 {
-	int eventNum = CHcsmCollection::m_sScenarioWriteCellDataSize;
+	int eventNum = m_pHC->m_ctx.m_sScenarioWriteCellDataSize;
 	bool haveSpace = eventNum < cMAX_SCENARIO_WRITE_CELL_EVENTS;
 	if( haveSpace )
 	{
-		CHcsmCollection::m_sScenarioWriteCellData[eventNum].cellName = m_cellName;
-		CHcsmCollection::m_sScenarioWriteCellData[eventNum].cellType = m_cellType;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].cellName = m_cellName;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].cellType = m_cellType;
 		if( m_isVariable )
 		{
 			string varName = m_cellData;
-			double varVal = CHcsmCollection::GetExprVariable( varName );
+			double varVal = m_pHC->GetExprVariable( varName );
 			if( m_cellType == CActionParseBlock::eFLOAT )
 			{
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].floatData.clear();
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].floatData.push_back( (float) varVal );
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].floatData.clear();
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].floatData.push_back( (float) varVal );
 			}
 			else if( m_cellType == CActionParseBlock::eSHORT )
 			{
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].shortData.clear();
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].shortData.push_back( (short) varVal );
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].shortData.clear();
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].shortData.push_back( (short) varVal );
 			}
 			else if( m_cellType == CActionParseBlock::eINT )
 			{
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].intData.clear();
-                CHcsmCollection::m_sScenarioWriteCellData[eventNum].intData.push_back( (int) varVal );
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].intData.clear();
+                m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].intData.push_back( (int) varVal );
 			}
 		}
 		else
 		{
 			if( m_cellType == CActionParseBlock::eFLOAT )
 			{
-				CHcsmCollection::m_sScenarioWriteCellData[eventNum].floatData = m_floatData;
+				m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].floatData = m_floatData;
 
 				//
 				// Saves false alarm info so that it can be used by the collision warning
@@ -192,33 +192,33 @@ CWriteCellActn::Execute( const set<CCandidate>* )
 					int index = 0;
 					for( itr = m_floatData.begin(); itr != m_floatData.end(); itr++ )
 					{
-						CHcsmCollection::m_sFalseAlarmInfo[index] = *itr;
+						m_pHC->m_ctx.m_sFalseAlarmInfo[index] = *itr;
 						index++;
 					}
 				}
 			}
 			else if( m_cellType == CActionParseBlock::eSHORT )
 			{
-				CHcsmCollection::m_sScenarioWriteCellData[eventNum].shortData = m_shortData;
+				m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].shortData = m_shortData;
 			}
 			else if( m_cellType == CActionParseBlock::eINT )
 			{
-				CHcsmCollection::m_sScenarioWriteCellData[eventNum].intData = m_intData;
+				m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].intData = m_intData;
 			}
 		}
 
-		CHcsmCollection::m_sScenarioWriteCellData[eventNum].cellData = m_cellData;
-		CHcsmCollection::m_sScenarioWriteCellData[eventNum].frame = CHcsmCollection::m_frame;
-		CHcsmCollection::m_sScenarioWriteCellDataSize++;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].cellData = m_cellData;
+		m_pHC->m_ctx.m_sScenarioWriteCellData[eventNum].frame = m_pHC->GetFrame();
+		m_pHC->m_ctx.m_sScenarioWriteCellDataSize++;
 	}
 	else
 	{
 		gout << "CWriteCellActn:Execute: out of space on cell write event list" << endl;
 #if 1
 		int i;
-		for( i = 0; i < CHcsmCollection::m_sScenarioWriteCellDataSize; i++ )
+		for( i = 0; i < m_pHC->m_ctx.m_sScenarioWriteCellDataSize; i++ )
 		{
-			gout << i << ":" << CHcsmCollection::m_sScenarioWriteCellData[i].frame << ": " << CHcsmCollection::m_sScenarioWriteCellData[i].cellName << ", " << CHcsmCollection::m_sScenarioWriteCellData[i].cellType << ", " << CHcsmCollection::m_sScenarioWriteCellData[i].cellData << endl;
+			gout << i << ":" << m_pHC->m_ctx.m_sScenarioWriteCellData[i].frame << ": " << m_pHC->m_ctx.m_sScenarioWriteCellData[i].cellName << ", " << m_pHC->m_ctx.m_sScenarioWriteCellData[i].cellType << ", " << m_pHC->m_ctx.m_sScenarioWriteCellData[i].cellData << endl;
 		}
 #endif
 	}
@@ -33,8 +33,29 @@
 #include <sstream>
 #endif
 
+#include <chrono>
+
 static char* pNoError = "No error";
 
+//
+// Makes reads on the socket give up after the specified time, with the
+// same result as a read on a non-blocking socket that has no data.
+//
+static void
+SetRecvTimeout(SOCKET sock, int ms)
+{
+#ifdef _WIN32
+	DWORD timeout = ms;
+	setsockopt( sock, SOL_SOCKET, SO_RCVTIMEO, 
+		(const char*) &timeout, sizeof(timeout) );
+#else
+	timeval timeout;
+	timeout.tv_sec  = ms / 1000;
+	timeout.tv_usec = ( ms % 1000 ) * 1000;
+	setsockopt( sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout) );
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Description: default constructor
@@ -49,6 +70,11 @@ CVehFailClient::CVehFailClient()
 {
 	m_ErrorMsg  = pNoError;
 	m_Socket    = -1;
+
+	m_AsyncPort    = VEH_FAILURES_PORT;
+	m_AsyncSock    = -1;
+	m_OutboxTicket = 1;
+	m_StopSender   = false;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -63,6 +89,7 @@ CVehFailClient::CVehFailClient()
 //
 CVehFailClient::~CVehFailClient()
 {
+	StopAsync();
 }
 
 
@@ -132,9 +159,7 @@ CVehFailClient::SendFailure(const TVehFailure &info)
 	}
 	if (status) {
 		TVehFailure sendInfo;
-		sendInfo.m_type  = (CVehFailClient::EVehFailureType)htonl(info.m_type);
-		for (int n = 0; n < 11; n++)
-		sendInfo.m_flags[n] = htonl(info.m_flags[n]);
+		EncodeFailure( info, sendInfo );
 		
 		if ( !SendMessage(m_Socket, VEH_FAILURE_CMD, &sendInfo, sizeof(info))) {
 			m_ErrorMsg = "Could not send message.";
@@ -210,3 +235,428 @@ CVehFailClient::IsConnected()
 
 
 
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: convert a failure to network byte order
+//
+// Arguments:
+// info     - the failure
+// sendInfo - where to put the failure as sent on the wire
+//
+void
+CVehFailClient::EncodeFailure(const TVehFailure &info, TVehFailure &sendInfo)
+{
+	sendInfo.m_type  = (CVehFailClient::EVehFailureType)htonl(info.m_type);
+	for (int n = 0; n < 11; n++)
+		sendInfo.m_flags[n] = htonl(info.m_flags[n]);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: extract the failure from a received message
+//
+// Arguments:
+// msg     - the message, as read by ReadMessage
+// failure - where to put the failure, in host byte order
+//
+void
+CVehFailClient::DecodeFailure(const TMessage &msg, TVehFailure &failure)
+{
+	const TVehFailure* pSent = (const TVehFailure*) &msg.data;
+	failure.m_type = (CVehFailClient::EVehFailureType)ntohl( pSent->m_type );
+	for (int n=0; n < 11; n++) {
+		failure.m_flags[n] = ntohl( pSent->m_flags[n] );
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: start the background sender
+//
+// Remarks:
+// After this call failures can be queued with PostFailure.  The
+// connection is made by the sender thread, so this function does not
+// wait for the receiver and succeeds even if it is not running yet.
+//
+// Arguments:
+// ip   - the ip address or name of the machine running the HCSM system
+// port - the port the receiver listens on
+//
+// Returns:
+// False if the sender is already running.
+//
+bool
+CVehFailClient::StartAsync(const string& ip, int port)
+{
+	if ( m_Sender.joinable() ) {
+		m_ErrorMsg = "Background sender already started";
+		return false;
+	}
+
+	m_AsyncIp    = ip;
+	m_AsyncPort  = port;
+	m_StopSender = false;
+	m_Sender     = thread( &CVehFailClient::SenderMain, this );
+
+	m_ErrorMsg = pNoError;
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: queue a failure for the background sender
+//
+// Remarks:
+// The function never waits for the network; it only takes a lock
+// that the sender holds for a few instructions at a time.  Failures
+// are delivered in the order they are posted.
+//
+// Arguments:
+// info - the failure
+//
+// Returns:
+// A ticket to pass to GetDeliveryStatus, or -1 if the background
+// sender is not running.
+//
+int
+CVehFailClient::PostFailure(const TVehFailure &info)
+{
+	if ( !m_Sender.joinable() ) {
+		m_ErrorMsg = "Background sender not started";
+		return -1;
+	}
+
+	int ticket;
+	{
+		lock_guard<mutex> guard( m_AsyncLock );
+		m_Outbox.push_back( info );
+		m_Status.push_back( ePENDING );
+		ticket = (int) m_Status.size();
+	}
+	m_AsyncCond.notify_one();
+
+	m_ErrorMsg = pNoError;
+	return ticket;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: get what happened to a posted failure
+//
+// Arguments:
+// ticket - the value returned by PostFailure
+//
+// Returns:
+// The delivery status of the failure.
+//
+CVehFailClient::EDeliveryStatus
+CVehFailClient::GetDeliveryStatus(int ticket) const
+{
+	lock_guard<mutex> guard( m_AsyncLock );
+	if ( ticket < 1 || ticket > (int) m_Status.size() ) return eUNKNOWN_TICKET;
+	return (EDeliveryStatus) m_Status[ticket - 1];
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: get the number of posted failures not delivered or
+// given up on yet
+//
+int
+CVehFailClient::NumPending(void) const
+{
+	lock_guard<mutex> guard( m_AsyncLock );
+	return (int) m_Outbox.size();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: stop the background sender
+//
+// Remarks:
+// The failure being sent, if any, is finished first.  Failures still
+// queued are marked undelivered.
+//
+void
+CVehFailClient::StopAsync(void)
+{
+	if ( !m_Sender.joinable() ) return;
+
+	{
+		lock_guard<mutex> guard( m_AsyncLock );
+		m_StopSender = true;
+	}
+	m_AsyncCond.notify_one();
+	m_Sender.join();
+
+	lock_guard<mutex> guard( m_AsyncLock );
+	while ( !m_Outbox.empty() ) {
+		m_Status[m_OutboxTicket - 1] = eUNDELIVERED;
+		m_Outbox.pop_front();
+		m_OutboxTicket++;
+	}
+	CloseAsyncSock();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: the body of the background sender thread
+//
+// Remarks:
+// Sends the first queued failure until it is acknowledged or runs out
+// of attempts, then moves on to the next one.  Between attempts the
+// thread backs off, starting at 50ms and doubling each time.
+//
+void
+CVehFailClient::SenderMain(void)
+{
+	unique_lock<mutex> lock( m_AsyncLock );
+
+	for ( ;; ) {
+		m_AsyncCond.wait( lock, [this]{ return m_StopSender || !m_Outbox.empty(); } );
+		if ( m_StopSender ) return;
+
+		TVehFailure info = m_Outbox.front();
+
+		bool delivered = false;
+		int  backoff   = 50;
+		for ( int attempt = 0; attempt < VEH_FAILURE_MAX_ATTEMPTS; attempt++ ) {
+			// the network is never touched with the lock held
+			lock.unlock();
+			delivered = SendOne( info );
+			lock.lock();
+
+			if ( delivered || m_StopSender ) break;
+
+			m_AsyncCond.wait_for( lock, chrono::milliseconds( backoff ),
+				[this]{ return m_StopSender; } );
+			if ( m_StopSender ) break;
+			backoff *= 2;
+		}
+
+		if ( !delivered && m_StopSender ) return;	// StopAsync marks it
+
+		m_Status[m_OutboxTicket - 1] = delivered ? eDELIVERED : eUNDELIVERED;
+		m_Outbox.pop_front();
+		m_OutboxTicket++;
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: send a failure on the sender's connection and wait for
+// the acknowledgment
+//
+// Remarks:
+// Connects first if needed.  Any error closes the connection, so the
+// next attempt starts with a new one.
+//
+// Returns:
+// True if the failure was acknowledged.
+//
+bool
+CVehFailClient::SendOne(const TVehFailure &info)
+{
+	if ( m_AsyncSock < 0 ) {
+		m_AsyncSock = ConnectToSocket( m_AsyncIp.c_str(), m_AsyncPort );
+		if ( m_AsyncSock < 0 ) return false;
+
+		// bound the wait for the acknowledgment
+		SetRecvTimeout( m_AsyncSock, VEH_FAILURE_ACK_TIMEOUT );
+	}
+
+	TVehFailure sendInfo;
+	EncodeFailure( info, sendInfo );
+
+	TMessage ack;
+	if ( SendMessage(m_AsyncSock, VEH_FAILURE_CMD, &sendInfo, sizeof(info)) &&
+		 RecvMessage(m_AsyncSock, ack) > 0 ) {
+		return true;
+	}
+
+	CloseAsyncSock();
+	return false;
+}
+
+
+void
+CVehFailClient::CloseAsyncSock(void)
+{
+	if ( m_AsyncSock >= 0 ) {
+		CloseSocket( m_AsyncSock );
+		m_AsyncSock = -1;
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: default constructor
+//
+CVehFailLoopback::CVehFailLoopback()
+{
+	m_Socket      = -1;
+	m_IgnoreCount = 0;
+	m_Stop        = false;
+}
+
+
+CVehFailLoopback::~CVehFailLoopback()
+{
+	Stop();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: start listening for failures
+//
+// Arguments:
+// port - the port to listen on
+//
+// Returns:
+// False if the port could not be opened.
+//
+bool
+CVehFailLoopback::Start(int port)
+{
+	if ( m_Receiver.joinable() ) return false;
+
+	m_Socket = CreateNonBlockingSocket( port );
+	if ( m_Socket < 0 ) return false;
+
+	m_Stop     = false;
+	m_Receiver = thread( &CVehFailLoopback::ReceiverMain, this );
+	return true;
+}
+
+
+void
+CVehFailLoopback::Stop(void)
+{
+	if ( m_Receiver.joinable() ) {
+		{
+			lock_guard<mutex> guard( m_Lock );
+			m_Stop = true;
+		}
+		m_Receiver.join();
+	}
+
+	if ( m_Socket >= 0 ) {
+		CloseSocket( m_Socket );
+		m_Socket = -1;
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: get the oldest failure received and not popped yet
+//
+// Returns:
+// False if there is none.
+//
+bool
+CVehFailLoopback::PopFailure(CVehFailClient::TVehFailure &failure)
+{
+	lock_guard<mutex> guard( m_Lock );
+	if ( m_Received.empty() ) return false;
+
+	failure = m_Received.front();
+	m_Received.pop_front();
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: drop the next failures without acknowledging them
+//
+// Remarks:
+// Each dropped failure also closes its connection, the way a receiver
+// that crashed would, so senders can be tested for retrying.
+//
+// Arguments:
+// count - the number of failures to drop
+//
+void
+CVehFailLoopback::SetIgnoreCount(int count)
+{
+	lock_guard<mutex> guard( m_Lock );
+	m_IgnoreCount = count;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: the body of the receiver thread
+//
+// Remarks:
+// Serves one connection at a time, like the VehFail HCSM.
+//
+void
+CVehFailLoopback::ReceiverMain(void)
+{
+	SOCKET cmdSock = -1;
+
+	for ( ;; ) {
+		{
+			lock_guard<mutex> guard( m_Lock );
+			if ( m_Stop ) break;
+		}
+
+		bool idle = true;
+
+		if ( cmdSock < 0 ) {
+			int code = PollSocketForConnection( m_Socket );
+			if ( code > 0 ) {
+				cmdSock = code;
+				// so a quiet connection does not keep Stop waiting
+				SetRecvTimeout( cmdSock, 10 );
+			}
+		}
+
+		TMsgHeader msgHeader;
+		if ( cmdSock >= 0 ) {
+			int code = ReadHeader( cmdSock, msgHeader );
+			if ( code < 0 ) {
+				CloseSocket( cmdSock );
+				cmdSock = -1;
+			}
+			else if ( code > 0 ) {
+				idle = false;
+
+				TMessage msg;
+				if ( ReadMessage( cmdSock, msgHeader, msg ) > 0 ) {
+					CVehFailClient::TVehFailure failure;
+					CVehFailClient::DecodeFailure( msg, failure );
+
+					lock_guard<mutex> guard( m_Lock );
+					if ( m_IgnoreCount > 0 ) {
+						m_IgnoreCount--;
+						CloseSocket( cmdSock );
+						cmdSock = -1;
+					}
+					else {
+						SendMessage( cmdSock, 0, 0, 0 );
+						m_Received.push_back( failure );
+					}
+				}
+			}
+		}
+
+		if ( idle ) this_thread::sleep_for( chrono::milliseconds( 1 ) );
+	}
+
+	if ( cmdSock >= 0 ) CloseSocket( cmdSock );
+}
@@ -26,6 +26,12 @@
 #include <unistd.h>
 #endif
 
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 
 #define VEH_FAILURES_PORT    5437
 
@@ -33,6 +39,11 @@
 // the only command, the actual value is irrelevant...
 #define VEH_FAILURE_CMD  9921
 
+// Attempts the background sender makes before giving up on a failure,
+// and how long it waits for an acknowledgment each time
+#define VEH_FAILURE_MAX_ATTEMPTS   5
+#define VEH_FAILURE_ACK_TIMEOUT    500		// ms
+
 ///////////////////////////////////////////////////////////////////////////// 
 /// This class allows any program to connect to the HCSM system and
 /// communicate vehicle failures through a TCP/IP interface.
@@ -45,6 +56,17 @@
 /// that HCSM should be running for this class to be able to
 /// connect to it.
 ///
+/// SendFailure waits for the acknowledgment, so a slow or unreachable
+/// receiver stalls the caller.  Callers that cannot afford that, such
+/// as a real-time loop, use StartAsync and PostFailure instead: the
+/// failures are queued and a background thread sends them one at a
+/// time, in the order they were posted, each after the previous one
+/// was acknowledged.  A failure that cannot be delivered is retried,
+/// reconnecting as needed, up to VEH_FAILURE_MAX_ATTEMPTS times.  The
+/// caller polls the outcome with GetDeliveryStatus.  Since a lost
+/// acknowledgment also causes a retry, the receiver may see the same
+/// failure twice in a row; applying a failure is idempotent.
+///
 ///\ingroup HCSM
 /////////////////////////////////////////////////////////////////////////////
 class CVehFailClient {
@@ -91,6 +113,16 @@ public:
 		TU32b             m_flags[11];
 	};
 
+	//
+	// What happened to a failure handed to PostFailure.
+	//
+	enum EDeliveryStatus {
+		eUNKNOWN_TICKET = 0,	// not returned by PostFailure
+		ePENDING        = 1,	// queued or being sent
+		eDELIVERED      = 2,	// the receiver acknowledged it
+		eUNDELIVERED    = 3		// given up on
+	};
+
 public:
 	bool Connect( const string& ip );
 	bool SendFailure(const TVehFailure &);
@@ -99,12 +131,72 @@ public:
 	bool Initialize();
 	bool IsConnected();
 
+	bool StartAsync( const string& ip, int port = VEH_FAILURES_PORT );
+	int  PostFailure( const TVehFailure& );
+	EDeliveryStatus GetDeliveryStatus( int ticket ) const;
+	int  NumPending( void ) const;
+	void StopAsync( void );
+
+	static void EncodeFailure( const TVehFailure&, TVehFailure& );
+	static void DecodeFailure( const TMessage&, TVehFailure& );
+
 private:
 	bool ConnectToDataSock(void);
+	void SenderMain( void );
+	bool SendOne( const TVehFailure& );
+	void CloseAsyncSock( void );
 
 	string			m_ErrorMsg;		// most recent error message
 	SOCKET          m_Socket;		// socket
 	char            m_IpAddr[255];  // machine we are connected to
+
+	//
+	// The background sender.  Everything below m_AsyncLock is guarded
+	// by it; the socket and address are only used by the sender thread.
+	//
+	string                      m_AsyncIp;
+	int                         m_AsyncPort;
+	SOCKET                      m_AsyncSock;
+	thread                      m_Sender;
+	mutable mutex               m_AsyncLock;
+	condition_variable          m_AsyncCond;
+	deque<TVehFailure>          m_Outbox;		// first one is being sent
+	int                         m_OutboxTicket;	// ticket of the first one
+	vector<char>                m_Status;		// EDeliveryStatus by ticket - 1
+	bool                        m_StopSender;
+};
+
+
+///////////////////////////////////////////////////////////////////////////// 
+/// An in-process stand-in for the VehFail HCSM, for testing programs
+/// that send vehicle failures.  It listens on a port on a thread of
+/// its own, acknowledges each failure exactly as the HCSM does and
+/// keeps the failures, in the order received, for the test to pop.
+///
+///\ingroup HCSM
+/////////////////////////////////////////////////////////////////////////////
+class CVehFailLoopback {
+public:
+	CVehFailLoopback();
+	~CVehFailLoopback();
+
+	bool Start( int port = VEH_FAILURES_PORT );
+	void Stop( void );
+	bool PopFailure( CVehFailClient::TVehFailure& );
+	void SetIgnoreCount( int count );
+
+private:
+	CVehFailLoopback(const CVehFailLoopback &);
+	CVehFailLoopback &operator=(const CVehFailLoopback &);
+
+	void ReceiverMain( void );
+
+	SOCKET                                 m_Socket;
+	thread                                 m_Receiver;
+	mutex                                  m_Lock;
+	deque<CVehFailClient::TVehFailure>     m_Received;
+	int                                    m_IgnoreCount;	// failures to drop unacknowledged
+	bool                                   m_Stop;
 };
 
 
@@ -0,0 +1,437 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: warningbatch.cxx,v 1.1 $
+//
+// Author(s):
+// Date:        October, 2026
+//
+// Description: The implementation of the CWarningBatch class.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "warningbatch.h"
+#include <math.h>
+
+#define M_PI       3.14159265358979323846
+#define M_PI_4     0.785398163397448309616
+#define	SIGN(x)	(((x) < 0)? -1 : 1)
+
+//
+// Signed area of the triangle a, b, p: positive if p is on the left
+// side of the line from a to b, negative if on the right side.
+//
+static inline double
+Side( double ax, double ay, double bx, double by, double px, double py )
+{
+	return ( bx - ax ) * ( py - ay ) - ( by - ay ) * ( px - ax );
+}
+
+static inline bool
+InBox( double minX, double minY, double maxX, double maxY, double px, double py )
+{
+	return ( px >= minX ) & ( px <= maxX ) & ( py >= minY ) & ( py <= maxY );
+}
+
+CWarningBatch::CWarningBatch()
+{
+}
+
+CWarningBatch::~CWarningBatch()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Transforms the objects into the own vehicle frame and marks the
+///		ones the warning algorithms consider.
+///
+///\remark
+///		An object passes if it is within range and its heading is within
+///		45 degrees of the own vehicle's.  The own vehicle frame has its
+///		origin at the own vehicle and its x axis along its heading.  This
+///		clears the candidates of the previous batch.
+///
+///\param	cOwnVehCartPos - The own vehicle's cartesian position in feet.
+///\param	ownVehHeading - The own vehicle's heading in radians.
+///\param	ownVehVel - The own vehicle's velocity in m/s.
+///\param	cpPos - The objects' positions, 3 floats per object.
+///\param	cpHeading - The objects' headings in radians.
+///\param	cpVel - The objects' velocities in m/s.
+///\param	numObjs - The number of objects.
+///\param	maxSqrdRng - The square of the range in feet.
+///
+///\return	The number of objects that passed.
+///
+//////////////////////////////////////////////////////////////////////////////
+int
+CWarningBatch::Prefilter(
+			const CPoint3D& cOwnVehCartPos,
+			float ownVehHeading,
+			double ownVehVel,
+			const float* cpPos,
+			const float* cpHeading,
+			const float* cpVel,
+			int numObjs,
+			float maxSqrdRng
+			)
+{
+	m_relX.resize( numObjs );
+	m_relY.resize( numObjs );
+	m_relZ.resize( numObjs );
+	m_relHeading.resize( numObjs );
+	m_closingVel.resize( numObjs );
+	m_sqrdDist.resize( numObjs );
+	m_pass.resize( numObjs );
+
+	m_cObj.clear();
+	m_cFront.clear();
+	m_cRear.clear();
+	m_cHalfWidth.clear();
+
+	const double cCos = cos( (double) -ownVehHeading );
+	const double cSin = sin( (double) -ownVehHeading );
+	const float cTwoPi = 2.0f * (float) M_PI;
+
+	int numPassed = 0;
+	int i;
+	for( i = 0; i < numObjs; i++ )
+	{
+		double dx = cpPos[3*i]     - cOwnVehCartPos.m_x;
+		double dy = cpPos[3*i + 1] - cOwnVehCartPos.m_y;
+		double dz = cpPos[3*i + 2] - cOwnVehCartPos.m_z;
+		float sqrdDist = (float)( dx * dx + dy * dy + dz * dz );
+
+		float relHeading = cpHeading[i] - ownVehHeading;
+		relHeading -= ( relHeading >  M_PI ) ? cTwoPi : 0.0f;
+		relHeading += ( relHeading < -M_PI ) ? cTwoPi : 0.0f;
+
+		m_relX[i] = cCos * dx - cSin * dy;
+		m_relY[i] = cSin * dx + cCos * dy;
+		m_relZ[i] = dz;
+		m_relHeading[i] = relHeading;
+		m_closingVel[i] = ( cpVel[i] - (float) ownVehVel ) * (float) cMETER_TO_FEET;
+		m_sqrdDist[i] = sqrdDist;
+
+		char pass = ( sqrdDist <= maxSqrdRng ) & ( fabs( relHeading ) <= M_PI_4 );
+		m_pass[i] = pass;
+		numPassed += pass;
+	}
+
+	return numPassed;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Adds an object that passed Prefilter to the candidates.
+///
+///\param	obj - The index of the object passed to Prefilter.
+///\param	front - Distance from the object's position to its front points.
+///\param	rear - Distance from the object's position to its rear points.
+///\param	halfWidth - Distance from the object's center line to its side
+///			points.
+///
+//////////////////////////////////////////////////////////////////////////////
+void
+CWarningBatch::AddCand( int obj, double front, double rear, double halfWidth )
+{
+	m_cObj.push_back( obj );
+	m_cFront.push_back( front );
+	m_cRear.push_back( rear );
+	m_cHalfWidth.push_back( halfWidth );
+}
+
+CPoint3D
+CWarningBatch::RelPos( int obj ) const
+{
+	return CPoint3D( m_relX[obj], m_relY[obj], m_relZ[obj] );
+}
+
+void
+CWarningBatch::ResizeCandResults( void )
+{
+	int n = NumCands();
+	m_warning.assign( n, 0 );
+	m_ttw.assign( n, 0 );
+	m_inCone.assign( n, 0 );
+	m_bumperDist.assign( n, 0.0 );
+	m_angleInCone.assign( n, 0.0 );
+}
+
+//
+// The wheel points TRWCAS and LPWS test: the object's position moved
+// ahead by shift and offset by the wheel base and track, then rotated
+// about the own vehicle by the relative heading.
+//
+void
+CWarningBatch::WheelPoints( double shift, int cand, double px[4], double py[4] ) const
+{
+	int obj = m_cObj[cand];
+	double x = m_relX[obj] + shift;
+	double y = m_relY[obj];
+	double c = cos( (double) m_relHeading[obj] );
+	double s = sin( (double) m_relHeading[obj] );
+
+	double xs[4] = { x + m_cFront[cand], x - m_cRear[cand], x + m_cFront[cand], x - m_cRear[cand] };
+	double ys[4] = { y - m_cHalfWidth[cand], y - m_cHalfWidth[cand], y + m_cHalfWidth[cand], y + m_cHalfWidth[cand] };
+	int k;
+	for( k = 0; k < 4; k++ )
+	{
+		px[k] = c * xs[k] - s * ys[k];
+		py[k] = s * xs[k] + c * ys[k];
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Runs the TRW Collision Avoidance System test on the candidates.
+///
+///\remark
+///		Equivalent to CScenarioControl::TRWCAS called for each candidate,
+///		once at its position for Warning and once at its position one
+///		second ahead at the closing velocity for TimeToWarn.
+///
+///\param	ownVehVel - The own vehicle's velocity in m/s.
+///\param	useFAZ - Whether to use the fast approach zones.
+///
+//////////////////////////////////////////////////////////////////////////////
+void
+CWarningBatch::EvalTrwcas( double ownVehVel, bool useFAZ )
+{
+	const float cProx_front      = 4.0f; // feet
+	const float cProx_rear       = 30.0f; // feet
+	const float cProx_side       = 11.0f; // feet
+	const float cProx_faz        = 162.0f; // feet
+	const float cWheelbase_half  = 7.5f; // feet
+	const float cTrackwidth_half = 3.75f; // feet
+	const float cTprox           = 3.0f; // seconds
+	const float cVelMin          = 4.47f; // m/sec
+	const float cTrack_margin    = 1.0f; // feet
+
+	const double cProxMinX = -cProx_rear - cWheelbase_half;
+	const double cProxMaxX =  cProx_front + cWheelbase_half;
+	const double cFazMinX  = -cProx_faz - cWheelbase_half;
+	const double cInnerY   =  cTrackwidth_half + cTrack_margin;
+	const double cOuterY   =  cProx_side + cTrackwidth_half;
+
+	ResizeCandResults();
+	if( ownVehVel < cVelMin ) return;
+
+	int n = NumCands();
+	int pass;
+	for( pass = 0; pass < 2; pass++ )
+	{
+		vector<int>& result = pass == 0 ? m_warning : m_ttw;
+		int c;
+		for( c = 0; c < n; c++ )
+		{
+			int obj = m_cObj[c];
+			float closingVel = m_closingVel[obj];
+			double px[4], py[4];
+			WheelPoints( pass == 0 ? 0.0 : closingVel, c, px, py );
+
+			bool inLeftProx = false, inRightProx = false;
+			bool inLeftFaz = false, inRightFaz = false;
+			int k;
+			for( k = 0; k < 4; k++ )
+			{
+				inLeftProx  |= InBox( cProxMinX,  cInnerY, cProxMaxX,  cOuterY, px[k], py[k] );
+				inRightProx |= InBox( cProxMinX, -cOuterY, cProxMaxX, -cInnerY, px[k], py[k] );
+				inLeftFaz   |= InBox( cFazMinX,   cInnerY, cProxMinX,  cOuterY, px[k], py[k] );
+				inRightFaz  |= InBox( cFazMinX,  -cOuterY, cProxMinX, -cInnerY, px[k], py[k] );
+			}
+
+			float range = sqrt( m_sqrdDist[obj] );
+			bool closingFast = range < cProx_rear + closingVel * cTprox;
+			bool fast = closingFast && useFAZ;
+			bool leftWarn  = inLeftProx  || ( inLeftFaz  && fast );
+			bool rightWarn = inRightProx || ( inRightFaz && fast );
+
+			result[c] = ( leftWarn ? 1 : 0 ) | ( rightWarn ? 2 : 0 );
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Runs the LPWS blind spot test on the candidates.
+///
+///\remark
+///		Equivalent to CScenarioControl::LPWS called for each candidate,
+///		once at its position for Warning and once at its position one
+///		second ahead at the closing velocity for TimeToWarn.
+///
+///\param	ownVehVel - The own vehicle's velocity in m/s.
+///
+//////////////////////////////////////////////////////////////////////////////
+void
+CWarningBatch::EvalLpws( double ownVehVel )
+{
+	const float cWheelbase_half  = 7.5f; // feet
+	const float cTrackwidth_half = 3.75f; // feet
+	const float cMirror_loc_x    = 4.0f; // feet
+	const float cMirror_loc_y    = cTrackwidth_half; // feet
+	const float cLeftMirrorHFOV  = 12.9f; // inner angle parallel to side of vehicle
+	const float cRightMirrorHFOV = 22.5f; // inner angle parallel to side of vehicle
+	const float cLeftDetectHFOV  = 90.0f - cLeftMirrorHFOV; // overlap 5deg with mirrorHFOV
+	const float cRightDetectHFOV = 90.0f - cRightMirrorHFOV; // overlap 5deg with mirrorHFOV
+	const float cOverlap         = 5.0f; // overlap between mirror and detect HFOVs
+	const float cProx_side       = 14.0f; // side detection limit
+	const float cProx_rear       = 50.0f; // rear detection limit
+	const float cVelMin          = 8.94f; // m/sec
+
+	// the four boundary lines go from the mirrors to these points
+	const double cLeftFrontX  = cMirror_loc_x - tan( cOverlap * M_PI / 180.0 );
+	const double cLeftRearX   = cMirror_loc_x - tan( ( cOverlap + cLeftDetectHFOV ) * M_PI / 180.0 );
+	const double cRightFrontX = cMirror_loc_x - tan( cOverlap * M_PI / 180.0 );
+	const double cRightRearX  = cMirror_loc_x - tan( ( cOverlap + cRightDetectHFOV ) * M_PI / 180.0 );
+	const double cLeftExtY    =  cMirror_loc_y + 1.0;
+	const double cRightExtY   = -cMirror_loc_y - 1.0;
+
+	const double cProxMinX = -cProx_rear - cWheelbase_half;
+	const double cProxMaxX =  cMirror_loc_y;
+	const double cInnerY   =  cMirror_loc_x;
+	const double cOuterY   =  cProx_side + cMirror_loc_x;
+
+	ResizeCandResults();
+	if( ownVehVel < cVelMin ) return;
+
+	int n = NumCands();
+	int pass;
+	for( pass = 0; pass < 2; pass++ )
+	{
+		vector<int>& result = pass == 0 ? m_warning : m_ttw;
+		int c;
+		for( c = 0; c < n; c++ )
+		{
+			double px[4], py[4];
+			WheelPoints( pass == 0 ? 0.0 : m_closingVel[m_cObj[c]], c, px, py );
+
+			bool inLeftProx = false, inRightProx = false;
+			bool inLeftDetect = false, inRightDetect = false;
+			int k;
+			for( k = 0; k < 4; k++ )
+			{
+				inLeftProx  |= InBox( cProxMinX,  cInnerY, cProxMaxX,  cOuterY, px[k], py[k] );
+				inRightProx |= InBox( cProxMinX, -cOuterY, cProxMaxX, -cInnerY, px[k], py[k] );
+				inLeftDetect |=
+					( Side( cMirror_loc_x, cMirror_loc_y, cLeftFrontX, cLeftExtY, px[k], py[k] ) > 0.0 ) &
+					( Side( cMirror_loc_x, cMirror_loc_y, cLeftRearX,  cLeftExtY, px[k], py[k] ) < 0.0 );
+				inRightDetect |=
+					( Side( cMirror_loc_x, -cMirror_loc_y, cRightFrontX, cRightExtY, px[k], py[k] ) < 0.0 ) &
+					( Side( cMirror_loc_x, -cMirror_loc_y, cRightRearX,  cRightExtY, px[k], py[k] ) > 0.0 );
+			}
+
+			bool leftWarn  = inLeftDetect  && inLeftProx;
+			bool rightWarn = inRightDetect && inRightProx;
+
+			result[c] = ( leftWarn ? 1 : 0 ) | ( rightWarn ? 2 : 0 );
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Runs the front cone test on the candidates.
+///
+///\remark
+///		Equivalent to CScenarioControl::ObjInFrontCone called for each
+///		candidate; with useMidPoints it is the CDynaParams version, which
+///		also tests the points halfway between the rear wheels and the
+///		center line, otherwise it is the CSolObjVehicle version.  The
+///		corners are rotated by the relative heading about the object's
+///		own position.  BumperToBumperDist and AngleInCone are only set
+///		for the candidates whose corners are in the cone.
+///
+///\param	coneAngle - The width of the cone in degrees.
+///\param	curvature - The curvature of the own vehicle's path.
+///\param	useMidPoints - Whether to test the rear mid points.
+///
+//////////////////////////////////////////////////////////////////////////////
+void
+CWarningBatch::EvalCone( float coneAngle, float curvature, bool useMidPoints )
+{
+	const float cVehicleLength = 15.74f;
+	const double cSensorX = cVehicleLength * 0.5;
+
+	// a point is in the cone if it is ahead of the sensor by more than
+	// this factor times its lateral distance
+	const double cConeSlope = tan( ( M_PI / 2 ) - ( coneAngle / 2 ) * cDEG_TO_RAD );
+	const double cMidFrac = useMidPoints ? 0.5 : 1.0;
+
+	ResizeCandResults();
+
+	int n = NumCands();
+	int c;
+	for( c = 0; c < n; c++ )
+	{
+		int obj = m_cObj[c];
+		double ox = m_relX[obj];
+		double oy = m_relY[obj];
+		double cs = cos( (double) m_relHeading[obj] );
+		double sn = sin( (double) m_relHeading[obj] );
+
+		// LF, LR, RF, RR, MLR, MRR
+		double hw = m_cHalfWidth[c];
+		double xs[6] = {  m_cFront[c], -m_cRear[c],  m_cFront[c], -m_cRear[c], -m_cRear[c], -m_cRear[c] };
+		double ys[6] = {  hw,           hw,          -hw,          -hw,          hw * cMidFrac, -hw * cMidFrac };
+
+		double px[6], py[6];
+		int k;
+		for( k = 0; k < 6; k++ )
+		{
+			px[k] = cs * xs[k] - sn * ys[k] + ox - cSensorX;
+			py[k] = sn * xs[k] + cs * ys[k] + oy;
+		}
+
+		// the rear points are tested against the cone
+		bool inCone =
+			( px[1] > cConeSlope * fabs( py[1] ) ) | ( px[3] > cConeSlope * fabs( py[3] ) ) |
+			( px[4] > cConeSlope * fabs( py[4] ) ) | ( px[5] > cConeSlope * fabs( py[5] ) );
+
+		// the corners give the distance
+		double minDist = px[0] * px[0] + py[0] * py[0];
+		for( k = 1; k < 4; k++ )
+		{
+			double distSq = px[k] * px[k] + py[k] * py[k];
+			if( distSq < minDist )  minDist = distSq;
+		}
+
+		m_inCone[c] = inCone;
+		m_bumperDist[c] = sqrt( minDist );
+	}
+
+	// the remaining tests only apply to the objects in the cone, which
+	// are few, so the trigonometry is not worth vectorizing
+	for( c = 0; c < n; c++ )
+	{
+		if( !m_inCone[c] ) continue;
+
+		int obj = m_cObj[c];
+		float x_ado = float( m_relX[obj] - cSensorX );
+		float y_ado = float( m_relY[obj] );
+		m_angleInCone[c] = atan2( x_ado, y_ado ) * cRAD_TO_DEG - 90.0;
+
+		if( fabs( curvature ) > 0.0001f )
+		{
+			float radius = 1.0f / fabs( curvature );
+			y_ado = float( m_bumperDist[c] * sin( m_angleInCone[c] * cDEG_TO_RAD ) );
+			float y_0 = radius * SIGN( curvature );
+			float R2_ado = float( m_relX[obj] * m_relX[obj] + ( y_ado - y_0 ) * ( y_ado - y_0 ) );
+			float R2_min = ( radius - 7.0f ) * ( radius - 7.0f );
+			float R2_max = ( radius + 7.0f ) * ( radius + 7.0f );
+			if( R2_ado < R2_min || R2_ado > R2_max ) m_inCone[c] = false;
+		}
+		else
+		{
+			if( y_ado < -7.0 || y_ado > 7.0 ) m_inCone[c] = false;
+		}
+	}
+}
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: warningbatch.h,v 1.1 $
+//
+// Author(s):
+// Date:        October, 2026
+//
+// Description: The header file for the CWarningBatch class, which runs
+//              the geometric tests of the collision warning algorithms
+//              over all the dynamic objects at once.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _WARNINGBATCH_H_
+#define _WARNINGBATCH_H_
+
+#include <cvedpub.h>
+#include <vector>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+///
+///\brief
+///		Evaluates the TRW CAS, LPWS and front cone tests for a batch of
+///		objects.
+///
+///\remark
+///		The object data is kept as parallel arrays and every test is a
+///		straight loop over them, with the per object decisions written to
+///		arrays, so the compiler can vectorize the arithmetic.  Prefilter
+///		transforms all the objects into the own vehicle frame and marks
+///		the ones within range and heading; the caller then adds the ones
+///		it wants tested, with their dimensions, as candidates.
+///
+///\remark
+///		The decisions match the scalar CScenarioControl::TRWCAS, LPWS and
+///		ObjInFrontCone functions except for points within about 1e-9 ft
+///		of a zone boundary, where the different order of the floating
+///		point operations may put them on the other side.
+///
+//////////////////////////////////////////////////////////////////////////////
+class CWarningBatch
+{
+public:
+	CWarningBatch();
+	~CWarningBatch();
+
+	int  Prefilter(
+				const CPoint3D& cOwnVehCartPos,
+				float ownVehHeading,
+				double ownVehVel,
+				const float* cpPos,
+				const float* cpHeading,
+				const float* cpVel,
+				int numObjs,
+				float maxSqrdRng
+				);
+	bool Passed( int obj ) const { return m_pass[obj] != 0; }
+
+	void AddCand( int obj, double front, double rear, double halfWidth );
+	int  NumCands( void ) const { return (int) m_cObj.size(); }
+	int  CandObj( int cand ) const { return m_cObj[cand]; }
+
+	void EvalTrwcas( double ownVehVel, bool useFAZ );
+	void EvalLpws( double ownVehVel );
+	void EvalCone( float coneAngle, float curvature, bool useMidPoints );
+
+	// per object results of Prefilter
+	CPoint3D RelPos( int obj ) const;
+	float RelHeading( int obj ) const { return m_relHeading[obj]; }
+	float ClosingVel( int obj ) const { return m_closingVel[obj]; }
+	float SqrdDist( int obj ) const { return m_sqrdDist[obj]; }
+
+	// per candidate results of the Eval functions
+	int    Warning( int cand ) const { return m_warning[cand]; }
+	int    TimeToWarn( int cand ) const { return m_ttw[cand]; }
+	bool   InCone( int cand ) const { return m_inCone[cand] != 0; }
+	double BumperToBumperDist( int cand ) const { return m_bumperDist[cand]; }
+	double AngleInCone( int cand ) const { return m_angleInCone[cand]; }
+
+private:
+	void ResizeCandResults( void );
+	void WheelPoints( double shift, int cand, double px[4], double py[4] ) const;
+
+	// per object
+	vector<double>  m_relX;
+	vector<double>  m_relY;
+	vector<double>  m_relZ;
+	vector<float>   m_relHeading;
+	vector<float>   m_closingVel;
+	vector<float>   m_sqrdDist;
+	vector<char>    m_pass;
+
+	// per candidate
+	vector<int>     m_cObj;
+	vector<double>  m_cFront;
+	vector<double>  m_cRear;
+	vector<double>  m_cHalfWidth;
+	vector<int>     m_warning;
+	vector<int>     m_ttw;
+	vector<char>    m_inCone;
+	vector<double>  m_bumperDist;
+	vector<double>  m_angleInCone;
+};
+
+#endif // _WARNINGBATCH_H_
@@ -49,6 +49,424 @@ static  char *m_pHeaderPreamble1 =
 "\n"
 ;
 
+/*
+ * The directory the generated files are written to, ending with a path
+ * separator, or empty for the current directory.  Half the path length
+ * is left for the file names.
+ */
+static char m_targetDir[SM_MAX_PATH_LEN / 2] = SM_TARGET_DIR;
+
+/*
+ * The hash and length of the preprocessed input, and the version of the
+ * code generator, as written to the stamp file.
+ */
+static char m_stamp[128];
+
+/*
+ * The lines of the stamp file that list the generated files, one
+ * "hash length name" line per file, in the order they were written.
+ */
+static char*  m_pOutputList = NULL;
+static size_t m_outputListLen = 0;
+static size_t m_outputListSize = 0;
+
+static const char* m_pGeneratorVersion = __DATE__ " " __TIME__;
+
+
+/******************************************************************************
+ *
+ * Name:  SetTargetDir
+ *
+ * Sets the directory the generated files are written to.
+ *
+ * Inputs:
+ *   pDir -- The directory, with or without a trailing separator.
+ *
+ */
+void SetTargetDir( const char* pDir )
+{
+
+	size_t len;
+
+	strncpy( m_targetDir, pDir, sizeof( m_targetDir ) - 2 );
+	m_targetDir[sizeof( m_targetDir ) - 2] = '\0';
+
+	len = strlen( m_targetDir );
+	if ( len > 0 && m_targetDir[len-1] != '/' && m_targetDir[len-1] != '\\' ) {
+
+		m_targetDir[len]   = '/';
+		m_targetDir[len+1] = '\0';
+
+	}
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  OpenGenFile
+ *
+ * Opens a generated file for writing.  The code is written to a temporary
+ * file next to the target, which CloseGenFile puts in place only if its
+ * contents differ from the target's.  The generated files that did not
+ * change thus keep their time stamps and are not rebuilt.
+ *
+ * Inputs:
+ *   pName -- The name of the generated file, relative to the target dir.
+ *
+ * Returns:  The open file; exits on failure.
+ *
+ */
+static FILE* OpenGenFile( const char* pName )
+{
+
+	char  tmpPath[SM_MAX_PATH_LEN];
+	FILE* pFile;
+
+	sprintf( tmpPath, "%s%s.tmp", m_targetDir, pName );
+	pFile = fopen( tmpPath, "w" );
+	if ( pFile == NULL ) {
+
+		fprintf( stderr, "Can't open '%s' for output", tmpPath );
+		perror("");
+		exit(-1);
+
+	}
+
+	return pFile;
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  SameContents
+ *
+ * Compares two files byte by byte.
+ *
+ * Inputs:
+ *   pPath1, pPath2 -- The files.
+ *
+ * Returns:  eTRUE if both files exist and have the same contents.
+ *
+ */
+static EBool SameContents( const char* pPath1, const char* pPath2 )
+{
+
+	char   buf1[4096];
+	char   buf2[4096];
+	size_t n1, n2;
+	EBool  same = eTRUE;
+	FILE*  pFile1;
+	FILE*  pFile2;
+
+	pFile1 = fopen( pPath1, "rb" );
+	if ( pFile1 == NULL )  return eFALSE;
+	pFile2 = fopen( pPath2, "rb" );
+	if ( pFile2 == NULL ) {
+
+		fclose( pFile1 );
+		return eFALSE;
+
+	}
+
+	do {
+
+		n1 = fread( buf1, 1, sizeof( buf1 ), pFile1 );
+		n2 = fread( buf2, 1, sizeof( buf2 ), pFile2 );
+		if ( n1 != n2 || memcmp( buf1, buf2, n1 ) ) {
+
+			same = eFALSE;
+			break;
+
+		}
+
+	} while ( n1 > 0 );
+
+	fclose( pFile1 );
+	fclose( pFile2 );
+
+	return same;
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  HashFile
+ *
+ * Computes the FNV-1a hash and the length of a file.
+ *
+ * Inputs:
+ *   pPath   -- The file.
+ *   pHash   -- Receives the hash.
+ *   pLength -- Receives the length in bytes.
+ *
+ * Returns:  eFALSE if the file can't be read.
+ *
+ */
+static EBool HashFile( const char* pPath, unsigned long* pHash, long* pLength )
+{
+
+	unsigned long hash = 2166136261UL;
+	long          len = 0;
+	int           c;
+	FILE*         pFile;
+
+	pFile = fopen( pPath, "rb" );
+	if ( pFile == NULL )  return eFALSE;
+	while ( ( c = getc( pFile ) ) != EOF ) {
+
+		hash = ( ( hash ^ (unsigned char) c ) * 16777619UL ) & 0xFFFFFFFFUL;
+		len++;
+
+	}
+	fclose( pFile );
+
+	*pHash   = hash;
+	*pLength = len;
+	return eTRUE;
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  AddToOutputList
+ *
+ * Records a generated file, with the hash of its contents, for the
+ * stamp file.
+ *
+ * Inputs:
+ *   pName -- The name of the generated file, relative to the target dir.
+ *   pPath -- The path of the generated file.
+ *
+ */
+static void AddToOutputList( const char* pName, const char* pPath )
+{
+
+	unsigned long hash;
+	long          len;
+	char          line[SM_MAX_PATH_LEN];
+	size_t        lineLen;
+
+	if ( !HashFile( pPath, &hash, &len ) ) {
+
+		fprintf( stderr, "Can't read '%s'", pPath );
+		perror("");
+		exit(-1);
+
+	}
+
+	sprintf( line, "%08lx %ld %s\n", hash, len, pName );
+	lineLen = strlen( line );
+
+	if ( m_outputListLen + lineLen + 1 > m_outputListSize ) {
+
+		m_outputListSize = 2 * m_outputListSize + lineLen + 1024;
+		m_pOutputList = (char *) realloc( m_pOutputList, m_outputListSize );
+		if ( m_pOutputList == NULL ) {
+
+			fprintf( stderr, "Out of memory\n" );
+			exit(-1);
+
+		}
+
+	}
+
+	strcpy( m_pOutputList + m_outputListLen, line );
+	m_outputListLen += lineLen;
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  CloseGenFile
+ *
+ * Closes a file opened with OpenGenFile.  The new contents replace the
+ * target only if they differ from it; otherwise the target is left alone
+ * and the temporary file is removed.
+ *
+ * Inputs:
+ *   pFile -- The file returned by OpenGenFile.
+ *   pName -- The name passed to OpenGenFile.
+ *
+ */
+static void CloseGenFile( FILE* pFile, const char* pName )
+{
+
+	char path[SM_MAX_PATH_LEN];
+	char tmpPath[SM_MAX_PATH_LEN];
+
+	sprintf( path, "%s%s", m_targetDir, pName );
+	sprintf( tmpPath, "%s%s.tmp", m_targetDir, pName );
+
+	if ( fclose( pFile ) != 0 ) {
+
+		fprintf( stderr, "Can't write '%s'", tmpPath );
+		perror("");
+		exit(-1);
+
+	}
+
+	if ( SameContents( tmpPath, path ) ) {
+
+		remove( tmpPath );
+		AddToOutputList( pName, path );
+		return;
+
+	}
+
+	/* rename does not replace an existing file on Windows */
+	remove( path );
+	if ( rename( tmpPath, path ) != 0 ) {
+
+		fprintf( stderr, "Can't rename '%s' to '%s'", tmpPath, path );
+		perror("");
+		exit(-1);
+
+	}
+
+	printf( "Updated %s\n", pName );
+	AddToOutputList( pName, path );
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  GetClassImplementFileName
+ *
+ * Builds the name of the file holding a state machine's class
+ * implementation: SM_CLASS_IMPLEMENT_PREFIX followed by the state
+ * machine's name in lower case.
+ *
+ * Inputs:
+ *   pSmName  -- The name of the state machine.
+ *   pName    -- Receives the file name; SM_MAX_PATH_LEN characters.
+ *
+ */
+static void GetClassImplementFileName( const char* pSmName, char* pName )
+{
+
+	char* pDst;
+
+	strcpy( pName, SM_CLASS_IMPLEMENT_PREFIX );
+	pDst = pName + strlen( pName );
+	while ( *pSmName )  *pDst++ = (char) tolower( (unsigned char) *pSmName++ );
+	strcpy( pDst, SM_CLASS_IMPLEMENT_SUFFIX );
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  IsGeneratedCodeCurrent
+ *
+ * Checks whether the generated code is already up to date with respect
+ * to an input.
+ *
+ * The input is the .sm file with its includes already expanded.  Its
+ * hash and length, with the version of the code generator, are compared
+ * to the stamp that GenerateCode left in the target directory on the
+ * last run.  The stamp also lists every file that run generated, with
+ * the hash and length of its contents.  The code is current only if the
+ * input matches and every one of those files is still there, unchanged.
+ * A generated file that was deleted or edited by hand thus makes the
+ * next run regenerate.
+ *
+ * Inputs:
+ *   pInputName -- The expanded input file.
+ *
+ * Returns:  eTRUE if the stamp matches the input and the generated files.
+ *
+ */
+EBool IsGeneratedCodeCurrent( const char* pInputName )
+{
+
+	unsigned long hash;
+	long          len;
+	char          path[SM_MAX_PATH_LEN];
+	char          line[SM_MAX_PATH_LEN];
+	char          name[SM_MAX_PATH_LEN];
+	unsigned long prevHash;
+	long          prevLen;
+	int           numOutputs = 0;
+	EBool         current = eTRUE;
+	FILE*         pFile;
+
+	if ( !HashFile( pInputName, &hash, &len ) )  return eFALSE;
+	sprintf( m_stamp, "%08lx %ld %s\n", hash, len, m_pGeneratorVersion );
+
+	sprintf( path, "%s%s", m_targetDir, SM_STAMP_FILE );
+	pFile = fopen( path, "r" );
+	if ( pFile == NULL )  return eFALSE;
+
+	if ( fgets( line, sizeof( line ), pFile ) == NULL || strcmp( line, m_stamp ) ) {
+
+		fclose( pFile );
+		return eFALSE;
+
+	}
+
+	while ( current && fgets( line, sizeof( line ), pFile ) != NULL ) {
+
+		if ( sscanf( line, "%lx %ld %s", &prevHash, &prevLen, name ) != 3 ) {
+
+			current = eFALSE;
+			break;
+
+		}
+
+		sprintf( path, "%s%s", m_targetDir, name );
+		if ( !HashFile( path, &hash, &len ) || hash != prevHash || len != prevLen ) {
+
+			current = eFALSE;
+
+		}
+		numOutputs++;
+
+	}
+	fclose( pFile );
+
+	return current && numOutputs > 0 ? eTRUE : eFALSE;
+
+}
+
+
+/******************************************************************************
+ *
+ * Name:  WriteStamp
+ *
+ * Records the input that the generated code was made from, as computed
+ * by IsGeneratedCodeCurrent, and the files generated from it in the
+ * target directory.
+ *
+ */
+static void WriteStamp( void )
+{
+
+	char  path[SM_MAX_PATH_LEN];
+	FILE* pFile;
+
+	if ( m_stamp[0] == '\0' )  return;
+
+	sprintf( path, "%s%s", m_targetDir, SM_STAMP_FILE );
+	pFile = fopen( path, "w" );
+	if ( pFile == NULL ) {
+
+		fprintf( stderr, "Can't open '%s' for output", path );
+		perror("");
+		exit(-1);
+
+	}
+	fputs( m_stamp, pFile );
+	if ( m_pOutputList )  fputs( m_pOutputList, pFile );
+	fclose( pFile );
+
+}
+
 
 /******************************************************************************
  *
@@ -81,116 +499,603 @@ static char* GetSnoParserClassFromHcsmName( char* hcsmName )
 		 ( !strcmp( hcsmName, "RemoteControl" ) )
 		 ) {
 
-		return "CAdoParseBlock";
+		return "CAdoParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "Ddo" ) ) {
+
+		return "CDdoParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "EnvironmentController" ) ) {
+
+		return "CEnvControlParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "Gateway" ) ) {
+
+		return "CGatewayParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "IntersectionManager" ) ) {
+
+		return "CIntersectionMngrParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "OwnVehicleMirror" ) ) {
+
+		return "COwnVehicleMirrorParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "StaticObjManager" ) ) {
+
+		return "CSobjMngrParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "TestPriv" ) ) {
+
+		return "CTrajFollowParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "TrafficData" ) ) {
+
+		return "CTrafficDataParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "DaqDriver" ) ) {
+
+		return "CDaqDriverParseBlock";
+
+	}
+	else if ( ( !strcmp( hcsmName, "TimeTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "RoadPadTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "ExpressionTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "FollowTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "TrffcLghtTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "TimeToArrvlTrigger" ) ) ||
+			  ( !strcmp( hcsmName, "GmtrcPstnTrigger" ) )
+			  ) {
+
+		return "CTriggerParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "CLG" ) ) {
+
+		return "CClgParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "EnviroInfo" ) ) {
+
+		return "CEnviroInfoParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "TrafficLightManager" ) ) {
+
+		return "CTrafLghtMngrParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "TrafficManager" ) ) {
+
+		return "CTrafMngrParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "TrafficSource" ) ) {
+
+		return "CTrafSrcParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "VehFail" ) ) {
+
+		return "CVehFailParseBlock";
+
+	}
+	else if ( !strcmp( hcsmName, "VirtualObject" ) ) {
+
+		return "CVirtualObjectParseBlock";
+
+	}
+	else {
+
+		return NULL;
+
+	}
+
+}
+ 
+ 
+/*
+ * The ways a value can be written to an hcsm checkpoint.
+ */
+typedef enum {
+	eCKPT_NONE = 0,     /* not saved; pointers, CVED handles, etc.          */
+	eCKPT_RAW,          /* CHcsmCheckpoint::Put/Get know how to handle it   */
+	eCKPT_STRING,       /* saved through the type's GetString/SetString     */
+	eCKPT_POD,          /* structure saved with CHcsmCheckpoint::PutPod     */
+	eCKPT_CVED,         /* CVED item; Get needs the CVED instance           */
+	eCKPT_STATE         /* class with its own SaveState and RestoreState    */
+} ECkptKind;
+
+
+/******************************************************************************
+ *
+ * Description: Determines how a value of the given type is checkpointed.
+ *
+ * Remarks:  Builtin types, strings, the CVED point and vector classes,
+ *   the random number generator, vectors and deques of these and 
+ *   enumerations (named E... or eCV... by convention) are written as is.
+ *   CRoadPos and CCrdr are written in their string form when they are 
+ *   dials or monitors, whose values are bound to CVED at construction.
+ *   The structures listed in pPodTypes are copied byte for byte and the
+ *   classes listed in pStateTypes save themselves.  Anything else is 
+ *   skipped; user code can save such values by providing SaveUserState
+ *   and RestoreUserState.
+ *
+ * Inputs:
+ *   pType -- The type's name.  White space is ignored.
+ *
+ * Returns:  The checkpoint kind of the type.
+ *
+ */
+static ECkptKind GetCheckpointKind( const char* pType )
+{
+
+	static char* pRawTypes[] = {
+		"int", "long", "float", "double", "bool", "char", "short",
+		"unsigned", "unsignedint", "unsignedlong", "unsignedshort",
+		"unsignedchar", "longlong", "__int64", "string", "std::string",
+		"CPoint2D", "CVector2D", "CPoint3D", "CVector3D", "CRandNumGen", 
+		NULL
+	};
+
+	static char* pPodTypes[] = {
+		"TFollowParams", "CVehDynCommand::TVehDynCommand", NULL
+	};
+
+	static char* pCvedTypes[] = {
+		"CPath", "CLane", "CRoad", "CIntrsctn", NULL
+	};
+
+	static char* pStateTypes[] = {
+		"CObjectInitCond", "CTriggerFireCond", "CLaneChangeConds", NULL
+	};
+
+	char  type[256];
+	char* pC;
+	char* pLast;
+	int   i;
+	int   len = 0;
+
+	/* remove white space so "vector <double>" matches "vector<double>" */
+	for ( ; *pType && len < (int) sizeof( type ) - 1; pType++ ) {
+
+		if ( !isspace( *pType ) )  type[len++] = *pType;
+
+	}
+	type[len] = '\0';
+
+	for ( i = 0; pRawTypes[i]; i++ ) {
+
+		if ( !strcmp( type, pRawTypes[i] ) )  return eCKPT_RAW;
+
+	}
+
+	if ( !strcmp( type, "CRoadPos" ) || !strcmp( type, "CCrdr" ) ) {
+
+		return eCKPT_STRING;
+
+	}
+
+	for ( i = 0; pPodTypes[i]; i++ ) {
+
+		if ( !strcmp( type, pPodTypes[i] ) )  return eCKPT_POD;
+
+	}
+
+	for ( i = 0; pCvedTypes[i]; i++ ) {
+
+		if ( !strcmp( type, pCvedTypes[i] ) )  return eCKPT_CVED;
+
+	}
+
+	for ( i = 0; pStateTypes[i]; i++ ) {
+
+		if ( !strcmp( type, pStateTypes[i] ) )  return eCKPT_STATE;
+
+	}
+
+	/* vectors and deques of raw types */
+	pC = type;
+	if ( !strncmp( pC, "std::", 5 ) )  pC += 5;
+	if ( ( !strncmp( pC, "vector<", 7 ) || !strncmp( pC, "deque<", 6 ) ) && 
+		 type[len - 1] == '>' ) {
+
+		char elemType[256];
+
+		strcpy( elemType, strchr( pC, '<' ) + 1 );
+		elemType[strlen( elemType ) - 1] = '\0';
+		return GetCheckpointKind( elemType ) == eCKPT_RAW ? 
+					eCKPT_RAW : eCKPT_NONE;
+
+	}
+
+	/* enumerations; only look at the name after any scope qualifiers */
+	if ( strchr( type, '*' ) || strchr( type, '<' ) )  return eCKPT_NONE;
+	pLast = strrchr( type, ':' );
+	pLast = pLast ? pLast + 1 : type;
+	if ( ( pLast[0] == 'E' && isupper( pLast[1] ) ) ||
+		 !strncmp( pLast, "eCV", 3 ) ) {
+
+		return eCKPT_RAW;
+
+	}
+
+	return eCKPT_NONE;
+
+}
+
+
+/******************************************************************************
+ *
+ * Description: Splits a private declaration into a data member's type and
+ *   name.
+ *
+ * Remarks:  Only simple declarations of the form "type name;" are 
+ *   accepted.  Functions, arrays, references, static members, declarations
+ *   with initializers and declarations of several members are rejected.
+ *
+ * Inputs:
+ *   pDec  -- The declaration as specified in the PRIV_DECL statement.
+ *   pType -- Receives the member's type (at least 256 chars).
+ *   pName -- Receives the member's name (at least 256 chars).
+ *
+ * Returns:  eTRUE if the declaration is a data member, eFALSE otherwise.
+ *
+ */
+static EBool ParsePrivDataMember( const char* pDec, char* pType, char* pName )
+{
+
+	char  dec[512];
+	char* pC;
+	char* pEnd;
+	char* pStart;
+
+	strncpy( dec, pDec, sizeof( dec ) - 1 );
+	dec[sizeof( dec ) - 1] = '\0';
+
+	/* strip comments and trailing white space */
+	pC = strstr( dec, "//" );
+	if ( pC )  *pC = '\0';
+	pC = strstr( dec, "/*" );
+	if ( pC )  *pC = '\0';
+
+	pEnd = dec + strlen( dec );
+	while ( pEnd > dec && isspace( pEnd[-1] ) )  pEnd--;
+	if ( pEnd == dec || pEnd[-1] != ';' )  return eFALSE;
+	pEnd--;
+	while ( pEnd > dec && isspace( pEnd[-1] ) )  pEnd--;
+	*pEnd = '\0';
+
+	if ( strpbrk( dec, "()[]{},&=" ) )  return eFALSE;
+
+	pStart = dec;
+	while ( isspace( *pStart ) )  pStart++;
+	if ( !strncmp( pStart, "static", 6 ) || !strncmp( pStart, "const", 5 ) ||
+		 !strncmp( pStart, "mutable", 7 ) || !strncmp( pStart, "typedef", 7 ) ) {
+
+		return eFALSE;
+
+	}
+
+	/* the name is the last identifier */
+	pC = pEnd;
+	while ( pC > pStart && ( isalnum( pC[-1] ) || pC[-1] == '_' ) )  pC--;
+	if ( pC == pEnd || pC == pStart )  return eFALSE;
+	if ( strlen( pC ) >= 256 )  return eFALSE;
+	strcpy( pName, pC );
+
+	while ( pC > pStart && isspace( pC[-1] ) )  pC--;
+	*pC = '\0';
+	if ( strlen( pStart ) >= 256 )  return eFALSE;
+	strcpy( pType, pStart );
+
+	return eTRUE;
+
+}
+
+
+/******************************************************************************
+ *
+ * Description: Generates the statements that save or restore one value.
+ *
+ * Inputs:
+ *   pFile    -- Pointer to the file to write data to.
+ *   pIndent  -- The indentation to use.
+ *   pType    -- The value's type.
+ *   pVarName -- The expression that refers to the value.
+ *   isSave   -- eTRUE to generate the save code, eFALSE for restore code.
+ *
+ */
+static void GenCheckpointValue(
+			FILE* pFile,
+			const char* pIndent,
+			const char* pType,
+			const char* pVarName,
+			EBool isSave
+			)
+{
+
+	switch ( GetCheckpointKind( pType ) ) {
+
+	case eCKPT_RAW:
+		fprintf( pFile, "%sckpt.%s( %s );\n", pIndent, 
+				 isSave ? "Put" : "Get", pVarName );
+		break;
+
+	case eCKPT_STRING:
+		if ( isSave ) {
+
+			fprintf( pFile, "%sckpt.Put( %s.GetString() );\n", pIndent, 
+					 pVarName );
+
+		}
+		else {
+
+			fprintf( pFile, "%s{\n", pIndent );
+			fprintf( pFile, "%s    string str;\n", pIndent );
+			fprintf( pFile, "%s    ckpt.Get( str );\n", pIndent );
+			fprintf( pFile, "%s    if ( !str.empty() ) %s.SetString( str );\n",
+					 pIndent, pVarName );
+			fprintf( pFile, "%s}\n", pIndent );
+
+		}
+		break;
+
+	case eCKPT_POD:
+		fprintf( pFile, "%sckpt.%s( %s );\n", pIndent, 
+				 isSave ? "PutPod" : "GetPod", pVarName );
+		break;
+
+	case eCKPT_CVED:
+		if ( isSave ) {
+
+			fprintf( pFile, "%sckpt.Put( %s );\n", pIndent, pVarName );
+
+		}
+		else {
+
+			fprintf( pFile, "%sckpt.Get( %s, *cved );\n", pIndent, 
+					 pVarName );
+
+		}
+		break;
+
+	case eCKPT_STATE:
+		if ( isSave ) {
+
+			fprintf( pFile, "%s%s.SaveState( ckpt );\n", pIndent, pVarName );
+
+		}
+		else {
+
+			fprintf( pFile, "%s%s.RestoreState( ckpt, *cved );\n", pIndent,
+					 pVarName );
+
+		}
+		break;
+
+	default:
+		fprintf( pFile, "%s// %s is of type %s and is not checkpointed\n",
+				 pIndent, pVarName, pType );
+		break;
+
+	}
+
+}
+
+
+/******************************************************************************
+ *
+ * Description: Determines whether values of a dial or monitor type are
+ *   handed out by reference.
+ *
+ * Remarks:  The built in types are cheap to copy and are passed by value.
+ *   Everything else, e.g. string, CRoadPos and CCrdr, owns heap storage,
+ *   so readers borrow the published value through a const reference
+ *   instead of copying it.
+ *
+ * Inputs:
+ *   pType -- The value's type.
+ *
+ * Returns:  eTRUE if the type is passed by reference.
+ *
+ */
+static EBool IsRefType( const char* pType )
+{
+
+	static char* valueTypes[] = 
+		{ "int", "long", "float", "double", "char", "bool", 0 };
+	int i;
+
+	for ( i = 0; valueTypes[i]; i++ ) {
+
+		if ( !strcmp( valueTypes[i], pType ) )  return eFALSE;
+
+	}
+
+	return eTRUE;
+
+}
+
 
-	}
-	else if ( !strcmp( hcsmName, "Ddo" ) ) {
+/******************************************************************************
+ *
+ * Description: Returns the type used to pass a value of the given type to
+ *   and from the dial and monitor functions.
+ *
+ * Remarks:  The result lives in a static buffer that is overwritten by
+ *   the next call, so only use it once per fprintf.
+ *
+ * Inputs:
+ *   pType -- The value's type.
+ *
+ * Returns:  The type itself, or a const reference to it.
+ *
+ */
+static const char* PassType( const char* pType )
+{
 
-		return "CDdoParseBlock";
+	static char passType[300];
 
-	}
-	else if ( !strcmp( hcsmName, "EnvironmentController" ) ) {
+	if ( IsRefType( pType ) ) {
 
-		return "CEnvControlParseBlock";
+		sprintf( passType, "const %s&", pType );
 
 	}
-	else if ( !strcmp( hcsmName, "Gateway" ) ) {
+	else {
 
-		return "CGatewayParseBlock";
+		sprintf( passType, "%s", pType );
 
 	}
-	else if ( !strcmp( hcsmName, "IntersectionManager" ) ) {
 
-		return "CIntersectionMngrParseBlock";
+	return passType;
 
-	}
-	else if ( !strcmp( hcsmName, "OwnVehicleMirror" ) ) {
+}
 
-		return "COwnVehicleMirrorParseBlock";
 
-	}
-	else if ( !strcmp( hcsmName, "StaticObjManager" ) ) {
+/******************************************************************************
+ *
+ * Name:  HashTemplateName
+ *
+ * The hash used to look up HCSM template names.  It is FNV-1a started
+ * from the given seed; the generated code carries an identical copy.
+ *
+ * Inputs:
+ *   pName -- The template name.
+ *   seed  -- The starting value of the hash.
+ *
+ * Returns:  The 32 bit hash of the name.
+ *
+ */
+static unsigned int HashTemplateName( const char* pName, unsigned int seed )
+{
 
-		return "CSobjMngrParseBlock";
+	unsigned int hash = seed;
 
-	}
-	else if ( !strcmp( hcsmName, "TestPriv" ) ) {
+	while ( *pName ) {
 
-		return "CTrajFollowParseBlock";
+		hash ^= (unsigned char) *pName++;
+		hash = ( hash * 16777619u ) & 0xffffffffu;
 
 	}
-	else if ( !strcmp( hcsmName, "TrafficData" ) ) {
 
-		return "CTrafficDataParseBlock";
+	return hash;
 
-	}
-	else if ( !strcmp( hcsmName, "DaqDriver" ) ) {
+}
 
-		return "CDaqDriverParseBlock";
 
-	}
-	else if ( ( !strcmp( hcsmName, "TimeTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "RoadPadTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "ExpressionTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "FollowTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "TrffcLghtTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "TimeToArrvlTrigger" ) ) ||
-			  ( !strcmp( hcsmName, "GmtrcPstnTrigger" ) )
-			  ) {
+/******************************************************************************
+ *
+ * Name:  FindTemplateHash
+ *
+ * Searches for a seed that makes HashTemplateName collision free over
+ * all the template names for a table of the given size.
+ *
+ * Inputs:
+ *   size  -- The table size, a power of two.
+ *   pSeed -- (output) The seed found.
+ *   pSlot -- (output) Table of size entries, set to the template id
+ *            hashed to each slot or -1.
+ *
+ * Returns:  eTRUE if a seed was found, eFALSE otherwise.
+ *
+ */
+static EBool FindTemplateHash( int size, unsigned int* pSeed, int* pSlot )
+{
 
-		return "CTriggerParseBlock";
+	TStateMachine* pSm;             /* pointer to SM on SM list             */
+	unsigned int   attempt;         /* seeds tried so far                   */
+	unsigned int   slot;            /* slot a name hashes to                */
+	int            id;              /* template id                          */
+	int            i;
 
-	}
-	else if ( !strcmp( hcsmName, "CLG" ) ) {
+	for ( attempt = 0; attempt < 65536; attempt++ ) {
 
-		return "CClgParseBlock";
+		unsigned int seed = 2166136261u + attempt;
+		EBool        collision = eFALSE;
 
-	}
-	else if ( !strcmp( hcsmName, "EnviroInfo" ) ) {
+		for ( i = 0; i < size; i++ )  pSlot[i] = -1;
 
-		return "CEnviroInfoParseBlock";
+		for ( pSm = m_pIn->sm_list, id = 0; pSm; pSm = pSm->next, id++ ) {
 
-	}
-	else if ( !strcmp( hcsmName, "TrafficLightManager" ) ) {
+			slot = HashTemplateName( pSm->name, seed ) & ( size - 1 );
+			if ( pSlot[slot] >= 0 ) {
 
-		return "CTrafLghtMngrParseBlock";
+				collision = eTRUE;
+				break;
 
-	}
-	else if ( !strcmp( hcsmName, "TrafficManager" ) ) {
+			}
+			pSlot[slot] = id;
 
-		return "CTrafMngrParseBlock";
+		}
 
-	}
-	else if ( !strcmp( hcsmName, "TrafficSource" ) ) {
+		if ( !collision ) {
 
-		return "CTrafSrcParseBlock";
+			*pSeed = seed;
+			return eTRUE;
+
+		}
 
 	}
-	else if ( !strcmp( hcsmName, "VehFail" ) ) {
 
-		return "CVehFailParseBlock";
+	return eFALSE;
 
-	}
-	else if ( !strcmp( hcsmName, "VirtualObject" ) ) {
+}
 
-		return "CVirtualObjectParseBlock";
 
-	}
-	else {
+/******************************************************************************
+ *
+ * Name:  GenTemplateIdEnum
+ *
+ * Generates the enumeration of the HCSM template ids used by the
+ * numeric creation path of the collection.  The ids are the positions
+ * of the templates in the input.
+ *
+ * Inputs:
+ *   pFile -- Pointer to the file to write data to.
+ *
+ */
+static void GenTemplateIdEnum( FILE* pFile )
+{
 
-		return NULL;
+	static char*   pTab = "    ";   /* simulates a tab character            */
+
+	TStateMachine* pSm;             /* pointer to SM on SM list             */
+
+	fprintf( pFile, "// HCSM template ids, see CHcsmCollection::CreateHcsm\n" );
+	fprintf( pFile, "enum EHcsmTemplateId {\n" );
+	for ( pSm = m_pIn->sm_list; pSm; pSm = pSm->next ) {
+
+		fprintf( pFile, "%seHCSM_%s,\n", pTab, pSm->name );
 
 	}
+	fprintf( pFile, "%seHCSM_NUM_TEMPLATES\n", pTab );
+	fprintf( pFile, "};\n" );
+	fprintf( pFile, "\n" );
 
 }
- 
- 
+
+
 /******************************************************************************
  *
  * Name:  GenTemplateToClassFunction
  *
- * Generates the function that creates a new class given a HCSM 
- * template name.
+ * Generates the functions that create a new class given a HCSM 
+ * template name or id.
+ *
+ * Remarks:  Each template gets a factory function and an entry in a
+ *   table indexed by template id.  Names are mapped to ids through a
+ *   perfect hash computed here, so a lookup costs one hash of the name
+ *   and one string comparison no matter how many templates there are.
  *
  * Inputs:
  *   pFile -- Pointer to the file to write data to.
@@ -204,49 +1109,166 @@ static void GenTemplateToClassFunction( FILE* pFile  )
 	static char*   pTab = "    ";   /* simulates a tab character            */
 
 	TStateMachine* pSm;             /* pointer to SM on SM list             */
+	int            numTemplates;    /* number of templates                  */
+	int            hashSize;        /* size of the hash table               */
+	int*           pSlot;           /* template id in each hash slot        */
+	unsigned int   seed;            /* seed of the perfect hash             */
+	int            i;
 
 	fprintf( pFile, "#include \"%s\"\n", SM_CLASS_HEADER_FILE );
 	fprintf( pFile, "#include \"hcsmcollection.h\"\n" );
 	fprintf( pFile, "\n" );
 
 	/*
-	 * Generate the inline function.
+	 * Find a perfect hash over the template names.  Start with a table
+	 * at least twice the number of templates and grow it if no seed
+	 * works.
 	 */
-	fprintf( pFile, "CHcsm* CHcsmCollection::" );
-	fprintf( pFile, "GetClassFromTemplateName(\n" );
-	fprintf( pFile, "%s%s%sstring templateName,\n", pTab, pTab, pTab );
-	fprintf( pFile, "%s%s%sconst %s& %s\n", pTab, pTab, pTab, 
-			 pSnoBlockClassName, pSnoBlockVarName );
-	fprintf( pFile, "%s%s%s)\n", pTab, pTab, pTab );
-	fprintf( pFile, "{\n" );
-	fprintf( pFile, "%sCHcsm* pHcsm;\n", pTab );
-	fprintf( pFile, "\n" );
+	numTemplates = 0;
+	for ( pSm = m_pIn->sm_list; pSm; pSm = pSm->next )  numTemplates++;
+
+	hashSize = 1;
+	while ( hashSize < 2 * numTemplates )  hashSize *= 2;
 
+	for ( ;; ) {
+
+		pSlot = (int*) malloc( hashSize * sizeof( int ) );
+		if ( !pSlot ) {
+
+			fprintf( stderr, "Out of memory generating template hash\n" );
+			exit( -1 );
+
+		}
+		if ( FindTemplateHash( hashSize, &seed, pSlot ) )  break;
+		free( pSlot );
+		hashSize *= 2;
+
+	}
+
+	/*
+	 * Generate the factory functions.
+	 */
 	for ( pSm = m_pIn->sm_list; pSm; pSm = pSm->next ) {
 
 		char* pSnoParserClassName = GetSnoParserClassFromHcsmName( pSm->name );
 
-		fprintf( pFile, "%sif ( templateName == \"%s\" ) {\n", 
-						 pTab, pSm->name );
-		fprintf( pFile, "\n" );
-		fprintf( pFile, "%s%s// EXIT: found class for template\n", pTab, pTab );
+		fprintf( pFile, "static CHcsm* New%s(\n", pSm->name );
+		fprintf( pFile, "%s%s%sCHcsmCollection* pRootCollection,\n", 
+				 pTab, pTab, pTab );
+		if ( pSnoParserClassName ) {
+			fprintf( pFile, "%s%s%sconst %s& %s\n", pTab, pTab, pTab, 
+					 pSnoBlockClassName, pSnoBlockVarName );
+		}
+		else {
+			fprintf( pFile, "%s%s%sconst %s&\n", pTab, pTab, pTab, 
+					 pSnoBlockClassName );
+		}
+		fprintf( pFile, "%s%s%s)\n", pTab, pTab, pTab );
+		fprintf( pFile, "{\n" );
 		if ( pSnoParserClassName ) {
-			fprintf( pFile, "%s%spHcsm = new C%s( this, %s );\n", 
-					 pTab, pTab, pSm->name, pSnoBlockVarName );
+			fprintf( pFile, "%sreturn new C%s( pRootCollection, %s );\n", 
+					 pTab, pSm->name, pSnoBlockVarName );
 		}
 		else{
-			fprintf( pFile, "%s%spHcsm = new C%s( this );\n", 
-					 pTab, pTab, pSm->name );
+			fprintf( pFile, "%sreturn new C%s( pRootCollection );\n", 
+					 pTab, pSm->name );
 		}
-		fprintf( pFile, "%s%sreturn pHcsm;\n", pTab, pTab );
+		fprintf( pFile, "}\n" );
 		fprintf( pFile, "\n" );
-		fprintf( pFile, "%s}\n", pTab );
 
 	}
 
+	/*
+	 * Generate the template table, indexed by template id.
+	 */
+	fprintf( pFile, "struct THcsmTemplate {\n" );
+	fprintf( pFile, "%sconst char* pName;\n", pTab );
+	fprintf( pFile, "%sCHcsm* (*pNew)( CHcsmCollection*, const %s& );\n", 
+			 pTab, pSnoBlockClassName );
+	fprintf( pFile, "};\n" );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "static const THcsmTemplate cHcsmTemplates[] = {\n" );
+	for ( pSm = m_pIn->sm_list; pSm; pSm = pSm->next ) {
+
+		fprintf( pFile, "%s{ \"%s\", New%s },\n", pTab, pSm->name, pSm->name );
+
+	}
+	fprintf( pFile, "};\n" );
+	fprintf( pFile, "\n" );
+
+	/*
+	 * Generate the hash table.
+	 */
+	fprintf( pFile, "// perfect hash of the template names; each slot holds the\n" );
+	fprintf( pFile, "// id of the only template that hashes to it or -1\n" );
+	fprintf( pFile, "static const unsigned int cHcsmTemplateHashSeed = %uu;\n", 
+			 seed );
+	fprintf( pFile, "static const int cHcsmTemplateHashSize = %d;\n", hashSize );
+	fprintf( pFile, "static const short cHcsmTemplateHash[%d] = {", hashSize );
+	for ( i = 0; i < hashSize; i++ ) {
+
+		if ( i % 16 == 0 )  fprintf( pFile, "\n%s", pTab );
+		fprintf( pFile, "%d%s", pSlot[i], i < hashSize - 1 ? ", " : "" );
+
+	}
+	fprintf( pFile, "\n};\n" );
+	fprintf( pFile, "\n" );
+	free( pSlot );
+
+	/*
+	 * Generate the lookup functions.
+	 */
+	fprintf( pFile, "int CHcsmCollection::GetTemplateId( const string& templateName )\n" );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%sunsigned int hash = cHcsmTemplateHashSeed;\n", pTab );
+	fprintf( pFile, "%sfor ( string::size_type i = 0; i < templateName.size(); i++ ) {\n", 
+			 pTab );
+	fprintf( pFile, "%s%shash ^= (unsigned char) templateName[i];\n", pTab, pTab );
+	fprintf( pFile, "%s%shash = ( hash * 16777619u ) & 0xffffffffu;\n", pTab, pTab );
+	fprintf( pFile, "%s}\n", pTab );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "%sint id = cHcsmTemplateHash[hash & ( cHcsmTemplateHashSize - 1 )];\n", 
+			 pTab );
+	fprintf( pFile, "%sif ( id >= 0 && templateName == cHcsmTemplates[id].pName )  return id;\n", 
+			 pTab );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "%sreturn -1;\n", pTab );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "const char* CHcsmCollection::GetTemplateName( int templateId )\n" );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%sif ( templateId < 0 || templateId >= eHCSM_NUM_TEMPLATES )  return \"\";\n", 
+			 pTab );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "%sreturn cHcsmTemplates[templateId].pName;\n", pTab );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "CHcsm* CHcsmCollection::" );
+	fprintf( pFile, "GetClassFromTemplateId(\n" );
+	fprintf( pFile, "%s%s%sint templateId,\n", pTab, pTab, pTab );
+	fprintf( pFile, "%s%s%sconst %s& %s\n", pTab, pTab, pTab, 
+			 pSnoBlockClassName, pSnoBlockVarName );
+	fprintf( pFile, "%s%s%s)\n", pTab, pTab, pTab );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%sif ( templateId < 0 || templateId >= eHCSM_NUM_TEMPLATES )  return NULL;\n", 
+			 pTab );
 	fprintf( pFile, "\n" );
-	fprintf( pFile, "%sreturn NULL;", pTab );
+	fprintf( pFile, "%sreturn cHcsmTemplates[templateId].pNew( this, %s );\n", 
+			 pTab, pSnoBlockVarName );
+	fprintf( pFile, "}\n" );
 	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "CHcsm* CHcsmCollection::" );
+	fprintf( pFile, "GetClassFromTemplateName(\n" );
+	fprintf( pFile, "%s%s%sstring templateName,\n", pTab, pTab, pTab );
+	fprintf( pFile, "%s%s%sconst %s& %s\n", pTab, pTab, pTab, 
+			 pSnoBlockClassName, pSnoBlockVarName );
+	fprintf( pFile, "%s%s%s)\n", pTab, pTab, pTab );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%sreturn GetClassFromTemplateId( GetTemplateId( templateName ), %s );\n", 
+			 pTab, pSnoBlockVarName );
 	fprintf( pFile, "}\n" );
 
 }
@@ -307,7 +1329,7 @@ static void GenStorageDerivedClassHeader(
 	fprintf( pFile, "public:\n" );
 	
 	/* default constructor */
-	fprintf( pFile, "%s%s( string );\n", pTab, className );
+	fprintf( pFile, "%s%s( const string& );\n", pTab, className );
 
 	/* copy constructor */
 	fprintf( pFile, "%s%s( const %s& );\n", pTab, className, className );
@@ -325,6 +1347,10 @@ static void GenStorageDerivedClassHeader(
 	/* set value function */
 	fprintf( pFile, "%svoid SetValue( %s );\n", pTab, pClassType );
 
+	/* checkpoint functions */
+	fprintf( pFile, "%svirtual void SaveState( CHcsmCheckpoint& );\n", pTab );
+	fprintf( pFile, "%svirtual void RestoreState( CHcsmCheckpoint& );\n", pTab );
+
 	fprintf( pFile, "\n" );
 	fprintf( pFile, "private:\n" );
 
@@ -389,7 +1415,7 @@ static void GenStorageDerivedClassImplementation(
 	/* 
 	 * Generate the default constructor.
 	 */
-	fprintf( pFile, "%s::%s( string name ):\n", className, className );
+	fprintf( pFile, "%s::%s( const string& name ):\n", className, className );
 	fprintf( pFile, "%s%s( name )\n", pTab, pBaseClassName );
 	fprintf( pFile, "{\n" );
 	fprintf( pFile, "\n" );
@@ -401,7 +1427,7 @@ static void GenStorageDerivedClassImplementation(
 	 */
 	fprintf( pFile, "%s::%s( const %s& %s ):\n", className, className, 
 			 className, pObjToCopy );
-	fprintf( pFile, "%s%s( %s.m_name )\n", pTab, pBaseClassName, pObjToCopy );
+	fprintf( pFile, "%s%s( %s )\n", pTab, pBaseClassName, pObjToCopy );
 	fprintf( pFile, "{\n" );
 	fprintf( pFile, "\n" );
 
@@ -485,6 +1511,27 @@ static void GenStorageDerivedClassImplementation(
 	fprintf( pFile, "}\n" );
 	fprintf( pFile, "\n" );
 
+	/*
+	 * Generate the SaveState and RestoreState functions.
+	 */
+	fprintf( pFile, "void %s::SaveState( CHcsmCheckpoint& ckpt )\n", className );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "%s%s::SaveState( ckpt );\n", pTab, pBaseClassName );
+	GenCheckpointValue( pFile, pTab, pClassType, pValueVarName, eTRUE );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "void %s::RestoreState( CHcsmCheckpoint& ckpt )\n", className );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "%s%s::RestoreState( ckpt );\n", pTab, pBaseClassName );
+	GenCheckpointValue( pFile, pTab, pClassType, pValueVarName, eFALSE );
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
 }
 
 
@@ -550,6 +1597,7 @@ static void GenStorageClasses( FILE* pHeaderFile, FILE* pImplementFile )
 	 */
 	fprintf( pImplementFile, "#include \"%s\"\n", SM_STORAGE_HEADER_FILE );
 	fprintf( pImplementFile, "#include <genericinclude.h>\n" );
+	fprintf( pImplementFile, "#include \"hcsmcheckpoint.h\"\n" );
 	fprintf( pImplementFile, "\n" );
 
 	/*
@@ -789,7 +1837,7 @@ static void GenCommunicationDerivedClassHeader(
 	fprintf( pFile, "public:\n" );
 	
 	/* default constructor */
-	fprintf( pFile, "%s%s( CHcsmCollection*, string );\n", pTab, className );
+	fprintf( pFile, "%s%s( CHcsmCollection*, const string& );\n", pTab, className );
 
 	/* copy constructor */
 	fprintf( pFile, "%s%s( const %s& );\n", pTab, className, className );
@@ -802,24 +1850,28 @@ static void GenCommunicationDerivedClassHeader(
 	fprintf( pFile, "%svirtual ~%s(); \n", pTab, className );
 
 	/* get value function */
-	fprintf( pFile, "%s%s GetValue();\n", pTab, pClassType );
+	fprintf( pFile, "%s%s GetValue();\n", pTab, PassType( pClassType ) );
 
 	/* get value string function */
 	fprintf( pFile, "%sstring GetValueStr();\n", pTab );
 
 	/* set value function */
-	fprintf( pFile, "%svoid SetValue( %s );\n", pTab, pClassType );
+	fprintf( pFile, "%svoid SetValue( %s );\n", pTab, PassType( pClassType ) );
 
 	/* set value string function */
 	fprintf( pFile, "%svoid SetValueStr(const string &);\n", pTab );
 
+	/* checkpoint functions */
+	fprintf( pFile, "%svirtual void SaveState( CHcsmCheckpoint& );\n", pTab );
+	fprintf( pFile, "%svirtual void RestoreState( CHcsmCheckpoint& );\n", pTab );
+
 	fprintf( pFile, "\n" );
 	fprintf( pFile, "private:\n" );
 
 	/* the private member that holds the value */
 	fprintf( pFile, "%s%s %s;\n", pTab, pClassType, pPrevValueVarName );
-	fprintf( pFile, "%s%s m_valueA;\n", pTab, pClassType );
-	fprintf( pFile, "%s%s m_valueB;\n", pTab, pClassType );
+	fprintf( pFile, "%s%s m_values[2];\n", pTab, pClassType );
+	fprintf( pFile, "%sint m_idxA;  // m_values[m_idxA] is A, the other one B\n", pTab );
 
 	fprintf( pFile, "};\n" );
 	fprintf( pFile, "\n" );
@@ -923,7 +1975,7 @@ static void GenCommunicationDerivedClassImpementation(
 	 */
 	fprintf( pFile, "%s::%s( ", className, className );
 	fprintf( pFile, "CHcsmCollection* %s, ", pCollectionVarName );
-	fprintf( pFile, "string name ):\n" );
+	fprintf( pFile, "const string& name ):\n" );
 	fprintf( pFile, "%s%s", pTab, pBaseClassName );
 	fprintf( pFile, "( %s, name )", pCollectionVarName );
 
@@ -941,6 +1993,8 @@ static void GenCommunicationDerivedClassImpementation(
 
 	fprintf( pFile, "\n{\n" );
 	fprintf( pFile, "\n" );
+	fprintf( pFile, "%sm_idxA = 0;\n", pTab );
+	fprintf( pFile, "\n" );
 	fprintf( pFile, "}\n" );
 	fprintf( pFile, "\n" );
 
@@ -957,11 +2011,9 @@ static void GenCommunicationDerivedClassImpementation(
 		);
 	fprintf( 
 		pFile, 
-		"%s%s( %s.m_%s, %s.m_name )", 
+		"%s%s( %s )", 
 		pTab, 
 		pBaseClassName, 
-		pObjToCopy, 
-		pCollectionVarName, 
 		pObjToCopy 
 		);
 	if( pCategory ) 
@@ -1002,8 +2054,9 @@ static void GenCommunicationDerivedClassImpementation(
 	fprintf( pFile, "%sif ( this != &%s ) {\n", pTab, pObjToCopy );
 	fprintf( pFile, "\n" );
 	fprintf( pFile, "%s%s// make a deep copy\n", pTab, pTab );
-	fprintf( pFile, "%s%sm_valueA = %s.m_valueA;\n", pTab, pTab, pObjToCopy );
-	fprintf( pFile, "%s%sm_valueB = %s.m_valueB;\n", pTab, pTab, pObjToCopy );
+	fprintf( pFile, "%s%sm_values[0] = %s.m_values[0];\n", pTab, pTab, pObjToCopy );
+	fprintf( pFile, "%s%sm_values[1] = %s.m_values[1];\n", pTab, pTab, pObjToCopy );
+	fprintf( pFile, "%s%sm_idxA = %s.m_idxA;\n", pTab, pTab, pObjToCopy );
 	fprintf( pFile, "\n" );
 	fprintf( pFile, "%s}\n", pTab );
 	fprintf( pFile, "\n" );
@@ -1023,58 +2076,11 @@ static void GenCommunicationDerivedClassImpementation(
 	fprintf( pFile, "\n" );
 
 	/*
-	 * Generate the GetValue function.
-	 */
-	fprintf( pFile, "%s %s::GetValue()\n", pClassType, className );
-	fprintf( pFile, "{\n" );
-
-	fprintf( pFile, "%sbool writtenThisFrame = m_setFrame == GetFrame();\n", pTab );
-	fprintf( pFile, "%sif( writtenThisFrame )\n", pTab );
-	fprintf( pFile, "%s{\n", pTab );
-	fprintf( pFile, "%s%s// make sure that dial has a value\n", pTab, pTab );
-	fprintf( pFile, "%s%sif( !m_hasValueB )\n", pTab, pTab );
-	fprintf( pFile, "%s%s{\n", pTab, pTab );
-	fprintf( 
-		pFile, 
-		"%s%s%scerr << MyName() << \"::GetValue: dial has no value\" << endl;\n",
-		pTab,
-		pTab,
-		pTab
-		);
-	fprintf( pFile, "%s%s}\n", pTab, pTab );
-	fprintf( pFile, "\n" );
-	fprintf( pFile, "%s%sreturn m_valueB;\n", pTab, pTab );
-	fprintf( pFile, "%s}\n", pTab );
-	fprintf( pFile, "%selse\n", pTab );
-	fprintf( pFile, "%s{\n", pTab );
-	fprintf( pFile, "%s%s// make sure that dial has a value\n", pTab, pTab );
-	fprintf( pFile, "%s%sif( !m_hasValueA )\n", pTab, pTab );
-	fprintf( pFile, "%s%s{\n", pTab, pTab );
-	fprintf( 
-		pFile, 
-		"%s%s%scerr << MyName() << \"::GetValue: dial has no value\" << endl;\n",
-		pTab,
-		pTab,
-		pTab
-		);
-	fprintf( pFile, "%s%s}\n", pTab, pTab );
-	fprintf( pFile, "\n" );
-	fprintf( pFile, "%s%sreturn m_valueA;\n", pTab, pTab );
-	fprintf( pFile, "%s}\n", pTab );
-
-	fprintf( pFile, "}\n" );
-	fprintf( pFile, "\n" );
-
-	/*
-	 * Generate the GetValueStr function.
+	 * Generate the GetValue function.
 	 */
-	fprintf( pFile, "string %s::GetValueStr()\n", className );
+	fprintf( pFile, "%s %s::GetValue()\n", PassType( pClassType ), className );
 	fprintf( pFile, "{\n" );
 
-	fprintf( pFile, "%sstring strValue = \"\";\n", pTab );
-	fprintf( pFile, "%s%s curValue;\n\n", pTab, pClassType );
-	fprintf( pFile, "\n" );
-
 	fprintf( pFile, "%sbool writtenThisFrame = m_setFrame == GetFrame();\n", pTab );
 	fprintf( pFile, "%sif( writtenThisFrame )\n", pTab );
 	fprintf( pFile, "%s{\n", pTab );
@@ -1090,7 +2096,7 @@ static void GenCommunicationDerivedClassImpementation(
 		);
 	fprintf( pFile, "%s%s}\n", pTab, pTab );
 	fprintf( pFile, "\n" );
-	fprintf( pFile, "%s%scurValue = m_valueB;\n", pTab, pTab );
+	fprintf( pFile, "%s%sreturn m_values[1 - m_idxA];\n", pTab, pTab );
 	fprintf( pFile, "%s}\n", pTab );
 	fprintf( pFile, "%selse\n", pTab );
 	fprintf( pFile, "%s{\n", pTab );
@@ -1106,8 +2112,20 @@ static void GenCommunicationDerivedClassImpementation(
 		);
 	fprintf( pFile, "%s%s}\n", pTab, pTab );
 	fprintf( pFile, "\n" );
-	fprintf( pFile, "%s%scurValue = m_valueA;\n", pTab, pTab );
+	fprintf( pFile, "%s%sreturn m_values[m_idxA];\n", pTab, pTab );
 	fprintf( pFile, "%s}\n", pTab );
+
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+	/*
+	 * Generate the GetValueStr function.
+	 */
+	fprintf( pFile, "string %s::GetValueStr()\n", className );
+	fprintf( pFile, "{\n" );
+
+	fprintf( pFile, "%sstring strValue = \"\";\n", pTab );
+	fprintf( pFile, "%s%s curValue = GetValue();\n", pTab, pClassType );
 	fprintf( pFile, "%s\n", pTab );
 
 	/* Figure out which conversion function to use */
@@ -1128,14 +2146,17 @@ static void GenCommunicationDerivedClassImpementation(
 	/*
 	 * Generate the SetValue function.
 	 */
-	fprintf( pFile, "void %s::SetValue( %s value )\n", className, pClassType );
+	fprintf( pFile, "void %s::SetValue( %s value )\n", className, PassType( pClassType ) );
 	fprintf( pFile, "{\n" );
 
 	fprintf( pFile, "%sbool writtenThisFrame = m_setFrame == GetFrame();\n", pTab );
 	fprintf( pFile, "%sif( !writtenThisFrame )\n", pTab );
 	fprintf( pFile, "%s{\n", pTab );
-	fprintf( pFile, "%s%sm_valueB = m_valueA;\n", pTab, pTab );
-	fprintf( pFile, "%s%sm_valueA = value;\n", pTab, pTab );
+	fprintf( pFile, "%s%s// the new value goes into the older buffer, so a value\n", pTab, pTab );
+	fprintf( pFile, "%s%s// borrowed earlier in this frame stays intact, as B, until\n", pTab, pTab );
+	fprintf( pFile, "%s%s// the next frame's write\n", pTab, pTab );
+	fprintf( pFile, "%s%sm_idxA = 1 - m_idxA;\n", pTab, pTab );
+	fprintf( pFile, "%s%sm_values[m_idxA] = value;\n", pTab, pTab );
 	fprintf( pFile, "%s}\n", pTab );
 	fprintf( pFile, "%s\n", pTab );
 	fprintf( pFile, "%s%s::SetValue();\n", pTab, pBaseClassName );
@@ -1154,14 +2175,35 @@ static void GenCommunicationDerivedClassImpementation(
 	fprintf( pFile, "%sbool writtenThisFrame = m_setFrame == GetFrame();\n", pTab );
 	fprintf( pFile, "%sif( !writtenThisFrame )\n", pTab );
 	fprintf( pFile, "%s{\n", pTab );
-	fprintf( pFile, "%s%sm_valueB = m_valueA;\n", pTab, pTab );
-	fprintf( pFile, "%s%sm_valueA%s;\n", pTab, pTab, conversion[typeIdx].stringToType );
+	fprintf( pFile, "%s%sm_idxA = 1 - m_idxA;\n", pTab, pTab );
+	fprintf( pFile, "%s%sm_values[m_idxA]%s;\n", pTab, pTab, conversion[typeIdx].stringToType );
 	fprintf( pFile, "%s}\n", pTab );
 	fprintf( pFile, "%s\n", pTab );
 	fprintf( pFile, "%s%s::SetValue();\n", pTab, pBaseClassName );
 
 	fprintf( pFile, "}\n" );
 	fprintf( pFile, "\n" );	
+
+	/*
+	 * Generate the SaveState and RestoreState functions.
+	 */
+	fprintf( pFile, "void %s::SaveState( CHcsmCheckpoint& ckpt )\n", className );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%s%s::SaveState( ckpt );\n", pTab, pBaseClassName );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_prevValue", eTRUE );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_values[m_idxA]", eTRUE );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_values[1 - m_idxA]", eTRUE );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "void %s::RestoreState( CHcsmCheckpoint& ckpt )\n", className );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "%s%s::RestoreState( ckpt );\n", pTab, pBaseClassName );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_prevValue", eFALSE );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_values[m_idxA]", eFALSE );
+	GenCheckpointValue( pFile, pTab, pClassType, "m_values[1 - m_idxA]", eFALSE );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
 }
 
 
@@ -1408,6 +2450,7 @@ GenHcsmMonitor(
 	static char* pTab = "    ";   
 	static char* pAccessorName = "GetMonitorByName"; 
 	static char* pAccessorStrName = "GetMonitorByNameStr"; 
+	static char* pBorrowName = "BorrowMonitorByName"; 
 
 	/*
 	 * Print out a header and information about the functions
@@ -1440,7 +2483,12 @@ GenHcsmMonitor(
 	fprintf( pFile, "// %smonitorName - name of the monitor\n", pTab );
 	fprintf( 
 		pFile, 
-		"// %svalue - place where value of monitor is put\n", 
+		"// %svalue - place where value of monitor is put, or for\n", 
+		pTab
+		);
+	fprintf( 
+		pFile, 
+		"// %s  BorrowMonitorByName a pointer to the current value\n", 
 		pTab
 		);
 	fprintf( pFile, "//\n" );
@@ -1489,6 +2537,40 @@ GenHcsmMonitor(
 			fprintf( pFile, "\n" );
 			fprintf( pFile, "}\n" );
 			fprintf( pFile, "\n" );
+
+			if ( !IsRefType( pNode->pName ) )  continue;
+
+			/*
+			 * Large types can also be borrowed instead of copied.  The
+			 * pointer stays valid until the monitor is written in the
+			 * next frame.
+			 */
+			fprintf( pFile, "inline virtual bool\n" );
+			fprintf( 
+				pFile, 
+				"%s( const string& monitorName, const %s** )\n", 
+				pBorrowName, 
+				pNode->pName 
+				);
+			fprintf( pFile, "{\n" );
+			fprintf( pFile, "\n" );
+
+			fprintf( 
+				pFile, 
+				"%scout << MyName()\n%s%s << \"::%s has no monitor named \"\n%s%s << monitorName << endl;\n", 
+				pTab, 
+				pTab, 
+				pTab, 
+				pBorrowName, 
+				pTab, 
+				pTab
+				);
+			
+			fprintf( pFile, "%sreturn false;\n", pTab );
+
+			fprintf( pFile, "\n" );
+			fprintf( pFile, "}\n" );
+			fprintf( pFile, "\n" );
 		}
 	}
 
@@ -1704,6 +2786,7 @@ GenCommunicationClasses(
 	fprintf( pImplementFile, "#include \"%s\"\n", SM_COMMUNICATE_HEADER_FILE );
 	fprintf( pImplementFile, "#include <genericinclude.h>\n" );
 	fprintf( pImplementFile, "#include <hcsmcollection.h>\n" );
+	fprintf( pImplementFile, "#include \"hcsmcheckpoint.h\"\n" );
 	fprintf( pImplementFile, "\n" );
 
 	/*
@@ -2066,6 +3149,11 @@ static void GenClassHeader( FILE* pFile )
 
 	}
 
+	/*
+	 * Print the template ids.
+	 */
+	GenTemplateIdEnum( pFile );
+
 	/*
 	 * Print the class declarations.
 	 */
@@ -2109,6 +3197,8 @@ static void GenClassHeader( FILE* pFile )
 		fprintf( pFile, "%sC%s& operator=( const C%s& );\n", pTab, pSm->name,
 				 pSm->name );
 		fprintf( pFile, "%svirtual ~C%s();\n", pTab, pSm->name );
+		fprintf( pFile, "%svirtual void SaveState( CHcsmCheckpoint& );\n", pTab );
+		fprintf( pFile, "%svirtual void RestoreState( CHcsmCheckpoint& );\n", pTab );
 
 		/*
 		 * Generate public input parameter mutator functions.
@@ -2139,7 +3229,7 @@ static void GenClassHeader( FILE* pFile )
 		for ( pDial = pSm->dials; pDial; pDial = pDial->pNext ) {
 
 			fprintf( pFile, "%svoid SetDial%s( %s );\n", pTab, 
-					 pDial->pName, pDial->pValue );
+					 pDial->pName, PassType( pDial->pValue ) );
 			fprintf( pFile, "%svoid SetDial%sNoValue();\n", 
 					 pTab, pDial->pName );
 
@@ -2150,8 +3240,8 @@ static void GenClassHeader( FILE* pFile )
 		 */
 		for ( pMonitor = pSm->monitors; pMonitor; pMonitor = pMonitor->pNext ) {
 
-			fprintf( pFile, "%s%s GetMonitor%s();\n", pTab, pMonitor->pValue,
-					 pMonitor->pName );
+			fprintf( pFile, "%s%s GetMonitor%s();\n", pTab, 
+					 PassType( pMonitor->pValue ), pMonitor->pName );
 
 		}
 
@@ -2214,6 +3304,10 @@ static void GenClassHeader( FILE* pFile )
 
 				fprintf( pFile, "%sbool GetMonitorByName", pTab );
 				fprintf( pFile, "( const string&, %s* );\n", pNode->pName );
+				if ( IsRefType( pNode->pName ) ) {
+					fprintf( pFile, "%sbool BorrowMonitorByName", pTab );
+					fprintf( pFile, "( const string&, const %s** );\n", pNode->pName );
+				}
 
 			}
 
@@ -2498,8 +3592,8 @@ static void GenClassHeader( FILE* pFile )
 
 			fprintf( pFile, "%sCDial%s m_dial%s;\n", pTab, 
 					 pDial->pValue, pDial->pName );
-			fprintf( pFile, "%s%s GetDial%s();\n", pTab, pDial->pValue,
-					 pDial->pName );
+			fprintf( pFile, "%s%s GetDial%s();\n", pTab, 
+					 PassType( pDial->pValue ), pDial->pName );
 
 		}
 
@@ -2520,7 +3614,7 @@ static void GenClassHeader( FILE* pFile )
 			fprintf( pFile, "%sCMonitor%s m_monitor%s;\n", pTab, 
 					 pMonitor->pValue, pMonitor->pName );
 			fprintf( pFile, "%svoid SetMonitor%s( %s );\n", pTab, 
-					 pMonitor->pName, pMonitor->pValue );
+					 pMonitor->pName, PassType( pMonitor->pValue ) );
 			fprintf( pFile, "%svoid SetMonitor%sNoValue();\n", pTab, 
 					 pMonitor->pName );
 
@@ -3679,6 +4773,134 @@ static void GenClassOutputParameter( FILE* pFile, TStateMachine* pSm )
 }
 
 
+/******************************************************************************
+ *
+ * Description: Generates the class member function that saves or restores
+ *   an HCSM's state to or from a checkpoint.
+ *
+ * Remarks:  The generated function first calls the parent class, which
+ *   takes care of the base HCSM state and the children, then handles the
+ *   buttons, dials, monitors, input parameters, local variables, output
+ *   parameters and the data members declared with PRIV_DECL, and finally
+ *   calls the user hook (SaveUserState or RestoreUserState).
+ *
+ * Arugments:
+ *   pFile            -- Pointer to the file to write data to.
+ *   pSm              -- Pointer to SM on SM list in parser data 
+ *                       structures.
+ *   pParentClassName -- The parent class' name.
+ *   isSave           -- eTRUE for SaveState, eFALSE for RestoreState.
+ *
+ * Returns:
+ *
+ */
+static void GenClassCheckpoint( 
+			FILE* pFile, 
+			TStateMachine* pSm, 
+			const char* pParentClassName,
+			EBool isSave
+			)
+{
+
+	static char*   pTab = "    ";   /* simulates a tab character            */
+
+	const char*    pFuncName = isSave ? "SaveState" : "RestoreState";
+	TStringPair*   pNode;           /* pointer to str pair node             */
+	TPrivUser*     pPriv;           /* pointer to private declaration       */
+
+	fprintf( pFile, "void C%s::%s( CHcsmCheckpoint& ckpt )\n", 
+			 pSm->name, pFuncName );
+	fprintf( pFile, "{\n" );
+	fprintf( pFile, "\n" );
+
+	fprintf( pFile, "%s%s::%s( ckpt );\n", pTab, pParentClassName, pFuncName );
+
+	for ( pNode = pSm->buttons; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_button%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pNode = pSm->dials; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_dial%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pNode = pSm->monitors; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_monitor%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pNode = pSm->inputs; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_input%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pNode = pSm->locals; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_local%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pNode = pSm->outputs; pNode; pNode = pNode->pNext ) {
+
+		fprintf( pFile, "%sm_output%s.%s( ckpt );\n", pTab, pNode->pName, 
+				 pFuncName );
+
+	}
+
+	for ( pPriv = pSm->priv_user_func; pPriv; pPriv = pPriv->pNext ) {
+
+		char type[256];
+		char name[256];
+
+		if ( !ParsePrivDataMember( pPriv->pDec, type, name ) )  continue;
+
+		/* 
+		 * CVED items declared here are not guaranteed to be bound to
+		 * CVED when the object is created, so they are rebuilt against 
+		 * the Hcsm's CVED instance instead of through SetString.
+		 */
+		if ( GetCheckpointKind( type ) == eCKPT_STRING ) {
+
+			if ( isSave ) {
+
+				fprintf( pFile, "%sckpt.Put( %s );\n", pTab, name );
+
+			}
+			else {
+
+				fprintf( pFile, "%sckpt.Get( %s, *cved );\n", pTab, name );
+
+			}
+
+		}
+		else {
+
+			GenCheckpointValue( pFile, pTab, type, name, isSave );
+
+		}
+
+	}
+
+	fprintf( pFile, "%s%s( ckpt );\n", pTab, 
+			 isSave ? "SaveUserState" : "RestoreUserState" );
+
+	fprintf( pFile, "\n" );
+	fprintf( pFile, "}\n" );
+	fprintf( pFile, "\n" );
+
+}
+
+
 /******************************************************************************
  *
  * Description: Generates the class member functions that set and get 
@@ -3801,7 +5023,7 @@ static void GenClassDial( FILE* pFile, TStateMachine* pSm )
 		/* 
 		 * Generate the accessor function.
 		 */
-		fprintf( pFile, "%s C%s::%s%s()\n", pDial->pValue,
+		fprintf( pFile, "%s C%s::%s%s()\n", PassType( pDial->pValue ),
 				 pSm->name, pAccessorName, pDial->pName );
 		fprintf( pFile, "{\n" );
 		fprintf( pFile, "\n" );
@@ -3817,7 +5039,7 @@ static void GenClassDial( FILE* pFile, TStateMachine* pSm )
 		 * Generate the mutator function.
 		 */
 		fprintf( pFile, "void C%s::%s%s( %s value )\n",  pSm->name,
-				 pMutatorName, pDial->pName, pDial->pValue );
+				 pMutatorName, pDial->pName, PassType( pDial->pValue ) );
 		fprintf( pFile, "{\n" );
 		fprintf( pFile, "\n" );
 
@@ -4011,7 +5233,7 @@ static void GenClassMonitor( FILE* pFile, TStateMachine* pSm )
 		/* 
 		 * Generate the accessor function.
 		 */
-		fprintf( pFile, "%s C%s::%s%s()\n", pMonitor->pValue,
+		fprintf( pFile, "%s C%s::%s%s()\n", PassType( pMonitor->pValue ),
 				 pSm->name, pAccessorName, pMonitor->pName );
 		fprintf( pFile, "{\n" );
 		fprintf( pFile, "\n" );
@@ -4027,7 +5249,7 @@ static void GenClassMonitor( FILE* pFile, TStateMachine* pSm )
 		 * Generate the mutator function.
 		 */
 		fprintf( pFile, "void C%s::%s%s( %s value )\n",  pSm->name,
-				 pMutatorName, pMonitor->pName, pMonitor->pValue );
+				 pMutatorName, pMonitor->pName, PassType( pMonitor->pValue ) );
 		fprintf( pFile, "{\n" );
 		fprintf( pFile, "\n" );
 
@@ -4104,6 +5326,48 @@ static void GenClassMonitor( FILE* pFile, TStateMachine* pSm )
 			fprintf( pFile, "\n" );
 			fprintf( pFile, "}\n" );
 			fprintf( pFile, "\n" );
+
+			if ( !IsRefType( pNode->pName ) )  continue;
+
+			/*
+			 * Generate the function that hands out a pointer to the
+			 * monitor's current value instead of a copy.
+			 */
+			fprintf( pFile, "bool C%s::BorrowMonitorByName", pSm->name );
+			fprintf( pFile, "( const string& monitorName, " );
+			fprintf( pFile, "const %s** ppValue )\n", pNode->pName );
+			fprintf( pFile, "{\n" );
+			fprintf( pFile, "\n" );
+
+			for ( pMonitor = pSm->monitors; pMonitor; pMonitor = pMonitor->pNext ) {
+
+				if ( !strcmp( pMonitor->pValue, pNode->pName ) ) {
+
+					fprintf( pFile, "%sif ( monitorName == m_monitor", pTab );
+					fprintf( pFile, "%s.GetName() ) {\n", pMonitor->pName );
+					fprintf( pFile, "%s%s\n", pTab, pTab );
+					fprintf( pFile, "%s%sbool retVal = m_monitor%s.HasValue();\n",
+							 pTab, pTab, pMonitor->pName );
+					fprintf( pFile, "%s%sif ( retVal ) {\n", pTab, pTab );
+					fprintf( pFile, "%s%s%s*ppValue = &m_monitor%s.GetValue();\n", 
+							 pTab, pTab, pTab, pMonitor->pName );
+					fprintf( pFile, "%s%s}\n", pTab, pTab );
+					fprintf( pFile, "%s%s\n", pTab, pTab );
+					fprintf( pFile, "%s%sreturn retVal;\n", pTab, pTab );
+					fprintf( pFile, "%s%s\n", pTab, pTab );
+					fprintf( pFile, "%s}\n", pTab );
+
+					fprintf( pFile, "%s\n", pTab );
+
+				}
+
+			}
+
+			fprintf( pFile, "%sreturn false;\n", pTab );
+
+			fprintf( pFile, "\n" );
+			fprintf( pFile, "}\n" );
+			fprintf( pFile, "\n" );
 		}
 
 
@@ -4116,14 +5380,15 @@ static void GenClassMonitor( FILE* pFile, TStateMachine* pSm )
  *
  * Name:  GenClassImplementation
  *
- * Generates the state machine c++ implementation file.  The implementation 
- * file contains class implementations.
+ * Generates the state machine c++ implementation files.  Each state
+ * machine's class implementation goes in a file of its own, named after
+ * the state machine, so changing one state machine only rebuilds its
+ * own file.
  *
  * Inputs:
- *   pFile -- Pointer to the file to write data to.
  *
  */
-static void GenClassImplementation( FILE* pFile )
+static void GenClassImplementation( void )
 {
 
 	static char*   pCollectionName = "CHcsmCollection";
@@ -4135,17 +5400,6 @@ static void GenClassImplementation( FILE* pFile )
 	TStateMachine* pSm;             /* pointer to SM on SM list             */
 
 
-	/*
-	 * Print the preamble.
-	 */
-	fprintf( pFile, m_pHeaderPreamble1 );
-
-	/*
-	 * Print the include for the header file.
-	 */
-	fprintf( pFile, "#include \"%s\"\n", SM_CLASS_HEADER_FILE );
-	fprintf( pFile, "\n" );
-
 	/*
 	 * Print the class implementations.
 	 */
@@ -4154,6 +5408,19 @@ static void GenClassImplementation( FILE* pFile )
 		char*   pSnoParserClassName;
 		char*   pParentName;
 		EBool   isConcurrent;
+		char    fileName[SM_MAX_PATH_LEN];
+		FILE*   pFile;
+
+		GetClassImplementFileName( pSm->name, fileName );
+		pFile = OpenGenFile( fileName );
+
+		/*
+		 * Print the preamble and the includes.
+		 */
+		fprintf( pFile, m_pHeaderPreamble1 );
+		fprintf( pFile, "#include \"%s\"\n", SM_CLASS_HEADER_FILE );
+		fprintf( pFile, "#include \"hcsmcheckpoint.h\"\n" );
+		fprintf( pFile, "\n" );
 
 		pSnoParserClassName = GetSnoParserClassFromHcsmName( pSm->name );
 		
@@ -4215,6 +5482,12 @@ static void GenClassImplementation( FILE* pFile )
 					);
 		fprintf( pFile, "\n" );
 
+		/*
+		 * Print the checkpoint functions.
+		 */
+		GenClassCheckpoint( pFile, pSm, pParentName, eTRUE );
+		GenClassCheckpoint( pFile, pSm, pParentName, eFALSE );
+
 		/*
 		 * Print the Creation, Deletion, PreActivity and PostActivity functions.
 		 */
@@ -4271,6 +5544,8 @@ static void GenClassImplementation( FILE* pFile )
 		 * Print the accessor and mutator functions for monitors.
 		 */
 		GenClassMonitor( pFile, pSm );
+
+		CloseGenFile( pFile, fileName );
 	}
 
 
@@ -4601,7 +5876,6 @@ void GenerateCode( THcsmParserInfo *pParserInfo )
 	int            lastParId = 1;
 	int            lastVarId = 1;
 	FILE*          pClassHeaderFile;   /* contains class decelarations       */
-	FILE*          pClassImplementFile;/* contains class implementations     */
 	FILE*          pCommunicateHeaderFile; /* contains hcsm communicate decls*/
 	FILE*          pCommunicateImplementFile; /* contains communicate implemn*/
 	FILE*          pGlobalHeaderFile;  /* contain global header information  */
@@ -4617,97 +5891,17 @@ void GenerateCode( THcsmParserInfo *pParserInfo )
 
 	m_pIn = pParserInfo;
 
-	pTemplateToClassFile = (FILE *) fopen( SM_TARGET_DIR SM_TEMPLATE_TO_CLASS_FILE, "w" );
-	if ( pTemplateToClassFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_TEMPLATE_TO_CLASS_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pGlobalHeaderFile = (FILE *) fopen( SM_TARGET_DIR SM_GLOBAL_HEADER_FILE, "w" );
-	if ( pGlobalHeaderFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_GLOBAL_HEADER_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pClassHeaderFile = (FILE *) fopen( SM_TARGET_DIR SM_CLASS_HEADER_FILE, "w" );
-	if ( pClassHeaderFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_CLASS_HEADER_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pClassImplementFile = (FILE *) fopen( SM_TARGET_DIR SM_CLASS_IMPLEMENT_FILE, "w" );
-	if ( pClassImplementFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_CLASS_IMPLEMENT_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pCommunicateHeaderFile = (FILE *) fopen( SM_TARGET_DIR SM_COMMUNICATE_HEADER_FILE, "w" );
-	if ( pCommunicateHeaderFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_COMMUNICATE_HEADER_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pCommunicateImplementFile = (FILE *) fopen( SM_TARGET_DIR SM_COMMUNICATE_IMPLEMENT_FILE, "w" );
-	if ( pCommunicateImplementFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_COMMUNICATE_IMPLEMENT_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pStorageHeaderFile = (FILE *) fopen( SM_TARGET_DIR SM_STORAGE_HEADER_FILE, "w" );
-	if ( pStorageHeaderFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_STORAGE_HEADER_FILE );
-		perror("");
-		exit(-1);
-
-	}
-	pStorageImplementFile = (FILE *) fopen( SM_TARGET_DIR SM_STORAGE_IMPLEMENT_FILE, "w" );
-	if ( pStorageImplementFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_STORAGE_IMPLEMENT_FILE );
-		perror("");
-		exit(-1);
-
-	}
-
-	pHcsmDialMonitorInlFile = (FILE *) fopen( SM_TARGET_DIR SM_HCSM_DIAL_MONITOR_INL_FILE, "w" );
-	if ( pHcsmDialMonitorInlFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_HCSM_DIAL_MONITOR_INL_FILE );
-		perror("");
-		exit(-1);
-
-	}
-
-	pGenButtonDialHeaderFile = (FILE *) fopen( SM_TARGET_DIR SM_GEN_BUTTON_DIAL_HEADER_FILE, "w" );
-	if ( pGenButtonDialHeaderFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_GEN_BUTTON_DIAL_HEADER_FILE );
-		perror("");
-		exit(-1);
+	pTemplateToClassFile = OpenGenFile( SM_TEMPLATE_TO_CLASS_FILE );
+	pGlobalHeaderFile = OpenGenFile( SM_GLOBAL_HEADER_FILE );
+	pClassHeaderFile = OpenGenFile( SM_CLASS_HEADER_FILE );
+	pCommunicateHeaderFile = OpenGenFile( SM_COMMUNICATE_HEADER_FILE );
+	pCommunicateImplementFile = OpenGenFile( SM_COMMUNICATE_IMPLEMENT_FILE );
+	pStorageHeaderFile = OpenGenFile( SM_STORAGE_HEADER_FILE );
+	pStorageImplementFile = OpenGenFile( SM_STORAGE_IMPLEMENT_FILE );
 
-	}
-
-	pGenButtonDialImplementFile = (FILE *) fopen( SM_TARGET_DIR SM_GEN_BUTTON_DIAL_IMPLEMENT_FILE, "w" );
-	if ( pGenButtonDialImplementFile == NULL ) {
-
-		fprintf( stderr, "Can't open '%s' for output", SM_TARGET_DIR SM_GEN_BUTTON_DIAL_IMPLEMENT_FILE );
-		perror("");
-		exit(-1);
-
-	}
+	pHcsmDialMonitorInlFile = OpenGenFile( SM_HCSM_DIAL_MONITOR_INL_FILE );
+	pGenButtonDialHeaderFile = OpenGenFile( SM_GEN_BUTTON_DIAL_HEADER_FILE );
+	pGenButtonDialImplementFile = OpenGenFile( SM_GEN_BUTTON_DIAL_IMPLEMENT_FILE );
 
 	/*
 	 * Assign unique identifiers to the various objects.
@@ -4758,20 +5952,20 @@ void GenerateCode( THcsmParserInfo *pParserInfo )
 	 * names to classes.
 	 */
 	GenTemplateToClassFunction( pTemplateToClassFile );
-	fclose( pTemplateToClassFile );
+	CloseGenFile( pTemplateToClassFile, SM_TEMPLATE_TO_CLASS_FILE );
 
 	/*
 	 * Generate the HCSM global header file.
 	 */
 	GenHcsmGlobalHeader( pGlobalHeaderFile );
-	fclose( pGlobalHeaderFile );
+	CloseGenFile( pGlobalHeaderFile, SM_GLOBAL_HEADER_FILE );
 
 	/*
 	 * Generate storage class declarations.
 	 */
 	GenStorageClasses( pStorageHeaderFile, pStorageImplementFile );
-	fclose( pStorageHeaderFile );
-	fclose( pStorageImplementFile );
+	CloseGenFile( pStorageHeaderFile, SM_STORAGE_HEADER_FILE );
+	CloseGenFile( pStorageImplementFile, SM_STORAGE_IMPLEMENT_FILE );
 
 	/*
 	 * Generate communicate class declarations.
@@ -4781,25 +5975,26 @@ void GenerateCode( THcsmParserInfo *pParserInfo )
 				pCommunicateImplementFile,
 				pHcsmDialMonitorInlFile 
 				);
-	fclose( pCommunicateHeaderFile );
-	fclose( pCommunicateImplementFile );
-	fclose( pHcsmDialMonitorInlFile );
+	CloseGenFile( pCommunicateHeaderFile, SM_COMMUNICATE_HEADER_FILE );
+	CloseGenFile( pCommunicateImplementFile, SM_COMMUNICATE_IMPLEMENT_FILE );
+	CloseGenFile( pHcsmDialMonitorInlFile, SM_HCSM_DIAL_MONITOR_INL_FILE );
 
 	/* 
 	 * Generate class declarations.
 	 */
 	GenClassHeader( pClassHeaderFile );
-	fclose( pClassHeaderFile );
+	CloseGenFile( pClassHeaderFile, SM_CLASS_HEADER_FILE );
 
 	/* 
-	 * Generate class implementations.
+	 * Generate class implementations, one file per state machine.
 	 */
-	GenClassImplementation( pClassImplementFile );
-	fclose( pClassImplementFile );
+	GenClassImplementation();
 
 	GenButtonDialHeader( pGenButtonDialHeaderFile );
-	fclose( pGenButtonDialHeaderFile );
+	CloseGenFile( pGenButtonDialHeaderFile, SM_GEN_BUTTON_DIAL_HEADER_FILE );
 
 	GenButtonDialImplementation( pGenButtonDialImplementFile );
-	fclose( pGenButtonDialImplementFile );
+	CloseGenFile( pGenButtonDialImplementFile, SM_GEN_BUTTON_DIAL_IMPLEMENT_FILE );
+
+	WriteStamp();
 }
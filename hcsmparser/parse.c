@@ -2142,13 +2142,38 @@ main( int argc, char **argv )
 	FILE*         pInFile;             /* input file                         */
 	FILE*         pOutFile;            /* output file                        */
 	int           jmpCode;             /* return value from setjmp           */
+	char*         pInputName = NULL;   /* the .sm file to process            */
+	EBool         force = eFALSE;      /* regenerate even if up to date      */
+	int           i;
 
 	/*
 	 * Check arguments to application.
 	 */
-	if( argc != 2 ) 
+	for( i = 1; i < argc; i++ ) 
 	{
-		fprintf( stderr, "Usage: %s input_file\n", argv[0] );
+		if( !strcmp( argv[i], "-o" ) && i + 1 < argc ) 
+		{
+			SetTargetDir( argv[++i] );
+		}
+		else if( !strcmp( argv[i], "-f" ) ) 
+		{
+			force = eTRUE;
+		}
+		else if( argv[i][0] != '-' && pInputName == NULL ) 
+		{
+			pInputName = argv[i];
+		}
+		else 
+		{
+			pInputName = NULL;
+			break;
+		}
+	}
+	if( pInputName == NULL ) 
+	{
+		fprintf( stderr, "Usage: %s [-o target_dir] [-f] input_file\n", argv[0] );
+		fprintf( stderr, "  -o  write the generated files to target_dir\n" );
+		fprintf( stderr, "  -f  regenerate even if the input has not changed\n" );
 		exit( -1 );
 	}
 
@@ -2171,9 +2196,21 @@ main( int argc, char **argv )
 		exit(-1);
 	}
 
-	IncludeFile( pOutFile, argv[1] );
+	IncludeFile( pOutFile, pInputName );
 	fclose( pOutFile );
 
+	/*
+	 * Nothing to do if the code was last generated from the same input
+	 * by the same code generator and no generated file has been deleted
+	 * or edited since.
+	 */
+	if( IsGeneratedCodeCurrent( pTempName ) && !force ) 
+	{
+		(void) _unlink( pTempName );
+		puts( "OK (up to date)" );
+		return 0;
+	}
+
 	/*
 	 * Open processed file.
 	 */
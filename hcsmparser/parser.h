@@ -48,6 +48,9 @@
 /*** the following #define reflects a value in sm.h */
 #define SM_MAX_HCSM_NAME_LEN  64
 
+/*** longest path of a generated file */
+#define SM_MAX_PATH_LEN       512
+
 #define ERROR(__msg) \
   fprintf(stderr,"Syntax error in %s, line %d.\n  Err msg: %s.\n",g_CurFile,\
 	g_LineNum, __msg), longjmp(g_Recovery, 1)
@@ -101,8 +104,13 @@ typedef enum { eTRUE= 1, eFALSE = 0 } EBool;
 #define SM_CLASS_HEADER_FILE "genhcsm.h"
 #endif
 
-#ifndef SM_CLASS_IMPLEMENT_FILE   
-#define SM_CLASS_IMPLEMENT_FILE "genhcsm.cxx"
+/* each state machine's class is implemented in prefix + name + suffix */
+#ifndef SM_CLASS_IMPLEMENT_PREFIX
+#define SM_CLASS_IMPLEMENT_PREFIX "genhcsm_"
+#endif
+
+#ifndef SM_CLASS_IMPLEMENT_SUFFIX
+#define SM_CLASS_IMPLEMENT_SUFFIX ".cxx"
 #endif
 
 #ifndef SM_STORAGE_HEADER_FILE   
@@ -137,6 +145,11 @@ typedef enum { eTRUE= 1, eFALSE = 0 } EBool;
 #define SM_GEN_BUTTON_DIAL_IMPLEMENT_FILE "genbuttondialinfo.cxx"
 #endif
 
+/* records the input the generated files were made from */
+#ifndef SM_STAMP_FILE
+#define SM_STAMP_FILE "hcsmgen.stamp"
+#endif
+
 /******************************************************************************
  *
  * Parser data structures.
@@ -346,3 +359,5 @@ int            AssignUniqueIdsToStrNodeList(TStringNode  *head, int start);
 int            AssignIdsToTransList(TTransition  *head, int start);
 
 void           GenerateCode( THcsmParserInfo* pPinfo );
+void           SetTargetDir( const char* pDir );
+EBool          IsGeneratedCodeCurrent( const char* pInputName );
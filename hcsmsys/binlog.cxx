@@ -0,0 +1,624 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: binlog.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:         October, 2026
+// Description:  Implementation of the binary, column oriented recorder
+//   and of the converter that reproduces the old text logs.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+
+#include <map>
+#include <fstream>
+#include <iostream>
+
+#include "binlog.h"
+
+// Provide consistency in error messages
+static const char s_Pre[] = "Binary Log";
+
+//
+// Describes the columns of a block.  Integer columns that are mostly
+// monotonic (frame, object id) are delta encoded before shuffling.
+//
+struct TBinLogColumn {
+	int   m_offset;
+	int   m_size;
+	bool  m_delta;
+};
+
+static const TBinLogColumn s_Columns[] = {
+	{ offsetof(TBinLogRec, m_frame),      sizeof(int),    true  },
+	{ offsetof(TBinLogRec, m_kind),       sizeof(int),    false },
+	{ offsetof(TBinLogRec, m_objId),      sizeof(int),    true  },
+	{ offsetof(TBinLogRec, m_hcsmTypeId), sizeof(int),    false },
+	{ offsetof(TBinLogRec, m_solId),      sizeof(int),    false },
+	{ offsetof(TBinLogRec, m_hcsmId),     sizeof(int),    false },
+	{ offsetof(TBinLogRec, m_pos),        sizeof(double), false },
+	{ offsetof(TBinLogRec, m_pos) + sizeof(double),     sizeof(double), false },
+	{ offsetof(TBinLogRec, m_pos) + 2 * sizeof(double), sizeof(double), false },
+	{ offsetof(TBinLogRec, m_tan),        sizeof(double), false },
+	{ offsetof(TBinLogRec, m_tan) + sizeof(double),     sizeof(double), false },
+	{ offsetof(TBinLogRec, m_tan) + 2 * sizeof(double), sizeof(double), false },
+	{ offsetof(TBinLogRec, m_lat),        sizeof(double), false },
+	{ offsetof(TBinLogRec, m_lat) + sizeof(double),     sizeof(double), false },
+	{ offsetof(TBinLogRec, m_lat) + 2 * sizeof(double), sizeof(double), false },
+};
+static const int cNUM_COLUMNS = sizeof(s_Columns) / sizeof(s_Columns[0]);
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Appends one column of the records to the output buffer.  The bytes of
+// each value are shuffled so that byte k of every value is stored
+// together; this groups the slowly changing high order bytes and makes
+// the run-length compression effective.
+//
+static void
+PackColumn(
+	const TBinLogRec*      cpRecs,
+	int                    numRecs,
+	const TBinLogColumn&   cCol,
+	vector<unsigned char>& out
+	)
+{
+	size_t base = out.size();
+	out.resize( base + numRecs * cCol.m_size );
+
+	int prev = 0;
+	for ( int i = 0; i < numRecs; i++ ) {
+		const unsigned char* pSrc =
+			reinterpret_cast<const unsigned char*>( &cpRecs[i] ) + cCol.m_offset;
+		unsigned char val[sizeof(double)];
+
+		if ( cCol.m_delta ) {
+			int cur;
+			memcpy( &cur, pSrc, sizeof(int) );
+			int diff = cur - prev;
+			prev     = cur;
+			memcpy( val, &diff, sizeof(int) );
+		}
+		else {
+			memcpy( val, pSrc, cCol.m_size );
+		}
+
+		for ( int b = 0; b < cCol.m_size; b++ ) {
+			out[base + b * numRecs + i] = val[b];
+		}
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// The inverse of PackColumn; fills one column of the records from the
+// input buffer and returns the number of bytes consumed.
+//
+static int
+UnpackColumn(
+	const unsigned char*   cpIn,
+	int                    numRecs,
+	const TBinLogColumn&   cCol,
+	TBinLogRec*            pRecs
+	)
+{
+	int prev = 0;
+	for ( int i = 0; i < numRecs; i++ ) {
+		unsigned char val[sizeof(double)];
+		for ( int b = 0; b < cCol.m_size; b++ ) {
+			val[b] = cpIn[b * numRecs + i];
+		}
+
+		unsigned char* pDst =
+			reinterpret_cast<unsigned char*>( &pRecs[i] ) + cCol.m_offset;
+		if ( cCol.m_delta ) {
+			int diff;
+			memcpy( &diff, val, sizeof(int) );
+			prev += diff;
+			memcpy( pDst, &prev, sizeof(int) );
+		}
+		else {
+			memcpy( pDst, val, cCol.m_size );
+		}
+	}
+
+	return numRecs * cCol.m_size;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Run-length compression.  Each packet starts with a control byte; if the
+// high bit is set the next byte is repeated (c & 0x7F) + 3 times, otherwise
+// c + 1 literal bytes follow.
+//
+static void
+Compress( const vector<unsigned char>& cIn, vector<unsigned char>& out )
+{
+	out.clear();
+
+	size_t n = cIn.size();
+	size_t i = 0;
+	while ( i < n ) {
+		size_t run = 1;
+		while ( i + run < n && run < 130 && cIn[i + run] == cIn[i] ) run++;
+
+		if ( run >= 3 ) {
+			out.push_back( (unsigned char)(0x80 | (run - 3)) );
+			out.push_back( cIn[i] );
+			i += run;
+			continue;
+		}
+
+		size_t start = i;
+		size_t len   = 0;
+		while ( i < n && len < 128 ) {
+			if ( i + 2 < n && cIn[i] == cIn[i + 1] && cIn[i] == cIn[i + 2] ) {
+				break;
+			}
+			i++;
+			len++;
+		}
+		out.push_back( (unsigned char)(len - 1) );
+		out.insert( out.end(), cIn.begin() + start, cIn.begin() + start + len );
+	}
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Inverse of Compress.  Returns false if the input is malformed.
+//
+static bool
+Decompress(
+	const vector<unsigned char>& cIn,
+	size_t                       rawSize,
+	vector<unsigned char>&       out
+	)
+{
+	out.clear();
+	out.reserve( rawSize );
+
+	size_t i = 0;
+	while ( i < cIn.size() ) {
+		unsigned char c = cIn[i++];
+		if ( c & 0x80 ) {
+			if ( i >= cIn.size() ) return false;
+			out.insert( out.end(), (size_t)(c & 0x7F) + 3, cIn[i++] );
+		}
+		else {
+			size_t len = (size_t)c + 1;
+			if ( i + len > cIn.size() ) return false;
+			out.insert( out.end(), cIn.begin() + i, cIn.begin() + i + len );
+			i += len;
+		}
+	}
+
+	return out.size() == rawSize;
+}
+
+
+CBinLogRecorder::CBinLogRecorder()
+	: m_pFile( 0 ), m_head( 0 ), m_tail( 0 ), m_quit( false )
+{
+}
+
+CBinLogRecorder::~CBinLogRecorder()
+{
+	Close();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Opens the output file and starts the writer thread.  All block memory
+// is allocated here so that logging does not allocate during the run.
+//
+// Returns:
+// True if everything was ok or false otherwise.  In case of errors, error
+// messages are printed to stderr.
+//
+bool
+CBinLogRecorder::Open( const string& cFileName, const string& cVerLogName )
+{
+	Close();
+
+	m_pFile = fopen( cFileName.c_str(), "wb" );
+	if ( m_pFile == 0 ) {
+		fprintf(
+			stderr,
+			"%s: Can't open file %s to store output: %s\n",
+			s_Pre,
+			cFileName.c_str(),
+			strerror(errno)
+			);
+
+		return false;
+	}
+
+	TBinLogFileHeader hdr;
+	memset( &hdr, 0, sizeof(hdr) );
+	hdr.m_magic     = cBLOG_MAGIC;
+	hdr.m_version   = cBLOG_VERSION;
+	hdr.m_blockRecs = cBLOG_BLOCK_RECS;
+	strncpy( hdr.m_verLogName, cVerLogName.c_str(), cBLOG_MAX_NAME_SIZE - 1 );
+	fwrite( &hdr, sizeof(hdr), 1, m_pFile );
+
+	for ( int i = 0; i < cBLOG_NUM_BLOCKS; i++ ) {
+		m_blocks[i].m_recs.clear();
+		m_blocks[i].m_recs.reserve( cBLOG_BLOCK_RECS );
+		m_blocks[i].m_names.clear();
+		m_blocks[i].m_names.reserve( 4 * 1024 );
+	}
+	m_raw.reserve( cBLOG_BLOCK_RECS * sizeof(TBinLogRec) );
+	m_comp.reserve( cBLOG_BLOCK_RECS * sizeof(TBinLogRec) );
+	m_lastNames.clear();
+
+	m_head   = 0;
+	m_tail   = 0;
+	m_quit   = false;
+	m_writer = thread( &CBinLogRecorder::WriterMain, this );
+
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Flushes the partially filled block, waits for the writer thread to
+// drain the ring and closes the file.
+//
+void
+CBinLogRecorder::Close( void )
+{
+	if ( m_pFile == 0 ) return;
+
+	if ( !m_blocks[m_head % cBLOG_NUM_BLOCKS].m_recs.empty() ) {
+		SubmitCurBlock();
+	}
+
+	{
+		lock_guard<mutex> lk( m_lock );
+		m_quit = true;
+	}
+	m_fullCond.notify_one();
+	m_writer.join();
+
+	TBinLogBlockHeader end;
+	memset( &end, 0, sizeof(end) );
+	fwrite( &end, sizeof(end), 1, m_pFile );
+
+	fclose( m_pFile );
+	m_pFile = 0;
+}
+
+
+TBinLogRec&
+CBinLogRecorder::NewRec( int frame, EBinLogRecKind kind, int objId )
+{
+	if ( m_blocks[m_head % cBLOG_NUM_BLOCKS].m_recs.size() >= cBLOG_BLOCK_RECS ) {
+		SubmitCurBlock();
+	}
+
+	TBlock& block = m_blocks[m_head % cBLOG_NUM_BLOCKS];
+	block.m_recs.resize( block.m_recs.size() + 1 );
+
+	TBinLogRec& rec = block.m_recs.back();
+	memset( &rec, 0, sizeof(rec) );
+	rec.m_frame = frame;
+	rec.m_kind  = kind;
+	rec.m_objId = objId;
+
+	return rec;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Hands the block being filled to the writer and moves to the next block
+// of the ring.  Only waits if the writer has fallen a whole ring behind.
+//
+void
+CBinLogRecorder::SubmitCurBlock( void )
+{
+	{
+		unique_lock<mutex> lk( m_lock );
+		m_head++;
+		m_fullCond.notify_one();
+		while ( m_head - m_tail >= (unsigned int)cBLOG_NUM_BLOCKS ) {
+			m_freeCond.wait( lk );
+		}
+	}
+
+	TBlock& block = m_blocks[m_head % cBLOG_NUM_BLOCKS];
+	block.m_recs.clear();
+	block.m_names.clear();
+}
+
+
+void
+CBinLogRecorder::WriterMain( void )
+{
+	unique_lock<mutex> lk( m_lock );
+	for ( ;; ) {
+		while ( m_tail == m_head && !m_quit ) {
+			m_fullCond.wait( lk );
+		}
+		if ( m_tail == m_head ) break;
+
+		TBlock& block = m_blocks[m_tail % cBLOG_NUM_BLOCKS];
+		lk.unlock();
+		WriteBlock( block );
+		lk.lock();
+
+		m_tail++;
+		m_freeCond.notify_one();
+	}
+}
+
+
+void
+CBinLogRecorder::WriteBlock( TBlock& block )
+{
+	int numRecs = (int)block.m_recs.size();
+
+	m_raw.clear();
+	for ( int c = 0; c < cNUM_COLUMNS; c++ ) {
+		PackColumn( &block.m_recs[0], numRecs, s_Columns[c], m_raw );
+	}
+	m_raw.insert( m_raw.end(), block.m_names.begin(), block.m_names.end() );
+
+	Compress( m_raw, m_comp );
+
+	TBinLogBlockHeader hdr;
+	hdr.m_numRecs  = numRecs;
+	hdr.m_rawSize  = (int)m_raw.size();
+	hdr.m_compSize = (int)m_comp.size();
+	fwrite( &hdr, sizeof(hdr), 1, m_pFile );
+	fwrite( &m_comp[0], 1, m_comp.size(), m_pFile );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Records the name of an object.  Names are only stored when they differ
+// from the last name recorded for the same id, so this can be called every
+// frame for every object.
+//
+void
+CBinLogRecorder::LogObjName( int frame, int objId, const char* cpName )
+{
+	if ( objId < 0 ) return;
+	if ( objId >= (int)m_lastNames.size() ) m_lastNames.resize( objId + 1 );
+	if ( m_lastNames[objId] == cpName ) return;
+
+	m_lastNames[objId] = cpName;
+	NewRec( frame, eBLOG_NAME, objId );
+
+	string& names = m_blocks[m_head % cBLOG_NUM_BLOCKS].m_names;
+	names.append( cpName );
+	names.push_back( '\0' );
+}
+
+void
+CBinLogRecorder::LogOpen( int frame, int objId, const char* cpName )
+{
+	LogObjName( frame, objId, cpName );
+	NewRec( frame, eBLOG_OPEN, objId );
+}
+
+void
+CBinLogRecorder::LogClose( int frame, int objId )
+{
+	NewRec( frame, eBLOG_CLOSE, objId );
+}
+
+void
+CBinLogRecorder::LogPos( int frame, int objId, double x, double y, double z )
+{
+	TBinLogRec& rec = NewRec( frame, eBLOG_POS, objId );
+	rec.m_pos[0] = x;
+	rec.m_pos[1] = y;
+	rec.m_pos[2] = z;
+}
+
+void
+CBinLogRecorder::LogVerFrame( int frame, int numObjs )
+{
+	NewRec( frame, eBLOG_VER_FRAME, numObjs );
+}
+
+void
+CBinLogRecorder::LogVerObj(
+	int          frame,
+	int          objId,
+	int          hcsmTypeId,
+	int          solId,
+	int          hcsmId,
+	const double pos[3],
+	const double tan[3],
+	const double lat[3]
+	)
+{
+	TBinLogRec& rec = NewRec( frame, eBLOG_VER_OBJ, objId );
+	rec.m_hcsmTypeId = hcsmTypeId;
+	rec.m_solId      = solId;
+	rec.m_hcsmId     = hcsmId;
+	memcpy( rec.m_pos, pos, sizeof(rec.m_pos) );
+	memcpy( rec.m_tan, tan, sizeof(rec.m_tan) );
+	memcpy( rec.m_lat, lat, sizeof(rec.m_lat) );
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Reads a binary log and writes the text files hcsmsys used to produce
+// directly: one NAME_ID.log file per logged object and, if verification
+// records are present, the verification log under the name given to
+// -vlog when the file was recorded.
+//
+// Returns:
+// True if everything was ok or false otherwise.  In case of errors, error
+// messages are printed to stderr.
+//
+bool
+ConvertBinLog( const string& cFileName, bool verbose )
+{
+	FILE* pF = fopen( cFileName.c_str(), "rb" );
+	if ( pF == 0 ) {
+		fprintf(
+			stderr,
+			"%s: Can't open file %s: %s\n",
+			s_Pre,
+			cFileName.c_str(),
+			strerror(errno)
+			);
+		return false;
+	}
+
+	TBinLogFileHeader hdr;
+	if ( fread( &hdr, sizeof(hdr), 1, pF ) != 1 || hdr.m_magic != cBLOG_MAGIC ) {
+		fprintf( stderr, "%s: %s is not a binary log.\n", s_Pre, cFileName.c_str() );
+		fclose( pF );
+		return false;
+	}
+	if ( hdr.m_version != cBLOG_VERSION ) {
+		fprintf(
+			stderr,
+			"%s: %s has version %d, expected %d.\n",
+			s_Pre,
+			cFileName.c_str(),
+			hdr.m_version,
+			cBLOG_VERSION
+			);
+		fclose( pF );
+		return false;
+	}
+	hdr.m_verLogName[cBLOG_MAX_NAME_SIZE - 1] = '\0';
+
+	FILE*                  pVerLog = 0;
+	map<int, ofstream*>    logs;
+	map<int, string>       names;
+	vector<unsigned char>  comp;
+	vector<unsigned char>  raw;
+	vector<TBinLogRec>     recs;
+	bool                   ok = true;
+
+	for ( ;; ) {
+		TBinLogBlockHeader blk;
+		if ( fread( &blk, sizeof(blk), 1, pF ) != 1 ) {
+			fprintf( stderr, "%s: premature end of file.\n", s_Pre );
+			ok = false;
+			break;
+		}
+		if ( blk.m_numRecs == 0 ) break;
+
+		comp.resize( blk.m_compSize );
+		if ( fread( &comp[0], 1, blk.m_compSize, pF ) != (size_t)blk.m_compSize
+			|| !Decompress( comp, blk.m_rawSize, raw ) ) {
+			fprintf( stderr, "%s: corrupt block.\n", s_Pre );
+			ok = false;
+			break;
+		}
+
+		recs.assign( blk.m_numRecs, TBinLogRec() );
+		int used = 0;
+		for ( int c = 0; c < cNUM_COLUMNS; c++ ) {
+			used += UnpackColumn( &raw[used], blk.m_numRecs, s_Columns[c], &recs[0] );
+		}
+		const char* pNextName = reinterpret_cast<const char*>( &raw[0] ) + used;
+
+		for ( int i = 0; i < blk.m_numRecs; i++ ) {
+			const TBinLogRec& rec = recs[i];
+
+			switch ( rec.m_kind ) {
+			case eBLOG_NAME:
+				names[rec.m_objId] = pNextName;
+				pNextName += strlen( pNextName ) + 1;
+				break;
+
+			case eBLOG_OPEN:
+				{
+					char fileName[cBLOG_MAX_NAME_SIZE];
+					sprintf( fileName, "%.200s_%d.log",
+						names[rec.m_objId].c_str(), rec.m_objId );
+					if ( verbose ) {
+						cout << "HCSM Logger: opening log file " << fileName << endl;
+					}
+
+					delete logs[rec.m_objId];
+					logs[rec.m_objId] = new ofstream( fileName );
+				}
+				break;
+
+			case eBLOG_CLOSE:
+				{
+					map<int, ofstream*>::iterator p = logs.find( rec.m_objId );
+					if ( p != logs.end() ) {
+						delete p->second;
+						logs.erase( p );
+					}
+				}
+				break;
+
+			case eBLOG_POS:
+				{
+					map<int, ofstream*>::iterator p = logs.find( rec.m_objId );
+					if ( p != logs.end() ) {
+						*p->second << rec.m_pos[0] << " " << rec.m_pos[1] << " "
+							<< rec.m_pos[2] << endl;
+					}
+				}
+				break;
+
+			case eBLOG_VER_FRAME:
+				if ( pVerLog == 0 ) {
+					pVerLog = fopen( hdr.m_verLogName, "w" );
+					if ( pVerLog == 0 ) {
+						perror( "Can't open output verification log file" );
+						ok = false;
+						break;
+					}
+				}
+				fprintf( pVerLog, "Frm: %d %d\n", rec.m_frame, rec.m_objId );
+				break;
+
+			case eBLOG_VER_OBJ:
+				if ( pVerLog == 0 ) break;
+				fprintf( pVerLog, "%s %d %d %d %d\n",
+					names[rec.m_objId].c_str(), rec.m_objId, rec.m_hcsmTypeId,
+					rec.m_solId, rec.m_hcsmId );
+				fprintf( pVerLog, "%-9.2f %-9.2f %-9.2f %-7.4f %-7.4f %-7.4f %-7.4f %-7.4f %-7.4f\n",
+					rec.m_pos[0], rec.m_pos[1], rec.m_pos[2],
+					rec.m_tan[0], rec.m_tan[1], rec.m_tan[2],
+					rec.m_lat[0], rec.m_lat[1], rec.m_lat[2] );
+				break;
+
+			default:
+				fprintf( stderr, "%s: unknown record kind %d.\n", s_Pre, rec.m_kind );
+				ok = false;
+				break;
+			}
+		}
+
+		if ( !ok ) break;
+	}
+
+	map<int, ofstream*>::iterator p;
+	for ( p = logs.begin(); p != logs.end(); p++ ) {
+		delete p->second;
+	}
+	if ( pVerLog )  fclose( pVerLog );
+	fclose( pF );
+
+	return ok;
+}
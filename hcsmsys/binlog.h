@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: binlog.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:         October, 2026
+// Description:  Interface for the binary, column oriented recorder that
+//   replaces the per-object text logs (-log) and the verification log
+//   (-vlog) of hcsmsys.
+//
+// The recorder appends fixed layout records to a ring of blocks.  When a
+// block fills up it is handed to a background thread which transposes it
+// into columns, delta encodes the integer columns, byte shuffles all
+// columns and run-length compresses the result before writing it to disk.
+// The frame thread therefore only pays for a memcpy sized record append.
+//
+// File layout:
+//     TBinLogFileHeader
+//     TBinLogBlockHeader, compressed payload
+//     TBinLogBlockHeader, compressed payload
+//     ...
+//     end marker (a block header with m_numRecs == 0)
+//
+// The payload of a block, once decompressed, contains one column per
+// field of TBinLogRec followed by the names referenced by eBLOG_NAME
+// records, each terminated by a 0.
+//
+// The ConvertBinLog function reads a file and produces the text files
+// that hcsmsys used to write directly, so existing verification scripts
+// keep working.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _BINLOG_H_
+#define _BINLOG_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+// Increment when the record or block layout changes
+const int cBLOG_VERSION       = 1;
+const int cBLOG_MAGIC         = 0xB106B106;
+const int cBLOG_BLOCK_RECS    = 4096;	// records per block
+const int cBLOG_NUM_BLOCKS    = 8;		// blocks in the ring
+const int cBLOG_MAX_NAME_SIZE = 256;
+
+// The kinds of records that can appear in the file
+enum EBinLogRecKind {
+	eBLOG_NAME = 0,		// name of object m_objId; string is in name table
+	eBLOG_OPEN,			// start a per-object text log for m_objId
+	eBLOG_CLOSE,		// end the per-object text log for m_objId
+	eBLOG_POS,			// per-object log sample, m_pos is valid
+	eBLOG_VER_FRAME,	// verification frame, m_objId holds object count
+	eBLOG_VER_OBJ		// verification sample, all fields valid
+};
+
+// Fixed layout record; every kind uses the same layout so the frame thread
+// never has to size anything.  Unused fields are zero and cost almost
+// nothing once compressed.
+struct TBinLogRec {
+	int     m_frame;
+	int     m_kind;
+	int     m_objId;
+	int     m_hcsmTypeId;
+	int     m_solId;
+	int     m_hcsmId;
+	double  m_pos[3];
+	double  m_tan[3];
+	double  m_lat[3];
+};
+
+struct TBinLogFileHeader {
+	int     m_magic;
+	int     m_version;
+	int     m_blockRecs;
+	char    m_verLogName[cBLOG_MAX_NAME_SIZE];	// text name used for -vlog
+};
+
+struct TBinLogBlockHeader {
+	int     m_numRecs;			// number of records in the block
+	int     m_rawSize;			// size of the payload before compression
+	int     m_compSize;			// size of the payload as stored
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Records per-object and verification data into a compressed binary file.
+// All Log* functions are meant to be called from the frame thread only.
+//
+class CBinLogRecorder
+{
+public:
+	CBinLogRecorder();
+	~CBinLogRecorder();
+
+	bool Open( const string& cFileName, const string& cVerLogName );
+	void Close( void );
+	bool IsOpen( void ) const { return m_pFile != 0; };
+
+	void LogObjName( int frame, int objId, const char* cpName );
+	void LogOpen( int frame, int objId, const char* cpName );
+	void LogClose( int frame, int objId );
+	void LogPos( int frame, int objId, double x, double y, double z );
+	void LogVerFrame( int frame, int numObjs );
+	void LogVerObj(
+				int frame,
+				int objId,
+				int hcsmTypeId,
+				int solId,
+				int hcsmId,
+				const double pos[3],
+				const double tan[3],
+				const double lat[3]
+				);
+
+private:
+	struct TBlock {
+		vector<TBinLogRec>  m_recs;
+		string              m_names;
+	};
+
+	TBinLogRec& NewRec( int frame, EBinLogRecKind kind, int objId );
+	void        SubmitCurBlock( void );
+	void        WriterMain( void );
+	void        WriteBlock( TBlock& );
+
+	FILE*               m_pFile;
+	TBlock              m_blocks[cBLOG_NUM_BLOCKS];
+	vector<string>      m_lastNames;	// last name logged for each object id
+
+	// Blocks [m_tail, m_head) are full and waiting for the writer; block
+	// m_head is being filled by the frame thread.
+	unsigned int        m_head;
+	unsigned int        m_tail;
+	bool                m_quit;
+	mutex               m_lock;
+	condition_variable  m_fullCond;
+	condition_variable  m_freeCond;
+	thread              m_writer;
+
+	vector<unsigned char> m_raw;	// writer scratch buffers, reused
+	vector<unsigned char> m_comp;
+
+	CBinLogRecorder( const CBinLogRecorder& );
+	CBinLogRecorder& operator=( const CBinLogRecorder& );
+};
+
+bool ConvertBinLog( const string& cFileName, bool verbose );
+
+#endif // _BINLOG_H_
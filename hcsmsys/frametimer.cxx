@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: frametimer.cxx,v 1.1 $
+//
+// Author(s):
+//
+// Date:         October, 2026
+// Description:  Implementation of the per-phase frame timing of hcsmsys.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "frametimer.h"
+
+static const char* s_PhaseNames[cNUM_FRAME_PHASES] = {
+	"Dynamics step",
+	"Behaviors",
+	"Debug dump",
+	"Maintainer",
+	"Verification log",
+	"Audio",
+	"Frame",
+};
+
+//
+// Bins 0 to cHIST_SUB_SIZE-1 hold one nanosecond each.  After that each
+// power of two is split into cHIST_SUB_SIZE bins of equal width.
+//
+static int
+BinOf( long long v )
+{
+	if ( v < cHIST_SUB_SIZE ) return v < 0 ? 0 : (int) v;
+
+	int exp = cHIST_SUB_BITS;
+	while ( exp < cHIST_MAX_EXP && ( v >> ( exp + 1 ) ) != 0 ) exp++;
+	if ( ( v >> ( exp + 1 ) ) != 0 ) return cHIST_NUM_BINS - 1;
+
+	int sub = (int) ( v >> ( exp - cHIST_SUB_BITS ) ) & ( cHIST_SUB_SIZE - 1 );
+	return ( exp - cHIST_SUB_BITS + 1 ) * cHIST_SUB_SIZE + sub;
+}
+
+// Returns the exclusive upper edge of a bin
+static long long
+BinTop( int bin )
+{
+	if ( bin < cHIST_SUB_SIZE ) return bin + 1;
+
+	int       exp   = bin / cHIST_SUB_SIZE + cHIST_SUB_BITS - 1;
+	int       sub   = bin % cHIST_SUB_SIZE;
+	long long width = 1LL << ( exp - cHIST_SUB_BITS );
+	return ( cHIST_SUB_SIZE + sub ) * width + width;
+}
+
+void
+CPhaseHistogram::Reset( void )
+{
+	memset( m_bins, 0, sizeof(m_bins) );
+	m_count = 0;
+	m_sum   = 0;
+	m_max   = 0;
+}
+
+void
+CPhaseHistogram::Record( long long nanoSecs )
+{
+	m_bins[BinOf( nanoSecs )]++;
+	m_count++;
+	m_sum += nanoSecs;
+	if ( nanoSecs > m_max ) m_max = nanoSecs;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the duration, in milliseconds, below which the
+//  given fraction of the recorded durations fall.
+//
+// Remarks: The value is the upper edge of the bin holding the percentile,
+//  capped to the largest recorded duration, so it errs on the high side.
+//
+// Arguments:
+//  pct - the percentile, between 0 and 100
+//
+//////////////////////////////////////////////////////////////////////////////
+double
+CPhaseHistogram::Percentile( double pct ) const
+{
+	if ( m_count == 0 ) return 0.0;
+
+	long long rank = (long long) ( pct / 100.0 * m_count + 0.5 );
+	if ( rank < 1 ) rank = 1;
+	if ( rank > m_count ) rank = m_count;
+
+	long long seen = 0;
+	for ( int bin = 0; bin < cHIST_NUM_BINS; bin++ ) {
+		seen += m_bins[bin];
+		if ( seen >= rank ) {
+			long long top = BinTop( bin );
+			return ( top < m_max ? top : m_max ) * 1.0e-6;
+		}
+	}
+	return GetMaxMs();
+}
+
+
+CFrameTimer::CFrameTimer()
+{
+	Start( 0.0, 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Clears all histograms and starts timing a run.
+//
+// Arguments:
+//  frameBudgetSecs - frames whose work takes longer count as overruns
+//  reportIntrvl    - frames between periodic reports, 0 for none
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CFrameTimer::Start( double frameBudgetSecs, int reportIntrvl )
+{
+	for ( int i = 0; i < cNUM_FRAME_PHASES; i++ ) {
+		m_total[i].Reset();
+		m_intrvl[i].Reset();
+	}
+	m_budgetNanoSecs   = (long long) ( frameBudgetSecs * 1.0e9 );
+	m_reportIntrvl     = reportIntrvl;
+	m_overruns         = 0;
+	m_intrvlOverruns   = 0;
+	m_intrvlFirstFrame = 0;
+	m_runStart         = Now();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Records the time elapsed since the given time point for
+//  a phase.
+//
+// Returns: The current time, so consecutive phases can be chained
+//  without reading the clock twice.
+//
+//////////////////////////////////////////////////////////////////////////////
+TFrameTime
+CFrameTimer::Record( EFramePhase phase, TFrameTime since )
+{
+	TFrameTime now = Now();
+	long long  ns  = chrono::duration_cast<chrono::nanoseconds>( now - since ).count();
+	m_total[phase].Record( ns );
+	m_intrvl[phase].Record( ns );
+	return now;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Records the frame time, counts overruns of the frame
+//  budget and prints the periodic report when an interval completes.
+//
+// Arguments:
+//  frame      - the frame that just finished
+//  frameStart - the time the frame started
+//  pOut       - where the periodic report goes
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CFrameTimer::EndFrame( int frame, TFrameTime frameStart, FILE* pOut )
+{
+	TFrameTime now = Record( ePHASE_FRAME, frameStart );
+	long long  ns  = chrono::duration_cast<chrono::nanoseconds>( now - frameStart ).count();
+	if ( m_budgetNanoSecs > 0 && ns > m_budgetNanoSecs ) {
+		m_overruns++;
+		m_intrvlOverruns++;
+	}
+
+	if ( m_reportIntrvl > 0 && ( frame + 1 - m_intrvlFirstFrame ) >= m_reportIntrvl ) {
+		fprintf( pOut, "--- Timing for frames %d to %d ---\n",
+			m_intrvlFirstFrame, frame );
+		Report( pOut, false );
+		for ( int i = 0; i < cNUM_FRAME_PHASES; i++ ) m_intrvl[i].Reset();
+		m_intrvlOverruns   = 0;
+		m_intrvlFirstFrame = frame + 1;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Prints the percentiles of each phase and the overruns.
+//
+// Arguments:
+//  pOut  - where the report goes
+//  total - true for the whole run, false for the current interval
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CFrameTimer::Report( FILE* pOut, bool total ) const
+{
+	const CPhaseHistogram* cpHists = total ? m_total : m_intrvl;
+
+	fprintf( pOut, "%-18s %9s %9s %8s %8s %8s %8s %8s\n",
+		"Phase (mSec)", "count", "mean", "p50", "p90", "p99", "p99.9", "max" );
+	for ( int i = 0; i < cNUM_FRAME_PHASES; i++ ) {
+		const CPhaseHistogram& hist = cpHists[i];
+		if ( hist.GetCount() == 0 ) continue;
+		fprintf( pOut, "%-18s %9lld %9.3f %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+			s_PhaseNames[i], hist.GetCount(), hist.GetMeanMs(),
+			hist.Percentile( 50.0 ), hist.Percentile( 90.0 ),
+			hist.Percentile( 99.0 ), hist.Percentile( 99.9 ),
+			hist.GetMaxMs() );
+	}
+
+	long long frames   = cpHists[ePHASE_FRAME].GetCount();
+	long long overruns = total ? m_overruns : m_intrvlOverruns;
+	fprintf( pOut, "Frame budget %.3f mSec, overruns: %lld of %lld (%.2f%%)\n",
+		m_budgetNanoSecs * 1.0e-6, overruns, frames,
+		frames ? 100.0 * overruns / frames : 0.0 );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Prints the totals of the run as one comma separated line:
+//  name, behaviors, maintainer, dynamics, overhead and wall-clock
+//  seconds.
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CFrameTimer::ReportCsv( FILE* pOut, const char* cpName ) const
+{
+	fprintf( pOut, "%s,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+		cpName,
+		GetPhaseSecs( ePHASE_BEHAVIORS ),
+		GetPhaseSecs( ePHASE_MAINTAINER ),
+		GetPhaseSecs( ePHASE_DYNAMICS ),
+		GetOverheadSecs(),
+		GetRunSecs() );
+}
+
+double
+CFrameTimer::GetRunSecs( void ) const
+{
+	return chrono::duration<double>( Now() - m_runStart ).count();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the wall-clock time of the run not spent in any of
+//  the timed phases of the frame thread.
+//
+//////////////////////////////////////////////////////////////////////////////
+double
+CFrameTimer::GetOverheadSecs( void ) const
+{
+	double busy = 0.0;
+	for ( int i = 0; i < ePHASE_FRAME; i++ ) {
+		busy += m_total[i].GetTotalSecs();
+	}
+	return GetRunSecs() - busy;
+}
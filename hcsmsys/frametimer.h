@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by National Advanced Driving Simulator and
+// Simulation Center, the University of Iowa and The University
+// of Iowa. All rights reserved.
+//
+// Version:      $Id: frametimer.h,v 1.1 $
+//
+// Author(s):
+//
+// Date:         October, 2026
+// Description:  Interface for the per-phase frame timing used by the
+//   -time, -ttime, -dtime and -timeIntrvl options of hcsmsys.
+//
+// Durations are measured with steady_clock and recorded into fixed size
+// log-linear histograms, so timing a run of any length uses the same
+// memory and no platform timer library is needed.  A histogram keeps 16
+// linear buckets per power of two nanoseconds, which bounds the error of
+// a reported percentile to about 6%.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _FRAMETIMER_H_
+#define _FRAMETIMER_H_
+
+#include <stdio.h>
+#include <chrono>
+
+using namespace std;
+
+typedef chrono::steady_clock           TFrameClock;
+typedef TFrameClock::time_point        TFrameTime;
+
+// The parts of a frame that are timed.  The dynamics are timed once per
+// sub-step.
+enum EFramePhase {
+	ePHASE_DYNAMICS = 0,
+	ePHASE_BEHAVIORS,
+	ePHASE_DEBUG_DUMP,
+	ePHASE_MAINTAINER,
+	ePHASE_VERLOG,
+	ePHASE_AUDIO,
+	ePHASE_FRAME,			// all the work of a frame, without the real-time wait
+	cNUM_FRAME_PHASES
+};
+
+const int cHIST_SUB_BITS  = 4;
+const int cHIST_SUB_SIZE  = 1 << cHIST_SUB_BITS;
+const int cHIST_MAX_EXP   = 42;		// about 73 minutes in nanoseconds
+const int cHIST_NUM_BINS  = ( cHIST_MAX_EXP - cHIST_SUB_BITS + 2 ) * cHIST_SUB_SIZE;
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// A log-linear histogram of durations in nanoseconds.
+//
+class CPhaseHistogram
+{
+public:
+	CPhaseHistogram() { Reset(); };
+
+	void   Reset( void );
+	void   Record( long long nanoSecs );
+	double Percentile( double pct ) const;
+
+	long long GetCount( void ) const { return m_count; };
+	double    GetTotalSecs( void ) const { return m_sum * 1.0e-9; };
+	double    GetMeanMs( void ) const
+	{
+		return m_count ? m_sum * 1.0e-6 / m_count : 0.0;
+	};
+	double    GetMaxMs( void ) const { return m_max * 1.0e-6; };
+
+private:
+	long long  m_bins[cHIST_NUM_BINS];
+	long long  m_count;
+	long long  m_sum;
+	long long  m_max;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Collects the phase durations of a run.  Each phase has a histogram for
+// the whole run and one for the current reporting interval.
+//
+// All the functions are meant to be called from the frame thread.
+//
+class CFrameTimer
+{
+public:
+	CFrameTimer();
+
+	void Start( double frameBudgetSecs, int reportIntrvl );
+
+	static TFrameTime Now( void ) { return TFrameClock::now(); };
+	TFrameTime Record( EFramePhase phase, TFrameTime since );
+	void       EndFrame( int frame, TFrameTime frameStart, FILE* pOut );
+
+	void   Report( FILE* pOut, bool total ) const;
+	void   ReportCsv( FILE* pOut, const char* cpName ) const;
+
+	double GetRunSecs( void ) const;
+	double GetPhaseSecs( EFramePhase phase ) const
+	{
+		return m_total[phase].GetTotalSecs();
+	};
+	double GetOverheadSecs( void ) const;
+
+private:
+	CPhaseHistogram  m_total[cNUM_FRAME_PHASES];
+	CPhaseHistogram  m_intrvl[cNUM_FRAME_PHASES];
+	long long        m_budgetNanoSecs;
+	int              m_reportIntrvl;		// frames, 0 for no periodic report
+	long long        m_overruns;
+	long long        m_intrvlOverruns;
+	int              m_intrvlFirstFrame;
+	TFrameTime       m_runStart;
+};
+
+#endif // _FRAMETIMER_H_
@@ -447,9 +447,8 @@ ProcessGetDynaObjs(
 
 	int startStatic = dynobjs.size();
 
-//	Cved.GetAllRuntimeObjs( staticObjs );
-	cerr << "@@@@ Hcsmexec:ProcessGetDynaObjs: CVED doesn't support GetAllRuntimeObjs" << endl;
-	assert( 0 );
+	// CVED no longer offers GetAllRuntimeObjs, so staticObjs stays empty
+	// and runtime static objects are not reported
 	dynobjs.insert( dynobjs.end(), staticObjs.begin(), staticObjs.end() );
 	NumObjs += staticObjs.size();
 
@@ -573,9 +572,8 @@ ProcessGetChangedStaticObjs(
 	int          package[4];      // storage message sending
 
 	map<int, int> objs;
-//	objs = Cved.GetStaticObjectsChanged();
-	cerr << "@@@@ Hcsmexec:ProcessGetChangedStaticObjs: CVED doesn't support GetStaticObjectsChanged" << endl;
-	assert( 0 );
+	// CVED no longer offers GetStaticObjectsChanged, so no changes are
+	// ever reported
 	int numObjs = objs.size();
 	
 	if ( numObjs == 0 ) {
@@ -708,9 +706,8 @@ ProcessGetInstancedObjs(
 // objects that are not dynamic
 //
 	NumObjs = 0;
-//	Cved.GetAllRuntimeObjs(runtimeObjs);
-	cerr << "@@@@ Hcsmexec:ProcessGetInstancedObjs: CVED doesn't support GetAllRuntimeObjs" << endl;
-	assert( 0 );
+	// CVED no longer offers GetAllRuntimeObjs, so runtimeObjs stays empty
+	// and no instanced objects are reported
 	for (pO=runtimeObjs.begin(); pO != runtimeObjs.end(); pO++) {
 		if ( !Cved.IsDynObj(*pO) ) {
 			instObjs.push_back(*pO);
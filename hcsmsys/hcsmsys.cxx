@@ -16,7 +16,9 @@
 
 #include <cvedpub.h>
 #include <hcsmcollection.h>
+#include <hcsmcheckpoint.h>
 #include <hcsmspec.h>
+#include <collisionbroadphase.h>
 #include <snoparse.h>
 #include <filename.h>
 #include <ctype.h>
@@ -28,6 +30,8 @@
 #endif
 
 #include "sdcaudio.h"
+#include "binlog.h"
+#include "frametimer.h"
 
 #ifdef _WIN32
 #include <winhrt.h>
@@ -36,9 +40,16 @@
 #include <pi_fstream>
 #include <pi_iostream>
 #include <pi_map>
+#include <set>
+#include <algorithm>
+#include <iterator>
 #include <pi_string>
 #include <pi_vector>
 #include <time.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 using namespace std;
 
 //const int cOBJ_BTNDIAL_SIZE = 128;
@@ -51,7 +62,22 @@ char g_FullLogFileName[256] = { 0 };
 
 //char g_runInst[128] = "";
 
-typedef map<int, ostream*> TLogMap;
+typedef set<int> TLogMap;
+
+//
+// Logging state for one run: the binary recorder, the objects whose log
+// streams are open and the object lists of the current and previous
+// frames.  The scratch vector is reused so steady state frames don't
+// allocate.
+//
+struct TRunLog
+{
+	CBinLogRecorder recorder;
+	TLogMap         openObjs;
+	vector<int>     objs;
+	vector<int>     prevObjs;
+	vector<int>     scratch;
+};
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -78,17 +104,34 @@ void Usage( void )
 	cerr << "                         INTVL => how often (in frames) to log" << endl;
 	cerr << "                         FNAME => name of file containing log" << endl;
 	cerr << "                         LG => if 0 don't log trf lights" << endl;
+	cerr << "  -blog FNAME            Binary file that receives -log and -vlog" << endl;
+	cerr << "                         data (default hcsmsys.blog)" << endl;
+	cerr << "  -blog2txt FNAME        Convert a binary log to the text files" << endl;
+	cerr << "                         -log and -vlog describe, then exit" << endl;
+	cerr << "  -ckptsave FRM FNAME    Save a checkpoint of the scenario to FNAME" << endl;
+	cerr << "                         at the end of frame FRM" << endl;
+	cerr << "  -ckptload FNAME        Restore the Hcsms from the checkpoint FNAME" << endl;
+	cerr << "                         instead of creating them from the snofile" << endl;
+	cerr << "  -ckptverify FRM N      Check that a checkpoint taken at the end of" << endl;
+	cerr << "                         frame FRM and restored runs the next N frames" << endl;
+	cerr << "                         exactly like the uninterrupted scenario" << endl;
+	cerr << "  -mc RUNS THREADS       Execute RUNS independent runs of each scenario," << endl;
+	cerr << "                         THREADS at a time, and report the throughput." << endl;
+	cerr << "                         Logging, audio and timing options are ignored" << endl;
 	cerr << "  -rt                    Run in pseudo real-time mode" << endl;
 	cerr << "  -laneDev               compute lane deviation" << endl;
+	cerr << "  -collDet               Report collisions between objects" << endl;
 	cerr << "  -verbose               If NUM non zero, run verbose mode";
 	cerr << endl;
 	cerr << "  -dbgMode NUM           NUM=0 => none, 1=>Text, 2=>Graphics, ";
 	cerr << "3=>both" << endl;
 	cerr << "  -time                  Print timing information" << endl;
 	cerr << "  -ttime                 Print timing information in CSV (for excel)" << endl;
-	cerr << "  -dtime                 Print detailed timing information" << endl;
+	cerr << "  -dtime                 Print per-phase timing percentiles" << endl;
+	cerr << "  -timeIntrvl NUM        Print per-phase timing every NUM frames" << endl;
 	cerr << "  -audio                 Play audio" << endl;
 	cerr << "  -nocurv                Disable curvature" << endl;
+	cerr << "  -adoLod                Run behaviors of Ados far from the driver at reduced rates" << endl;
 	cerr << "  -ode radius            Schedule traj follower mode transition during the run, scatter them" << endl; 
     cerr << "                             in the given radius" << endl;
 	exit(0);
@@ -104,6 +147,25 @@ public:
 	int    frames;
 };
 
+// Outcome of a run in Monte Carlo mode
+struct TMcRunResult {
+	int    m_run;
+	bool   m_ok;
+	int    m_frames;
+	int    m_numHcsm;
+	double m_secs;
+};
+
+// A scenario parsed once and shared read-only by all the runs of a
+// Monte Carlo batch (and by the two runs of -ckptverify).  This is the
+// only place where a scenario is loaded more than once; the interactive
+// path and CScenarioControl parse each file a single time, and Hcsms
+// created at run time are handed blocks that are already parsed.
+struct TMcScenario {
+	CSnoBlock          m_header;
+	vector<CSnoBlock>  m_blocks;	// the blocks after the header
+};
+
 /// global flags & variables
 int     g_CvedDebug  = 0;
 float   g_Freq       = 30.0f;
@@ -113,7 +175,9 @@ bool    g_RealTime   = false;
 bool    g_Timing     = false;
 bool    g_DetTiming  = false;
 bool    g_CSVTiming  = false;
+int     g_TimingIntrvl = 0;
 bool    g_LaneDev    = false;
+bool    g_CollDet    = false;
 bool    g_VerLog     = false;
 bool    g_VerLogLights = false;
 bool    g_DoAudio    = false;
@@ -124,7 +188,16 @@ float   g_odeRadius = 25.0f;
 
 string  g_VerLogFileName;
 int     g_VerLogIntrvl;
-FILE*   g_pVerLogFile;
+string  g_BinLogFileName = "hcsmsys.blog";
+string  g_BinLogToConvert;
+CFrameTimer g_FrameTimer;
+int     g_CkptSaveFrame = -1;
+string  g_CkptSaveFileName;
+string  g_CkptLoadFileName;
+int     g_CkptVerifyFrame  = -1;
+int     g_CkptVerifyFrames = 0;
+int     g_McRuns     = 0;
+int     g_McThreads  = 1;
 EDebugMode g_DebugMode = eDEBUG_NONE;
 CHcsmDebugItem::ELevel g_DebugLevel = CHcsmDebugItem::eDEBUG_ROUTINE;
 
@@ -243,6 +316,13 @@ void ParseCommandLineArguments( int argc, char** argv )
 			{
 				g_DetTiming = true;
 			}
+			else if( !strcmp( argv[arg], "-timeIntrvl" ) ) 
+			{
+				if( arg + 1 >= argc )  Usage();
+
+				arg++;
+				g_TimingIntrvl = atoi( argv[arg] );
+			}
 			else if( !strcmp( argv[arg], "-log" ) ) 
 			{
 				if( arg + 1 >= argc )  Usage();
@@ -312,10 +392,62 @@ void ParseCommandLineArguments( int argc, char** argv )
 				g_VerLogLights = atoi( argv[arg] ) ? true : false;
 				g_VerLog         = true;
 			}
+			else if( !strcmp( argv[arg], "-blog" ) ) 
+			{
+				if( arg + 1 >= argc ) Usage();
+				arg++;
+				g_BinLogFileName = argv[arg];
+			}
+			else if( !strcmp( argv[arg], "-blog2txt" ) ) 
+			{
+				if( arg + 1 >= argc ) Usage();
+				arg++;
+				g_BinLogToConvert = argv[arg];
+			}
+			else if( !strcmp( argv[arg], "-ckptsave" ) ) 
+			{
+				if( arg + 2 >= argc ) Usage();
+				arg++;
+				g_CkptSaveFrame    = atoi( argv[arg] );
+				arg++;
+				g_CkptSaveFileName = argv[arg];
+			}
+			else if( !strcmp( argv[arg], "-ckptload" ) ) 
+			{
+				if( arg + 1 >= argc ) Usage();
+				arg++;
+				g_CkptLoadFileName = argv[arg];
+			}
+			else if( !strcmp( argv[arg], "-ckptverify" ) ) 
+			{
+				if( arg + 2 >= argc ) Usage();
+				arg++;
+				g_CkptVerifyFrame  = atoi( argv[arg] );
+				arg++;
+				g_CkptVerifyFrames = atoi( argv[arg] );
+				if( g_CkptVerifyFrame < 0 || g_CkptVerifyFrames < 1 ) Usage();
+			}
+			else if( !strcmp( argv[arg], "-mc" ) ) 
+			{
+				if( arg + 2 >= argc ) Usage();
+				arg++;
+				g_McRuns    = atoi( argv[arg] );
+				arg++;
+				g_McThreads = atoi( argv[arg] );
+				if( g_McRuns < 1 || g_McThreads < 1 ) Usage();
+			}
 			else if( !strcmp( argv[arg], "-nocurv" ) ) 
 			{
 				CHcsmCollection::m_sDisableCurvature = true;
 			}
+			else if( !strcmp( argv[arg], "-collDet" ) )
+			{
+				g_CollDet = true;
+			}
+			else if( !strcmp( argv[arg], "-adoLod" ) )
+			{
+				CHcsmCollection::m_sAdoLod = true;
+			}
 			else if( !strcmp( argv[arg], "-ode" ) ) 
 			{
 				if( arg + 1 >= argc ) Usage();
@@ -378,7 +510,7 @@ static void InitializeCved( string lriFileName, CCved& cved )
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Dumps all CVED objects into the verification log file.  The verification
+// Dumps all CVED objects into the verification log.  The verification
 // log file is meant to be used to verify that changes to the code 
 // do not affect the outcome of the simulation.  For example, one can 
 // run a simulation creating a verification log and then implement code changes
@@ -386,8 +518,10 @@ static void InitializeCved( string lriFileName, CCved& cved )
 // outcome.  Running the same scenario file after the changes should 
 // produce the same verification log file.
 //
+// The data goes to the binary recorder; -blog2txt produces the text file.
+//
 static void
-DumpToVerLog(int frame, FILE *pF, CCved& cved)
+DumpToVerLog(int frame, TRunLog& runLog, CCved& cved)
 {
 	// first get all cved objects
 	CObjTypeMask objMask;
@@ -399,33 +533,31 @@ DumpToVerLog(int frame, FILE *pF, CCved& cved)
 		objMask.Clear(eCV_TRAFFIC_LIGHT);
 	}
 
-	vector<int>                  objs;
+	CBinLogRecorder&             log  = runLog.recorder;
+	vector<int>&                 objs = runLog.scratch;
 	vector<int>::const_iterator  pO;
 	int                          nObj;
 	
+	objs.clear();
 	cved.GetAllObjs( objs, objMask );
 	nObj = objs.size();
 
-	// three lines per object
-	fprintf(pF, "Frm: %d %d\n", frame, nObj);
+	log.LogVerFrame( frame, nObj );
 
 	for (pO=objs.begin(); pO!=objs.end(); pO++) {
 
-		// remaining two lines contain the following fields:  
-		//     name cvedId hcsmtypeid solid hcsmid
-		//     x y z tanI tanJ tanK latI latJ latK
-		fprintf(pF, "%s %d %d %d %d\n",
-			cved.GetObjName(*pO), *pO, cved.GetObjHcsmTypeId(*pO), 
-			cved.GetObjSolId(*pO), cved.GetObjHcsmId(*pO));
+		// the name is only stored when it changes
+		log.LogObjName( frame, *pO, cved.GetObjName(*pO) );
 
 		CPoint3D  objPos;
 		CVector3D objTan, objLat;
 		cved.GetObjState( *pO, objPos, objTan, objLat );
 
-		fprintf(pF, "%-9.2f %-9.2f %-9.2f %-7.4f %-7.4f %-7.4f %-7.4f %-7.4f %-7.4f\n",
-			objPos.m_x, objPos.m_y, objPos.m_z,
-			objTan.m_i, objTan.m_j, objTan.m_k,
-			objLat.m_i, objLat.m_j, objLat.m_k);
+		double pos[3] = { objPos.m_x, objPos.m_y, objPos.m_z };
+		double tan[3] = { objTan.m_i, objTan.m_j, objTan.m_k };
+		double lat[3] = { objLat.m_i, objLat.m_j, objLat.m_k };
+		log.LogVerObj( frame, *pO, cved.GetObjHcsmTypeId(*pO), 
+			cved.GetObjSolId(*pO), cved.GetObjHcsmId(*pO), pos, tan, lat );
 	}
 }
 
@@ -460,73 +592,56 @@ GetAllObjsFromCved( CCved& cved, vector<int>& objs )
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Accepts two vectors of objects and finds the objects in the 2nd vector 
-// that don't exist in the 1st vector and then opens log files for those
-// objects.
+// Finds the objects in the current frame's list that don't exist in the
+// previous frame's list and then opens log streams for those objects in
+// the binary recorder.
 //
 //////////////////////////////////////////////////////////////////////////////
 static void OpenLogFilesForNewObjs( 
 			CCved& cved,
-			vector<int>& prevObjs, 
-			vector<int>& objs, 
-			TLogMap& logFileMap )
+			int frame,
+			TRunLog& runLog )
 {
 
 	// get the difference of the 2 vectors
-	vector<int> diff( 200 );
-	vector<int>::iterator diffEnd;
-
-	diffEnd = set_difference(
-					objs.begin(),
-					objs.end(), 
-					prevObjs.begin(), 
-					prevObjs.end(),
-					diff.begin()
-					);
+	vector<int>& diff = runLog.scratch;
+	diff.clear();
+	set_difference(
+				runLog.objs.begin(),
+				runLog.objs.end(), 
+				runLog.prevObjs.begin(), 
+				runLog.prevObjs.end(),
+				back_inserter( diff )
+				);
 
 	vector<int>::iterator i;
-	for ( i = diff.begin(); i != diffEnd; i++ ) {
+	for ( i = diff.begin(); i != diff.end(); i++ ) {
 		
 		int objId = *i;
 
 		// only log objects whose name matches the name of CVED objects
 		// being logged (the name was passed in as a command-line 
 		// argument
-		string objName = cved.GetObjName( objId );
+		const char* pObjName = cved.GetObjName( objId );
 
-		if ( strcmp(g_Log.c_str(), "__all__") && objName != g_Log )  continue;
+		if ( strcmp(g_Log.c_str(), "__all__") && g_Log != pObjName )  continue;
 
 		if ( g_Verbose ) {
-			cout << "HCSM Logger: opening log file for object ";
+			cout << "HCSM Logger: opening log stream for object ";
 			cout << objId << endl;
 		}
 
-		if ( logFileMap.find( objId ) != logFileMap.end() ) {
+		if ( runLog.openObjs.find( objId ) != runLog.openObjs.end() ) {
 
-			cerr << "HCSMSYS: output file already exists...something ";
+			cerr << "HCSMSYS: output stream already exists...something ";
 			cerr << "is wrong" << endl;
 			exit( -1 );
 
 		}
 		else {
 
-			// build the file name and open the file
-			char fileName[128];
-			sprintf( fileName, "%s_%d.log", objName.c_str(), objId );
-			//string fileNameStr = objName + "_" + objIdStr + ".log";
-			string fileNameStr = fileName;
-			ofstream* pOutFile = new ofstream( fileNameStr.c_str() );
-
-			if ( !(*pOutFile) ) {
-
-				cerr << "Cannot log " << objName << " HCSM to file ";
-				cerr << "named '" << fileNameStr << endl;
-
-				exit( -1 );
-
-			}
-
-			logFileMap[ objId ] = pOutFile;
+			runLog.recorder.LogOpen( frame, objId, pObjName );
+			runLog.openObjs.insert( objId );
 
 		}
 
@@ -537,40 +652,33 @@ static void OpenLogFilesForNewObjs(
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Accepts two vectors of objects and finds the objects in the 1st vector 
-// that don't exist in the 2nd vector and then closes log files for those
-// objects.
+// Finds the objects in the previous frame's list that don't exist in the
+// current frame's list and then closes log streams for those objects.
 //
 //////////////////////////////////////////////////////////////////////////////
-static void CloseLogFilesForDeadObjs(
-			vector<int>& prevObjs, 
-			vector<int>& objs, 
-			TLogMap& logFileMap )
+static void CloseLogFilesForDeadObjs( int frame, TRunLog& runLog )
 {
 
 	// get the difference of the 2 vectors
-	vector<int> diff( 200 );
-	vector<int>::iterator diffEnd;
-
-	diffEnd = set_difference( prevObjs.begin(), prevObjs.end(), 
-							  objs.begin(), objs.end(),
-							  diff.begin() );
+	vector<int>& diff = runLog.scratch;
+	diff.clear();
+	set_difference( runLog.prevObjs.begin(), runLog.prevObjs.end(), 
+					runLog.objs.begin(), runLog.objs.end(),
+					back_inserter( diff ) );
 
 	vector<int>::iterator i;
-	for ( i = diff.begin(); i != diffEnd; i++ ) {
+	for ( i = diff.begin(); i != diff.end(); i++ ) {
 		
 		int objId = *i;
 
 		if ( g_Verbose ) {
-			cout << "HCSM Logger: looking to close file for obj ";
+			cout << "HCSM Logger: looking to close stream for obj ";
 			cout << objId << endl;
 		}
 
-		if ( logFileMap.find( objId ) != logFileMap.end() ) {
+		if ( runLog.openObjs.erase( objId ) ) {
 
-			// close the log file and erase the entry from the map
-			delete logFileMap[ objId ];
- 			logFileMap.erase( objId );
+			runLog.recorder.LogClose( frame, objId );
 
 		}
 
@@ -582,51 +690,47 @@ static void CloseLogFilesForDeadObjs(
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Closes all currently open log files.
+// Closes all currently open log streams.
 //
 //////////////////////////////////////////////////////////////////////////////
-static void CloseAllLogFiles( TLogMap& logFileMap )
+static void CloseAllLogFiles( int frame, TRunLog& runLog )
 {
 
 	TLogMap::const_iterator i;
 
-	for ( i = logFileMap.begin(); i != logFileMap.end(); i++ ) {
+	for ( i = runLog.openObjs.begin(); i != runLog.openObjs.end(); i++ ) {
 		
-		int objId = i->first;
+		int objId = *i;
 
 		if ( g_Verbose ) {
-			cout << "HCSM Logger: looking to close file for obj ";
+			cout << "HCSM Logger: looking to close stream for obj ";
 			cout << objId << endl;
 		}
 
-		// close the log file and erase the entry from the map
-		delete logFileMap[ objId ];
+		runLog.recorder.LogClose( frame, objId );
 
 	}
 
-	logFileMap.clear();
+	runLog.openObjs.clear();
 
 }
 
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Writes information to files that are open for CVED objects in the map.
+// Records the position of the CVED objects whose log streams are open.
 //
 //////////////////////////////////////////////////////////////////////////////
-static void LogCvedData( CCved& cved, TLogMap& logFileMap )
+static void LogCvedData( CCved& cved, int frame, TRunLog& runLog )
 {
 
-	TLogMap::iterator i;
-
-	for ( i = logFileMap.begin(); i != logFileMap.end(); i++ ) {
+	TLogMap::const_iterator i;
 
-		int objId          = i->first;
-		ostream* pOutFile  = i->second;
+	for ( i = runLog.openObjs.begin(); i != runLog.openObjs.end(); i++ ) {
 
+		int objId       = *i;
 		CPoint3D objPos = cved.GetObjPosInstant( objId );
-		*pOutFile << objPos.m_x << " " << objPos.m_y << " " << objPos.m_z;
-		*pOutFile << endl;
+		runLog.recorder.LogPos( frame, objId, objPos.m_x, objPos.m_y, objPos.m_z );
 
 	}
 
@@ -719,6 +823,63 @@ TestCollDet(CCved& cved)
 	printf("\n");
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Reports the pairs of objects that started colliding
+//  during the frame.
+//
+// Remarks: All the pairs are found with one pass of the broadphase,
+//  instead of one CVED query per object.  A pair is reported once for
+//  as long as the objects keep overlapping.
+//
+// Arguments:
+//  cved        - the CVED instance
+//  frm         - the current frame
+//  broadphase  - the broadphase kept across the frames of the run
+//  activePairs - (in/out) the pairs colliding at the previous frame
+//
+// Returns: the number of new collisions.
+//
+/////////////////////////////////////////////////////////////////////////////
+static int
+ReportCollisions(
+			CCved& cved,
+			int frm,
+			CCollisionBroadphase& broadphase,
+			set< pair<int, int> >& activePairs
+			)
+{
+	CObjTypeMask mask;
+	mask.Clear();
+	mask.Set( eCV_VEHICLE );
+	mask.Set( eCV_TRAJ_FOLLOWER );
+	mask.Set( eCV_WALKER );
+	mask.Set( eCV_EXTERNAL_DRIVER );
+
+	broadphase.Refresh( cved, mask );
+
+	vector<CCollisionBroadphase::TPair> pairs;
+	broadphase.FindPairs( pairs );
+
+	set< pair<int, int> > curPairs;
+	int numNew = 0;
+	vector<CCollisionBroadphase::TPair>::const_iterator i;
+	for( i = pairs.begin(); i != pairs.end(); i++ )
+	{
+		pair<int, int> p( i->obj1, i->obj2 );
+		curPairs.insert( p );
+		if( activePairs.find( p ) == activePairs.end() )
+		{
+			cout << "Fr " << frm << ": collision between objects "
+				<< i->obj1 << " and " << i->obj2 << endl;
+			numNew++;
+		}
+	}
+
+	activePairs.swap( curPairs );
+	return numNew;
+}
+
 
 #include "ScenarioControl.h"
 
@@ -1063,6 +1224,387 @@ void TemTest(
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Parses a scenario for a Monte Carlo batch.  The blocks are copied out
+// of the parser so that the runs, which execute on threads of their own,
+// only ever read them.  Returns false if the file cannot be parsed or
+// doesn't start with a header.
+//
+// Only the parse is shared, there is no precompiled scenario format: the
+// parse blocks belong to snoparse, whose only serialized form is the text
+// it reads (CSnoBlock::Store), so a binary image would still have to be
+// parsed block by block when loaded and would save nothing over keeping
+// the blocks in memory for the length of the batch.  For the same reason
+// a memory-mapped image can't be used in place: the typed parse blocks
+// the Hcsms take are built from CSnoBlock strings, and road and SOL
+// references are resolved against the CVED instance of each run.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+McLoadScenario( const CScenFile& cScen, TMcScenario& scen )
+{
+	CFileName snoFile( cScen.Name );
+	snoFile.TranslatePath( "NADSSDC_SCN" );
+
+	CSnoParser parser;
+	if( !LoadFile( snoFile.GetFullPathFileName(), parser ) ) return false;
+
+	CSnoParser::TIterator pBlock = parser.Begin();
+	if( pBlock == parser.End() || pBlock->GetBlockName() != string( "Header" ) ) 
+	{
+		return false;
+	}
+
+	scen.m_header = *pBlock;
+	scen.m_blocks.clear();
+	for( pBlock++ ; pBlock != parser.End(); pBlock++ ) 
+	{
+		scen.m_blocks.push_back( *pBlock );
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Creates the Hcsms of a scenario parsed by McLoadScenario, places the
+// static objects and adds the external driver.  Returns false if an Hcsm
+// cannot be created.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+McCreateHcsms( 
+			const TMcScenario& cScenBlks, 
+			CCved& cved, 
+			CHcsmCollection& rootCollection 
+			)
+{
+	CHeaderParseBlock hdrBlk( cScenBlks.m_header );
+
+	vector<CSnoBlock>::const_iterator pBlock;
+	for( pBlock = cScenBlks.m_blocks.begin(); pBlock != cScenBlks.m_blocks.end(); pBlock++ ) 
+	{
+		CHcsm *pH = 
+			rootCollection.CreateHcsm( pBlock->GetBlockName(), *pBlock );
+		if( pH == 0 )  return false;
+
+		if( "StaticObjManager" == pH->GetName() ) 
+		{
+			CSobjMngrParseBlock block( *pBlock );
+			StaticObjManInitialSetup( &block, cved, rootCollection, pH );
+		}
+	}
+
+	// the external driver is created after the scenario's blocks, the
+	// same as when it is appended to the parser in the interactive mode
+	if( hdrBlk.HasOwnVeh() ) 
+	{
+		CAdoParseBlock block;
+		block.SetName( "ExternalDriver" );
+		block.SetSolName( "ChevyBlazerRed" );
+		CRoadPos pos( cved, hdrBlk.GetOwnVehPos() );
+		if( pos.IsValid() )
+		{
+			block.SetRoadPos( pos.GetString() );
+			block.SetPath( hdrBlk.GetPath() );
+			if( rootCollection.CreateHcsm( block.GetBlockName(), block ) == 0 )  return false;
+		}
+	}
+
+	cved.Maintainer();
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Executes one frame without logging, audio or timing.
+//
+//////////////////////////////////////////////////////////////////////////////
+static void
+McExecuteFrame( CCved& cved, CHcsmCollection& rootCollection )
+{
+	int dyn;
+	for( dyn = 0; dyn < g_DynaMult; dyn++ ) 
+	{
+		cved.ExecuteDynamicModels();
+	}
+
+	rootCollection.ExecuteAllHcsm();
+	cved.Maintainer();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Executes one run of a Monte Carlo batch (-mc).  Each run gets its own
+// collection, which holds the scenario state, and its own CVED instance,
+// so runs can execute on threads of their own.  The run index is passed
+// to the collection, which uses it to seed the ADO random number
+// generators so every run draws from different streams, and is
+// available to the scenario as the expression variable McRun.  The
+// scenario is parsed once by McLoadScenario and shared by all runs.
+//
+//////////////////////////////////////////////////////////////////////////////
+static void
+McRunScenario( 
+			const CScenFile& cScen, 
+			const TMcScenario& cScenBlks, 
+			int run, 
+			TMcRunResult& result 
+			)
+{
+	result.m_run    = run;
+	result.m_ok     = false;
+	result.m_frames = 0;
+	result.m_secs   = 0.0;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	CHeaderParseBlock hdrBlk( cScenBlks.m_header );
+	CCved cved;
+	InitializeCved( hdrBlk.GetLriFile(), cved );
+
+	CHcsmCollection rootCollection( 1.0f / g_Freq , &cved, run );
+	rootCollection.m_rng.SetAllSeeds( 2 + run, 1 );
+	rootCollection.SetExprVariable( "McRun", run );
+
+	if( !McCreateHcsms( cScenBlks, cved, rootCollection ) )  return;
+
+	int frm;
+	for( frm = 0; frm < cScen.frames; frm++ ) 
+	{
+		McExecuteFrame( cved, rootCollection );
+
+		if( rootCollection.IsSimulationTerminated() )  break;
+	}
+
+	result.m_ok      = true;
+	result.m_frames  = frm;
+	result.m_numHcsm = rootCollection.NumHcsm();
+	result.m_secs    = chrono::duration<double>( 
+				chrono::steady_clock::now() - start 
+				).count();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Executes g_McRuns independent runs of a scenario, at most g_McThreads
+// at a time, and prints a line per run followed by the throughput.
+//
+//////////////////////////////////////////////////////////////////////////////
+static void
+RunMonteCarlo( const CScenFile& cScen )
+{
+	TMcScenario scen;
+	if( !McLoadScenario( cScen, scen ) ) 
+	{
+		cerr << cScen.Name << ": cannot open or parse the input file." << endl;
+		return;
+	}
+
+	vector<TMcRunResult> results( g_McRuns );
+	vector<thread>       threads;
+	mutex                lock;
+	condition_variable   doneCond;
+	int                  numActive = 0;
+
+	threads.reserve( g_McRuns );
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	int run;
+	for( run = 0; run < g_McRuns; run++ ) 
+	{
+		{
+			unique_lock<mutex> guard( lock );
+			while( numActive >= g_McThreads )  doneCond.wait( guard );
+			numActive++;
+		}
+
+		TMcRunResult* pResult = &results[run];
+		threads.push_back( thread( [&, run, pResult]() {
+			McRunScenario( cScen, scen, run, *pResult );
+
+			lock_guard<mutex> guard( lock );
+			numActive--;
+			doneCond.notify_one();
+		} ) );
+	}
+
+	vector<thread>::iterator pThread;
+	for( pThread = threads.begin(); pThread != threads.end(); pThread++ ) 
+	{
+		pThread->join();
+	}
+
+	double secs = chrono::duration<double>( 
+				chrono::steady_clock::now() - start 
+				).count();
+
+	int numOk = 0;
+	for( run = 0; run < g_McRuns; run++ ) 
+	{
+		const TMcRunResult& cRes = results[run];
+		cout << "  run " << cRes.m_run << ": ";
+		if( cRes.m_ok ) 
+		{
+			numOk++;
+			cout << cRes.m_frames << " frames, " << cRes.m_numHcsm;
+			cout << " hcsms, " << cRes.m_secs << " secs" << endl;
+		}
+		else 
+		{
+			cout << "FAILED" << endl;
+		}
+	}
+
+	cout << cScen.Name << ": " << numOk << " of " << g_McRuns;
+	cout << " runs completed in " << secs << " secs using ";
+	cout << g_McThreads << " threads (" << ( secs > 0.0 ? numOk / secs : 0.0 );
+	cout << " runs/sec)" << endl;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Runs a scenario from the start for frames 0 to g_CkptVerifyFrame + 
+// g_CkptVerifyFrames and takes a checkpoint at the end of each frame 
+// from g_CkptVerifyFrame on.
+//
+//////////////////////////////////////////////////////////////////////////////
+static void
+CkptVerifyRecord( 
+			const TMcScenario& cScenBlks, 
+			vector<CHcsmCheckpoint>& images, 
+			bool& ok 
+			)
+{
+	ok = false;
+
+	CHeaderParseBlock hdrBlk( cScenBlks.m_header );
+	CCved cved;
+	InitializeCved( hdrBlk.GetLriFile(), cved );
+
+	CHcsmCollection rootCollection( 1.0f / g_Freq , &cved );
+	if( !McCreateHcsms( cScenBlks, cved, rootCollection ) )  return;
+
+	int frm;
+	for( frm = 0; frm <= g_CkptVerifyFrame + g_CkptVerifyFrames; frm++ ) 
+	{
+		McExecuteFrame( cved, rootCollection );
+		if( frm >= g_CkptVerifyFrame ) 
+		{
+			rootCollection.SaveCheckpoint( images[frm - g_CkptVerifyFrame] );
+		}
+	}
+
+	ok = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Restores the first of the checkpoints taken by CkptVerifyRecord into a 
+// new CVED instance and collection, the same way -ckptload does, runs 
+// g_CkptVerifyFrames frames and compares the checkpoint taken at the end 
+// of each one with the recorded one.  Reports the first frame that 
+// differs.
+//
+//////////////////////////////////////////////////////////////////////////////
+static void
+CkptVerifyReplay( 
+			const TMcScenario& cScenBlks, 
+			vector<CHcsmCheckpoint>& images, 
+			bool& ok 
+			)
+{
+	ok = false;
+
+	CHeaderParseBlock hdrBlk( cScenBlks.m_header );
+	CCved cved;
+	InitializeCved( hdrBlk.GetLriFile(), cved );
+
+	CHcsmCollection rootCollection( 1.0f / g_Freq , &cved );
+	if( !rootCollection.RestoreCheckpoint( images[0] ) )  return;
+
+	vector<CSnoBlock>::const_iterator pBlock;
+	for( pBlock = cScenBlks.m_blocks.begin(); pBlock != cScenBlks.m_blocks.end(); pBlock++ ) 
+	{
+		if( "StaticObjManager" == pBlock->GetBlockName() ) 
+		{
+			CSobjMngrParseBlock block( *pBlock );
+			StaticObjManInitialSetup( 
+						&block, 
+						cved, 
+						rootCollection, 
+						rootCollection.GetHcsm( pBlock->GetBlockName() ) 
+						);
+		}
+	}
+	cved.Maintainer();
+
+	int i;
+	for( i = 1; i <= g_CkptVerifyFrames; i++ ) 
+	{
+		McExecuteFrame( cved, rootCollection );
+
+		CHcsmCheckpoint ckpt;
+		rootCollection.SaveCheckpoint( ckpt );
+
+		const vector<char>& cExpected = images[i].GetData();
+		const vector<char>& cActual   = ckpt.GetData();
+		size_t size = min( cExpected.size(), cActual.size() );
+		size_t pos  = mismatch( 
+						cExpected.begin(), 
+						cExpected.begin() + size, 
+						cActual.begin() 
+						).first - cExpected.begin();
+		if( pos < size || cExpected.size() != cActual.size() ) 
+		{
+			cout << "  frame " << g_CkptVerifyFrame + i << ": state differs ";
+			cout << "at byte " << pos << " of " << cExpected.size() << endl;
+			return;
+		}
+	}
+
+	ok = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Checks that restoring a checkpoint reproduces a scenario exactly
+// (-ckptverify).  The two runs use collections of their own, so the
+// replay doesn't see any state left behind by the recording.
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool
+VerifyCheckpoint( const CScenFile& cScen )
+{
+	TMcScenario scen;
+	if( !McLoadScenario( cScen, scen ) ) 
+	{
+		cerr << cScen.Name << ": cannot open or parse the input file." << endl;
+		return false;
+	}
+
+	vector<CHcsmCheckpoint> images( g_CkptVerifyFrames + 1 );
+	bool recorded = false;
+	CkptVerifyRecord( scen, images, recorded );
+	if( !recorded ) 
+	{
+		cout << cScen.Name << ": the scenario could not be run" << endl;
+		return false;
+	}
+
+	bool same = false;
+	CkptVerifyReplay( scen, images, same );
+
+	cout << cScen.Name << ": checkpoint at frame " << g_CkptVerifyFrame;
+	cout << ( same ? " reproduces " : " does not reproduce " );
+	cout << g_CkptVerifyFrames << " frames" << endl;
+
+	return same;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Program entry point.
@@ -1070,11 +1612,6 @@ void TemTest(
 //////////////////////////////////////////////////////////////////////////////
 int main( int argc, char** argv )
 {
-	short	totTimer;
-	short	dynaTimer;
-	short	behTimer;
-	short	maintTimer;
-	short   indTimer;
 	vector<CScenFile>::const_iterator pScen;
 
 	int RunHcsmExecMode( int, char ** );
@@ -1095,6 +1632,10 @@ int main( int argc, char** argv )
 	// parse command line arguments
 	ParseCommandLineArguments( argc, argv );
 
+	if ( g_BinLogToConvert.length() != 0 ) {
+		exit( ConvertBinLog( g_BinLogToConvert, g_Verbose ) ? 0 : -1 );
+	}
+
 	if ( g_FullLogFileName[0] ) {
 		pScen=g_SnoFiles.begin(); 
 		assert(pScen != g_SnoFiles.end() );
@@ -1102,6 +1643,21 @@ int main( int argc, char** argv )
 		exit(0);
 	}
 
+	if ( g_McRuns > 0 ) {
+		for( pScen = g_SnoFiles.begin(); pScen != g_SnoFiles.end(); pScen++ ) {
+			RunMonteCarlo( *pScen );
+		}
+		exit(0);
+	}
+
+	if ( g_CkptVerifyFrame >= 0 ) {
+		bool ok = true;
+		for( pScen = g_SnoFiles.begin(); pScen != g_SnoFiles.end(); pScen++ ) {
+			if( !VerifyCheckpoint( *pScen ) )  ok = false;
+		}
+		exit( ok ? 0 : -1 );
+	}
+
 	bool logging = ( g_Log.length() != 0 );
 
 
@@ -1136,15 +1692,6 @@ int main( int argc, char** argv )
 		}
 	}
 
-#ifdef _WIN32
-	totTimer   = hrt_timer_alloc(HRT_MICROSECOND, "");
-	dynaTimer  = hrt_timer_alloc(HRT_MICROSECOND, "");
-	behTimer   = hrt_timer_alloc(HRT_MICROSECOND, "");
-	maintTimer = hrt_timer_alloc(HRT_MICROSECOND, "");
-
-	indTimer   = hrt_timer_alloc(HRT_MICROSECOND, "");
-#endif
-
 	if ( g_DoAudio ) {
 		if ( !InitAudio() ) {
 			g_DoAudio = false;
@@ -1212,9 +1759,36 @@ int main( int argc, char** argv )
 		// Start the remaining hcsms on a new instance of an HCSM collection
 		CHcsmCollection rootCollection( 1.0f / g_Freq , &cved );
 
+		if( g_CkptLoadFileName.length() != 0 ) 
+		{
+			if( !rootCollection.RestoreCheckpoint( g_CkptLoadFileName ) ) 
+			{
+				cerr << "CHcsmCollection::RestoreCheckpoint(";
+				cerr << g_CkptLoadFileName << ") failed." << endl;
+				exit( -1 );
+			}
+		}
+
 		pBlock = parser.Begin();
 		for( pBlock++ ; pBlock != parser.End(); pBlock++ ) 
 		{
+			if( g_CkptLoadFileName.length() != 0 ) 
+			{
+				// the Hcsms come from the checkpoint, only the static
+				// objects have to be placed
+				if( "StaticObjManager" == pBlock->GetBlockName() ) 
+				{
+					CSobjMngrParseBlock block( *pBlock );
+					StaticObjManInitialSetup( 
+								&block, 
+								cved, 
+								rootCollection, 
+								rootCollection.GetHcsm( pBlock->GetBlockName() ) 
+								);
+				}
+				continue;
+			}
+
 			if( g_Verbose ) 
 			{
 				cout << "[" << rootCollection.GetFrame();
@@ -1245,55 +1819,40 @@ int main( int argc, char** argv )
 		//
 		// Logging stuff.
 		//
-		vector<int> objs;
-		vector<int> prevObjs;
-		TLogMap logFileMap;
-		if( logging ) 
-		{	
-			GetAllObjsFromCved( cved, objs );
-
-			// Open log files for newly created CVED objects and close log
-			// files for CVED objects that have been deleted since the last
-			// frame.
-			OpenLogFilesForNewObjs( cved, prevObjs, objs, logFileMap );
-			CloseLogFilesForDeadObjs( prevObjs, objs, logFileMap );
-		}
-
-		if( g_VerLog ) 
+		TRunLog runLog;
+		if( logging || g_VerLog ) 
 		{
-			g_pVerLogFile = fopen( g_VerLogFileName.c_str(), "w" );
-			if( g_pVerLogFile == 0 ) 
+			if( !runLog.recorder.Open( g_BinLogFileName, g_VerLogFileName ) ) 
 			{
-				perror( "Can't open output verification log file" );
 				exit( -1 );
 			}
 		}
 
-#ifdef _WIN32
-		hrt_timer_start(totTimer);
-
-		hrt_timer_start(dynaTimer);
-		hrt_timer_suspend(dynaTimer);
-		hrt_timer_start(behTimer);
-		hrt_timer_suspend(behTimer);
-		hrt_timer_start(maintTimer);
-		hrt_timer_suspend(maintTimer);
-		
-		vector<double> dynaTimes;
-		vector<double> behavTimes;
-		vector<double> maintTimes;
-
-		if ( g_DetTiming ) {
-			dynaTimes.reserve(g_DynaMult * pScen->frames);
-			behavTimes.reserve(pScen->frames);
-			maintTimes.reserve(pScen->frames);
+		if( logging ) 
+		{	
+			GetAllObjsFromCved( cved, runLog.objs );
+
+			// Open log streams for newly created CVED objects and close log
+			// streams for CVED objects that have been deleted since the last
+			// frame.
+			OpenLogFilesForNewObjs( cved, 0, runLog );
+			CloseLogFilesForDeadObjs( 0, runLog );
 		}
-#endif
+
+		g_FrameTimer.Start( 1.0 / g_Freq, g_TimingIntrvl );
 
 		if( g_DoAudio )  InitAudioForRun( &cved );
 
-		int frm;
-		for( frm = 0; frm < pScen->frames; frm++ ) 
+		CCollisionBroadphase  collBroadphase;
+		set< pair<int, int> > collPairs;
+		int numCollisions = 0;
+
+		// a restored scenario picks up at the frame after the one the
+		// checkpoint was taken at
+		int frm = 0;
+		if( g_CkptLoadFileName.length() != 0 )  frm = rootCollection.GetFrame() - 1;
+
+		for( ; frm < pScen->frames; frm++ ) 
 		{
 #ifdef sgi
 			struct timeval tm1, tm2;
@@ -1317,89 +1876,81 @@ int main( int argc, char** argv )
 				hrt_alarm_set( alarmHandle, periodMicroSecs, HRT_ONCE );
 			}
 #endif
+			TFrameTime frameStart = CFrameTimer::Now();
+			TFrameTime phaseStart;
+
 			if( g_Verbose ) 
 			{
 				cout << "### EXECUTING FRAME " << frm << " ###" << endl;
 			}
 
 			// Execute dynamics and logging g_DynaMult times per frame.
-#ifdef _WIN32
-			int dyn;
-			for( dyn = 0; dyn < g_DynaMult; dyn++ ) 
-			{
-				hrt_timer_start( indTimer );
-				hrt_timer_resume( dynaTimer );
-
-				cved.ExecuteDynamicModels();
-
-				hrt_timer_suspend( dynaTimer );
-				hrt_timer_stop( indTimer );
-				if( logging )  LogCvedData( cved, logFileMap );
-				if( g_DetTiming && frm > 0 ) 
-				{
-					dynaTimes.push_back(hrt_timer_lastelapsedsecs(indTimer)*1000.0);
-				}
-			}
-#else
+			//
+			// The phases run in sequence on purpose.  The behaviors read
+			// the poses the dynamics write, write the controls the dynamics
+			// read and create and delete the objects the dynamics step, all
+			// through the same CCved, and nothing in CVED keeps the two
+			// apart within a frame.  Overlapping the dynamics with the
+			// behaviors would need CVED to hand out a snapshot of object
+			// state and controls and commit it in Maintainer, so there is
+			// no pipelined frame mode.
 			int dyn;
 			for( dyn = 0; dyn < g_DynaMult; dyn++ ) 
 			{
+				phaseStart = CFrameTimer::Now();
 				cved.ExecuteDynamicModels();
-				if( logging )  LogCvedData( cved, logFileMap );
+				g_FrameTimer.Record( ePHASE_DYNAMICS, phaseStart );
+				if( logging )  LogCvedData( cved, frm, runLog );
 			}
-#endif
 
 //			TestCollDet(cved);
 
 			// Execute HCSMs 1 time per frame
-#ifdef _WIN32
-			hrt_timer_start( indTimer );
-			hrt_timer_resume( behTimer );
-			rootCollection.ExecuteAllHcsm();
-			hrt_timer_suspend( behTimer );
-			hrt_timer_stop( indTimer );
-			if( g_DetTiming && frm > 0 ) 
-			{
-				double f = hrt_timer_lastelapsedsecs(indTimer)*1000.0;
-				behavTimes.push_back(hrt_timer_lastelapsedsecs(indTimer)*1000.0);
-			}
-#else
+			phaseStart = CFrameTimer::Now();
 			rootCollection.ExecuteAllHcsm();
-#endif
+			g_FrameTimer.Record( ePHASE_BEHAVIORS, phaseStart );
 
+			phaseStart = CFrameTimer::Now();
 			dumpDebugInfo( rootCollection );
+			phaseStart = g_FrameTimer.Record( ePHASE_DEBUG_DUMP, phaseStart );
 
-#ifdef _WIN32
-			hrt_timer_start( indTimer );
-			hrt_timer_resume( maintTimer );
-			cved.Maintainer();
-			hrt_timer_suspend( maintTimer );
-			hrt_timer_stop( indTimer );
-#else
 			cved.Maintainer();
-#endif
+			g_FrameTimer.Record( ePHASE_MAINTAINER, phaseStart );
 
-			if( g_DetTiming && frm > 0  ) 
+			if( g_CollDet ) 
 			{
-				maintTimes.push_back(hrt_timer_lastelapsedsecs(indTimer)*1000.0);
+				numCollisions += ReportCollisions( cved, frm, collBroadphase, collPairs );
 			}
 
 			if( g_VerLog && (frm % g_VerLogIntrvl) == 0 ) 
 			{
-				DumpToVerLog( frm, g_pVerLogFile, cved );
+				phaseStart = CFrameTimer::Now();
+				DumpToVerLog( frm, runLog, cved );
+				g_FrameTimer.Record( ePHASE_VERLOG, phaseStart );
+			}
+
+			if( frm == g_CkptSaveFrame ) 
+			{
+				if( !rootCollection.SaveCheckpoint( g_CkptSaveFileName ) ) 
+				{
+					cerr << "CHcsmCollection::SaveCheckpoint(";
+					cerr << g_CkptSaveFileName << ") failed." << endl;
+				}
 			}
 
 			if( g_DoAudio ) 
 			{
+				phaseStart = CFrameTimer::Now();
 				AudioExec();
+				g_FrameTimer.Record( ePHASE_AUDIO, phaseStart );
 			}
 
 			// Update the 'place' phonecall flag
-			if( CHcsmCollection::m_sSCC_PlacePhoneCall ) 
+			if( rootCollection.m_ctx.m_sSCC_PlacePhoneCall ) 
 			{
-				if( frm > CHcsmCollection::m_sPlacePhoneCallAge + 200 ) 
+				if( frm > rootCollection.m_ctx.m_sPlacePhoneCallAge + 200 ) 
 				{
-					CHcsmCollection::m_sSCC_PlacePhoneCall = 0;
+					rootCollection.m_ctx.m_sSCC_PlacePhoneCall = 0;
 				}
 			}
 
@@ -1484,19 +2035,21 @@ int main( int argc, char** argv )
 				// This statement exists because on the Concurrent, if 
 				// 	objs is empty and it is assigned to prevObjs, a 
 				// 	segmentation fault occurs.
-				prevObjs.clear();
+				runLog.prevObjs.clear();
 
-				prevObjs = objs;
-				GetAllObjsFromCved( cved, objs );
+				runLog.prevObjs.swap( runLog.objs );
+				GetAllObjsFromCved( cved, runLog.objs );
 
-				// Open log files for newly created CVED objects and close log
-				// files for CVED objects that have been deleted since the last
+				// Open log streams for newly created CVED objects and close log
+				// streams for CVED objects that have been deleted since the last
 				// frame.
-				OpenLogFilesForNewObjs( cved, prevObjs, objs, logFileMap );
-				CloseLogFilesForDeadObjs( prevObjs, objs, logFileMap );
+				OpenLogFilesForNewObjs( cved, frm, runLog );
+				CloseLogFilesForDeadObjs( frm, runLog );
 
 			}
 
+			g_FrameTimer.EndFrame( frm, frameStart, stdout );
+
 #ifdef sgi
 			if ( g_RealTime ) {
 				gettimeofday(&tm2);
@@ -1524,50 +2077,42 @@ int main( int argc, char** argv )
 
 		}
 
+
+		if( g_CollDet ) 
+		{
+			cout << "Collisions: " << numCollisions << endl;
+		}
+
 		if ( logging ) {
 
-			// close all log files
-			CloseAllLogFiles( logFileMap );
+			// close all log streams
+			CloseAllLogFiles( frm, runLog );
 
 		}
 
-		if ( g_VerLog ) {
-			fclose(g_pVerLogFile);
-		}
+		// flushes the remaining blocks and waits for the writer thread
+		runLog.recorder.Close();
 
 		if ( g_DoAudio ) {
 			TermAudioForRun();
 		}
 
-#ifdef _WIN32
-		hrt_timer_stop(totTimer);
-		hrt_timer_stop(behTimer);
-		hrt_timer_stop(dynaTimer);
-		hrt_timer_stop(maintTimer);
-
 		if ( g_Timing ) {
 			string info;
-			double   behTime   = hrt_timer_elapsedsecs(behTimer);
-			double   dynaTime  = hrt_timer_elapsedsecs(dynaTimer);
-			double   maintTime = hrt_timer_elapsedsecs(maintTimer);
-			double   overhead  = hrt_timer_elapsedsecs(totTimer) 
-				- (behTime + dynaTime + maintTime);
+			double   behTime   = g_FrameTimer.GetPhaseSecs( ePHASE_BEHAVIORS );
+			double   dynaTime  = g_FrameTimer.GetPhaseSecs( ePHASE_DYNAMICS );
+			double   maintTime = g_FrameTimer.GetPhaseSecs( ePHASE_MAINTAINER );
+			double   overhead  = g_FrameTimer.GetOverheadSecs();
 
 			cved.QryTerrainPerfCheck(info, true);
 			if ( g_CSVTiming ) {
-				printf("%s,%.2f,%.2f,%.2f,%.2f,%.2f\n", 
-					pScen->Name.c_str(),
-					behTime,
-					maintTime,
-					dynaTime,
-					overhead,
-					hrt_timer_elapsedsecs(totTimer));
+				g_FrameTimer.ReportCsv( stdout, pScen->Name.c_str() );
 			}
 			else {
 				printf("======================== Timing report ==========================\n");
 				printf(": \n");
 				printf("Frames executed  :  %d, wall-clock time: %.2f, sim time: %.2f\n",
-						frm, hrt_timer_elapsedsecs(totTimer), frm / g_Freq);
+						frm, g_FrameTimer.GetRunSecs(), frm / g_Freq);
 				printf("Behaviors time   :  %6.2f secs,  (%5.2f mSec/iter)\n",
 					behTime, 1000.0 * behTime / frm);
 				printf("Maintainer time  :  %6.2f secs,  (%5.2f mSec/iter)\n",
@@ -1576,31 +2121,15 @@ int main( int argc, char** argv )
 					dynaTime, 1000.0 * dynaTime / frm);
 				printf("Hcsmsys overhead :  %6.2f secs,  (%5.2f mSec/iter)\n\n",
 					overhead, 1000.0 * overhead / frm);
+				g_FrameTimer.Report( stdout, true );
 				printf("%s\n", info.c_str());
 				printf("==================================================================\n");
 			}
 		}
 
-		if ( g_DetTiming ) {
-			fprintf(stderr, "Detailed timing: behav maint dyna [dyna ...] total %d %d\n",
-				behavTimes.size(), dynaTimes.size());
-			double tot;
-
-			for (unsigned int i=0; i<behavTimes.size(); i++) {
-				tot = 0.0;
-				printf("%6.3f %6.3f ", behavTimes[i], maintTimes[i]);
-				tot += behavTimes[i];
-				tot += maintTimes[i];
-
-				for (int j=0; j<g_DynaMult; j++) {
-					printf("%6.3f ", dynaTimes[i * g_DynaMult + j]);
-					tot += dynaTimes[i * g_DynaMult + j];
-				}
-
-				printf("%6.2f\n", tot);
-			}
+		if ( g_DetTiming && ( !g_Timing || g_CSVTiming ) ) {
+			g_FrameTimer.Report( stdout, true );
 		}
-#endif
 
 	}  // end for (iterate across all scenario files)
 
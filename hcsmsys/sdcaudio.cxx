@@ -14,13 +14,14 @@
 //////////////////////////////////////////////////////////////////////////////
 #include "stdafx.h"
 #include "sdcaudio.h"
+#include <proximitytracker.h>
 
 // Audio specific global variables
 static const CSol*        m_pSol;
-static const CCved*       m_pCved;
+static CCved*             m_pCved;
 
 static long               m_Tick;
-static vector<int>        m_Objs;			// objects available at this run
+static CProximityTracker  m_Near;			// objects around the driver
 
 
 
@@ -139,8 +140,6 @@ InternalAudioProc(
 bool
 InitAudio()
 {
-	m_Objs.reserve(300);
-
 	return true;
 }
 
@@ -164,12 +163,12 @@ InitAudio()
 // handle will remain valid until TermAudioForRun is called.
 //
 void
-InitAudioForRun(const CCved*  pC)
+InitAudioForRun(CCved*  pC)
 {
 	m_pCved = pC;
 	m_pSol  = &m_pCved->GetSol();
 
-	m_Objs.clear();
+	m_Near.Reset();
 	m_Tick = 0;
 }
 
@@ -190,11 +189,6 @@ AudioExec()
 	CPoint3D     driverPos;
 	double       radius = 1000.0;	// how far around the driver to look
 
-	static vector<int>  temp;		// temporary buffer space
-	static vector<int>  newObjs;	// list of newly created objects
-	static vector<int>  delObjs;	// deleted objects
-	static vector<int>  objs;		// objects remaining active
-
 	if ( !m_pCved->GetOwnVehiclePos( driverPos) ) {
 		driverPos.m_x = -11914;
 		driverPos.m_y = 2349;
@@ -210,46 +204,19 @@ AudioExec()
 	mask.Clear(eCV_TRAFFIC_SIGN);
 	mask.Clear(eCV_COORDINATOR);
 
-//	m_pCved->GetObjsNear(driverPos, radius, temp, mask);
-	cerr << "@@@@ AudioExec: CVED doesn't support GetObjsNear" << endl;
-	assert( 0 );
-
-	unsigned int i, j;
-
-	newObjs.clear();
-	delObjs.clear();
-	objs.clear();
-
-	for (i=0; i<temp.size(); i++) {
-		bool found = false;
-		for (j=0; j<m_Objs.size(); j++) {
-			if ( temp[i] == m_Objs[j] ) {
-				found = true;
-				break;
-			}
-		}
-		if ( found ) 
-			objs.push_back(temp[i]);
-		else
-			newObjs.push_back(temp[i]);
-	
-	}
+	m_Near.SetRadius( radius );
+	m_Near.Update( *m_pCved, driverPos, mask );
 
-	for (i=0; i<m_Objs.size(); i++) {
-		bool found = false;
-		for (j=0; j<temp.size(); j++) {
-			if ( m_Objs[i] == temp[j] ) {
-				found = true;
-				break;
-			}
-		}
-		if ( !found ) delObjs.push_back(m_Objs[i]);
-	}
+	const vector<int>& newObjs = m_Near.Entered();
+	const vector<int>& delObjs = m_Near.Exited();
+	const vector<int>& objs    = m_Near.Stayed();
 
 	InternalAudioProc(m_Tick, objs, newObjs, delObjs);
 
 	// debug printing
 #if 0
+	unsigned int i;
+
 	printf("\n--- Frame %d\n", m_Tick);
 
 	if ( newObjs.size() > 0 ) {
@@ -270,9 +237,6 @@ AudioExec()
 		printf("\n");
 	}
 #endif
-
-	// preparing for next time
-	m_Objs = temp;
 }
 
 
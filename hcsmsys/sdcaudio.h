@@ -16,7 +16,7 @@
 // NOTE: file assumes it is included after cved header files
 
 bool InitAudio();
-void InitAudioForRun(const CCved *);
+void InitAudioForRun(CCved *);
 void AudioExec();
 void TermAudioForRun();
 void TermAudio();
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: main.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  Converts a recorded driver trace, i.e. the pair of DAQ
+ *   position and orientation text files read by the DaqDriver HCSM, to a
+ *   single binary trace.  The scenario then names the binary trace as
+ *   the driver position file and DaqDriver maps it instead of parsing
+ *   the text files.
+ *
+ *   Usage: daqtraceconv <pos file> <ori file> <output file>
+ *
+ *   Builds with hcsm/usersrc/daqtrace.cxx.  On Windows use
+ *   winnt/daqtraceconv.vcxproj.  Elsewhere compile both files with
+ *   hcsm/usersrc and the CVED include directory (the include directory
+ *   next to this tree, as for the other projects) on the include path,
+ *   and link with the CVED and misc libraries.
+ *
+ ****************************************************************************/
+
+#include <pi_iostream>
+#include <daqtrace.h>
+
+using namespace std;
+
+int
+main( int argc, char* argv[] )
+{
+	if ( argc != 4 ) {
+		cerr << "Usage: " << argv[0];
+		cerr << " <pos file> <ori file> <output file>" << endl;
+		return 1;
+	}
+
+	if ( !CDaqTrace::Convert( argv[1], argv[2], argv[3], cerr ) ) {
+		return 1;
+	}
+
+	//
+	// Read the result back as DaqDriver would.
+	//
+	CDaqTrace trace;
+	if ( !trace.Open( argv[3], "" ) ) {
+		return 1;
+	}
+
+	cout << "Wrote " << trace.NumSamples() << " samples, frames ";
+	cout << trace.GetSample( 0 ).frame << " to ";
+	cout << trace.GetSample( trace.NumSamples() - 1 ).frame;
+	cout << ", to '" << argv[3] << "'" << endl;
+
+	return 0;
+}
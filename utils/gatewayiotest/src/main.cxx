@@ -0,0 +1,254 @@
+/*****************************************************************************
+ *
+ * (C) Copyright 1998 by National Advanced Driving Simulator and
+ * Simulation Center, the University of Iowa and The University
+ * of Iowa. All rights reserved.
+ *
+ * Version: $Id: main.cxx,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:    October, 2026
+ *
+ * Description:  Checks the TMessage side of CGatewayIo over the loopback
+ *   interface.  The program plays both the frame thread and a client:
+ *
+ *   - a CONTROLOBJ message is sent a few bytes at a time and must come
+ *     out of PopCommand exactly once, followed by one acknowledgment;
+ *   - a GETDYNAOBJS request, sent in the same write as a second
+ *     CONTROLOBJ, must be answered with every object intact although
+ *     the reply is much larger than the socket buffers and the client
+ *     only starts reading after a while.
+ *
+ *   Usage: gatewayiotest [port]
+ *
+ *   Builds with hcsm/gatewayio.cxx, hcsm/hcsmwireserver.cxx,
+ *   hcsm/hcsmwire.cxx and hcsm/sockcode.cxx.  On Windows use
+ *   winnt/gatewayiotest.vcxproj.  Elsewhere compile those files and this
+ *   one with hcsm and the CVED include directory (the include directory
+ *   next to this tree, as for the other projects) on the include path,
+ *   and link with the CVED and misc libraries and the thread library.
+ *
+ ****************************************************************************/
+
+#include <gatewayio.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#endif
+
+using namespace std;
+
+// objects in the GETDYNAOBJS reply, enough to fill several socket buffers
+const int cNUM_OBJS = 20000;
+
+static int s_Frame = 0;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Runs the frame thread's side of the gateway for a number
+//  of frames, collecting every control command and answering object
+//  requests with cNUM_OBJS objects whose ids count up from 0.
+//
+static void
+RunFrames( CGatewayIo& io, int numFrames, vector<TWireControl>& controls )
+{
+	for ( int i = 0; i < numFrames; i++, s_Frame++ ) {
+		TWireControl control;
+		while ( io.PopCommand( control ) ) {
+			controls.push_back( control );
+		}
+
+		TGatewaySnapshot* pSnapshot = io.BeginSnapshot( s_Frame );
+		if ( pSnapshot ) {
+			if ( pSnapshot->hasDynaObjs ) {
+				pSnapshot->dynaObjs.resize( cNUM_OBJS );
+				for ( int id = 0; id < cNUM_OBJS; id++ ) {
+					memset( &pSnapshot->dynaObjs[id], 0, sizeof(TObjDesc) );
+					pSnapshot->dynaObjs[id].id = htonl( id );
+				}
+			}
+			io.EndSnapshot( pSnapshot );
+		}
+
+		this_thread::sleep_for( chrono::milliseconds( 2 ) );
+	}
+}
+
+
+static bool
+SendAll( SOCKET sock, const unsigned char* cpData, int size )
+{
+	while ( size > 0 ) {
+		int n = send( sock, (const char*) cpData, size, 0 );
+		if ( n <= 0 ) return false;
+		cpData += n;
+		size   -= n;
+	}
+	return true;
+}
+
+
+static bool
+RecvAll( SOCKET sock, void* pData, int size )
+{
+	char* pBuf = (char*) pData;
+	while ( size > 0 ) {
+		int n = recv( sock, pBuf, size, 0 );
+		if ( n <= 0 ) return false;
+		pBuf += n;
+		size -= n;
+	}
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Description: Appends a message to a buffer, in the format SendMessage
+//  uses.
+//
+static void
+AddMessage( vector<unsigned char>& buf, int cmd, const void* cpBody, int size )
+{
+	TMsgHeader head;
+	head.m_StartMark = htons( START_MARK );
+	head.m_OpCode    = htons( cmd );
+	head.m_MsgLen    = htonl( size + sizeof(head) );
+
+	const unsigned char* cpHead = (const unsigned char*) &head;
+	buf.insert( buf.end(), cpHead, cpHead + sizeof(head) );
+	if ( size > 0 ) {
+		const unsigned char* cpData = (const unsigned char*) cpBody;
+		buf.insert( buf.end(), cpData, cpData + size );
+	}
+}
+
+
+static void
+AddControl( vector<unsigned char>& buf, int cmd, int hcsmId, int val )
+{
+	int ints[3];
+	ints[0] = htonl( cmd );
+	ints[1] = htonl( hcsmId );
+	ints[2] = htonl( val );
+	AddMessage( buf, CMD_CONTROLOBJ, ints, sizeof(ints) );
+}
+
+
+static bool
+ReadReply( SOCKET sock, TMessage& msg )
+{
+	if ( !RecvAll( sock, &msg.header, sizeof(msg.header) ) ) return false;
+
+	int opCode = ntohs( msg.header.m_OpCode );
+	int len    = ntohl( msg.header.m_MsgLen ) - sizeof(msg.header);
+	if ( opCode != CMD_ACKOK || len < 0 || len > (int) sizeof(msg.data) ) {
+		return false;
+	}
+
+	return RecvAll( sock, msg.data.bytes, len );
+}
+
+
+static bool
+Check( bool ok, const char* cpWhat )
+{
+	printf( "%s: %s\n", ok ? "ok  " : "FAIL", cpWhat );
+	return ok;
+}
+
+
+int
+main( int argc, char* argv[] )
+{
+	int port = argc > 1 ? atoi( argv[1] ) : 45300;
+
+	CGatewayIo io;
+	if ( !io.Start( port, port + 1 ) ) {
+		fprintf( stderr, "cannot listen on port %d\n", port );
+		return 1;
+	}
+
+	SOCKET sock = ConnectToSocket( "127.0.0.1", port );
+	if ( sock < 0 ) {
+		fprintf( stderr, "cannot connect to port %d\n", port );
+		io.Stop();
+		return 1;
+	}
+
+	bool ok = true;
+	vector<TWireControl> controls;
+	static TMessage msg;
+
+	//
+	// A control command trickling in a few bytes at a time.
+	//
+	vector<unsigned char> buf;
+	AddControl( buf, 2, 77, -5 );
+	for ( size_t i = 0; i < buf.size(); i += 3 ) {
+		int size = buf.size() - i < 3 ? (int) ( buf.size() - i ) : 3;
+		SendAll( sock, &buf[i], size );
+		RunFrames( io, 2, controls );
+	}
+	RunFrames( io, 10, controls );
+
+	ok &= Check( controls.size() == 1, "split CONTROLOBJ queued once" );
+	ok &= Check( controls.size() == 1 && controls[0].cmd == 2 &&
+			controls[0].hcsmId == 77 && controls[0].val == -5,
+			"split CONTROLOBJ decoded" );
+	ok &= Check( ReadReply( sock, msg ) &&
+			ntohl( msg.header.m_MsgLen ) == sizeof(msg.header),
+			"split CONTROLOBJ acknowledged" );
+
+	//
+	// A second control and an object request in one write, with the
+	// client not reading until the reply has backed up.
+	//
+	buf.clear();
+	AddControl( buf, 3, 78, 9 );
+	AddMessage( buf, CMD_GETDYNAOBJS, 0, 0 );
+	SendAll( sock, &buf[0], (int) buf.size() );
+
+	controls.clear();
+	RunFrames( io, 50, controls );
+	ok &= Check( controls.size() == 1 && controls[0].hcsmId == 78,
+			"CONTROLOBJ followed by GETDYNAOBJS" );
+	ok &= Check( ReadReply( sock, msg ), "CONTROLOBJ acknowledged" );
+
+	thread frames( RunFrames, ref( io ), 500, ref( controls ) );
+	this_thread::sleep_for( chrono::milliseconds( 200 ) );
+
+	int package[4];
+	bool replyOk = ReadReply( sock, msg );
+	memcpy( package, msg.data.bytes, sizeof(package) );
+	int numObjs     = ntohl( package[0] );
+	int numMessages = ntohl( package[1] );
+	int perMessage  = ntohl( package[2] );
+	int inLast      = ntohl( package[3] );
+	replyOk &= numObjs == cNUM_OBJS;
+
+	int nextId = 0;
+	for ( int k = 0; replyOk && k < numMessages; k++ ) {
+		replyOk &= ReadReply( sock, msg );
+		int n = k == numMessages - 1 ? inLast : perMessage;
+		for ( int i = 0; replyOk && i < n; i++ ) {
+			replyOk &= (int) ntohl( msg.data.objs[i].id ) == nextId++;
+		}
+	}
+	frames.join();
+
+	ok &= Check( replyOk && nextId == cNUM_OBJS, "large GETDYNAOBJS reply intact" );
+
+	CloseSocket( sock );
+	io.Stop();
+
+	return ok ? 0 : 1;
+}